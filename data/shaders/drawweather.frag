@@ -0,0 +1,19 @@
+#version 150
+
+in vec2        fPosition;
+flat in ivec2  fOrigin;
+flat in ivec2  fSpacing;
+flat in uint   fColour;
+
+out uint oColour;
+
+void main()
+{
+    // Only the pixels on the pattern's lattice are particles
+    ivec2 offset = ivec2(fPosition) - fOrigin;
+    if (offset.x % fSpacing.x != 0 || offset.y % fSpacing.y != 0)
+    {
+        discard;
+    }
+    oColour = fColour;
+}
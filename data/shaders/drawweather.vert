@@ -0,0 +1,35 @@
+#version 150
+
+// Allows for about 8 million draws per frame
+const float DEPTH_INCREMENT = 1.0 / float(1u << 22u);
+
+uniform ivec2 uScreenSize;
+
+in ivec4 vBounds;
+in ivec2 vSpacing;
+in uint  vColour;
+in int   vDepth;
+
+out vec2        fPosition;
+flat out ivec2  fOrigin;
+flat out ivec2  fSpacing;
+flat out uint   fColour;
+
+void main()
+{
+    // Each instance is a quad over its bounds, with the corners taken from the vertex index
+    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+    vec2 pos = mix(vec2(vBounds.xy), vec2(vBounds.zw), corner);
+
+    fPosition = pos;
+    fOrigin = vBounds.xy;
+    fSpacing = vSpacing;
+    fColour = vColour;
+
+    // Transform screen coordinates to viewport coordinates
+    pos = (pos * (2.0 / uScreenSize)) - 1.0;
+    pos.y *= -1;
+    float depth = 1.0 - (vDepth + 1) * DEPTH_INCREMENT;
+
+    gl_Position = vec4(pos, depth, 1.0);
+}
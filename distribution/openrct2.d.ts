@@ -183,17 +183,46 @@ declare global {
          */
         getRandom(min: number, max: number): number;
 
+        /**
+         * Gets how long each stage of the game logic took over the last recorded ticks.
+         * The stages are returned in the order they run, followed by an entry named
+         * "total" for the whole tick.
+         */
+        getTickProfile(): TickProfileStage[];
+
+        /**
+         * Gets how long each loaded plugin, and each hook it subscribes to, has taken to run so far.
+         */
+        getPerformanceStats(): PluginPerformanceStats[];
+
+        /**
+         * Gets how much memory the larger subsystems of the game hold, such as the tile elements,
+         * sprites, object images and plugin heaps.
+         */
+        getMemoryReport(): MemoryReportEntry[];
+
+        /**
+         * Starts a worker that runs the given script on a background thread. The worker has no
+         * access to the game or the plugin API, it can only exchange messages with the plugin.
+         * @param code The script to run. It receives messages through a global onmessage function
+         * and replies by calling the global postMessage function.
+         */
+        createWorker(code: string): Worker;
+
         /**
          * Registers a new game action that allows clients to interact with the game.
          * @param action The unique name of the action.
          * @param query Logic for validating and returning a price for an action.
          * @param execute Logic for validating and executing the action.
+         * @param schema The type of each argument of the action. When given, the arguments are sent
+         * in a compact binary form instead of JSON, and only the fields in the schema are sent.
          * @throws An error if the action has already been registered by this or another plugin.
          */
         registerAction(
             action: string,
             query: (args: object) => GameActionResult,
-            execute: (args: object) => GameActionResult): void;
+            execute: (args: object) => GameActionResult,
+            schema?: { [name: string]: ActionArgumentType }): void;
 
         /**
          * Query the result of running a game action. This allows you to check the outcome and validity of
@@ -230,8 +259,29 @@ declare global {
         subscribe(hook: "network.leave", callback: (e: NetworkEventArgs) => void): IDisposable;
         subscribe(hook: "ride.ratings.calculate", callback: (e: RideRatingsCalculateArgs) => void): IDisposable;
         subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void): IDisposable;
+
+        /**
+         * Subscribes to the ratings calculation of a single ride only, the callback is
+         * not called for any other ride.
+         */
+        subscribe(hook: "ride.ratings.calculate", callback: (e: RideRatingsCalculateArgs) => void,
+            options: { ride: number }): IDisposable;
+
+        /**
+         * Subscribes to location checks within an area of the map only, the callback is
+         * not called for locations outside the area.
+         */
+        subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void,
+            options: { area: MapRange }): IDisposable;
+        /**
+         * Called once per tick with all the actions that were executed since the last call, instead of once
+         * per action like action.execute.
+         */
+        subscribe(hook: "action.execute.batch", callback: (e: GameActionBatchEventArgs) => void): IDisposable;
     }
 
+    type ActionArgumentType = "bool" | "int8" | "uint8" | "int16" | "uint16" | "int32" | "uint32" | "float64" | "string";
+
     interface Configuration {
         getAll(namespace: string): { [name: string]: any };
         get<T>(key: string): T | undefined;
@@ -240,6 +290,86 @@ declare global {
         has(key: string): boolean;
     }
 
+    interface PluginCallStats {
+        /**
+         * The number of times the plugin was called.
+         */
+        calls: number;
+
+        /**
+         * The total time spent in the calls, in milliseconds.
+         */
+        totalTime: number;
+
+        /**
+         * The longest time spent in a single call, in milliseconds.
+         */
+        longestTime: number;
+    }
+
+    interface PluginPerformanceStats extends PluginCallStats {
+        /**
+         * The name of the plugin.
+         */
+        name: string;
+
+        /**
+         * The time spent in the plugin during the last tick it ran in, in milliseconds.
+         */
+        lastTickTime: number;
+
+        /**
+         * The number of ticks in which the plugin went over the soft tick budget.
+         */
+        ticksOverBudget: number;
+
+        /**
+         * The number of calls skipped because the plugin went over the hard tick budget.
+         */
+        throttledCalls: number;
+
+        /**
+         * The calls by hook, e.g. "interval.tick". Calls that are not hooks, such as intervals and
+         * UI callbacks, are under "other".
+         */
+        hooks: { [hook: string]: PluginCallStats };
+    }
+
+    interface MemoryReportEntry {
+        /**
+         * The name of the subsystem, e.g. "tile_elements" or "script_heap".
+         */
+        name: string;
+
+        /**
+         * The memory held by the subsystem, in bytes.
+         */
+        bytes: number;
+
+        /**
+         * The number of items the memory is spread over, such as tile elements or loaded
+         * objects. 0 when the subsystem has no meaningful item count.
+         */
+        items: number;
+    }
+
+    interface TickProfileStage {
+        /**
+         * The name of the stage, e.g. "peeps" or "vehicles".
+         */
+        name: string;
+
+        /**
+         * The mean time spent in the stage per tick, in milliseconds.
+         */
+        mean: number;
+
+        /**
+         * The longest time spent in the stage in a single tick, in milliseconds.
+         */
+        longest: number;
+    }
+
     interface CaptureOptions {
         /**
          * A relative filename from the screenshot directory to save the capture as.
@@ -295,7 +425,7 @@ declare global {
     type HookType =
         "interval.tick" | "interval.day" |
         "network.chat" | "network.action" | "network.join" | "network.leave" |
-        "ride.ratings.calculate" | "action.location";
+        "ride.ratings.calculate" | "action.location" | "action.execute.batch";
 
     type ExpenditureType =
         "ride_construction" |
@@ -401,6 +531,11 @@ declare global {
         result: GameActionResult;
     }
 
+    interface GameActionBatchEventArgs {
+        readonly tick: number;
+        readonly actions: GameActionEventArgs[];
+    }
+
     interface GameActionResult {
         error?: number;
         errorTitle?: string;
@@ -490,9 +625,78 @@ declare global {
 
         getRide(id: number): Ride;
         getTile(x: number, y: number): Tile;
+        /**
+         * Reads a rectangle of tiles in a single call, which is much faster than going through getTile.
+         * @param x The x coordinate of the first tile.
+         * @param y The y coordinate of the first tile.
+         * @param width The number of tiles in each row.
+         * @param height The number of rows.
+         */
+        getTileData(x: number, y: number, width: number, height: number): TileData;
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         getAllEntities(type: "peep"): Peep[];
+        /**
+         * Gets the entities of a type that match the query. Only the matching entities are wrapped in script objects,
+         * or none at all if the query asks for fields.
+         * @param type The type of entity to look for.
+         * @param query Filters, paging and the fields to return.
+         */
+        queryEntities(type: EntityType, query: EntityQuery & { fields: EntityQueryField[] }): EntityQueryResult;
+        queryEntities(type: EntityType, query?: EntityQuery): Entity[];
+        queryEntities(type: "peep", query?: EntityQuery): Peep[];
+    }
+
+    type EntityQueryField =
+        "id" | "x" | "y" | "z" | "energy" | "happiness" | "nausea" | "hunger" | "thirst" | "toilet" | "cash" | "ride" |
+        "velocity";
+
+    interface EntityQuery {
+        /** Only entities within this range of map coordinates. */
+        range?: MapRange;
+        /** Only peeps with all of these flags set. */
+        flags?: PeepFlags[];
+        /** Only guests or only staff. */
+        peepType?: PeepType;
+        /** The number of matching entities to skip. */
+        offset?: number;
+        /** The maximum number of entities to return. */
+        limit?: number;
+        /** Return these fields of the matching entities instead of the entities. */
+        fields?: EntityQueryField[];
+    }
+
+    /**
+     * The fields of the entities that matched a query, one typed array per requested field. Fields that do not
+     * apply to an entity, such as happiness for staff, read as zero.
+     */
+    interface EntityQueryResult {
+        readonly length: number;
+        readonly [field: string]: Int32Array | number;
+    }
+
+    /**
+     * Packed data of a rectangle of tiles. Each array has one value per tile, the value of tile (x, y) is at
+     * index (y - TileData.y) * TileData.width + (x - TileData.x). Tiles outside the map are all zero.
+     */
+    interface TileData {
+        readonly x: number;
+        readonly y: number;
+        readonly width: number;
+        readonly height: number;
+        /** The base height of the first surface element. */
+        readonly surfaceHeight: Uint8Array;
+        /** The highest clearance height of all elements on the tile. */
+        readonly maxHeight: Uint8Array;
+        readonly waterHeight: Uint16Array;
+        readonly surfaceStyle: Uint8Array;
+        readonly ownership: Uint8Array;
+        readonly numElements: Uint16Array;
+        /**
+         * Which element types are on the tile, one bit each in this order:
+         * surface, footpath, track, small_scenery, entrance, wall, large_scenery, banner, openrct2_corrupt_deprecated.
+         */
+        readonly elementTypes: Uint16Array;
     }
 
     type TileElementType =
@@ -1299,6 +1503,12 @@ declare global {
         readonly currentPlayer: Player;
         defaultGroup: number;
 
+        /**
+         * Traffic and timing statistics for each connection. On a server this has an entry for each client,
+         * on a client only the connection to the server.
+         */
+        readonly stats: NetworkStats;
+
         getServerInfo(): ServerInfo;
         addGroup(): void;
         getGroup(index: number): PlayerGroup;
@@ -1314,6 +1524,53 @@ declare global {
 
     type NetworkMode = "none" | "server" | "client";
 
+    interface NetworkStats {
+        /**
+         * The upper bounds in milliseconds of the ping histogram buckets, the last bucket
+         * holds all pings above the last bound.
+         */
+        readonly pingBuckets: number[];
+        readonly connections: NetworkConnectionStats[];
+    }
+
+    interface NetworkConnectionStats {
+        /**
+         * The name of the player, or null if the connection has no player yet.
+         */
+        readonly player: string | null;
+        readonly bytesSent: number;
+        readonly bytesReceived: number;
+
+        /**
+         * The number of packets waiting to be sent and the most there have been at once.
+         */
+        readonly queuedPackets: number;
+        readonly maxQueuedPackets: number;
+        readonly pendingSendBytes: number;
+
+        /**
+         * The number of pings that fell into each bucket of {@link NetworkStats.pingBuckets}.
+         */
+        readonly pingHistogram: number[];
+
+        /**
+         * Statistics for each command that has been sent or received, keyed by the command name.
+         */
+        readonly commands: { [name: string]: NetworkCommandStats };
+    }
+
+    interface NetworkCommandStats {
+        readonly packetsSent: number;
+        readonly packetsReceived: number;
+        readonly bytesSent: number;
+        readonly bytesReceived: number;
+
+        /**
+         * The total time spent handling the received packets in milliseconds.
+         */
+        readonly handlerTime: number;
+    }
+
     /**
      * Represents a player within a network game.
      */
@@ -1436,6 +1693,7 @@ declare global {
         "forbidMarketingCampaigns" |
         "forbidTreeRemoval" |
         "freeParkEntry" |
+        "longRangePathfinding" |
         "noMoney" |
         "open" |
         "preferLessIntenseRides" |
@@ -1919,18 +2177,52 @@ declare global {
      * Based on node.js net.Socket, see https://nodejs.org/api/net.html for more information.
      */
     interface Socket {
+        /**
+         * The number of bytes written that are still waiting to be sent.
+         */
+        readonly bufferedAmount: number;
+
+        /**
+         * Whether data events receive a string or a Uint8Array. Defaults to "string".
+         * All data received during one game update is delivered as a single data event.
+         */
+        binaryType: "string" | "arraybuffer";
+
         connect(port: number, host: string, callback: Function): Socket;
         destroy(error: object): Socket;
         setNoDelay(noDelay: boolean): Socket;
-        end(data?: string): Socket;
-        write(data: string): boolean;
+        end(data?: string | Uint8Array): Socket;
+
+        /**
+         * Queues data to be sent. Returns false if the data could not be sent straight away,
+         * a drain event is raised once all queued data has been sent.
+         */
+        write(data: string | Uint8Array): boolean;
 
         on(event: 'close', callback: (hadError: boolean) => void): Socket;
         on(event: 'error', callback: (hadError: boolean) => void): Socket;
-        on(event: 'data', callback: (data: string) => void): Socket;
+        on(event: 'data', callback: (data: string | Uint8Array) => void): Socket;
+        on(event: 'drain', callback: () => void): Socket;
 
         off(event: 'close', callback: (hadError: boolean) => void): Socket;
         off(event: 'error', callback: (hadError: boolean) => void): Socket;
-        off(event: 'data', callback: (data: string) => void): Socket;
+        off(event: 'data', callback: (data: string | Uint8Array) => void): Socket;
+        off(event: 'drain', callback: () => void): Socket;
+    }
+
+    /**
+     * A script running on a background thread, created with context.createWorker.
+     * Messages are copied between the plugin and the worker as JSON, so typed arrays
+     * and objects with methods need to be converted to plain arrays and objects first.
+     */
+    interface Worker {
+        postMessage(data: any): void;
+        terminate(): void;
+
+        on(event: 'message', callback: (data: any) => void): Worker;
+        on(event: 'error', callback: (message: string) => void): Worker;
+
+        off(event: 'message', callback: (data: any) => void): Worker;
+        off(event: 'error', callback: (message: string) => void): Worker;
     }
 }
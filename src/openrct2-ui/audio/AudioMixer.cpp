@@ -47,6 +47,8 @@ namespace OpenRCT2::Audio
         std::vector<uint8_t> _channelBuffer;
         std::vector<uint8_t> _convertBuffer;
         std::vector<uint8_t> _effectBuffer;
+        // Channels are accumulated here when the device takes 16-bit samples, and converted once at the end
+        std::vector<float> _mixBuffer;
 
     public:
         AudioMixerImpl()
@@ -122,6 +124,8 @@ namespace OpenRCT2::Audio
             _convertBuffer.shrink_to_fit();
             _effectBuffer.clear();
             _effectBuffer.shrink_to_fit();
+            _mixBuffer.clear();
+            _mixBuffer.shrink_to_fit();
         }
 
         void Lock() override
@@ -212,7 +216,15 @@ namespace OpenRCT2::Audio
             UpdateAdjustedSound();
 
             // Zero the output buffer
-            std::fill_n(dst, length, 0);
+            const bool mixFloat = IsFloatMixing();
+            if (mixFloat)
+            {
+                _mixBuffer.assign(length / sizeof(int16_t), 0.0f);
+            }
+            else
+            {
+                std::fill_n(dst, length, 0);
+            }
 
             // Mix channels onto output buffer
             auto it = _channels.begin();
@@ -235,6 +247,26 @@ namespace OpenRCT2::Audio
                     it++;
                 }
             }
+
+            if (mixFloat)
+            {
+                WriteMixBuffer(reinterpret_cast<int16_t*>(dst));
+            }
+        }
+
+        bool IsFloatMixing() const
+        {
+            return _format.format == AUDIO_S16SYS;
+        }
+
+        void WriteMixBuffer(int16_t* dst) const
+        {
+            const float* mix = _mixBuffer.data();
+            const size_t numSamples = _mixBuffer.size();
+            for (size_t i = 0; i < numSamples; i++)
+            {
+                dst[i] = static_cast<int16_t>(std::clamp(mix[i], -32768.0f, 32767.0f));
+            }
         }
 
         void UpdateAdjustedSound()
@@ -322,14 +354,22 @@ namespace OpenRCT2::Audio
                 buffer = _effectBuffer.data();
             }
 
-            // Apply panning and volume
-            ApplyPan(channel, buffer, bufferLen, byteRate);
-            int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
-
-            // Finally mix on to destination buffer
             size_t dstLength = std::min(length, bufferLen);
-            SDL_MixAudioFormat(
-                data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            if (IsFloatMixing())
+            {
+                // Panning, volume and mixing in one pass over the samples
+                MixS16(channel, static_cast<const int16_t*>(buffer), dstLength / sizeof(int16_t));
+            }
+            else
+            {
+                // Apply panning and volume
+                ApplyPan(channel, buffer, bufferLen, byteRate);
+                int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
+
+                // Finally mix on to destination buffer
+                SDL_MixAudioFormat(
+                    data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            }
 
             channel->UpdateOldVolume();
         }
@@ -378,7 +418,46 @@ namespace OpenRCT2::Audio
             }
         }
 
-        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        /**
+         * Adds the samples to the float mix buffer, fading pan and volume from the channel's old to its new levels over
+         * the length of the chunk. Every sample is computed independently so the compiler can vectorise the loops.
+         */
+        void MixS16(const IAudioChannel* channel, const int16_t* src, size_t numSamples)
+        {
+            const float volumeAdjust = GetVolumeAdjust(channel) / MIXER_VOLUME_MAX;
+            const float startVolume = channel->GetOldVolume() * volumeAdjust;
+            const float endVolume = channel->IsStopping() ? 0.0f : channel->GetVolume() * volumeAdjust;
+
+            float* mix = _mixBuffer.data();
+            numSamples = std::min(numSamples, _mixBuffer.size());
+            if (_format.channels == 2)
+            {
+                const float startL = startVolume * channel->GetOldVolumeL();
+                const float startR = startVolume * channel->GetOldVolumeR();
+                const float deltaL = endVolume * channel->GetVolumeL() - startL;
+                const float deltaR = endVolume * channel->GetVolumeR() - startR;
+                const size_t numFrames = numSamples / 2;
+                const float dt = numFrames != 0 ? 1.0f / numFrames : 0.0f;
+                for (size_t i = 0; i < numFrames; i++)
+                {
+                    const float t = static_cast<float>(i) * dt;
+                    mix[i * 2 + 0] += static_cast<float>(src[i * 2 + 0]) * (startL + deltaL * t);
+                    mix[i * 2 + 1] += static_cast<float>(src[i * 2 + 1]) * (startR + deltaR * t);
+                }
+            }
+            else
+            {
+                const float delta = endVolume - startVolume;
+                const float dt = numSamples != 0 ? 1.0f / numSamples : 0.0f;
+                for (size_t i = 0; i < numSamples; i++)
+                {
+                    const float t = static_cast<float>(i) * dt;
+                    mix[i] += static_cast<float>(src[i]) * (startVolume + delta * t);
+                }
+            }
+        }
+
+        float GetVolumeAdjust(const IAudioChannel* channel) const
         {
             float volumeAdjust = _volume;
             volumeAdjust *= gConfigSound.master_sound_enabled ? (static_cast<float>(gConfigSound.master_volume) / 100.0f)
@@ -400,7 +479,12 @@ namespace OpenRCT2::Audio
                     volumeAdjust *= _adjustMusicVolume;
                     break;
             }
+            return volumeAdjust;
+        }
 
+        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        {
+            float volumeAdjust = GetVolumeAdjust(channel);
             int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
             int32_t endVolume = channel->GetVolume() * volumeAdjust;
             if (channel->IsStopping())
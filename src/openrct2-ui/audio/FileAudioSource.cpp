@@ -12,23 +12,46 @@
 
 #include <SDL.h>
 #include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/common.h>
+#include <thread>
+#include <vector>
 
 namespace OpenRCT2::Audio
 {
     /**
      * An audio source where raw PCM data is streamed directly from
-     * a file.
+     * a file. A background thread reads ahead of the mixer into a
+     * ring buffer so the audio callback does not wait on the disk.
      */
     class FileAudioSource final : public ISDLAudioSource
     {
     private:
+        static constexpr size_t READ_AHEAD_CHUNK_SIZE = 16 * 1024;
+        static constexpr size_t MIN_READ_AHEAD_SIZE = 64 * 1024;
+
         AudioFormat _format = {};
         SDL_RWops* _rw = nullptr;
         uint64_t _dataBegin = 0;
         uint64_t _dataLength = 0;
 
+        // Guards _rw, held by whichever thread is reading from the file
+        std::mutex _fileMutex;
+
+        // Guards the ring buffer state below
+        std::mutex _bufferMutex;
+        std::condition_variable _bufferCondition;
+        std::vector<uint8_t> _buffer;
+        uint64_t _bufferOffset = 0;
+        size_t _bufferStart = 0;
+        size_t _bufferLength = 0;
+        uint32_t _bufferGeneration = 0;
+        bool _stopReadAhead = false;
+        std::thread _readAheadThread;
+
     public:
         ~FileAudioSource() override
         {
@@ -47,6 +70,55 @@ namespace OpenRCT2::Audio
 
         size_t Read(void* dst, uint64_t offset, size_t len) override
         {
+            {
+                std::lock_guard<std::mutex> lock(_bufferMutex);
+                if (offset == _bufferOffset && _bufferLength != 0)
+                {
+                    size_t bytesRead = ReadFromBuffer(static_cast<uint8_t*>(dst), len);
+                    _bufferCondition.notify_one();
+                    return bytesRead;
+                }
+            }
+
+            // The mixer has seeked, looped or overtaken the read-ahead thread, read directly
+            // and restart the read-ahead from where this read finishes.
+            size_t bytesRead;
+            {
+                std::lock_guard<std::mutex> lock(_fileMutex);
+                bytesRead = ReadFromFile(dst, offset, len);
+            }
+            {
+                std::lock_guard<std::mutex> lock(_bufferMutex);
+                _bufferOffset = offset + bytesRead;
+                _bufferStart = 0;
+                _bufferLength = 0;
+                _bufferGeneration++;
+            }
+            _bufferCondition.notify_one();
+            return bytesRead;
+        }
+
+        bool LoadWAV(SDL_RWops* rw)
+        {
+            if (!ReadWAVHeader(rw))
+            {
+                return false;
+            }
+
+            auto bytesPerSecond = static_cast<size_t>(_format.freq) * _format.channels * _format.BytesPerSample();
+            _buffer.resize(std::max(bytesPerSecond, MIN_READ_AHEAD_SIZE));
+            _readAheadThread = std::thread(&FileAudioSource::ReadAhead, this);
+            return true;
+        }
+
+    private:
+        size_t ReadFromFile(void* dst, uint64_t offset, size_t len)
+        {
+            if (offset >= _dataLength)
+            {
+                return 0;
+            }
+
             size_t bytesRead = 0;
             int64_t currentPosition = SDL_RWtell(_rw);
             if (currentPosition != -1)
@@ -66,7 +138,83 @@ namespace OpenRCT2::Audio
             return bytesRead;
         }
 
-        bool LoadWAV(SDL_RWops* rw)
+        size_t ReadFromBuffer(uint8_t* dst, size_t len)
+        {
+            size_t bytesToRead = std::min(len, _bufferLength);
+            size_t firstPart = std::min(bytesToRead, _buffer.size() - _bufferStart);
+            std::memcpy(dst, _buffer.data() + _bufferStart, firstPart);
+            std::memcpy(dst + firstPart, _buffer.data(), bytesToRead - firstPart);
+            _bufferStart = (_bufferStart + bytesToRead) % _buffer.size();
+            _bufferLength -= bytesToRead;
+            _bufferOffset += bytesToRead;
+            return bytesToRead;
+        }
+
+        void ReadAhead()
+        {
+            std::vector<uint8_t> chunk(READ_AHEAD_CHUNK_SIZE);
+            std::unique_lock<std::mutex> lock(_bufferMutex);
+            while (true)
+            {
+                _bufferCondition.wait(lock, [this] {
+                    return _stopReadAhead
+                        || (_bufferLength + READ_AHEAD_CHUNK_SIZE <= _buffer.size()
+                            && _bufferOffset + _bufferLength < _dataLength);
+                });
+                if (_stopReadAhead)
+                {
+                    break;
+                }
+
+                auto generation = _bufferGeneration;
+                auto readOffset = _bufferOffset + _bufferLength;
+                lock.unlock();
+
+                size_t bytesRead;
+                {
+                    std::lock_guard<std::mutex> fileLock(_fileMutex);
+                    bytesRead = ReadFromFile(chunk.data(), readOffset, chunk.size());
+                }
+
+                lock.lock();
+                if (bytesRead == 0)
+                {
+                    // Treat a failed read as the end of the data so the thread does not spin, the mixer
+                    // will fall back to reading directly.
+                    _bufferCondition.wait(lock, [this, generation] {
+                        return _stopReadAhead || _bufferGeneration != generation;
+                    });
+                }
+                else if (generation == _bufferGeneration)
+                {
+                    size_t writeIndex = (_bufferStart + _bufferLength) % _buffer.size();
+                    size_t firstPart = std::min(bytesRead, _buffer.size() - writeIndex);
+                    std::memcpy(_buffer.data() + writeIndex, chunk.data(), firstPart);
+                    std::memcpy(_buffer.data(), chunk.data() + firstPart, bytesRead - firstPart);
+                    _bufferLength += bytesRead;
+                }
+            }
+        }
+
+        void StopReadAhead()
+        {
+            if (_readAheadThread.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_bufferMutex);
+                    _stopReadAhead = true;
+                }
+                _bufferCondition.notify_one();
+                _readAheadThread.join();
+            }
+            _stopReadAhead = false;
+            _buffer.clear();
+            _bufferOffset = 0;
+            _bufferStart = 0;
+            _bufferLength = 0;
+        }
+
+        bool ReadWAVHeader(SDL_RWops* rw)
         {
             const uint32_t DATA = 0x61746164;
             const uint32_t FMT = 0x20746D66;
@@ -143,7 +291,6 @@ namespace OpenRCT2::Audio
             return true;
         }
 
-    private:
         static uint32_t FindChunk(SDL_RWops* rw, uint32_t wantedId)
         {
             uint32_t subchunkId = SDL_ReadLE32(rw);
@@ -171,6 +318,7 @@ namespace OpenRCT2::Audio
 
         void Unload()
         {
+            StopReadAhead();
             if (_rw != nullptr)
             {
                 SDL_RWclose(_rw);
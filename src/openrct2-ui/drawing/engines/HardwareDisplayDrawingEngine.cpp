@@ -10,10 +10,13 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <openrct2/Game.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/drawing/Drawing.h>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/drawing/LightFX.h>
 #include <openrct2/drawing/X8DrawingEngine.h>
@@ -50,6 +53,10 @@ private:
 
     std::vector<uint32_t> _dirtyVisualsTime;
 
+    // The bits as they were last copied to the screen texture
+    std::vector<uint8_t> _presentedBits;
+    bool _presentedBitsValid = false;
+
     bool smoothNN = false;
 
 public:
@@ -153,6 +160,7 @@ public:
         _screenTextureFormat = SDL_AllocFormat(format);
 
         ConfigureBits(width, height, width);
+        _presentedBitsValid = false;
     }
 
     void SetPalette(const GamePalette& palette) override
@@ -163,6 +171,7 @@ public:
             {
                 _paletteHWMapped[i] = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
             }
+            _presentedBitsValid = false;
 
 #ifdef __ENABLE_LIGHTFX__
             if (gConfigGeneral.enable_light_fx)
@@ -217,12 +226,12 @@ private:
                 lightfx_render_to_texture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+            _presentedBitsValid = false;
         }
         else
 #endif
         {
-            CopyBitsToTexture(
-                _screenTexture, _bits, static_cast<int32_t>(_width), static_cast<int32_t>(_height), _paletteHWMapped);
+            CopyChangedBitsToTexture();
         }
         if (smoothNN)
         {
@@ -265,11 +274,7 @@ private:
             int32_t padding = pitch - (width * 4);
             if (pitch == width * 4)
             {
-                uint32_t* dst = static_cast<uint32_t*>(pixels);
-                for (int32_t i = width * height; i > 0; i--)
-                {
-                    *dst++ = palette[*src++];
-                }
+                palette_convert_fn(src, static_cast<uint32_t*>(pixels), palette, width * height);
             }
             else
             {
@@ -304,6 +309,83 @@ private:
         }
     }
 
+    /**
+     * Only converts the part of the screen that changed since the last frame. The weather and overlays such as the FPS
+     * counter are drawn outside of the dirty blocks, so the changes are found by comparing with the presented bits.
+     */
+    void CopyChangedBitsToTexture()
+    {
+        const auto width = static_cast<int32_t>(_width);
+        const auto height = static_cast<int32_t>(_height);
+        if (!_presentedBitsValid || _screenTextureFormat->BytesPerPixel != 4)
+        {
+            CopyBitsToTexture(_screenTexture, _bits, width, height, _paletteHWMapped);
+            _presentedBits.assign(_bits, _bits + _width * _height);
+            _presentedBitsValid = true;
+            return;
+        }
+
+        const uint8_t* presented = _presentedBits.data();
+        auto rowChanged = [&](int32_t y) { return std::memcmp(_bits + y * width, presented + y * width, width) != 0; };
+        int32_t top = 0;
+        while (top < height && !rowChanged(top))
+        {
+            top++;
+        }
+        if (top == height)
+        {
+            return;
+        }
+        int32_t bottom = height;
+        while (!rowChanged(bottom - 1))
+        {
+            bottom--;
+        }
+
+        // Narrow the columns down to whole dirty blocks, comparing single pixels is not worth it
+        const auto blockWidth = static_cast<int32_t>(_dirtyGrid.BlockWidth);
+        const int32_t lastBlock = ((width - 1) / blockWidth) * blockWidth;
+        int32_t left = width;
+        int32_t right = 0;
+        for (int32_t y = top; y < bottom; y++)
+        {
+            const uint8_t* bitsRow = _bits + y * width;
+            const uint8_t* presentedRow = presented + y * width;
+            for (int32_t x = 0; x < left; x += blockWidth)
+            {
+                if (std::memcmp(bitsRow + x, presentedRow + x, std::min(blockWidth, width - x)) != 0)
+                {
+                    left = x;
+                    break;
+                }
+            }
+            for (int32_t x = lastBlock; x >= right; x -= blockWidth)
+            {
+                auto blockEnd = std::min(x + blockWidth, width);
+                if (std::memcmp(bitsRow + x, presentedRow + x, blockEnd - x) != 0)
+                {
+                    right = blockEnd;
+                    break;
+                }
+            }
+        }
+
+        SDL_Rect rect = { left, top, right - left, bottom - top };
+        void* pixels;
+        int32_t pitch;
+        if (SDL_LockTexture(_screenTexture, &rect, &pixels, &pitch) == 0)
+        {
+            for (int32_t y = top; y < bottom; y++)
+            {
+                auto src = _bits + y * width + left;
+                auto dst = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(pixels) + (y - top) * pitch);
+                palette_convert_fn(src, dst, _paletteHWMapped, rect.w);
+                std::copy_n(src, rect.w, _presentedBits.data() + y * width + left);
+            }
+            SDL_UnlockTexture(_screenTexture);
+        }
+    }
+
     uint32_t GetDirtyVisualTime(uint32_t x, uint32_t y)
     {
         uint32_t result = 0;
@@ -98,6 +98,15 @@ struct DrawLineCommand
     GLint depth;
 };
 
+// Per-instance data for weather: one particle every spacing pixels, starting at the top left of bounds
+struct DrawWeatherCommand
+{
+    ivec4 bounds;
+    ivec2 spacing;
+    GLuint colour;
+    GLint depth;
+};
+
 // Per-instance data for images
 struct DrawRectCommand
 {
@@ -122,3 +131,4 @@ struct DrawRectCommand
 
 using LineCommandBatch = CommandBatch<DrawLineCommand>;
 using RectCommandBatch = CommandBatch<DrawRectCommand>;
+using WeatherCommandBatch = CommandBatch<DrawWeatherCommand>;
@@ -12,6 +12,7 @@
 #include "DrawCommands.h"
 #include "GLSLTypes.h"
 #include "OpenGLShaderProgram.h"
+#include "StreamBuffer.h"
 
 class DrawLineShader final : public OpenGLShaderProgram
 {
@@ -26,7 +27,6 @@ private:
     GLuint vVertMat;
 
     GLuint _vbo;
-    GLuint _vboInstances;
     GLuint _vao;
 
 public:
@@ -34,7 +34,7 @@ public:
     ~DrawLineShader() override;
 
     void SetScreenSize(int32_t width, int32_t height);
-    void DrawInstances(const LineCommandBatch& instances);
+    void DrawInstances(const LineCommandBatch& instances, StreamBuffer& buffer);
 
 private:
     void GetLocations();
@@ -11,6 +11,8 @@
 
 #    include "DrawRectShader.h"
 
+#    include <algorithm>
+
 namespace
 {
     struct VDStruct
@@ -33,7 +35,6 @@ DrawRectShader::DrawRectShader()
     GetLocations();
 
     glGenBuffers(1, &_vbo);
-    glGenBuffers(1, &_vboInstances);
     glGenVertexArrays(1, &_vao);
 
     glBindBuffer(GL_ARRAY_BUFFER, _vbo);
@@ -51,30 +52,6 @@ DrawRectShader::DrawRectShader()
         vVertMat + 3, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, mat[3])));
     glVertexAttribPointer(vVertVec, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, vec)));
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
-    glVertexAttribIPointer(vClip, 4, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, clip)));
-    glVertexAttribIPointer(
-        vTexColourAtlas, 1, GL_INT, sizeof(DrawRectCommand),
-        reinterpret_cast<void*>(offsetof(DrawRectCommand, texColourAtlas)));
-    glVertexAttribPointer(
-        vTexColourBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand),
-        reinterpret_cast<void*>(offsetof(DrawRectCommand, texColourBounds)));
-    glVertexAttribIPointer(
-        vTexMaskAtlas, 1, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, texMaskAtlas)));
-    glVertexAttribPointer(
-        vTexMaskBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand),
-        reinterpret_cast<void*>(offsetof(DrawRectCommand, texMaskBounds)));
-    glVertexAttribIPointer(
-        vPalettes, 3, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, palettes)));
-    glVertexAttribIPointer(
-        vFlags, 1, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, flags)));
-    glVertexAttribIPointer(
-        vColour, 1, GL_UNSIGNED_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, colour)));
-    glVertexAttribIPointer(
-        vBounds, 4, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, bounds)));
-    glVertexAttribIPointer(
-        vDepth, 1, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, depth)));
-
     glEnableVertexAttribArray(vVertMat + 0);
     glEnableVertexAttribArray(vVertMat + 1);
     glEnableVertexAttribArray(vVertMat + 2);
@@ -114,7 +91,6 @@ DrawRectShader::DrawRectShader()
 DrawRectShader::~DrawRectShader()
 {
     glDeleteBuffers(1, &_vbo);
-    glDeleteBuffers(1, &_vboInstances);
     glDeleteVertexArrays(1, &_vao);
 }
 
@@ -158,12 +134,33 @@ void DrawRectShader::DisablePeeling()
     glUniform1i(uPeeling, 0);
 }
 
-void DrawRectShader::SetInstances(const RectCommandBatch& instances)
+void DrawRectShader::SetInstanceAttributes(size_t offset)
+{
+    auto pointer = [offset](size_t member) { return reinterpret_cast<void*>(offset + member); };
+
+    glVertexAttribIPointer(vClip, 4, GL_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, clip)));
+    glVertexAttribIPointer(
+        vTexColourAtlas, 1, GL_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, texColourAtlas)));
+    glVertexAttribPointer(
+        vTexColourBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, texColourBounds)));
+    glVertexAttribIPointer(
+        vTexMaskAtlas, 1, GL_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, texMaskAtlas)));
+    glVertexAttribPointer(
+        vTexMaskBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, texMaskBounds)));
+    glVertexAttribIPointer(vPalettes, 3, GL_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, palettes)));
+    glVertexAttribIPointer(vFlags, 1, GL_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, flags)));
+    glVertexAttribIPointer(vColour, 1, GL_UNSIGNED_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, colour)));
+    glVertexAttribIPointer(vBounds, 4, GL_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, bounds)));
+    glVertexAttribIPointer(vDepth, 1, GL_INT, sizeof(DrawRectCommand), pointer(offsetof(DrawRectCommand, depth)));
+}
+
+void DrawRectShader::SetInstances(const RectCommandBatch& instances, StreamBuffer& buffer)
 {
     glBindVertexArray(_vao);
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(DrawRectCommand) * instances.size(), instances.data(), GL_STREAM_DRAW);
+    // Leaves the stream buffer bound for the attribute pointers
+    size_t offset = buffer.Write(instances.data(), sizeof(DrawRectCommand) * instances.size());
+    SetInstanceAttributes(offset);
 
     _instanceCount = static_cast<GLsizei>(instances.size());
 }
@@ -174,4 +171,10 @@ void DrawRectShader::DrawInstances()
     glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, _instanceCount);
 }
 
+void DrawRectShader::DrawInstances(size_t count)
+{
+    glBindVertexArray(_vao);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, std::min(_instanceCount, static_cast<GLsizei>(count)));
+}
+
 #endif /* DISABLE_OPENGL */
@@ -12,6 +12,7 @@
 #include "DrawCommands.h"
 #include "GLSLTypes.h"
 #include "OpenGLShaderProgram.h"
+#include "StreamBuffer.h"
 
 #include <SDL_pixels.h>
 
@@ -40,7 +41,6 @@ private:
     GLuint vDepth;
 
     GLuint _vbo;
-    GLuint _vboInstances;
     GLuint _vao;
 
     GLsizei _instanceCount = 0;
@@ -53,9 +53,11 @@ public:
     void EnablePeeling(GLuint peelingTex);
     void DisablePeeling();
 
-    void SetInstances(const RectCommandBatch& instances);
+    void SetInstances(const RectCommandBatch& instances, StreamBuffer& buffer);
     void DrawInstances();
+    void DrawInstances(size_t count);
 
 private:
     void GetLocations();
+    void SetInstanceAttributes(size_t offset);
 };
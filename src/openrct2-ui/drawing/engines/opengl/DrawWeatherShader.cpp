@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_OPENGL
+
+#    include "DrawWeatherShader.h"
+
+DrawWeatherShader::DrawWeatherShader()
+    : OpenGLShaderProgram("drawweather")
+{
+    GetLocations();
+
+    glGenVertexArrays(1, &_vao);
+
+    // The quad corners come from gl_VertexID, so only the per-instance data needs a buffer
+    glBindVertexArray(_vao);
+    glEnableVertexAttribArray(vBounds);
+    glEnableVertexAttribArray(vSpacing);
+    glEnableVertexAttribArray(vColour);
+    glEnableVertexAttribArray(vDepth);
+
+    glVertexAttribDivisor(vBounds, 1);
+    glVertexAttribDivisor(vSpacing, 1);
+    glVertexAttribDivisor(vColour, 1);
+    glVertexAttribDivisor(vDepth, 1);
+
+    Use();
+}
+
+DrawWeatherShader::~DrawWeatherShader()
+{
+    glDeleteVertexArrays(1, &_vao);
+}
+
+void DrawWeatherShader::GetLocations()
+{
+    uScreenSize = GetUniformLocation("uScreenSize");
+
+    vBounds = GetAttributeLocation("vBounds");
+    vSpacing = GetAttributeLocation("vSpacing");
+    vColour = GetAttributeLocation("vColour");
+    vDepth = GetAttributeLocation("vDepth");
+}
+
+void DrawWeatherShader::SetScreenSize(int32_t width, int32_t height)
+{
+    glUniform2i(uScreenSize, width, height);
+}
+
+void DrawWeatherShader::DrawInstances(const WeatherCommandBatch& instances, StreamBuffer& buffer)
+{
+    glBindVertexArray(_vao);
+
+    // Leaves the stream buffer bound for the attribute pointers
+    size_t offset = buffer.Write(instances.data(), sizeof(DrawWeatherCommand) * instances.size());
+    auto pointer = [offset](size_t member) { return reinterpret_cast<void*>(offset + member); };
+    glVertexAttribIPointer(vBounds, 4, GL_INT, sizeof(DrawWeatherCommand), pointer(offsetof(DrawWeatherCommand, bounds)));
+    glVertexAttribIPointer(vSpacing, 2, GL_INT, sizeof(DrawWeatherCommand), pointer(offsetof(DrawWeatherCommand, spacing)));
+    glVertexAttribIPointer(
+        vColour, 1, GL_UNSIGNED_INT, sizeof(DrawWeatherCommand), pointer(offsetof(DrawWeatherCommand, colour)));
+    glVertexAttribIPointer(vDepth, 1, GL_INT, sizeof(DrawWeatherCommand), pointer(offsetof(DrawWeatherCommand, depth)));
+
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instances.size()));
+}
+
+#endif /* DISABLE_OPENGL */
@@ -0,0 +1,38 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "DrawCommands.h"
+#include "GLSLTypes.h"
+#include "OpenGLShaderProgram.h"
+#include "StreamBuffer.h"
+
+class DrawWeatherShader final : public OpenGLShaderProgram
+{
+private:
+    GLuint uScreenSize;
+
+    GLuint vBounds;
+    GLuint vSpacing;
+    GLuint vColour;
+    GLuint vDepth;
+
+    GLuint _vao;
+
+public:
+    DrawWeatherShader();
+    ~DrawWeatherShader() override;
+
+    void SetScreenSize(int32_t width, int32_t height);
+    void DrawInstances(const WeatherCommandBatch& instances, StreamBuffer& buffer);
+
+private:
+    void GetLocations();
+};
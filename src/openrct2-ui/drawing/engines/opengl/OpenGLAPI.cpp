@@ -11,13 +11,14 @@
 
 #    include "OpenGLAPI.h"
 
+#    include <SDL_video.h>
+
 #    if OPENGL_NO_LINK
 
 #        define OPENGL_PROC(TYPE, PROC) TYPE PROC = nullptr;
 #        include "OpenGLAPIProc.h"
 #        undef OPENGL_PROC
 
-#        include <SDL_video.h>
 #        include <openrct2/core/Console.hpp>
 
 static const char* TryLoadAllProcAddresses()
@@ -50,6 +51,17 @@ namespace OpenGLState
     }
 } // namespace OpenGLState
 
+PFNGLBUFFERSTORAGEPROC OpenGLAPI::BufferStorage = nullptr;
+
+static bool IsBufferStorageSupported()
+{
+    GLint major = 0;
+    GLint minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    return major > 4 || (major == 4 && minor >= 4) || SDL_GL_ExtensionSupported("GL_ARB_buffer_storage");
+}
+
 void OpenGLAPI::SetTexture(uint16_t index, GLenum type, GLuint texture)
 {
     if (OpenGLState::ActiveTexture != index)
@@ -71,6 +83,12 @@ bool OpenGLAPI::Initialise()
         return false;
     }
 #    endif
+
+    BufferStorage = nullptr;
+    if (IsBufferStorageSupported())
+    {
+        BufferStorage = reinterpret_cast<PFNGLBUFFERSTORAGEPROC>(SDL_GL_GetProcAddress("glBufferStorage"));
+    }
     return true;
 }
 
@@ -29,6 +29,7 @@ OPENGL_PROC(PFNGLGENTEXTURESPROC, glGenTextures)
 OPENGL_PROC(PFNGLGETERRORPROC, glGetError)
 OPENGL_PROC(PFNGLPIXELSTOREIPROC, glPixelStorei)
 OPENGL_PROC(PFNGLREADPIXELSPROC, glReadPixels)
+OPENGL_PROC(PFNGLSCISSORPROC, glScissor)
 OPENGL_PROC(PFNGLTEXIMAGE2DPROC, glTexImage2D)
 OPENGL_PROC(PFNGLTEXPARAMETERIPROC, glTexParameteri)
 OPENGL_PROC(PFNGLVIEWPORTPROC, glViewport)
@@ -47,17 +48,22 @@ OPENGL_PROC(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer)
 OPENGL_PROC(PFNGLBUFFERDATAPROC, glBufferData)
 OPENGL_PROC(PFNGLCLEARBUFFERFVPROC, glClearBufferfv)
 OPENGL_PROC(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv)
+OPENGL_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync)
 OPENGL_PROC(PFNGLCOMPILESHADERPROC, glCompileShader)
+OPENGL_PROC(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D)
 OPENGL_PROC(PFNGLCREATEPROGRAMPROC, glCreateProgram)
 OPENGL_PROC(PFNGLCREATESHADERPROC, glCreateShader)
 OPENGL_PROC(PFNGLDELETEBUFFERSPROC, glDeleteBuffers)
 OPENGL_PROC(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers)
 OPENGL_PROC(PFNGLDELETEPROGRAMPROC, glDeleteProgram)
 OPENGL_PROC(PFNGLDELETESHADERPROC, glDeleteShader)
+OPENGL_PROC(PFNGLDELETESYNCPROC, glDeleteSync)
 OPENGL_PROC(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays)
 OPENGL_PROC(PFNGLDETACHSHADERPROC, glDetachShader)
 OPENGL_PROC(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray)
+OPENGL_PROC(PFNGLFENCESYNCPROC, glFenceSync)
 OPENGL_PROC(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D)
+OPENGL_PROC(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer)
 OPENGL_PROC(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation)
 OPENGL_PROC(PFNGLGENBUFFERSPROC, glGenBuffers)
 OPENGL_PROC(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers)
@@ -68,6 +74,7 @@ OPENGL_PROC(PFNGLGETSHADERIVPROC, glGetShaderiv)
 OPENGL_PROC(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation)
 OPENGL_PROC(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays)
 OPENGL_PROC(PFNGLLINKPROGRAMPROC, glLinkProgram)
+OPENGL_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange)
 OPENGL_PROC(PFNGLSHADERSOURCEPROC, glShaderSource)
 OPENGL_PROC(PFNGLUNIFORM1IPROC, glUniform1i)
 OPENGL_PROC(PFNGLUNIFORM1IVPROC, glUniform1iv)
@@ -78,6 +85,7 @@ OPENGL_PROC(PFNGLUNIFORM2FPROC, glUniform2f)
 OPENGL_PROC(PFNGLUNIFORM4FPROC, glUniform4f)
 OPENGL_PROC(PFNGLUNIFORM4IPROC, glUniform4i)
 OPENGL_PROC(PFNGLUNIFORM4FVPROC, glUniform4fv)
+OPENGL_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer)
 OPENGL_PROC(PFNGLUSEPROGRAMPROC, glUseProgram)
 OPENGL_PROC(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer)
 OPENGL_PROC(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer)
@@ -13,10 +13,12 @@
 #    include "ApplyPaletteShader.h"
 #    include "DrawCommands.h"
 #    include "DrawLineShader.h"
+#    include "DrawWeatherShader.h"
 #    include "DrawRectShader.h"
 #    include "GLSLTypes.h"
 #    include "OpenGLAPI.h"
 #    include "OpenGLFramebuffer.h"
+#    include "StreamBuffer.h"
 #    include "SwapFramebuffer.h"
 #    include "TextureCache.h"
 #    include "TransparencyDepth.h"
@@ -34,9 +36,13 @@
 #    include <openrct2/drawing/LightFX.h>
 #    include <openrct2/drawing/Weather.h>
 #    include <openrct2/interface/Screenshot.h>
+#    include <openrct2/interface/Viewport.h>
+#    include <openrct2/paint/tile_element/Paint.Surface.h>
 #    include <openrct2/ui/UiContext.h>
 #    include <openrct2/world/Climate.h>
 #    include <unordered_map>
+#    include <utility>
+#    include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -50,6 +56,9 @@ struct OpenGLVersion
 
 constexpr OpenGLVersion OPENGL_MINIMUM_REQUIRED_VERSION = { 3, 3 };
 
+// Instance data per frame for a busy park at 1080p, the buffer grows when a frame needs more
+constexpr size_t INSTANCE_BUFFER_FRAME_SIZE = 4 * 1024 * 1024;
+
 class OpenGLDrawingEngine;
 
 class OpenGLDrawingContext final : public IDrawingContext
@@ -60,7 +69,9 @@ private:
     ApplyTransparencyShader* _applyTransparencyShader = nullptr;
     DrawLineShader* _drawLineShader = nullptr;
     DrawRectShader* _drawRectShader = nullptr;
+    DrawWeatherShader* _drawWeatherShader = nullptr;
     SwapFramebuffer* _swapFramebuffer = nullptr;
+    StreamBuffer* _instanceBuffer = nullptr;
 
     TextureCache* _textureCache = nullptr;
 
@@ -79,6 +90,7 @@ private:
         LineCommandBatch lines;
         RectCommandBatch rects;
         RectCommandBatch transparent;
+        WeatherCommandBatch weather;
     } _commandBuffers;
 
 public:
@@ -108,11 +120,14 @@ public:
     void DrawSpriteRawMasked(int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage) override;
     void DrawSpriteSolid(uint32_t image, int32_t x, int32_t y, uint8_t colour) override;
     void DrawGlyph(uint32_t image, int32_t x, int32_t y, const PaletteMap& palette) override;
+    void DrawWeatherPattern(
+        uint8_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t xSpacing, int32_t ySpacing);
 
     void FlushCommandBuffers();
 
     void FlushLines();
     void FlushRectangles();
+    void FlushWeather();
     void HandleTransparency();
 
     void SetDPI(rct_drawpixelinfo* dpi);
@@ -142,35 +157,24 @@ public:
 
         uint8_t patternStartXOffset = xStart % patternXSpace;
         uint8_t patternStartYOffset = yStart % patternYSpace;
-
-        const auto* dpi = _drawingContext->GetDPI();
-
-        uint32_t pixelOffset = (dpi->pitch + dpi->width) * y + x;
         uint8_t patternYPos = patternStartYOffset % patternYSpace;
 
-        for (; height != 0; height--)
+        // Every pattern row repeats down the region every patternYSpace rows, so each becomes a single instance that
+        // the GPU expands into particles rather than one line per pixel
+        for (uint8_t patternRow = 0; patternRow < patternYSpace; patternRow++)
         {
-            uint8_t patternX = pattern[patternYPos * 2];
-            if (patternX != 0xFF)
-            {
-                uint32_t finalPixelOffset = width + pixelOffset;
-
-                uint32_t xPixelOffset = pixelOffset;
-                xPixelOffset += (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
-
-                uint8_t patternPixel = pattern[patternYPos * 2 + 1];
-                for (; xPixelOffset < finalPixelOffset; xPixelOffset += patternXSpace)
-                {
-                    int32_t pixelX = xPixelOffset % dpi->width;
-                    int32_t pixelY = (xPixelOffset / dpi->width) % dpi->height;
+            uint8_t patternX = pattern[patternRow * 2];
+            if (patternX == 0xFF)
+                continue;
 
-                    _drawingContext->DrawLine(patternPixel, pixelX, pixelY, pixelX + 1, pixelY + 1);
-                }
+            int32_t left = x + (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
+            int32_t top = y + (patternRow + patternYSpace - patternYPos) % patternYSpace;
+            if (left < x + width && top < y + height)
+            {
+                uint8_t patternPixel = pattern[patternRow * 2 + 1];
+                _drawingContext->DrawWeatherPattern(
+                    patternPixel, left, top, x + width, y + height, patternXSpace, patternYSpace);
             }
-
-            pixelOffset += dpi->pitch + dpi->width;
-            patternYPos++;
-            patternYPos %= patternYSpace;
         }
     }
 };
@@ -198,6 +202,9 @@ private:
     OpenGLFramebuffer* _smoothScaleFramebuffer = nullptr;
     OpenGLWeatherDrawer _weatherDrawer;
 
+    std::vector<uint32_t> _prefetchImages;
+    std::vector<uint32_t> _prefetchViewportImages;
+
 public:
     SDL_Color Palette[256];
     vec4 GLPalette[256];
@@ -334,6 +341,7 @@ public:
     void PaintWindows() override
     {
         window_update_all_viewports();
+        PrefetchViewportImages();
         window_draw_all(&_bitsDPI, 0, 0, _width, _height);
     }
 
@@ -389,6 +397,53 @@ public:
     }
 
 private:
+    /**
+     * Queues the images that scrolling or zooming viewports are about to show, so they are uploaded at the start of
+     * the next frames rather than when a sprite first misses the texture cache in the middle of drawing.
+     */
+    void PrefetchViewportImages()
+    {
+        _prefetchImages.clear();
+        for (const auto& viewport : g_viewport_list)
+        {
+            if (viewport.width == 0)
+                continue;
+
+            _prefetchViewportImages.clear();
+            const ZoomLevel zoom = viewport_get_prefetch_images(&viewport, _prefetchViewportImages);
+            for (uint32_t image : _prefetchViewportImages)
+            {
+                // Zoomed out views draw the smaller copies of images that have them, see DrawSprite
+                const rct_g1_element* g1Element = gfx_get_g1_element(image);
+                for (ZoomLevel imageZoom = zoom; g1Element != nullptr && imageZoom > 0; imageZoom--)
+                {
+                    if (g1Element->flags & G1_FLAG_HAS_ZOOM_SPRITE)
+                    {
+                        image -= g1Element->zoomed_offset;
+                        g1Element = gfx_get_g1_element(image);
+                    }
+                    else
+                    {
+                        if (g1Element->flags & G1_FLAG_NO_ZOOM_DRAW)
+                            g1Element = nullptr;
+                        break;
+                    }
+                }
+                if (g1Element != nullptr)
+                {
+                    _prefetchImages.push_back(image);
+                }
+            }
+        }
+
+        if (_prefetchImages.empty())
+            return;
+
+        std::sort(_prefetchImages.begin(), _prefetchImages.end());
+        _prefetchImages.erase(std::unique(_prefetchImages.begin(), _prefetchImages.end()), _prefetchImages.end());
+        _drawingContext->GetTextureCache()->PrefetchImages(_prefetchImages);
+    }
+
     static OpenGLVersion GetOpenGLVersion()
     {
         CheckGLError(); // Clear Any Errors
@@ -500,7 +555,9 @@ OpenGLDrawingContext::~OpenGLDrawingContext()
     delete _applyTransparencyShader;
     delete _drawLineShader;
     delete _drawRectShader;
+    delete _drawWeatherShader;
     delete _swapFramebuffer;
+    delete _instanceBuffer;
 
     delete _textureCache;
 }
@@ -510,23 +567,43 @@ IDrawingEngine* OpenGLDrawingContext::GetEngine()
     return _engine;
 }
 
+// Terrain, edges and water cover almost every tile of a zoomed out park, so they are queued to be in the atlases
+// before the first park is drawn
+static constexpr std::pair<uint32_t, uint32_t> PrewarmImageRanges[] = {
+    { SPR_EDGE_ROCK_BASE, SPR_TERRAIN_SELECTION_PATROL_AREA },
+    { SPR_TERRAIN_GRASS_MOWED, SPR_TERRAIN_SELECTION_CORNER },
+    { SPR_WATER_MASK, SPR_WATER_OVERLAY + 5 },
+    { SPR_TERRAIN_EDGE_MASK_TOP_RIGHT, SPR_TERRAIN_PATTERN_ICE + 6 },
+};
+
 void OpenGLDrawingContext::Initialise()
 {
     _textureCache = new TextureCache();
+
+    for (const auto& [firstImage, lastImage] : PrewarmImageRanges)
+    {
+        _textureCache->PrewarmImages(firstImage, lastImage - firstImage);
+    }
+
     _applyTransparencyShader = new ApplyTransparencyShader();
     _drawRectShader = new DrawRectShader();
     _drawLineShader = new DrawLineShader();
+    _drawWeatherShader = new DrawWeatherShader();
+    _instanceBuffer = new StreamBuffer(INSTANCE_BUFFER_FRAME_SIZE);
 }
 
 void OpenGLDrawingContext::Resize(int32_t width, int32_t height)
 {
     _commandBuffers.lines.clear();
     _commandBuffers.rects.clear();
+    _commandBuffers.weather.clear();
 
     _drawRectShader->Use();
     _drawRectShader->SetScreenSize(width, height);
     _drawLineShader->Use();
     _drawLineShader->SetScreenSize(width, height);
+    _drawWeatherShader->Use();
+    _drawWeatherShader->SetScreenSize(width, height);
 
     // Re-create canvas framebuffer
     delete _swapFramebuffer;
@@ -542,6 +619,7 @@ void OpenGLDrawingContext::StartNewDraw()
 {
     _drawCount = 0;
     _swapFramebuffer->Clear();
+    _textureCache->UploadPrewarmImages();
 }
 
 void OpenGLDrawingContext::Clear(uint8_t paletteIndex)
@@ -931,6 +1009,30 @@ void OpenGLDrawingContext::DrawGlyph(uint32_t image, int32_t x, int32_t y, const
     command.depth = _drawCount++;
 }
 
+void OpenGLDrawingContext::DrawWeatherPattern(
+    uint8_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t xSpacing, int32_t ySpacing)
+{
+    left += _offsetX;
+    top += _offsetY;
+    right = std::min(right + _offsetX, _clipRight);
+    bottom = std::min(bottom + _offsetY, _clipBottom);
+
+    // Move the origin forward to the first particle inside the clip so the lattice stays aligned
+    if (left < _clipLeft)
+        left += ((_clipLeft - left + xSpacing - 1) / xSpacing) * xSpacing;
+    if (top < _clipTop)
+        top += ((_clipTop - top + ySpacing - 1) / ySpacing) * ySpacing;
+    if (left >= right || top >= bottom)
+        return;
+
+    DrawWeatherCommand& command = _commandBuffers.weather.allocate();
+
+    command.bounds = { left, top, right, bottom };
+    command.spacing = { xSpacing, ySpacing };
+    command.colour = colour;
+    command.depth = _drawCount++;
+}
+
 void OpenGLDrawingContext::FlushCommandBuffers()
 {
     glEnable(GL_DEPTH_TEST);
@@ -942,8 +1044,11 @@ void OpenGLDrawingContext::FlushCommandBuffers()
 
     FlushLines();
     FlushRectangles();
+    FlushWeather();
 
     HandleTransparency();
+
+    _instanceBuffer->EndFrame();
 }
 
 void OpenGLDrawingContext::FlushLines()
@@ -952,11 +1057,22 @@ void OpenGLDrawingContext::FlushLines()
         return;
 
     _drawLineShader->Use();
-    _drawLineShader->DrawInstances(_commandBuffers.lines);
+    _drawLineShader->DrawInstances(_commandBuffers.lines, *_instanceBuffer);
 
     _commandBuffers.lines.clear();
 }
 
+void OpenGLDrawingContext::FlushWeather()
+{
+    if (_commandBuffers.weather.empty())
+        return;
+
+    _drawWeatherShader->Use();
+    _drawWeatherShader->DrawInstances(_commandBuffers.weather, *_instanceBuffer);
+
+    _commandBuffers.weather.clear();
+}
+
 void OpenGLDrawingContext::FlushRectangles()
 {
     if (_commandBuffers.rects.empty())
@@ -966,7 +1082,7 @@ void OpenGLDrawingContext::FlushRectangles()
     OpenGLAPI::SetTexture(1, GL_TEXTURE_2D, _textureCache->GetPaletteTexture());
 
     _drawRectShader->Use();
-    _drawRectShader->SetInstances(_commandBuffers.rects);
+    _drawRectShader->SetInstances(_commandBuffers.rects, *_instanceBuffer);
     _drawRectShader->DrawInstances();
 
     _commandBuffers.rects.clear();
@@ -979,12 +1095,16 @@ void OpenGLDrawingContext::HandleTransparency()
         return;
     }
 
+    // Sorts the batch so that each pass draws a prefix of it
+    TransparencyPasses passes = PlanTransparencyPasses(_commandBuffers.transparent);
+
     _drawRectShader->Use();
-    _drawRectShader->SetInstances(_commandBuffers.transparent);
+    _drawRectShader->SetInstances(_commandBuffers.transparent, *_instanceBuffer);
 
-    int32_t max_depth = MaxTransparencyDepth(_commandBuffers.transparent);
-    for (int32_t i = 0; i < max_depth; ++i)
+    _swapFramebuffer->BeginTransparency(passes[0].bounds);
+    for (size_t i = 0; i < passes.size(); ++i)
     {
+        _swapFramebuffer->SetTransparencyRegion(passes[i].bounds);
         _swapFramebuffer->BindTransparent();
 
         glEnable(GL_DEPTH_TEST);
@@ -1000,9 +1120,10 @@ void OpenGLDrawingContext::HandleTransparency()
         OpenGLAPI::SetTexture(1, GL_TEXTURE_2D, _textureCache->GetPaletteTexture());
 
         _drawRectShader->Use();
-        _drawRectShader->DrawInstances();
+        _drawRectShader->DrawInstances(passes[i].count);
         _swapFramebuffer->ApplyTransparency(*_applyTransparencyShader, _textureCache->GetPaletteTexture());
     }
+    _swapFramebuffer->EndTransparency();
 
     _commandBuffers.transparent.clear();
 }
@@ -0,0 +1,154 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_OPENGL
+
+#    include "StreamBuffer.h"
+
+#    include <cstring>
+
+// Attribute offsets only need to be 4 byte aligned, 16 keeps each batch on its own vec4 boundary
+constexpr size_t WriteAlignment = 16;
+
+constexpr GLuint64 FenceTimeout = 1000000000; // 1 second in nanoseconds
+
+StreamBuffer::StreamBuffer(size_t regionSize)
+{
+    Allocate(regionSize);
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    Release();
+}
+
+void StreamBuffer::Allocate(size_t regionSize)
+{
+    _regionSize = regionSize;
+    _region = 0;
+    _offset = 0;
+    _regionReady = true;
+
+    const auto bufferSize = static_cast<GLsizeiptr>(_regionSize * FramesInFlight);
+    glGenBuffers(1, &_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _buffer);
+    if (OpenGLAPI::BufferStorage != nullptr)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        OpenGLAPI::BufferStorage(GL_ARRAY_BUFFER, bufferSize, nullptr, flags);
+        _persistentData = static_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, flags));
+        if (_persistentData != nullptr)
+            return;
+
+        // Buffer storage is immutable, a new buffer is needed to fall back to mapping each write
+        glDeleteBuffers(1, &_buffer);
+        glGenBuffers(1, &_buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, _buffer);
+    }
+    glBufferData(GL_ARRAY_BUFFER, bufferSize, nullptr, GL_STREAM_DRAW);
+}
+
+void StreamBuffer::Release()
+{
+    for (auto& fence : _fences)
+    {
+        if (fence != nullptr)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (_persistentData != nullptr)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, _buffer);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        _persistentData = nullptr;
+    }
+    // Draws still queued from the buffer keep it alive in the driver until they are done
+    glDeleteBuffers(1, &_buffer);
+    _buffer = 0;
+}
+
+void StreamBuffer::WaitForRegion()
+{
+    auto& fence = _fences[_region];
+    if (fence != nullptr)
+    {
+        // Normally signalled long ago, the GPU would have to be a whole FramesInFlight behind to block here
+        GLenum result;
+        do
+        {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FenceTimeout);
+        } while (result == GL_TIMEOUT_EXPIRED);
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+    _regionReady = true;
+}
+
+size_t StreamBuffer::Write(const void* data, size_t size)
+{
+    size_t offset = (_offset + WriteAlignment - 1) & ~(WriteAlignment - 1);
+    if (offset + size > _regionSize)
+    {
+        // Too much for a region, start again with a fresh buffer big enough for this frame at least
+        size_t regionSize = _regionSize;
+        while (regionSize < offset + size)
+        {
+            regionSize *= 2;
+        }
+        Release();
+        Allocate(regionSize);
+        offset = 0;
+    }
+
+    if (!_regionReady)
+    {
+        WaitForRegion();
+    }
+
+    const size_t bufferOffset = _region * _regionSize + offset;
+    glBindBuffer(GL_ARRAY_BUFFER, _buffer);
+    if (_persistentData != nullptr)
+    {
+        std::memcpy(_persistentData + bufferOffset, data, size);
+    }
+    else
+    {
+        // The range is not in use by the GPU thanks to the fences, so the driver does not need to check
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+        void* dst = glMapBufferRange(
+            GL_ARRAY_BUFFER, static_cast<GLintptr>(bufferOffset), static_cast<GLsizeiptr>(size), flags);
+        if (dst != nullptr)
+        {
+            std::memcpy(dst, data, size);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+    }
+
+    _offset = offset + size;
+    return bufferOffset;
+}
+
+void StreamBuffer::EndFrame()
+{
+    if (_offset == 0)
+    {
+        // Nothing was written, the next frame can carry on with the same region
+        return;
+    }
+
+    _fences[_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _region = (_region + 1) % FramesInFlight;
+    _offset = 0;
+    _regionReady = false;
+}
+
+#endif /* DISABLE_OPENGL */
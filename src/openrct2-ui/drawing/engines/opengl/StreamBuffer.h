@@ -0,0 +1,59 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "OpenGLAPI.h"
+
+#include <array>
+#include <openrct2/common.h>
+
+/**
+ * Ring buffer for per-instance data that is written by the CPU once per frame. The buffer is split into one region
+ * per frame in flight, a fence at the end of each frame tells when the GPU is done with its region so it can be
+ * written again without the driver having to orphan or synchronise the buffer.
+ *
+ * The buffer is mapped persistently when the driver supports buffer storage, otherwise each write maps its range
+ * unsynchronised.
+ */
+class StreamBuffer final
+{
+private:
+    static constexpr size_t FramesInFlight = 3;
+
+    GLuint _buffer = 0;
+    size_t _regionSize = 0;
+    uint8_t* _persistentData = nullptr;
+
+    std::array<GLsync, FramesInFlight> _fences{};
+    size_t _region = 0;
+    size_t _offset = 0;
+    bool _regionReady = false;
+
+public:
+    explicit StreamBuffer(size_t regionSize);
+    ~StreamBuffer();
+
+    StreamBuffer(const StreamBuffer&) = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    /**
+     * Copies the data into the region of the current frame and returns its offset in the buffer. The buffer is left
+     * bound to GL_ARRAY_BUFFER, ready for the attribute pointers to be set up with the offset.
+     */
+    size_t Write(const void* data, size_t size);
+
+    // Fences the region of the current frame and moves on to the next one.
+    void EndFrame();
+
+private:
+    void Allocate(size_t regionSize);
+    void Release();
+    void WaitForRegion();
+};
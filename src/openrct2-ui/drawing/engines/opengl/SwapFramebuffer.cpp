@@ -13,6 +13,8 @@
 
 #    include "OpenGLFramebuffer.h"
 
+#    include <algorithm>
+
 constexpr GLfloat depthValue[1] = { 1.0f };
 constexpr GLfloat depthValueTransparent[1] = { 0.0f };
 constexpr GLuint indexValue[4] = { 0, 0, 0, 0 };
@@ -27,6 +29,38 @@ SwapFramebuffer::SwapFramebuffer(int32_t width, int32_t height)
     glClearBufferfv(GL_DEPTH, 0, depthValueTransparent);
 }
 
+void SwapFramebuffer::BeginTransparency(const ivec4& region)
+{
+    glEnable(GL_SCISSOR_TEST);
+    SetTransparencyRegion(region);
+
+    // Only the regions of the last frame were cleared after use
+    _transparentFramebuffer.Bind();
+    glClearBufferuiv(GL_COLOR, 0, indexValue);
+    glClearBufferfv(GL_DEPTH, 0, depthValueTransparent);
+}
+
+void SwapFramebuffer::SetTransparencyRegion(const ivec4& region)
+{
+    const int32_t width = _opaqueFramebuffer.GetWidth();
+    const int32_t height = _opaqueFramebuffer.GetHeight();
+    const int32_t left = std::clamp(region.x, 0, width);
+    const int32_t top = std::clamp(region.y, 0, height);
+    const int32_t right = std::clamp(region.z, left, width);
+    const int32_t bottom = std::clamp(region.w, top, height);
+
+    _transparencyRegionIsScreen = left == 0 && top == 0 && right == width && bottom == height;
+
+    // Framebuffer rows go from the bottom of the screen up
+    glScissor(left, height - bottom, right - left, bottom - top);
+}
+
+void SwapFramebuffer::EndTransparency()
+{
+    glDisable(GL_SCISSOR_TEST);
+    _transparencyRegionIsScreen = true;
+}
+
 void SwapFramebuffer::ApplyTransparency(ApplyTransparencyShader& shader, GLuint paletteTex)
 {
     _mixFramebuffer.Bind();
@@ -44,7 +78,15 @@ void SwapFramebuffer::ApplyTransparency(ApplyTransparencyShader& shader, GLuint
     glClearBufferuiv(GL_COLOR, 0, indexValue);
     glClearBufferfv(GL_DEPTH, 0, depthValueTransparent);
 
-    _opaqueFramebuffer.SwapColourBuffer(_mixFramebuffer);
+    if (_transparencyRegionIsScreen)
+    {
+        _opaqueFramebuffer.SwapColourBuffer(_mixFramebuffer);
+    }
+    else
+    {
+        // Outside of the region the mix buffer is out of date, the scissor test limits the copy to the region
+        _opaqueFramebuffer.Copy(_mixFramebuffer, GL_NEAREST);
+    }
     // Change binding to guaruntee no undefined behavior
     _opaqueFramebuffer.Bind();
 }
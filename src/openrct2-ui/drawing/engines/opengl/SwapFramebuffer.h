@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ApplyTransparencyShader.h"
+#include "GLSLTypes.h"
 #include "OpenGLAPI.h"
 #include "OpenGLFramebuffer.h"
 
@@ -30,6 +31,7 @@ private:
     OpenGLFramebuffer _transparentFramebuffer;
     OpenGLFramebuffer _mixFramebuffer;
     GLuint _backDepth;
+    bool _transparencyRegionIsScreen = true;
 
 public:
     SwapFramebuffer(int32_t width, int32_t height);
@@ -51,6 +53,15 @@ public:
         _transparentFramebuffer.Bind();
     }
 
+    /*
+     * Limits the transparent draws and ApplyTransparency to a region of the
+     * screen (left, top, right, bottom) until EndTransparency. The first call
+     * also clears the transparent buffers in the region.
+     */
+    void BeginTransparency(const ivec4& region);
+    void SetTransparencyRegion(const ivec4& region);
+    void EndTransparency();
+
     void ApplyTransparency(ApplyTransparencyShader& shader, GLuint paletteTex);
     void Clear();
 };
@@ -17,11 +17,17 @@
 #    include <stdexcept>
 #    include <vector>
 
-constexpr uint32_t UNUSED_INDEX = 0xFFFFFFFF;
+// Layout of the packed image texture entries: four 12 bit bounds, the 12 bit atlas index and a flag for loaded entries
+constexpr uint64_t UNUSED_IMAGE_TEXTURE = 0;
+constexpr uint64_t IMAGE_TEXTURE_LOADED = 1ULL << 63;
+constexpr uint32_t IMAGE_TEXTURE_FIELD_BITS = 12;
+constexpr uint64_t IMAGE_TEXTURE_FIELD_MASK = (1ULL << IMAGE_TEXTURE_FIELD_BITS) - 1;
+
+static_assert(TEXTURE_CACHE_MAX_ATLAS_SIZE <= IMAGE_TEXTURE_FIELD_MASK, "Atlas coordinates do not fit the packed entries");
 
 TextureCache::TextureCache()
 {
-    std::fill(_indexMap.begin(), _indexMap.end(), UNUSED_INDEX);
+    std::fill(_imageTextureMap.begin(), _imageTextureMap.end(), UNUSED_IMAGE_TEXTURE);
 }
 
 TextureCache::~TextureCache()
@@ -33,66 +39,44 @@ void TextureCache::InvalidateImage(uint32_t image)
 {
     unique_lock lock(_mutex);
 
-    uint32_t index = _indexMap[image];
-    if (index == UNUSED_INDEX)
+    uint64_t packed = _imageTextureMap[image].load(std::memory_order_relaxed);
+    if (packed == UNUSED_IMAGE_TEXTURE)
         return;
 
-    AtlasTextureInfo& elem = _textureCache.at(index);
+    _imageTextureMap[image].store(UNUSED_IMAGE_TEXTURE, std::memory_order_release);
 
+    AtlasTextureInfo elem{};
+    elem.index = UnpackImageTexture(packed).index;
+    elem.slot = _atlases[elem.index].GetSlot(UnpackImageBounds(packed));
     _atlases[elem.index].Free(elem);
-    _indexMap[image] = UNUSED_INDEX;
-
-    if (index == _textureCache.size() - 1)
-    {
-        // Last element can be popped back.
-        _textureCache.pop_back();
-    }
-    else
-    {
-        // Swap last element with element to erase and then pop back.
-        AtlasTextureInfo& last = _textureCache.back();
 
-        // Move last to current.
-        elem = last;
-
-        // Change index for moved element.
-        _indexMap[last.image] = index;
-
-        _textureCache.pop_back();
-    }
+    // The image was in use, upload its new pixels before the next frame rather than in the middle of drawing it
+    _prewarmImages.push_back(image);
 }
 
 // Note: for performance reasons, this returns a BasicTextureInfo over an AtlasTextureInfo (also to not expose the cache)
 BasicTextureInfo TextureCache::GetOrLoadImageTexture(uint32_t image)
 {
-    uint32_t index;
-
     image &= 0x7FFFFUL;
 
-    // Try to read cached texture first.
+    // Try to read cached texture first, this is the path almost every sprite takes so it does not lock.
+    uint64_t packed = _imageTextureMap[image].load(std::memory_order_acquire);
+    if (packed != UNUSED_IMAGE_TEXTURE)
     {
-        shared_lock lock(_mutex);
-
-        index = _indexMap[image];
-        if (index != UNUSED_INDEX)
-        {
-            const auto& info = _textureCache[index];
-            return {
-                info.index,
-                info.normalizedBounds,
-            };
-        }
+        return UnpackImageTexture(packed);
     }
 
-    // Load new texture.
+    // Load new texture, unless another thread did while waiting for the lock.
     unique_lock lock(_mutex);
 
-    index = static_cast<uint32_t>(_textureCache.size());
+    packed = _imageTextureMap[image].load(std::memory_order_relaxed);
+    if (packed != UNUSED_IMAGE_TEXTURE)
+    {
+        return UnpackImageTexture(packed);
+    }
 
     AtlasTextureInfo info = LoadImageTexture(image);
-
-    _textureCache.push_back(info);
-    _indexMap[image] = index;
+    _imageTextureMap[image].store(PackImageTexture(info), std::memory_order_release);
 
     return info;
 }
@@ -133,6 +117,61 @@ BasicTextureInfo TextureCache::GetOrLoadGlyphTexture(uint32_t image, const Palet
     return (*it.first).second;
 }
 
+void TextureCache::PrewarmImages(uint32_t firstImage, uint32_t count)
+{
+    unique_lock lock(_mutex);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        _prewarmImages.push_back(firstImage + i);
+    }
+}
+
+/**
+ * Queues images that are expected to be drawn soon. They go ahead of the images queued earlier, which
+ * are less likely to be needed by the next frames.
+ */
+void TextureCache::PrefetchImages(const std::vector<uint32_t>& images)
+{
+    unique_lock lock(_mutex);
+
+    for (uint32_t image : images)
+    {
+        image &= 0x7FFFFUL;
+        if (_imageTextureMap[image].load(std::memory_order_relaxed) == UNUSED_IMAGE_TEXTURE)
+        {
+            _prewarmImages.push_back(image);
+        }
+    }
+}
+
+/**
+ * Uploads queued images into the atlases before any drawing commands of the frame reference them, so the
+ * paint does not have to stop for the upload of sprites that are known to be needed.
+ */
+void TextureCache::UploadPrewarmImages()
+{
+    unique_lock lock(_mutex);
+
+    size_t uploaded = 0;
+    while (!_prewarmImages.empty() && uploaded < TEXTURE_CACHE_MAX_PREWARM_PER_FRAME)
+    {
+        uint32_t image = _prewarmImages.back() & 0x7FFFFUL;
+        _prewarmImages.pop_back();
+
+        if (_imageTextureMap[image].load(std::memory_order_relaxed) != UNUSED_IMAGE_TEXTURE)
+            continue;
+
+        auto g1Element = gfx_get_g1_element(image);
+        if (g1Element == nullptr || g1Element->width == 0 || g1Element->height == 0)
+            continue;
+
+        auto info = LoadImageTexture(image);
+        _imageTextureMap[image].store(PackImageTexture(info), std::memory_order_release);
+        uploaded++;
+    }
+}
+
 void TextureCache::CreateTextures()
 {
     if (!_initialized)
@@ -204,32 +243,40 @@ void TextureCache::EnlargeAtlasesTexture(GLuint newEntries)
 
     GLuint newIndices = _atlasesTextureIndices + newEntries;
 
-    std::vector<char> oldPixels;
-
     if (newIndices > _atlasesTextureCapacity)
     {
-        // Retrieve current array data, growing buffer.
-        oldPixels.resize(_atlasesTextureDimensions * _atlasesTextureDimensions * _atlasesTextureCapacity);
-        if (!oldPixels.empty())
-        {
-            glGetTexImage(GL_TEXTURE_2D_ARRAY, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, oldPixels.data());
-        }
-
         // Initial capacity will be 12 which covers most cases of a fully visible park.
-        _atlasesTextureCapacity = (_atlasesTextureCapacity + 6) << 1UL;
+        GLuint newCapacity = (_atlasesTextureCapacity + 6) << 1UL;
 
-        glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
+        GLuint newTexture;
+        glGenTextures(1, &newTexture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, newTexture);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
         glTexImage3D(
-            GL_TEXTURE_2D_ARRAY, 0, GL_R8UI, _atlasesTextureDimensions, _atlasesTextureDimensions, _atlasesTextureCapacity, 0,
+            GL_TEXTURE_2D_ARRAY, 0, GL_R8UI, _atlasesTextureDimensions, _atlasesTextureDimensions, newCapacity, 0,
             GL_RED_INTEGER, GL_UNSIGNED_BYTE, nullptr);
 
-        // Restore old data
-        if (!oldPixels.empty())
+        // Copy the old atlases layer by layer on the GPU, reading them back to the CPU stalls until all
+        // pending draws are finished
+        if (_atlasesTextureIndices > 0)
         {
-            glTexSubImage3D(
-                GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, _atlasesTextureDimensions, _atlasesTextureDimensions, _atlasesTextureIndices,
-                GL_RED_INTEGER, GL_UNSIGNED_BYTE, oldPixels.data());
+            GLuint framebuffer;
+            glGenFramebuffers(1, &framebuffer);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+            for (GLuint i = 0; i < _atlasesTextureIndices; i++)
+            {
+                glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, _atlasesTexture, 0, i);
+                glCopyTexSubImage3D(
+                    GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, 0, 0, _atlasesTextureDimensions, _atlasesTextureDimensions);
+            }
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+            glDeleteFramebuffers(1, &framebuffer);
         }
+
+        glDeleteTextures(1, &_atlasesTexture);
+        _atlasesTexture = newTexture;
+        _atlasesTextureCapacity = newCapacity;
     }
 
     _atlasesTextureIndices = newIndices;
@@ -333,8 +380,44 @@ void TextureCache::FreeTextures()
 {
     // Free array texture
     glDeleteTextures(1, &_atlasesTexture);
-    _textureCache.clear();
-    std::fill(_indexMap.begin(), _indexMap.end(), UNUSED_INDEX);
+    std::fill(_imageTextureMap.begin(), _imageTextureMap.end(), UNUSED_IMAGE_TEXTURE);
+}
+
+uint64_t TextureCache::PackImageTexture(const AtlasTextureInfo& info)
+{
+    uint64_t packed = IMAGE_TEXTURE_LOADED;
+    packed |= static_cast<uint64_t>(info.bounds.x) & IMAGE_TEXTURE_FIELD_MASK;
+    packed |= (static_cast<uint64_t>(info.bounds.y) & IMAGE_TEXTURE_FIELD_MASK) << (IMAGE_TEXTURE_FIELD_BITS * 1);
+    packed |= (static_cast<uint64_t>(info.bounds.z) & IMAGE_TEXTURE_FIELD_MASK) << (IMAGE_TEXTURE_FIELD_BITS * 2);
+    packed |= (static_cast<uint64_t>(info.bounds.w) & IMAGE_TEXTURE_FIELD_MASK) << (IMAGE_TEXTURE_FIELD_BITS * 3);
+    packed |= (static_cast<uint64_t>(info.index) & IMAGE_TEXTURE_FIELD_MASK) << (IMAGE_TEXTURE_FIELD_BITS * 4);
+    return packed;
+}
+
+ivec4 TextureCache::UnpackImageBounds(uint64_t packed) const
+{
+    return ivec4{
+        static_cast<GLint>(packed & IMAGE_TEXTURE_FIELD_MASK),
+        static_cast<GLint>((packed >> (IMAGE_TEXTURE_FIELD_BITS * 1)) & IMAGE_TEXTURE_FIELD_MASK),
+        static_cast<GLint>((packed >> (IMAGE_TEXTURE_FIELD_BITS * 2)) & IMAGE_TEXTURE_FIELD_MASK),
+        static_cast<GLint>((packed >> (IMAGE_TEXTURE_FIELD_BITS * 3)) & IMAGE_TEXTURE_FIELD_MASK),
+    };
+}
+
+BasicTextureInfo TextureCache::UnpackImageTexture(uint64_t packed) const
+{
+    // All atlases have the same dimensions, which are determined before the first image is loaded
+    auto bounds = UnpackImageBounds(packed);
+    auto dimensions = static_cast<float>(_atlasesTextureDimensions);
+    return {
+        static_cast<GLuint>((packed >> (IMAGE_TEXTURE_FIELD_BITS * 4)) & IMAGE_TEXTURE_FIELD_MASK),
+        vec4{
+            bounds.x / dimensions,
+            bounds.y / dimensions,
+            bounds.z / dimensions,
+            bounds.w / dimensions,
+        },
+    };
 }
 
 rct_drawpixelinfo TextureCache::CreateDPI(int32_t width, int32_t height)
@@ -15,6 +15,7 @@
 #include <SDL_pixels.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <openrct2/common.h>
 #ifndef __MACOSX__
@@ -59,6 +60,10 @@ constexpr int32_t TEXTURE_CACHE_MAX_ATLAS_SIZE = 2048;
 // Must be a power of 2!
 constexpr int32_t TEXTURE_CACHE_SMALLEST_SLOT = 32;
 
+// Maximum number of queued images uploaded ahead of drawing each frame, so pre-warming
+// a large range of images does not stall a single frame
+constexpr size_t TEXTURE_CACHE_MAX_PREWARM_PER_FRAME = 256;
+
 struct BasicTextureInfo
 {
     GLuint index;
@@ -145,6 +150,12 @@ public:
         return imageOrder == atlasOrder;
     }
 
+    // Returns the slot that the given bounds were allocated from
+    [[nodiscard]] GLuint GetSlot(const ivec4& bounds) const
+    {
+        return (bounds.y / _imageSize) * _cols + (bounds.x / _imageSize);
+    }
+
     [[nodiscard]] int32_t GetFreeSlots() const
     {
         return static_cast<int32_t>(_freeSlots.size());
@@ -199,8 +210,11 @@ private:
     GLint _atlasesTextureIndicesLimit = 0;
     std::vector<Atlas> _atlases;
     std::unordered_map<GlyphId, AtlasTextureInfo, GlyphId::Hash, GlyphId::Equal> _glyphTextureMap;
-    std::vector<AtlasTextureInfo> _textureCache;
-    std::array<uint32_t, 0x7FFFF> _indexMap;
+    std::vector<uint32_t> _prewarmImages;
+
+    // Atlas index and bounds of every loaded image packed into one word, so sprite lookups can read them without
+    // taking the mutex. Entries are only written with the mutex held, on the render thread.
+    std::array<std::atomic<uint64_t>, 0x7FFFF> _imageTextureMap;
 
     GLuint _paletteTexture = 0;
 
@@ -220,6 +234,9 @@ public:
     void InvalidateImage(uint32_t image);
     BasicTextureInfo GetOrLoadImageTexture(uint32_t image);
     BasicTextureInfo GetOrLoadGlyphTexture(uint32_t image, const PaletteMap& paletteMap);
+    void PrewarmImages(uint32_t firstImage, uint32_t count);
+    void PrefetchImages(const std::vector<uint32_t>& images);
+    void UploadPrewarmImages();
 
     GLuint GetAtlasesTexture();
     GLuint GetPaletteTexture();
@@ -236,6 +253,10 @@ private:
     static rct_drawpixelinfo GetGlyphAsDPI(uint32_t image, const PaletteMap& paletteMap);
     void FreeTextures();
 
+    static uint64_t PackImageTexture(const AtlasTextureInfo& info);
+    [[nodiscard]] BasicTextureInfo UnpackImageTexture(uint64_t packed) const;
+    [[nodiscard]] ivec4 UnpackImageBounds(uint64_t packed) const;
+
     static rct_drawpixelinfo CreateDPI(int32_t width, int32_t height);
     static void DeleteDPI(rct_drawpixelinfo dpi);
 };
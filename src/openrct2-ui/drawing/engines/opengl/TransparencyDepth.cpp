@@ -13,6 +13,7 @@
 
 #    include <algorithm>
 #    include <map>
+#    include <numeric>
 #    include <vector>
 
 /*
@@ -26,6 +27,21 @@ struct XData
 };
 using SweepLine = std::vector<XData>;
 
+/*
+ * Returns the bounds of the command after clipping, as left, top, right, bottom.
+ */
+static inline ivec4 GetClippedBounds(const DrawRectCommand& command)
+{
+    int32_t left = std::min(std::max(command.bounds.x, command.clip.x), command.clip.z);
+    int32_t top = std::min(std::max(command.bounds.y, command.clip.y), command.clip.w);
+    int32_t right = std::min(std::max(command.bounds.z, command.clip.x), command.clip.z);
+    int32_t bottom = std::min(std::max(command.bounds.w, command.clip.y), command.clip.w);
+
+    assert(left <= right);
+    assert(top <= bottom);
+    return { left, top, right, bottom };
+}
+
 /*
  * Creates a list of vertical bounding box edges, stored as xdata and sorted
  * from left to right. If multiple edges are at the same x coordinate, Then
@@ -38,20 +54,14 @@ static inline SweepLine CreateXList(const RectCommandBatch& transparent)
 
     for (const DrawRectCommand& command : transparent)
     {
-        int32_t left = std::min(std::max(command.bounds.x, command.clip.x), command.clip.z);
-        int32_t top = std::min(std::max(command.bounds.y, command.clip.y), command.clip.w);
-        int32_t right = std::min(std::max(command.bounds.z, command.clip.x), command.clip.z);
-        int32_t bottom = std::min(std::max(command.bounds.w, command.clip.y), command.clip.w);
-
-        assert(left <= right);
-        assert(top <= bottom);
-        if (left == right)
+        ivec4 bounds = GetClippedBounds(command);
+        if (bounds.x == bounds.z)
             continue;
-        if (top == bottom)
+        if (bounds.y == bounds.w)
             continue;
 
-        x_sweep.push_back({ left, true, top, bottom });
-        x_sweep.push_back({ right, false, top, bottom });
+        x_sweep.push_back({ bounds.x, true, bounds.y, bounds.w });
+        x_sweep.push_back({ bounds.z, false, bounds.y, bounds.w });
     }
 
     std::sort(x_sweep.begin(), x_sweep.end(), [](const XData& a, const XData& b) -> bool {
@@ -205,4 +215,80 @@ int32_t MaxTransparencyDepth(const RectCommandBatch& transparent)
     return max_depth;
 }
 
+TransparencyPasses PlanTransparencyPasses(RectCommandBatch& transparent)
+{
+    const size_t count = transparent.size();
+    if (count == 0)
+        return {};
+
+    std::vector<ivec4> bounds(count);
+    std::vector<int32_t> layers(count, 1);
+    std::vector<size_t> order(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        bounds[i] = GetClippedBounds(transparent[i]);
+    }
+    std::iota(order.begin(), order.end(), 0);
+
+    /*
+     * Count the overlaps by sweeping from left to right, only the commands
+     * starting before the current one ends can overlap it.
+     */
+    std::sort(order.begin(), order.end(), [&bounds](size_t a, size_t b) { return bounds[a].x < bounds[b].x; });
+    for (size_t a = 0; a < count; a++)
+    {
+        const ivec4& current = bounds[order[a]];
+        if (current.x == current.z || current.y == current.w)
+            continue;
+
+        for (size_t b = a + 1; b < count; b++)
+        {
+            const ivec4& other = bounds[order[b]];
+            if (other.x >= current.z)
+                break;
+            if (other.x == other.z || other.y >= current.w || other.w <= current.y)
+                continue;
+
+            layers[order[a]]++;
+            layers[order[b]]++;
+        }
+    }
+
+    // The sweep line bound is usually tighter for large clusters of overlapping commands
+    const int32_t max_depth = MaxTransparencyDepth(transparent);
+    for (auto& commandLayers : layers)
+    {
+        commandLayers = std::min(commandLayers, max_depth);
+    }
+
+    std::sort(order.begin(), order.end(), [&layers](size_t a, size_t b) { return layers[a] > layers[b]; });
+    std::vector<DrawRectCommand> sorted;
+    sorted.reserve(count);
+    for (size_t i : order)
+    {
+        sorted.push_back(transparent[i]);
+    }
+    std::copy(sorted.begin(), sorted.end(), transparent.begin());
+
+    /*
+     * Iteration i draws the commands with more than i layers, a prefix of the
+     * sorted batch, within the area covered by them.
+     */
+    TransparencyPasses passes(layers[order[0]]);
+    ivec4 area = { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+    for (size_t i = 0; i < count; i++)
+    {
+        const ivec4& current = bounds[order[i]];
+        area = { std::min(area.x, current.x), std::min(area.y, current.y), std::max(area.z, current.z),
+                 std::max(area.w, current.w) };
+
+        int32_t nextLayers = i + 1 < count ? layers[order[i + 1]] : 0;
+        for (int32_t pass = nextLayers; pass < layers[order[i]]; pass++)
+        {
+            passes[pass] = { i + 1, area };
+        }
+    }
+    return passes;
+}
+
 #endif /* DISABLE_OPENGL */
@@ -12,6 +12,7 @@
 #include "DrawCommands.h"
 
 #include <openrct2/common.h>
+#include <vector>
 
 /*
  * Determines an aproximation of the number of depth peeling iterations needed
@@ -19,3 +20,24 @@
  * iterations, but it can overestimate, usually by no more than +2.
  */
 int32_t MaxTransparencyDepth(const RectCommandBatch& transparent);
+
+/*
+ * A depth peeling iteration only has to draw the first count commands of the
+ * batch, and only changes pixels inside bounds (left, top, right, bottom).
+ */
+struct TransparencyPass
+{
+    size_t count;
+    ivec4 bounds;
+};
+using TransparencyPasses = std::vector<TransparencyPass>;
+
+/*
+ * Plans the depth peeling iterations for the command batch. Each command is
+ * given an upper bound on the number of transparent layers under it, one more
+ * than the number of other commands it overlaps, and the batch is sorted so
+ * the commands with the most layers come first. Iteration i then only draws
+ * the commands that can have more than i layers, which for most frames leaves
+ * just a few small areas for all but the first iteration.
+ */
+TransparencyPasses PlanTransparencyPasses(RectCommandBatch& transparent);
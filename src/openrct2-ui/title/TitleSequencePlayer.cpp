@@ -12,6 +12,7 @@
 #include "../interface/Window.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
@@ -21,6 +22,7 @@
 #include <openrct2/common.h>
 #include <openrct2/core/Console.hpp>
 #include <openrct2/core/Guard.hpp>
+#include <openrct2/core/MemoryStream.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/interface/Viewport.h>
@@ -55,6 +57,10 @@ private:
     int32_t _lastScreenHeight = 0;
     CoordsXY _viewCentreLocation = {};
 
+    // The park of the next load command, read on a background thread while the current scene plays
+    std::future<std::unique_ptr<TitleSequenceParkHandle>> _prefetchedPark;
+    int32_t _prefetchedSaveIndex = -1;
+
 public:
     explicit TitleSequencePlayer(GameState& gameState)
         : _gameState(gameState)
@@ -74,6 +80,8 @@ public:
     void Eject() override
     {
         _sequence = nullptr;
+        _prefetchedPark = {};
+        _prefetchedSaveIndex = -1;
     }
 
     bool Begin(size_t titleSequenceId) override
@@ -276,11 +284,12 @@ private:
             {
                 bool loadSuccess = false;
                 uint8_t saveIndex = command.SaveIndex;
-                auto parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
+                auto parkHandle = GetParkHandle(saveIndex);
                 if (parkHandle != nullptr)
                 {
                     loadSuccess = LoadParkFromStream(parkHandle->Stream.get(), parkHandle->HintPath);
                 }
+                PrefetchNextPark();
                 if (!loadSuccess)
                 {
                     if (_sequence->Saves.size() > saveIndex)
@@ -311,6 +320,71 @@ private:
         return true;
     }
 
+    std::unique_ptr<TitleSequenceParkHandle> GetParkHandle(uint8_t saveIndex)
+    {
+        if (_prefetchedPark.valid())
+        {
+            auto parkHandle = _prefetchedPark.get();
+            if (parkHandle != nullptr && _prefetchedSaveIndex == saveIndex)
+            {
+                return parkHandle;
+            }
+        }
+        return TitleSequenceGetParkHandle(*_sequence, saveIndex);
+    }
+
+    /**
+     * Starts reading the park of the next load command into memory. Decoding and importing the park modify the object
+     * repository and the game state, so those are left for when the command runs.
+     */
+    void PrefetchNextPark()
+    {
+        int32_t position = _position;
+        const TitleCommand* command = nullptr;
+        do
+        {
+            position = (position + 1) % static_cast<int32_t>(_sequence->Commands.size());
+            command = &_sequence->Commands[position];
+        } while (!TitleSequenceIsLoadCommand(*command) && position != _position);
+
+        if (command->Type != TITLE_SCRIPT_LOAD)
+        {
+            return;
+        }
+
+        // Only what is needed to find the park, the player's sequence may be ejected before the read finishes
+        TitleSequence sequence;
+        sequence.Path = _sequence->Path;
+        sequence.Saves = _sequence->Saves;
+        sequence.IsZip = _sequence->IsZip;
+
+        _prefetchedSaveIndex = command->SaveIndex;
+        _prefetchedPark = std::async(std::launch::async, [sequence = std::move(sequence), saveIndex = command->SaveIndex]() {
+            return ReadParkIntoMemory(sequence, saveIndex);
+        });
+    }
+
+    static std::unique_ptr<TitleSequenceParkHandle> ReadParkIntoMemory(const TitleSequence& sequence, size_t saveIndex)
+    {
+        try
+        {
+            auto parkHandle = TitleSequenceGetParkHandle(sequence, saveIndex);
+            if (parkHandle != nullptr && dynamic_cast<MemoryStream*>(parkHandle->Stream.get()) == nullptr)
+            {
+                auto length = static_cast<size_t>(parkHandle->Stream->GetLength());
+                std::vector<uint8_t> data(length);
+                parkHandle->Stream->Read(data.data(), length);
+                parkHandle->Stream = std::make_unique<MemoryStream>(data.data(), length);
+            }
+            return parkHandle;
+        }
+        catch (const std::exception&)
+        {
+            // The park is read again on the main thread, which reports the error
+            return nullptr;
+        }
+    }
+
     void SetViewZoom(const uint32_t& zoom)
     {
         rct_window* w = window_get_main();
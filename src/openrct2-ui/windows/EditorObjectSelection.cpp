@@ -283,6 +283,47 @@ static bool visible_list_sort_ride_type(const list_item& a, const list_item& b)
     return result != 0 ? result < 0 : visible_list_sort_ride_name(a, b);
 }
 
+static list_item visible_list_create_item(size_t index)
+{
+    auto filter = std::make_unique<rct_object_filters>();
+    filter->ride.category[0] = 0;
+    filter->ride.category[1] = 0;
+    filter->ride.ride_type = 0;
+
+    const ObjectRepositoryItem* item = &object_repository_get_items()[index];
+    list_item currentListItem;
+    currentListItem.repositoryItem = item;
+    currentListItem.entry = const_cast<rct_object_entry*>(&item->ObjectEntry);
+    currentListItem.filter = std::move(filter);
+    currentListItem.flags = &_objectSelectionFlags[index];
+    return currentListItem;
+}
+
+static void visible_list_sort()
+{
+    sortFunc_t sortFunc = nullptr;
+    switch (_listSortType)
+    {
+        case RIDE_SORT_TYPE:
+            sortFunc = visible_list_sort_ride_type;
+            break;
+        case RIDE_SORT_RIDE:
+            sortFunc = visible_list_sort_ride_name;
+            break;
+        default:
+            log_warning("Wrong sort type %d, leaving list as-is.", _listSortType);
+            break;
+    }
+    if (sortFunc != nullptr)
+    {
+        std::sort(_listItems.begin(), _listItems.end(), sortFunc);
+        if (_listSortDescending)
+        {
+            std::reverse(_listItems.begin(), _listItems.end());
+        }
+    }
+}
+
 static void visible_list_refresh(rct_window* w)
 {
     int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
@@ -299,17 +340,7 @@ static void visible_list_refresh(rct_window* w)
         if (objectType == get_selected_object_type(w) && !(selectionFlags & OBJECT_SELECTION_FLAG_6) && filter_source(item)
             && filter_string(item) && filter_chunks(item) && filter_selected(selectionFlags))
         {
-            auto filter = std::make_unique<rct_object_filters>();
-            filter->ride.category[0] = 0;
-            filter->ride.category[1] = 0;
-            filter->ride.ride_type = 0;
-
-            list_item currentListItem;
-            currentListItem.repositoryItem = item;
-            currentListItem.entry = const_cast<rct_object_entry*>(&item->ObjectEntry);
-            currentListItem.filter = std::move(filter);
-            currentListItem.flags = &_objectSelectionFlags[i];
-            _listItems.push_back(std::move(currentListItem));
+            _listItems.push_back(visible_list_create_item(i));
         }
     }
 
@@ -319,28 +350,64 @@ static void visible_list_refresh(rct_window* w)
     }
     else
     {
-        sortFunc_t sortFunc = nullptr;
-        switch (_listSortType)
+        visible_list_sort();
+    }
+    w->Invalidate();
+}
+
+/**
+ * A change in selection only affects the filter counts and visible list when the selected or non selected filter is on,
+ * and then only for the objects whose selection changed. Those are found by comparing the selection flags, which is far
+ * cheaper than running the other filters on every object again.
+ */
+static void visible_list_update_selection(rct_window* w, const std::vector<uint8_t>& previousSelectionFlags)
+{
+    if (_FILTER_SELECTED == _FILTER_NONSELECTED)
+    {
+        return;
+    }
+
+    const ObjectRepositoryItem* items = object_repository_get_items();
+    const ObjectType selectedObjectType = get_selected_object_type(w);
+    bool listChanged = false;
+    const size_t numObjects = std::min(_objectSelectionFlags.size(), previousSelectionFlags.size());
+    for (size_t i = 0; i < numObjects; i++)
+    {
+        const uint8_t selectionFlags = _objectSelectionFlags[i];
+        const bool wasVisible = filter_selected(previousSelectionFlags[i]);
+        const bool isVisible = filter_selected(selectionFlags);
+        const ObjectRepositoryItem* item = &items[i];
+        if (wasVisible == isVisible || !filter_source(item) || !filter_string(item) || !filter_chunks(item))
         {
-            case RIDE_SORT_TYPE:
-                sortFunc = visible_list_sort_ride_type;
-                break;
-            case RIDE_SORT_RIDE:
-                sortFunc = visible_list_sort_ride_name;
-                break;
-            default:
-                log_warning("Wrong sort type %d, leaving list as-is.", _listSortType);
-                break;
+            continue;
         }
-        if (sortFunc != nullptr)
+
+        ObjectType objectType = item->ObjectEntry.GetType();
+        _filter_object_counts[EnumValue(objectType)] += isVisible ? 1 : -1;
+
+        if (objectType == selectedObjectType && !(selectionFlags & OBJECT_SELECTION_FLAG_6))
         {
-            std::sort(_listItems.begin(), _listItems.end(), sortFunc);
-            if (_listSortDescending)
+            if (isVisible)
+            {
+                _listItems.push_back(visible_list_create_item(i));
+            }
+            else
             {
-                std::reverse(_listItems.begin(), _listItems.end());
+                _listItems.erase(
+                    std::remove_if(
+                        _listItems.begin(), _listItems.end(),
+                        [item](const list_item& listItem) { return listItem.repositoryItem == item; }),
+                    _listItems.end());
             }
+            listChanged = true;
         }
     }
+
+    if (listChanged)
+    {
+        w->selected_list_item = -1;
+        visible_list_sort();
+    }
     w->Invalidate();
 }
 
@@ -701,6 +768,7 @@ static void window_editor_object_selection_scroll_mousedown(
         flags |= INPUT_FLAG_EDITOR_OBJECT_SELECT;
 
     _maxObjectsWasHit = false;
+    const auto previousSelectionFlags = _objectSelectionFlags;
     if (!window_editor_object_selection_select_object(0, flags, listItem->entry))
     {
         rct_string_id error_title = (flags & INPUT_FLAG_EDITOR_OBJECT_SELECT) ? STR_UNABLE_TO_SELECT_THIS_OBJECT
@@ -710,12 +778,7 @@ static void window_editor_object_selection_scroll_mousedown(
         return;
     }
 
-    if (_FILTER_SELECTED || _FILTER_NONSELECTED)
-    {
-        filter_update_counts();
-        visible_list_refresh(w);
-        w->Invalidate();
-    }
+    visible_list_update_selection(w, previousSelectionFlags);
 
     if (_maxObjectsWasHit)
     {
@@ -20,7 +20,10 @@
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/sprites.h>
 #include <openrct2/util/Util.h>
+#include <openrct2/world/Park.h>
 #include <openrct2/world/Sprite.h>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_GUESTS;
@@ -86,6 +89,9 @@ static rct_widget window_guest_list_widgets[] = {
 static constexpr const uint8_t SUMMARISED_GUEST_ROW_HEIGHT = SCROLLABLE_ROW_HEIGHT + 11;
 static constexpr const auto GUESTS_PER_PAGE = 2000;
 static constexpr const auto GUEST_PAGE_HEIGHT = GUESTS_PER_PAGE * SCROLLABLE_ROW_HEIGHT;
+// Guest count changes arrive every time a guest enters or leaves the park, so refreshes they request are batched up and
+// the list is rebuilt at most once every this many updates.
+static constexpr const uint32_t GUEST_LIST_REFRESH_INTERVAL = 16;
 
 static std::vector<uint16_t> GuestList;
 
@@ -139,9 +145,34 @@ static bool operator!=(const FilterArguments& l, const FilterArguments& r)
     return !(l == r);
 }
 
+struct FilterArgumentsHash
+{
+    size_t operator()(const FilterArguments& value) const
+    {
+        // FNV-1a
+        size_t hash = 2166136261U;
+        for (auto b : value.args)
+        {
+            hash = (hash ^ b) * 16777619U;
+        }
+        return hash;
+    }
+};
+
+// Sort key of a guest in the individual list, worked out once per rebuild rather than once per comparison.
+struct GuestListEntry
+{
+    uint16_t SpriteIndex;
+    uint32_t Id;
+    bool HasName;
+    std::string Name;
+};
+
 static uint32_t _window_guest_list_last_find_groups_tick;
 static uint32_t _window_guest_list_last_find_groups_selected_view;
 static uint32_t _window_guest_list_last_find_groups_wait;
+static bool _window_guest_list_refresh_pending;
+static uint32_t _window_guest_list_refresh_wait;
 
 static uint32_t _window_guest_list_highlighted_index; // 0x00F1EE10
 static int32_t _window_guest_list_selected_tab;       // 0x00F1EE12
@@ -156,16 +187,17 @@ static FilterArguments _window_guest_list_filter_arguments;
 static uint16_t _window_guest_list_groups_num_guests[240];
 static FilterArguments _window_guest_list_groups_arguments[240];
 static uint8_t _window_guest_list_groups_guest_faces[240 * 58];
-static uint8_t _window_guest_list_group_index[240];
 
 static char _window_guest_list_filter_name[32];
 
 static int32_t window_guest_list_is_peep_in_filter(Peep* peep);
 static void window_guest_list_find_groups();
+static void window_guest_list_rebuild_list();
 
 static FilterArguments get_arguments_from_peep(const Peep* peep);
 
-static bool guest_should_be_visible(Peep* peep);
+static bool guest_should_be_visible(Peep* peep, const std::string& name);
+static std::string get_peep_name(const Peep* peep);
 
 void window_guest_list_init_vars()
 {
@@ -174,6 +206,8 @@ void window_guest_list_init_vars()
     _window_guest_list_last_find_groups_tick = 0xFFFFFFFF;
     _window_guest_list_selected_filter = 0xFF;
     _window_guest_list_last_find_groups_wait = 0;
+    _window_guest_list_refresh_pending = false;
+    _window_guest_list_refresh_wait = 0;
 }
 
 /**
@@ -212,7 +246,7 @@ rct_window* window_guest_list_open()
     window->min_height = 330;
     window->max_width = 500;
     window->max_height = 450;
-    window_guest_list_refresh_list();
+    window_guest_list_rebuild_list();
     return window;
 }
 
@@ -223,6 +257,14 @@ void window_guest_list_refresh_list()
         return;
     }
 
+    _window_guest_list_refresh_pending = true;
+}
+
+static void window_guest_list_rebuild_list()
+{
+    _window_guest_list_refresh_pending = false;
+    _window_guest_list_refresh_wait = GUEST_LIST_REFRESH_INTERVAL;
+
     // Only the individual tab uses the GuestList so no point calculating it
     if (_window_guest_list_selected_tab != PAGE_INDIVIDUAL)
     {
@@ -232,7 +274,9 @@ void window_guest_list_refresh_list()
         return;
     }
 
-    GuestList.clear();
+    static std::vector<GuestListEntry> entries;
+    entries.clear();
+    bool anyNamed = false;
     for (auto peep : EntityList<Guest>(EntityListId::Peep))
     {
         sprite_set_flashing(peep, false);
@@ -244,12 +288,43 @@ void window_guest_list_refresh_list()
                 continue;
             sprite_set_flashing(peep, true);
         }
-        if (!guest_should_be_visible(peep))
-            continue;
-        GuestList.push_back(peep->sprite_index);
+        entries.push_back({ peep->sprite_index, peep->Id, peep->NameId != INTERNED_STRING_NULL, {} });
+        anyNamed |= peep->NameId != INTERNED_STRING_NULL;
     }
 
-    std::sort(GuestList.begin(), GuestList.end(), [](const uint16_t a, const uint16_t b) { return peep_compare(a, b) < 0; });
+    // Each name is formatted once here instead of on every comparison. They are only needed when sorting by name or
+    // filtering by name, numbered guests are otherwise sorted by id.
+    bool realNames = (gParkFlags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES) != 0;
+    if (realNames || anyNamed || _window_guest_list_filter_name[0] != '\0')
+    {
+        for (auto& entry : entries)
+        {
+            auto peep = GetEntity<Guest>(entry.SpriteIndex);
+            if (peep != nullptr)
+                entry.Name = get_peep_name(peep);
+        }
+    }
+
+    entries.erase(
+        std::remove_if(
+            entries.begin(), entries.end(),
+            [](const GuestListEntry& entry) {
+                auto peep = GetEntity<Guest>(entry.SpriteIndex);
+                return peep == nullptr || !guest_should_be_visible(peep, entry.Name);
+            }),
+        entries.end());
+
+    // Same order as peep_compare, guests are all of the same type
+    std::sort(entries.begin(), entries.end(), [realNames](const GuestListEntry& a, const GuestListEntry& b) {
+        if (!a.HasName && !b.HasName && !realNames)
+            return a.Id < b.Id;
+        return strlogicalcmp(a.Name.c_str(), b.Name.c_str()) < 0;
+    });
+
+    GuestList.clear();
+    GuestList.reserve(entries.size());
+    for (const auto& entry : entries)
+        GuestList.push_back(entry.SpriteIndex);
 }
 
 /**
@@ -328,7 +403,7 @@ rct_window* window_guest_list_open_with_filter(GuestListFilterType type, int32_t
         }
     }
 
-    window_guest_list_refresh_list();
+    window_guest_list_rebuild_list();
     return w;
 }
 
@@ -354,7 +429,7 @@ static void window_guest_list_mouseup(rct_window* w, rct_widgetindex widgetIndex
                 w->pressed_widgets &= ~(1 << WIDX_TRACKING);
             w->Invalidate();
             w->scrolls[0].v_top = 0;
-            window_guest_list_refresh_list();
+            window_guest_list_rebuild_list();
             break;
         case WIDX_FILTER_BY_NAME:
             if (strnlen(_window_guest_list_filter_name, sizeof(_window_guest_list_filter_name)) > 0)
@@ -362,7 +437,7 @@ static void window_guest_list_mouseup(rct_window* w, rct_widgetindex widgetIndex
                 // Unset the search filter.
                 _window_guest_list_filter_name[0] = '\0';
                 w->pressed_widgets &= ~(1 << WIDX_FILTER_BY_NAME);
-                window_guest_list_refresh_list();
+                window_guest_list_rebuild_list();
             }
             else
             {
@@ -424,7 +499,7 @@ static void window_guest_list_mousedown(rct_window* w, rct_widgetindex widgetInd
             _window_guest_list_selected_filter = -1;
             w->Invalidate();
             w->scrolls[0].v_top = 0;
-            window_guest_list_refresh_list();
+            window_guest_list_rebuild_list();
             break;
         case WIDX_PAGE_DROPDOWN_BUTTON:
             widget = &w->widgets[widgetIndex - 1];
@@ -493,6 +568,15 @@ static void window_guest_list_update(rct_window* w)
     {
         _window_guest_list_last_find_groups_wait--;
     }
+    if (_window_guest_list_refresh_wait != 0)
+    {
+        _window_guest_list_refresh_wait--;
+    }
+    if (_window_guest_list_refresh_pending && _window_guest_list_refresh_wait == 0)
+    {
+        window_guest_list_rebuild_list();
+        w->Invalidate();
+    }
     w->list_information_type++;
     if (w->list_information_type >= (_window_guest_list_selected_tab == PAGE_INDIVIDUAL ? 24 : 32))
         w->list_information_type = 0;
@@ -563,18 +647,13 @@ static void window_guest_list_scrollmousedown(rct_window* w, int32_t scrollIndex
         case PAGE_INDIVIDUAL:
             i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
             i += _window_guest_list_selected_page * GUESTS_PER_PAGE;
-            for (auto spriteIndex : GuestList)
+            if (i < GuestList.size())
             {
-                if (i == 0)
+                auto guest = GetEntity<Guest>(GuestList[i]);
+                if (guest != nullptr)
                 {
-                    auto guest = GetEntity<Guest>(spriteIndex);
-                    if (guest != nullptr)
-                    {
-                        window_guest_open(guest);
-                    }
-                    break;
+                    window_guest_open(guest);
                 }
-                i--;
             }
             break;
         case PAGE_SUMMARISED:
@@ -587,7 +666,7 @@ static void window_guest_list_scrollmousedown(rct_window* w, int32_t scrollIndex
                 window_guest_list_widgets[WIDX_TRACKING].type = WWT_FLATBTN;
                 w->Invalidate();
                 w->scrolls[0].v_top = 0;
-                window_guest_list_refresh_list();
+                window_guest_list_rebuild_list();
             }
             break;
     }
@@ -745,19 +824,24 @@ static void window_guest_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi,
     {
         case PAGE_INDIVIDUAL:
         {
-            uint32_t i = 0;
-            y = _window_guest_list_selected_page * -GUEST_PAGE_HEIGHT;
+            // Only visit the rows that intersect the clip rectangle
+            int32_t pageTop = _window_guest_list_selected_page * GUEST_PAGE_HEIGHT;
+            int32_t firstRow = std::max(0, (pageTop + dpi->y - 1) / SCROLLABLE_ROW_HEIGHT);
+            int32_t lastRow = std::min<int32_t>(
+                static_cast<int32_t>(GuestList.size()), (pageTop + dpi->y + dpi->height) / SCROLLABLE_ROW_HEIGHT + 1);
 
-            // For each guest
-            for (auto spriteIndex : GuestList)
+            for (int32_t i = firstRow; i < lastRow; i++)
             {
+                auto spriteIndex = GuestList[i];
+                y = i * SCROLLABLE_ROW_HEIGHT - pageTop;
+
                 // Check if y is beyond the scroll control
                 if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi->y && y < 0x7FFF
                     && y < dpi->y + dpi->height)
                 {
                     // Highlight backcolour and text colour (format)
                     format = STR_BLACK_STRING;
-                    if (i == _window_guest_list_highlighted_index)
+                    if (static_cast<uint32_t>(i) == _window_guest_list_highlighted_index)
                     {
                         gfx_filter_rect(dpi, 0, y, 800, y + SCROLLABLE_ROW_HEIGHT - 1, PALETTE_DARKEN_1);
                         format = STR_WINDOW_COLOUR_2_STRINGID;
@@ -808,10 +892,6 @@ static void window_guest_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi,
                             break;
                     }
                 }
-
-                // Increment list item index and y
-                i++;
-                y += SCROLLABLE_ROW_HEIGHT;
             }
             break;
         }
@@ -865,7 +945,7 @@ static void window_guest_list_textinput(rct_window* w, rct_widgetindex widgetInd
     {
         safe_strcpy(_window_guest_list_filter_name, text, sizeof(_window_guest_list_filter_name));
         w->pressed_widgets |= (1 << WIDX_FILTER_BY_NAME);
-        window_guest_list_refresh_list();
+        window_guest_list_rebuild_list();
     }
 }
 
@@ -940,122 +1020,75 @@ static void window_guest_list_find_groups()
     _window_guest_list_last_find_groups_tick = tick256;
     _window_guest_list_last_find_groups_selected_view = _window_guest_list_selected_view;
     _window_guest_list_last_find_groups_wait = 320;
-    _window_guest_list_num_groups = 0;
 
-    // Set all guests to unassigned
+    // Group every guest in a single pass, keyed by their action or thought
+    struct GuestGroup
     {
-        for (auto peep : EntityList<Guest>(EntityListId::Peep))
-        {
-            if (!peep->OutsideOfPark)
-            {
-                peep->flags |= SPRITE_FLAGS_PEEP_VISIBLE;
-            }
-        }
-    }
-    // For each guest / group
+        FilterArguments Arguments;
+        uint32_t NumGuests;
+        uint8_t Faces[56];
+    };
+    static std::vector<GuestGroup> groups;
+    static std::unordered_map<FilterArguments, size_t, FilterArgumentsHash> groupIndices;
+    groups.clear();
+    groupIndices.clear();
     for (auto peep : EntityList<Guest>(EntityListId::Peep))
     {
-        if (peep->OutsideOfPark || !(peep->flags & SPRITE_FLAGS_PEEP_VISIBLE))
+        if (peep->OutsideOfPark)
             continue;
 
-        // New group, cap at 240 though
-        int32_t groupIndex = _window_guest_list_num_groups;
-        if (groupIndex >= 240)
-            break;
-
-        _window_guest_list_num_groups++;
-        _window_guest_list_groups_num_guests[groupIndex] = 1;
-        peep->flags &= ~(SPRITE_FLAGS_PEEP_VISIBLE);
-
-        _window_guest_list_groups_arguments[groupIndex] = get_arguments_from_peep(peep);
-        _window_guest_list_filter_arguments = _window_guest_list_groups_arguments[groupIndex];
-
-        _window_guest_list_group_index[groupIndex] = groupIndex;
-        auto faceIndex = groupIndex * 56;
-        _window_guest_list_groups_guest_faces[faceIndex++] = get_peep_face_sprite_small(peep)
-            - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
-
-        // Find more peeps that belong to same group
-        for (auto peep2 : EntityList<Guest>(EntityListId::Peep))
+        auto arguments = get_arguments_from_peep(peep);
+        auto result = groupIndices.emplace(arguments, groups.size());
+        if (result.second)
         {
-            if (peep2->OutsideOfPark || !(peep2->flags & SPRITE_FLAGS_PEEP_VISIBLE))
-                continue;
-
-            // Get and check if in same group
-            auto argument12 = get_arguments_from_peep(peep2);
-            if (argument12 != _window_guest_list_groups_arguments[groupIndex])
-                continue;
-
-            // Assign guest
-            _window_guest_list_groups_num_guests[groupIndex]++;
-            peep2->flags &= ~(SPRITE_FLAGS_PEEP_VISIBLE);
-
-            // Add face sprite, cap at 56 though
-            if (_window_guest_list_groups_num_guests[groupIndex] >= 56)
-                continue;
-            _window_guest_list_groups_guest_faces[faceIndex++] = get_peep_face_sprite_small(peep2)
-                - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
+            groups.push_back({ arguments, 0, {} });
         }
 
-        if (_window_guest_list_filter_arguments.GetFirstStringId() == 0)
+        auto& group = groups[result.first->second];
+        if (group.NumGuests < std::size(group.Faces))
         {
-            _window_guest_list_num_groups--;
-            continue;
+            group.Faces[group.NumGuests] = get_peep_face_sprite_small(peep) - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
         }
+        group.NumGuests++;
+    }
 
-        auto curr_num_guests = _window_guest_list_groups_num_guests[groupIndex];
-        int32_t swap_position = 0;
-        // This section places the groups in size order.
-        bool gotoNextPeep = false;
-        while (1)
-        {
-            if (swap_position >= groupIndex)
-            {
-                gotoNextPeep = true;
-                break;
-            }
-            if (curr_num_guests > _window_guest_list_groups_num_guests[swap_position])
-                break;
-            swap_position++;
-        }
-        if (gotoNextPeep)
-        {
-            continue;
-        }
+    groups.erase(
+        std::remove_if(
+            groups.begin(), groups.end(), [](GuestGroup& group) { return group.Arguments.GetFirstStringId() == 0; }),
+        groups.end());
 
-        auto arguments12 = _window_guest_list_groups_arguments[groupIndex];
-        auto bl = _window_guest_list_group_index[groupIndex];
+    // Biggest groups first, groups of the same size stay in the order they were found
+    std::stable_sort(
+        groups.begin(), groups.end(), [](const GuestGroup& a, const GuestGroup& b) { return a.NumGuests > b.NumGuests; });
 
-        do
-        {
-            std::swap(curr_num_guests, _window_guest_list_groups_num_guests[swap_position]);
-            std::swap(arguments12, _window_guest_list_groups_arguments[swap_position]);
-
-            uint8_t temp_faces[56];
-            std::memcpy(temp_faces, &(_window_guest_list_groups_guest_faces[groupIndex * 56]), 56);
-            std::memcpy(
-                &(_window_guest_list_groups_guest_faces[groupIndex * 56]),
-                &(_window_guest_list_groups_guest_faces[swap_position * 56]), 56);
-            std::memcpy(&(_window_guest_list_groups_guest_faces[swap_position * 56]), temp_faces, 56);
-
-            std::swap(bl, _window_guest_list_group_index[swap_position]);
-        } while (++swap_position <= groupIndex);
+    _window_guest_list_num_groups = static_cast<uint32_t>(std::min<size_t>(groups.size(), 240));
+    for (uint32_t i = 0; i < _window_guest_list_num_groups; i++)
+    {
+        const auto& group = groups[i];
+        _window_guest_list_groups_num_guests[i] = static_cast<uint16_t>(std::min<uint32_t>(group.NumGuests, UINT16_MAX));
+        _window_guest_list_groups_arguments[i] = group.Arguments;
+        std::memcpy(&_window_guest_list_groups_guest_faces[i * 56], group.Faces, 56);
     }
 }
 
-static bool guest_should_be_visible(Peep* peep)
+static std::string get_peep_name(const Peep* peep)
+{
+    char name[256]{};
+
+    Formatter ft;
+    peep->FormatNameTo(ft);
+    format_string(name, sizeof(name), STR_STRINGID, ft.Data());
+    return name;
+}
+
+static bool guest_should_be_visible(Peep* peep, const std::string& name)
 {
     if (_window_guest_list_tracking_only && !(peep->PeepFlags & PEEP_FLAGS_TRACKING))
         return false;
 
     if (_window_guest_list_filter_name[0] != '\0')
     {
-        char name[256]{};
-
-        Formatter ft;
-        peep->FormatNameTo(ft);
-        format_string(name, sizeof(name), STR_STRINGID, ft.Data());
-        if (strcasestr(name, _window_guest_list_filter_name) == nullptr)
+        if (strcasestr(name.c_str(), _window_guest_list_filter_name) == nullptr)
         {
             return false;
         }
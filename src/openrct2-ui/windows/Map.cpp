@@ -168,12 +168,31 @@ static uint32_t _currentLine;
 /** rct2: 0x00F1AD68 */
 static std::vector<uint8_t> _mapImageData;
 
+// Number of lines still to be swept at full speed. Once the whole image has been drawn only the tiles reported by the
+// map change journal are repainted, along with a slow sweep to pick up any change that did not invalidate its tile.
+static uint32_t _linesToRefresh;
+static std::vector<TileCoordsXY> _changedTiles;
+
+// Minimap pixels covered by peeps or vehicles, rebuilt once per update so that painting the overlay costs one rectangle
+// per occupied tile rather than one per entity.
+enum
+{
+    MAP_OVERLAY_GUEST = 1 << 0,
+    MAP_OVERLAY_STAFF = 1 << 1,
+    MAP_OVERLAY_FLASHING_GUEST = 1 << 2,
+    MAP_OVERLAY_FLASHING_STAFF = 1 << 3,
+    MAP_OVERLAY_VEHICLE = 1 << 4,
+};
+static std::vector<uint8_t> _overlayGrid;
+static std::vector<TileCoordsXY> _overlayTiles;
+
 static uint16_t _landRightsToolSize;
 
 static void window_map_init_map();
 static void window_map_centre_on_view_point();
 static void window_map_show_default_scenario_editor_buttons(rct_window* w);
 static void window_map_draw_tab_images(rct_window* w, rct_drawpixelinfo* dpi);
+static void window_map_update_overlay(rct_window* w);
 static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi);
 static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi);
 static void window_map_paint_hud_rectangle(rct_drawpixelinfo* dpi);
@@ -188,6 +207,7 @@ static void window_map_set_peep_spawn_tool_down(const ScreenCoordsXY& screenCoor
 static void map_window_increase_map_size();
 static void map_window_decrease_map_size();
 static void map_window_set_pixels(rct_window* w);
+static void map_window_set_tile_pixel(rct_window* w, const TileCoordsXY& tile);
 
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords);
 
@@ -211,6 +231,7 @@ rct_window* window_map_open()
     try
     {
         _mapImageData.resize(MAP_WINDOW_MAP_SIZE * MAP_WINDOW_MAP_SIZE);
+        _overlayGrid.resize(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL);
     }
     catch (const std::bad_alloc&)
     {
@@ -233,6 +254,7 @@ rct_window* window_map_open()
 
     w->map.rotation = get_current_rotation();
 
+    map_change_journal_set_enabled(true);
     window_map_init_map();
     gWindowSceneryRotation = 0;
     window_map_centre_on_view_point();
@@ -266,6 +288,11 @@ static void window_map_close(rct_window* w)
 {
     _mapImageData.clear();
     _mapImageData.shrink_to_fit();
+    _overlayGrid.clear();
+    _overlayGrid.shrink_to_fit();
+    _overlayTiles.clear();
+    _changedTiles.clear();
+    map_change_journal_set_enabled(false);
     if ((input_test_flag(INPUT_FLAG_TOOL_ACTIVE)) && gCurrentToolWidget.window_classification == w->classification
         && gCurrentToolWidget.window_number == w->number)
     {
@@ -368,6 +395,7 @@ static void window_map_mouseup(rct_window* w, rct_widgetindex widgetIndex)
 
                 w->selected_tab = widgetIndex;
                 w->list_information_type = 0;
+                _linesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
             }
     }
 }
@@ -427,8 +455,20 @@ static void window_map_update(rct_window* w)
         window_map_centre_on_view_point();
     }
 
-    for (int32_t i = 0; i < 16; i++)
+    if (!map_change_journal_take(_changedTiles))
+        _linesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
+    for (const auto& tile : _changedTiles)
+        map_window_set_tile_pixel(w, tile);
+
+    int32_t numLines = _linesToRefresh > 0 ? 16 : 1;
+    for (int32_t i = 0; i < numLines; i++)
+    {
         map_window_set_pixels(w);
+        if (_linesToRefresh > 0)
+            _linesToRefresh--;
+    }
+
+    window_map_update_overlay(w);
 
     w->Invalidate();
 
@@ -888,6 +928,9 @@ static void window_map_init_map()
 {
     std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
     _currentLine = 0;
+    _linesToRefresh = MAXIMUM_MAP_SIZE_TECHNICAL;
+    map_change_journal_take(_changedTiles);
+    _changedTiles.clear();
 }
 
 /**
@@ -1030,45 +1073,84 @@ static MapCoordsXY window_map_transform_to_map_coords(CoordsXY c)
     return { -x + y + MAXIMUM_MAP_SIZE_TECHNICAL - 8, x + y - 8 };
 }
 
+static void window_map_add_to_overlay(const CoordsXY& loc, uint8_t flags)
+{
+    auto tile = TileCoordsXY{ loc };
+    if (tile.x < 0 || tile.y < 0 || tile.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tile.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    auto& cell = _overlayGrid[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL];
+    if (cell == 0)
+        _overlayTiles.push_back(tile);
+    cell |= flags;
+}
+
+static void window_map_update_overlay(rct_window* w)
+{
+    for (const auto& tile : _overlayTiles)
+        _overlayGrid[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL] = 0;
+    _overlayTiles.clear();
+
+    if (w->selected_tab == PAGE_PEEPS)
+    {
+        for (auto peep : EntityList<Peep>(EntityListId::Peep))
+        {
+            if (peep->x == LOCATION_NULL)
+                continue;
+
+            bool isStaff = peep->AssignedPeepType == PeepType::Staff;
+            uint8_t flags;
+            if (sprite_get_flashing(peep))
+                flags = isStaff ? MAP_OVERLAY_FLASHING_STAFF : MAP_OVERLAY_FLASHING_GUEST;
+            else
+                flags = isStaff ? MAP_OVERLAY_STAFF : MAP_OVERLAY_GUEST;
+            window_map_add_to_overlay({ peep->x, peep->y }, flags);
+        }
+    }
+    else
+    {
+        for (auto train : EntityList<Vehicle>(EntityListId::TrainHead))
+        {
+            for (Vehicle* vehicle = train; vehicle != nullptr; vehicle = GetEntity<Vehicle>(vehicle->next_vehicle_on_train))
+            {
+                if (vehicle->x == LOCATION_NULL)
+                    continue;
+
+                window_map_add_to_overlay({ vehicle->x, vehicle->y }, MAP_OVERLAY_VEHICLE);
+            }
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x0068DADA
  */
 static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
 {
-    for (auto peep : EntityList<Peep>(EntityListId::Peep))
+    for (const auto& tile : _overlayTiles)
     {
-        if (peep->x == LOCATION_NULL)
-            continue;
-
-        MapCoordsXY c = window_map_transform_to_map_coords({ peep->x, peep->y });
+        auto flags = _overlayGrid[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL];
+        MapCoordsXY c = window_map_transform_to_map_coords(tile.ToCoordsXY());
         auto leftTop = ScreenCoordsXY{ c.x, c.y };
         auto rightBottom = leftTop;
 
         int16_t colour = PALETTE_INDEX_20;
 
-        if (sprite_get_flashing(peep))
+        // Flashing peeps take priority over any other peep on the same tile
+        if ((flags & MAP_OVERLAY_FLASHING_STAFF) && (gWindowMapFlashingFlags & (1 << 3)) != 0)
         {
-            if (peep->AssignedPeepType == PeepType::Staff)
-            {
-                if ((gWindowMapFlashingFlags & (1 << 3)) != 0)
-                {
-                    colour = PALETTE_INDEX_138;
-                    leftTop.x--;
-                    if ((gWindowMapFlashingFlags & (1 << 15)) == 0)
-                        colour = PALETTE_INDEX_10;
-                }
-            }
-            else
-            {
-                if ((gWindowMapFlashingFlags & (1 << 1)) != 0)
-                {
-                    colour = PALETTE_INDEX_172;
-                    leftTop.x--;
-                    if ((gWindowMapFlashingFlags & (1 << 15)) == 0)
-                        colour = PALETTE_INDEX_21;
-                }
-            }
+            colour = PALETTE_INDEX_138;
+            leftTop.x--;
+            if ((gWindowMapFlashingFlags & (1 << 15)) == 0)
+                colour = PALETTE_INDEX_10;
+        }
+        else if ((flags & MAP_OVERLAY_FLASHING_GUEST) && (gWindowMapFlashingFlags & (1 << 1)) != 0)
+        {
+            colour = PALETTE_INDEX_172;
+            leftTop.x--;
+            if ((gWindowMapFlashingFlags & (1 << 15)) == 0)
+                colour = PALETTE_INDEX_21;
         }
         gfx_fill_rect(dpi, { leftTop, rightBottom }, colour);
     }
@@ -1080,17 +1162,13 @@ static void window_map_paint_peep_overlay(rct_drawpixelinfo* dpi)
  */
 static void window_map_paint_train_overlay(rct_drawpixelinfo* dpi)
 {
-    for (auto train : EntityList<Vehicle>(EntityListId::TrainHead))
+    for (const auto& tile : _overlayTiles)
     {
-        for (Vehicle* vehicle = train; vehicle != nullptr; vehicle = GetEntity<Vehicle>(vehicle->next_vehicle_on_train))
-        {
-            if (vehicle->x == LOCATION_NULL)
-                continue;
-
-            MapCoordsXY c = window_map_transform_to_map_coords({ vehicle->x, vehicle->y });
+        if (!(_overlayGrid[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL] & MAP_OVERLAY_VEHICLE))
+            continue;
 
-            gfx_fill_rect(dpi, { { c.x, c.y }, { c.x, c.y } }, PALETTE_INDEX_171);
-        }
+        MapCoordsXY c = window_map_transform_to_map_coords(tile.ToCoordsXY());
+        gfx_fill_rect(dpi, { { c.x, c.y }, { c.x, c.y } }, PALETTE_INDEX_171);
     }
 }
 
@@ -1501,6 +1579,18 @@ static uint16_t map_window_get_pixel_colour_ride(const CoordsXY& c)
     return colourB;
 }
 
+static uint16_t map_window_get_pixel_colour(rct_window* w, const CoordsXY& c)
+{
+    switch (w->selected_tab)
+    {
+        case PAGE_PEEPS:
+            return map_window_get_pixel_colour_peep(c);
+        case PAGE_RIDES:
+            return map_window_get_pixel_colour_ride(c);
+    }
+    return 0;
+}
+
 static void map_window_set_pixels(rct_window* w)
 {
     uint16_t colour = 0;
@@ -1541,15 +1631,7 @@ static void map_window_set_pixels(rct_window* w)
     {
         if (x > 0 && y > 0 && x < gMapSizeUnits && y < gMapSizeUnits)
         {
-            switch (w->selected_tab)
-            {
-                case PAGE_PEEPS:
-                    colour = map_window_get_pixel_colour_peep({ x, y });
-                    break;
-                case PAGE_RIDES:
-                    colour = map_window_get_pixel_colour_ride({ x, y });
-                    break;
-            }
+            colour = map_window_get_pixel_colour(w, { x, y });
             destination[0] = (colour >> 8) & 0xFF;
             destination[1] = colour;
         }
@@ -1565,6 +1647,43 @@ static void map_window_set_pixels(rct_window* w)
         _currentLine = 0;
 }
 
+/**
+ * Repaints the pixel of a single tile, the inverse of the mapping map_window_set_pixels uses for each line.
+ */
+static void map_window_set_tile_pixel(rct_window* w, const TileCoordsXY& tile)
+{
+    auto loc = tile.ToCoordsXY();
+    if (loc.x <= 0 || loc.y <= 0 || loc.x >= gMapSizeUnits || loc.y >= gMapSizeUnits)
+        return;
+
+    int32_t line = 0, i = 0;
+    switch (get_current_rotation())
+    {
+        case 0:
+            line = tile.x;
+            i = tile.y;
+            break;
+        case 1:
+            line = tile.y;
+            i = MAXIMUM_MAP_SIZE_TECHNICAL - 1 - tile.x;
+            break;
+        case 2:
+            line = MAXIMUM_MAP_SIZE_TECHNICAL - 1 - tile.x;
+            i = MAXIMUM_MAP_SIZE_TECHNICAL - 1 - tile.y;
+            break;
+        case 3:
+            line = MAXIMUM_MAP_SIZE_TECHNICAL - 1 - tile.y;
+            i = tile.x;
+            break;
+    }
+
+    auto destinationPosition = ScreenCoordsXY{ MAXIMUM_MAP_SIZE_TECHNICAL - 1 - line + i, line + i };
+    auto destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
+    uint16_t colour = map_window_get_pixel_colour(w, loc);
+    destination[0] = (colour >> 8) & 0xFF;
+    destination[1] = colour;
+}
+
 static CoordsXY map_window_screen_to_map(ScreenCoordsXY screenCoords)
 {
     screenCoords.x = ((screenCoords.x + 8) - MAXIMUM_MAP_SIZE_TECHNICAL) / 2;
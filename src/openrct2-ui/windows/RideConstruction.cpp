@@ -453,9 +453,10 @@ static void window_ride_construction_exit_click(rct_window* w);
 static void window_ride_construction_draw_track_piece(
     rct_window* w, rct_drawpixelinfo* dpi, ride_id_t rideIndex, int32_t trackType, int32_t trackDirection, int32_t unknown,
     int32_t width, int32_t height);
-static void sub_6CBCE2(
+static paint_session* sub_6CBCE2(
     rct_drawpixelinfo* dpi, ride_id_t rideIndex, int32_t trackType, int32_t trackDirection, int32_t edx,
     const CoordsXY& originCoords, int32_t originZ);
+static void window_ride_construction_release_track_preview();
 static void window_ride_construction_update_map_selection();
 static void window_ride_construction_update_possible_ride_configurations();
 static void window_ride_construction_update_widgets(rct_window* w);
@@ -577,6 +578,7 @@ rct_window* window_ride_construction_open()
  */
 static void window_ride_construction_close(rct_window* w)
 {
+    window_ride_construction_release_track_preview();
     ride_construction_invalidate_current_track();
     viewport_set_visibility(0);
 
@@ -2336,6 +2338,38 @@ static void window_ride_construction_paint(rct_window* w, rct_drawpixelinfo* dpi
     }
 }
 
+// Everything the preview of the selected piece is painted from, the ride's colours and vehicles are only changed
+// by actions
+struct TrackPiecePreviewKey
+{
+    ride_id_t RideIndex;
+    int32_t TrackType;
+    int32_t TrackDirection;
+    int32_t LiftHillAndInvertedState;
+    uint8_t Rotation;
+    int32_t X;
+    int32_t Y;
+    int32_t Width;
+    int32_t Height;
+    ZoomLevel Zoom;
+    uint32_t ExecutedActionCount;
+
+    bool operator==(const TrackPiecePreviewKey& other) const
+    {
+        return RideIndex == other.RideIndex && TrackType == other.TrackType && TrackDirection == other.TrackDirection
+            && LiftHillAndInvertedState == other.LiftHillAndInvertedState && Rotation == other.Rotation && X == other.X
+            && Y == other.Y && Width == other.Width && Height == other.Height && Zoom == other.Zoom
+            && ExecutedActionCount == other.ExecutedActionCount;
+    }
+};
+
+// The window is repainted on every mouse move while placing ghosts, the arranged preview is drawn again instead
+static struct
+{
+    TrackPiecePreviewKey Key;
+    paint_session* Session;
+} _trackPiecePreview;
+
 static void window_ride_construction_draw_track_piece(
     rct_window* w, rct_drawpixelinfo* dpi, ride_id_t rideIndex, int32_t trackType, int32_t trackDirection,
     int32_t liftHillAndInvertedState, int32_t width, int32_t height)
@@ -2371,7 +2405,41 @@ static void window_ride_construction_draw_track_piece(
     dpi->x += rotatedScreenCoords.x - width / 2;
     dpi->y += rotatedScreenCoords.y - height / 2 - 16;
 
-    sub_6CBCE2(dpi, rideIndex, trackType, trackDirection, liftHillAndInvertedState, { 4096, 4096 }, 1024);
+    TrackPiecePreviewKey key;
+    key.RideIndex = rideIndex;
+    key.TrackType = trackType;
+    key.TrackDirection = trackDirection;
+    key.LiftHillAndInvertedState = liftHillAndInvertedState;
+    key.Rotation = get_current_rotation();
+    key.X = dpi->x;
+    key.Y = dpi->y;
+    key.Width = dpi->width;
+    key.Height = dpi->height;
+    key.Zoom = dpi->zoom_level;
+    key.ExecutedActionCount = GameActions::GetExecutedCount();
+    if (_trackPiecePreview.Session == nullptr || !(_trackPiecePreview.Key == key))
+    {
+        window_ride_construction_release_track_preview();
+        _trackPiecePreview.Key = key;
+        _trackPiecePreview.Session = sub_6CBCE2(
+            dpi, rideIndex, trackType, trackDirection, liftHillAndInvertedState, { 4096, 4096 }, 1024);
+        if (_trackPiecePreview.Session == nullptr)
+            return;
+    }
+
+    // Paint structs are in view coordinates, so the session only needs to be pointed at this drawing area
+    paint_session session = *_trackPiecePreview.Session;
+    session.DPI = *dpi;
+    PaintDrawStructs(&session);
+}
+
+static void window_ride_construction_release_track_preview()
+{
+    if (_trackPiecePreview.Session != nullptr)
+    {
+        PaintSessionFree(_trackPiecePreview.Session);
+        _trackPiecePreview.Session = nullptr;
+    }
 }
 
 static TileElement _tempTrackTileElement;
@@ -2384,17 +2452,18 @@ static TileElement* _backupTileElementArrays[5];
  * bh: trackDirection
  * dl: rideIndex
  * dh: trackType
+ * Returns the arranged session, which the caller draws and frees.
  */
-static void sub_6CBCE2(
+static paint_session* sub_6CBCE2(
     rct_drawpixelinfo* dpi, ride_id_t rideIndex, int32_t trackType, int32_t trackDirection, int32_t liftHillAndInvertedState,
     const CoordsXY& originCoords, int32_t originZ)
 {
-    paint_session* session = PaintSessionAlloc(dpi, 0);
-    trackDirection &= 3;
-
     auto ride = get_ride(rideIndex);
     if (ride == nullptr)
-        return;
+        return nullptr;
+
+    paint_session* session = PaintSessionAlloc(dpi, 0);
+    trackDirection &= 3;
 
     int16_t preserveMapSizeUnits = gMapSizeUnits;
     int16_t preserveMapSizeMinus2 = gMapSizeMinus2;
@@ -2470,8 +2539,7 @@ static void sub_6CBCE2(
     gMapSizeMaxXY = preserveMapSizeMaxXY;
 
     PaintSessionArrange(session);
-    PaintDrawStructs(session);
-    PaintSessionFree(session);
+    return session;
 }
 
 /**
@@ -9,6 +9,7 @@
 
 #include "../interface/Theme.h"
 
+#include <bitset>
 #include <iterator>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -24,6 +25,9 @@
 #include <openrct2/util/Util.h>
 #include <openrct2/windows/Intent.h>
 #include <openrct2/world/Park.h>
+#include <optional>
+#include <string>
+#include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_NONE;
 static constexpr const int32_t WH = 240;
@@ -286,9 +290,8 @@ static void window_ride_list_resize(rct_window* w)
         w->height = w->min_height;
     }
 
-    // Refreshing the list can be a very intensive operation
-    // owing to its use of ride_has_any_track_elements().
-    // This makes sure it's only refreshed every 64 ticks.
+    // Refreshing the list scans the map for closed rides' track,
+    // this makes sure it's only refreshed every 64 ticks.
     if (!(gCurrentRealTimeTicks & 0x3f))
     {
         window_ride_list_refresh_list(w);
@@ -574,9 +577,12 @@ static void window_ride_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi,
     gfx_fill_rect(
         dpi, { dpiCoords, dpiCoords + ScreenCoordsXY{ dpi->width, dpi->height } }, ColourMapA[w->colours[1]].mid_light);
 
-    auto y = 0;
-    for (auto i = 0; i < w->no_list_items; i++)
+    // Skip straight to the first row that intersects the clip rectangle
+    auto firstRow = std::max(0, dpi->y / SCROLLABLE_ROW_HEIGHT);
+    auto lastRow = std::min<int32_t>(w->no_list_items, (dpi->y + dpi->height) / SCROLLABLE_ROW_HEIGHT + 1);
+    for (auto i = firstRow; i < lastRow; i++)
     {
+        auto y = i * SCROLLABLE_ROW_HEIGHT;
         rct_string_id format = (_quickDemolishMode ? STR_RED_STRINGID : STR_BLACK_STRING);
         if (i == w->selected_list_item)
         {
@@ -746,7 +752,6 @@ static void window_ride_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi,
             ft.Add<rct_string_id>(formatSecondary);
         }
         DrawTextEllipsised(dpi, { 160, y - 1 }, 157, format, ft, COLOUR_BLACK);
-        y += SCROLLABLE_ROW_HEIGHT;
     }
 }
 
@@ -780,231 +785,128 @@ static void window_ride_list_draw_tab_images(rct_drawpixelinfo* dpi, rct_window*
         dpi, sprite_idx, w->windowPos + ScreenCoordsXY{ w->widgets[WIDX_TAB_3].left, w->widgets[WIDX_TAB_3].top }, 0);
 }
 
+/**
+ * Finds which rides have any track in a single pass over the map, rather than a pass per ride with
+ * ride_has_any_track_elements.
+ */
+static std::bitset<MAX_RIDES> window_ride_list_get_rides_with_track()
+{
+    std::bitset<MAX_RIDES> result;
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    while (tile_element_iterator_next(&it))
+    {
+        if (it.element->GetType() != TILE_ELEMENT_TYPE_TRACK || it.element->IsGhost())
+            continue;
+
+        auto rideIndex = static_cast<size_t>(it.element->AsTrack()->GetRideIndex());
+        if (rideIndex < result.size())
+            result[rideIndex] = true;
+    }
+    return result;
+}
+
+/**
+ * The value rides are sorted by for each numeric information type, higher values first.
+ */
+static int64_t window_ride_list_get_sort_value(Ride* ride, int32_t informationType)
+{
+    switch (informationType)
+    {
+        case INFORMATION_TYPE_POPULARITY:
+            return ride->popularity;
+        case INFORMATION_TYPE_SATISFACTION:
+            return ride->satisfaction;
+        case INFORMATION_TYPE_PROFIT:
+            return ride->profit;
+        case INFORMATION_TYPE_TOTAL_CUSTOMERS:
+            return ride->total_customers;
+        case INFORMATION_TYPE_TOTAL_PROFIT:
+            return ride->total_profit;
+        case INFORMATION_TYPE_CUSTOMERS:
+            return ride_customers_per_hour(ride);
+        case INFORMATION_TYPE_AGE:
+            return ride->build_date;
+        case INFORMATION_TYPE_INCOME:
+            return ride->income_per_hour;
+        case INFORMATION_TYPE_RUNNING_COST:
+            return ride->upkeep_cost;
+        case INFORMATION_TYPE_QUEUE_LENGTH:
+            return ride->GetTotalQueueLength();
+        case INFORMATION_TYPE_QUEUE_TIME:
+            return ride->GetMaxQueueTime();
+        case INFORMATION_TYPE_RELIABILITY:
+            return ride->reliability_percentage;
+        case INFORMATION_TYPE_DOWN_TIME:
+            return ride->downtime;
+        case INFORMATION_TYPE_GUESTS_FAVOURITE:
+            return ride->guests_favourite;
+        default:
+            return 0;
+    }
+}
+
 /**
  *
  *  rct2: 0x006B39A8
  */
 void window_ride_list_refresh_list(rct_window* w)
 {
-    int32_t list_index = 0;
-    for (auto& ridec : GetRideManager())
+    struct RideListEntry
     {
-        auto ride = &ridec;
-        if (ride->GetClassification() != static_cast<RideClassification>(w->page)
-            || (ride->status == RIDE_STATUS_CLOSED && !ride_has_any_track_elements(ride)))
-            continue;
+        ride_id_t Id;
+        int64_t Value;
+        std::string Name;
+    };
 
-        if (ride->window_invalidate_flags & RIDE_INVALIDATE_RIDE_LIST)
+    auto classification = static_cast<RideClassification>(w->page);
+    bool sortByName = w->list_information_type == INFORMATION_TYPE_STATUS;
+
+    std::optional<std::bitset<MAX_RIDES>> ridesWithTrack;
+    std::vector<RideListEntry> entries;
+    for (auto& ride : GetRideManager())
+    {
+        if (ride.GetClassification() != classification)
+            continue;
+        if (ride.status == RIDE_STATUS_CLOSED)
         {
-            ride->window_invalidate_flags &= ~RIDE_INVALIDATE_RIDE_LIST;
+            if (!ridesWithTrack)
+                ridesWithTrack = window_ride_list_get_rides_with_track();
+            if (!(*ridesWithTrack)[static_cast<size_t>(ride.id)])
+                continue;
         }
 
-        w->list_item_positions[list_index] = ride->id;
-        int32_t current_list_position = list_index;
-        switch (w->list_information_type)
+        if (ride.window_invalidate_flags & RIDE_INVALIDATE_RIDE_LIST)
         {
-            case INFORMATION_TYPE_STATUS:
-            {
-                auto strA = ride->GetName();
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        auto strB = otherRide->GetName();
-                        if (strlogicalcmp(strA.c_str(), strB.c_str()) >= 0)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            }
-            case INFORMATION_TYPE_POPULARITY:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->popularity * 4 <= otherRide->popularity * 4)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_SATISFACTION:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->satisfaction * 5 <= otherRide->satisfaction * 5)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_PROFIT:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->profit <= otherRide->profit)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_TOTAL_CUSTOMERS:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->total_customers <= otherRide->total_customers)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_TOTAL_PROFIT:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->total_profit <= otherRide->total_profit)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_CUSTOMERS:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride_customers_per_hour(ride) <= ride_customers_per_hour(otherRide))
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_AGE:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->build_date <= otherRide->build_date)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_INCOME:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->income_per_hour <= otherRide->income_per_hour)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_RUNNING_COST:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->upkeep_cost <= otherRide->upkeep_cost)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_QUEUE_LENGTH:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->GetTotalQueueLength() <= otherRide->GetTotalQueueLength())
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_QUEUE_TIME:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->GetMaxQueueTime() <= otherRide->GetMaxQueueTime())
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_RELIABILITY:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->reliability_percentage <= otherRide->reliability_percentage)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_DOWN_TIME:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->downtime <= otherRide->downtime)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
-            case INFORMATION_TYPE_GUESTS_FAVOURITE:
-                while (--current_list_position >= 0)
-                {
-                    auto otherRide = get_ride(w->list_item_positions[current_list_position]);
-                    if (otherRide != nullptr)
-                    {
-                        if (ride->guests_favourite <= otherRide->guests_favourite)
-                            break;
-
-                        window_bubble_list_item(w, current_list_position);
-                    }
-                }
-                break;
+            ride.window_invalidate_flags &= ~RIDE_INVALIDATE_RIDE_LIST;
         }
 
-        list_index++;
+        // Each name or value is worked out once here rather than on every comparison
+        RideListEntry entry{ ride.id, 0, {} };
+        if (sortByName)
+            entry.Name = ride.GetName();
+        else
+            entry.Value = window_ride_list_get_sort_value(&ride, w->list_information_type);
+        entries.push_back(std::move(entry));
+    }
+
+    // Stable so that rides which compare equal stay in ride index order
+    if (sortByName)
+    {
+        std::stable_sort(entries.begin(), entries.end(), [](const RideListEntry& a, const RideListEntry& b) {
+            return strlogicalcmp(a.Name.c_str(), b.Name.c_str()) < 0;
+        });
+    }
+    else
+    {
+        std::stable_sort(
+            entries.begin(), entries.end(), [](const RideListEntry& a, const RideListEntry& b) { return a.Value > b.Value; });
+    }
+
+    int32_t list_index = 0;
+    for (const auto& entry : entries)
+    {
+        w->list_item_positions[list_index++] = entry.Id;
     }
 
     w->no_list_items = list_index;
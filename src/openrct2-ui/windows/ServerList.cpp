@@ -157,6 +157,7 @@ rct_window* window_server_list_open()
 
 static void window_server_list_close(rct_window* w)
 {
+    _serverList.CancelLatencyProbes();
     _serverList = {};
     _fetchFuture = {};
 }
@@ -230,6 +231,7 @@ static void window_server_list_dropdown(rct_window* w, rct_widgetindex widgetInd
             case DDIDX_FAVOURITE:
             {
                 server.Favourite = !server.Favourite;
+                _serverList.Reposition(serverIndex);
                 _serverList.WriteFavourites();
             }
             break;
@@ -245,6 +247,12 @@ static void window_server_list_update(rct_window* w)
         widget_invalidate(w, WIDX_PLAYER_NAME_INPUT);
     }
     server_list_fetch_servers_check(w);
+
+    // Reordering is held back while a dropdown is open as its items act on the selected index
+    if (window_find_by_class(WC_DROPDOWN) == nullptr && _serverList.MergeLatencyResults())
+    {
+        w->Invalidate();
+    }
 }
 
 static void window_server_list_scroll_getsize(rct_window* w, int32_t scrollIndex, int32_t* width, int32_t* height)
@@ -462,8 +470,15 @@ static void window_server_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi
         }
         const int16_t numPlayersStringWidth = gfx_get_string_width(players);
 
+        char latency[32] = { 0 };
+        if (serverDetails.Latency.has_value())
+        {
+            snprintf(latency, sizeof(latency), "%u ms", *serverDetails.Latency);
+        }
+        const int16_t latencyColumnWidth = serverDetails.Latency.has_value() ? gfx_get_string_width(latency) + 8 : 0;
+
         // How much space we have for the server info depends on the size of everything rendered after.
-        const int16_t spaceAvailableForInfo = width - numPlayersStringWidth - SCROLLBAR_WIDTH - 35;
+        const int16_t spaceAvailableForInfo = width - numPlayersStringWidth - latencyColumnWidth - SCROLLBAR_WIDTH - 35;
 
         // Are we showing the server's name or description?
         const char* serverInfoToShow = serverDetails.Name.c_str();
@@ -508,6 +523,13 @@ static void window_server_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi
         screenCoords.x = right - numPlayersStringWidth;
         gfx_draw_string(dpi, players, w->colours[1], screenCoords + ScreenCoordsXY{ 0, 3 });
 
+        // Draw latency
+        if (serverDetails.Latency.has_value())
+        {
+            screenCoords.x -= latencyColumnWidth;
+            gfx_draw_string(dpi, latency, w->colours[1], screenCoords + ScreenCoordsXY{ 0, 3 });
+        }
+
         screenCoords.y += ITEM_HEIGHT;
     }
 }
@@ -606,6 +628,7 @@ static void server_list_fetch_servers_check(rct_window* w)
             {
                 auto [entries, statusText] = _fetchFuture.get();
                 _serverList.AddRange(entries);
+                _serverList.BeginLatencyProbes();
                 _numPlayersOnline = _serverList.GetTotalPlayerCount();
                 _statusText = STR_X_PLAYERS_ONLINE;
                 if (statusText != STR_NONE)
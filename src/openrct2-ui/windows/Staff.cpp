@@ -555,12 +555,9 @@ void window_staff_overview_dropdown(rct_window* w, rct_widgetindex widgetIndex,
         {
             return;
         }
-        for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
-        {
-            gStaffPatrolAreas[peep->StaffId * STAFF_PATROL_AREA_SIZE + i] = 0;
-        }
+        staff_clear_patrol_area(peep->StaffId);
         assert(gStaffModes[peep->StaffId] == StaffMode::Patrol);
-        gStaffModes[peep->StaffId] = StaffMode::Walk;
+        staff_set_mode(peep->StaffId, StaffMode::Walk);
 
         gfx_invalidate_screen();
         staff_update_greyed_patrol_areas();
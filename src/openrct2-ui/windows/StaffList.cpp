@@ -286,6 +286,7 @@ static void window_staff_list_mousedown(rct_window* w, rct_widgetindex widgetInd
             w->Invalidate();
             w->scrolls[0].v_top = 0;
             window_staff_list_cancel_tools(w);
+            WindowStaffListRefresh();
             break;
         case WIDX_STAFF_LIST_UNIFORM_COLOUR_PICKER:
             WindowDropdownShowColour(
@@ -337,10 +338,6 @@ void window_staff_list_update(rct_window* w)
             }
         }
     }
-
-    // Note this may be slow if number of staff increases a large amount.
-    // See GuestList for fix (more intents) if required.
-    WindowStaffListRefresh();
 }
 
 /**
@@ -456,30 +453,25 @@ void window_staff_list_scrollgetsize(rct_window* w, int32_t scrollIndex, int32_t
  */
 void window_staff_list_scrollmousedown(rct_window* w, int32_t scrollIndex, const ScreenCoordsXY& screenCoords)
 {
-    int32_t i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
-    for (auto spriteIndex : StaffList)
+    size_t i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
+    if (i >= StaffList.size())
+        return;
+
+    auto spriteIndex = StaffList[i];
+    if (_quick_fire_mode)
     {
-        if (i == 0)
+        auto staffFireAction = StaffFireAction(spriteIndex);
+        GameActions::Execute(&staffFireAction);
+    }
+    else
+    {
+        auto peep = GetEntity<Staff>(spriteIndex);
+        if (peep != nullptr)
         {
-            if (_quick_fire_mode)
-            {
-                auto staffFireAction = StaffFireAction(spriteIndex);
-                GameActions::Execute(&staffFireAction);
-            }
-            else
-            {
-                auto peep = GetEntity<Staff>(spriteIndex);
-                if (peep != nullptr)
-                {
-                    auto intent = Intent(WC_PEEP);
-                    intent.putExtra(INTENT_EXTRA_PEEP, peep);
-                    context_open_intent(&intent);
-                }
-            }
-            break;
+            auto intent = Intent(WC_PEEP);
+            intent.putExtra(INTENT_EXTRA_PEEP, peep);
+            context_open_intent(&intent);
         }
-
-        i--;
     }
 }
 
@@ -678,10 +670,12 @@ void window_staff_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi, int32_
     const int32_t actionColumnSize = nonIconSpace * 0.58;
     const int32_t actionOffset = w->widgets[WIDX_STAFF_LIST_LIST].right - actionColumnSize - 15;
 
-    auto y = 0;
-    auto i = 0;
-    for (auto spriteIndex : StaffList)
+    // Skip straight to the first row that intersects the clip rectangle
+    auto i = std::max(0, (dpi->y - 11) / SCROLLABLE_ROW_HEIGHT);
+    auto y = i * SCROLLABLE_ROW_HEIGHT;
+    for (; i < static_cast<int32_t>(StaffList.size()); i++, y += SCROLLABLE_ROW_HEIGHT)
     {
+        auto spriteIndex = StaffList[i];
         if (y > dpi->y + dpi->height)
         {
             break;
@@ -739,9 +733,6 @@ void window_staff_list_scrollpaint(rct_window* w, rct_drawpixelinfo* dpi, int32_
                 gfx_draw_sprite(dpi, staffCostumeSprites[EnumValue(peep->SpriteType) - 4], { staffOrderIcon_x, y }, 0);
             }
         }
-
-        y += SCROLLABLE_ROW_HEIGHT;
-        i++;
     }
 }
 
@@ -39,6 +39,7 @@
 #include <openrct2/actions/PauseToggleAction.hpp>
 #include <openrct2/actions/SetCheatAction.hpp>
 #include <openrct2/actions/SmallSceneryPlaceAction.hpp>
+#include <openrct2/actions/SmallSceneryPlaceBatchAction.hpp>
 #include <openrct2/actions/SmallScenerySetColourAction.hpp>
 #include <openrct2/actions/SurfaceSetStyleAction.hpp>
 #include <openrct2/actions/WallPlaceAction.hpp>
@@ -1770,6 +1771,7 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
             }
 
             bool forceError = true;
+            auto smallSceneryPlaceBatchAction = SmallSceneryPlaceBatchAction(selectedScenery, primaryColour, secondaryColour);
             for (int32_t q = 0; q < quantity; q++)
             {
                 int32_t zCoordinate = gSceneryPlaceZ;
@@ -1831,8 +1833,14 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                     }
                 }
 
+                // Scattered items are collected and placed together in a single action
+                if (isCluster && success == GameActions::Status::Ok)
+                {
+                    smallSceneryPlaceBatchAction.AddItem({ cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant);
+                    forceError = false;
+                }
                 // Actually place
-                if (success == GameActions::Status::Ok || ((q + 1 == quantity) && forceError))
+                else if (success == GameActions::Status::Ok || ((q + 1 == quantity) && forceError))
                 {
                     auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
                         { cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery,
@@ -1857,6 +1865,17 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                 }
                 gSceneryPlaceZ = zCoordinate;
             }
+
+            if (smallSceneryPlaceBatchAction.GetItemCount() != 0)
+            {
+                smallSceneryPlaceBatchAction.SetCallback([=](const GameAction* ga, const GameActions::Result* result) {
+                    if (result->Error == GameActions::Status::Ok)
+                    {
+                        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, result->Position);
+                    }
+                });
+                GameActions::Execute(&smallSceneryPlaceBatchAction);
+            }
             break;
         }
         case SCENERY_TYPE_PATH_ITEM:
@@ -774,7 +774,7 @@ static bool track_list_load_design_for_preview(utf8* path)
     _loadedTrackDesign = track_design_open(path);
     if (_loadedTrackDesign != nullptr)
     {
-        track_design_draw_preview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
+        track_design_draw_preview(path, _loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
         return true;
     }
     return false;
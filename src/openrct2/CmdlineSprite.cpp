@@ -13,7 +13,9 @@
 
 #include "Context.h"
 #include "OpenRCT2.h"
+#include "core/File.h"
 #include "core/Imaging.h"
+#include "core/JobPool.h"
 #include "core/Json.hpp"
 #include "drawing/Drawing.h"
 #include "drawing/ImageImporter.h"
@@ -25,8 +27,12 @@
 #include "world/Entrance.h"
 #include "world/Scenery.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <cmath>
 #include <cstring>
+#include <unordered_map>
+#include <vector>
 
 #ifdef _WIN32
 #    include "core/String.hpp"
@@ -269,6 +275,117 @@ static std::optional<ImageImporter::ImportResult> sprite_file_import(
     }
 }
 
+struct SpriteBuildEntry
+{
+    std::string ImagePath;
+    int16_t XOffset = 0;
+    int16_t YOffset = 0;
+    bool KeepPalette = false;
+    bool ForceBmp = false;
+
+    uint64_t Hash = 0;
+    bool FromCache = false;
+    std::optional<ImageImporter::ImportResult> Result;
+    std::string Error;
+};
+
+using SpriteBuildCache = std::unordered_map<uint64_t, ImageImporter::ImportResult>;
+
+static std::string sprite_build_cache_path(const char* spriteFilePath)
+{
+    return std::string(spriteFilePath) + ".cache";
+}
+
+/**
+ * FNV-1a of the image file and everything else that changes how it is imported.
+ */
+static uint64_t sprite_build_hash(const std::vector<uint8_t>& fileData, const SpriteBuildEntry& entry)
+{
+    uint64_t hash = 0xCBF29CE484222325;
+    auto add = [&hash](const void* data, size_t length) {
+        auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < length; i++)
+        {
+            hash = (hash ^ bytes[i]) * 0x100000001B3;
+        }
+    };
+    add(fileData.data(), fileData.size());
+    add(&entry.XOffset, sizeof(entry.XOffset));
+    add(&entry.YOffset, sizeof(entry.YOffset));
+    add(&entry.KeepPalette, sizeof(entry.KeepPalette));
+    add(&entry.ForceBmp, sizeof(entry.ForceBmp));
+    add(&gSpriteMode, sizeof(gSpriteMode));
+    return hash;
+}
+
+/**
+ * Reads the images of the sprite file from the last build, keyed by the hash they were built from. The cache file
+ * lists the hash and data size of each image in the sprite file, in order.
+ */
+static SpriteBuildCache sprite_build_cache_load(const char* spriteFilePath)
+{
+    SpriteBuildCache cache;
+    auto cachePath = sprite_build_cache_path(spriteFilePath);
+    if (!File::Exists(cachePath) || !File::Exists(spriteFilePath))
+        return cache;
+
+    json_t jsonCache;
+    try
+    {
+        jsonCache = Json::ReadFromFile(cachePath.c_str());
+    }
+    catch (const std::exception&)
+    {
+        return cache;
+    }
+    json_t jsonEntries = jsonCache["entries"];
+    if (!jsonEntries.is_array() || !sprite_file_open(spriteFilePath))
+        return cache;
+
+    if (jsonEntries.size() == spriteFileHeader.num_entries)
+    {
+        for (uint32_t i = 0; i < spriteFileHeader.num_entries; i++)
+        {
+            json_t jsonEntry = jsonEntries[i];
+            auto hash = std::strtoull(Json::GetString(jsonEntry["hash"]).c_str(), nullptr, 16);
+            auto size = Json::GetNumber<uint32_t>(jsonEntry["size"]);
+
+            const auto& element = spriteFileEntries[i];
+            auto offset = static_cast<size_t>(element.offset - spriteFileData);
+            if (offset + size > spriteFileHeader.total_size)
+                break;
+
+            ImageImporter::ImportResult result;
+            result.Element = element;
+            result.Buffer.assign(element.offset, element.offset + size);
+            result.Element.offset = nullptr;
+            cache.emplace(hash, std::move(result));
+        }
+    }
+    sprite_file_close();
+    return cache;
+}
+
+static void sprite_build_cache_save(const char* spriteFilePath, const std::vector<SpriteBuildEntry>& entries)
+{
+    json_t jsonEntries = json_t::array();
+    for (const auto& entry : entries)
+    {
+        char hash[17];
+        snprintf(hash, sizeof(hash), "%016" PRIx64, entry.Hash);
+        jsonEntries.push_back({ { "hash", hash }, { "size", entry.Result->Buffer.size() } });
+    }
+
+    try
+    {
+        Json::WriteToFile(sprite_build_cache_path(spriteFilePath).c_str(), { { "entries", jsonEntries } });
+    }
+    catch (const std::exception& e)
+    {
+        fprintf(stderr, "Unable to write sprite build cache: %s\n", e.what());
+    }
+}
+
 int32_t cmdline_for_sprite(const char** argv, int32_t argc)
 {
     gOpenRCT2Headless = true;
@@ -690,13 +807,7 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
 
         bool silent = (argc >= 4 && strcmp(argv[3], "silent") == 0);
 
-        spriteFileHeader.num_entries = 0;
-        spriteFileHeader.total_size = 0;
-        sprite_file_save(spriteFilePath);
-
-        fprintf(stdout, "Building: %s\n", spriteFilePath);
-
-        json_t sprite_description;
+        std::vector<SpriteBuildEntry> entries;
 
         // Note: jsonSprite is deliberately left non-const: json_t behaviour changes when const
         for (auto& [jsonKey, jsonSprite] : jsonSprites.items())
@@ -715,57 +826,100 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
             }
             std::string strPath = Json::GetString(path);
 
-            json_t x_offset = jsonSprite["x_offset"];
-            json_t y_offset = jsonSprite["y_offset"];
-
-            bool keep_palette = Json::GetString(jsonSprite["palette"]) == "keep";
-            bool forceBmp = !jsonSprite["palette"].is_null() && Json::GetBoolean(jsonSprite["forceBmp"]);
+            SpriteBuildEntry entry;
+            entry.ImagePath = platform_get_absolute_path(strPath.c_str(), directoryPath);
+            entry.XOffset = Json::GetNumber<int16_t>(jsonSprite["x_offset"]);
+            entry.YOffset = Json::GetNumber<int16_t>(jsonSprite["y_offset"]);
+            entry.KeepPalette = Json::GetString(jsonSprite["palette"]) == "keep";
+            entry.ForceBmp = !jsonSprite["palette"].is_null() && Json::GetBoolean(jsonSprite["forceBmp"]);
+            entries.push_back(std::move(entry));
+        }
 
-            auto imagePath = platform_get_absolute_path(strPath.c_str(), directoryPath);
+        fprintf(stdout, "Building: %s\n", spriteFilePath);
 
-            auto importResult = sprite_file_import(
-                imagePath.c_str(), Json::GetNumber<int16_t>(x_offset), Json::GetNumber<int16_t>(y_offset), keep_palette,
-                forceBmp, gSpriteMode);
-            if (importResult == std::nullopt)
-            {
-                fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath.c_str());
-                return -1;
-            }
+        // Read the cache before the sprite file it refers to is replaced
+        auto cache = sprite_build_cache_load(spriteFilePath);
 
-            if (!sprite_file_open(spriteFilePath))
+        // Images are imported on the worker pool, one at a time per worker as their sizes vary a lot
+        JobPool::ParallelFor(entries.size(), 1, [&entries, &cache](size_t i) {
+            auto& entry = entries[i];
+            try
             {
-                fprintf(stderr, "Unable to open sprite file: %s\nCanceling\n", spriteFilePath);
-                return -1;
-            }
+                auto fileData = File::ReadAllBytes(entry.ImagePath);
+                entry.Hash = sprite_build_hash(fileData, entry);
 
-            spriteFileHeader.num_entries++;
-            spriteFileHeader.total_size += static_cast<uint32_t>(importResult->Buffer.size());
-            spriteFileEntries = static_cast<rct_g1_element*>(
-                realloc(spriteFileEntries, spriteFileHeader.num_entries * sizeof(rct_g1_element)));
-
-            sprite_entries_make_relative();
-            spriteFileData = static_cast<uint8_t*>(realloc(spriteFileData, spriteFileHeader.total_size));
-            sprite_entries_make_absolute();
+                auto cached = cache.find(entry.Hash);
+                if (cached != cache.end())
+                {
+                    entry.Result = cached->second;
+                    entry.FromCache = true;
+                    return;
+                }
 
-            spriteFileEntries[spriteFileHeader.num_entries - 1] = importResult->Element;
+                auto format = IMAGE_FORMAT::PNG_32;
+                auto flags = entry.ForceBmp ? ImageImporter::IMPORT_FLAGS::NONE : ImageImporter::IMPORT_FLAGS::RLE;
+                if (entry.KeepPalette)
+                {
+                    format = IMAGE_FORMAT::PNG;
+                    flags = static_cast<ImageImporter::IMPORT_FLAGS>(flags | ImageImporter::IMPORT_FLAGS::KEEP_PALETTE);
+                }
 
-            const auto& buffer = importResult->Buffer;
-            std::memcpy(spriteFileData + (spriteFileHeader.total_size - buffer.size()), buffer.data(), buffer.size());
-            spriteFileEntries[spriteFileHeader.num_entries - 1].offset = spriteFileData
-                + (spriteFileHeader.total_size - buffer.size());
+                ImageImporter importer;
+                auto image = Imaging::ReadFromBuffer(fileData, format);
+                entry.Result = importer.Import(
+                    image, entry.XOffset, entry.YOffset, flags, static_cast<ImageImporter::IMPORT_MODE>(gSpriteMode));
+            }
+            catch (const std::exception& e)
+            {
+                entry.Error = e.what();
+            }
+        });
 
-            if (!sprite_file_save(spriteFilePath))
+        // Assemble the sprite file in the order of the description, so the output does not depend on the scheduling
+        size_t reused = 0;
+        uint32_t totalSize = 0;
+        for (const auto& entry : entries)
+        {
+            if (entry.Result == std::nullopt)
             {
-                fprintf(stderr, "Could not save sprite file: %s\nCanceling\n", imagePath.c_str());
+                fprintf(
+                    stderr, "%s\nCould not import image file: %s\nCanceling\n", entry.Error.c_str(), entry.ImagePath.c_str());
                 return -1;
             }
-
+            totalSize += static_cast<uint32_t>(entry.Result->Buffer.size());
+            if (entry.FromCache)
+                reused++;
             if (!silent)
-                fprintf(stdout, "Added: %s\n", imagePath.c_str());
+                fprintf(stdout, "Added: %s\n", entry.ImagePath.c_str());
+        }
 
-            sprite_file_close();
+        spriteFileHeader.num_entries = static_cast<uint32_t>(entries.size());
+        spriteFileHeader.total_size = totalSize;
+        spriteFileEntries = static_cast<rct_g1_element*>(malloc(std::max<size_t>(entries.size(), 1) * sizeof(rct_g1_element)));
+        spriteFileData = static_cast<uint8_t*>(malloc(std::max<uint32_t>(totalSize, 1)));
+
+        uint8_t* dst = spriteFileData;
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            const auto& buffer = entries[i].Result->Buffer;
+            std::memcpy(dst, buffer.data(), buffer.size());
+            spriteFileEntries[i] = entries[i].Result->Element;
+            spriteFileEntries[i].offset = dst;
+            dst += buffer.size();
         }
 
+        bool saved = sprite_file_save(spriteFilePath);
+        sprite_file_close();
+        if (!saved)
+        {
+            fprintf(stderr, "Could not save sprite file: %s\nCanceling\n", spriteFilePath);
+            return -1;
+        }
+        sprite_build_cache_save(spriteFilePath, entries);
+
+        if (reused > 0)
+            fprintf(stdout, "Reused %zu unchanged images\n", reused);
+
         free(directoryPath);
 
         fprintf(stdout, "Finished\n");
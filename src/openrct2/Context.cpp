@@ -14,6 +14,7 @@
 #include "Context.h"
 #include "Editor.h"
 #include "FileClassifier.h"
+#include "FrameProfiler.h"
 #include "Game.h"
 #include "GameState.h"
 #include "GameStateSnapshots.h"
@@ -23,6 +24,7 @@
 #include "ParkImporter.h"
 #include "PlatformEnvironment.h"
 #include "ReplayManager.h"
+#include "Tracing.h"
 #include "Version.h"
 #include "actions/GameAction.h"
 #include "audio/AudioContext.h"
@@ -34,9 +36,12 @@
 #include "core/FileStream.h"
 #include "core/Guard.hpp"
 #include "core/Http.h"
+#include "core/JobPool.h"
+#include "core/LargePages.h"
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
+#include "core/Timer.h"
 #include "drawing/IDrawingEngine.h"
 #include "drawing/LightFX.h"
 #include "interface/Chat.h"
@@ -66,12 +71,14 @@
 #include "world/Park.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <exception>
 #include <future>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Audio;
@@ -83,6 +90,9 @@ using namespace OpenRCT2::Ui;
 
 namespace OpenRCT2
 {
+    static constexpr auto GameUpdateTime = std::chrono::milliseconds(GAME_UPDATE_TIME_MS);
+    static constexpr auto GameUpdateMaxThreshold = std::chrono::milliseconds(GAME_UPDATE_MAX_THRESHOLD);
+
     class Context final : public IContext
     {
     private:
@@ -117,8 +127,10 @@ namespace OpenRCT2
 
         bool _initialised = false;
         bool _isWindowMinimised = false;
-        uint32_t _lastTick = 0;
-        uint32_t _accumulator = 0;
+        Timer::Clock::time_point _lastTick{};
+        Timer::Clock::duration _accumulator{};
+        uint32_t _turboSampleStart = 0;
+        uint32_t _turboSampleTicks = 0;
         uint32_t _lastUpdateTime = 0;
         bool _variableFrame = false;
 
@@ -130,6 +142,9 @@ namespace OpenRCT2
         NewVersionInfo _newVersionInfo;
         bool _hasNewVersionInfo = false;
 
+        // Processes hosting the other parks when this process was asked to host more than one
+        std::vector<int32_t> _parkProcesses;
+
     public:
         // Singleton of Context.
         // Remove this when GetContext() is no longer called so that
@@ -160,6 +175,12 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            // Write a trace that was still being recorded when the game quit
+            Tracing::Stop();
+
+            // Finish writing an autosave before anything it uses is torn down
+            scenario_wait_for_background_save();
+
             GameActions::ClearQueue();
             network_close();
             window_close_all();
@@ -171,6 +192,7 @@ namespace OpenRCT2
                 _objectManager->UnloadAll();
             }
 
+            scrolling_text_dispose();
             gfx_object_check_all_images_freed();
             gfx_unload_g2();
             gfx_unload_g1();
@@ -260,7 +282,16 @@ namespace OpenRCT2
         {
             if (Initialise())
             {
+#if !defined(DISABLE_NETWORK) && !defined(_WIN32)
+                StartParkProcesses();
+#endif
                 Launch();
+#if !defined(DISABLE_NETWORK) && !defined(_WIN32)
+                for (auto pid : _parkProcesses)
+                {
+                    Platform::StopProcess(pid);
+                }
+#endif
                 return EXIT_SUCCESS;
             }
             return EXIT_FAILURE;
@@ -339,6 +370,9 @@ namespace OpenRCT2
 
             crash_init();
 
+            // Before anything allocates the game pools
+            LargePages::SetEnabled(gConfigGeneral.use_large_pages);
+
             if (gConfigGeneral.last_run_version != nullptr && String::Equals(gConfigGeneral.last_run_version, OPENRCT2_VERSION))
             {
                 gOpenRCT2ShowChangelog = false;
@@ -430,24 +464,41 @@ namespace OpenRCT2
 
             EnsureUserContentDirectoriesExist();
 
+            // The track design, scenario and title sequence indexes depend on nothing but the language, so they are
+            // loaded in the background while the objects, audio and graphics are loaded on this thread. None of them
+            // are used until the title screen is created.
+            // Headless instances have no windows to browse track designs or play title sequences in, so those indexes
+            // are not built at all.
+            const auto language = _localisationService->GetCurrentLanguage();
+            JobPool startupJobs;
+            if (!gOpenRCT2Headless)
+            {
+                AddStartupStage(startupJobs, "track design index", [this, language]() {
+                    _trackDesignRepository->Scan(language);
+                });
+            }
+            AddStartupStage(startupJobs, "scenario index", [this, language]() { _scenarioRepository->Scan(language); });
+            if (!gOpenRCT2Headless)
+            {
+                AddStartupStage(startupJobs, "title sequences", []() { TitleSequenceManager::Scan(); });
+            }
+
             // TODO Ideally we want to delay this until we show the title so that we can
             //      still open the game window and draw a progress screen for the creation
             //      of the object cache.
-            _objectRepository->LoadOrConstruct(_localisationService->GetCurrentLanguage());
-
-            // TODO Like objects, this can take a while if there are a lot of track designs
-            //      its also really something really we might want to do in the background
-            //      as its not required until the player wants to place a new ride.
-            _trackDesignRepository->Scan(_localisationService->GetCurrentLanguage());
-
-            _scenarioRepository->Scan(_localisationService->GetCurrentLanguage());
-            TitleSequenceManager::Scan();
+            RunStartupStage("object index", [this, language]() { _objectRepository->LoadOrConstruct(language); });
+            if (gConfigGeneral.enable_object_hot_reloading && !gOpenRCT2Headless)
+            {
+                _objectRepository->EnableHotReloading();
+            }
 
             if (!gOpenRCT2Headless)
             {
-                Init();
-                PopulateDevices();
-                InitRideSoundsAndInfo();
+                RunStartupStage("audio", []() {
+                    Init();
+                    PopulateDevices();
+                    InitRideSoundsAndInfo();
+                });
                 gGameSoundsOff = !gConfigSound.master_sound_enabled;
             }
 
@@ -455,9 +506,12 @@ namespace OpenRCT2
             chat_init();
             CopyOriginalUserFilesOver();
 
+            // Objects read images of the base graphics, so these must not be loaded while the object index is built
             if (!gOpenRCT2NoGraphics)
             {
-                if (!LoadBaseGraphics())
+                bool graphicsLoaded = false;
+                RunStartupStage("base graphics", [this, &graphicsLoaded]() { graphicsLoaded = LoadBaseGraphics(); });
+                if (!graphicsLoaded)
                 {
                     return false;
                 }
@@ -466,6 +520,8 @@ namespace OpenRCT2
 #endif
             }
 
+            RunStartupStage("waiting for background stages", [&startupJobs]() { startupJobs.Join(); });
+
             gScenarioTicks = 0;
             input_reset_place_obj_modifier();
             viewport_init_all();
@@ -584,6 +640,7 @@ namespace OpenRCT2
 
         bool LoadParkFromStream(IStream* stream, const std::string& path, bool loadTitleScreenFirstOnFail) final override
         {
+            Tracing::ScopedSpan traceSpan("save_load", "load");
             try
             {
                 ClassifiedFileInfo info;
@@ -746,6 +803,34 @@ namespace OpenRCT2
             return result;
         }
 
+        /**
+         * Runs a stage of the start up on the calling thread and logs how long it took.
+         */
+        template<typename TFn> static void RunStartupStage(const char* name, TFn&& fn)
+        {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            fn();
+            auto duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime);
+            log_verbose("Startup: %s took %.2f ms", name, duration.count() * 1000);
+        }
+
+        /**
+         * Runs a stage of the start up on the job pool, it must not depend on any other stage but the language.
+         */
+        template<typename TFn> static void AddStartupStage(JobPool& jobs, const char* name, TFn&& fn)
+        {
+            jobs.AddTask([name, fn = std::forward<TFn>(fn)]() {
+                try
+                {
+                    RunStartupStage(name, fn);
+                }
+                catch (const std::exception& e)
+                {
+                    log_error("Startup: %s failed: %s", name, e.what());
+                }
+            });
+        }
+
         bool LoadBaseGraphics()
         {
             if (!gfx_load_g1(*_env))
@@ -758,6 +843,46 @@ namespace OpenRCT2
             return true;
         }
 
+#if !defined(DISABLE_NETWORK) && !defined(_WIN32)
+        /**
+         * Hosts each additional park in a copy of this process, forked once the object repository, the scenario and
+         * track indexes and the g1 images are loaded so that all parks share that memory. Each park's game state is
+         * private to its process, the n-th additional park is served on the n-th port after the first park's.
+         */
+        void StartParkProcesses()
+        {
+            if (gNetworkStart != NETWORK_MODE_SERVER || gNetworkAdditionalParks.empty())
+                return;
+
+            if (gNetworkStartPort == 0)
+            {
+                gNetworkStartPort = gConfigNetwork.default_port;
+            }
+
+            auto parks = std::move(gNetworkAdditionalParks);
+            gNetworkAdditionalParks.clear();
+            for (size_t i = 0; i < parks.size(); i++)
+            {
+                auto pid = Platform::ForkProcess();
+                if (pid == -1)
+                {
+                    Console::Error::WriteLine("Unable to start a process for '%s'", parks[i].c_str());
+                }
+                else if (pid == 0)
+                {
+                    _parkProcesses.clear();
+                    String::Set(gOpenRCT2StartupActionPath, sizeof(gOpenRCT2StartupActionPath), parks[i].c_str());
+                    gNetworkStartPort += static_cast<int32_t>(i + 1);
+                    return;
+                }
+                else
+                {
+                    _parkProcesses.push_back(pid);
+                }
+            }
+        }
+#endif
+
         /**
          * Launches the game, after command line arguments have been parsed and processed.
          */
@@ -895,7 +1020,22 @@ namespace OpenRCT2
                 {
                     gNetworkStartPort = gConfigNetwork.default_port;
                 }
-                network_begin_client(gNetworkStartHost, gNetworkStartPort);
+                if (gNetworkStartAddress.empty())
+                {
+                    gNetworkStartAddress = gConfigNetwork.listen_address;
+                }
+                if (gNetworkRelayPort != 0)
+                {
+                    network_begin_relay(gNetworkStartHost, gNetworkStartPort, gNetworkRelayPort, gNetworkStartAddress);
+                }
+                else if (gNetworkStandbyPort != 0)
+                {
+                    network_begin_standby(gNetworkStartHost, gNetworkStartPort, gNetworkStandbyPort, gNetworkStartAddress);
+                }
+                else
+                {
+                    network_begin_client(gNetworkStartHost, gNetworkStartPort);
+                }
             }
 #endif // DISABLE_NETWORK
 
@@ -941,13 +1081,35 @@ namespace OpenRCT2
             log_verbose("finish openrct2 loop");
         }
 
+        bool ShouldRunTurboFrame()
+        {
+            if (!gTurboMode)
+                return false;
+            if (network_get_mode() != NETWORK_MODE_NONE)
+                return false;
+            if (gIntroState != IntroState::None)
+                return false;
+            if (gScreenFlags & SCREEN_FLAGS_TITLE_DEMO)
+                return false;
+            if (game_is_paused())
+                return false;
+            return true;
+        }
+
         void RunFrame()
         {
+            if (ShouldRunTurboFrame())
+            {
+                RunTurboFrame();
+                return;
+            }
+            _turboSampleStart = 0;
+
             // Make sure we catch the state change and reset it.
             bool useVariableFrame = ShouldRunVariableFrame();
             if (_variableFrame != useVariableFrame)
             {
-                _lastTick = 0;
+                _lastTick = {};
                 _variableFrame = useVariableFrame;
             }
 
@@ -961,83 +1123,156 @@ namespace OpenRCT2
             }
         }
 
-        void RunFixedFrame()
+        /**
+         * Adds the time since the last frame to the accumulator, capped so a long stall does not have to be caught up.
+         */
+        void AccumulateFrameTime(Timer::Clock::time_point currentTick)
         {
-            uint32_t currentTick = platform_get_ticks();
-
-            if (_lastTick == 0)
+            if (_lastTick == Timer::Clock::time_point{})
             {
                 _lastTick = currentTick;
             }
 
-            uint32_t elapsed = currentTick - _lastTick;
+            auto elapsed = currentTick - _lastTick;
             _lastTick = currentTick;
-            _accumulator = std::min(_accumulator + elapsed, static_cast<uint32_t>(GAME_UPDATE_MAX_THRESHOLD));
+            _accumulator = std::min<Timer::Clock::duration>(_accumulator + elapsed, GameUpdateMaxThreshold);
+        }
+
+        void RunFixedFrame()
+        {
+            auto currentTick = Timer::Clock::now();
+            AccumulateFrameTime(currentTick);
 
             _uiContext->ProcessMessages();
 
-            if (_accumulator < GAME_UPDATE_TIME_MS)
+            if (_accumulator < GameUpdateTime)
             {
-                platform_sleep(GAME_UPDATE_TIME_MS - _accumulator - 1);
+                Timer::SleepUntil(currentTick + (GameUpdateTime - _accumulator));
                 return;
             }
 
-            while (_accumulator >= GAME_UPDATE_TIME_MS)
+            FrameProfiler::ScopedFrame profileFrame(gCurrentDrawCount);
+            FrameProfiler::SetTickLateness(std::chrono::duration<double>(_accumulator - GameUpdateTime).count());
             {
-                Update();
-                _accumulator -= GAME_UPDATE_TIME_MS;
+                FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::GameLogic);
+                while (_accumulator >= GameUpdateTime)
+                {
+                    Update();
+                    _accumulator -= GameUpdateTime;
+                }
             }
 
             if (!_isWindowMinimised && !gOpenRCT2Headless)
             {
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
-                _drawingEngine->EndDraw();
+                {
+                    FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Present);
+                    _drawingEngine->EndDraw();
+                }
                 _drawingEngine->UpdateWindows();
             }
         }
 
-        void RunVariableFrame()
+        /**
+         * Updates the game back to back until the next preview frame is due, then paints it. Sound is paused by
+         * game_set_turbo_mode, so the only other work done between ticks is input and window updates.
+         */
+        void RunTurboFrame()
         {
+            uint32_t frameStart = platform_get_ticks();
+            uint32_t previewInterval = 1000 / std::clamp<int32_t>(gTurboPreviewRate, 1, GAME_UPDATE_FPS);
+            uint32_t startTicks = gCurrentTicks;
+
+            _uiContext->ProcessMessages();
+
+            FrameProfiler::ScopedFrame profileFrame(gCurrentDrawCount);
+            {
+                FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::GameLogic);
+                do
+                {
+                    Update();
+                } while (!_finished && gTurboMode && platform_get_ticks() - frameStart < previewInterval);
+            }
+
+            // Report the achieved rate over roughly a second so it does not jump about with each preview frame
             uint32_t currentTick = platform_get_ticks();
+            if (_turboSampleStart == 0)
+            {
+                _turboSampleStart = frameStart;
+                _turboSampleTicks = 0;
+            }
+            _turboSampleTicks += gCurrentTicks - startTicks;
+            uint32_t sampleLength = currentTick - _turboSampleStart;
+            if (sampleLength >= 1000)
+            {
+                gTurboTicksPerSecond = static_cast<uint32_t>(static_cast<uint64_t>(_turboSampleTicks) * 1000 / sampleLength);
+                _turboSampleStart = currentTick;
+                _turboSampleTicks = 0;
+            }
+
+            // Start the normal frame loops afresh rather than have them catch up on the time spent here
+            _lastTick = {};
+            _accumulator = {};
+
+            if (!_isWindowMinimised && !gOpenRCT2Headless)
+            {
+                _drawingEngine->BeginDraw();
+                _painter->Paint(*_drawingEngine);
+                {
+                    FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Present);
+                    _drawingEngine->EndDraw();
+                }
+                _drawingEngine->UpdateWindows();
+            }
+        }
 
+        void RunVariableFrame()
+        {
             bool draw = !_isWindowMinimised && !gOpenRCT2Headless;
-            if (_lastTick == 0)
+            if (_lastTick == Timer::Clock::time_point{})
             {
                 sprite_position_tween_reset();
-                _lastTick = currentTick;
             }
-
-            uint32_t elapsed = currentTick - _lastTick;
-
-            _lastTick = currentTick;
-            _accumulator = std::min(_accumulator + elapsed, static_cast<uint32_t>(GAME_UPDATE_MAX_THRESHOLD));
+            AccumulateFrameTime(Timer::Clock::now());
 
             _uiContext->ProcessMessages();
 
-            while (_accumulator >= GAME_UPDATE_TIME_MS)
+            FrameProfiler::ScopedFrame profileFrame(gCurrentDrawCount);
             {
-                // Get the original position of each sprite
-                if (draw)
-                    sprite_position_tween_store_a();
+                FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::GameLogic);
+                while (_accumulator >= GameUpdateTime)
+                {
+                    // Only the last tick of the frame is interpolated, so catching up after a slow frame does not also
+                    // pay for recording sprite positions that are immediately overwritten.
+                    bool isLastTick = _accumulator < GameUpdateTime * 2;
 
-                Update();
+                    // Get the original position of each sprite
+                    if (draw && isLastTick)
+                        sprite_position_tween_store_a();
 
-                _accumulator -= GAME_UPDATE_TIME_MS;
+                    Update();
 
-                // Get the next position of each sprite
-                if (draw)
-                    sprite_position_tween_store_b();
+                    _accumulator -= GameUpdateTime;
+
+                    // Get the next position of each sprite
+                    if (draw && isLastTick)
+                        sprite_position_tween_store_b();
+                }
             }
 
             if (draw)
             {
-                const float alpha = std::min(static_cast<float>(_accumulator) / GAME_UPDATE_TIME_MS, 1.0f);
+                const float alpha = std::min(
+                    std::chrono::duration<float>(_accumulator) / std::chrono::duration<float>(GameUpdateTime), 1.0f);
                 sprite_position_tween_all(alpha);
 
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
-                _drawingEngine->EndDraw();
+                {
+                    FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Present);
+                    _drawingEngine->EndDraw();
+                }
 
                 sprite_position_tween_restore();
 
@@ -1084,6 +1319,7 @@ namespace OpenRCT2
 #endif
 
             chat_update();
+            _objectRepository->UpdateHotReloading();
 #ifdef ENABLE_SCRIPTING
             _scriptEngine.Update();
 #endif
@@ -420,16 +420,13 @@ bool window_editor_object_selection_select_object(uint8_t isMasterObject, int32_
         return false;
     }
 
-    int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    // Get repository item index
-    int32_t index = -1;
+    // Get repository item index, items are stored contiguously so selecting an object does not need to search for it
     const ObjectRepositoryItem* items = object_repository_get_items();
-    for (int32_t i = 0; i < numObjects; i++)
+    const size_t index = static_cast<size_t>(item - items);
+    if (item < items || index >= _objectSelectionFlags.size())
     {
-        if (&items[i] == item)
-        {
-            index = i;
-        }
+        set_object_selection_error(isMasterObject, STR_OBJECT_SELECTION_ERR_OBJECT_DATA_NOT_FOUND);
+        return false;
     }
 
     uint8_t* selectionFlags = &_objectSelectionFlags[index];
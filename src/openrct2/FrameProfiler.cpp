@@ -0,0 +1,144 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace OpenRCT2::FrameProfiler
+{
+    static constexpr std::array<std::string_view, StageCount> StageNames = {
+        "game_logic",
+        "invalidation",
+        "windows",
+        "viewport_sessions",
+        "viewport_draw",
+        "interface",
+        "weather",
+        "text",
+        "present",
+    };
+
+    static SampleBuffer _samples;
+    static FrameSample _currentSample{};
+
+    static double GetSecondsSince(const std::chrono::high_resolution_clock::time_point& startTime)
+    {
+        return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+    }
+
+    template<typename TFn> static StageSummary Summarise(TFn getTime)
+    {
+        StageSummary summary{};
+        if (_samples.empty())
+            return summary;
+
+        for (size_t i = 0; i < _samples.size(); i++)
+        {
+            const double time = getTime(_samples[i]);
+            summary.Mean += time;
+            summary.Longest = std::max(summary.Longest, time);
+        }
+        summary.Mean /= _samples.size();
+        return summary;
+    }
+
+    ScopedFrame::ScopedFrame(uint32_t frame)
+        : _startTime(std::chrono::high_resolution_clock::now())
+    {
+        _currentSample = {};
+        _currentSample.Frame = frame;
+    }
+
+    ScopedFrame::~ScopedFrame()
+    {
+        _currentSample.Total = GetSecondsSince(_startTime);
+        _samples.push_back(_currentSample);
+    }
+
+    ScopedStage::ScopedStage(Stage stage)
+        : _stage(stage)
+        , _startTime(std::chrono::high_resolution_clock::now())
+        , _span("frame", GetStageName(stage))
+    {
+    }
+
+    ScopedStage::~ScopedStage()
+    {
+        AddTime(_stage, GetSecondsSince(_startTime));
+    }
+
+    void AddTime(Stage stage, double time)
+    {
+        _currentSample.Time[static_cast<size_t>(stage)] += time;
+    }
+
+    void SetTickLateness(double lateness)
+    {
+        _currentSample.Lateness = lateness;
+    }
+
+    std::string_view GetStageName(Stage stage)
+    {
+        const auto index = static_cast<size_t>(stage);
+        if (index >= StageNames.size())
+            return {};
+        return StageNames[index];
+    }
+
+    const SampleBuffer& GetSamples()
+    {
+        return _samples;
+    }
+
+    StageSummary GetStageSummary(Stage stage)
+    {
+        const auto index = static_cast<size_t>(stage);
+        return Summarise([index](const FrameSample& sample) { return sample.Time[index]; });
+    }
+
+    StageSummary GetTotalSummary()
+    {
+        return Summarise([](const FrameSample& sample) { return sample.Total; });
+    }
+
+    StageSummary GetTickLatenessSummary()
+    {
+        return Summarise([](const FrameSample& sample) { return sample.Lateness; });
+    }
+
+    bool WriteTrace(const std::string& path)
+    {
+        FILE* fp = fopen(path.c_str(), "wt");
+        if (!fp)
+            return false;
+
+        fputs("frame", fp);
+        for (const auto& name : StageNames)
+        {
+            fprintf(fp, ",%.*s", static_cast<int>(name.size()), name.data());
+        }
+        fputs(",total,tick_lateness\n", fp);
+
+        for (size_t i = 0; i < _samples.size(); i++)
+        {
+            const auto& sample = _samples[i];
+            fprintf(fp, "%u", sample.Frame);
+            for (auto time : sample.Time)
+            {
+                fprintf(fp, ",%.3f", time * 1000);
+            }
+            fprintf(fp, ",%.3f,%.3f\n", sample.Total * 1000, sample.Lateness * 1000);
+        }
+        fclose(fp);
+
+        return true;
+    }
+} // namespace OpenRCT2::FrameProfiler
@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Tracing.h"
+#include "common.h"
+#include "core/CircularBuffer.h"
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <string_view>
+
+namespace OpenRCT2::FrameProfiler
+{
+    /**
+     * The parts a frame is split into. The viewport stages are part of the time of the windows stage.
+     */
+    enum class Stage : uint8_t
+    {
+        GameLogic,
+        Invalidation,
+        Windows,
+        ViewportSessions,
+        ViewportDraw,
+        Interface,
+        Weather,
+        Text,
+        Present,
+        Count,
+    };
+
+    constexpr size_t StageCount = static_cast<size_t>(Stage::Count);
+    constexpr size_t MaxSamples = 256;
+
+    struct FrameSample
+    {
+        uint32_t Frame;                      // Value of gCurrentDrawCount when the frame started
+        double Total;                        // Time spent in the whole frame, in seconds
+        double Lateness;                     // How long after the first tick of the frame was due it started, in seconds
+        std::array<double, StageCount> Time; // Time spent in each stage, in seconds
+    };
+
+    struct StageSummary
+    {
+        double Mean;    // Mean time per frame over the recorded frames, in seconds
+        double Longest; // Longest time of a single recorded frame, in seconds
+    };
+
+    using SampleBuffer = CircularBuffer<FrameSample, MaxSamples>;
+
+    /**
+     * Records the total time of a frame, the stages timed while it is alive are added to the same sample.
+     * The sample of the frame is pushed into the sample buffer once the scope ends.
+     */
+    class ScopedFrame
+    {
+    private:
+        std::chrono::high_resolution_clock::time_point _startTime;
+
+    public:
+        explicit ScopedFrame(uint32_t frame);
+        ~ScopedFrame();
+
+        ScopedFrame(const ScopedFrame&) = delete;
+        ScopedFrame& operator=(const ScopedFrame&) = delete;
+    };
+
+    /**
+     * Adds the time from construction until the end of the scope to a stage of the current frame.
+     * The stage is also recorded as a trace span while tracing is enabled.
+     */
+    class ScopedStage
+    {
+    private:
+        Stage _stage;
+        std::chrono::high_resolution_clock::time_point _startTime;
+        Tracing::ScopedSpan _span;
+
+    public:
+        explicit ScopedStage(Stage stage);
+        ~ScopedStage();
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+    };
+
+    // Adds time that was measured elsewhere to a stage of the current frame.
+    void AddTime(Stage stage, double time);
+
+    // Sets how late the ticks of the current frame started, only fixed rate frames wait for their ticks to be due.
+    void SetTickLateness(double lateness);
+
+    std::string_view GetStageName(Stage stage);
+
+    // Returns the samples of the last recorded frames, oldest first.
+    const SampleBuffer& GetSamples();
+
+    StageSummary GetStageSummary(Stage stage);
+    StageSummary GetTotalSummary();
+    StageSummary GetTickLatenessSummary();
+
+    /**
+     * Writes the recorded frames to a CSV file, one row per frame with the time of each stage and the tick
+     * lateness in milliseconds.
+     * Returns false if the file could not be written.
+     */
+    bool WriteTrace(const std::string& path);
+} // namespace OpenRCT2::FrameProfiler
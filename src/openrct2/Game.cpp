@@ -74,6 +74,9 @@
 uint16_t gCurrentDeltaTime;
 uint8_t gGamePaused = 0;
 int32_t gGameSpeed = 1;
+bool gTurboMode = false;
+int32_t gTurboPreviewRate = 4;
+uint32_t gTurboTicksPerSecond = 0;
 bool gDoSingleUpdate = false;
 float gDayNightCycle = 0;
 bool gInUpdateCode = false;
@@ -93,6 +96,7 @@ using namespace OpenRCT2;
 void game_reset_speed()
 {
     gGameSpeed = 1;
+    game_set_turbo_mode(false);
     window_invalidate_by_class(WC_TOP_TOOLBAR);
 }
 
@@ -112,6 +116,28 @@ void game_reduce_game_speed()
     window_invalidate_by_class(WC_TOP_TOOLBAR);
 }
 
+/**
+ * Turbo mode runs the game as fast as the CPU allows, only painting a preview at gTurboPreviewRate frames per second.
+ * Sound is paused while it is on as it would not keep up anyway.
+ */
+void game_set_turbo_mode(bool enabled)
+{
+    if (gTurboMode == enabled)
+        return;
+
+    gTurboMode = enabled;
+    gTurboTicksPerSecond = 0;
+    if (enabled)
+    {
+        OpenRCT2::Audio::Pause();
+    }
+    else if (gConfigSound.master_sound_enabled)
+    {
+        OpenRCT2::Audio::Resume();
+    }
+    window_invalidate_by_class(WC_TOP_TOOLBAR);
+}
+
 /**
  *
  *  rct2: 0x0066B5C0 (part of 0x0066B3E8)
@@ -590,6 +616,7 @@ void game_load_init()
 
     OpenRCT2::Audio::StopTitleMusic();
     gGameSpeed = 1;
+    game_set_turbo_mode(false);
 }
 
 void game_load_scripts()
@@ -768,26 +795,32 @@ void game_autosave()
         timeName, sizeof(timeName), "autosave_%04u-%02u-%02u_%02u-%02u-%02u%s", currentDate.year, currentDate.month,
         currentDate.day, currentTime.hour, currentTime.minute, currentTime.second, fileExtension);
 
-    int32_t autosavesToKeep = gConfigGeneral.autosave_amount;
-    limit_autosave_count(autosavesToKeep - 1, (gScreenFlags & SCREEN_FLAGS_EDITOR));
+    const int32_t autosavesToKeep = gConfigGeneral.autosave_amount;
+    const bool isLandscape = (gScreenFlags & SCREEN_FLAGS_EDITOR) != 0;
 
     utf8 path[MAX_PATH];
     utf8 backupPath[MAX_PATH];
     platform_get_user_directory(path, subDirectory, sizeof(path));
     safe_strcat_path(path, "autosave", sizeof(path));
-    platform_ensure_directory_exists(path);
+    const std::string directory = path;
     safe_strcpy(backupPath, path, sizeof(backupPath));
     safe_strcat_path(path, timeName, sizeof(path));
     safe_strcat_path(backupPath, "autosave", sizeof(backupPath));
     safe_strcat(backupPath, fileExtension, sizeof(backupPath));
     safe_strcat(backupPath, ".bak", sizeof(backupPath));
 
-    if (Platform::FileExists(path))
-    {
-        platform_file_copy(path, backupPath, true);
-    }
-
-    if (!scenario_save(path, saveFlags))
+    // Only the copy of the park is made here, the old autosaves are cleaned up and the file is written on a
+    // background thread so that large parks do not stall the game
+    auto prepareFn = [autosavesToKeep, isLandscape, directory, savePath = std::string(path),
+                      backup = std::string(backupPath)]() {
+        limit_autosave_count(autosavesToKeep - 1, isLandscape);
+        platform_ensure_directory_exists(directory.c_str());
+        if (Platform::FileExists(savePath))
+        {
+            platform_file_copy(savePath.c_str(), backup.c_str(), true);
+        }
+    };
+    if (!scenario_save_in_background(path, saveFlags, prepareFn))
         std::fprintf(stderr, "Could not autosave the scenario. Is the save folder writeable?\n");
 }
 
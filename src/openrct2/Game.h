@@ -99,6 +99,7 @@ enum GAME_COMMAND
     GAME_COMMAND_GUEST_SET_FLAGS,              // GA
     GAME_COMMAND_SET_DATE,                     // GA
     GAME_COMMAND_CUSTOM,                       // GA
+    GAME_COMMAND_PLACE_SCENERY_BATCH,          // GA
     GAME_COMMAND_COUNT,
 };
 
@@ -138,6 +139,9 @@ extern uint32_t gCurrentRealTimeTicks;
 extern uint16_t gCurrentDeltaTime;
 extern uint8_t gGamePaused;
 extern int32_t gGameSpeed;
+extern bool gTurboMode;
+extern int32_t gTurboPreviewRate;
+extern uint32_t gTurboTicksPerSecond;
 extern bool gDoSingleUpdate;
 extern float gDayNightCycle;
 extern bool gInUpdateCode;
@@ -149,6 +153,7 @@ extern bool gLoadKeepWindowsOpen;
 void game_reset_speed();
 void game_increase_game_speed();
 void game_reduce_game_speed();
+void game_set_turbo_mode(bool enabled);
 
 void game_create_windows();
 void reset_all_sprite_quadrant_placements();
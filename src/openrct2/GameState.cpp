@@ -16,6 +16,7 @@
 #include "Input.h"
 #include "OpenRCT2.h"
 #include "ReplayManager.h"
+#include "TickProfiler.h"
 #include "actions/GameAction.h"
 #include "config/Config.h"
 #include "interface/Screenshot.h"
@@ -227,44 +228,53 @@ void GameState::Update()
 
 void GameState::UpdateLogic()
 {
+    using namespace OpenRCT2::TickProfiler;
+    ScopedTick profileTick(gCurrentTicks);
+
     gScreenAge++;
     if (gScreenAge == 0)
         gScreenAge--;
 
-    GetContext()->GetReplayManager()->Update();
-
-    network_update();
-
-    if (network_get_mode() == NETWORK_MODE_SERVER)
     {
-        if (network_gamestate_snapshots_enabled())
-        {
-            CreateStateSnapshot();
-        }
-
-        // Send current tick out.
-        network_send_tick();
+        ScopedStage profileStage(Stage::Replay);
+        GetContext()->GetReplayManager()->Update();
     }
-    else if (network_get_mode() == NETWORK_MODE_CLIENT)
+
     {
-        // Don't run past the server, this condition can happen during map changes.
-        if (network_get_server_tick() == gCurrentTicks)
-        {
-            return;
-        }
+        ScopedStage profileStage(Stage::Network);
+        network_update();
 
-        // Check desync.
-        bool desynced = network_check_desynchronisation();
-        if (desynced)
+        if (network_get_mode() == NETWORK_MODE_SERVER)
         {
-            // If desync debugging is enabled and we are still connected request the specific game state from server.
-            if (network_gamestate_snapshots_enabled() && network_get_status() == NETWORK_STATUS_CONNECTED)
+            if (network_gamestate_snapshots_enabled())
             {
-                // Create snapshot from this tick so we can compare it later
-                // as we won't pause the game on this event.
                 CreateStateSnapshot();
+            }
 
-                network_request_gamestate_snapshot();
+            // Send current tick out.
+            network_send_tick();
+        }
+        else if (network_get_mode() == NETWORK_MODE_CLIENT)
+        {
+            // Don't run past the server, this condition can happen during map changes.
+            if (network_get_server_tick() == gCurrentTicks)
+            {
+                return;
+            }
+
+            // Check desync.
+            bool desynced = network_check_desynchronisation();
+            if (desynced)
+            {
+                // If desync debugging is enabled and we are still connected request the specific game state from server.
+                if (network_gamestate_snapshots_enabled() && network_get_status() == NETWORK_STATUS_CONNECTED)
+                {
+                    // Create snapshot from this tick so we can compare it later
+                    // as we won't pause the game on this event.
+                    CreateStateSnapshot();
+
+                    network_request_gamestate_snapshot();
+                }
             }
         }
     }
@@ -275,36 +285,90 @@ void GameState::UpdateLogic()
     auto day = _date.GetDay();
 #endif
 
-    date_update();
-    _date = Date(static_cast<uint32_t>(gDateMonthsElapsed), gDateMonthTicks);
-
-    scenario_update();
-    climate_update();
-    map_update_tiles();
-    // Temporarily remove provisional paths to prevent peep from interacting with them
-    map_remove_provisional_elements();
-    map_update_path_wide_flags();
-    peep_update_all();
-    map_restore_provisional_elements();
-    vehicle_update_all();
-    sprite_misc_update_all();
-    Ride::UpdateAll();
+    {
+        ScopedStage profileStage(Stage::Date);
+        date_update();
+        _date = Date(static_cast<uint32_t>(gDateMonthsElapsed), gDateMonthTicks);
+    }
+
+    {
+        ScopedStage profileStage(Stage::Scenario);
+        scenario_update();
+    }
+    {
+        ScopedStage profileStage(Stage::Climate);
+        climate_update();
+        if (!gOpenRCT2Headless)
+        {
+            climate_update_effects();
+        }
+    }
+    {
+        ScopedStage profileStage(Stage::MapTiles);
+        map_update_tiles();
+    }
+    {
+        ScopedStage profileStage(Stage::MapPathWideFlags);
+        // Temporarily remove provisional paths to prevent peep from interacting with them
+        map_remove_provisional_elements();
+        map_update_path_wide_flags();
+    }
+    {
+        ScopedStage profileStage(Stage::Peeps);
+        peep_update_all();
+        map_restore_provisional_elements();
+    }
+    {
+        ScopedStage profileStage(Stage::Vehicles);
+        vehicle_update_all();
+    }
+    {
+        ScopedStage profileStage(Stage::MiscSprites);
+        sprite_misc_update_all();
+    }
+    {
+        ScopedStage profileStage(Stage::Rides);
+        Ride::UpdateAll();
+    }
 
     if (!(gScreenFlags & SCREEN_FLAGS_EDITOR))
     {
+        ScopedStage profileStage(Stage::Park);
         _park->Update(_date);
     }
 
-    research_update();
-    ride_ratings_update_all();
-    ride_measurements_update();
-    News::UpdateCurrentItem();
-
-    map_animation_invalidate_all();
-    vehicle_sounds_update();
-    peep_update_crowd_noise();
-    climate_update_sound();
-    editor_open_windows_for_current_step();
+    {
+        ScopedStage profileStage(Stage::Research);
+        research_update();
+    }
+    {
+        ScopedStage profileStage(Stage::RideRatings);
+        ride_ratings_update_all();
+    }
+    {
+        ScopedStage profileStage(Stage::RideMeasurements);
+        ride_measurements_update();
+    }
+    {
+        ScopedStage profileStage(Stage::News);
+        News::UpdateCurrentItem();
+    }
+    {
+        ScopedStage profileStage(Stage::MapAnimations);
+        map_animation_invalidate_all();
+    }
+    // Turbo mode pauses sound, so there is no need to work out what would be heard
+    if (!gTurboMode)
+    {
+        ScopedStage profileStage(Stage::Sounds);
+        vehicle_sounds_update();
+        peep_update_crowd_noise();
+        climate_update_sound();
+    }
+    {
+        ScopedStage profileStage(Stage::Editor);
+        editor_open_windows_for_current_step();
+    }
 
     // Update windows
     // window_dispatch_update_all();
@@ -315,20 +379,32 @@ void GameState::UpdateLogic()
         gLastAutoSaveUpdate = Platform::GetTicks();
     }
 
-    GameActions::ProcessQueue();
+    {
+        ScopedStage profileStage(Stage::GameActions);
+        GameActions::ProcessQueue();
+    }
 
-    network_process_pending();
-    network_flush();
+    {
+        ScopedStage profileStage(Stage::NetworkFlush);
+        network_process_pending();
+        network_flush();
+    }
 
     gCurrentTicks++;
     gScenarioTicks++;
     gSavedAge++;
 
 #ifdef ENABLE_SCRIPTING
-    auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
-    hookEngine.Call(HOOK_TYPE::INTERVAL_TICK, true);
+    ScopedStage profileStage(Stage::Hooks);
+    auto& scriptEngine = GetContext()->GetScriptEngine();
+    scriptEngine.FlushGameActionBatch();
+    auto& hookEngine = scriptEngine.GetHookEngine();
+    if (hookEngine.HasSubscriptions(HOOK_TYPE::INTERVAL_TICK))
+    {
+        hookEngine.Call(HOOK_TYPE::INTERVAL_TICK, true);
+    }
 
-    if (day != _date.GetDay())
+    if (day != _date.GetDay() && hookEngine.HasSubscriptions(HOOK_TYPE::INTERVAL_DAY))
     {
         hookEngine.Call(HOOK_TYPE::INTERVAL_DAY, true);
     }
@@ -10,41 +10,103 @@
 #include "GameStateSnapshots.h"
 
 #include "core/CircularBuffer.h"
+#include "core/JobPool.h"
 #include "peep/Peep.h"
 #include "world/Sprite.h"
 
+#include <algorithm>
+
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
-struct GameStateSnapshot_t
+// Number of captured snapshots that store their entities as changes against the same keyframe.
+static constexpr uint32_t SnapshotKeyframeInterval = 8;
+
+// Returns how many bytes of an entity are stored in a snapshot.
+static size_t GetStoredSpriteSize(const rct_sprite& sprite)
 {
-    GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
+    switch (sprite.generic.sprite_identifier)
     {
-        tick = mv.tick;
-        storedSprites = std::move(mv.storedSprites);
-        return *this;
+        case SpriteIdentifier::Vehicle:
+            return sizeof(Vehicle);
+        case SpriteIdentifier::Peep:
+            return sizeof(Peep);
+        case SpriteIdentifier::Litter:
+            return sizeof(Litter);
+        case SpriteIdentifier::Misc:
+            switch (sprite.generic.type)
+            {
+                case SPRITE_MISC_MONEY_EFFECT:
+                    return sizeof(MoneyEffect);
+                case SPRITE_MISC_BALLOON:
+                    return sizeof(Balloon);
+                case SPRITE_MISC_DUCK:
+                    return sizeof(Duck);
+                case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
+                    return sizeof(JumpingFountain);
+                case SPRITE_MISC_STEAM_PARTICLE:
+                    return sizeof(SteamParticle);
+            }
+            break;
+        case SpriteIdentifier::Null:
+            break;
     }
+    return 0;
+}
 
-    uint32_t tick = InvalidTick;
-    uint32_t srand0 = 0;
+struct StoredSprite_t
+{
+    uint32_t offset = 0; // Position of the entity data in the stream of the keyframe
+    uint32_t size = 0;
+    SpriteIdentifier spriteIdentifier = SpriteIdentifier::Null;
+    uint8_t type = 0;
+};
 
+/**
+ * All entities at the tick a keyframe was captured, shared by the snapshots that store their entities as changes
+ * against it.
+ */
+struct GameStateKeyframe_t
+{
     OpenRCT2::MemoryStream storedSprites;
-    OpenRCT2::MemoryStream parkParameters;
+    std::vector<StoredSprite_t> index;
 
-    // Must pass a function that can access the sprite.
-    void SerialiseSprites(std::function<rct_sprite*(const size_t)> getEntity, const size_t numSprites, bool saving)
+    bool IsUnchanged(uint32_t spriteIdx, const rct_sprite& sprite) const
     {
-        const bool loading = !saving;
+        const auto& stored = index[spriteIdx];
+        if (stored.spriteIdentifier != sprite.generic.sprite_identifier || stored.type != sprite.generic.type
+            || stored.size != GetStoredSpriteSize(sprite))
+        {
+            return false;
+        }
+        const auto* data = static_cast<const uint8_t*>(storedSprites.GetData()) + stored.offset;
+        return std::memcmp(data, &sprite, stored.size) == 0;
+    }
+};
 
-        storedSprites.SetPosition(0);
-        DataSerialiser ds(saving, storedSprites);
+// Must pass a function that can access the sprite. When saving, spriteIndices limits which sprites are written and
+// storedIndex receives where the data of each sprite was written to.
+static void SerialiseSprites(
+    OpenRCT2::MemoryStream& storedSprites, std::function<rct_sprite*(const size_t)> getEntity, const size_t numSprites,
+    bool saving, const std::vector<uint32_t>* spriteIndices = nullptr, std::vector<StoredSprite_t>* storedIndex = nullptr)
+{
+    const bool loading = !saving;
 
-        std::vector<uint32_t> indexTable;
-        indexTable.reserve(numSprites);
+    storedSprites.SetPosition(0);
+    DataSerialiser ds(saving, storedSprites);
 
-        uint32_t numSavedSprites = 0;
+    std::vector<uint32_t> indexTable;
+    indexTable.reserve(numSprites);
 
-        if (saving)
+    uint32_t numSavedSprites = 0;
+
+    if (saving)
+    {
+        if (spriteIndices != nullptr)
+        {
+            indexTable = *spriteIndices;
+        }
+        else
         {
             for (size_t i = 0; i < numSprites; i++)
             {
@@ -53,70 +115,112 @@ struct GameStateSnapshot_t
                     continue;
                 indexTable.push_back(static_cast<uint32_t>(i));
             }
-            numSavedSprites = static_cast<uint32_t>(indexTable.size());
         }
+        numSavedSprites = static_cast<uint32_t>(indexTable.size());
+    }
 
-        ds << numSavedSprites;
+    ds << numSavedSprites;
 
-        if (loading)
-        {
-            indexTable.resize(numSavedSprites);
-        }
+    if (loading)
+    {
+        indexTable.resize(numSavedSprites);
+    }
 
-        for (uint32_t i = 0; i < numSavedSprites; i++)
-        {
-            ds << indexTable[i];
+    for (uint32_t i = 0; i < numSavedSprites; i++)
+    {
+        ds << indexTable[i];
 
-            const uint32_t spriteIdx = indexTable[i];
-            rct_sprite* entity = getEntity(spriteIdx);
-            if (entity == nullptr)
-            {
-                log_error("Entity index corrupted!");
-                return;
-            }
-            auto& sprite = *entity;
+        const uint32_t spriteIdx = indexTable[i];
+        rct_sprite* entity = getEntity(spriteIdx);
+        if (entity == nullptr)
+        {
+            log_error("Entity index corrupted!");
+            return;
+        }
+        auto& sprite = *entity;
 
-            ds << sprite.generic.sprite_identifier;
+        ds << sprite.generic.sprite_identifier;
 
-            switch (sprite.generic.sprite_identifier)
+        switch (sprite.generic.sprite_identifier)
+        {
+            case SpriteIdentifier::Vehicle:
+                ds << reinterpret_cast<uint8_t(&)[sizeof(Vehicle)]>(sprite.vehicle);
+                break;
+            case SpriteIdentifier::Peep:
+                ds << reinterpret_cast<uint8_t(&)[sizeof(Peep)]>(sprite.peep);
+                break;
+            case SpriteIdentifier::Litter:
+                ds << reinterpret_cast<uint8_t(&)[sizeof(Litter)]>(sprite.litter);
+                break;
+            case SpriteIdentifier::Misc:
             {
-                case SpriteIdentifier::Vehicle:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Vehicle)]>(sprite.vehicle);
-                    break;
-                case SpriteIdentifier::Peep:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Peep)]>(sprite.peep);
-                    break;
-                case SpriteIdentifier::Litter:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Litter)]>(sprite.litter);
-                    break;
-                case SpriteIdentifier::Misc:
+                ds << sprite.generic.type;
+                switch (sprite.generic.type)
                 {
-                    ds << sprite.generic.type;
-                    switch (sprite.generic.type)
-                    {
-                        case SPRITE_MISC_MONEY_EFFECT:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(MoneyEffect)]>(sprite.money_effect);
-                            break;
-                        case SPRITE_MISC_BALLOON:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(Balloon)]>(sprite.balloon);
-                            break;
-                        case SPRITE_MISC_DUCK:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(Duck)]>(sprite.duck);
-                            break;
-                        case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(JumpingFountain)]>(sprite.jumping_fountain);
-                            break;
-                        case SPRITE_MISC_STEAM_PARTICLE:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(SteamParticle)]>(sprite.steam_particle);
-                            break;
-                    }
-                    break;
+                    case SPRITE_MISC_MONEY_EFFECT:
+                        ds << reinterpret_cast<uint8_t(&)[sizeof(MoneyEffect)]>(sprite.money_effect);
+                        break;
+                    case SPRITE_MISC_BALLOON:
+                        ds << reinterpret_cast<uint8_t(&)[sizeof(Balloon)]>(sprite.balloon);
+                        break;
+                    case SPRITE_MISC_DUCK:
+                        ds << reinterpret_cast<uint8_t(&)[sizeof(Duck)]>(sprite.duck);
+                        break;
+                    case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
+                        ds << reinterpret_cast<uint8_t(&)[sizeof(JumpingFountain)]>(sprite.jumping_fountain);
+                        break;
+                    case SPRITE_MISC_STEAM_PARTICLE:
+                        ds << reinterpret_cast<uint8_t(&)[sizeof(SteamParticle)]>(sprite.steam_particle);
+                        break;
                 }
-                case SpriteIdentifier::Null:
-                    break;
+                break;
             }
+            case SpriteIdentifier::Null:
+                break;
+        }
+
+        if (storedIndex != nullptr)
+        {
+            // The entity data is always written last and unmodified
+            auto& stored = (*storedIndex)[spriteIdx];
+            stored.size = static_cast<uint32_t>(GetStoredSpriteSize(sprite));
+            stored.offset = static_cast<uint32_t>(storedSprites.GetPosition()) - stored.size;
+            stored.spriteIdentifier = sprite.generic.sprite_identifier;
+            stored.type = sprite.generic.type;
         }
     }
+}
+
+// Grows or shrinks a list of unpacked entities, any added slots hold no entity.
+static void ResizeSpriteList(std::vector<rct_sprite>& spriteList, size_t size)
+{
+    rct_sprite nullSprite{};
+    nullSprite.generic.sprite_identifier = SpriteIdentifier::Null;
+    spriteList.resize(size, nullSprite);
+}
+
+struct GameStateSnapshot_t
+{
+    GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
+    {
+        tick = mv.tick;
+        srand0 = mv.srand0;
+        storedSprites = std::move(mv.storedSprites);
+        parkParameters = std::move(mv.parkParameters);
+        keyframe = std::move(mv.keyframe);
+        removedSprites = std::move(mv.removedSprites);
+        return *this;
+    }
+
+    uint32_t tick = InvalidTick;
+    uint32_t srand0 = 0;
+
+    // All entities, or only the ones that were added or changed since the keyframe if there is one.
+    OpenRCT2::MemoryStream storedSprites;
+    OpenRCT2::MemoryStream parkParameters;
+
+    std::shared_ptr<GameStateKeyframe_t> keyframe;
+    std::vector<uint32_t> removedSprites;
 };
 
 struct GameStateSnapshots final : public IGameStateSnapshots
@@ -124,6 +228,8 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     virtual void Reset() override final
     {
         _snapshots.clear();
+        _keyframe.reset();
+        _snapshotsSinceKeyframe = 0;
     }
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
@@ -142,8 +248,41 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
     virtual void Capture(GameStateSnapshot_t& snapshot) override final
     {
-        snapshot.SerialiseSprites(
-            [](const size_t index) { return reinterpret_cast<rct_sprite*>(GetEntity(index)); }, MAX_SPRITES, true);
+        auto getEntity = [](const size_t index) { return reinterpret_cast<rct_sprite*>(GetEntity(index)); };
+
+        // Only the allocated part of the entity pool can hold entities, a change in its size starts a new keyframe so
+        // the index of the keyframe always covers it.
+        const size_t numSprites = sprite_get_allocated_count();
+        std::vector<uint32_t> changedSprites;
+        snapshot.removedSprites.clear();
+        if (_keyframe == nullptr || _snapshotsSinceKeyframe >= SnapshotKeyframeInterval
+            || _keyframe->index.size() != numSprites)
+        {
+            _keyframe = std::make_shared<GameStateKeyframe_t>();
+            _keyframe->index.resize(numSprites);
+            SerialiseSprites(_keyframe->storedSprites, getEntity, numSprites, true, nullptr, &_keyframe->index);
+            _snapshotsSinceKeyframe = 0;
+        }
+        else
+        {
+            // Most entities do not change between a few ticks, so only store the ones that did
+            for (uint32_t i = 0; i < numSprites; i++)
+            {
+                const rct_sprite* entity = getEntity(i);
+                if (entity == nullptr || entity->generic.sprite_identifier == SpriteIdentifier::Null)
+                {
+                    if (_keyframe->index[i].spriteIdentifier != SpriteIdentifier::Null)
+                        snapshot.removedSprites.push_back(i);
+                }
+                else if (!_keyframe->IsUnchanged(i, *entity))
+                {
+                    changedSprites.push_back(i);
+                }
+            }
+        }
+        SerialiseSprites(snapshot.storedSprites, getEntity, numSprites, true, &changedSprites);
+        snapshot.keyframe = _keyframe;
+        _snapshotsSinceKeyframe++;
 
         // log_info("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
     }
@@ -162,22 +301,53 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         ds << snapshot.tick;
         ds << snapshot.srand0;
-        ds << snapshot.storedSprites;
+        if (ds.IsSaving() && snapshot.keyframe != nullptr)
+        {
+            // Captured snapshots only hold the changes since their keyframe, write out all entities
+            auto spriteList = BuildSpriteList(snapshot);
+            OpenRCT2::MemoryStream storedSprites;
+            SerialiseSprites(
+                storedSprites, [&spriteList](const size_t index) { return &spriteList[index]; }, spriteList.size(), true);
+            ds << storedSprites;
+        }
+        else
+        {
+            if (ds.IsLoading())
+            {
+                snapshot.keyframe.reset();
+                snapshot.removedSprites.clear();
+            }
+            ds << snapshot.storedSprites;
+        }
         ds << snapshot.parkParameters;
     }
 
     std::vector<rct_sprite> BuildSpriteList(GameStateSnapshot_t& snapshot) const
     {
+        // Snapshots received from elsewhere do not say how many entities the pool had, so the list grows to the
+        // highest index that is read.
         std::vector<rct_sprite> spriteList;
-        spriteList.resize(MAX_SPRITES);
-
-        for (auto& sprite : spriteList)
+        if (snapshot.keyframe != nullptr)
         {
-            // By default they don't exist.
-            sprite.generic.sprite_identifier = SpriteIdentifier::Null;
+            ResizeSpriteList(spriteList, snapshot.keyframe->index.size());
         }
 
-        snapshot.SerialiseSprites([&spriteList](const size_t index) { return &spriteList[index]; }, MAX_SPRITES, false);
+        auto getEntity = [&spriteList](const size_t index) -> rct_sprite* {
+            if (index >= MAX_SPRITES)
+                return nullptr;
+            if (index >= spriteList.size())
+                ResizeSpriteList(spriteList, index + 1);
+            return &spriteList[index];
+        };
+        if (snapshot.keyframe != nullptr)
+        {
+            SerialiseSprites(snapshot.keyframe->storedSprites, getEntity, spriteList.size(), false);
+            for (auto spriteIdx : snapshot.removedSprites)
+            {
+                spriteList[spriteIdx].generic.sprite_identifier = SpriteIdentifier::Null;
+            }
+        }
+        SerialiseSprites(snapshot.storedSprites, getEntity, spriteList.size(), false);
 
         return spriteList;
     }
@@ -538,10 +708,52 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
         std::vector<rct_sprite> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
         std::vector<rct_sprite> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+        MatchSpriteListSizes(spritesBase, spritesCmp);
 
-        for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
-        {
-            GameStateSpriteChange_t changeData;
+        CompareSpriteLists(spritesBase, spritesCmp, res);
+        return res;
+    }
+
+    virtual std::future<bool> CompareAndLogToFileAsync(
+        const GameStateSnapshot_t& base, const GameStateSnapshot_t& cmp, const std::string& fileName) const override final
+    {
+        GameStateCompareData_t res;
+        res.tick = base.tick;
+        res.srand0Left = base.srand0;
+        res.srand0Right = cmp.srand0;
+
+        // Both snapshots may share a keyframe which is read through a single stream, so unpack them here where the
+        // snapshots are still guaranteed to be alive and leave the expensive part to the worker.
+        std::vector<rct_sprite> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
+        std::vector<rct_sprite> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+        MatchSpriteListSizes(spritesBase, spritesCmp);
+
+        return std::async(
+            std::launch::async,
+            [this, fileName, res = std::move(res), spritesBase = std::move(spritesBase),
+             spritesCmp = std::move(spritesCmp)]() mutable {
+                CompareSpriteLists(spritesBase, spritesCmp, res);
+                return LogCompareDataToFile(fileName, res);
+            });
+    }
+
+    // The entity pools of both sides may have been allocated to different sizes.
+    static void MatchSpriteListSizes(std::vector<rct_sprite>& spritesBase, std::vector<rct_sprite>& spritesCmp)
+    {
+        const size_t size = std::max(spritesBase.size(), spritesCmp.size());
+        ResizeSpriteList(spritesBase, size);
+        ResizeSpriteList(spritesCmp, size);
+    }
+
+    void CompareSpriteLists(
+        const std::vector<rct_sprite>& spritesBase, const std::vector<rct_sprite>& spritesCmp,
+        GameStateCompareData_t& res) const
+    {
+        // Every sprite is compared on its own, so the list is split into ranges that fill their own slots.
+        res.spriteChanges.resize(spritesBase.size());
+        JobPool::ParallelFor(spritesBase.size(), [&](size_t index) {
+            const uint32_t i = static_cast<uint32_t>(index);
+            GameStateSpriteChange_t& changeData = res.spriteChanges[i];
             changeData.spriteIndex = i;
 
             const rct_sprite& spriteBase = spritesBase[i];
@@ -584,11 +796,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
                     changeData.changeType = GameStateSpriteChange_t::MODIFIED;
                 }
             }
-
-            res.spriteChanges.push_back(changeData);
-        }
-
-        return res;
+        });
     }
 
     static const char* GetSpriteIdentifierName(SpriteIdentifier spriteIdentifier, uint8_t miscIdentifier)
@@ -689,8 +897,35 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         return true;
     }
 
+    virtual size_t GetCount() const override final
+    {
+        return _snapshots.size();
+    }
+
+    virtual size_t GetMemoryUsage() const override final
+    {
+        size_t result = 0;
+        const GameStateKeyframe_t* lastKeyframe = nullptr;
+        for (size_t i = 0; i < _snapshots.size(); i++)
+        {
+            const auto& snapshot = *_snapshots[i];
+            result += snapshot.storedSprites.GetLength() + snapshot.parkParameters.GetLength()
+                + snapshot.removedSprites.capacity() * sizeof(uint32_t);
+
+            // Snapshots that share a keyframe follow each other
+            if (snapshot.keyframe != nullptr && snapshot.keyframe.get() != lastKeyframe)
+            {
+                lastKeyframe = snapshot.keyframe.get();
+                result += lastKeyframe->storedSprites.GetLength() + lastKeyframe->index.capacity() * sizeof(StoredSprite_t);
+            }
+        }
+        return result;
+    }
+
 private:
     CircularBuffer<std::unique_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+    std::shared_ptr<GameStateKeyframe_t> _keyframe;
+    uint32_t _snapshotsSinceKeyframe = 0;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots()
@@ -12,6 +12,7 @@
 #include "common.h"
 #include "core/DataSerialiser.h"
 
+#include <future>
 #include <memory>
 #include <set>
 #include <string>
@@ -103,6 +104,19 @@ struct IGameStateSnapshots
      * Writes the GameStateCompareData_t into the specified file as readable text.
      */
     virtual bool LogCompareDataToFile(const std::string& fileName, const GameStateCompareData_t& cmpData) const = 0;
+
+    /*
+     * Compares two states and writes the result into the specified file on a worker thread. The snapshots are only
+     * read before this returns so they may be removed afterwards, the future tells whether the file was written.
+     */
+    virtual std::future<bool> CompareAndLogToFileAsync(
+        const GameStateSnapshot_t& base, const GameStateSnapshot_t& cmp, const std::string& fileName) const = 0;
+
+    /*
+     * Number of stored snapshots and the memory they use, including their keyframes.
+     */
+    virtual size_t GetCount() const = 0;
+    virtual size_t GetMemoryUsage() const = 0;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots();
@@ -0,0 +1,79 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryReport.h"
+
+#include "Context.h"
+#include "GameStateSnapshots.h"
+#include "ReplayManager.h"
+#include "drawing/Drawing.h"
+#include "object/Object.h"
+#include "object/ObjectLimits.h"
+#include "object/ObjectManager.h"
+#include "world/Map.h"
+#include "world/Sprite.h"
+
+#ifdef ENABLE_SCRIPTING
+#    include "scripting/ScriptEngine.h"
+#endif
+
+#include <iterator>
+
+namespace OpenRCT2::MemoryReport
+{
+    std::vector<Entry> GetEntries()
+    {
+        std::vector<Entry> entries;
+        entries.push_back({ "tile_elements", gTileElements.size() * sizeof(TileElement), gTileElements.size() });
+        entries.push_back(
+            { "tile_pointers", sizeof(gTileElementTilePointers), std::size(gTileElementTilePointers) });
+
+        const auto spriteCount = sprite_get_allocated_count();
+        entries.push_back({ "sprites", spriteCount * sizeof(rct_sprite), spriteCount });
+
+        entries.push_back({ "base_graphics", gfx_get_gx_memory_usage(), 0 });
+
+        auto context = GetContext();
+        if (context != nullptr)
+        {
+            uint64_t objectCount = 0;
+            uint64_t imageBytes = 0;
+            auto& objectManager = context->GetObjectManager();
+            for (size_t i = 0; i < OBJECT_ENTRY_COUNT; i++)
+            {
+                const auto* object = objectManager.GetLoadedObject(i);
+                if (object != nullptr)
+                {
+                    objectCount++;
+                    imageBytes += object->GetImageTable().GetMemoryUsage();
+                }
+            }
+            entries.push_back({ "object_images", imageBytes, objectCount });
+
+            auto snapshots = context->GetGameStateSnapshots();
+            if (snapshots != nullptr)
+            {
+                entries.push_back({ "snapshots", snapshots->GetMemoryUsage(), snapshots->GetCount() });
+            }
+
+            auto replayManager = context->GetReplayManager();
+            if (replayManager != nullptr)
+            {
+                entries.push_back({ "replays", replayManager->GetMemoryUsage(), 0 });
+            }
+        }
+
+#ifdef ENABLE_SCRIPTING
+        using namespace OpenRCT2::Scripting;
+        entries.push_back({ "script_heap", GetDukHeapSize(DukHeapType::Engine), 0 });
+        entries.push_back({ "worker_heaps", GetDukHeapSize(DukHeapType::Worker), 0 });
+#endif
+        return entries;
+    }
+} // namespace OpenRCT2::MemoryReport
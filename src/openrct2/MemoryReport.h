@@ -0,0 +1,31 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <string_view>
+#include <vector>
+
+namespace OpenRCT2::MemoryReport
+{
+    struct Entry
+    {
+        std::string_view Name; // Name of the subsystem, e.g. "tile_elements"
+        uint64_t Bytes;        // Memory held by the subsystem's own data
+        uint64_t Items;        // Number of items the memory is spread over, e.g. elements or objects
+    };
+
+    /**
+     * Measures the memory held by the larger subsystems. Each subsystem reports the size of the data it has allocated,
+     * allocator overhead and small bookkeeping members are not included.
+     */
+    std::vector<Entry> GetEntries();
+} // namespace OpenRCT2::MemoryReport
@@ -12,6 +12,7 @@
 #include "common.h"
 
 #include <string>
+#include <vector>
 
 enum class PromptMode : uint8_t;
 
@@ -54,6 +55,9 @@ extern int32_t gNetworkStart;
 extern std::string gNetworkStartHost;
 extern int32_t gNetworkStartPort;
 extern std::string gNetworkStartAddress;
+extern int32_t gNetworkRelayPort;
+extern int32_t gNetworkStandbyPort;
+extern std::vector<std::string> gNetworkAdditionalParks;
 #endif
 
 extern uint32_t gCurrentDrawCount;
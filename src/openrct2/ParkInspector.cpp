@@ -0,0 +1,322 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkInspector.h"
+
+#include "core/FileStream.h"
+#include "core/JobPool.h"
+#include "core/Json.hpp"
+#include "core/String.hpp"
+#include "localisation/Localisation.h"
+#include "rct12/SawyerChunkReader.h"
+#include "rct2/RCT2.h"
+#include "ride/Ride.h"
+#include "ride/RideRatings.h"
+#include "scenario/Scenario.h"
+#include "world/Surface.h"
+
+#include <memory>
+#include <sstream>
+
+namespace OpenRCT2::ParkInspector
+{
+    static std::string GetRCT2String(const char* src, size_t maxLength)
+    {
+        auto asUtf8 = rct2_to_utf8(std::string_view(src, strnlen(src, maxLength)), RCT2_LANGUAGE_ID_ENGLISH_UK);
+        utf8_remove_format_codes(asUtf8.data(), false);
+        return asUtf8.data();
+    }
+
+    static std::string GetUserString(const rct_s6_data& s6, rct_string_id stringId)
+    {
+        if (!is_user_string_id(stringId))
+            return {};
+        const auto& customString = s6.custom_strings[(stringId - USER_STRING_START) % RCT12_MAX_USER_STRINGS];
+        return GetRCT2String(customString, std::size(customString));
+    }
+
+    /**
+     * Reads the chunks of the file the same way S6Importer does, packed objects are skipped rather than installed.
+     */
+    static std::unique_ptr<rct_s6_data> ReadS6(const std::string& path)
+    {
+        auto s6 = std::make_unique<rct_s6_data>();
+        auto fs = FileStream(path, FILE_MODE_OPEN);
+        auto chunkReader = SawyerChunkReader(&fs);
+        chunkReader.ReadChunk(&s6->header, sizeof(s6->header));
+        bool isScenario = s6->header.type == S6_TYPE_SCENARIO;
+        if (!isScenario && s6->header.type != S6_TYPE_SAVEDGAME)
+        {
+            throw std::runtime_error("Not an RCT2 saved game or scenario.");
+        }
+        if (s6->header.classic_flag == 0xf)
+        {
+            throw std::runtime_error("RCT Classic parks are not supported.");
+        }
+
+        if (isScenario)
+        {
+            chunkReader.ReadChunk(&s6->info, sizeof(s6->info));
+        }
+        for (uint16_t i = 0; i < s6->header.num_packed_objects; i++)
+        {
+            fs.Seek(sizeof(rct_object_entry), STREAM_SEEK_CURRENT);
+            chunkReader.SkipChunk();
+        }
+
+        chunkReader.ReadChunk(&s6->objects, sizeof(s6->objects));
+        chunkReader.ReadChunk(&s6->elapsed_months, 16);
+        chunkReader.ReadChunk(&s6->tile_elements, sizeof(s6->tile_elements));
+        if (isScenario)
+        {
+            chunkReader.ReadChunk(&s6->next_free_tile_element_pointer_index, 2560076);
+            chunkReader.ReadChunk(&s6->guests_in_park, 4);
+            chunkReader.ReadChunk(&s6->last_guests_in_park, 8);
+            chunkReader.ReadChunk(&s6->park_rating, 2);
+            chunkReader.ReadChunk(&s6->active_research_types, 1082);
+            chunkReader.ReadChunk(&s6->current_expenditure, 16);
+            chunkReader.ReadChunk(&s6->park_value, 4);
+            chunkReader.ReadChunk(&s6->completed_company_value, 483816);
+        }
+        else
+        {
+            chunkReader.ReadChunk(&s6->next_free_tile_element_pointer_index, 3048816);
+        }
+        return s6;
+    }
+
+    static void SummariseTiles(const rct_s6_data& s6, ParkSummary& park)
+    {
+        // Elements are stored tile after tile, each run ending with the last for tile flag
+        size_t index = 0;
+        for (int32_t tile = 0; tile < MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL; tile++)
+        {
+            int32_t x = tile % MAXIMUM_MAP_SIZE_TECHNICAL;
+            int32_t y = tile / MAXIMUM_MAP_SIZE_TECHNICAL;
+            bool insideMap = x > 0 && y > 0 && x < s6.map_size - 1 && y < s6.map_size - 1;
+            if (insideMap)
+                park.Tiles++;
+
+            bool lastForTile;
+            do
+            {
+                if (index >= RCT2_MAX_TILE_ELEMENTS)
+                    return;
+
+                const auto& element = s6.tile_elements[index++];
+                lastForTile = element.IsLastForTile();
+                if (!insideMap || element.IsGhost())
+                    continue;
+
+                switch (static_cast<RCT12TileElementType>(element.GetType()))
+                {
+                    case RCT12TileElementType::Surface:
+                    {
+                        auto surface = element.AsSurface();
+                        auto ownership = surface->GetOwnership();
+                        if (ownership & OWNERSHIP_OWNED)
+                            park.OwnedTiles++;
+                        else if (ownership & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED)
+                            park.ConstructionRightsTiles++;
+                        if (surface->GetWaterHeight() > 0)
+                            park.WaterTiles++;
+                        break;
+                    }
+                    case RCT12TileElementType::Path:
+                        park.PathElements++;
+                        break;
+                    case RCT12TileElementType::Track:
+                        park.TrackElements++;
+                        break;
+                    case RCT12TileElementType::SmallScenery:
+                    case RCT12TileElementType::LargeScenery:
+                        park.SceneryElements++;
+                        break;
+                    case RCT12TileElementType::Wall:
+                        park.WallElements++;
+                        break;
+                    default:
+                        break;
+                }
+            } while (!lastForTile);
+        }
+    }
+
+    static void SummariseRides(const rct_s6_data& s6, ParkSummary& park)
+    {
+        for (uint16_t i = 0; i < RCT12_MAX_RIDES_IN_PARK; i++)
+        {
+            const auto& src = s6.rides[i];
+            if (src.type == RIDE_TYPE_NULL)
+                continue;
+
+            RideSummary ride;
+            ride.Id = i;
+            ride.Type = src.type;
+            if (src.subtype < MAX_RIDE_OBJECTS)
+            {
+                ride.ObjectName = String::Trim(std::string(s6.objects[src.subtype].GetName()));
+            }
+            ride.Name = GetUserString(s6, src.name);
+            ride.Status = src.status;
+            ride.Excitement = src.excitement;
+            ride.Intensity = src.intensity;
+            ride.Nausea = src.nausea;
+            ride.TotalCustomers = src.total_customers;
+            park.Rides.push_back(std::move(ride));
+        }
+    }
+
+    ParkSummary Inspect(const std::string& path)
+    {
+        ParkSummary park;
+        park.Path = path;
+        try
+        {
+            auto s6 = ReadS6(path);
+            park.IsScenario = s6->header.type == S6_TYPE_SCENARIO;
+            park.Name = GetUserString(*s6, s6->park_name);
+            park.ScenarioName = GetRCT2String(s6->scenario_name, sizeof(s6->scenario_name));
+            park.ElapsedMonths = s6->elapsed_months;
+            park.MapSize = s6->map_size;
+            park.Guests = s6->guests_in_park;
+            park.Rating = s6->park_rating;
+            park.Cash = s6->cash;
+            park.Loan = s6->current_loan;
+            park.ParkValue = s6->park_value;
+            park.CompanyValue = s6->company_value;
+            SummariseTiles(*s6, park);
+            SummariseRides(*s6, park);
+        }
+        catch (const std::exception& e)
+        {
+            park = {};
+            park.Path = path;
+            park.Error = e.what();
+        }
+        return park;
+    }
+
+    std::vector<ParkSummary> Inspect(const std::vector<std::string>& paths)
+    {
+        std::vector<ParkSummary> result(paths.size());
+        // A chunk per file as the reads are dominated by decompression which varies with the file
+        JobPool::ParallelFor(paths.size(), 1, [&](size_t i) { result[i] = Inspect(paths[i]); });
+        return result;
+    }
+
+    static json_t RatingToJson(uint16_t rating)
+    {
+        if (rating == static_cast<uint16_t>(RIDE_RATING_UNDEFINED))
+            return nullptr;
+        return rating / 100.0;
+    }
+
+    json_t ToJson(const ParkSummary& park)
+    {
+        json_t result = { { "path", park.Path } };
+        if (!park.Error.empty())
+        {
+            result["error"] = park.Error;
+            return result;
+        }
+
+        json_t rides = json_t::array();
+        for (const auto& ride : park.Rides)
+        {
+            rides.push_back({
+                { "id", ride.Id },
+                { "type", ride.Type },
+                { "object", ride.ObjectName },
+                { "name", ride.Name },
+                { "status", ride.Status },
+                { "excitement", RatingToJson(ride.Excitement) },
+                { "intensity", RatingToJson(ride.Intensity) },
+                { "nausea", RatingToJson(ride.Nausea) },
+                { "totalCustomers", ride.TotalCustomers },
+            });
+        }
+
+        result["type"] = park.IsScenario ? "scenario" : "park";
+        result["name"] = park.Name;
+        result["scenarioName"] = park.ScenarioName;
+        result["elapsedMonths"] = park.ElapsedMonths;
+        result["mapSize"] = park.MapSize;
+        result["guests"] = park.Guests;
+        result["rating"] = park.Rating;
+        result["cash"] = park.Cash;
+        result["loan"] = park.Loan;
+        result["parkValue"] = park.ParkValue;
+        result["companyValue"] = park.CompanyValue;
+        result["land"] = {
+            { "tiles", park.Tiles },
+            { "owned", park.OwnedTiles },
+            { "constructionRights", park.ConstructionRightsTiles },
+            { "water", park.WaterTiles },
+            { "paths", park.PathElements },
+            { "track", park.TrackElements },
+            { "scenery", park.SceneryElements },
+            { "walls", park.WallElements },
+        };
+        result["rides"] = std::move(rides);
+        return result;
+    }
+
+    static std::string CsvQuote(std::string_view value)
+    {
+        std::string result = "\"";
+        for (auto ch : value)
+        {
+            if (ch == '"')
+                result += '"';
+            result += ch;
+        }
+        result += '"';
+        return result;
+    }
+
+    std::string ToCsv(const std::vector<ParkSummary>& parks)
+    {
+        std::ostringstream csv;
+        csv << "path,error,type,name,scenario_name,elapsed_months,map_size,guests,rating,cash,loan,park_value,"
+               "company_value,tiles,owned_tiles,construction_rights_tiles,water_tiles,path_elements,track_elements,"
+               "scenery_elements,wall_elements,rides,rated_rides,mean_excitement,mean_intensity,mean_nausea\n";
+        for (const auto& park : parks)
+        {
+            csv << CsvQuote(park.Path) << ',' << CsvQuote(park.Error);
+            if (!park.Error.empty())
+            {
+                csv << std::string(24, ',') << '\n';
+                continue;
+            }
+
+            uint32_t ratedRides = 0;
+            uint64_t excitement = 0, intensity = 0, nausea = 0;
+            for (const auto& ride : park.Rides)
+            {
+                if (ride.Excitement == static_cast<uint16_t>(RIDE_RATING_UNDEFINED))
+                    continue;
+                ratedRides++;
+                excitement += ride.Excitement;
+                intensity += ride.Intensity;
+                nausea += ride.Nausea;
+            }
+            auto mean = [ratedRides](uint64_t total) { return ratedRides == 0 ? 0.0 : total / (ratedRides * 100.0); };
+
+            csv << ',' << (park.IsScenario ? "scenario" : "park") << ',' << CsvQuote(park.Name) << ','
+                << CsvQuote(park.ScenarioName) << ',' << park.ElapsedMonths << ',' << park.MapSize << ',' << park.Guests
+                << ',' << park.Rating << ',' << park.Cash << ',' << park.Loan << ',' << park.ParkValue << ','
+                << park.CompanyValue << ',' << park.Tiles << ',' << park.OwnedTiles << ',' << park.ConstructionRightsTiles
+                << ',' << park.WaterTiles << ',' << park.PathElements << ',' << park.TrackElements << ','
+                << park.SceneryElements << ',' << park.WallElements << ',' << park.Rides.size() << ',' << ratedRides << ','
+                << mean(excitement) << ',' << mean(intensity) << ',' << mean(nausea) << '\n';
+        }
+        return csv.str();
+    }
+} // namespace OpenRCT2::ParkInspector
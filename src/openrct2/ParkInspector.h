@@ -0,0 +1,79 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+#include "core/JsonFwd.hpp"
+
+#include <string>
+#include <vector>
+
+namespace OpenRCT2::ParkInspector
+{
+    struct RideSummary
+    {
+        uint16_t Id{};
+        uint8_t Type{};
+        std::string ObjectName; // Identifier of the ride's object, e.g. "WMOUSE"
+        std::string Name;       // Custom name, empty when the ride has its default name
+        uint8_t Status{};
+        uint16_t Excitement{}; // Ratings in hundredths, RIDE_RATING_UNDEFINED when not yet rated
+        uint16_t Intensity{};
+        uint16_t Nausea{};
+        uint32_t TotalCustomers{};
+    };
+
+    struct ParkSummary
+    {
+        std::string Path;
+        std::string Error; // Set when the file could not be read, the other fields are then left empty
+        bool IsScenario{};
+        std::string Name;
+        std::string ScenarioName;
+        uint16_t ElapsedMonths{};
+        uint16_t MapSize{};
+        uint16_t Guests{};
+        uint16_t Rating{};
+        money32 Cash{};
+        money32 Loan{};
+        money32 ParkValue{};
+        money32 CompanyValue{};
+
+        // Land use, only the tiles inside the map edge are counted
+        uint32_t Tiles{};
+        uint32_t OwnedTiles{};
+        uint32_t ConstructionRightsTiles{};
+        uint32_t WaterTiles{};
+        uint32_t PathElements{};
+        uint32_t TrackElements{};
+        uint32_t SceneryElements{};
+        uint32_t WallElements{};
+
+        std::vector<RideSummary> Rides;
+    };
+
+    /**
+     * Reads the summary of an RCT2 saved game or scenario straight from the file. Unlike loading the park this does not
+     * need a context, objects or images, and it does not touch the game state, so many files can be read at once.
+     */
+    ParkSummary Inspect(const std::string& path);
+
+    /**
+     * Reads many parks in parallel. The summaries are returned in the order of the given paths.
+     */
+    std::vector<ParkSummary> Inspect(const std::vector<std::string>& paths);
+
+    json_t ToJson(const ParkSummary& park);
+
+    /**
+     * Formats the summaries as CSV, one row per park with ride counts and mean ratings instead of the ride list.
+     */
+    std::string ToCsv(const std::vector<ParkSummary>& parks);
+} // namespace OpenRCT2::ParkInspector
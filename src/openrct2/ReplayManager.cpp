@@ -32,8 +32,10 @@
 #include "world/Park.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace OpenRCT2
@@ -75,6 +77,15 @@ namespace OpenRCT2
         OpenRCT2::MemoryStream data;
     };
 
+    // Full park state at a tick of the replay, playback can start from here when seeking.
+    struct ReplayKeyframe
+    {
+        uint32_t tick;
+        OpenRCT2::MemoryStream parkData;
+        OpenRCT2::MemoryStream parkParams;
+        OpenRCT2::MemoryStream cheatData;
+    };
+
     struct ReplayRecordData
     {
         uint32_t magic;
@@ -92,15 +103,19 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        std::vector<ReplayKeyframe> keyframes;
+        std::multiset<ReplayCommand>::iterator nextCommand; // Next command to replay during playback
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 4;
+        static constexpr uint16_t ReplayVersion = 5;
+        static constexpr uint16_t ReplayVersionKeyframes = 5;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
+        static constexpr uint32_t KeyframeTicks = 12000;         // About five minutes of game time
 
         enum class ReplayMode
         {
@@ -130,6 +145,28 @@ namespace OpenRCT2
             return _mode == ReplayMode::NORMALISATION;
         }
 
+        virtual size_t GetMemoryUsage() const override
+        {
+            size_t result = 0;
+            for (const auto* data : { _currentRecording.get(), _currentReplay.get() })
+            {
+                if (data == nullptr)
+                    continue;
+
+                // The commands are in a tree, count a few pointers of overhead for each node
+                result += data->parkData.GetLength() + data->parkParams.GetLength() + data->cheatData.GetLength()
+                    + data->gameStateSnapshots.GetLength();
+                result += data->commands.size() * (sizeof(ReplayCommand) + 4 * sizeof(void*));
+                result += data->checksums.capacity() * sizeof(data->checksums[0]);
+                result += data->keyframes.capacity() * sizeof(ReplayKeyframe);
+                for (const auto& keyframe : data->keyframes)
+                {
+                    result += keyframe.parkData.GetLength() + keyframe.parkParams.GetLength() + keyframe.cheatData.GetLength();
+                }
+            }
+            return result;
+        }
+
         virtual bool ShouldDisplayNotice() const override
         {
             return IsRecording() && _recordType == RecordType::NORMAL;
@@ -164,6 +201,12 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && gCurrentTicks >= _nextKeyframeTick)
+            {
+                AddKeyframe();
+                _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -193,7 +236,7 @@ namespace OpenRCT2
                 ReplayCommands();
 
                 // If we run out of commands we can just stop
-                if (_currentReplay->commands.empty())
+                if (_currentReplay->nextCommand == _currentReplay->commands.end())
                 {
                     StopPlayback();
                     StopRecording();
@@ -240,23 +283,10 @@ namespace OpenRCT2
 
             replayData->filePath = name;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto s6exporter = std::make_unique<S6Exporter>();
-            s6exporter->ExportObjectsList = objects;
-            s6exporter->Export();
-            s6exporter->SaveGame(&replayData->parkData);
+            CaptureParkState(replayData->parkData, replayData->parkParams, replayData->cheatData, true);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
-            DataSerialiser parkParamsDs(true, replayData->parkParams);
-            SerialiseParkParameters(parkParamsDs);
-
-            DataSerialiser cheatDataDs(true, replayData->cheatData);
-            SerialiseCheats(cheatDataDs);
-
             TakeGameStateSnapshot(replayData->gameStateSnapshots);
 
             if (_mode != ReplayMode::NORMALISATION)
@@ -265,6 +295,7 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
 
             return true;
         }
@@ -437,7 +468,9 @@ namespace OpenRCT2
 
             _currentReplay = std::move(replayData);
             _currentReplay->checksumIndex = 0;
+            _currentReplay->nextCommand = _currentReplay->commands.begin();
             _faultyChecksumIndex = -1;
+            _firstMismatchTick.reset();
 
             // Make sure game is not paused.
             gGamePaused = 0;
@@ -457,6 +490,11 @@ namespace OpenRCT2
             return _faultyChecksumIndex != -1;
         }
 
+        virtual std::optional<uint32_t> GetFirstPlaybackMismatch() const override
+        {
+            return _firstMismatchTick;
+        }
+
         virtual bool StopPlayback() override
         {
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
@@ -482,6 +520,61 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool SeekPlayback(uint32_t replayTick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            auto& replay = *_currentReplay;
+
+            // Playback stops once it reaches the last tick, so the furthest it can go is the tick before
+            if (replay.tickEnd <= replay.tickStart)
+                return false;
+            const uint32_t targetTick = replay.tickStart + std::min(replayTick, replay.tickEnd - replay.tickStart - 1);
+
+            ReplayKeyframe* keyframe = nullptr;
+            for (auto& candidate : replay.keyframes)
+            {
+                if (candidate.tick <= targetTick)
+                    keyframe = &candidate;
+            }
+
+            // Going back always needs a reload, going forward only if a keyframe is closer than the current tick
+            const uint32_t startTick = keyframe != nullptr ? keyframe->tick : replay.tickStart;
+            if (targetTick < gCurrentTicks || startTick > gCurrentTicks)
+            {
+                bool loaded = keyframe != nullptr
+                    ? LoadParkState(keyframe->parkData, keyframe->parkParams, keyframe->cheatData)
+                    : LoadReplayDataMap(replay);
+                if (!loaded)
+                {
+                    log_error("Unable to load replay state at tick %u.", startTick);
+                    StopPlayback();
+                    return false;
+                }
+
+                gCurrentTicks = startTick;
+                gGamePaused = 0;
+
+                auto& commands = replay.commands;
+                replay.nextCommand = std::find_if(
+                    commands.begin(), commands.end(), [startTick](const auto& c) { return c.tick >= startTick; });
+                auto& checksums = replay.checksums;
+                auto checksum = std::find_if(
+                    checksums.begin(), checksums.end(), [startTick](const auto& c) { return c.first >= startTick; });
+                replay.checksumIndex = static_cast<uint32_t>(std::distance(checksums.begin(), checksum));
+                _faultyChecksumIndex = -1;
+                _firstMismatchTick.reset();
+            }
+
+            auto* gameState = GetContext()->GetGameState();
+            while (gCurrentTicks < targetTick && _mode == ReplayMode::PLAYING)
+            {
+                gameState->UpdateLogic();
+            }
+            return true;
+        }
+
         virtual bool NormaliseReplay(const std::string& file, const std::string& outFile) override
         {
             _mode = ReplayMode::NORMALISATION;
@@ -515,17 +608,50 @@ namespace OpenRCT2
             }
         }
 
+        void CaptureParkState(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData, bool packObjects)
+        {
+            auto s6exporter = std::make_unique<S6Exporter>();
+            if (packObjects)
+            {
+                auto& objManager = GetContext()->GetObjectManager();
+                s6exporter->ExportObjectsList = objManager.GetPackableObjects();
+            }
+            s6exporter->Export();
+            s6exporter->SaveGame(&parkData);
+
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            DataSerialiser cheatDataDs(true, cheatData);
+            SerialiseCheats(cheatDataDs);
+        }
+
+        void AddKeyframe()
+        {
+            // The objects are already packed into the park the recording started with, no need to repeat them
+            auto& keyframe = _currentRecording->keyframes.emplace_back();
+            keyframe.tick = gCurrentTicks;
+            CaptureParkState(keyframe.parkData, keyframe.parkParams, keyframe.cheatData, false);
+        }
+
         bool LoadReplayDataMap(ReplayRecordData& data)
+        {
+            return LoadParkState(data.parkData, data.parkParams, data.cheatData);
+        }
+
+        bool LoadParkState(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
+                parkParams.SetPosition(0);
+                cheatData.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateS6(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
 
                 importer->Import();
@@ -533,13 +659,13 @@ namespace OpenRCT2
                 sprite_position_tween_reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 // New cheats might not be serialised, make sure they are using their defaults.
                 CheatsReset();
 
-                DataSerialiser cheatDataDs(false, data.cheatData);
+                DataSerialiser cheatDataDs(false, cheatData);
                 SerialiseCheats(cheatDataDs);
 
                 game_load_init();
@@ -712,7 +838,8 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            // Version 4 is the same apart from the missing keyframes
+            return data.version == 4 || data.version == ReplayVersion;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -785,6 +912,25 @@ namespace OpenRCT2
             }
 
             serialiser << data.gameStateSnapshots;
+
+            if (data.version >= ReplayVersionKeyframes)
+            {
+                uint32_t countKeyframes = static_cast<uint32_t>(data.keyframes.size());
+                serialiser << countKeyframes;
+
+                if (serialiser.IsLoading())
+                {
+                    data.keyframes.resize(countKeyframes);
+                }
+
+                for (auto& keyframe : data.keyframes)
+                {
+                    serialiser << keyframe.tick;
+                    serialiser << keyframe.parkData;
+                    serialiser << keyframe.parkParams;
+                    serialiser << keyframe.cheatData;
+                }
+            }
             return true;
         }
 
@@ -810,6 +956,8 @@ namespace OpenRCT2
                         replayTick, savedChecksum.second.ToString().c_str(), checksum.ToString().c_str());
 
                     _faultyChecksumIndex = checksumIndex;
+                    if (!_firstMismatchTick)
+                        _firstMismatchTick = replayTick;
                 }
                 else
                 {
@@ -826,10 +974,11 @@ namespace OpenRCT2
         void ReplayCommands()
         {
             auto& replayQueue = _currentReplay->commands;
+            auto& nextCommand = _currentReplay->nextCommand;
 
-            while (replayQueue.begin() != replayQueue.end())
+            while (nextCommand != replayQueue.end())
             {
-                const ReplayCommand& command = (*replayQueue.begin());
+                const ReplayCommand& command = *nextCommand;
 
                 if (_mode == ReplayMode::PLAYING)
                 {
@@ -865,7 +1014,7 @@ namespace OpenRCT2
                         window_scroll_to_location(mainWindow, result->Position);
                 }
 
-                replayQueue.erase(replayQueue.begin());
+                ++nextCommand;
             }
         }
 
@@ -874,9 +1023,11 @@ namespace OpenRCT2
         std::unique_ptr<ReplayRecordData> _currentRecording;
         std::unique_ptr<ReplayRecordData> _currentReplay;
         int32_t _faultyChecksumIndex = -1;
+        std::optional<uint32_t> _firstMismatchTick; // Replay tick, kept after playback stops
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
         uint32_t _nextReplayTick = 0;
+        uint32_t _nextKeyframeTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
 
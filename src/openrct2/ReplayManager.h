@@ -12,6 +12,7 @@
 #include "common.h"
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 
@@ -60,9 +61,24 @@ namespace OpenRCT2
 
         virtual bool StartPlayback(const std::string& file) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
+
+        /**
+         * Returns the first tick of the last playback, counted from the start of the replay, at which the game state
+         * differed from the recording. Stays available after playback has stopped.
+         */
+        virtual std::optional<uint32_t> GetFirstPlaybackMismatch() const = 0;
         virtual bool StopPlayback() = 0;
 
+        /**
+         * Jumps to the given number of ticks after the start of the replay that is playing. Starts from the closest
+         * keyframe stored in the replay and runs the game until the tick is reached.
+         */
+        virtual bool SeekPlayback(uint32_t replayTick) = 0;
+
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
+
+        // Memory used by the replay being recorded and the replay being played back.
+        virtual size_t GetMemoryUsage() const = 0;
     };
 
     std::unique_ptr<IReplayManager> CreateReplayManager();
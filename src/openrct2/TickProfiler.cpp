@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TickProfiler.h"
+
+#include <algorithm>
+
+namespace OpenRCT2::TickProfiler
+{
+    static constexpr std::array<std::string_view, StageCount> StageNames = {
+        "replay",
+        "network",
+        "date",
+        "scenario",
+        "climate",
+        "map_tiles",
+        "map_path_wide_flags",
+        "peeps",
+        "vehicles",
+        "misc_sprites",
+        "rides",
+        "park",
+        "research",
+        "ride_ratings",
+        "ride_measurements",
+        "news",
+        "map_animations",
+        "sounds",
+        "editor",
+        "game_actions",
+        "network_flush",
+        "hooks",
+    };
+
+    static SampleBuffer _samples;
+    static TickSample _currentSample{};
+
+    static double GetSecondsSince(const std::chrono::high_resolution_clock::time_point& startTime)
+    {
+        return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+    }
+
+    template<typename TFn> static StageSummary Summarise(TFn getTime)
+    {
+        StageSummary summary{};
+        if (_samples.empty())
+            return summary;
+
+        for (size_t i = 0; i < _samples.size(); i++)
+        {
+            const double time = getTime(_samples[i]);
+            summary.Mean += time;
+            summary.Longest = std::max(summary.Longest, time);
+        }
+        summary.Mean /= _samples.size();
+        return summary;
+    }
+
+    ScopedTick::ScopedTick(uint32_t tick)
+        : _startTime(std::chrono::high_resolution_clock::now())
+    {
+        _span.emplace("tick", "tick");
+        _currentSample = {};
+        _currentSample.Tick = tick;
+    }
+
+    ScopedTick::~ScopedTick()
+    {
+        _currentSample.Total = GetSecondsSince(_startTime);
+        _samples.push_back(_currentSample);
+
+        // End the span first so the last traced tick is part of the trace
+        _span.reset();
+        Tracing::OnTickEnd();
+    }
+
+    ScopedStage::ScopedStage(Stage stage)
+        : _stage(stage)
+        , _startTime(std::chrono::high_resolution_clock::now())
+        , _span("tick", GetStageName(stage))
+    {
+    }
+
+    ScopedStage::~ScopedStage()
+    {
+        _currentSample.Time[static_cast<size_t>(_stage)] += GetSecondsSince(_startTime);
+    }
+
+    std::string_view GetStageName(Stage stage)
+    {
+        const auto index = static_cast<size_t>(stage);
+        if (index >= StageNames.size())
+            return {};
+        return StageNames[index];
+    }
+
+    const SampleBuffer& GetSamples()
+    {
+        return _samples;
+    }
+
+    StageSummary GetStageSummary(Stage stage)
+    {
+        const auto index = static_cast<size_t>(stage);
+        return Summarise([index](const TickSample& sample) { return sample.Time[index]; });
+    }
+
+    StageSummary GetTotalSummary()
+    {
+        return Summarise([](const TickSample& sample) { return sample.Total; });
+    }
+} // namespace OpenRCT2::TickProfiler
@@ -0,0 +1,115 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Tracing.h"
+#include "common.h"
+#include "core/CircularBuffer.h"
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+namespace OpenRCT2::TickProfiler
+{
+    /**
+     * The stages of GameState::UpdateLogic, in the order they run.
+     */
+    enum class Stage : uint8_t
+    {
+        Replay,
+        Network,
+        Date,
+        Scenario,
+        Climate,
+        MapTiles,
+        MapPathWideFlags,
+        Peeps,
+        Vehicles,
+        MiscSprites,
+        Rides,
+        Park,
+        Research,
+        RideRatings,
+        RideMeasurements,
+        News,
+        MapAnimations,
+        Sounds,
+        Editor,
+        GameActions,
+        NetworkFlush,
+        Hooks,
+        Count,
+    };
+
+    constexpr size_t StageCount = static_cast<size_t>(Stage::Count);
+    constexpr size_t MaxSamples = 256;
+
+    struct TickSample
+    {
+        uint32_t Tick;                       // Value of gCurrentTicks when the tick started
+        double Total;                        // Time spent in the whole tick, in seconds
+        std::array<double, StageCount> Time; // Time spent in each stage, in seconds
+    };
+
+    struct StageSummary
+    {
+        double Mean;    // Mean time per tick over the recorded ticks, in seconds
+        double Longest; // Longest time of a single recorded tick, in seconds
+    };
+
+    using SampleBuffer = CircularBuffer<TickSample, MaxSamples>;
+
+    /**
+     * Records the total time of a tick, the stages timed while it is alive are added to the same sample.
+     * The sample of the tick is pushed into the sample buffer once the scope ends.
+     * The tick and its stages are also recorded as trace spans while tracing is enabled.
+     */
+    class ScopedTick
+    {
+    private:
+        std::chrono::high_resolution_clock::time_point _startTime;
+        std::optional<Tracing::ScopedSpan> _span;
+
+    public:
+        explicit ScopedTick(uint32_t tick);
+        ~ScopedTick();
+
+        ScopedTick(const ScopedTick&) = delete;
+        ScopedTick& operator=(const ScopedTick&) = delete;
+    };
+
+    /**
+     * Adds the time from construction until the end of the scope to a stage of the current tick.
+     */
+    class ScopedStage
+    {
+    private:
+        Stage _stage;
+        std::chrono::high_resolution_clock::time_point _startTime;
+        Tracing::ScopedSpan _span;
+
+    public:
+        explicit ScopedStage(Stage stage);
+        ~ScopedStage();
+
+        ScopedStage(const ScopedStage&) = delete;
+        ScopedStage& operator=(const ScopedStage&) = delete;
+    };
+
+    std::string_view GetStageName(Stage stage);
+
+    // Returns the samples of the last recorded ticks, oldest first.
+    const SampleBuffer& GetSamples();
+
+    StageSummary GetStageSummary(Stage stage);
+    StageSummary GetTotalSummary();
+} // namespace OpenRCT2::TickProfiler
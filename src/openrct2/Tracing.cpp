@@ -0,0 +1,147 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Tracing.h"
+
+#include "Diagnostic.h"
+
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace OpenRCT2::Tracing
+{
+    struct TraceEvent
+    {
+        const char* Category;
+        std::string Name;
+        int64_t Start;    // Microseconds since recording started
+        int64_t Duration; // Microseconds
+        uint32_t ThreadId;
+    };
+
+    std::atomic_bool gTracingEnabled = { false };
+
+    static std::mutex _mutex;
+    static std::vector<TraceEvent> _events;
+    static std::string _path;
+    static uint32_t _remainingTicks;
+    static Clock::time_point _origin;
+    static std::atomic<uint32_t> _nextThreadId = { 0 };
+
+    static uint32_t GetThreadId()
+    {
+        // Small sequential ids read better in trace viewers than the native thread ids
+        static thread_local uint32_t threadId = _nextThreadId++;
+        return threadId;
+    }
+
+    static void WriteEscaped(FILE* fp, std::string_view text)
+    {
+        for (auto c : text)
+        {
+            if (c == '"' || c == '\\')
+                fputc('\\', fp);
+            if (static_cast<unsigned char>(c) >= 0x20)
+                fputc(c, fp);
+        }
+    }
+
+    static bool WriteTrace(const std::string& path, const std::vector<TraceEvent>& events)
+    {
+        FILE* fp = fopen(path.c_str(), "wt");
+        if (!fp)
+            return false;
+
+        fputs("{\"traceEvents\":[\n", fp);
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            const auto& ev = events[i];
+            fputs("{\"name\":\"", fp);
+            WriteEscaped(fp, ev.Name);
+            fprintf(
+                fp, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%u}%s\n", ev.Category,
+                static_cast<long long>(ev.Start), static_cast<long long>(ev.Duration), ev.ThreadId,
+                i + 1 < events.size() ? "," : "");
+        }
+        fputs("],\"displayTimeUnit\":\"ms\"}\n", fp);
+        fclose(fp);
+
+        return true;
+    }
+
+    void Start(const std::string& path, uint32_t numTicks)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _events.clear();
+        _path = path;
+        _remainingTicks = numTicks;
+        _origin = Clock::now();
+        gTracingEnabled = true;
+    }
+
+    void Stop()
+    {
+        std::vector<TraceEvent> events;
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!gTracingEnabled)
+                return;
+
+            gTracingEnabled = false;
+            events = std::move(_events);
+            path = std::move(_path);
+            _events.clear();
+        }
+
+        if (WriteTrace(path, events))
+        {
+            log_info("Wrote %u trace events to %s", static_cast<uint32_t>(events.size()), path.c_str());
+        }
+        else
+        {
+            log_error("Unable to write trace to %s", path.c_str());
+        }
+    }
+
+    void OnTickEnd()
+    {
+        if (!IsEnabled())
+            return;
+
+        bool finished;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_remainingTicks > 0)
+                _remainingTicks--;
+            finished = _remainingTicks == 0;
+        }
+        if (finished)
+        {
+            Stop();
+        }
+    }
+
+    void AddSpan(const char* category, std::string_view name, Clock::time_point startTime, Clock::time_point endTime)
+    {
+        const auto threadId = GetThreadId();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!gTracingEnabled)
+            return;
+
+        auto& ev = _events.emplace_back();
+        ev.Category = category;
+        ev.Name = std::string(name);
+        ev.Start = std::chrono::duration_cast<std::chrono::microseconds>(startTime - _origin).count();
+        ev.Duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+        ev.ThreadId = threadId;
+    }
+} // namespace OpenRCT2::Tracing
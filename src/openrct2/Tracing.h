@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <string_view>
+
+/**
+ * Records timestamped spans for a limited number of game ticks and writes them to a file in the Chrome trace event
+ * format, which can be opened in chrome://tracing, Perfetto and other trace viewers. Spans can be recorded from any
+ * thread. Recording is off unless started with --trace-out, in which case a span only costs a check of a flag.
+ */
+namespace OpenRCT2::Tracing
+{
+    using Clock = std::chrono::steady_clock;
+
+    extern std::atomic_bool gTracingEnabled;
+
+    inline bool IsEnabled()
+    {
+        return gTracingEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Starts recording, the trace is written to path once numTicks game ticks have completed or Stop is called.
+     */
+    void Start(const std::string& path, uint32_t numTicks);
+
+    // Writes what has been recorded so far and stops recording.
+    void Stop();
+
+    // Counts a completed game tick, stops recording once the requested number of ticks is reached.
+    void OnTickEnd();
+
+    void AddSpan(const char* category, std::string_view name, Clock::time_point startTime, Clock::time_point endTime);
+
+    /**
+     * Records a span from construction until the end of the scope. The name is copied when the span ends.
+     */
+    class ScopedSpan
+    {
+    private:
+        const char* _category;
+        std::string_view _name;
+        Clock::time_point _startTime;
+        bool _enabled;
+
+    public:
+        ScopedSpan(const char* category, std::string_view name)
+            : _category(category)
+            , _name(name)
+            , _enabled(IsEnabled())
+        {
+            if (_enabled)
+            {
+                _startTime = Clock::now();
+            }
+        }
+
+        ~ScopedSpan()
+        {
+            if (_enabled)
+            {
+                AddSpan(_category, _name, _startTime, Clock::now());
+            }
+        }
+
+        ScopedSpan(const ScopedSpan&) = delete;
+        ScopedSpan& operator=(const ScopedSpan&) = delete;
+    };
+} // namespace OpenRCT2::Tracing
@@ -20,12 +20,15 @@ DEFINE_GAME_ACTION(CustomAction, GAME_COMMAND_CUSTOM, GameActions::Result)
 private:
     std::string _id;
     std::string _json;
+    // Binary arguments of actions registered with a schema, _json is empty for these.
+    std::vector<uint8_t> _args;
 
 public:
     CustomAction() = default;
-    CustomAction(const std::string& id, const std::string& json)
+    CustomAction(const std::string& id, const std::string& json, std::vector<uint8_t> args = {})
         : _id(id)
         , _json(json)
+        , _args(std::move(args))
     {
     }
 
@@ -39,6 +42,11 @@ public:
         return _json;
     }
 
+    const std::vector<uint8_t>& GetArgs() const
+    {
+        return _args;
+    }
+
     uint16_t GetActionFlags() const override
     {
         return GameAction::GetActionFlags() | GameActions::Flags::AllowWhilePaused;
@@ -47,19 +55,19 @@ public:
     void Serialise(DataSerialiser & stream) override
     {
         GameAction::Serialise(stream);
-        stream << DS_TAG(_id) << DS_TAG(_json);
+        stream << DS_TAG(_id) << DS_TAG(_json) << DS_TAG(_args);
     }
 
     GameActions::Result::Ptr Query() const override
     {
         auto& scriptingEngine = OpenRCT2::GetContext()->GetScriptEngine();
-        return scriptingEngine.QueryOrExecuteCustomGameAction(_id, _json, false);
+        return scriptingEngine.QueryOrExecuteCustomGameAction(_id, _json, _args, false);
     }
 
     GameActions::Result::Ptr Execute() const override
     {
         auto& scriptingEngine = OpenRCT2::GetContext()->GetScriptEngine();
-        return scriptingEngine.QueryOrExecuteCustomGameAction(_id, _json, true);
+        return scriptingEngine.QueryOrExecuteCustomGameAction(_id, _json, _args, true);
     }
 };
 
@@ -11,12 +11,15 @@
 
 #include "../Context.h"
 #include "../ReplayManager.h"
+#include "../Tracing.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
 #include "../localisation/Localisation.h"
 #include "../network/network.h"
+#include "../peep/GuestPathfinding.h"
 #include "../platform/platform.h"
+#include "../ride/RideRatings.h"
 #include "../scenario/Scenario.h"
 #include "../scripting/Duktape.hpp"
 #include "../scripting/HookEngine.h"
@@ -27,6 +30,7 @@
 #include "../world/Scenery.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 
 using namespace OpenRCT2;
@@ -108,10 +112,19 @@ namespace GameActions
         }
     };
 
+    // Actions enqueued with EnqueueConcurrent, kept in a lock-free list until the main thread moves them into the queue.
+    struct PendingGameAction
+    {
+        QueuedGameAction queued;
+        PendingGameAction* next;
+    };
+
     static GameActionFactory _actions[GAME_COMMAND_COUNT];
     static std::multiset<QueuedGameAction> _actionQueue;
-    static uint32_t _nextUniqueId = 0;
+    static std::atomic<PendingGameAction*> _pendingActions{ nullptr };
+    static std::atomic<uint32_t> _nextUniqueId{ 0 };
     static bool _suspended = false;
+    static uint32_t _executedCount;
 
     GameActionFactory Register(uint32_t id, GameActionFactory factory)
     {
@@ -158,6 +171,32 @@ namespace GameActions
         _actionQueue.emplace(tick, std::move(ga), _nextUniqueId++);
     }
 
+    void EnqueueConcurrent(GameAction::Ptr&& ga, uint32_t tick)
+    {
+        auto pending = new PendingGameAction{ QueuedGameAction(tick, std::move(ga), _nextUniqueId++), nullptr };
+        pending->next = _pendingActions.load(std::memory_order_relaxed);
+        while (!_pendingActions.compare_exchange_weak(
+            pending->next, pending, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    static std::unique_ptr<PendingGameAction> TakePendingActions()
+    {
+        return std::unique_ptr<PendingGameAction>(_pendingActions.exchange(nullptr, std::memory_order_acquire));
+    }
+
+    static void FlushPendingActions()
+    {
+        // The queue orders by tick and unique id, so the order the pending actions are inserted in does not matter.
+        auto pending = TakePendingActions();
+        while (pending != nullptr)
+        {
+            _actionQueue.insert(std::move(pending->queued));
+            pending.reset(pending->next);
+        }
+    }
+
     void ProcessQueue()
     {
         if (_suspended)
@@ -166,6 +205,8 @@ namespace GameActions
             return;
         }
 
+        FlushPendingActions();
+
         const uint32_t currentTick = gCurrentTicks;
 
         while (_actionQueue.begin() != _actionQueue.end())
@@ -198,11 +239,14 @@ namespace GameActions
                 case GAME_COMMAND_PLACE_LARGE_SCENERY:
                 case GAME_COMMAND_PLACE_BANNER:
                 case GAME_COMMAND_PLACE_SCENERY:
+                case GAME_COMMAND_PLACE_SCENERY_BATCH:
                     scenery_remove_ghost_tool_placement();
                     break;
             }
 
-            GameAction* action = queued.action.get();
+            // Take the action out of the queue before it runs, anything it enqueues is then ordered after it.
+            auto node = _actionQueue.extract(_actionQueue.begin());
+            GameAction* action = node.value().action.get();
             action->SetFlags(action->GetFlags() | GAME_COMMAND_FLAG_NETWORKED);
 
             Guard::Assert(action != nullptr);
@@ -213,14 +257,18 @@ namespace GameActions
                 // Relay this action to all other clients.
                 network_send_game_action(action);
             }
-
-            _actionQueue.erase(_actionQueue.begin());
         }
     }
 
     void ClearQueue()
     {
         _actionQueue.clear();
+
+        auto pending = TakePendingActions();
+        while (pending != nullptr)
+        {
+            pending.reset(pending->next);
+        }
     }
 
     void Initialize()
@@ -381,6 +429,7 @@ namespace GameActions
     static GameActions::Result::Ptr ExecuteInternal(const GameAction* action, bool topLevel)
     {
         Guard::ArgumentNotNull(action);
+        OpenRCT2::Tracing::ScopedSpan traceSpan("game_action", action->GetName());
 
         uint16_t actionFlags = action->GetActionFlags();
         uint32_t flags = action->GetFlags();
@@ -404,11 +453,13 @@ namespace GameActions
 
         GameActions::Result::Ptr result = QueryInternal(action, topLevel);
 #ifdef ENABLE_SCRIPTING
+        // Built by the first hook that needs them, then shared by the query and execute hooks.
+        OpenRCT2::Scripting::GameActionHookArgs hookArgs;
         if (result->Error == GameActions::Status::Ok
             && ((network_get_mode() == NETWORK_MODE_NONE) || (flags & GAME_COMMAND_FLAG_NETWORKED)))
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
-            scriptEngine.RunGameActionHooks(*action, result, false);
+            scriptEngine.RunGameActionHooks(*action, result, false, hookArgs);
             // Script hooks may now have changed the game action result...
         }
 #endif
@@ -447,11 +498,18 @@ namespace GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+            if (result->Error == GameActions::Status::Ok)
+            {
+                // Most actions can change the footpath network or the surroundings of rides in one way or another
+                peep_pathfind_cache_invalidate();
+                ride_ratings_cache_invalidate();
+                _executedCount++;
+            }
 #ifdef ENABLE_SCRIPTING
             if (result->Error == GameActions::Status::Ok)
             {
                 auto& scriptEngine = GetContext()->GetScriptEngine();
-                scriptEngine.RunGameActionHooks(*action, result, true);
+                scriptEngine.RunGameActionHooks(*action, result, true, hookArgs);
                 // Script hooks may now have changed the game action result...
             }
 #endif
@@ -556,6 +614,11 @@ namespace GameActions
     {
         return ExecuteInternal(action, false);
     }
+
+    uint32_t GetExecutedCount()
+    {
+        return _executedCount;
+    }
 } // namespace GameActions
 
 bool GameAction::LocationValid(const CoordsXY& coords) const
@@ -565,7 +628,9 @@ bool GameAction::LocationValid(const CoordsXY& coords) const
         return false;
 #ifdef ENABLE_SCRIPTING
     auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
-    if (hookEngine.HasSubscriptions(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION))
+    OpenRCT2::Scripting::HookTarget hookTarget;
+    hookTarget.Location = coords;
+    if (hookEngine.HasSubscriptions(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION, hookTarget))
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
 
@@ -582,7 +647,7 @@ bool GameAction::LocationValid(const CoordsXY& coords) const
 
         // Call the subscriptions
         auto e = obj.Take();
-        hookEngine.Call(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION, e, true);
+        hookEngine.Call(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION, e, true, hookTarget);
 
         auto scriptResult = OpenRCT2::Scripting::AsOrDefault(e["result"], true);
 
@@ -12,6 +12,7 @@
 #include "../Game.h"
 #include "../common.h"
 #include "../core/DataSerialiser.h"
+#include "../core/FreeListPool.h"
 #include "../core/IStream.hpp"
 #include "../localisation/StringIds.h"
 #include "../world/Map.h"
@@ -138,6 +139,16 @@ namespace GameActions
         Result(const GameActions::Result&) = delete;
         virtual ~Result(){};
 
+        // Results are created for every query and execute, recycle their memory
+        static void* operator new(size_t size)
+        {
+            return FreeListPool::Allocate(size);
+        }
+        static void operator delete(void* ptr, size_t size) noexcept
+        {
+            FreeListPool::Free(ptr, size);
+        }
+
         std::string GetErrorTitle() const;
         std::string GetErrorMessage() const;
     };
@@ -227,6 +238,16 @@ public:
 
     virtual ~GameAction() = default;
 
+    // Actions are created for every ghost placement and every queued or received action, recycle their memory
+    static void* operator new(size_t size)
+    {
+        return FreeListPool::Allocate(size);
+    }
+    static void operator delete(void* ptr, size_t size) noexcept
+    {
+        FreeListPool::Free(ptr, size);
+    }
+
     virtual const char* GetName() const = 0;
 
     virtual void AcceptParameters(GameActionParameterVisitor&)
@@ -397,6 +418,11 @@ namespace GameActions
 
     void Enqueue(const GameAction* ga, uint32_t tick);
     void Enqueue(GameAction::Ptr&& ga, uint32_t tick);
+
+    // Thread safe and lock free, can be called from any thread such as the network I/O thread. The action must already
+    // have its player set, it is moved into the queue the next time ProcessQueue runs.
+    void EnqueueConcurrent(GameAction::Ptr&& ga, uint32_t tick);
+
     void ProcessQueue();
     void ClearQueue();
 
@@ -411,6 +437,10 @@ namespace GameActions
     GameActions::Result::Ptr QueryNested(const GameAction* action);
     GameActions::Result::Ptr ExecuteNested(const GameAction* action);
 
+    // Number of actions executed successfully so far, ghosts included. The map and the park only change through
+    // actions and the game tick, so results that do not depend on the tick stay valid while this stays the same.
+    uint32_t GetExecutedCount();
+
     GameActionFactory Register(uint32_t id, GameActionFactory action);
 
     template<typename T> static GameActionFactory Register()
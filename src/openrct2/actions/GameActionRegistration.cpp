@@ -67,6 +67,7 @@
 #include "SignSetNameAction.hpp"
 #include "SignSetStyleAction.hpp"
 #include "SmallSceneryPlaceAction.hpp"
+#include "SmallSceneryPlaceBatchAction.hpp"
 #include "SmallSceneryRemoveAction.hpp"
 #include "SmallScenerySetColourAction.hpp"
 #include "StaffFireAction.hpp"
@@ -147,6 +148,7 @@ namespace GameActions
         Register<WallRemoveAction>();
         Register<WallSetColourAction>();
         Register<SmallSceneryPlaceAction>();
+        Register<SmallSceneryPlaceBatchAction>();
         Register<SmallSceneryRemoveAction>();
         Register<SmallScenerySetColourAction>();
         Register<LargeSceneryPlaceAction>();
@@ -179,6 +179,7 @@ public:
             return MakeResult(GameActions::Status::InvalidParameters, STR_CANT_CHANGE_OPERATING_MODE);
         }
 
+        ride->Wake();
         switch (_setting)
         {
             case RideSetSetting::Mode:
@@ -136,6 +136,9 @@ public:
             return res;
         }
 
+        // A ride that is opened or tested has to be updated every tick again
+        ride->Wake();
+
         res->ErrorTitle = _StatusErrorTitles[_status];
 
         Formatter ft(res->ErrorMessageArgs.data());
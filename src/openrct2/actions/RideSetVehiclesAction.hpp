@@ -148,6 +148,7 @@ public:
             return std::make_unique<GameActions::Result>(GameActions::Status::InvalidParameters, errTitle);
         }
 
+        ride->Wake();
         switch (_type)
         {
             case RideSetVehicleType::NumTrains:
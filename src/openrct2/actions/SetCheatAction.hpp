@@ -392,35 +392,33 @@ private:
 
     void WaterPlants() const
     {
-        tile_element_iterator it;
-
-        tile_element_iterator_begin(&it);
-        do
-        {
-            if (it.element->GetType() == TILE_ELEMENT_TYPE_SMALL_SCENERY)
+        map_for_each_tile_parallel([](const TileElementSpan& span) {
+            for (auto& element : span)
             {
-                it.element->AsSmallScenery()->SetAge(0);
+                if (element.GetType() == TILE_ELEMENT_TYPE_SMALL_SCENERY)
+                {
+                    element.AsSmallScenery()->SetAge(0);
+                }
             }
-        } while (tile_element_iterator_next(&it));
+        });
 
         gfx_invalidate_screen();
     }
 
     void FixVandalism() const
     {
-        tile_element_iterator it;
-
-        tile_element_iterator_begin(&it);
-        do
-        {
-            if (it.element->GetType() != TILE_ELEMENT_TYPE_PATH)
-                continue;
+        map_for_each_tile_parallel([](const TileElementSpan& span) {
+            for (auto& element : span)
+            {
+                if (element.GetType() != TILE_ELEMENT_TYPE_PATH)
+                    continue;
 
-            if (!(it.element)->AsPath()->HasAddition())
-                continue;
+                if (!element.AsPath()->HasAddition())
+                    continue;
 
-            it.element->AsPath()->SetIsBroken(false);
-        } while (tile_element_iterator_next(&it));
+                element.AsPath()->SetIsBroken(false);
+            }
+        });
 
         gfx_invalidate_screen();
     }
@@ -432,23 +430,20 @@ private:
             sprite_remove(litter);
         }
 
-        tile_element_iterator it;
-        rct_scenery_entry* sceneryEntry;
-
-        tile_element_iterator_begin(&it);
-        do
-        {
-            if (it.element->GetType() != TILE_ELEMENT_TYPE_PATH)
-                continue;
-
-            if (!(it.element)->AsPath()->HasAddition())
-                continue;
+        map_for_each_tile_parallel([](const TileElementSpan& span) {
+            for (auto& element : span)
+            {
+                if (element.GetType() != TILE_ELEMENT_TYPE_PATH)
+                    continue;
 
-            sceneryEntry = it.element->AsPath()->GetAdditionEntry();
-            if (sceneryEntry->path_bit.flags & PATH_BIT_FLAG_IS_BIN)
-                it.element->AsPath()->SetAdditionStatus(0xFF);
+                if (!element.AsPath()->HasAddition())
+                    continue;
 
-        } while (tile_element_iterator_next(&it));
+                auto sceneryEntry = element.AsPath()->GetAdditionEntry();
+                if (sceneryEntry->path_bit.flags & PATH_BIT_FLAG_IS_BIN)
+                    element.AsPath()->SetAdditionStatus(0xFF);
+            }
+        });
 
         gfx_invalidate_screen();
     }
@@ -561,10 +556,7 @@ private:
     void GenerateGuests(int32_t count) const
     {
         auto& park = OpenRCT2::GetContext()->GetGameState()->GetPark();
-        for (int32_t i = 0; i < count; i++)
-        {
-            park.GenerateGuest();
-        }
+        park.GenerateGuests(count);
         window_invalidate_by_class(WC_BOTTOM_TOOLBAR);
     }
 
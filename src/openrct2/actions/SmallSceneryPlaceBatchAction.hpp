@@ -0,0 +1,124 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../localisation/StringIds.h"
+#include "../management/Finance.h"
+#include "../world/Location.hpp"
+#include "GameAction.h"
+#include "SmallSceneryPlaceAction.hpp"
+
+#include <vector>
+
+/**
+ * Places many items of the same small scenery in one action, as used by the scatter tool. The whole batch is sent as a
+ * single network message and the items that can not be placed are skipped, the batch only fails if none of them can be.
+ */
+DEFINE_GAME_ACTION(SmallSceneryPlaceBatchAction, GAME_COMMAND_PLACE_SCENERY_BATCH, GameActions::Result)
+{
+private:
+    std::vector<CoordsXYZD> _locations;
+    std::vector<uint8_t> _quadrants;
+    ObjectEntryIndex _sceneryType{};
+    uint8_t _primaryColour{};
+    uint8_t _secondaryColour{};
+
+public:
+    SmallSceneryPlaceBatchAction() = default;
+
+    SmallSceneryPlaceBatchAction(ObjectEntryIndex sceneryType, uint8_t primaryColour, uint8_t secondaryColour)
+        : _sceneryType(sceneryType)
+        , _primaryColour(primaryColour)
+        , _secondaryColour(secondaryColour)
+    {
+    }
+
+    void AddItem(const CoordsXYZD& loc, uint8_t quadrant)
+    {
+        _locations.push_back(loc);
+        _quadrants.push_back(quadrant);
+    }
+
+    size_t GetItemCount() const
+    {
+        return _locations.size();
+    }
+
+    uint32_t GetCooldownTime() const override
+    {
+        return 20;
+    }
+
+    uint16_t GetActionFlags() const override
+    {
+        return GameAction::GetActionFlags();
+    }
+
+    void Serialise(DataSerialiser & stream) override
+    {
+        GameAction::Serialise(stream);
+
+        stream << DS_TAG(_locations) << DS_TAG(_quadrants) << DS_TAG(_sceneryType) << DS_TAG(_primaryColour)
+               << DS_TAG(_secondaryColour);
+    }
+
+    GameActions::Result::Ptr Query() const override
+    {
+        return QueryExecute(false);
+    }
+
+    GameActions::Result::Ptr Execute() const override
+    {
+        return QueryExecute(true);
+    }
+
+private:
+    GameActions::Result::Ptr QueryExecute(bool executing) const
+    {
+        if (_locations.empty() || _locations.size() != _quadrants.size())
+        {
+            return MakeResult(GameActions::Status::InvalidParameters, STR_CANT_POSITION_THIS_HERE, STR_NONE);
+        }
+
+        auto res = MakeResult();
+        res->ErrorTitle = STR_CANT_POSITION_THIS_HERE;
+        res->Expenditure = ExpenditureType::Landscaping;
+
+        GameActions::Result::Ptr firstError;
+        bool anyPlaced = false;
+        for (size_t i = 0; i < _locations.size(); i++)
+        {
+            auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
+                _locations[i], _quadrants[i], _sceneryType, _primaryColour, _secondaryColour);
+            smallSceneryPlaceAction.SetFlags(GetFlags());
+            auto result = executing ? GameActions::ExecuteNested(&smallSceneryPlaceAction)
+                                    : GameActions::QueryNested(&smallSceneryPlaceAction);
+            if (result->Error != GameActions::Status::Ok)
+            {
+                if (firstError == nullptr)
+                    firstError = std::move(result);
+                continue;
+            }
+
+            if (!anyPlaced)
+            {
+                res->Position = result->Position;
+                anyPlaced = true;
+            }
+            res->Cost += result->Cost;
+        }
+
+        if (!anyPlaced)
+        {
+            return firstError;
+        }
+        return res;
+    }
+};
@@ -24,6 +24,7 @@
 #include "../ui/WindowManager.h"
 #include "../world/Entrance.h"
 #include "../world/Park.h"
+#include "../windows/Intent.h"
 #include "../world/Sprite.h"
 #include "GameAction.h"
 
@@ -206,7 +207,7 @@ private:
             {
                 spriteType = EntertainerCostumeToSprite(_entertainerType);
             }
-            newPeep->Name = nullptr;
+            newPeep->NameStorage = nullptr;
             newPeep->SpriteType = spriteType;
 
             const rct_sprite_bounds* spriteBounds = &GetSpriteBounds(spriteType);
@@ -244,14 +245,13 @@ private:
 
             newPeep->StaffId = staffIndex;
 
-            gStaffModes[staffIndex] = StaffMode::Walk;
-
-            for (int32_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
-            {
-                gStaffPatrolAreas[staffIndex * STAFF_PATROL_AREA_SIZE + i] = 0;
-            }
+            staff_set_mode(staffIndex, StaffMode::Walk);
+            staff_clear_patrol_area(staffIndex);
 
             res->peepSriteIndex = newPeep->sprite_index;
+
+            auto intent = Intent(INTENT_ACTION_REFRESH_STAFF_LIST);
+            context_broadcast_intent(&intent);
         }
 
         return res;
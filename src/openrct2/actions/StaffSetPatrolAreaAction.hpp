@@ -88,11 +88,11 @@ public:
 
         if (isPatrolling)
         {
-            gStaffModes[staff->StaffId] = StaffMode::Patrol;
+            staff_set_mode(staff->StaffId, StaffMode::Patrol);
         }
         else if (gStaffModes[staff->StaffId] == StaffMode::Patrol)
         {
-            gStaffModes[staff->StaffId] = StaffMode::Walk;
+            staff_set_mode(staff->StaffId, StaffMode::Walk);
         }
 
         for (int32_t y = 0; y < 4 * COORDS_XY_STEP; y += COORDS_XY_STEP)
@@ -0,0 +1,233 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../TickProfiler.h"
+#include "../core/Console.hpp"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../network/network.h"
+#include "../peep/Peep.h"
+#include "../platform/platform.h"
+#include "../world/Sprite.h"
+#include "CommandLine.hpp"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static uint32_t _ticks = 0;
+static uint32_t _warmupTicks = 0;
+static utf8* _outputPath = nullptr;
+static utf8* _baselinePath = nullptr;
+static float _tolerance = 0;
+
+static constexpr uint32_t DefaultTicks = 10000;
+static constexpr uint32_t DefaultWarmupTicks = 1000;
+static constexpr float DefaultTolerance = 5;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BenchSimulateOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_ticks,        NAC, "ticks",     "number of ticks to measure for each park (default 10000)"              },
+    { CMDLINE_TYPE_INTEGER, &_warmupTicks,  NAC, "warmup",    "number of ticks to run before measuring (default 1000)"                },
+    { CMDLINE_TYPE_STRING,  &_outputPath,   NAC, "output",    "write the results as JSON to the given file instead of stdout"         },
+    { CMDLINE_TYPE_STRING,  &_baselinePath, NAC, "baseline",  "compare the results against a JSON file written by an earlier run"     },
+    { CMDLINE_TYPE_REAL,    &_tolerance,    NAC, "tolerance", "slowdown in percent allowed before a park counts as a regression (default 5)" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchSimulate(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchSimulateCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> [<file> ...]", BenchSimulateOptions, HandleBenchSimulate),
+    CommandTableEnd
+};
+// clang-format on
+
+static json_t BenchmarkPark(IContext& context, const char* path, uint32_t warmupTicks, uint32_t ticks)
+{
+    if (!context.LoadParkFromFile(path))
+    {
+        throw std::runtime_error(std::string("Unable to load ") + path);
+    }
+
+    auto gameState = context.GetGameState();
+    for (uint32_t i = 0; i < warmupTicks; i++)
+    {
+        gameState->UpdateLogic();
+    }
+
+    // The profiler only keeps the last few ticks, so the stage times are summed up after every tick
+    std::array<double, TickProfiler::StageCount> stageTimes{};
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        gameState->UpdateLogic();
+
+        const auto& samples = TickProfiler::GetSamples();
+        if (!samples.empty())
+        {
+            const auto& sample = samples.back();
+            for (size_t j = 0; j < stageTimes.size(); j++)
+            {
+                stageTimes[j] += sample.Time[j];
+            }
+        }
+    }
+    auto totalTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    json_t stages = json_t::object();
+    for (size_t i = 0; i < stageTimes.size(); i++)
+    {
+        const auto name = std::string(TickProfiler::GetStageName(static_cast<TickProfiler::Stage>(i)));
+        stages[name] = ticks != 0 ? stageTimes[i] * 1000 / ticks : 0;
+    }
+
+    json_t result = {
+        { "park", Path::GetFileName(path) },
+        { "ticks_per_second", totalTime > 0 ? ticks / totalTime : 0 },
+        { "total_ms", totalTime * 1000 },
+        { "entities", MAX_SPRITES - GetEntityListCount(EntityListId::Free) },
+        { "guests", gNumGuestsInPark },
+        { "checksum", sprite_checksum().ToString() },
+        { "stage_ms_per_tick", stages },
+    };
+    return result;
+}
+
+/**
+ * Prints how each park compares to the baseline, returns false if any park got slower than the tolerance allows.
+ */
+static bool CompareWithBaseline(const json_t& results, const json_t& baseline, float tolerance)
+{
+    bool passed = true;
+    for (const auto& park : results["parks"])
+    {
+        const auto name = park["park"].get<std::string>();
+        const json_t* baselinePark = nullptr;
+        for (const auto& candidate : baseline["parks"])
+        {
+            if (candidate.is_object() && candidate.value("park", "") == name)
+            {
+                baselinePark = &candidate;
+                break;
+            }
+        }
+        if (baselinePark == nullptr)
+        {
+            Console::WriteLine("%s: not in baseline", name.c_str());
+            continue;
+        }
+
+        const double current = park["ticks_per_second"].get<double>();
+        const double previous = baselinePark->value("ticks_per_second", 0.0);
+        const double change = previous > 0 ? (current - previous) * 100 / previous : 0;
+        const bool regressed = change < -tolerance;
+        Console::WriteLine(
+            "%s: %.1f ticks/s, baseline %.1f ticks/s (%+.1f%%)%s", name.c_str(), current, previous, change,
+            regressed ? " REGRESSION" : "");
+
+        if (baselinePark->value("checksum", "") != park["checksum"].get<std::string>())
+        {
+            Console::WriteLine("%s: checksum differs from baseline, the simulation has changed", name.c_str());
+        }
+        passed &= !regressed;
+    }
+    return passed;
+}
+
+static exitcode_t HandleBenchSimulate(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing arguments <file> [<file> ...].");
+        return EXITCODE_FAIL;
+    }
+
+    const uint32_t ticks = _ticks != 0 ? _ticks : DefaultTicks;
+    const uint32_t warmupTicks = _warmupTicks != 0 ? _warmupTicks : DefaultWarmupTicks;
+    const float tolerance = _tolerance != 0 ? _tolerance : DefaultTolerance;
+    const std::string outputPath = _outputPath != nullptr ? _outputPath : "";
+    const std::string baselinePath = _baselinePath != nullptr ? _baselinePath : "";
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+#ifndef DISABLE_NETWORK
+    gNetworkStart = NETWORK_MODE_SERVER;
+#endif
+
+    json_t results = {
+        { "ticks", ticks },
+        { "warmup", warmupTicks },
+        { "parks", json_t::array() },
+    };
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    try
+    {
+        for (int32_t i = 0; i < argc; i++)
+        {
+            Console::Error::WriteLine("Benchmarking %s...", argv[i]);
+            results["parks"].push_back(BenchmarkPark(*context, argv[i], warmupTicks, ticks));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("%s", e.what());
+        return EXITCODE_FAIL;
+    }
+
+    if (outputPath.empty())
+    {
+        Console::WriteLine("%s", results.dump(4).c_str());
+    }
+    else
+    {
+        Json::WriteToFile(outputPath.c_str(), results);
+    }
+
+    if (!baselinePath.empty())
+    {
+        try
+        {
+            auto baseline = Json::ReadFromFile(baselinePath.c_str());
+            if (!CompareWithBaseline(results, baseline, tolerance))
+            {
+                return EXITCODE_FAIL;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read baseline %s: %s", baselinePath.c_str(), e.what());
+            return EXITCODE_FAIL;
+        }
+    }
+
+    return EXITCODE_OK;
+}
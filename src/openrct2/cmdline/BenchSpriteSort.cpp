@@ -32,44 +32,33 @@
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
+#    include <string>
 #    include <vector>
 
-static void fixup_pointers(paint_session* s, size_t paint_session_entries, size_t paint_struct_entries, size_t quadrant_entries)
+static void fixup_pointers(std::vector<RecordedPaintSession>& s)
 {
-    for (size_t i = 0; i < paint_session_entries; i++)
+    for (auto& record : s)
     {
-        for (size_t j = 0; j < paint_struct_entries; j++)
+        const size_t nullIndex = record.Entries.size();
+        for (auto& entry : record.Entries)
         {
-            if (s[i].PaintStructs[j].basic.next_quadrant_ps == reinterpret_cast<paint_struct*>(paint_struct_entries))
-            {
-                s[i].PaintStructs[j].basic.next_quadrant_ps = nullptr;
-            }
-            else
-            {
-                auto nextQuadrantPs = reinterpret_cast<uintptr_t>(s[i].PaintStructs[j].basic.next_quadrant_ps);
-                s[i].PaintStructs[j].basic.next_quadrant_ps = &s[i].PaintStructs[nextQuadrantPs].basic;
-            }
+            auto nextQuadrantPs = reinterpret_cast<size_t>(entry.basic.next_quadrant_ps);
+            entry.basic.next_quadrant_ps = nextQuadrantPs == nullIndex ? nullptr : &record.Entries[nextQuadrantPs].basic;
         }
-        for (size_t j = 0; j < quadrant_entries; j++)
+        for (auto& quad : record.Session.Quadrants)
         {
-            if (s[i].Quadrants[j] == reinterpret_cast<paint_struct*>(quadrant_entries))
-            {
-                s[i].Quadrants[j] = nullptr;
-            }
-            else
-            {
-                s[i].Quadrants[j] = &s[i].PaintStructs[reinterpret_cast<size_t>(s[i].Quadrants[j])].basic;
-            }
+            auto quadIndex = reinterpret_cast<size_t>(quad);
+            quad = quadIndex == nullIndex ? nullptr : &record.Entries[quadIndex].basic;
         }
     }
 }
 
-static std::vector<paint_session> extract_paint_session(const std::string parkFileName)
+static std::vector<RecordedPaintSession> extract_paint_session(const std::string parkFileName)
 {
     core_init();
     gOpenRCT2Headless = true;
     auto context = OpenRCT2::CreateContext();
-    std::vector<paint_session> sessions;
+    std::vector<RecordedPaintSession> sessions;
     log_info("Starting...");
     if (context->Initialise())
     {
@@ -132,42 +121,77 @@ static std::vector<paint_session> extract_paint_session(const std::string parkFi
     return sessions;
 }
 
+/**
+ * Arranges every session with both engines and checks that they draw the paint structs in the same order.
+ */
+static bool verify_paint_arrange_engines(const std::vector<RecordedPaintSession>& inputSessions)
+{
+    for (size_t i = 0; i < std::size(inputSessions); i++)
+    {
+        std::vector<RecordedPaintSession> linked = { inputSessions[i] };
+        std::vector<RecordedPaintSession> flat = { inputSessions[i] };
+        fixup_pointers(linked);
+        fixup_pointers(flat);
+        PaintSessionArrange(&linked[0].Session, PaintArrangeEngine::Linked);
+        PaintSessionArrange(&flat[0].Session, PaintArrangeEngine::Flat);
+
+        const paint_struct* linkedPS = linked[0].Session.PaintHead.next_quadrant_ps;
+        const paint_struct* flatPS = flat[0].Session.PaintHead.next_quadrant_ps;
+        while (linkedPS != nullptr && flatPS != nullptr)
+        {
+            auto linkedIndex = reinterpret_cast<const paint_entry*>(linkedPS) - linked[0].Entries.data();
+            auto flatIndex = reinterpret_cast<const paint_entry*>(flatPS) - flat[0].Entries.data();
+            if (linkedIndex != flatIndex)
+                break;
+            linkedPS = linkedPS->next_quadrant_ps;
+            flatPS = flatPS->next_quadrant_ps;
+        }
+        if (linkedPS != nullptr || flatPS != nullptr)
+        {
+            log_error("Paint arrange engines disagree on session %u.", i);
+            return false;
+        }
+    }
+    return true;
+}
+
 // This function is based on benchgfx_render_screenshots
-static void BM_paint_session_arrange(benchmark::State& state, const std::vector<paint_session> inputSessions)
+static void BM_paint_session_arrange(
+    benchmark::State& state, PaintArrangeEngine engine, const std::vector<RecordedPaintSession> inputSessions)
 {
-    std::vector<paint_session> sessions = inputSessions;
+    std::vector<RecordedPaintSession> sessions = inputSessions;
     // Fixing up the pointers continuously is wasteful. Fix it up once for `sessions` and store a copy.
     // Keep in mind we need bit-exact copy, as the lists use pointers.
-    // Once sorted, just restore the copy with the original fixed-up version.
-    paint_session* local_s = new paint_session[std::size(sessions)];
-    fixup_pointers(&sessions[0], std::size(sessions), std::size(local_s->PaintStructs), std::size(local_s->Quadrants));
-    std::copy_n(sessions.cbegin(), std::size(sessions), local_s);
+    // Once sorted, just restore the copy with the original fixed-up version. The entries are copied into the existing
+    // storage of `sessions` so the fixed-up pointers stay valid.
+    fixup_pointers(sessions);
+    std::vector<RecordedPaintSession> local_s = sessions;
     for (auto _ : state)
     {
         state.PauseTiming();
-        std::copy_n(local_s, std::size(sessions), sessions.begin());
+        for (size_t i = 0; i < std::size(sessions); i++)
+        {
+            sessions[i].Session = local_s[i].Session;
+            std::copy(local_s[i].Entries.cbegin(), local_s[i].Entries.cend(), sessions[i].Entries.begin());
+        }
         state.ResumeTiming();
-        PaintSessionArrange(&sessions[0]);
+        PaintSessionArrange(&sessions[0].Session, engine);
         benchmark::DoNotOptimize(sessions);
     }
     state.SetItemsProcessed(state.iterations() * std::size(sessions));
-    delete[] local_s;
 }
 
 static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
 {
     {
         // Register some basic "baseline" benchmark
-        std::vector<paint_session> sessions(1);
-        for (auto& ps : sessions[0].PaintStructs)
-        {
-            ps.basic.next_quadrant_ps = reinterpret_cast<paint_struct*>((std::size(sessions[0].PaintStructs)));
-        }
-        for (auto& quad : sessions[0].Quadrants)
+        std::vector<RecordedPaintSession> sessions(1);
+        for (auto& quad : sessions[0].Session.Quadrants)
         {
-            quad = reinterpret_cast<paint_struct*>((std::size(sessions[0].Quadrants)));
+            quad = reinterpret_cast<paint_struct*>(std::size(sessions[0].Entries));
         }
-        benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions);
+        benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, PaintArrangeEngine::Linked, sessions);
+        benchmark::RegisterBenchmark("baseline/flat", BM_paint_session_arrange, PaintArrangeEngine::Flat, sessions);
     }
 
     // Google benchmark does stuff to argv. It doesn't modify the pointees,
@@ -183,9 +207,17 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
         if (Platform::FileExists(argv[i]))
         {
             // Register benchmark for sv6 if valid
-            std::vector<paint_session> sessions = extract_paint_session(argv[i]);
+            std::vector<RecordedPaintSession> sessions = extract_paint_session(argv[i]);
             if (!sessions.empty())
-                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions);
+            {
+                if (!verify_paint_arrange_engines(sessions))
+                    return -1;
+
+                std::string flatName = std::string(argv[i]) + "/flat";
+                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, PaintArrangeEngine::Linked, sessions);
+                benchmark::RegisterBenchmark(
+                    flatName.c_str(), BM_paint_session_arrange, PaintArrangeEngine::Flat, sessions);
+            }
         }
         else
         {
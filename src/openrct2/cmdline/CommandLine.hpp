@@ -118,7 +118,10 @@ namespace CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
+    extern const CommandLineCommand BenchSimulateCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand VerifyReplaysCommands[];
+    extern const CommandLineCommand ParkCommands[];
 
     extern const CommandLineExample RootExamples[];
 
@@ -18,7 +18,10 @@
 #include "CommandLine.hpp"
 
 #include <memory>
+#include <string>
+#include <vector>
 
+static exitcode_t ConvertPark(const std::string& sourcePath, const std::string& destinationPath);
 static void WriteConvertFromAndToMessage(uint32_t sourceFileType, uint32_t destinationFileType);
 static const utf8* GetFileTypeFriendlyName(uint32_t fileType);
 
@@ -30,29 +33,58 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
         return result;
     }
 
-    // Get the source path
-    const utf8* rawSourcePath;
-    if (!enumerator->TryPopString(&rawSourcePath))
+    // Get the source paths followed by the destination path
+    std::vector<std::string> paths;
+    const utf8* rawPath;
+    while (enumerator->TryPopString(&rawPath))
+    {
+        paths.push_back(Path::GetAbsolute(rawPath));
+    }
+    if (paths.empty())
     {
         Console::Error::WriteLine("Expected a source path.");
         return EXITCODE_FAIL;
     }
+    if (paths.size() == 1)
+    {
+        Console::Error::WriteLine("Expected a destination path.");
+        return EXITCODE_FAIL;
+    }
 
-    utf8 sourcePath[MAX_PATH];
-    Path::GetAbsolute(sourcePath, sizeof(sourcePath), rawSourcePath);
-    uint32_t sourceFileType = get_file_extension_type(sourcePath);
+    auto destinationPath = paths.back();
+    paths.pop_back();
+    if (paths.size() == 1)
+    {
+        return ConvertPark(paths[0], destinationPath);
+    }
 
-    // Get the destination path
-    const utf8* rawDestinationPath;
-    if (!enumerator->TryPopString(&rawDestinationPath))
+    // Many parks are converted into a directory, one after another so that the objects only need to be scanned once
+    if (!Path::DirectoryExists(destinationPath))
     {
-        Console::Error::WriteLine("Expected a destination path.");
+        Console::Error::WriteLine("Expected the destination to be a directory when converting multiple parks.");
         return EXITCODE_FAIL;
     }
 
-    utf8 destinationPath[MAX_PATH];
-    Path::GetAbsolute(destinationPath, sizeof(sourcePath), rawDestinationPath);
-    uint32_t destinationFileType = get_file_extension_type(destinationPath);
+    result = EXITCODE_OK;
+    for (const auto& sourcePath : paths)
+    {
+        auto sourceFileType = get_file_extension_type(sourcePath.c_str());
+        bool isScenario = sourceFileType == FILE_EXTENSION_SC4 || sourceFileType == FILE_EXTENSION_SC6;
+        auto destinationFileName = Path::GetFileNameWithoutExtension(sourcePath) + (isScenario ? ".sc6" : ".sv6");
+
+        Console::WriteLine("%s", sourcePath.c_str());
+        if (ConvertPark(sourcePath, Path::Combine(destinationPath, destinationFileName)) != EXITCODE_OK)
+        {
+            result = EXITCODE_FAIL;
+        }
+    }
+    return result;
+}
+
+static exitcode_t ConvertPark(const std::string& sourcePath, const std::string& destinationPath)
+{
+    uint32_t sourceFileType = get_file_extension_type(sourcePath.c_str());
+    uint32_t destinationFileType = get_file_extension_type(destinationPath.c_str());
 
     // Validate target type
     if (destinationFileType != FILE_EXTENSION_SC6 && destinationFileType != FILE_EXTENSION_SV6)
@@ -94,7 +126,7 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     try
     {
         auto importer = ParkImporter::Create(sourcePath);
-        importer->Load(sourcePath);
+        importer->Load(sourcePath.c_str());
         importer->Import();
     }
     catch (const std::exception& ex)
@@ -120,11 +152,11 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
         exporter->Export();
         if (destinationFileType == FILE_EXTENSION_SC6)
         {
-            exporter->SaveScenario(destinationPath);
+            exporter->SaveScenario(destinationPath.c_str());
         }
         else
         {
-            exporter->SaveGame(destinationPath);
+            exporter->SaveGame(destinationPath.c_str());
         }
     }
     catch (const std::exception& ex)
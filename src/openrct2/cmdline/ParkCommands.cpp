@@ -0,0 +1,111 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../ParkInspector.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/Json.hpp"
+#include "../core/String.hpp"
+#include "CommandLine.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static const char* _format = nullptr;
+static const char* _outputPath = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition ParkInspectOptions[]
+{
+    { CMDLINE_TYPE_STRING, &_format,     NAC, "format", "output format, json (default) or csv" },
+    { CMDLINE_TYPE_STRING, &_outputPath, NAC, "output", "file to write to instead of standard output" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleParkInspect(CommandLineArgEnumerator *argEnumerator);
+
+const CommandLineCommand CommandLine::ParkCommands[]
+{
+    // Main commands
+    DefineCommand("inspect", "<file>...", ParkInspectOptions, HandleParkInspect),
+    CommandTableEnd
+};
+// clang-format on
+
+static exitcode_t HandleParkInspect(CommandLineArgEnumerator* argEnumerator)
+{
+    bool csv = false;
+    if (_format != nullptr)
+    {
+        csv = String::Equals(_format, "csv", true);
+        if (!csv && !String::Equals(_format, "json", true))
+        {
+            Console::Error::WriteLine("Unknown format '%s', expected json or csv.", _format);
+            return EXITCODE_FAIL;
+        }
+    }
+
+    // Options follow the paths
+    std::vector<std::string> paths;
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument) && argument[0] != '-')
+    {
+        paths.push_back(argument);
+    }
+    if (paths.empty())
+    {
+        Console::Error::WriteLine("Expected at least one park file.");
+        return EXITCODE_FAIL;
+    }
+
+    auto parks = ParkInspector::Inspect(paths);
+
+    std::string output;
+    if (csv)
+    {
+        output = ParkInspector::ToCsv(parks);
+    }
+    else
+    {
+        json_t result = json_t::array();
+        for (const auto& park : parks)
+        {
+            result.push_back(ParkInspector::ToJson(park));
+        }
+        output = result.dump(4) + "\n";
+    }
+
+    if (_outputPath != nullptr)
+    {
+        try
+        {
+            File::WriteAllBytes(_outputPath, output.data(), output.size());
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to write %s: %s", _outputPath, e.what());
+            return EXITCODE_FAIL;
+        }
+    }
+    else
+    {
+        Console::Write(output.c_str());
+    }
+
+    for (const auto& park : parks)
+    {
+        if (!park.Error.empty())
+        {
+            return EXITCODE_FAIL;
+        }
+    }
+    return EXITCODE_OK;
+}
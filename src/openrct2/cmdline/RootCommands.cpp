@@ -10,6 +10,7 @@
 #include "../Context.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
+#include "../Tracing.h"
 #include "../Version.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
@@ -40,8 +41,13 @@ int32_t gNetworkStart = NETWORK_MODE_NONE;
 std::string gNetworkStartHost;
 int32_t gNetworkStartPort = NETWORK_DEFAULT_PORT;
 std::string gNetworkStartAddress;
+int32_t gNetworkRelayPort = 0;
+int32_t gNetworkStandbyPort = 0;
+std::vector<std::string> gNetworkAdditionalParks;
 
 static uint32_t _port = 0;
+static uint32_t _relayPort = 0;
+static uint32_t _standbyPort = 0;
 static char* _address = nullptr;
 #endif
 
@@ -58,6 +64,10 @@ static utf8* _openrct2DataPath = nullptr;
 static utf8* _rct1DataPath = nullptr;
 static utf8* _rct2DataPath = nullptr;
 static bool _silentBreakpad = false;
+static utf8* _traceOut = nullptr;
+static uint32_t _traceTicks = 0;
+
+static constexpr uint32_t DefaultTraceTicks = 1000;
 
 // clang-format off
 static constexpr const CommandLineOptionDefinition StandardOptions[]
@@ -72,12 +82,16 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
 #ifndef DISABLE_NETWORK                                                    
     { CMDLINE_TYPE_INTEGER, &_port,             NAC, "port",               "port to use for hosting or joining a server"                },
     { CMDLINE_TYPE_STRING,  &_address,          NAC, "address",            "address to listen on when hosting a server"                 },
+    { CMDLINE_TYPE_INTEGER, &_relayPort,        NAC, "relay-port",         "port spectators connect to when relaying a server"          },
+    { CMDLINE_TYPE_INTEGER, &_standbyPort,      NAC, "standby-port",       "port to serve on once a standby takes over"                  },
 #endif                                                                     
     { CMDLINE_TYPE_STRING,  &_password,         NAC, "password",           "password needed to join the server"                         },
     { CMDLINE_TYPE_STRING,  &_userDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)"    },
     { CMDLINE_TYPE_STRING,  &_openrct2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
     { CMDLINE_TYPE_STRING,  &_rct2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_STRING,  &_traceOut,         NAC, "trace-out",          "write a Chrome trace of the first ticks to the given file"  },
+    { CMDLINE_TYPE_INTEGER, &_traceTicks,       NAC, "trace-ticks",        "number of ticks to trace with --trace-out (default 1000)"   },
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
@@ -90,6 +104,8 @@ static exitcode_t HandleCommandIntro(CommandLineArgEnumerator * enumerator);
 #ifndef DISABLE_NETWORK
 static exitcode_t HandleCommandHost(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandJoin(CommandLineArgEnumerator * enumerator);
+static exitcode_t HandleCommandRelay(CommandLineArgEnumerator * enumerator);
+static exitcode_t HandleCommandStandby(CommandLineArgEnumerator * enumerator);
 #endif
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandScanObjects(CommandLineArgEnumerator * enumerator);
@@ -123,11 +139,13 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
     DefineCommand("intro",    "",                       StandardOptions, HandleCommandIntro  ),
 #ifndef DISABLE_NETWORK
-    DefineCommand("host",     "<uri>",                  StandardOptions, HandleCommandHost   ),
+    DefineCommand("host",     "<uri>...",               StandardOptions, HandleCommandHost   ),
     DefineCommand("join",     "<hostname>",             StandardOptions, HandleCommandJoin   ),
+    DefineCommand("relay",    "<hostname>",             StandardOptions, HandleCommandRelay  ),
+    DefineCommand("standby",  "<hostname>",             StandardOptions, HandleCommandStandby),
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
-    DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
+    DefineCommand("convert",  "<source>... <destination>", StandardOptions, CommandLine::HandleCommandConvert),
     DefineCommand("scan-objects", "<path>",             StandardOptions, HandleCommandScanObjects),
     DefineCommand("handle-uri", "openrct2://.../",      StandardOptions, CommandLine::HandleCommandUri),
 
@@ -140,7 +158,10 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
+    DefineSubCommand("benchsimulate",   CommandLine::BenchSimulateCommands    ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("verifyreplays",   CommandLine::VerifyReplaysCommands    ),
+    DefineSubCommand("park",            CommandLine::ParkCommands             ),
     CommandTableEnd
 };
 
@@ -154,6 +175,7 @@ const CommandLineExample CommandLine::RootExamples[]
 #endif
 #ifndef DISABLE_NETWORK
     { "host ./my_park.sv6 --port 11753 --headless",   "run a headless server for a saved park" },
+    { "host ./a.sv6 ./b.sv6 --port 11753 --headless", "run servers for two parks on ports 11753 and 11754" },
 #endif
     ExampleTableEnd
 };
@@ -230,6 +252,12 @@ exitcode_t CommandLine::HandleCommandDefault()
         Memory::Free(_password);
     }
 
+    if (_traceOut != nullptr)
+    {
+        OpenRCT2::Tracing::Start(_traceOut, _traceTicks != 0 ? _traceTicks : DefaultTraceTicks);
+        Memory::Free(_traceOut);
+    }
+
     return result;
 }
 
@@ -303,6 +331,20 @@ exitcode_t HandleCommandHost(CommandLineArgEnumerator* enumerator)
     gOpenRCT2StartupAction = StartupAction::Open;
     String::Set(gOpenRCT2StartupActionPath, sizeof(gOpenRCT2StartupActionPath), parkUri);
 
+    // Any further parks are hosted by copies of this process on the following ports, options follow the parks
+    const char* additionalParkUri;
+    while (enumerator->TryPopString(&additionalParkUri) && additionalParkUri[0] != '-')
+    {
+        gNetworkAdditionalParks.push_back(additionalParkUri);
+    }
+#ifdef _WIN32
+    if (!gNetworkAdditionalParks.empty())
+    {
+        Console::Error::WriteLine("Hosting more than one park at once is not supported on this platform.");
+        return EXITCODE_FAIL;
+    }
+#endif
+
     gNetworkStart = NETWORK_MODE_SERVER;
     gNetworkStartPort = _port;
     gNetworkStartAddress = String::ToStd(_address);
@@ -331,6 +373,60 @@ exitcode_t HandleCommandJoin(CommandLineArgEnumerator* enumerator)
     return EXITCODE_CONTINUE;
 }
 
+exitcode_t HandleCommandRelay(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const char* hostname;
+    if (!enumerator->TryPopString(&hostname))
+    {
+        Console::Error::WriteLine("Expected a hostname or IP address to the server to relay.");
+        return EXITCODE_FAIL;
+    }
+
+    // A relay joins the server as a client and serves the game on to spectators, it has no use for a window
+    gNetworkStart = NETWORK_MODE_CLIENT;
+    gNetworkStartPort = _port;
+    gNetworkStartHost = hostname;
+    gNetworkStartAddress = String::ToStd(_address);
+    gNetworkRelayPort = _relayPort != 0 ? _relayPort : NETWORK_DEFAULT_PORT;
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    gOpenRCT2SilentBreakpad = true;
+    return EXITCODE_CONTINUE;
+}
+
+exitcode_t HandleCommandStandby(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const char* hostname;
+    if (!enumerator->TryPopString(&hostname))
+    {
+        Console::Error::WriteLine("Expected a hostname or IP address to the server to stand by for.");
+        return EXITCODE_FAIL;
+    }
+
+    // A standby follows the server as a client until it has to take over, like a headless server
+    gNetworkStart = NETWORK_MODE_CLIENT;
+    gNetworkStartPort = _port;
+    gNetworkStartHost = hostname;
+    gNetworkStartAddress = String::ToStd(_address);
+    gNetworkStandbyPort = _standbyPort != 0 ? _standbyPort : NETWORK_DEFAULT_PORT;
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    gOpenRCT2SilentBreakpad = true;
+    return EXITCODE_CONTINUE;
+}
+
 #endif // DISABLE_NETWORK
 
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator* enumerator)
@@ -29,10 +29,12 @@ static constexpr const CommandLineOptionDefinition ScreenshotOptionsDef[]
 };
 
 static exitcode_t HandleScreenshot(CommandLineArgEnumerator *argEnumerator);
+static exitcode_t HandleScreenshotServe(CommandLineArgEnumerator *argEnumerator);
 
 const CommandLineCommand CommandLine::ScreenshotCommands[]
 {
     // Main commands
+    DefineCommand("serve", "[<jobs_file>]",                                                  ScreenshotOptionsDef, HandleScreenshotServe),
     DefineCommand("", "<file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]", ScreenshotOptionsDef, HandleScreenshot),
     DefineCommand("", "<file> <output_image> giant <zoom> <rotation>",                      ScreenshotOptionsDef, HandleScreenshot),
     CommandTableEnd
@@ -50,3 +52,21 @@ static exitcode_t HandleScreenshot(CommandLineArgEnumerator* argEnumerator)
     }
     return EXITCODE_OK;
 }
+
+static exitcode_t HandleScreenshotServe(CommandLineArgEnumerator* argEnumerator)
+{
+    // Jobs are read from standard input unless a file is given
+    const char* jobsPath = nullptr;
+    const char* argument;
+    if (argEnumerator->TryPopString(&argument) && argument[0] != '-')
+    {
+        jobsPath = argument;
+    }
+
+    int32_t result = cmdline_for_screenshot_serve(jobsPath, &_options);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
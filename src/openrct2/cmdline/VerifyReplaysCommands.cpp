@@ -0,0 +1,251 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../platform/Platform2.h"
+#include "../platform/platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static int32_t _jobs = 0;
+static utf8* _outputPath = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition VerifyReplaysOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_jobs,       NAC, "jobs",   "number of processes to verify the replays with (default 1)"    },
+    { CMDLINE_TYPE_STRING,  &_outputPath, NAC, "output", "write the results as JSON to the given file"                   },
+    OptionTableEnd
+};
+
+static exitcode_t HandleVerifyReplays(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::VerifyReplaysCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> [<file> ...]", VerifyReplaysOptions, HandleVerifyReplays),
+    CommandTableEnd
+};
+// clang-format on
+
+static json_t VerifyReplay(IContext& context, const std::string& path)
+{
+    json_t result = {
+        { "replay", path },
+        { "status", "error" },
+        { "ticks", 0 },
+        { "ticks_per_second", 0 },
+        { "first_mismatch_tick", nullptr },
+    };
+
+    auto replayManager = context.GetReplayManager();
+    if (!replayManager->StartPlayback(path))
+    {
+        return result;
+    }
+
+    // Stop at the first mismatch, the ticks after it say nothing new about the replay
+    auto gameState = context.GetGameState();
+    uint32_t ticks = 0;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    while (replayManager->IsReplaying() && !replayManager->GetFirstPlaybackMismatch())
+    {
+        gameState->UpdateLogic();
+        ticks++;
+    }
+    auto totalTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+    replayManager->StopPlayback();
+
+    auto mismatch = replayManager->GetFirstPlaybackMismatch();
+    result["status"] = mismatch ? "mismatch" : "ok";
+    result["ticks"] = ticks;
+    result["ticks_per_second"] = totalTime > 0 ? ticks / totalTime : 0;
+    if (mismatch)
+    {
+        result["first_mismatch_tick"] = *mismatch;
+    }
+    return result;
+}
+
+static json_t VerifyReplays(const std::vector<std::string>& paths)
+{
+    json_t results = json_t::array();
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        for (const auto& path : paths)
+        {
+            results.push_back({ { "replay", path }, { "status", "error" } });
+        }
+        return results;
+    }
+
+    // One context is shared by all replays, initialising it takes longer than most replays
+    for (const auto& path : paths)
+    {
+        Console::Error::WriteLine("Verifying %s...", path.c_str());
+        results.push_back(VerifyReplay(*context, path));
+    }
+    return results;
+}
+
+static std::string QuoteArgument(const std::string& arg)
+{
+    return "\"" + arg + "\"";
+}
+
+/**
+ * The game state is global, so replays can only run in parallel in separate processes. Each process verifies a share
+ * of the replays, writes its results to a file next to the output and the results are merged once all have finished.
+ */
+static json_t VerifyReplaysInProcesses(const std::vector<std::string>& paths, size_t jobs, const std::string& outputBase)
+{
+    const auto executable = Platform::GetCurrentExecutablePath();
+
+    std::vector<std::future<void>> processes;
+    std::vector<std::string> resultPaths;
+    for (size_t job = 0; job < jobs; job++)
+    {
+        if (job >= paths.size())
+            break;
+
+        auto resultPath = String::StdFormat("%s.%u", outputBase.c_str(), static_cast<uint32_t>(job));
+        std::string command = QuoteArgument(executable) + " verifyreplays --output " + QuoteArgument(resultPath);
+        for (size_t i = job; i < paths.size(); i += jobs)
+        {
+            command += " " + QuoteArgument(paths[i]);
+        }
+#ifdef _WIN32
+        // cmd.exe strips the first and last quote of the command line
+        command = "\"" + command + "\"";
+#endif
+        resultPaths.push_back(resultPath);
+        processes.push_back(std::async(std::launch::async, [command]() { std::system(command.c_str()); }));
+    }
+
+    for (auto& process : processes)
+    {
+        process.wait();
+    }
+
+    json_t results = json_t::array();
+    for (const auto& resultPath : resultPaths)
+    {
+        try
+        {
+            auto jobResults = Json::ReadFromFile(resultPath.c_str());
+            for (const auto& result : jobResults["replays"])
+            {
+                results.push_back(result);
+            }
+            File::Delete(resultPath);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read results %s: %s", resultPath.c_str(), e.what());
+        }
+    }
+
+    // Report the replays of a process that did not finish as errors
+    for (const auto& path : paths)
+    {
+        auto found = std::any_of(results.begin(), results.end(), [&path](const json_t& result) {
+            return result.value("replay", "") == path;
+        });
+        if (!found)
+        {
+            results.push_back({ { "replay", path }, { "status", "error" } });
+        }
+    }
+    return results;
+}
+
+static exitcode_t HandleVerifyReplays(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing arguments <file> [<file> ...].");
+        return EXITCODE_FAIL;
+    }
+
+    std::vector<std::string> paths;
+    for (int32_t i = 0; i < argc; i++)
+    {
+        paths.push_back(Path::GetAbsolute(argv[i]));
+    }
+
+    const size_t jobs = std::clamp<size_t>(_jobs > 0 ? _jobs : 1, 1, paths.size());
+    const std::string outputPath = _outputPath != nullptr ? _outputPath : "";
+
+    core_init();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    json_t results;
+    if (jobs > 1)
+    {
+        const auto outputBase = Path::GetAbsolute(!outputPath.empty() ? outputPath : "verifyreplays.json");
+        results = VerifyReplaysInProcesses(paths, jobs, outputBase);
+    }
+    else
+    {
+        results = VerifyReplays(paths);
+    }
+
+    bool passed = true;
+    for (const auto& result : results)
+    {
+        const auto path = result.value("replay", "");
+        const auto status = result.value("status", "error");
+        if (status == "ok")
+        {
+            Console::WriteLine(
+                "%s: ok, %u ticks at %.1f ticks/s", path.c_str(), result.value("ticks", 0u),
+                result.value("ticks_per_second", 0.0));
+        }
+        else if (status == "mismatch")
+        {
+            Console::WriteLine(
+                "%s: MISMATCH at replay tick %u", path.c_str(), result["first_mismatch_tick"].get<uint32_t>());
+        }
+        else
+        {
+            Console::WriteLine("%s: ERROR, unable to play replay", path.c_str());
+        }
+        passed &= status == "ok";
+    }
+
+    if (!outputPath.empty())
+    {
+        Json::WriteToFile(outputPath.c_str(), json_t{ { "replays", results } });
+    }
+    return passed ? EXITCODE_OK : EXITCODE_FAIL;
+}
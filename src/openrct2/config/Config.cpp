@@ -14,6 +14,7 @@
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/FileStream.h"
+#include "../core/Imaging.h"
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -36,6 +37,7 @@
 #include "IniReader.hpp"
 #include "IniWriter.hpp"
 
+#include <algorithm>
 #include <memory>
 
 using namespace OpenRCT2;
@@ -200,7 +202,10 @@ namespace Config
             model->scale_quality = reader->GetEnum<ScaleQuality>(
                 "scale_quality", ScaleQuality::SmoothNearestNeighbour, Enum_ScaleQuality);
             model->show_fps = reader->GetBoolean("show_fps", false);
+            model->show_frame_timings = reader->GetBoolean("show_frame_timings", false);
             model->multithreading = reader->GetBoolean("multi_threading", false);
+            model->use_large_pages = reader->GetBoolean("use_large_pages", true);
+            model->simulation_level_of_detail = reader->GetBoolean("simulation_level_of_detail", false);
             model->trap_cursor = reader->GetBoolean("trap_cursor", false);
             model->auto_open_shops = reader->GetBoolean("auto_open_shops", false);
             model->scenario_select_mode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -219,7 +224,11 @@ namespace Config
             model->show_real_names_of_guests = reader->GetBoolean("show_real_names_of_guests", true);
             model->allow_early_completion = reader->GetBoolean("allow_early_completion", false);
             model->transparent_screenshot = reader->GetBoolean("transparent_screenshot", true);
+            model->screenshot_compression_level = std::clamp(
+                reader->GetInt32("screenshot_compression_level", Imaging::DefaultCompressionLevel), -1, 9);
+            model->screenshot_multithreaded_encoding = reader->GetBoolean("screenshot_multithreaded_encoding", false);
             model->last_version_check_time = reader->GetInt64("last_version_check_time", 0);
+            model->enable_object_hot_reloading = reader->GetBoolean("enable_object_hot_reloading", false);
         }
     }
 
@@ -276,7 +285,10 @@ namespace Config
         writer->WriteFloat("window_scale", model->window_scale);
         writer->WriteEnum<ScaleQuality>("scale_quality", model->scale_quality, Enum_ScaleQuality);
         writer->WriteBoolean("show_fps", model->show_fps);
+        writer->WriteBoolean("show_frame_timings", model->show_frame_timings);
         writer->WriteBoolean("multi_threading", model->multithreading);
+        writer->WriteBoolean("use_large_pages", model->use_large_pages);
+        writer->WriteBoolean("simulation_level_of_detail", model->simulation_level_of_detail);
         writer->WriteBoolean("trap_cursor", model->trap_cursor);
         writer->WriteBoolean("auto_open_shops", model->auto_open_shops);
         writer->WriteInt32("scenario_select_mode", model->scenario_select_mode);
@@ -296,7 +308,10 @@ namespace Config
         writer->WriteBoolean("allow_early_completion", model->allow_early_completion);
         writer->WriteEnum<VirtualFloorStyles>("virtual_floor_style", model->virtual_floor_style, Enum_VirtualFloorStyle);
         writer->WriteBoolean("transparent_screenshot", model->transparent_screenshot);
+        writer->WriteInt32("screenshot_compression_level", model->screenshot_compression_level);
+        writer->WriteBoolean("screenshot_multithreaded_encoding", model->screenshot_multithreaded_encoding);
         writer->WriteInt64("last_version_check_time", model->last_version_check_time);
+        writer->WriteBoolean("enable_object_hot_reloading", model->enable_object_hot_reloading);
     }
 
     static void ReadInterface(IIniReader* reader)
@@ -410,6 +425,11 @@ namespace Config
             model->log_server_actions = reader->GetBoolean("log_server_actions", false);
             model->pause_server_if_no_clients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desync_debugging = reader->GetBoolean("desync_debugging", false);
+            model->desync_check_interval = reader->GetInt32("desync_check_interval", 25);
+            model->failover_host = reader->GetString("failover_host", "");
+            model->failover_port = reader->GetInt32("failover_port", NETWORK_DEFAULT_PORT);
+            model->compress_traffic = reader->GetBoolean("compress_traffic", true);
+            model->interest_management = reader->GetBoolean("interest_management", false);
         }
     }
 
@@ -437,6 +457,11 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->log_server_actions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pause_server_if_no_clients);
         writer->WriteBoolean("desync_debugging", model->desync_debugging);
+        writer->WriteInt32("desync_check_interval", model->desync_check_interval);
+        writer->WriteString("failover_host", model->failover_host);
+        writer->WriteInt32("failover_port", model->failover_port);
+        writer->WriteBoolean("compress_traffic", model->compress_traffic);
+        writer->WriteBoolean("interest_management", model->interest_management);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -537,6 +562,8 @@ namespace Config
         {
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
+            model->soft_tick_budget = reader->GetFloat("soft_tick_budget", 0);
+            model->hard_tick_budget = reader->GetFloat("hard_tick_budget", 0);
         }
     }
 
@@ -545,6 +572,8 @@ namespace Config
         auto model = &gConfigPlugin;
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
+        writer->WriteFloat("soft_tick_budget", model->soft_tick_budget);
+        writer->WriteFloat("hard_tick_budget", model->hard_tick_budget);
     }
 
     static bool SetDefaults()
@@ -40,7 +40,10 @@ struct GeneralConfiguration
     bool uncap_fps;
     bool use_vsync;
     bool show_fps;
+    bool show_frame_timings;
     bool multithreading;
+    bool use_large_pages;
+    bool simulation_level_of_detail;
     bool minimize_fullscreen_focus_loss;
     bool disable_screensaver;
 
@@ -57,6 +60,8 @@ struct GeneralConfiguration
     bool disable_lightning_effect;
     bool show_guest_purchases;
     bool transparent_screenshot;
+    int32_t screenshot_compression_level;
+    bool screenshot_multithreaded_encoding;
 
     // Localisation
     int32_t language;
@@ -106,6 +111,7 @@ struct GeneralConfiguration
     utf8* last_run_version;
     bool use_native_browse_dialog;
     int64_t last_version_check_time;
+    bool enable_object_hot_reloading;
 };
 
 struct InterfaceConfiguration
@@ -159,6 +165,11 @@ struct NetworkConfiguration
     bool log_server_actions;
     bool pause_server_if_no_clients;
     bool desync_debugging;
+    int32_t desync_check_interval;
+    std::string failover_host;
+    int32_t failover_port;
+    bool compress_traffic;
+    bool interest_management;
 };
 
 struct NotificationConfiguration
@@ -204,6 +215,9 @@ struct FontConfiguration
 struct PluginConfiguration
 {
     bool enable_hot_reloading;
+    // Milliseconds a plugin may spend in a single tick before it is warned about (soft) or throttled (hard), 0 is off.
+    float soft_tick_budget;
+    float hard_tick_budget;
 };
 
 enum SORT
@@ -19,12 +19,15 @@ class DataSerialiser
 private:
     OpenRCT2::MemoryStream _stream;
     OpenRCT2::IStream& _activeStream;
+    // Set when the active stream is a memory stream, the values are then read and written without virtual calls
+    OpenRCT2::MemoryStream* _memoryStream = nullptr;
     bool _isSaving = false;
     bool _isLogging = false;
 
 public:
     DataSerialiser(bool isSaving)
         : _activeStream(_stream)
+        , _memoryStream(&_stream)
         , _isSaving(isSaving)
         , _isLogging(false)
     {
@@ -32,6 +35,7 @@ public:
 
     DataSerialiser(bool isSaving, OpenRCT2::IStream& stream, bool isLogging = false)
         : _activeStream(stream)
+        , _memoryStream(dynamic_cast<OpenRCT2::MemoryStream*>(&stream))
         , _isSaving(isSaving)
         , _isLogging(isLogging)
     {
@@ -59,35 +63,37 @@ public:
 
     template<typename T> DataSerialiser& operator<<(const T& data)
     {
-        if (!_isLogging)
-        {
-            if (_isSaving)
-                DataSerializerTraits<T>::encode(&_activeStream, data);
-            else
-                DataSerializerTraits<T>::decode(&_activeStream, const_cast<T&>(data));
-        }
+        if (_memoryStream != nullptr)
+            Serialise<DataSerializerTraits<T>>(_memoryStream, const_cast<T&>(data));
         else
-        {
-            DataSerializerTraits<T>::log(&_activeStream, data);
-        }
+            Serialise<DataSerializerTraits<T>>(&_activeStream, const_cast<T&>(data));
 
         return *this;
     }
 
     template<typename T> DataSerialiser& operator<<(DataSerialiserTag<T> data)
+    {
+        if (_memoryStream != nullptr)
+            Serialise<DataSerializerTraits<DataSerialiserTag<T>>>(_memoryStream, data);
+        else
+            Serialise<DataSerializerTraits<DataSerialiserTag<T>>>(&_activeStream, data);
+
+        return *this;
+    }
+
+private:
+    template<typename TTraits, typename TStream, typename T> void Serialise(TStream* stream, T& data)
     {
         if (!_isLogging)
         {
             if (_isSaving)
-                DataSerializerTraits<DataSerialiserTag<T>>::encode(&_activeStream, data);
+                TTraits::encode(stream, data);
             else
-                DataSerializerTraits<DataSerialiserTag<T>>::decode(&_activeStream, data);
+                TTraits::decode(stream, data);
         }
         else
         {
-            DataSerializerTraits<DataSerialiserTag<T>>::log(&_activeStream, data);
+            TTraits::log(stream, data);
         }
-
-        return *this;
     }
 };
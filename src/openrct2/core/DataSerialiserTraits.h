@@ -30,22 +30,22 @@
 
 template<typename T> struct DataSerializerTraits_t
 {
-    static void encode(OpenRCT2::IStream* stream, const T& v) = delete;
-    static void decode(OpenRCT2::IStream* stream, T& val) = delete;
-    static void log(OpenRCT2::IStream* stream, const T& val) = delete;
+    template<typename TStream> static void encode(TStream* stream, const T& v) = delete;
+    template<typename TStream> static void decode(TStream* stream, T& val) = delete;
+    template<typename TStream> static void log(TStream* stream, const T& val) = delete;
 };
 
 template<typename T> struct DataSerializerTraits_enum
 {
-    static void encode(OpenRCT2::IStream* stream, const T& val)
+    template<typename TStream> static void encode(TStream* stream, const T& val)
     {
         stream->Write(&val);
     }
-    static void decode(OpenRCT2::IStream* stream, T& val)
+    template<typename TStream> static void decode(TStream* stream, T& val)
     {
         stream->Read(&val);
     }
-    static void log(OpenRCT2::IStream* stream, const T& val)
+    template<typename TStream> static void log(TStream* stream, const T& val)
     {
         using underlying = std::underlying_type_t<T>;
         std::stringstream ss;
@@ -61,18 +61,18 @@ using DataSerializerTraits = std::conditional_t<std::is_enum_v<T>, DataSerialize
 
 template<typename T> struct DataSerializerTraitsIntegral
 {
-    static void encode(OpenRCT2::IStream* stream, const T& val)
+    template<typename TStream> static void encode(TStream* stream, const T& val)
     {
         T temp = ByteSwapBE(val);
         stream->Write(&temp);
     }
-    static void decode(OpenRCT2::IStream* stream, T& val)
+    template<typename TStream> static void decode(TStream* stream, T& val)
     {
         T temp;
         stream->Read(&temp);
         val = ByteSwapBE(temp);
     }
-    static void log(OpenRCT2::IStream* stream, const T& val)
+    template<typename TStream> static void log(TStream* stream, const T& val)
     {
         std::stringstream ss;
         ss << std::hex << std::setw(sizeof(T) * 2) << std::setfill('0') << +val;
@@ -84,15 +84,15 @@ template<typename T> struct DataSerializerTraitsIntegral
 
 template<> struct DataSerializerTraits_t<bool>
 {
-    static void encode(OpenRCT2::IStream* stream, const bool& val)
+    template<typename TStream> static void encode(TStream* stream, const bool& val)
     {
         stream->Write(&val);
     }
-    static void decode(OpenRCT2::IStream* stream, bool& val)
+    template<typename TStream> static void decode(TStream* stream, bool& val)
     {
         stream->Read(&val);
     }
-    static void log(OpenRCT2::IStream* stream, const bool& val)
+    template<typename TStream> static void log(TStream* stream, const bool& val)
     {
         if (val)
             stream->Write("true", 4);
@@ -135,25 +135,25 @@ template<> struct DataSerializerTraits_t<int64_t> : public DataSerializerTraitsI
 
 template<> struct DataSerializerTraits_t<std::string>
 {
-    static void encode(OpenRCT2::IStream* stream, const std::string& str)
+    template<typename TStream> static void encode(TStream* stream, const std::string& str)
     {
         uint16_t len = static_cast<uint16_t>(str.size());
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
         stream->WriteArray(str.c_str(), len);
     }
-    static void decode(OpenRCT2::IStream* stream, std::string& res)
+    template<typename TStream> static void decode(TStream* stream, std::string& res)
     {
         uint16_t len;
         stream->Read(&len);
         len = ByteSwapBE(len);
 
-        const char* str = stream->ReadArray<char>(len);
+        const char* str = stream->template ReadArray<char>(len);
         res.assign(str, len);
 
         Memory::FreeArray(str, len);
     }
-    static void log(OpenRCT2::IStream* stream, const std::string& str)
+    template<typename TStream> static void log(TStream* stream, const std::string& str)
     {
         stream->Write("\"", 1);
         stream->Write(str.data(), str.size());
@@ -163,19 +163,19 @@ template<> struct DataSerializerTraits_t<std::string>
 
 template<> struct DataSerializerTraits_t<NetworkPlayerId_t>
 {
-    static void encode(OpenRCT2::IStream* stream, const NetworkPlayerId_t& val)
+    template<typename TStream> static void encode(TStream* stream, const NetworkPlayerId_t& val)
     {
         uint32_t temp = static_cast<uint32_t>(val.id);
         temp = ByteSwapBE(temp);
         stream->Write(&temp);
     }
-    static void decode(OpenRCT2::IStream* stream, NetworkPlayerId_t& val)
+    template<typename TStream> static void decode(TStream* stream, NetworkPlayerId_t& val)
     {
         uint32_t temp;
         stream->Read(&temp);
         val.id = static_cast<decltype(val.id)>(ByteSwapBE(temp));
     }
-    static void log(OpenRCT2::IStream* stream, const NetworkPlayerId_t& val)
+    template<typename TStream> static void log(TStream* stream, const NetworkPlayerId_t& val)
     {
         char playerId[28] = {};
         snprintf(playerId, sizeof(playerId), "%u", val.id);
@@ -198,19 +198,19 @@ template<> struct DataSerializerTraits_t<NetworkPlayerId_t>
 
 template<> struct DataSerializerTraits_t<NetworkRideId_t>
 {
-    static void encode(OpenRCT2::IStream* stream, const NetworkRideId_t& val)
+    template<typename TStream> static void encode(TStream* stream, const NetworkRideId_t& val)
     {
         uint32_t temp = static_cast<uint32_t>(val.id);
         temp = ByteSwapBE(temp);
         stream->Write(&temp);
     }
-    static void decode(OpenRCT2::IStream* stream, NetworkRideId_t& val)
+    template<typename TStream> static void decode(TStream* stream, NetworkRideId_t& val)
     {
         uint32_t temp;
         stream->Read(&temp);
         val.id = static_cast<decltype(val.id)>(ByteSwapBE(temp));
     }
-    static void log(OpenRCT2::IStream* stream, const NetworkRideId_t& val)
+    template<typename TStream> static void log(TStream* stream, const NetworkRideId_t& val)
     {
         char rideId[28] = {};
         snprintf(rideId, sizeof(rideId), "%u", val.id);
@@ -231,17 +231,17 @@ template<> struct DataSerializerTraits_t<NetworkRideId_t>
 
 template<typename T> struct DataSerializerTraits_t<DataSerialiserTag<T>>
 {
-    static void encode(OpenRCT2::IStream* stream, const DataSerialiserTag<T>& tag)
+    template<typename TStream> static void encode(TStream* stream, const DataSerialiserTag<T>& tag)
     {
         DataSerializerTraits<T> s;
         s.encode(stream, tag.Data());
     }
-    static void decode(OpenRCT2::IStream* stream, DataSerialiserTag<T>& tag)
+    template<typename TStream> static void decode(TStream* stream, DataSerialiserTag<T>& tag)
     {
         DataSerializerTraits<T> s;
         s.decode(stream, tag.Data());
     }
-    static void log(OpenRCT2::IStream* stream, const DataSerialiserTag<T>& tag)
+    template<typename TStream> static void log(TStream* stream, const DataSerialiserTag<T>& tag)
     {
         const char* name = tag.Name();
         stream->Write(name, strlen(name));
@@ -256,33 +256,46 @@ template<typename T> struct DataSerializerTraits_t<DataSerialiserTag<T>>
 
 template<> struct DataSerializerTraits_t<OpenRCT2::MemoryStream>
 {
-    static void encode(OpenRCT2::IStream* stream, const OpenRCT2::MemoryStream& val)
+    template<typename TStream> static void encode(TStream* stream, const OpenRCT2::MemoryStream& val)
     {
         DataSerializerTraits<uint32_t> s;
         s.encode(stream, val.GetLength());
 
         stream->Write(val.GetData(), val.GetLength());
     }
-    static void decode(OpenRCT2::IStream* stream, OpenRCT2::MemoryStream& val)
+    template<typename TStream> static void decode(TStream* stream, OpenRCT2::MemoryStream& val)
     {
         DataSerializerTraits<uint32_t> s;
 
         uint32_t length = 0;
         s.decode(stream, length);
 
-        std::unique_ptr<uint8_t[]> buf(new uint8_t[length]);
-        stream->Read(buf.get(), length);
+        if constexpr (std::is_same_v<TStream, OpenRCT2::MemoryStream>)
+        {
+            // Copy straight out of the source buffer, nested streams such as snapshots can be large
+            if (length > stream->GetLength() - stream->GetPosition())
+            {
+                throw IOException("Attempted to read past end of stream.");
+            }
+            val.Write(stream->GetDataAtPosition(), length);
+            stream->Seek(length, OpenRCT2::STREAM_SEEK_CURRENT);
+        }
+        else
+        {
+            std::unique_ptr<uint8_t[]> buf(new uint8_t[length]);
+            stream->Read(buf.get(), length);
 
-        val.Write(buf.get(), length);
+            val.Write(buf.get(), length);
+        }
     }
-    static void log(OpenRCT2::IStream* stream, const OpenRCT2::MemoryStream& tag)
+    template<typename TStream> static void log(TStream* stream, const OpenRCT2::MemoryStream& tag)
     {
     }
 };
 
 template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
 {
-    static void encode(OpenRCT2::IStream* stream, const _Ty (&val)[_Size])
+    template<typename TStream> static void encode(TStream* stream, const _Ty (&val)[_Size])
     {
         uint16_t len = static_cast<uint16_t>(_Size);
         uint16_t swapped = ByteSwapBE(len);
@@ -294,7 +307,7 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
             s.encode(stream, sub);
         }
     }
-    static void decode(OpenRCT2::IStream* stream, _Ty (&val)[_Size])
+    template<typename TStream> static void decode(TStream* stream, _Ty (&val)[_Size])
     {
         uint16_t len;
         stream->Read(&len);
@@ -309,7 +322,7 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
             s.decode(stream, sub);
         }
     }
-    static void log(OpenRCT2::IStream* stream, const _Ty (&val)[_Size])
+    template<typename TStream> static void log(TStream* stream, const _Ty (&val)[_Size])
     {
         stream->Write("{", 1);
         DataSerializerTraits<_Ty> s;
@@ -324,6 +337,25 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
 
 template<size_t _Size> struct DataSerializerTraits_t<uint8_t[_Size]> : public DataSerializerTraitsPODArray<uint8_t, _Size>
 {
+    // Bytes need no swapping, so write them in one go, game state snapshots store whole entities like this
+    template<typename TStream> static void encode(TStream* stream, const uint8_t (&val)[_Size])
+    {
+        uint16_t len = static_cast<uint16_t>(_Size);
+        uint16_t swapped = ByteSwapBE(len);
+        stream->Write(&swapped);
+        stream->Write(val, _Size);
+    }
+    template<typename TStream> static void decode(TStream* stream, uint8_t (&val)[_Size])
+    {
+        uint16_t len;
+        stream->Read(&len);
+        len = ByteSwapBE(len);
+
+        if (len != _Size)
+            throw std::runtime_error("Invalid size, can't decode");
+
+        stream->Read(val, _Size);
+    }
 };
 
 template<size_t _Size> struct DataSerializerTraits_t<uint16_t[_Size]> : public DataSerializerTraitsPODArray<uint16_t, _Size>
@@ -338,21 +370,34 @@ template<size_t _Size> struct DataSerializerTraits_t<uint64_t[_Size]> : public D
 {
 };
 
+// Single byte values are stored as they are, so containers of them can be read and written in one go. Not used for bool
+// as std::vector<bool> does not store its values as bytes.
+template<typename T>
+constexpr bool DataSerialiserIsRawByte = (std::is_integral_v<T> || std::is_enum_v<T>) && sizeof(T) == 1
+    && !std::is_same_v<T, bool>;
+
 template<typename _Ty, size_t _Size> struct DataSerializerTraits_t<std::array<_Ty, _Size>>
 {
-    static void encode(OpenRCT2::IStream* stream, const std::array<_Ty, _Size>& val)
+    template<typename TStream> static void encode(TStream* stream, const std::array<_Ty, _Size>& val)
     {
         uint16_t len = static_cast<uint16_t>(_Size);
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerialiserIsRawByte<_Ty>)
         {
-            s.encode(stream, sub);
+            stream->Write(val.data(), _Size);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
-    static void decode(OpenRCT2::IStream* stream, std::array<_Ty, _Size>& val)
+    template<typename TStream> static void decode(TStream* stream, std::array<_Ty, _Size>& val)
     {
         uint16_t len;
         stream->Read(&len);
@@ -361,13 +406,20 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraits_t<std::array<_T
         if (len != _Size)
             throw std::runtime_error("Invalid size, can't decode");
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerialiserIsRawByte<_Ty>)
         {
-            s.decode(stream, sub);
+            stream->Read(val.data(), _Size);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.decode(stream, sub);
+            }
         }
     }
-    static void log(OpenRCT2::IStream* stream, const std::array<_Ty, _Size>& val)
+    template<typename TStream> static void log(TStream* stream, const std::array<_Ty, _Size>& val)
     {
         stream->Write("{", 1);
         DataSerializerTraits<_Ty> s;
@@ -382,33 +434,50 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraits_t<std::array<_T
 
 template<typename _Ty> struct DataSerializerTraits_t<std::vector<_Ty>>
 {
-    static void encode(OpenRCT2::IStream* stream, const std::vector<_Ty>& val)
+    template<typename TStream> static void encode(TStream* stream, const std::vector<_Ty>& val)
     {
         uint16_t len = static_cast<uint16_t>(val.size());
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerialiserIsRawByte<_Ty>)
         {
-            s.encode(stream, sub);
+            stream->Write(val.data(), val.size());
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
-    static void decode(OpenRCT2::IStream* stream, std::vector<_Ty>& val)
+    template<typename TStream> static void decode(TStream* stream, std::vector<_Ty>& val)
     {
         uint16_t len;
         stream->Read(&len);
         len = ByteSwapBE(len);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto i = 0; i < len; ++i)
+        if constexpr (DataSerialiserIsRawByte<_Ty>)
         {
-            _Ty sub;
-            s.decode(stream, sub);
-            val.push_back(sub);
+            const auto offset = val.size();
+            val.resize(offset + len);
+            stream->Read(val.data() + offset, len);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            val.reserve(val.size() + len);
+            for (auto i = 0; i < len; ++i)
+            {
+                _Ty sub;
+                s.decode(stream, sub);
+                val.push_back(sub);
+            }
         }
     }
-    static void log(OpenRCT2::IStream* stream, const std::vector<_Ty>& val)
+    template<typename TStream> static void log(TStream* stream, const std::vector<_Ty>& val)
     {
         stream->Write("{", 1);
         DataSerializerTraits<_Ty> s;
@@ -423,22 +492,22 @@ template<typename _Ty> struct DataSerializerTraits_t<std::vector<_Ty>>
 
 template<> struct DataSerializerTraits_t<MapRange>
 {
-    static void encode(OpenRCT2::IStream* stream, const MapRange& v)
+    template<typename TStream> static void encode(TStream* stream, const MapRange& v)
     {
         stream->WriteValue(ByteSwapBE(v.GetLeft()));
         stream->WriteValue(ByteSwapBE(v.GetTop()));
         stream->WriteValue(ByteSwapBE(v.GetRight()));
         stream->WriteValue(ByteSwapBE(v.GetBottom()));
     }
-    static void decode(OpenRCT2::IStream* stream, MapRange& v)
+    template<typename TStream> static void decode(TStream* stream, MapRange& v)
     {
-        auto l = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto t = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto r = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto b = ByteSwapBE(stream->ReadValue<int32_t>());
+        auto l = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto t = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto r = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto b = ByteSwapBE(stream->template ReadValue<int32_t>());
         v = MapRange(l, t, r, b);
     }
-    static void log(OpenRCT2::IStream* stream, const MapRange& v)
+    template<typename TStream> static void log(TStream* stream, const MapRange& v)
     {
         char coords[128] = {};
         snprintf(
@@ -451,7 +520,7 @@ template<> struct DataSerializerTraits_t<MapRange>
 
 template<> struct DataSerializerTraits_t<TileElement>
 {
-    static void encode(OpenRCT2::IStream* stream, const TileElement& tileElement)
+    template<typename TStream> static void encode(TStream* stream, const TileElement& tileElement)
     {
         stream->WriteValue(tileElement.type);
         stream->WriteValue(tileElement.Flags);
@@ -466,22 +535,22 @@ template<> struct DataSerializerTraits_t<TileElement>
             stream->WriteValue(tileElement.pad_08[i]);
         }
     }
-    static void decode(OpenRCT2::IStream* stream, TileElement& tileElement)
+    template<typename TStream> static void decode(TStream* stream, TileElement& tileElement)
     {
-        tileElement.type = stream->ReadValue<uint8_t>();
-        tileElement.Flags = stream->ReadValue<uint8_t>();
-        tileElement.base_height = stream->ReadValue<uint8_t>();
-        tileElement.clearance_height = stream->ReadValue<uint8_t>();
+        tileElement.type = stream->template ReadValue<uint8_t>();
+        tileElement.Flags = stream->template ReadValue<uint8_t>();
+        tileElement.base_height = stream->template ReadValue<uint8_t>();
+        tileElement.clearance_height = stream->template ReadValue<uint8_t>();
         for (int i = 0; i < 4; ++i)
         {
-            tileElement.pad_04[i] = stream->ReadValue<uint8_t>();
+            tileElement.pad_04[i] = stream->template ReadValue<uint8_t>();
         }
         for (int i = 0; i < 8; ++i)
         {
-            tileElement.pad_08[i] = stream->ReadValue<uint8_t>();
+            tileElement.pad_08[i] = stream->template ReadValue<uint8_t>();
         }
     }
-    static void log(OpenRCT2::IStream* stream, const TileElement& tileElement)
+    template<typename TStream> static void log(TStream* stream, const TileElement& tileElement)
     {
         char msg[128] = {};
         snprintf(
@@ -493,18 +562,18 @@ template<> struct DataSerializerTraits_t<TileElement>
 
 template<> struct DataSerializerTraits_t<CoordsXY>
 {
-    static void encode(OpenRCT2::IStream* stream, const CoordsXY& coords)
+    template<typename TStream> static void encode(TStream* stream, const CoordsXY& coords)
     {
         stream->WriteValue(ByteSwapBE(coords.x));
         stream->WriteValue(ByteSwapBE(coords.y));
     }
-    static void decode(OpenRCT2::IStream* stream, CoordsXY& coords)
+    template<typename TStream> static void decode(TStream* stream, CoordsXY& coords)
     {
-        auto x = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto y = ByteSwapBE(stream->ReadValue<int32_t>());
+        auto x = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto y = ByteSwapBE(stream->template ReadValue<int32_t>());
         coords = CoordsXY{ x, y };
     }
-    static void log(OpenRCT2::IStream* stream, const CoordsXY& coords)
+    template<typename TStream> static void log(TStream* stream, const CoordsXY& coords)
     {
         char msg[128] = {};
         snprintf(msg, sizeof(msg), "CoordsXY(x = %d, y = %d)", coords.x, coords.y);
@@ -514,22 +583,22 @@ template<> struct DataSerializerTraits_t<CoordsXY>
 
 template<> struct DataSerializerTraits_t<CoordsXYZ>
 {
-    static void encode(OpenRCT2::IStream* stream, const CoordsXYZ& coord)
+    template<typename TStream> static void encode(TStream* stream, const CoordsXYZ& coord)
     {
         stream->WriteValue(ByteSwapBE(coord.x));
         stream->WriteValue(ByteSwapBE(coord.y));
         stream->WriteValue(ByteSwapBE(coord.z));
     }
 
-    static void decode(OpenRCT2::IStream* stream, CoordsXYZ& coord)
+    template<typename TStream> static void decode(TStream* stream, CoordsXYZ& coord)
     {
-        auto x = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto y = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto z = ByteSwapBE(stream->ReadValue<int32_t>());
+        auto x = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto y = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto z = ByteSwapBE(stream->template ReadValue<int32_t>());
         coord = CoordsXYZ{ x, y, z };
     }
 
-    static void log(OpenRCT2::IStream* stream, const CoordsXYZ& coord)
+    template<typename TStream> static void log(TStream* stream, const CoordsXYZ& coord)
     {
         char msg[128] = {};
         snprintf(msg, sizeof(msg), "CoordsXYZ(x = %d, y = %d, z = %d)", coord.x, coord.y, coord.z);
@@ -539,7 +608,7 @@ template<> struct DataSerializerTraits_t<CoordsXYZ>
 
 template<> struct DataSerializerTraits_t<CoordsXYZD>
 {
-    static void encode(OpenRCT2::IStream* stream, const CoordsXYZD& coord)
+    template<typename TStream> static void encode(TStream* stream, const CoordsXYZD& coord)
     {
         stream->WriteValue(ByteSwapBE(coord.x));
         stream->WriteValue(ByteSwapBE(coord.y));
@@ -547,16 +616,16 @@ template<> struct DataSerializerTraits_t<CoordsXYZD>
         stream->WriteValue(ByteSwapBE(coord.direction));
     }
 
-    static void decode(OpenRCT2::IStream* stream, CoordsXYZD& coord)
+    template<typename TStream> static void decode(TStream* stream, CoordsXYZD& coord)
     {
-        auto x = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto y = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto z = ByteSwapBE(stream->ReadValue<int32_t>());
-        auto d = ByteSwapBE(stream->ReadValue<uint8_t>());
+        auto x = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto y = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto z = ByteSwapBE(stream->template ReadValue<int32_t>());
+        auto d = ByteSwapBE(stream->template ReadValue<uint8_t>());
         coord = CoordsXYZD{ x, y, z, d };
     }
 
-    static void log(OpenRCT2::IStream* stream, const CoordsXYZD& coord)
+    template<typename TStream> static void log(TStream* stream, const CoordsXYZD& coord)
     {
         char msg[128] = {};
         snprintf(
@@ -567,18 +636,18 @@ template<> struct DataSerializerTraits_t<CoordsXYZD>
 
 template<> struct DataSerializerTraits_t<NetworkCheatType_t>
 {
-    static void encode(OpenRCT2::IStream* stream, const NetworkCheatType_t& val)
+    template<typename TStream> static void encode(TStream* stream, const NetworkCheatType_t& val)
     {
         uint32_t temp = ByteSwapBE(val.id);
         stream->Write(&temp);
     }
-    static void decode(OpenRCT2::IStream* stream, NetworkCheatType_t& val)
+    template<typename TStream> static void decode(TStream* stream, NetworkCheatType_t& val)
     {
         uint32_t temp;
         stream->Read(&temp);
         val.id = ByteSwapBE(temp);
     }
-    static void log(OpenRCT2::IStream* stream, const NetworkCheatType_t& val)
+    template<typename TStream> static void log(TStream* stream, const NetworkCheatType_t& val)
     {
         const char* cheatName = CheatsGetName(static_cast<CheatType>(val.id));
         stream->Write(cheatName, strlen(cheatName));
@@ -587,21 +656,21 @@ template<> struct DataSerializerTraits_t<NetworkCheatType_t>
 
 template<> struct DataSerializerTraits_t<rct_object_entry>
 {
-    static void encode(OpenRCT2::IStream* stream, const rct_object_entry& val)
+    template<typename TStream> static void encode(TStream* stream, const rct_object_entry& val)
     {
         uint32_t temp = ByteSwapBE(val.flags);
         stream->Write(&temp);
         stream->WriteArray(val.nameWOC, 12);
     }
-    static void decode(OpenRCT2::IStream* stream, rct_object_entry& val)
+    template<typename TStream> static void decode(TStream* stream, rct_object_entry& val)
     {
         uint32_t temp;
         stream->Read(&temp);
         val.flags = ByteSwapBE(temp);
-        const char* str = stream->ReadArray<char>(12);
+        const char* str = stream->template ReadArray<char>(12);
         memcpy(val.nameWOC, str, 12);
     }
-    static void log(OpenRCT2::IStream* stream, const rct_object_entry& val)
+    template<typename TStream> static void log(TStream* stream, const rct_object_entry& val)
     {
         stream->WriteArray(val.name, 8);
     }
@@ -609,17 +678,17 @@ template<> struct DataSerializerTraits_t<rct_object_entry>
 
 template<> struct DataSerializerTraits_t<TrackDesignTrackElement>
 {
-    static void encode(OpenRCT2::IStream* stream, const TrackDesignTrackElement& val)
+    template<typename TStream> static void encode(TStream* stream, const TrackDesignTrackElement& val)
     {
         stream->Write(&val.flags);
         stream->Write(&val.type);
     }
-    static void decode(OpenRCT2::IStream* stream, TrackDesignTrackElement& val)
+    template<typename TStream> static void decode(TStream* stream, TrackDesignTrackElement& val)
     {
         stream->Read(&val.flags);
         stream->Read(&val.type);
     }
-    static void log(OpenRCT2::IStream* stream, const TrackDesignTrackElement& val)
+    template<typename TStream> static void log(TStream* stream, const TrackDesignTrackElement& val)
     {
         char msg[128] = {};
         snprintf(msg, sizeof(msg), "TrackDesignTrackElement(type = %d, flags = %d)", val.type, val.flags);
@@ -629,18 +698,18 @@ template<> struct DataSerializerTraits_t<TrackDesignTrackElement>
 
 template<> struct DataSerializerTraits_t<TrackDesignMazeElement>
 {
-    static void encode(OpenRCT2::IStream* stream, const TrackDesignMazeElement& val)
+    template<typename TStream> static void encode(TStream* stream, const TrackDesignMazeElement& val)
     {
         uint32_t temp = ByteSwapBE(val.all);
         stream->Write(&temp);
     }
-    static void decode(OpenRCT2::IStream* stream, TrackDesignMazeElement& val)
+    template<typename TStream> static void decode(TStream* stream, TrackDesignMazeElement& val)
     {
         uint32_t temp;
         stream->Read(&temp);
         val.all = ByteSwapBE(temp);
     }
-    static void log(OpenRCT2::IStream* stream, const TrackDesignMazeElement& val)
+    template<typename TStream> static void log(TStream* stream, const TrackDesignMazeElement& val)
     {
         char msg[128] = {};
         snprintf(msg, sizeof(msg), "TrackDesignMazeElement(all = %d)", val.all);
@@ -650,7 +719,7 @@ template<> struct DataSerializerTraits_t<TrackDesignMazeElement>
 
 template<> struct DataSerializerTraits_t<TrackDesignEntranceElement>
 {
-    static void encode(OpenRCT2::IStream* stream, const TrackDesignEntranceElement& val)
+    template<typename TStream> static void encode(TStream* stream, const TrackDesignEntranceElement& val)
     {
         stream->Write(&val.x);
         stream->Write(&val.y);
@@ -658,7 +727,7 @@ template<> struct DataSerializerTraits_t<TrackDesignEntranceElement>
         stream->Write(&val.direction);
         stream->Write(&val.isExit);
     }
-    static void decode(OpenRCT2::IStream* stream, TrackDesignEntranceElement& val)
+    template<typename TStream> static void decode(TStream* stream, TrackDesignEntranceElement& val)
     {
         stream->Read(&val.x);
         stream->Read(&val.y);
@@ -666,7 +735,7 @@ template<> struct DataSerializerTraits_t<TrackDesignEntranceElement>
         stream->Read(&val.direction);
         stream->Read(&val.isExit);
     }
-    static void log(OpenRCT2::IStream* stream, const TrackDesignEntranceElement& val)
+    template<typename TStream> static void log(TStream* stream, const TrackDesignEntranceElement& val)
     {
         char msg[128] = {};
         snprintf(
@@ -678,7 +747,7 @@ template<> struct DataSerializerTraits_t<TrackDesignEntranceElement>
 
 template<> struct DataSerializerTraits_t<TrackDesignSceneryElement>
 {
-    static void encode(OpenRCT2::IStream* stream, const TrackDesignSceneryElement& val)
+    template<typename TStream> static void encode(TStream* stream, const TrackDesignSceneryElement& val)
     {
         stream->Write(&val.x);
         stream->Write(&val.y);
@@ -689,7 +758,7 @@ template<> struct DataSerializerTraits_t<TrackDesignSceneryElement>
         DataSerializerTraits<rct_object_entry> s;
         s.encode(stream, val.scenery_object);
     }
-    static void decode(OpenRCT2::IStream* stream, TrackDesignSceneryElement& val)
+    template<typename TStream> static void decode(TStream* stream, TrackDesignSceneryElement& val)
     {
         stream->Read(&val.x);
         stream->Read(&val.y);
@@ -700,7 +769,7 @@ template<> struct DataSerializerTraits_t<TrackDesignSceneryElement>
         DataSerializerTraits<rct_object_entry> s;
         s.decode(stream, val.scenery_object);
     }
-    static void log(OpenRCT2::IStream* stream, const TrackDesignSceneryElement& val)
+    template<typename TStream> static void log(TStream* stream, const TrackDesignSceneryElement& val)
     {
         char msg[128] = {};
         snprintf(
@@ -713,17 +782,17 @@ template<> struct DataSerializerTraits_t<TrackDesignSceneryElement>
 
 template<> struct DataSerializerTraits_t<rct_vehicle_colour>
 {
-    static void encode(OpenRCT2::IStream* stream, const rct_vehicle_colour& val)
+    template<typename TStream> static void encode(TStream* stream, const rct_vehicle_colour& val)
     {
         stream->Write(&val.body_colour);
         stream->Write(&val.trim_colour);
     }
-    static void decode(OpenRCT2::IStream* stream, rct_vehicle_colour& val)
+    template<typename TStream> static void decode(TStream* stream, rct_vehicle_colour& val)
     {
         stream->Read(&val.body_colour);
         stream->Read(&val.trim_colour);
     }
-    static void log(OpenRCT2::IStream* stream, const rct_vehicle_colour& val)
+    template<typename TStream> static void log(TStream* stream, const rct_vehicle_colour& val)
     {
         char msg[128] = {};
         snprintf(msg, sizeof(msg), "rct_vehicle_colour(body_colour = %d, trim_colour = %d)", val.body_colour, val.trim_colour);
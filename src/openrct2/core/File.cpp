@@ -17,12 +17,87 @@
 #include "../util/Util.h"
 #include "File.h"
 #include "FileStream.h"
+#include "JobPool.h"
 #include "String.hpp"
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <mutex>
+#include <thread>
 
 namespace File
 {
+    /**
+     * Runs file requests one after another on a background thread. The thread takes all requests queued since it last
+     * woke up in one go, starts with the first request and finishes the queued requests before the process exits.
+     */
+    class IOQueue
+    {
+    private:
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<JobTask> _requests;
+        bool _stopping = false;
+
+    public:
+        ~IOQueue()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _condition.notify_one();
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+        }
+
+        template<typename TFn> auto Enqueue(TFn&& fn)
+        {
+            std::packaged_task<std::invoke_result_t<TFn>()> task(std::forward<TFn>(fn));
+            auto result = task.get_future();
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_thread.joinable())
+                {
+                    _thread = std::thread([this]() { Run(); });
+                }
+                _requests.emplace_back(std::move(task));
+            }
+            _condition.notify_one();
+            return result;
+        }
+
+    private:
+        void Run()
+        {
+            std::deque<JobTask> batch;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _condition.wait(lock, [this]() { return _stopping || !_requests.empty(); });
+                    if (_requests.empty())
+                    {
+                        return;
+                    }
+                    batch.swap(_requests);
+                }
+
+                for (auto& request : batch)
+                {
+                    request();
+                }
+                batch.clear();
+            }
+        }
+    };
+
+    static IOQueue _ioQueue;
+
     bool Exists(const std::string& path)
     {
         return Platform::FileExists(path);
@@ -147,6 +222,16 @@ namespace File
 #endif
         return lastModified;
     }
+
+    std::future<std::vector<uint8_t>> ReadAllBytesAsync(const std::string& path)
+    {
+        return _ioQueue.Enqueue([path]() { return ReadAllBytes(path); });
+    }
+
+    std::future<void> WriteAllBytesAsync(const std::string& path, std::vector<uint8_t> data)
+    {
+        return _ioQueue.Enqueue([path, data = std::move(data)]() { WriteAllBytes(path, data.data(), data.size()); });
+    }
 } // namespace File
 
 bool writeentirefile(const utf8* path, const void* buffer, size_t length)
@@ -11,6 +11,7 @@
 
 #include "../common.h"
 
+#include <future>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -26,4 +27,11 @@ namespace File
     void WriteAllBytes(const std::string& path, const void* buffer, size_t length);
     std::vector<std::string> ReadAllLines(const std::string& path);
     uint64_t GetLastModified(const std::string& path);
+
+    /**
+     * Reads and writes on the background I/O thread, errors are thrown from the future. Requests are handled in the
+     * order they were made, so a read after a write to the same path sees the written data.
+     */
+    std::future<std::vector<uint8_t>> ReadAllBytesAsync(const std::string& path);
+    std::future<void> WriteAllBytesAsync(const std::string& path, std::vector<uint8_t> data);
 } // namespace File
@@ -13,14 +13,16 @@
 #include "Console.hpp"
 #include "File.h"
 #include "FileScanner.h"
-#include "FileStream.h"
 #include "JobPool.h"
+#include "MemoryStream.h"
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -34,18 +36,38 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct ScannedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
+        ScanResult(DirectoryStats stats, std::vector<ScannedFile> files)
             : Stats(stats)
             , Files(files)
         {
         }
     };
 
+    // A file as it was when the index was written, along with the item created from it
+    struct IndexedFile
+    {
+        ScannedFile File;
+        std::optional<TItem> Item;
+    };
+
+    struct ReadIndexResult
+    {
+        bool UpToDate = false;
+        std::vector<IndexedFile> Files;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -54,11 +76,11 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -94,31 +116,34 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. If the index is up to date, the items are loaded from the index
+     * and returned, otherwise the index is updated. Only files that were added or changed since the index was written
+     * are loaded again, the items of the other files are taken from the index.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
         auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        if (readIndexResult.UpToDate)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            std::vector<TItem> items;
+            items.reserve(readIndexResult.Files.size());
+            for (auto& indexedFile : readIndexResult.Files)
+            {
+                if (indexedFile.Item.has_value())
+                {
+                    items.push_back(std::move(*indexedFile.Item));
+                }
+            }
+            return items;
         }
-        return items;
+        return Build(language, scanResult, readIndexResult.Files);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, {});
         return items;
     }
 
@@ -143,7 +168,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<ScannedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -156,7 +181,7 @@ private:
                 auto fileInfo = scanner->GetFileInfo();
                 auto path = std::string(scanner->GetPath());
 
-                files.push_back(path);
+                files.push_back({ path, fileInfo->Size, fileInfo->LastModified });
 
                 stats.TotalFiles++;
                 stats.TotalFileSize += fileInfo->Size;
@@ -171,13 +196,14 @@ private:
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const ScanResult& scanResult, const std::vector<size_t>& fileIndices, size_t rangeStart,
+        size_t rangeEnd, std::vector<std::optional<TItem>>& items, std::atomic<size_t>& processed,
+        std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            const auto fileIndex = fileIndices[i];
+            const auto& filePath = scanResult.Files.at(fileIndex).Path;
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
@@ -188,28 +214,62 @@ private:
             auto item = Create(language, filePath);
             if (std::get<0>(item))
             {
-                items.push_back(std::get<1>(item));
+                items[fileIndex] = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the items of all scanned files. Items of files that have the same size and modification date as in
+     * the previous index are reused instead of loading the file again.
+     */
+    std::vector<TItem> Build(
+        int32_t language, const ScanResult& scanResult, const std::vector<IndexedFile>& previousFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        const size_t numFiles = scanResult.Files.size();
+        std::vector<std::optional<TItem>> fileItems(numFiles);
+        std::vector<size_t> changedFiles;
+        {
+            std::unordered_map<std::string_view, const IndexedFile*> previousByPath;
+            for (const auto& previousFile : previousFiles)
+            {
+                previousByPath.emplace(previousFile.File.Path, &previousFile);
+            }
+            for (size_t i = 0; i < numFiles; i++)
+            {
+                const auto& file = scanResult.Files[i];
+                auto it = previousByPath.find(file.Path);
+                if (it != previousByPath.end() && it->second->File.Size == file.Size
+                    && it->second->File.LastModified == file.LastModified)
+                {
+                    fileItems[i] = it->second->Item;
+                }
+                else
+                {
+                    changedFiles.push_back(i);
+                }
+            }
+        }
+
+        if (previousFiles.empty())
+        {
+            Console::WriteLine("Building %s (%zu items)", _name.c_str(), numFiles);
+        }
+        else
+        {
+            Console::WriteLine("Updating %s (%zu of %zu items changed)", _name.c_str(), changedFiles.size(), numFiles);
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = changedFiles.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
@@ -226,25 +286,29 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
+                // Every file has its own slot in fileItems, so the ranges can write their items without a lock
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), std::cref(changedFiles),
+                    rangeStart, rangeStart + stepSize, std::ref(fileItems), std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
+        }
+
+        WriteIndexFile(language, scanResult, fileItems);
 
-            for (auto&& itr : containers)
+        std::vector<TItem> allItems;
+        allItems.reserve(numFiles);
+        for (auto& item : fileItems)
+        {
+            if (item.has_value())
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                allItems.push_back(std::move(*item));
             }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
-
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
@@ -252,33 +316,49 @@ private:
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    /**
+     * Reads the files and items stored in the index. The result is up to date if the directories have not changed
+     * since the index was written. An index written for another language or version is not read at all.
+     */
+    ReadIndexResult ReadIndexFile(int32_t language, const DirectoryStats& stats) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        ReadIndexResult result;
         if (File::Exists(_indexPath))
         {
             try
             {
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
-                auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Items are read a value at a time, which is a lot faster from memory than through the file
+                auto data = File::ReadAllBytes(_indexPath);
+                auto fs = OpenRCT2::MemoryStream(data.data(), data.size());
+
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    result.Files.reserve(header.NumFiles);
+                    for (uint32_t i = 0; i < header.NumFiles; i++)
                     {
-                        auto item = Deserialise(&fs);
-                        items.push_back(item);
+                        IndexedFile indexedFile;
+                        indexedFile.File.Path = fs.ReadStdString();
+                        indexedFile.File.Size = fs.ReadValue<uint64_t>();
+                        indexedFile.File.LastModified = fs.ReadValue<uint64_t>();
+                        if (fs.ReadValue<uint8_t>() != 0)
+                        {
+                            indexedFile.Item = Deserialise(&fs);
+                        }
+                        result.Files.push_back(std::move(indexedFile));
+                    }
+
+                    result.UpToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
+                    if (!result.UpToDate)
+                    {
+                        Console::WriteLine("%s out of date", _name.c_str());
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -289,18 +369,19 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                result = {};
             }
         }
-        return std::make_tuple(loadedItems, items);
+        return result;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(
+        int32_t language, const ScanResult& scanResult, const std::vector<std::optional<TItem>>& fileItems) const
     {
         try
         {
             log_verbose("FileIndex:Writing index: '%s'", _indexPath.c_str());
-            Path::CreateDirectory(Path::GetDirectory(_indexPath));
-            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_WRITE);
+            OpenRCT2::MemoryStream fs;
 
             // Write header
             FileIndexHeader header;
@@ -308,15 +389,26 @@ private:
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.Stats = scanResult.Stats;
+            header.NumFiles = static_cast<uint32_t>(scanResult.Files.size());
             fs.WriteValue(header);
 
-            // Write items
-            for (const auto& item : items)
+            // Write every file, also the ones without an item so they are not loaded again on the next update
+            for (size_t i = 0; i < scanResult.Files.size(); i++)
             {
-                Serialise(&fs, item);
+                const auto& file = scanResult.Files[i];
+                fs.WriteString(file.Path);
+                fs.WriteValue<uint64_t>(file.Size);
+                fs.WriteValue<uint64_t>(file.LastModified);
+                fs.WriteValue<uint8_t>(fileItems[i].has_value() ? 1 : 0);
+                if (fileItems[i].has_value())
+                {
+                    Serialise(&fs, *fileItems[i]);
+                }
             }
+
+            Path::CreateDirectory(Path::GetDirectory(_indexPath));
+            File::WriteAllBytes(_indexPath, fs.GetData(), static_cast<size_t>(fs.GetLength()));
         }
         catch (const std::exception& e)
         {
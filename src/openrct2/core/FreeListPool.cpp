@@ -0,0 +1,107 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "FreeListPool.h"
+
+#include <array>
+#include <new>
+
+namespace FreeListPool
+{
+    static constexpr size_t SizeClassGranularity = 32;
+    static constexpr size_t SizeClassCount = MaxBlockSize / SizeClassGranularity;
+
+    // Enough spare blocks for a burst of ghost placements without holding on to memory forever
+    static constexpr size_t MaxFreeBlocksPerClass = 64;
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* Head = nullptr;
+        size_t Count = 0;
+    };
+
+    // Set once the lists of the thread are destroyed, objects released after that (static destructors) use the heap
+    static thread_local bool _freeListsDestroyed;
+
+    class ThreadFreeLists
+    {
+    public:
+        std::array<FreeList, SizeClassCount> Lists;
+
+        ThreadFreeLists() = default;
+        ThreadFreeLists(const ThreadFreeLists&) = delete;
+        ThreadFreeLists& operator=(const ThreadFreeLists&) = delete;
+
+        ~ThreadFreeLists()
+        {
+            _freeListsDestroyed = true;
+            for (auto& list : Lists)
+            {
+                while (list.Head != nullptr)
+                {
+                    auto next = list.Head->Next;
+                    ::operator delete(list.Head);
+                    list.Head = next;
+                }
+            }
+        }
+    };
+
+    static thread_local ThreadFreeLists _freeLists;
+
+    static size_t GetSizeClass(size_t size)
+    {
+        return (size + SizeClassGranularity - 1) / SizeClassGranularity - 1;
+    }
+
+    void* Allocate(size_t size)
+    {
+        if (size == 0 || size > MaxBlockSize || _freeListsDestroyed)
+            return ::operator new(size);
+
+        auto sizeClass = GetSizeClass(size);
+        auto& list = _freeLists.Lists[sizeClass];
+        if (list.Head != nullptr)
+        {
+            auto block = list.Head;
+            list.Head = block->Next;
+            list.Count--;
+            return block;
+        }
+        return ::operator new((sizeClass + 1) * SizeClassGranularity);
+    }
+
+    void Free(void* ptr, size_t size) noexcept
+    {
+        if (ptr == nullptr)
+            return;
+
+        if (size == 0 || size > MaxBlockSize || _freeListsDestroyed)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        auto& list = _freeLists.Lists[GetSizeClass(size)];
+        if (list.Count >= MaxFreeBlocksPerClass)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+        auto block = static_cast<FreeBlock*>(ptr);
+        block->Next = list.Head;
+        list.Head = block;
+        list.Count++;
+    }
+} // namespace FreeListPool
@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <cstddef>
+
+/**
+ * Recycles the memory of small objects that are created and destroyed at a high rate, such as game actions and their
+ * results. Blocks are grouped into size classes and kept on a free list of the thread that released them instead of
+ * going back to the heap. Blocks can be released on a different thread than the one they were allocated on.
+ */
+namespace FreeListPool
+{
+    // Allocations larger than this are not pooled
+    constexpr size_t MaxBlockSize = 1024;
+
+    void* Allocate(size_t size);
+    void Free(void* ptr, size_t size) noexcept;
+} // namespace FreeListPool
+
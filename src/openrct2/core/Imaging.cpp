@@ -15,14 +15,18 @@
 #include "../drawing/Drawing.h"
 #include "Guard.hpp"
 #include "IStream.hpp"
+#include "JobPool.h"
 #include "Memory.hpp"
 #include "String.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <png.h>
+#include <sstream>
 #include <stdexcept>
 #include <unordered_map>
+#include <zlib.h>
 
 namespace Imaging
 {
@@ -162,7 +166,7 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(std::ostream& ostream, const Image& image, int32_t compressionLevel)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -209,6 +213,10 @@ namespace Imaging
             }
 
             png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+            if (compressionLevel != DefaultCompressionLevel)
+            {
+                png_set_compression_level(png_ptr, compressionLevel);
+            }
 
             // Set error handler
             if (setjmp(png_jmpbuf(png_ptr)))
@@ -329,12 +337,12 @@ namespace Imaging
         return ReadFromStream(istream, format);
     }
 
-    void WriteToFile(const std::string_view& path, const Image& image, IMAGE_FORMAT format)
+    void WriteToFile(const std::string_view& path, const Image& image, IMAGE_FORMAT format, int32_t compressionLevel)
     {
         switch (format)
         {
             case IMAGE_FORMAT::AUTOMATIC:
-                WriteToFile(path, image, GetImageFormatFromPath(path));
+                WriteToFile(path, image, GetImageFormatFromPath(path), compressionLevel);
                 break;
             case IMAGE_FORMAT::PNG:
             {
@@ -344,11 +352,258 @@ namespace Imaging
 #else
                 std::ofstream fs(path.data(), std::ios::binary);
 #endif
-                WritePng(fs, image);
+                WritePng(fs, image, compressionLevel);
                 break;
             }
             default:
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    std::vector<uint8_t> WriteToBuffer(const Image& image, IMAGE_FORMAT format, int32_t compressionLevel)
+    {
+        std::ostringstream stream(std::ios::binary);
+        switch (format)
+        {
+            case IMAGE_FORMAT::PNG:
+                WritePng(stream, image, compressionLevel);
+                break;
+            default:
+                throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
+        }
+
+        const auto data = stream.str();
+        return std::vector<uint8_t>(data.begin(), data.end());
+    }
+
+    // Largest distance deflate can refer back to, the tail of the previous band is used as the dictionary of the next
+    constexpr size_t DEFLATE_WINDOW_SIZE = 32768;
+
+    static void WritePngChunk(std::ostream& stream, const char* type, const uint8_t* data, size_t length)
+    {
+        const auto length32 = static_cast<uint32_t>(length);
+        const uint8_t header[8] = {
+            static_cast<uint8_t>(length32 >> 24),
+            static_cast<uint8_t>(length32 >> 16),
+            static_cast<uint8_t>(length32 >> 8),
+            static_cast<uint8_t>(length32),
+            static_cast<uint8_t>(type[0]),
+            static_cast<uint8_t>(type[1]),
+            static_cast<uint8_t>(type[2]),
+            static_cast<uint8_t>(type[3]),
+        };
+        auto crc = crc32(0, header + 4, 4);
+        if (length != 0)
+        {
+            crc = crc32(crc, data, length32);
+        }
+        const uint8_t footer[4] = {
+            static_cast<uint8_t>(crc >> 24),
+            static_cast<uint8_t>(crc >> 16),
+            static_cast<uint8_t>(crc >> 8),
+            static_cast<uint8_t>(crc),
+        };
+
+        stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+        stream.write(reinterpret_cast<const char*>(data), length);
+        stream.write(reinterpret_cast<const char*>(footer), sizeof(footer));
+    }
+
+    static void WritePngChunk(std::ostream& stream, const char* type, const std::vector<uint8_t>& data)
+    {
+        WritePngChunk(stream, type, data.data(), data.size());
+    }
+
+    /**
+     * Deflates a band as raw deflate data that continues the stream of the previous bands. All but the last band end
+     * with a sync flush so that the pieces can simply be concatenated.
+     */
+    static void DeflateBand(
+        std::vector<uint8_t>& output, const std::vector<uint8_t>& input, const uint8_t* dictionary, size_t dictionaryLength,
+        int32_t compressionLevel, bool last)
+    {
+        z_stream strm{};
+        if (deflateInit2(&strm, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            throw std::runtime_error("deflateInit2 failed.");
+        }
+        if (dictionaryLength != 0)
+        {
+            deflateSetDictionary(&strm, dictionary, static_cast<uInt>(dictionaryLength));
+        }
+
+        output.resize(deflateBound(&strm, static_cast<uLong>(input.size())) + 16);
+        strm.next_in = const_cast<Bytef*>(input.data());
+        strm.avail_in = static_cast<uInt>(input.size());
+
+        const int flush = last ? Z_FINISH : Z_SYNC_FLUSH;
+        int result;
+        do
+        {
+            if (strm.total_out == output.size())
+            {
+                output.resize(output.size() * 2);
+            }
+            strm.next_out = output.data() + strm.total_out;
+            strm.avail_out = static_cast<uInt>(output.size() - strm.total_out);
+            result = deflate(&strm, flush);
+            if (result == Z_STREAM_ERROR)
+            {
+                deflateEnd(&strm);
+                throw std::runtime_error("deflate failed.");
+            }
+        } while (last ? result != Z_STREAM_END : strm.avail_out == 0);
+
+        output.resize(strm.total_out);
+        deflateEnd(&strm);
+    }
+
+    /**
+     * The second byte of the zlib header records how hard the stream was compressed, in the same four steps zlib uses
+     * itself. Decoders ignore it, but it keeps the file identical to what one deflate call would have produced.
+     */
+    static uint8_t GetZlibHeaderFlags(int32_t compressionLevel)
+    {
+        if (compressionLevel == 0 || compressionLevel == 1)
+            return 0x01;
+        if (compressionLevel >= 2 && compressionLevel <= 5)
+            return 0x5E;
+        if (compressionLevel >= 7)
+            return 0xDA;
+        return 0x9C;
+    }
+
+    PngBandWriter::PngBandWriter(
+        const std::string_view& path, uint32_t width, uint32_t height, const GamePalette& palette, int32_t compressionLevel)
+        : _width(width)
+        , _height(height)
+        , _adler(adler32(0, nullptr, 0))
+        , _compressionLevel(compressionLevel)
+    {
+#if defined(_WIN32) && !defined(__MINGW32__)
+        auto pathW = String::ToWideChar(path);
+        _stream = std::make_unique<std::ofstream>(pathW, std::ios::binary);
+#else
+        _stream = std::make_unique<std::ofstream>(std::string(path), std::ios::binary);
+#endif
+        if (!_stream->good())
+        {
+            throw std::runtime_error("Unable to open " + std::string(path) + " for writing.");
+        }
+        _stream->exceptions(std::ios::failbit | std::ios::badbit);
+
+        static constexpr uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        _stream->write(reinterpret_cast<const char*>(signature), sizeof(signature));
+
+        const uint8_t header[] = {
+            static_cast<uint8_t>(width >> 24),
+            static_cast<uint8_t>(width >> 16),
+            static_cast<uint8_t>(width >> 8),
+            static_cast<uint8_t>(width),
+            static_cast<uint8_t>(height >> 24),
+            static_cast<uint8_t>(height >> 16),
+            static_cast<uint8_t>(height >> 8),
+            static_cast<uint8_t>(height),
+            8,                      // Bit depth
+            PNG_COLOR_TYPE_PALETTE, // Colour type
+            0,                      // Compression method
+            0,                      // Filter method
+            0,                      // Interlace method
+        };
+        WritePngChunk(*_stream, "IHDR", header, sizeof(header));
+
+        std::vector<uint8_t> colours;
+        colours.reserve(PALETTE_SIZE * 3);
+        for (uint16_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            const auto entry = palette[i];
+            colours.push_back(entry.Red);
+            colours.push_back(entry.Green);
+            colours.push_back(entry.Blue);
+        }
+        WritePngChunk(*_stream, "PLTE", colours);
+
+        // Same as WritePng, palette index 0 is transparent
+        const uint8_t transparency[] = { 0 };
+        WritePngChunk(*_stream, "tRNS", transparency, sizeof(transparency));
+
+        std::vector<uint8_t> text(std::begin("Software"), std::end("Software"));
+        text.insert(text.end(), gVersionInfoFull, gVersionInfoFull + std::strlen(gVersionInfoFull));
+        WritePngChunk(*_stream, "tEXt", text);
+
+        // zlib header of the stream the bands are deflated into: deflate with a 32K window
+        const uint8_t zlibHeader[] = { 0x78, GetZlibHeaderFlags(compressionLevel) };
+        WritePngChunk(*_stream, "IDAT", zlibHeader, sizeof(zlibHeader));
+    }
+
+    void PngBandWriter::WriteBand(const uint8_t* pixels, uint32_t stride, uint32_t rows)
+    {
+        if (rows == 0)
+            return;
+        if (rows > _height - _rowsWritten)
+        {
+            throw std::runtime_error("PNG band exceeds the height of the image.");
+        }
+
+        auto& band = _bands.emplace_back();
+        band.Data.resize(static_cast<size_t>(_width + 1) * rows);
+        auto dst = band.Data.data();
+        for (uint32_t y = 0; y < rows; y++)
+        {
+            // Paletted images are written unfiltered, like libpng does by default
+            *dst++ = PNG_FILTER_TYPE_BASE;
+            std::copy_n(pixels, _width, dst);
+            dst += _width;
+            pixels += stride;
+        }
+
+        _rowsWritten += rows;
+        band.Last = _rowsWritten == _height;
+        if (band.Last || _bands.size() >= JobPool::GetConcurrency())
+        {
+            FlushBands();
+        }
+    }
+
+    void PngBandWriter::Finish()
+    {
+        if (_rowsWritten != _height)
+        {
+            throw std::runtime_error("PNG image is missing rows.");
+        }
+
+        const uint8_t adler[] = {
+            static_cast<uint8_t>(_adler >> 24),
+            static_cast<uint8_t>(_adler >> 16),
+            static_cast<uint8_t>(_adler >> 8),
+            static_cast<uint8_t>(_adler),
+        };
+        WritePngChunk(*_stream, "IDAT", adler, sizeof(adler));
+        WritePngChunk(*_stream, "IEND", nullptr, 0);
+        _stream->flush();
+    }
+
+    void PngBandWriter::FlushBands()
+    {
+        JobPool::ParallelFor(_bands.size(), 1, [this](size_t i) {
+            auto& band = _bands[i];
+            const auto& dictionary = i == 0 ? _dictionary : _bands[i - 1].Data;
+            const size_t dictionaryLength = std::min(dictionary.size(), DEFLATE_WINDOW_SIZE);
+            DeflateBand(
+                band.Compressed, band.Data, dictionary.data() + dictionary.size() - dictionaryLength, dictionaryLength,
+                _compressionLevel, band.Last);
+            band.Adler = adler32(adler32(0, nullptr, 0), band.Data.data(), static_cast<uInt>(band.Data.size()));
+        });
+
+        for (const auto& band : _bands)
+        {
+            WritePngChunk(*_stream, "IDAT", band.Compressed);
+            _adler = adler32_combine(_adler, band.Adler, static_cast<z_off_t>(band.Data.size()));
+        }
+
+        const auto& lastData = _bands.back().Data;
+        const size_t tailLength = std::min(lastData.size(), DEFLATE_WINDOW_SIZE);
+        _dictionary.assign(lastData.end() - tailLength, lastData.end());
+        _bands.clear();
+    }
 } // namespace Imaging
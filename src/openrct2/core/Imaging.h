@@ -15,6 +15,7 @@
 #include <functional>
 #include <istream>
 #include <memory>
+#include <ostream>
 #include <string_view>
 #include <vector>
 
@@ -46,10 +47,53 @@ using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
 
 namespace Imaging
 {
+    // zlib compression level for PNGs, 0 (fastest) to 9 (smallest) or -1 for the zlib default
+    constexpr int32_t DefaultCompressionLevel = -1;
+
     IMAGE_FORMAT GetImageFormatFromPath(const std::string_view& path);
     Image ReadFromFile(const std::string_view& path, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
-    void WriteToFile(const std::string_view& path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+    void WriteToFile(
+        const std::string_view& path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC,
+        int32_t compressionLevel = DefaultCompressionLevel);
+    std::vector<uint8_t> WriteToBuffer(
+        const Image& image, IMAGE_FORMAT format, int32_t compressionLevel = DefaultCompressionLevel);
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
+
+    /**
+     * Writes an 8-bit paletted PNG that is handed over in bands of rows, so the whole image never has to be in memory.
+     * Bands are deflated as separate pieces of one zlib stream, a batch of them at a time on the job pool.
+     */
+    class PngBandWriter
+    {
+    private:
+        struct Band
+        {
+            std::vector<uint8_t> Data; // Rows, each prefixed by its filter type
+            std::vector<uint8_t> Compressed;
+            uint32_t Adler{};
+            bool Last{};
+        };
+
+        std::unique_ptr<std::ostream> _stream;
+        uint32_t _width{};
+        uint32_t _height{};
+        uint32_t _rowsWritten{};
+        uint32_t _adler{};
+        int32_t _compressionLevel{};
+        std::vector<Band> _bands;
+        std::vector<uint8_t> _dictionary;
+
+    public:
+        PngBandWriter(
+            const std::string_view& path, uint32_t width, uint32_t height, const GamePalette& palette,
+            int32_t compressionLevel = DefaultCompressionLevel);
+
+        void WriteBand(const uint8_t* pixels, uint32_t stride, uint32_t rows);
+        void Finish();
+
+    private:
+        void FlushBands();
+    };
 } // namespace Imaging
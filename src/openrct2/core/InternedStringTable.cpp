@@ -0,0 +1,78 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "InternedStringTable.h"
+
+#include "Guard.hpp"
+
+interned_string_id InternedStringTable::Intern(std::string_view value)
+{
+    if (value.empty())
+    {
+        return INTERNED_STRING_NULL;
+    }
+
+    auto it = _lookup.find(value);
+    if (it != _lookup.end())
+    {
+        _entries[it->second - 1].References++;
+        return it->second;
+    }
+
+    interned_string_id id;
+    if (_freeIds.empty())
+    {
+        _entries.emplace_back();
+        id = static_cast<interned_string_id>(_entries.size());
+    }
+    else
+    {
+        id = _freeIds.back();
+        _freeIds.pop_back();
+    }
+
+    auto& entry = _entries[id - 1];
+    entry.Value = value;
+    entry.References = 1;
+    _lookup.emplace(entry.Value, id);
+    return id;
+}
+
+void InternedStringTable::Release(interned_string_id id)
+{
+    if (id == INTERNED_STRING_NULL || id > _entries.size())
+    {
+        return;
+    }
+
+    auto& entry = _entries[id - 1];
+    Guard::Assert(entry.References > 0, "Interned string released more often than it was interned");
+    if (entry.References > 0 && --entry.References == 0)
+    {
+        _lookup.erase(entry.Value);
+        entry.Value = std::string();
+        _freeIds.push_back(id);
+    }
+}
+
+const utf8* InternedStringTable::Get(interned_string_id id) const
+{
+    if (id == INTERNED_STRING_NULL || id > _entries.size() || _entries[id - 1].References == 0)
+    {
+        return nullptr;
+    }
+    return _entries[id - 1].Value.c_str();
+}
+
+void InternedStringTable::Clear()
+{
+    _lookup.clear();
+    _entries.clear();
+    _freeIds.clear();
+}
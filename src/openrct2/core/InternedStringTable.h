@@ -0,0 +1,66 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using interned_string_id = uint32_t;
+constexpr interned_string_id INTERNED_STRING_NULL = 0;
+
+/**
+ * Stores each distinct string once and hands out a stable id for it. Ids are reference counted, an id and its string
+ * stay valid until every reference to it has been released, after which the id may be handed out again.
+ */
+class InternedStringTable
+{
+private:
+    struct Entry
+    {
+        std::string Value;
+        uint32_t References{};
+    };
+
+    // Entry of id n is at n - 1, a deque so that the lookup can refer to the strings in place
+    std::deque<Entry> _entries;
+    std::unordered_map<std::string_view, interned_string_id> _lookup;
+    std::vector<interned_string_id> _freeIds;
+
+public:
+    /**
+     * Returns the id of the given string with a new reference to it, or INTERNED_STRING_NULL for an empty string.
+     */
+    interned_string_id Intern(std::string_view value);
+
+    /**
+     * Releases a reference taken by Intern.
+     */
+    void Release(interned_string_id id);
+
+    /**
+     * Returns the string of the given id or nullptr for INTERNED_STRING_NULL.
+     */
+    const utf8* Get(interned_string_id id) const;
+
+    /**
+     * Forgets all strings, for when everything holding a reference is discarded at once.
+     */
+    void Clear();
+
+    size_t GetCount() const
+    {
+        return _lookup.size();
+    }
+};
@@ -11,66 +11,267 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
 
-JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
-    : WorkFn(workFn)
-    , CompletionFn(completionFn)
-{
-}
+#ifndef _WIN32
+#    include <pthread.h>
+#endif
 
-JobPool::JobPool(size_t maxThreads)
+/**
+ * Persistent worker threads, each with its own task deque. A worker takes the newest task from its own deque and
+ * steals the oldest task from the other deques once its own runs dry. Tasks added from outside the scheduler are
+ * spread over the deques round robin, tasks added by a worker go to its own deque.
+ */
+class JobScheduler
 {
-    maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
-    for (size_t n = 0; n < maxThreads; n++)
+private:
+    struct WorkQueue
+    {
+        std::mutex Mutex;
+        std::deque<JobPool::TaskData> Tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> _queues;
+    std::vector<std::thread> _threads;
+    std::atomic<size_t> _nextQueue = { 0 };
+    std::atomic<size_t> _queued = { 0 };
+    std::atomic_bool _shouldStop = { false };
+    std::condition_variable _condPending;
+    std::mutex _sleepMutex;
+    bool _stoppedForFork = false;
+
+    static thread_local size_t _workerIndex;
+    static constexpr size_t NotAWorker = SIZE_MAX;
+
+public:
+    static JobScheduler& Get()
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        static JobScheduler scheduler;
+        return scheduler;
     }
-}
 
-JobPool::~JobPool()
-{
+    JobScheduler()
     {
-        unique_lock lock(_mutex);
-        _shouldStop = true;
-        _condPending.notify_all();
+        // The thread calling Join() also runs tasks, so one less worker is needed.
+        const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        const size_t numWorkers = std::max<size_t>(1, hardwareThreads - 1);
+        for (size_t n = 0; n < numWorkers; n++)
+        {
+            _queues.push_back(std::make_unique<WorkQueue>());
+        }
+        StartWorkers();
+
+#ifndef _WIN32
+        // Only the forking thread exists in a child process, so the workers are stopped around a fork and started again
+        // on both sides. Queued tasks stay in the deques and are picked up by the new workers.
+        pthread_atfork([] { Get().OnForkPrepare(); }, [] { Get().OnForkDone(); }, [] { Get().OnForkDone(); });
+#endif
+    }
+
+    ~JobScheduler()
+    {
+        StopWorkers();
+    }
+
+    size_t GetConcurrency() const
+    {
+        return _threads.size() + 1;
+    }
+
+    void Push(JobPool::TaskData&& task)
+    {
+        const size_t queueIndex = _workerIndex != NotAWorker ? _workerIndex : (_nextQueue++ % _queues.size());
+        {
+            auto& queue = *_queues[queueIndex];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            queue.Tasks.push_back(std::move(task));
+        }
+        _queued++;
+
+        // Lock so that a worker that just found no work can not miss the notification before it starts waiting.
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _condPending.notify_one();
+    }
+
+    /**
+     * Runs one queued task on the calling thread, only a task of the given pool when one is given. Returns false if
+     * there was nothing to run.
+     */
+    bool RunOne(const JobPool* pool = nullptr)
+    {
+        auto task = Pop(pool);
+        if (!task)
+            return false;
+
+        task->WorkFn();
+        task->Pool->OnTaskComplete(std::move(task->CompletionFn));
+        return true;
+    }
+
+private:
+#ifndef _WIN32
+    /**
+     * A worker can not wait for itself to stop, so the workers are only stopped when fork is called from a thread
+     * outside the scheduler. The child of a fork from within a task has no workers and must not use JobPool, it may
+     * only exec or exit.
+     */
+    void OnForkPrepare()
+    {
+        _stoppedForFork = _workerIndex == NotAWorker;
+        if (_stoppedForFork)
+        {
+            StopWorkers();
+        }
+    }
+
+    void OnForkDone()
+    {
+        if (_stoppedForFork)
+        {
+            _stoppedForFork = false;
+            StartWorkers();
+        }
+    }
+#endif
+
+    void StartWorkers()
+    {
+        _shouldStop = false;
+        for (size_t n = 0; n < _queues.size(); n++)
+        {
+            _threads.emplace_back(&JobScheduler::WorkerMain, this, n);
+        }
+    }
+
+    void StopWorkers()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _shouldStop = true;
+            _condPending.notify_all();
+        }
+
+        for (auto&& th : _threads)
+        {
+            assert(th.joinable() != false);
+            th.join();
+        }
+        _threads.clear();
+    }
+
+    std::optional<JobPool::TaskData> Pop(const JobPool* pool)
+    {
+        if (_queued == 0)
+            return std::nullopt;
+
+        const size_t numQueues = _queues.size();
+        const bool isWorker = _workerIndex != NotAWorker;
+        const size_t first = isWorker ? _workerIndex : 0;
+        for (size_t n = 0; n < numQueues; n++)
+        {
+            auto& queue = *_queues[(first + n) % numQueues];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            if (queue.Tasks.empty())
+                continue;
+
+            // Own queue newest first as its data is most likely still in cache, other queues oldest first.
+            const bool newestFirst = n == 0 && isWorker;
+            auto it = newestFirst ? std::prev(queue.Tasks.end()) : queue.Tasks.begin();
+            if (pool != nullptr)
+            {
+                auto isFromPool = [pool](const JobPool::TaskData& task) { return task.Pool == pool; };
+                if (newestFirst)
+                {
+                    auto rit = std::find_if(queue.Tasks.rbegin(), queue.Tasks.rend(), isFromPool);
+                    if (rit == queue.Tasks.rend())
+                        continue;
+                    it = std::prev(rit.base());
+                }
+                else
+                {
+                    it = std::find_if(queue.Tasks.begin(), queue.Tasks.end(), isFromPool);
+                    if (it == queue.Tasks.end())
+                        continue;
+                }
+            }
+
+            std::optional<JobPool::TaskData> task = std::move(*it);
+            queue.Tasks.erase(it);
+            _queued--;
+            return task;
+        }
+        return std::nullopt;
     }
 
-    for (auto&& th : _threads)
+    void WorkerMain(size_t workerIndex)
     {
-        assert(th.joinable() != false);
-        th.join();
+        _workerIndex = workerIndex;
+        while (!_shouldStop)
+        {
+            if (RunOne())
+                continue;
+
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _condPending.wait(lock, [this]() { return _shouldStop || _queued != 0; });
+        }
     }
+};
+
+thread_local size_t JobScheduler::_workerIndex = JobScheduler::NotAWorker;
+
+JobPool::~JobPool()
+{
+    // Tasks hold a pointer to their pool so they must all have finished.
+    Join();
+}
+
+void JobPool::AddTask(JobTask workFn, JobTask completionFn)
+{
+    _outstanding++;
+    JobScheduler::Get().Push({ std::move(workFn), std::move(completionFn), this });
 }
 
-void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
+void JobPool::OnTaskComplete(JobTask completionFn)
 {
     unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    if (completionFn)
+    {
+        _completed.push_back(std::move(completionFn));
+    }
+    _outstanding--;
+    _condComplete.notify_all();
 }
 
 void JobPool::Join(std::function<void()> reportFn)
 {
-    unique_lock lock(_mutex);
+    auto& scheduler = JobScheduler::Get();
     while (true)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        // Help out with the queued work of this pool. Work of other pools is left alone, it may be long running or
+        // expect to run on a worker, and waiting on it here would hold up this pool's caller.
+        bool ranTask = _outstanding != 0 && scheduler.RunOne(this);
+
+        unique_lock lock(_mutex);
+        if (!ranTask && _outstanding != 0 && _completed.empty())
+        {
+            // Everything left is running on other threads, wait for one of them to finish.
+            _condComplete.wait(lock, [this]() { return _outstanding == 0 || !_completed.empty(); });
+        }
 
         // Dispatch all completion callbacks if there are any.
         while (!_completed.empty())
         {
-            auto taskData = _completed.front();
+            auto completionFn = std::move(_completed.front());
             _completed.pop_front();
 
-            if (taskData.CompletionFn)
-            {
-                lock.unlock();
+            lock.unlock();
 
-                taskData.CompletionFn();
+            completionFn();
 
-                lock.lock();
-            }
+            lock.lock();
         }
 
         if (reportFn)
@@ -83,7 +284,7 @@ void JobPool::Join(std::function<void()> reportFn)
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (_completed.empty() && _outstanding == 0)
         {
             break;
         }
@@ -92,34 +293,10 @@ void JobPool::Join(std::function<void()> reportFn)
 
 size_t JobPool::CountPending()
 {
-    return _pending.size();
+    return _outstanding;
 }
 
-void JobPool::ProcessQueue()
+size_t JobPool::GetConcurrency()
 {
-    unique_lock lock(_mutex);
-    do
-    {
-        // Wait for work or cancelation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
-
-        if (!_pending.empty())
-        {
-            _processing++;
-
-            auto taskData = _pending.front();
-            _pending.pop_front();
-
-            lock.unlock();
-
-            taskData.WorkFn();
-
-            lock.lock();
-
-            _completed.push_back(taskData);
-
-            _processing--;
-            _condComplete.notify_one();
-        }
-    } while (!_shouldStop);
+    return JobScheduler::Get().GetConcurrency();
 }
@@ -9,44 +9,233 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <thread>
-#include <vector>
+#include <new>
+#include <type_traits>
+#include <utility>
 
+/**
+ * A type erased void() callable that stores small callables inline rather than allocating them on the heap like
+ * std::function does. Callables that do not fit are moved into a heap allocation.
+ */
+class JobTask
+{
+private:
+    static constexpr size_t InlineSize = 64;
+
+    struct Operations
+    {
+        void (*Invoke)(void* storage);
+        void (*Move)(void* dst, void* src);
+        void (*Destroy)(void* storage);
+    };
+
+    template<typename TFn> struct InlineOperations
+    {
+        static void Invoke(void* storage)
+        {
+            (*static_cast<TFn*>(storage))();
+        }
+        static void Move(void* dst, void* src)
+        {
+            new (dst) TFn(std::move(*static_cast<TFn*>(src)));
+            static_cast<TFn*>(src)->~TFn();
+        }
+        static void Destroy(void* storage)
+        {
+            static_cast<TFn*>(storage)->~TFn();
+        }
+        static constexpr Operations Table = { &Invoke, &Move, &Destroy };
+    };
+
+    template<typename TFn> struct HeapOperations
+    {
+        static TFn*& Get(void* storage)
+        {
+            return *static_cast<TFn**>(storage);
+        }
+        static void Invoke(void* storage)
+        {
+            (*Get(storage))();
+        }
+        static void Move(void* dst, void* src)
+        {
+            new (dst) TFn*(Get(src));
+            Get(src) = nullptr;
+        }
+        static void Destroy(void* storage)
+        {
+            delete Get(storage);
+        }
+        static constexpr Operations Table = { &Invoke, &Move, &Destroy };
+    };
+
+    alignas(std::max_align_t) unsigned char _storage[InlineSize];
+    const Operations* _operations = nullptr;
+
+public:
+    JobTask() = default;
+
+    template<typename TFn, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TFn>, JobTask>>>
+    JobTask(TFn&& fn)
+    {
+        using TFnValue = std::decay_t<TFn>;
+        if constexpr (
+            sizeof(TFnValue) <= InlineSize && alignof(TFnValue) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<TFnValue>)
+        {
+            new (_storage) TFnValue(std::forward<TFn>(fn));
+            _operations = &InlineOperations<TFnValue>::Table;
+        }
+        else
+        {
+            new (_storage) TFnValue*(new TFnValue(std::forward<TFn>(fn)));
+            _operations = &HeapOperations<TFnValue>::Table;
+        }
+    }
+
+    JobTask(JobTask&& other) noexcept
+    {
+        if (other._operations != nullptr)
+        {
+            other._operations->Move(_storage, other._storage);
+            _operations = other._operations;
+            other._operations = nullptr;
+        }
+    }
+
+    JobTask& operator=(JobTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            if (other._operations != nullptr)
+            {
+                other._operations->Move(_storage, other._storage);
+                _operations = other._operations;
+                other._operations = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    JobTask(const JobTask&) = delete;
+    JobTask& operator=(const JobTask&) = delete;
+
+    ~JobTask()
+    {
+        Reset();
+    }
+
+    explicit operator bool() const
+    {
+        return _operations != nullptr;
+    }
+
+    void operator()()
+    {
+        _operations->Invoke(_storage);
+    }
+
+    void Reset()
+    {
+        if (_operations != nullptr)
+        {
+            _operations->Destroy(_storage);
+            _operations = nullptr;
+        }
+    }
+};
+
+/**
+ * A group of tasks that run on the shared work-stealing scheduler. Creating a JobPool is cheap, all worker threads
+ * are owned by the scheduler and live for the lifetime of the process. Join() waits for the tasks added to this pool
+ * only and runs the ones still queued on the calling thread while it waits, so pools may be used from within tasks.
+ */
 class JobPool
 {
 private:
     struct TaskData
     {
-        const std::function<void()> WorkFn;
-        const std::function<void()> CompletionFn;
-
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn);
+        JobTask WorkFn;
+        JobTask CompletionFn;
+        JobPool* Pool;
     };
 
-    std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
-    std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
-    std::condition_variable _condPending;
+    std::atomic<size_t> _outstanding = { 0 };
+    std::deque<JobTask> _completed;
     std::condition_variable _condComplete;
     std::mutex _mutex;
 
     using unique_lock = std::unique_lock<std::mutex>;
 
+    friend class JobScheduler;
+
 public:
-    JobPool(size_t maxThreads = 255);
+    JobPool() = default;
     ~JobPool();
 
-    void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    void AddTask(JobTask workFn, JobTask completionFn = {});
     void Join(std::function<void()> reportFn = nullptr);
     size_t CountPending();
 
+    /**
+     * Number of threads that can run tasks at the same time, including the thread calling Join().
+     */
+    static size_t GetConcurrency();
+
+    /**
+     * Calls fn(i) for every i in [0, count) spread across the scheduler and returns once all calls are done.
+     * The range is split into a few chunks per thread so that uneven items still balance out through stealing.
+     */
+    template<typename TFn> static void ParallelFor(size_t count, TFn&& fn)
+    {
+        const size_t chunkSize = std::max<size_t>(1, count / (GetConcurrency() * 4));
+        ParallelFor(count, chunkSize, std::forward<TFn>(fn));
+    }
+
+    /**
+     * Same as above but with a given number of items per task, a chunk size of 1 suits items that differ a lot in cost.
+     */
+    template<typename TFn> static void ParallelFor(size_t count, size_t chunkSize, TFn&& fn)
+    {
+        if (count == 0)
+            return;
+
+        if (count == 1 || GetConcurrency() <= 1)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                fn(i);
+            }
+            return;
+        }
+
+        chunkSize = std::max<size_t>(1, chunkSize);
+        JobPool pool;
+        for (size_t begin = 0; begin < count; begin += chunkSize)
+        {
+            const size_t end = std::min(count, begin + chunkSize);
+            pool.AddTask([&fn, begin, end]() {
+                for (size_t i = begin; i < end; i++)
+                {
+                    fn(i);
+                }
+            });
+        }
+        pool.Join();
+    }
+
 private:
-    void ProcessQueue();
+    void OnTaskComplete(JobTask completionFn);
 };
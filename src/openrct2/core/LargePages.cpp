@@ -0,0 +1,207 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#include "LargePages.h"
+
+#include <atomic>
+
+namespace LargePages
+{
+    static std::atomic<bool> _enabled{ true };
+
+    void SetEnabled(bool enabled)
+    {
+        _enabled = enabled;
+    }
+
+    bool IsEnabled()
+    {
+        return _enabled;
+    }
+
+    static size_t RoundUp(size_t size, size_t alignment)
+    {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    static void TouchPages(void* ptr, size_t size, size_t pageSize)
+    {
+        auto bytes = static_cast<volatile uint8_t*>(ptr);
+        for (size_t offset = 0; offset < size; offset += pageSize)
+        {
+            bytes[offset] = 0;
+        }
+    }
+
+#ifdef _WIN32
+    static size_t GetPageSize()
+    {
+        static const size_t pageSize = [] {
+            SYSTEM_INFO info{};
+            GetSystemInfo(&info);
+            return static_cast<size_t>(info.dwPageSize);
+        }();
+        return pageSize;
+    }
+
+    /**
+     * Large pages need the lock pages in memory privilege, which is disabled in the process token even when the user
+     * holds it. Returns the large page size or 0 when large pages can not be used.
+     */
+    static size_t GetUsableLargePageSize()
+    {
+        static const size_t largePageSize = []() -> size_t {
+            auto minimum = GetLargePageMinimum();
+            if (minimum == 0)
+                return 0;
+
+            HANDLE token;
+            if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+                return 0;
+
+            TOKEN_PRIVILEGES privileges{};
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+            bool enabled = LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid)
+                && AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr)
+                && GetLastError() == ERROR_SUCCESS;
+            CloseHandle(token);
+            return enabled ? minimum : 0;
+        }();
+        return largePageSize;
+    }
+
+    void* Allocate(size_t size, bool prefault)
+    {
+        // Large pages are locked in memory, they are always backed and do not need to be prefaulted
+        auto largePageSize = _enabled ? GetUsableLargePageSize() : 0;
+        if (largePageSize != 0 && size >= largePageSize)
+        {
+            auto result = VirtualAlloc(
+                nullptr, RoundUp(size, largePageSize), MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (result != nullptr)
+                return result;
+        }
+
+        auto result = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (result != nullptr && prefault)
+        {
+            TouchPages(result, size, GetPageSize());
+        }
+        return result;
+    }
+
+    void* Reserve(size_t size)
+    {
+        // Large pages are always backed, so only normal pages are used
+        return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    }
+
+    void Free(void* ptr, [[maybe_unused]] size_t size)
+    {
+        if (ptr != nullptr)
+        {
+            VirtualFree(ptr, 0, MEM_RELEASE);
+        }
+    }
+
+    void Discard(void* ptr, size_t size)
+    {
+        // Fails for large pages, which can not be given back without freeing them
+        VirtualAlloc(ptr, size, MEM_RESET, PAGE_READWRITE);
+    }
+#else
+    // Size of a transparent huge page on x86-64 and of the usual 2 MiB block on arm64
+    static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+    static size_t GetPageSize()
+    {
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return pageSize;
+    }
+
+    /**
+     * Huge page sized allocations are rounded up to whole huge pages, so that the mapping can be backed by them
+     * entirely. This only depends on the size so that Free can work out the same length again.
+     */
+    static size_t GetMappingSize(size_t size)
+    {
+        return RoundUp(size, size >= HugePageSize ? HugePageSize : GetPageSize());
+    }
+
+    void* Allocate(size_t size, bool prefault)
+    {
+        const size_t mappingSize = GetMappingSize(size);
+        const size_t alignment = mappingSize >= HugePageSize ? HugePageSize : GetPageSize();
+
+        // Over-allocate so that the mapping can be aligned to a huge page, then trim the ends
+        const size_t reserveSize = mappingSize + alignment - GetPageSize();
+        auto reserved = mmap(nullptr, reserveSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED)
+            return nullptr;
+
+        auto start = reinterpret_cast<uintptr_t>(reserved);
+        auto aligned = RoundUp(start, alignment);
+        if (aligned != start)
+        {
+            munmap(reserved, aligned - start);
+        }
+        auto end = aligned + mappingSize;
+        auto reservedEnd = start + reserveSize;
+        if (reservedEnd != end)
+        {
+            munmap(reinterpret_cast<void*>(end), reservedEnd - end);
+        }
+
+        auto result = reinterpret_cast<void*>(aligned);
+#    ifdef MADV_HUGEPAGE
+        if (_enabled && mappingSize >= HugePageSize)
+        {
+            madvise(result, mappingSize, MADV_HUGEPAGE);
+        }
+#    endif
+        if (prefault)
+        {
+            TouchPages(result, mappingSize, GetPageSize());
+        }
+        return result;
+    }
+
+    void* Reserve(size_t size)
+    {
+        return Allocate(size, false);
+    }
+
+    void Free(void* ptr, size_t size)
+    {
+        if (ptr != nullptr)
+        {
+            munmap(ptr, GetMappingSize(size));
+        }
+    }
+
+    void Discard(void* ptr, size_t size)
+    {
+        // Only whole pages inside the range can be given back
+        auto start = RoundUp(reinterpret_cast<uintptr_t>(ptr), GetPageSize());
+        auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / GetPageSize() * GetPageSize();
+        if (end > start)
+        {
+            madvise(reinterpret_cast<void*>(start), end - start, MADV_DONTNEED);
+        }
+    }
+#endif
+} // namespace LargePages
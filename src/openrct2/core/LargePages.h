@@ -0,0 +1,48 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <cstddef>
+
+/**
+ * Allocations for the large game pools that are walked over every tick, such as the tile elements and the sprites.
+ * Memory comes straight from the OS in whole pages and, when enabled, is backed by large pages (transparent huge pages
+ * on Linux, large pages on Windows when the user holds the lock pages privilege) to cut down on TLB misses.
+ */
+namespace LargePages
+{
+    // Allocations smaller than this are not worth whole pages and use the normal heap
+    constexpr size_t MinimumSize = 64 * 1024;
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled();
+
+    /**
+     * Allocates zeroed memory, aligned to the page size. With prefault set every page is touched before returning so
+     * the first pass over the memory does not have to take the page faults, otherwise pages are only backed once they
+     * are first written.
+     */
+    void* Allocate(size_t size, bool prefault);
+
+    /**
+     * Allocates zeroed memory for a pool that may never be used in full. Pages are only backed once they are first
+     * written, so large pages are only used where they can be backed on demand (transparent huge pages on Linux).
+     */
+    void* Reserve(size_t size);
+    void Free(void* ptr, size_t size);
+
+    /**
+     * Gives the pages of a range back to the OS while keeping the allocation. The range reads as undefined data after
+     * this and must be written before it is used again.
+     */
+    void Discard(void* ptr, size_t size);
+} // namespace LargePages
@@ -0,0 +1,113 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+        auto pathW = String::ToWideChar(path);
+        auto hFile = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE)
+        {
+            throw IOException("Unable to open '" + path + "'");
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(hFile, &fileSize))
+        {
+            CloseHandle(hFile);
+            throw IOException("Unable to get size of '" + path + "'");
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        if (_size == 0)
+        {
+            CloseHandle(hFile);
+            return;
+        }
+
+        // The view keeps the file mapped, so both handles can be closed straight away
+        auto hMapping = CreateFileMappingW(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(hFile);
+        if (hMapping == nullptr)
+        {
+            throw IOException("Unable to map '" + path + "'");
+        }
+        _data = static_cast<uint8_t*>(MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0));
+        CloseHandle(hMapping);
+        if (_data == nullptr)
+        {
+            throw IOException("Unable to map '" + path + "'");
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException("Unable to open '" + path + "'");
+        }
+
+        struct stat statInfo
+        {
+        };
+        if (fstat(fd, &statInfo) != 0)
+        {
+            close(fd);
+            throw IOException("Unable to get size of '" + path + "'");
+        }
+        _size = static_cast<size_t>(statInfo.st_size);
+        if (_size == 0)
+        {
+            close(fd);
+            return;
+        }
+
+        // The mapping keeps the file open, so the descriptor can be closed straight away
+        auto data = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            throw IOException("Unable to map '" + path + "'");
+        }
+        _data = static_cast<uint8_t*>(data);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+            munmap(_data, _size);
+        }
+    }
+#endif
+} // namespace OpenRCT2
@@ -0,0 +1,45 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+
+namespace OpenRCT2
+{
+    /**
+     * A whole file mapped into memory, the contents are only read from disk once they are accessed. The mapping is copy on
+     * write, changes made to the data are private to the process and never written back to the file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        uint8_t* _data = nullptr;
+        size_t _size = 0;
+
+    public:
+        explicit MemoryMappedFile(const std::string& path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetSize() const
+        {
+            return _size;
+        }
+    };
+} // namespace OpenRCT2
@@ -108,6 +108,35 @@ namespace OpenRCT2
             _dataSize = std::max<size_t>(_dataSize, static_cast<size_t>(nextPosition));
         }
 
+        // Typed reads and writes that use the inline copies above instead of the virtual ones of IStream
+        template<typename T> void Read(T* value)
+        {
+            Read<sizeof(T)>(value);
+        }
+
+        template<typename T> void Write(const T* value)
+        {
+            Write<sizeof(T)>(value);
+        }
+
+        template<typename T> T ReadValue()
+        {
+            T buffer;
+            Read(&buffer);
+            return buffer;
+        }
+
+        template<typename T> void WriteValue(const T value)
+        {
+            Write(&value);
+        }
+
+        // Returns the data at the current position, the caller must not access more than GetLength() - GetPosition() bytes
+        const void* GetDataAtPosition() const
+        {
+            return _position;
+        }
+
         uint64_t TryRead(void* buffer, uint64_t length) override;
 
     private:
@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Timer.h"
+
+#include <cmath>
+#include <thread>
+
+namespace OpenRCT2::Timer
+{
+    // Weight of a new sleep measurement, high enough to follow changes to the timer resolution within a few ticks
+    static constexpr double EstimateWeight = 0.1;
+
+    // Start pessimistic, the default timer resolution on Windows can be as coarse as 15.6 ms
+    static double _sleepMean = 0.016;
+    static double _sleepVariance = 0;
+    static double _sleepEstimate = _sleepMean;
+
+    static void UpdateSleepEstimate(double observed)
+    {
+        const double delta = observed - _sleepMean;
+        _sleepMean += EstimateWeight * delta;
+        _sleepVariance = (1 - EstimateWeight) * (_sleepVariance + EstimateWeight * delta * delta);
+        _sleepEstimate = _sleepMean + std::sqrt(_sleepVariance);
+    }
+
+    void SleepUntil(Clock::time_point deadline)
+    {
+        auto now = Clock::now();
+        while (std::chrono::duration<double>(deadline - now).count() > _sleepEstimate)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            const auto woken = Clock::now();
+            UpdateSleepEstimate(std::chrono::duration<double>(woken - now).count());
+            now = woken;
+        }
+
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+} // namespace OpenRCT2::Timer
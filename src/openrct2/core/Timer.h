@@ -0,0 +1,28 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+/**
+ * Timing for the game loop, which needs to wake up within a fraction of a millisecond of a tick being due.
+ */
+namespace OpenRCT2::Timer
+{
+    // Monotonic clock used for pacing ticks and frames, it is not affected by changes to the system time.
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Blocks the calling thread until the deadline has passed. The thread sleeps while the deadline is further away
+     * than the OS usually oversleeps by and spins for the remainder, so it neither wakes up late on systems with a
+     * coarse sleep granularity nor burns a core for the whole wait.
+     */
+    void SleepUntil(Clock::time_point deadline);
+} // namespace OpenRCT2::Timer
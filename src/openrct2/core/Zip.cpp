@@ -14,6 +14,144 @@
 
 #    include <zip.h>
 
+using namespace OpenRCT2;
+
+/**
+ * A read only stream over a file within a zip archive. Compressed files can only be read forwards, so seeking backwards
+ * reopens the file and reads up to the new position.
+ */
+class ZipItemStream final : public IStream
+{
+private:
+    zip_t* _zip;
+    zip_int64_t _index;
+    zip_file_t* _zipFile = nullptr;
+    uint64_t _length;
+    uint64_t _position = 0;
+
+public:
+    ZipItemStream(zip_t* zip, zip_int64_t index, uint64_t length)
+        : _zip(zip)
+        , _index(index)
+        , _length(length)
+    {
+        Open();
+    }
+
+    ~ZipItemStream() override
+    {
+        Close();
+    }
+
+    bool CanRead() const override
+    {
+        return true;
+    }
+
+    bool CanWrite() const override
+    {
+        return false;
+    }
+
+    uint64_t GetLength() const override
+    {
+        return _length;
+    }
+
+    uint64_t GetPosition() const override
+    {
+        return _position;
+    }
+
+    void SetPosition(uint64_t position) override
+    {
+        if (position > _length)
+        {
+            throw IOException("Attempted to seek outside of zip entry.");
+        }
+        if (position < _position)
+        {
+            Close();
+            Open();
+        }
+
+        uint8_t skipBuffer[4096];
+        while (_position < position)
+        {
+            auto skipLength = std::min<uint64_t>(sizeof(skipBuffer), position - _position);
+            if (TryRead(skipBuffer, skipLength) != skipLength)
+            {
+                throw IOException("Unable to seek within zip entry.");
+            }
+        }
+    }
+
+    void Seek(int64_t offset, int32_t origin) override
+    {
+        switch (origin)
+        {
+            case STREAM_SEEK_BEGIN:
+                SetPosition(offset);
+                break;
+            case STREAM_SEEK_CURRENT:
+                SetPosition(_position + offset);
+                break;
+            case STREAM_SEEK_END:
+                SetPosition(_length + offset);
+                break;
+        }
+    }
+
+    void Read(void* buffer, uint64_t length) override
+    {
+        if (TryRead(buffer, length) != length)
+        {
+            throw IOException("Attempted to read past end of zip entry.");
+        }
+    }
+
+    void Write(const void*, uint64_t) override
+    {
+        throw IOException("Unable to write to zip entry.");
+    }
+
+    uint64_t TryRead(void* buffer, uint64_t length) override
+    {
+        auto readBytes = zip_fread(_zipFile, buffer, length);
+        if (readBytes <= 0)
+        {
+            return 0;
+        }
+        _position += readBytes;
+        return readBytes;
+    }
+
+    const void* GetData() const override
+    {
+        return nullptr;
+    }
+
+private:
+    void Open()
+    {
+        _zipFile = zip_fopen_index(_zip, _index, 0);
+        if (_zipFile == nullptr)
+        {
+            throw IOException("Unable to open zip entry.");
+        }
+        _position = 0;
+    }
+
+    void Close()
+    {
+        if (_zipFile != nullptr)
+        {
+            zip_fclose(_zipFile);
+            _zipFile = nullptr;
+        }
+    }
+};
+
 class ZipArchive final : public IZipArchive
 {
 private:
@@ -97,6 +235,23 @@ public:
         return result;
     }
 
+    std::unique_ptr<IStream> GetFileStream(const std::string_view& path) const override
+    {
+        auto index = GetIndexFromPath(path);
+        if (index == -1)
+        {
+            return nullptr;
+        }
+        try
+        {
+            return std::make_unique<ZipItemStream>(_zip, index, GetFileSize(index));
+        }
+        catch (const IOException&)
+        {
+            return nullptr;
+        }
+    }
+
     void SetFileData(const std::string_view& path, std::vector<uint8_t>&& data) override
     {
         // Push buffer to an internal list as libzip requires access to it until the zip
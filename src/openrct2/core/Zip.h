@@ -15,6 +15,11 @@
 #include <string_view>
 #include <vector>
 
+namespace OpenRCT2
+{
+    struct IStream;
+}
+
 /**
  * Represents a zip file.
  */
@@ -29,6 +34,14 @@ struct IZipArchive
     virtual uint64_t GetFileSize(size_t index) const abstract;
     virtual std::vector<uint8_t> GetFileData(const std::string_view& path) const abstract;
 
+    /**
+     * Opens a read only stream over a file within the zip archive, the file is decompressed as the stream is read. The
+     * stream must not outlive the archive.
+     * @param path The path of the file within the zip.
+     * @return The stream or nullptr if the file could not be opened.
+     */
+    virtual std::unique_ptr<OpenRCT2::IStream> GetFileStream(const std::string_view& path) const abstract;
+
     /**
      * Creates or overwrites a file within the zip archive to the given data buffer.
      * @param path The path of the file within the zip.
@@ -11,6 +11,7 @@
 
 #    include "../platform/platform.h"
 #    include "IStream.hpp"
+#    include "MemoryStream.h"
 #    include "Zip.h"
 
 #    include <SDL.h>
@@ -113,6 +114,13 @@ public:
         return std::vector<uint8_t>(dataPtr, dataPtr + dataSize);
     }
 
+    std::unique_ptr<OpenRCT2::IStream> GetFileStream(const std::string_view& path) const override
+    {
+        // The Java side hands over whole files, so there is nothing to stream
+        auto data = GetFileData(path);
+        return std::make_unique<OpenRCT2::MemoryStream>(data.data(), data.size());
+    }
+
     void SetFileData(const std::string_view& path, std::vector<uint8_t>&& data) override
     {
         STUB();
@@ -42,6 +42,32 @@ void mask_avx2(
     }
 }
 
+void transparent_copy_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    const __m256i zero = {};
+    int32_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i colour = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i dest = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i transparent = _mm256_cmpeq_epi8(colour, zero);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(colour, dest, transparent));
+    }
+    transparent_copy_scalar(src + i, dst + i, count - i);
+}
+
+void palette_convert_avx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* palette, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        const __m256i colours = _mm256_i32gather_epi32(reinterpret_cast<const int*>(palette), indices, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), colours);
+    }
+    palette_convert_scalar(src + i, dst + i, palette, count - i);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +81,14 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void transparent_copy_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void palette_convert_avx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* palette, int32_t count)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -9,6 +9,8 @@
 
 #include "Drawing.h"
 
+#include <cstring>
+
 template<DrawBlendOp TBlendOp> static void FASTCALL DrawBMPSpriteMagnify(DrawSpriteArgs& args)
 {
     auto& g1 = args.SourceImage;
@@ -49,6 +51,25 @@ template<DrawBlendOp TBlendOp> static void FASTCALL DrawBMPSpriteMinify(DrawSpri
     size_t srcLineWidth = g1.width * zoomLevel;
     size_t dstLineWidth = (static_cast<size_t>(dpi->width) / zoomLevel) + dpi->pitch;
     uint8_t zoom = 1 * zoomLevel;
+    if constexpr (TBlendOp == BLEND_NONE || TBlendOp == BLEND_TRANSPARENT)
+    {
+        // Every pixel is sampled at this zoom level, so whole rows can be copied at once
+        if (zoom == 1 && width > 0)
+        {
+            for (; height > 0; height--, src += srcLineWidth, dst += dstLineWidth)
+            {
+                if constexpr (TBlendOp == BLEND_NONE)
+                {
+                    std::memcpy(dst, src, width);
+                }
+                else
+                {
+                    transparent_copy_fn(src, dst, width);
+                }
+            }
+            return;
+        }
+    }
     for (; height > 0; height -= zoom)
     {
         auto nextSrc = src + srcLineWidth;
@@ -12,6 +12,8 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/platform.h"
 #include "../sprites.h"
@@ -20,8 +22,11 @@
 #include "Drawing.h"
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -67,6 +72,18 @@ static inline uint32_t rctc_to_rct2_index(uint32_t image)
 }
 // clang-format on
 
+/**
+ * Returns the element data that follows the element headers, the elements are left pointing into the mapped file.
+ */
+static uint8_t* get_gxdat_data(const MemoryMappedFile& file, const MemoryStream& stream, uint32_t totalSize)
+{
+    if (stream.GetLength() - stream.GetPosition() < totalSize)
+    {
+        throw IOException("Attempted to read past end of stream.");
+    }
+    return file.GetData() + stream.GetPosition();
+}
+
 static void read_and_convert_gxdat(IStream* stream, size_t count, bool is_rctc, rct_g1_element* elements)
 {
     auto g1Elements32 = std::make_unique<rct_g1_element_32bit[]>(count);
@@ -177,11 +194,38 @@ void mask_scalar(
     }
 }
 
+void transparent_copy_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (src[i] != 0)
+        {
+            dst[i] = src[i];
+        }
+    }
+}
+
+void palette_convert_scalar(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* palette, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        dst[i] = palette[src[i]];
+    }
+}
+
 static rct_gx _g1 = {};
 static rct_gx _g2 = {};
 static rct_gx _csg = {};
 static bool _csgLoaded = false;
 
+// The element data of the gx files is used straight from these, so it is only read from disk once it is drawn
+static std::unique_ptr<MemoryMappedFile> _g1File;
+static std::unique_ptr<MemoryMappedFile> _g2File;
+static std::unique_ptr<MemoryMappedFile> _csgFile;
+
+// Bumped when g1 is unloaded, as the combined remap palettes are built from its palette images
+static std::atomic<uint32_t> _remapPaletteCacheGeneration{ 1 };
+
 static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
 bool gTinyFontAntiAliased = false;
@@ -196,7 +240,8 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
     try
     {
         auto path = Path::Combine(env.GetDirectoryPath(DIRBASE::RCT2, DIRID::DATA), "g1.dat");
-        auto fs = FileStream(path, FILE_MODE_OPEN);
+        _g1File = std::make_unique<MemoryMappedFile>(path);
+        auto fs = MemoryStream(_g1File->GetData(), _g1File->GetSize());
         _g1.header = fs.ReadValue<rct_g1_header>();
 
         log_verbose("g1.dat, number of entries: %u", _g1.header.num_entries);
@@ -212,13 +257,11 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         read_and_convert_gxdat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
         gTinyFontAntiAliased = is_rctc;
 
-        // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
-
         // Fix entry data offsets
+        auto data = get_gxdat_data(*_g1File, fs, _g1.header.total_size);
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data);
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -226,6 +269,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
     {
         _g1.elements.clear();
         _g1.elements.shrink_to_fit();
+        _g1File = nullptr;
 
         log_fatal("Unable to load g1 graphics");
         if (!gOpenRCT2Headless)
@@ -239,23 +283,41 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
-    SafeFree(_g1.data);
+    _remapPaletteCacheGeneration++;
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
+    _g1File = nullptr;
 }
 
 void gfx_unload_g2()
 {
-    SafeFree(_g2.data);
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
+    _g2File = nullptr;
 }
 
 void gfx_unload_csg()
 {
-    SafeFree(_csg.data);
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
+    _csgFile = nullptr;
+}
+
+size_t gfx_get_gx_memory_usage()
+{
+    size_t result = 0;
+    for (const auto* gx : { &_g1, &_g2, &_csg })
+    {
+        result += gx->elements.capacity() * sizeof(rct_g1_element);
+    }
+    for (const auto* file : { &_g1File, &_g2File, &_csgFile })
+    {
+        if (*file != nullptr)
+        {
+            result += (*file)->GetSize();
+        }
+    }
+    return result;
 }
 
 bool gfx_load_g2()
@@ -268,20 +330,19 @@ bool gfx_load_g2()
     safe_strcat_path(path, "g2.dat", MAX_PATH);
     try
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
+        _g2File = std::make_unique<MemoryMappedFile>(path);
+        auto fs = MemoryStream(_g2File->GetData(), _g2File->GetSize());
         _g2.header = fs.ReadValue<rct_g1_header>();
 
         // Read element headers
         _g2.elements.resize(_g2.header.num_entries);
         read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
-        // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
-
         // Fix entry data offsets
+        auto data = get_gxdat_data(*_g2File, fs, _g2.header.total_size);
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data);
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -289,6 +350,7 @@ bool gfx_load_g2()
     {
         _g2.elements.clear();
         _g2.elements.shrink_to_fit();
+        _g2File = nullptr;
 
         log_fatal("Unable to load g2 graphics");
         if (!gOpenRCT2Headless)
@@ -315,9 +377,9 @@ bool gfx_load_csg()
     try
     {
         auto fileHeader = FileStream(pathHeaderPath, FILE_MODE_OPEN);
-        auto fileData = FileStream(pathDataPath, FILE_MODE_OPEN);
+        auto fileData = std::make_unique<MemoryMappedFile>(pathDataPath);
         size_t fileHeaderSize = fileHeader.GetLength();
-        size_t fileDataSize = fileData.GetLength();
+        size_t fileDataSize = fileData->GetSize();
 
         _csg.header.num_entries = static_cast<uint32_t>(fileHeaderSize / sizeof(rct_g1_element_32bit));
         _csg.header.total_size = static_cast<uint32_t>(fileDataSize);
@@ -332,19 +394,18 @@ bool gfx_load_csg()
         _csg.elements.resize(_csg.header.num_entries);
         read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
-        // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
-
         // Fix entry data offsets
+        auto data = fileData->GetData();
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data);
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
                 _csg.elements[i].zoomed_offset = i - _csg.elements[i].zoomed_offset;
             }
         }
+        _csgFile = std::move(fileData);
         _csgLoaded = true;
         return true;
     }
@@ -358,23 +419,54 @@ bool gfx_load_csg()
     }
 }
 
-static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId imageId)
+struct remap_palette
 {
-    if (!imageId.HasSecondary())
+    uint8_t data[256];
+};
+
+struct remap_palette_cache
+{
+    uint32_t generation = 0;
+    std::unordered_map<uint32_t, remap_palette> maps;
+    // Cars of a train and rows of scenery draw the same colours one after another, those skip the map lookup
+    uint32_t last_key = std::numeric_limits<uint32_t>::max();
+    remap_palette* last_entry = nullptr;
+};
+
+static constexpr size_t REMAP_PALETTE_CACHE_MAX_ENTRIES = 4096;
+
+static PaletteMap FASTCALL gfx_draw_sprite_get_remap_palette(ImageId imageId)
+{
+    // Peeps and vehicles combine two or three colour remaps on every draw and crowds repeat the same few combinations,
+    // so the combined maps are kept per thread. This also keeps parallel drawing from writing to the shared base maps.
+    thread_local remap_palette_cache cache;
+    auto generation = _remapPaletteCacheGeneration.load(std::memory_order_relaxed);
+    if (cache.generation != generation || cache.maps.size() >= REMAP_PALETTE_CACHE_MAX_ENTRIES)
     {
-        uint8_t paletteId = imageId.GetRemap();
-        if (!imageId.IsBlended())
-        {
-            paletteId &= 0x7F;
-        }
-        return GetPaletteMapForColour(paletteId);
+        cache.maps.clear();
+        cache.generation = generation;
+        cache.last_entry = nullptr;
     }
-    else
+
+    uint32_t key = imageId.GetPrimary() | (imageId.GetSecondary() << 8);
+    if (imageId.HasTertiary())
+    {
+        key |= (imageId.GetTertiary() << 16) | (1 << 24);
+    }
+    if (key == cache.last_key && cache.last_entry != nullptr)
+    {
+        return PaletteMap(cache.last_entry->data);
+    }
+
+    auto [it, inserted] = cache.maps.try_emplace(key);
+    cache.last_key = key;
+    cache.last_entry = &it->second;
+    auto paletteMap = PaletteMap(it->second.data);
+    if (inserted)
     {
-        auto paletteMap = PaletteMap(gPeepPalette);
         if (imageId.HasTertiary())
         {
-            paletteMap = PaletteMap(gOtherPalette);
+            std::copy_n(gOtherPalette, std::size(gOtherPalette), it->second.data);
             auto tertiaryPaletteMap = GetPaletteMapForColour(imageId.GetTertiary());
             if (tertiaryPaletteMap)
             {
@@ -382,6 +474,10 @@ static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId im
                     PALETTE_OFFSET_REMAP_TERTIARY, *tertiaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
             }
         }
+        else
+        {
+            std::copy_n(gPeepPalette, std::size(gPeepPalette), it->second.data);
+        }
 
         auto primaryPaletteMap = GetPaletteMapForColour(imageId.GetPrimary());
         if (primaryPaletteMap)
@@ -396,9 +492,22 @@ static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId im
             paletteMap.Copy(
                 PALETTE_OFFSET_REMAP_SECONDARY, *secondaryPaletteMap, PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
         }
+    }
+    return paletteMap;
+}
 
-        return paletteMap;
+static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId imageId)
+{
+    if (!imageId.HasSecondary())
+    {
+        uint8_t paletteId = imageId.GetRemap();
+        if (!imageId.IsBlended())
+        {
+            paletteId &= 0x7F;
+        }
+        return GetPaletteMapForColour(paletteId);
     }
+    return gfx_draw_sprite_get_remap_palette(imageId);
 }
 
 void FASTCALL gfx_draw_sprite_software(rct_drawpixelinfo* dpi, ImageId imageId, const ScreenCoordsXY& spriteCoords)
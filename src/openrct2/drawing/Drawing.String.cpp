@@ -19,6 +19,10 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <unordered_map>
 
 enum : uint32_t
 {
@@ -33,6 +37,83 @@ enum : uint32_t
 
 static int32_t ttf_get_string_width(const utf8* text);
 
+constexpr size_t TextLayoutCacheMaxEntries = 2048;
+
+struct TextWrapResult
+{
+    std::string Buffer;
+    int32_t NumLines;
+    int32_t MaxWidth;
+};
+
+struct TextClipResult
+{
+    int32_t ClipOffset;
+    int32_t Width;
+};
+
+/**
+ * Results of measuring, wrapping and clipping strings, keyed on the font state and the text itself. Windows repaint the
+ * same strings every frame, so this saves re-measuring every prefix of every line. Kept per thread like the glyph cache.
+ */
+struct TextLayoutCache
+{
+    uint32_t Generation = 0;
+    std::string Key;
+    std::unordered_map<std::string, int32_t> Widths;
+    std::unordered_map<std::string, TextWrapResult> Wraps;
+    std::unordered_map<std::string, TextClipResult> Clips;
+};
+
+static std::atomic<uint32_t> _textLayoutCacheGeneration{ 1 };
+static thread_local TextLayoutCache _textLayoutCache;
+
+static TextLayoutCache& text_layout_cache_get()
+{
+    TextLayoutCache& cache = _textLayoutCache;
+    uint32_t generation = _textLayoutCacheGeneration.load(std::memory_order_acquire);
+    if (cache.Generation != generation)
+    {
+        cache.Widths.clear();
+        cache.Wraps.clear();
+        cache.Clips.clear();
+        cache.Generation = generation;
+    }
+    return cache;
+}
+
+static const std::string& text_layout_cache_make_key(TextLayoutCache& cache, const utf8* text, int32_t width)
+{
+    struct
+    {
+        int32_t width;
+        int16_t fontSpriteBase;
+        uint16_t fontFlags;
+    } header = { width, gCurrentFontSpriteBase, gCurrentFontFlags };
+
+    cache.Key.assign(reinterpret_cast<const char*>(&header), sizeof(header));
+    cache.Key.append(text);
+    return cache.Key;
+}
+
+template<typename T>
+static void text_layout_cache_add(std::unordered_map<std::string, T>& map, const std::string& key, const T& value)
+{
+    if (map.size() >= TextLayoutCacheMaxEntries)
+    {
+        map.clear();
+    }
+    map.emplace(key, value);
+}
+
+/**
+ * Drops all cached text layouts, needs to be called whenever the font or glyph widths change.
+ */
+void gfx_text_layout_cache_invalidate()
+{
+    _textLayoutCacheGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
 /**
  *
  *  rct2: 0x006C23B1
@@ -71,27 +152,24 @@ int32_t gfx_get_string_width_new_lined(utf8* text)
  */
 int32_t gfx_get_string_width(const utf8* buffer)
 {
-    return ttf_get_string_width(buffer);
+    TextLayoutCache& cache = text_layout_cache_get();
+    const std::string& key = text_layout_cache_make_key(cache, buffer, 0);
+    auto it = cache.Widths.find(key);
+    if (it != cache.Widths.end())
+    {
+        return it->second;
+    }
+
+    int32_t width = ttf_get_string_width(buffer);
+    text_layout_cache_add(cache.Widths, key, width);
+    return width;
 }
 
-/**
- * Clip the text in buffer to width, add ellipsis and return the new width of the clipped string
- *
- *  rct2: 0x006C2460
- * buffer (esi)
- * width (edi)
- */
-int32_t gfx_clip_string(utf8* text, int32_t width)
+static int32_t gfx_clip_string_uncached(utf8* text, int32_t width, int32_t* outClipOffset)
 {
-    int32_t clippedWidth;
-
-    if (width < 6)
-    {
-        *text = 0;
-        return 0;
-    }
+    *outClipOffset = -1;
 
-    clippedWidth = gfx_get_string_width(text);
+    int32_t clippedWidth = ttf_get_string_width(text);
     if (clippedWidth <= width)
     {
         return clippedWidth;
@@ -121,7 +199,7 @@ int32_t gfx_clip_string(utf8* text, int32_t width)
         }
         nextCh[3] = 0;
 
-        int32_t queryWidth = gfx_get_string_width(text);
+        int32_t queryWidth = ttf_get_string_width(text);
         if (queryWidth < width)
         {
             clipCh = nextCh;
@@ -134,6 +212,7 @@ int32_t gfx_clip_string(utf8* text, int32_t width)
                 clipCh[i] = '.';
             }
             clipCh[3] = 0;
+            *outClipOffset = static_cast<int32_t>(clipCh - text);
             return clippedWidth;
         }
 
@@ -143,27 +222,48 @@ int32_t gfx_clip_string(utf8* text, int32_t width)
         };
         ch = nextCh;
     }
-    return gfx_get_string_width(text);
+    return ttf_get_string_width(text);
 }
 
 /**
- * Wrap the text in buffer to width, returns width of longest line.
- *
- * Inserts NULL where line should break (as \n is used for something else),
- * so the number of lines is returned in num_lines. font_height seems to be
- * a control character for line height.
+ * Clip the text in buffer to width, add ellipsis and return the new width of the clipped string
  *
- *  rct2: 0x006C21E2
+ *  rct2: 0x006C2460
  * buffer (esi)
- * width (edi) - in
- * num_lines (edi) - out
- * font_height (ebx) - out
+ * width (edi)
  */
-int32_t gfx_wrap_string(utf8* text, int32_t width, int32_t* outNumLines, int32_t* outFontHeight)
+int32_t gfx_clip_string(utf8* text, int32_t width)
+{
+    if (width < 6)
+    {
+        *text = 0;
+        return 0;
+    }
+
+    TextLayoutCache& cache = text_layout_cache_get();
+    const std::string& key = text_layout_cache_make_key(cache, text, width);
+    auto it = cache.Clips.find(key);
+    if (it == cache.Clips.end())
+    {
+        TextClipResult result;
+        result.Width = gfx_clip_string_uncached(text, width, &result.ClipOffset);
+        text_layout_cache_add(cache.Clips, key, result);
+        return result.Width;
+    }
+
+    if (it->second.ClipOffset != -1)
+    {
+        std::memcpy(text + it->second.ClipOffset, "...", 4);
+    }
+    return it->second.Width;
+}
+
+static int32_t gfx_wrap_string_uncached(utf8* text, int32_t width, int32_t* outNumLines, size_t* outInsertedBytes)
 {
     int32_t lineWidth = 0;
     int32_t maxWidth = 0;
     *outNumLines = 0;
+    *outInsertedBytes = 0;
 
     // Pointer to the start of the current word
     utf8* currentWord = nullptr;
@@ -204,7 +304,7 @@ int32_t gfx_wrap_string(utf8* text, int32_t width, int32_t* outNumLines, int32_t
 
         uint8_t saveCh = *nextCh;
         *nextCh = 0;
-        lineWidth = gfx_get_string_width(firstCh);
+        lineWidth = ttf_get_string_width(firstCh);
         *nextCh = saveCh;
 
         if (lineWidth <= width || numCharactersOnLine == 0)
@@ -215,7 +315,9 @@ int32_t gfx_wrap_string(utf8* text, int32_t width, int32_t* outNumLines, int32_t
         else if (currentWord == nullptr)
         {
             // Single word is longer than line, insert null terminator
-            ch += utf8_insert_codepoint(ch, 0);
+            int32_t insertedBytes = utf8_insert_codepoint(ch, 0);
+            *outInsertedBytes += insertedBytes;
+            ch += insertedBytes;
             maxWidth = std::max(maxWidth, lineWidth);
             (*outNumLines)++;
             lineWidth = 0;
@@ -237,10 +339,47 @@ int32_t gfx_wrap_string(utf8* text, int32_t width, int32_t* outNumLines, int32_t
         }
     }
     maxWidth = std::max(maxWidth, lineWidth);
-    *outFontHeight = gCurrentFontSpriteBase;
     return maxWidth == 0 ? lineWidth : maxWidth;
 }
 
+/**
+ * Wrap the text in buffer to width, returns width of longest line.
+ *
+ * Inserts NULL where line should break (as \n is used for something else),
+ * so the number of lines is returned in num_lines. font_height seems to be
+ * a control character for line height.
+ *
+ *  rct2: 0x006C21E2
+ * buffer (esi)
+ * width (edi) - in
+ * num_lines (edi) - out
+ * font_height (ebx) - out
+ */
+int32_t gfx_wrap_string(utf8* text, int32_t width, int32_t* outNumLines, int32_t* outFontHeight)
+{
+    *outFontHeight = gCurrentFontSpriteBase;
+
+    TextLayoutCache& cache = text_layout_cache_get();
+    const std::string& key = text_layout_cache_make_key(cache, text, width);
+    auto it = cache.Wraps.find(key);
+    if (it == cache.Wraps.end())
+    {
+        size_t length = std::strlen(text);
+        size_t insertedBytes;
+        TextWrapResult result;
+        result.MaxWidth = gfx_wrap_string_uncached(text, width, &result.NumLines, &insertedBytes);
+        result.Buffer.assign(text, length + insertedBytes + 1);
+        text_layout_cache_add(cache.Wraps, key, result);
+        *outNumLines = result.NumLines;
+        return result.MaxWidth;
+    }
+
+    // Line breaks are stored as the wrapped buffer itself, including any terminators inserted into long words
+    std::memcpy(text, it->second.Buffer.data(), it->second.Buffer.size());
+    *outNumLines = it->second.NumLines;
+    return it->second.MaxWidth;
+}
+
 /**
  * Draws text that is left aligned and vertically centred.
  */
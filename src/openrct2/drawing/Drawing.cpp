@@ -559,22 +559,33 @@ void (*mask_fn)(
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
     = nullptr;
 
+void (*transparent_copy_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count) = transparent_copy_scalar;
+
+void (*palette_convert_fn)(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* palette, int32_t count)
+    = palette_convert_scalar;
+
 void mask_init()
 {
     if (avx2_available())
     {
         log_verbose("registering AVX2 mask function");
         mask_fn = mask_avx2;
+        transparent_copy_fn = transparent_copy_avx2;
+        palette_convert_fn = palette_convert_avx2;
     }
     else if (sse41_available())
     {
         log_verbose("registering SSE4.1 mask function");
         mask_fn = mask_sse4_1;
+        transparent_copy_fn = transparent_copy_sse4_1;
+        palette_convert_fn = palette_convert_scalar;
     }
     else
     {
         log_verbose("registering scalar mask function");
         mask_fn = mask_scalar;
+        transparent_copy_fn = transparent_copy_scalar;
+        palette_convert_fn = palette_convert_scalar;
     }
 }
 
@@ -97,7 +97,6 @@ struct rct_gx
 {
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
-    void* data;
 };
 
 struct rct_drawpixelinfo
@@ -704,6 +703,10 @@ bool gfx_load_g1(const OpenRCT2::IPlatformEnvironment& env);
 bool gfx_load_g2();
 bool gfx_load_csg();
 void gfx_unload_g1();
+/**
+ * Memory used by the loaded g1, g2 and csg files, including their mapped element data.
+ */
+size_t gfx_get_gx_memory_usage();
 void gfx_unload_g2();
 void gfx_unload_csg();
 const rct_g1_element* gfx_get_g1_element(ImageId imageId);
@@ -761,12 +764,14 @@ int32_t gfx_get_string_width(const utf8* buffer);
 int32_t gfx_get_string_width_new_lined(char* buffer);
 int32_t string_get_height_raw(char* buffer);
 int32_t gfx_clip_string(char* buffer, int32_t width);
+void gfx_text_layout_cache_invalidate();
 void shorten_path(utf8* buffer, size_t bufferSize, const utf8* path, int32_t availableWidth);
 void ttf_draw_string(rct_drawpixelinfo* dpi, const_utf8string text, int32_t colour, const ScreenCoordsXY& coords);
 
 // scrolling text
 void scrolling_text_initialise_bitmaps();
 void scrolling_text_invalidate();
+void scrolling_text_dispose();
 
 class Formatter;
 
@@ -792,6 +797,20 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Copies the pixels of a row that are not transparent (0)
+void transparent_copy_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void transparent_copy_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void transparent_copy_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+
+extern void (*transparent_copy_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+
+// Converts a row of palette indices to the 32-bit colours of the given palette
+void palette_convert_scalar(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* palette, int32_t count);
+void palette_convert_avx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* palette, int32_t count);
+
+extern void (*palette_convert_fn)(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* palette, int32_t count);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 
@@ -14,6 +14,7 @@
 #    include "../Game.h"
 #    include "../common.h"
 #    include "../config/Config.h"
+#    include "../core/JobPool.h"
 #    include "../interface/Viewport.h"
 #    include "../interface/Window.h"
 #    include "../interface/Window_internal.h"
@@ -29,6 +30,10 @@
 #    include <cmath>
 #    include <cstring>
 
+#    ifdef __SSE2__
+#        include <emmintrin.h>
+#    endif
+
 static uint8_t _bakedLightTexture_lantern_0[32 * 32];
 static uint8_t _bakedLightTexture_lantern_1[64 * 64];
 static uint8_t _bakedLightTexture_lantern_2[128 * 128];
@@ -190,220 +195,221 @@ void lightfx_update_buffers(rct_drawpixelinfo* info)
 
 extern void viewport_paint_setup();
 
-void lightfx_prepare_light_list()
+static void lightfx_prepare_light(lightlist_entry* entry)
 {
-    for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+    if (entry->z == 0x7FFF)
     {
-        lightlist_entry* entry = &_LightListFront[light];
+        entry->lightIntensity = 0xFF;
+        return;
+    }
 
-        if (entry->z == 0x7FFF)
-        {
-            entry->lightIntensity = 0xFF;
-            continue;
-        }
+    CoordsXYZ coord_3d = { /* .x = */ entry->x,
+                           /* .y = */ entry->y,
+                           /* .z = */ entry->z };
 
-        CoordsXYZ coord_3d = { /* .x = */ entry->x,
-                               /* .y = */ entry->y,
-                               /* .z = */ entry->z };
+    int32_t posOnScreenX = entry->viewCoords.x - _current_view_x_front;
+    int32_t posOnScreenY = entry->viewCoords.y - _current_view_y_front;
 
-        int32_t posOnScreenX = entry->viewCoords.x - _current_view_x_front;
-        int32_t posOnScreenY = entry->viewCoords.y - _current_view_y_front;
+    posOnScreenX = posOnScreenX / _current_view_zoom_front;
+    posOnScreenY = posOnScreenY / _current_view_zoom_front;
 
-        posOnScreenX = posOnScreenX / _current_view_zoom_front;
-        posOnScreenY = posOnScreenY / _current_view_zoom_front;
+    if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
+        || (posOnScreenY > _pixelInfo.height + 128))
+    {
+        entry->lightType = LightType::None;
+        return;
+    }
 
-        if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
-            || (posOnScreenY > _pixelInfo.height + 128))
-        {
-            entry->lightType = LightType::None;
-            continue;
-        }
+    uint32_t lightIntensityOccluded = 0x0;
+
+    int32_t dirVecX = 707;
+    int32_t dirVecY = 707;
+
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            dirVecX = 707;
+            dirVecY = 707;
+            break;
+        case 1:
+            dirVecX = -707;
+            dirVecY = 707;
+            break;
+        case 2:
+            dirVecX = -707;
+            dirVecY = -707;
+            break;
+        case 3:
+            dirVecX = 707;
+            dirVecY = -707;
+            break;
+        default:
+            dirVecX = 0;
+            dirVecY = 0;
+            break;
+    }
+
+    int32_t tileOffsetX = 0;
+    int32_t tileOffsetY = 0;
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            tileOffsetX = 0;
+            tileOffsetY = 0;
+            break;
+        case 1:
+            tileOffsetX = 16;
+            tileOffsetY = 0;
+            break;
+        case 2:
+            tileOffsetX = 32;
+            tileOffsetY = 32;
+            break;
+        case 3:
+            tileOffsetX = 0;
+            tileOffsetY = 16;
+            break;
+    }
+
+    int32_t mapFrontDiv = 1 * _current_view_zoom_front;
 
-        uint32_t lightIntensityOccluded = 0x0;
+    // clang-format off
+    static int16_t offsetPattern[26] = {
+        0, 0,
+        -4, 0, 0, -3, 4, 0, 0, 3,
+        -2, -1, -1, -1, 2, 1, 1, 1,
+        -3, -2, -3, 2, 3, -2, 3, 2,
+    };
+    // clang-format on
 
-        int32_t dirVecX = 707;
-        int32_t dirVecY = 707;
+    // Light occlusion code
+    if (true)
+    {
+        int32_t totalSamplePoints = 5;
+        int32_t startSamplePoint = 1;
 
-        switch (_current_view_rotation_front)
+        if (entry->qualifier == LightFXQualifier::Map)
         {
-            case 0:
-                dirVecX = 707;
-                dirVecY = 707;
-                break;
-            case 1:
-                dirVecX = -707;
-                dirVecY = 707;
-                break;
-            case 2:
-                dirVecX = -707;
-                dirVecY = -707;
-                break;
-            case 3:
-                dirVecX = 707;
-                dirVecY = -707;
-                break;
-            default:
-                dirVecX = 0;
-                dirVecY = 0;
-                break;
+            startSamplePoint = 0;
+            totalSamplePoints = 1;
         }
 
-        int32_t tileOffsetX = 0;
-        int32_t tileOffsetY = 0;
-        switch (_current_view_rotation_front)
+        for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
         {
-            case 0:
-                tileOffsetX = 0;
-                tileOffsetY = 0;
-                break;
-            case 1:
-                tileOffsetX = 16;
-                tileOffsetY = 0;
-                break;
-            case 2:
-                tileOffsetX = 32;
-                tileOffsetY = 32;
-                break;
-            case 3:
-                tileOffsetX = 0;
-                tileOffsetY = 16;
-                break;
-        }
+            CoordsXY mapCoord{};
 
-        int32_t mapFrontDiv = 1 * _current_view_zoom_front;
+            TileElement* tileElement = nullptr;
 
-        // clang-format off
-        static int16_t offsetPattern[26] = {
-            0, 0,
-            -4, 0, 0, -3, 4, 0, 0, 3,
-            -2, -1, -1, -1, 2, 1, 1, 1,
-            -3, -2, -3, 2, 3, -2, 3, 2,
-        };
-        // clang-format on
+            int32_t interactionType = 0;
 
-        // Light occlusion code
-        if (true)
-        {
-            int32_t totalSamplePoints = 5;
-            int32_t startSamplePoint = 1;
+            auto* w = window_get_main();
+            if (w != nullptr)
+            {
+                ScreenCoordsXY viewCoords = { entry->viewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv,
+                                              entry->viewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv };
+                auto info = viewport_pick(
+                    viewCoords, _current_view_zoom_front, w->viewport->flags, VIEWPORT_INTERACTION_MASK_NONE);
+
+                mapCoord = info.Loc;
+                mapCoord.x += tileOffsetX;
+                mapCoord.y += tileOffsetY;
+                interactionType = info.SpriteType;
+                tileElement = info.Element;
+            }
 
-            if (entry->qualifier == LightFXQualifier::Map)
+            int32_t minDist = 0;
+            int32_t baseHeight = (-999) * COORDS_Z_STEP;
+
+            if (interactionType != VIEWPORT_INTERACTION_ITEM_SPRITE && tileElement)
             {
-                startSamplePoint = 0;
-                totalSamplePoints = 1;
+                baseHeight = tileElement->GetBaseZ();
             }
 
-            for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
+            minDist = (baseHeight - coord_3d.z) / 2;
+
+            int32_t deltaX = mapCoord.x - coord_3d.x;
+            int32_t deltaY = mapCoord.y - coord_3d.y;
+
+            int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
+
+            projDot = std::max(minDist, projDot);
+
+            if (projDot < 5)
             {
-                CoordsXY mapCoord{};
-
-                TileElement* tileElement = nullptr;
-
-                int32_t interactionType = 0;
-
-                auto* w = window_get_main();
-                if (w != nullptr)
-                {
-                    // based on get_map_coordinates_from_pos_window
-                    rct_drawpixelinfo dpi;
-                    dpi.x = entry->viewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv;
-                    dpi.y = entry->viewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv;
-                    dpi.height = 1;
-                    dpi.zoom_level = _current_view_zoom_front;
-                    dpi.width = 1;
-
-                    paint_session* session = PaintSessionAlloc(&dpi, w->viewport->flags);
-                    PaintSessionGenerate(session);
-                    PaintSessionArrange(session);
-                    auto info = set_interaction_info_from_paint_session(session, VIEWPORT_INTERACTION_MASK_NONE);
-                    PaintSessionFree(session);
-
-                    //  log_warning("[%i, %i]", dpi->x, dpi->y);
-
-                    mapCoord = info.Loc;
-                    mapCoord.x += tileOffsetX;
-                    mapCoord.y += tileOffsetY;
-                    interactionType = info.SpriteType;
-                    tileElement = info.Element;
-                }
-
-                int32_t minDist = 0;
-                int32_t baseHeight = (-999) * COORDS_Z_STEP;
-
-                if (interactionType != VIEWPORT_INTERACTION_ITEM_SPRITE && tileElement)
-                {
-                    baseHeight = tileElement->GetBaseZ();
-                }
-
-                minDist = (baseHeight - coord_3d.z) / 2;
-
-                int32_t deltaX = mapCoord.x - coord_3d.x;
-                int32_t deltaY = mapCoord.y - coord_3d.y;
-
-                int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
-
-                projDot = std::max(minDist, projDot);
-
-                if (projDot < 5)
-                {
-                    lightIntensityOccluded += 100;
-                }
-                else
-                {
-                    lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
-                }
-
-                //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
-                //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
-
-                if (pat == 0)
-                {
-                    if (lightIntensityOccluded == 100)
-                        break;
-                    if (_current_view_zoom_front > 2)
-                        break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 4)
-                {
-                    if (_current_view_zoom_front > 1)
-                        break;
-                    if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
-                        break;
-                    // lastSampleCount = lightIntensityOccluded / 500;
-                    //  break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 8)
-                {
-                    break;
-                }
+                lightIntensityOccluded += 100;
+            }
+            else
+            {
+                lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
             }
 
-            totalSamplePoints -= startSamplePoint;
+            //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
+            //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
 
-            if (lightIntensityOccluded == 0)
+            if (pat == 0)
             {
-                entry->lightType = LightType::None;
-                continue;
+                if (lightIntensityOccluded == 100)
+                    break;
+                if (_current_view_zoom_front > 2)
+                    break;
+                totalSamplePoints += 4;
+            }
+            else if (pat == 4)
+            {
+                if (_current_view_zoom_front > 1)
+                    break;
+                if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
+                    break;
+                // lastSampleCount = lightIntensityOccluded / 500;
+                //  break;
+                totalSamplePoints += 4;
+            }
+            else if (pat == 8)
+            {
+                break;
             }
+        }
+
+        totalSamplePoints -= startSamplePoint;
 
-            entry->lightIntensity = std::min<uint32_t>(
-                0xFF, (entry->lightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+        if (lightIntensityOccluded == 0)
+        {
+            entry->lightType = LightType::None;
+            return;
         }
-        entry->lightIntensity = std::max<uint32_t>(
-            0x00, entry->lightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
 
-        if (_current_view_zoom_front > 0)
+        entry->lightIntensity = std::min<uint32_t>(
+            0xFF, (entry->lightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+    }
+    entry->lightIntensity = std::max<uint32_t>(
+        0x00, entry->lightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
+
+    if (_current_view_zoom_front > 0)
+    {
+        if (GetLightTypeSize(entry->lightType) < static_cast<int8_t>(_current_view_zoom_front))
         {
-            if (GetLightTypeSize(entry->lightType) < static_cast<int8_t>(_current_view_zoom_front))
-            {
-                entry->lightType = LightType::None;
-                continue;
-            }
+            entry->lightType = LightType::None;
+            return;
+        }
 
-            entry->lightType = SetLightTypeSize(
-                entry->lightType, GetLightTypeSize(entry->lightType) - static_cast<int8_t>(_current_view_zoom_front));
+        entry->lightType = SetLightTypeSize(
+            entry->lightType, GetLightTypeSize(entry->lightType) - static_cast<int8_t>(_current_view_zoom_front));
+    }
+}
+
+void lightfx_prepare_light_list()
+{
+    // Each light samples the scene with its own 1x1 paint sessions, so the occlusion tests can run side by side
+    if (gConfigGeneral.multithreading)
+    {
+        JobPool::ParallelFor(
+            LightListCurrentCountFront, 16, [](size_t light) { lightfx_prepare_light(&_LightListFront[light]); });
+    }
+    else
+    {
+        for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+        {
+            lightfx_prepare_light(&_LightListFront[light]);
         }
     }
 }
@@ -449,6 +455,47 @@ void lightfx_update_viewport_settings()
     }
 }
 
+/**
+ * Adds one row of a baked light texture onto the light buffer, scaled by the light's intensity and saturated at 0xFF.
+ */
+static void lightfx_accumulate_row(uint8_t* dst, const uint8_t* src, int32_t count, uint8_t intensity)
+{
+    int32_t x = 0;
+    if (intensity == 0xFF)
+    {
+#    ifdef __SSE2__
+        for (; x + 16 <= count; x += 16)
+        {
+            __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+            __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(d, l));
+        }
+#    endif
+        for (; x < count; x++)
+        {
+            dst[x] = std::min(0xFF, dst[x] + src[x]);
+        }
+        return;
+    }
+
+#    ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i scale = _mm_set1_epi16(static_cast<int16_t>(1 + intensity));
+    for (; x + 16 <= count; x += 16)
+    {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+        __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(l, zero), scale), 8);
+        __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(l, zero), scale), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(d, _mm_packus_epi16(lo, hi)));
+    }
+#    endif
+    for (; x < count; x++)
+    {
+        dst[x] = std::min(0xFF, dst[x] + ((src[x] * (1 + intensity)) >> 8));
+    }
+}
+
 void lightfx_render_lights_to_frontbuffer()
 {
     if (_light_rendered_buffer_front == nullptr)
@@ -584,35 +631,11 @@ void lightfx_render_lights_to_frontbuffer()
         bufReadSkip = bufReadWidth - bufWriteWidth;
         bufWriteSkip = _pixelInfo.width - bufWriteWidth;
 
-        if (entry->lightIntensity == 0xFF)
+        for (int32_t y = 0; y < bufWriteHeight; y++)
         {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
-        }
-        else
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry->lightIntensity)) >> 8));
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
+            lightfx_accumulate_row(bufWriteBase, bufReadBase, bufWriteWidth, entry->lightIntensity);
+            bufWriteBase += bufWriteWidth + bufWriteSkip;
+            bufReadBase += bufWriteWidth + bufReadSkip;
         }
     }
 }
@@ -982,6 +1005,66 @@ static uint8_t mix_light(uint32_t a, uint32_t b, uint32_t intensity)
     return result;
 }
 
+/**
+ * Resolves one row of palette indices to colours, brightening each pixel towards its lit colour by the light buffer.
+ */
+static void lightfx_composite_row(
+    uint32_t* dst, const uint8_t* src, const uint8_t* lightBits, uint32_t width, const uint32_t* palette,
+    const uint32_t* lightPalette)
+{
+    uint32_t x = 0;
+#    ifdef __SSE2__
+    // mulhi of (b << 8) and (intensity * 6) is exactly mix_light's (b * intensity * 6) >> 8
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i dark = _mm_set_epi32(
+            static_cast<int32_t>(palette[src[x + 3]]), static_cast<int32_t>(palette[src[x + 2]]),
+            static_cast<int32_t>(palette[src[x + 1]]), static_cast<int32_t>(palette[src[x]]));
+        uint32_t intensities;
+        std::memcpy(&intensities, &lightBits[x], sizeof(intensities));
+        if (intensities == 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), dark);
+            continue;
+        }
+
+        __m128i light = _mm_set_epi32(
+            static_cast<int32_t>(lightPalette[src[x + 3]]), static_cast<int32_t>(lightPalette[src[x + 2]]),
+            static_cast<int32_t>(lightPalette[src[x + 1]]), static_cast<int32_t>(lightPalette[src[x]]));
+        int16_t i0 = static_cast<int16_t>(lightBits[x] * 6);
+        int16_t i1 = static_cast<int16_t>(lightBits[x + 1] * 6);
+        int16_t i2 = static_cast<int16_t>(lightBits[x + 2] * 6);
+        int16_t i3 = static_cast<int16_t>(lightBits[x + 3] * 6);
+        __m128i scaleLo = _mm_set_epi16(i1, i1, i1, i1, i0, i0, i0, i0);
+        __m128i scaleHi = _mm_set_epi16(i3, i3, i3, i3, i2, i2, i2, i2);
+        __m128i lo = _mm_mulhi_epu16(_mm_unpacklo_epi8(zero, light), scaleLo);
+        __m128i hi = _mm_mulhi_epu16(_mm_unpackhi_epi8(zero, light), scaleHi);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(dark, _mm_packus_epi16(lo, hi)));
+    }
+#    endif
+    for (; x < width; x++)
+    {
+        uint32_t darkColour = palette[src[x]];
+        uint32_t lightColour = lightPalette[src[x]];
+        uint8_t lightIntensity = lightBits[x];
+
+        uint32_t colour = 0;
+        if (lightIntensity == 0)
+        {
+            colour = darkColour;
+        }
+        else
+        {
+            colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
+            colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
+            colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
+            colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+        }
+        dst[x] = colour;
+    }
+}
+
 void lightfx_render_to_texture(
     void* dstPixels, uint32_t dstPitch, uint8_t* bits, uint32_t width, uint32_t height, const uint32_t* palette,
     const uint32_t* lightPalette)
@@ -1001,27 +1084,7 @@ void lightfx_render_to_texture(
     {
         uintptr_t dstOffset = static_cast<uintptr_t>(y * dstPitch);
         uint32_t* dst = reinterpret_cast<uint32_t*>(reinterpret_cast<uintptr_t>(dstPixels) + dstOffset);
-        for (uint32_t x = 0; x < width; x++)
-        {
-            uint8_t* src = &bits[y * width + x];
-            uint32_t darkColour = palette[*src];
-            uint32_t lightColour = lightPalette[*src];
-            uint8_t lightIntensity = lightBits[y * width + x];
-
-            uint32_t colour = 0;
-            if (lightIntensity == 0)
-            {
-                colour = darkColour;
-            }
-            else
-            {
-                colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
-                colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
-                colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
-                colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
-            }
-            *dst++ = colour;
-        }
+        lightfx_composite_row(dst, &bits[y * width], &lightBits[y * width], width, palette, lightPalette);
     }
 }
 
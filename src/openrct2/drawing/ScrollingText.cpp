@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../interface/Colour.h"
 #include "../localisation/Localisation.h"
@@ -17,7 +18,9 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 struct rct_draw_scroll_text
 {
@@ -27,20 +30,57 @@ struct rct_draw_scroll_text
     uint16_t position;
     uint16_t mode;
     uint32_t id;
+    uint32_t frame;
+    uint32_t image_id;
     uint8_t bitmap[64 * 40];
 };
 
 constexpr int32_t MAX_SCROLLING_TEXT_ENTRIES = 32;
+constexpr int32_t MAX_SCROLLING_TEXT_EXTRA_ENTRIES = 480;
+constexpr int32_t SCROLLING_TEXT_EXTRA_BLOCK_SIZE = 32;
+constexpr int32_t SCROLLING_TEXT_SHARD_COUNT = 8;
+
+/**
+ * Entries are spread over shards by their key so parallel paint columns rarely contend on the same lock. Each shard
+ * starts with a share of the fixed scrolling text images and borrows extra entries, backed by image list allocations,
+ * once it has to evict an entry that was already used this frame.
+ */
+struct scrolling_text_shard
+{
+    std::mutex mutex;
+    std::vector<rct_draw_scroll_text*> entries;
+    uint32_t nextId = 0;
+};
 
 static rct_draw_scroll_text _drawScrollTextList[MAX_SCROLLING_TEXT_ENTRIES];
 static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8];
-static uint32_t _drawSCrollNextIndex = 0;
-static std::mutex _scrollingTextMutex;
+
+struct scrolling_text_cache
+{
+    scrolling_text_shard shards[SCROLLING_TEXT_SHARD_COUNT];
+
+    std::mutex extraMutex;
+    std::vector<std::unique_ptr<rct_draw_scroll_text[]>> extraBlocks;
+    std::vector<uint32_t> extraImageBases;
+    std::vector<rct_draw_scroll_text*> extraFree;
+
+    scrolling_text_cache()
+    {
+        for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
+        {
+            _drawScrollTextList[i].image_id = SPR_SCROLLING_TEXT_START + i;
+            shards[i % SCROLLING_TEXT_SHARD_COUNT].entries.push_back(&_drawScrollTextList[i]);
+        }
+    }
+};
+
+static scrolling_text_cache _scrollingTextCache;
 
 static void scrolling_text_set_bitmap_for_sprite(
     utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
 static void scrolling_text_set_bitmap_for_ttf(
     utf8* text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
+static rct_g1_element scrolling_text_create_g1(const rct_g1_element& g1original, rct_draw_scroll_text& scrollText);
 
 void scrolling_text_initialise_bitmaps()
 {
@@ -99,21 +139,97 @@ void scrolling_text_initialise_bitmaps()
         const rct_g1_element* g1original = gfx_get_g1_element(imageId);
         if (g1original != nullptr)
         {
-            rct_g1_element g1 = *g1original;
-            g1.offset = _drawScrollTextList[i].bitmap;
-            g1.width = 64;
-            g1.height = 40;
-            g1.offset[0] = 0xFF;
-            g1.offset[1] = 0xFF;
-            g1.offset[14] = 0;
-            g1.offset[15] = 0;
-            g1.offset[16] = 0;
-            g1.offset[17] = 0;
+            rct_g1_element g1 = scrolling_text_create_g1(*g1original, _drawScrollTextList[i]);
             gfx_set_g1_element(imageId, &g1);
         }
     }
 }
 
+static rct_g1_element scrolling_text_create_g1(const rct_g1_element& g1original, rct_draw_scroll_text& scrollText)
+{
+    rct_g1_element g1 = g1original;
+    g1.offset = scrollText.bitmap;
+    g1.width = 64;
+    g1.height = 40;
+    g1.offset[0] = 0xFF;
+    g1.offset[1] = 0xFF;
+    g1.offset[14] = 0;
+    g1.offset[15] = 0;
+    g1.offset[16] = 0;
+    g1.offset[17] = 0;
+    return g1;
+}
+
+/**
+ * Takes an entry from the extra pool, allocating another block of images for it when the pool is empty.
+ */
+static rct_draw_scroll_text* scrolling_text_allocate_extra()
+{
+    auto& cache = _scrollingTextCache;
+    std::scoped_lock<std::mutex> lock(cache.extraMutex);
+
+    if (cache.extraFree.empty())
+    {
+        if (cache.extraBlocks.size() * SCROLLING_TEXT_EXTRA_BLOCK_SIZE >= MAX_SCROLLING_TEXT_EXTRA_ENTRIES)
+            return nullptr;
+
+        const rct_g1_element* g1original = gfx_get_g1_element(SPR_SCROLLING_TEXT_START);
+        if (g1original == nullptr)
+            return nullptr;
+
+        auto block = std::make_unique<rct_draw_scroll_text[]>(SCROLLING_TEXT_EXTRA_BLOCK_SIZE);
+        std::vector<rct_g1_element> g1s;
+        for (int32_t i = 0; i < SCROLLING_TEXT_EXTRA_BLOCK_SIZE; i++)
+        {
+            g1s.push_back(scrolling_text_create_g1(*g1original, block[i]));
+        }
+
+        uint32_t baseImageId = gfx_object_allocate_images(g1s.data(), SCROLLING_TEXT_EXTRA_BLOCK_SIZE);
+        if (baseImageId == UINT32_MAX)
+            return nullptr;
+
+        for (int32_t i = SCROLLING_TEXT_EXTRA_BLOCK_SIZE - 1; i >= 0; i--)
+        {
+            block[i].image_id = baseImageId + i;
+            cache.extraFree.push_back(&block[i]);
+        }
+        cache.extraBlocks.push_back(std::move(block));
+        cache.extraImageBases.push_back(baseImageId);
+    }
+
+    auto scrollText = cache.extraFree.back();
+    cache.extraFree.pop_back();
+    return scrollText;
+}
+
+/**
+ * Returns the extra entries and their images, the fixed entries are left in place.
+ */
+void scrolling_text_dispose()
+{
+    auto& cache = _scrollingTextCache;
+    for (auto& shard : cache.shards)
+    {
+        std::scoped_lock<std::mutex> lock(shard.mutex);
+        shard.entries.erase(
+            std::remove_if(
+                shard.entries.begin(), shard.entries.end(),
+                [](const rct_draw_scroll_text* scrollText) {
+                    return scrollText < std::begin(_drawScrollTextList) || scrollText >= std::end(_drawScrollTextList);
+                }),
+            shard.entries.end());
+    }
+
+    std::scoped_lock<std::mutex> lock(cache.extraMutex);
+    for (auto baseImageId : cache.extraImageBases)
+    {
+        gfx_object_free_images(baseImageId, SCROLLING_TEXT_EXTRA_BLOCK_SIZE);
+    }
+    cache.extraImageBases.clear();
+    cache.extraFree.clear();
+    cache.extraBlocks.clear();
+}
+
 static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
 {
     auto offset = font_sprite_get_codepoint_offset(codepoint);
@@ -127,30 +243,59 @@ static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
     }
 }
 
-static int32_t scrolling_text_get_matching_or_oldest(
-    rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+static uint32_t scrolling_text_get_shard_index(
+    rct_string_id stringId, const uint8_t* args, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
 {
-    uint32_t oldestId = 0xFFFFFFFF;
-    int32_t scrollIndex = -1;
-    for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](uint32_t value) { hash = (hash ^ value) * 16777619u; };
+    mix(stringId);
+    mix(scroll);
+    mix(scrollingMode);
+    mix(colour);
+    for (size_t i = 0; i < sizeof(rct_draw_scroll_text::string_args); i++)
+    {
+        mix(args[i]);
+    }
+    return hash % SCROLLING_TEXT_SHARD_COUNT;
+}
+
+static rct_draw_scroll_text* scrolling_text_get_matching_or_oldest(
+    scrolling_text_shard& shard, rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode,
+    colour_t colour, bool* outMatched)
+{
+    rct_draw_scroll_text* oldest = nullptr;
+    for (auto scrollText : shard.entries)
     {
-        rct_draw_scroll_text* scrollText = &_drawScrollTextList[i];
-        if (oldestId >= scrollText->id)
+        if (oldest == nullptr || oldest->id >= scrollText->id)
         {
-            oldestId = scrollText->id;
-            scrollIndex = i;
+            oldest = scrollText;
         }
 
-        // If exact match return the matching index
+        // If exact match return the matching entry
         if (scrollText->string_id == stringId
             && std::memcmp(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args)) == 0
             && scrollText->colour == colour && scrollText->position == scroll && scrollText->mode == scrollingMode)
         {
-            scrollText->id = _drawSCrollNextIndex;
-            return i + SPR_SCROLLING_TEXT_START;
+            scrollText->id = shard.nextId;
+            scrollText->frame = gCurrentDrawCount;
+            *outMatched = true;
+            return scrollText;
+        }
+    }
+
+    // Evicting an entry drawn earlier this frame would change its text under the sign still showing it
+    if (oldest == nullptr || (oldest->frame == gCurrentDrawCount && oldest->id != 0))
+    {
+        auto extra = scrolling_text_allocate_extra();
+        if (extra != nullptr)
+        {
+            shard.entries.push_back(extra);
+            oldest = extra;
         }
     }
-    return scrollIndex;
+
+    *outMatched = false;
+    return oldest;
 }
 
 static void scrolling_text_format(utf8* dst, size_t size, rct_draw_scroll_text* scrollText)
@@ -1433,19 +1578,20 @@ static constexpr const int16_t* _scrollPositions[MAX_SCROLLING_TEXT_MODES] = {
 
 void scrolling_text_invalidate()
 {
-    for (int32_t i = 0; i < MAX_SCROLLING_TEXT_ENTRIES; i++)
+    for (auto& shard : _scrollingTextCache.shards)
     {
-        rct_draw_scroll_text& scrollText = _drawScrollTextList[i];
-        scrollText.string_id = 0;
-        std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
+        std::scoped_lock<std::mutex> lock(shard.mutex);
+        for (auto scrollText : shard.entries)
+        {
+            scrollText->string_id = 0;
+            std::memset(scrollText->string_args, 0, sizeof(scrollText->string_args));
+        }
     }
 }
 
 int32_t scrolling_text_setup(
     paint_session* session, rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
 {
-    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
-
     assert(scrollingMode < MAX_SCROLLING_TEXT_MODES);
 
     rct_drawpixelinfo* dpi = &session->DPI;
@@ -1453,20 +1599,25 @@ int32_t scrolling_text_setup(
     if (dpi->zoom_level > 0)
         return SPR_SCROLLING_TEXT_DEFAULT;
 
-    _drawSCrollNextIndex++;
     ft.Rewind();
-    int32_t scrollIndex = scrolling_text_get_matching_or_oldest(stringId, ft, scroll, scrollingMode, colour);
-    if (scrollIndex >= SPR_SCROLLING_TEXT_START)
-        return scrollIndex;
+    auto shardIndex = scrolling_text_get_shard_index(stringId, ft.Buf(), scroll, scrollingMode, colour);
+    auto& shard = _scrollingTextCache.shards[shardIndex];
+    std::scoped_lock<std::mutex> lock(shard.mutex);
+
+    shard.nextId++;
+    bool matched;
+    auto scrollText = scrolling_text_get_matching_or_oldest(shard, stringId, ft, scroll, scrollingMode, colour, &matched);
+    if (matched)
+        return scrollText->image_id;
 
     // Setup scrolling text
-    auto scrollText = &_drawScrollTextList[scrollIndex];
     scrollText->string_id = stringId;
     std::memcpy(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args));
     scrollText->colour = colour;
     scrollText->position = scroll;
     scrollText->mode = scrollingMode;
-    scrollText->id = _drawSCrollNextIndex;
+    scrollText->id = shard.nextId;
+    scrollText->frame = gCurrentDrawCount;
 
     // Create the string to draw
     utf8 scrollString[256];
@@ -1484,9 +1635,8 @@ int32_t scrolling_text_setup(
         scrolling_text_set_bitmap_for_sprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
     }
 
-    uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
-    drawing_engine_invalidate_image(imageId);
-    return imageId;
+    drawing_engine_invalidate_image(scrollText->image_id);
+    return scrollText->image_id;
 }
 
 static void scrolling_text_set_bitmap_for_sprite(
@@ -9,15 +9,19 @@
 
 #ifndef NO_TTF
 
+#    include <algorithm>
 #    include <atomic>
+#    include <cstring>
+#    include <memory>
 #    include <mutex>
+#    include <unordered_map>
+#    include <vector>
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wdocumentation"
 #    include <ft2build.h>
 #    include FT_FREETYPE_H
 #    pragma clang diagnostic pop
 
-#    include "../OpenRCT2.h"
 #    include "../config/Config.h"
 #    include "../localisation/Localisation.h"
 #    include "../localisation/LocalisationService.h"
@@ -26,43 +30,76 @@
 
 static bool _ttfInitialised = false;
 
-#    define TTF_SURFACE_CACHE_SIZE 256
-#    define TTF_GETWIDTH_CACHE_SIZE 1024
+#    define TTF_GLYPH_ATLAS_PAGE_SIZE 512
+#    define TTF_GLYPH_ATLAS_MAX_PAGES 16
 
-struct ttf_cache_entry
+struct ttf_atlas_glyph
 {
-    TTFSurface* surface;
-    TTF_Font* font;
-    utf8* text;
-    uint32_t lastUseTick;
+    uint32_t index;
+    int16_t minx;
+    int16_t maxx;
+    int16_t miny;
+    int16_t yoffset;
+    int16_t advance;
+    uint16_t width;
+    uint16_t rows;
+    uint16_t pitch;
+    const uint8_t* pixels;
 };
 
-struct ttf_getwidth_cache_entry
+struct ttf_atlas_page
 {
-    uint32_t width;
-    TTF_Font* font;
-    utf8* text;
-    uint32_t lastUseTick;
+    std::unique_ptr<uint8_t[]> pixels;
+    int32_t width;
+    int32_t height;
+    int32_t shelfX;
+    int32_t shelfY;
+    int32_t shelfHeight;
 };
 
-static ttf_cache_entry _ttfSurfaceCache[TTF_SURFACE_CACHE_SIZE] = {};
-static int32_t _ttfSurfaceCacheCount = 0;
-static int32_t _ttfSurfaceCacheHitCount = 0;
-static int32_t _ttfSurfaceCacheMissCount = 0;
+struct ttf_font_glyphs
+{
+    TTFFontMetrics metrics;
+    bool composable;
+    std::unordered_map<uint16_t, ttf_atlas_glyph> glyphs;
+    std::unordered_map<uint64_t, int32_t> kerning;
+};
+
+struct ttf_glyph_run_entry
+{
+    const ttf_atlas_glyph* glyph;
+    int32_t x;
+};
+
+/**
+ * Glyphs are rasterised once per thread into atlas pages and strings are composed from them, so only
+ * glyphs that have never been seen on a thread need the FreeType lock.
+ */
+struct ttf_glyph_cache
+{
+    uint32_t generation = 0;
+    std::unordered_map<const TTF_Font*, ttf_font_glyphs> fonts;
+    std::vector<ttf_atlas_page> pages;
+    std::vector<ttf_glyph_run_entry> run;
+    std::vector<uint8_t> surfacePixels;
+    TTFSurface surface = {};
+    TTFSurface* fallbackSurface = nullptr;
+
+    ~ttf_glyph_cache()
+    {
+        if (fallbackSurface != nullptr)
+            ttf_free_surface(fallbackSurface);
+    }
+};
 
-static ttf_getwidth_cache_entry _ttfGetWidthCache[TTF_GETWIDTH_CACHE_SIZE] = {};
-static int32_t _ttfGetWidthCacheCount = 0;
-static int32_t _ttfGetWidthCacheHitCount = 0;
-static int32_t _ttfGetWidthCacheMissCount = 0;
+static std::atomic<uint32_t> _ttfGlyphCacheGeneration{ 1 };
+static thread_local ttf_glyph_cache _ttfGlyphCache;
 
 static std::mutex _mutex;
 
 static TTF_Font* ttf_open_font(const utf8* fontPath, int32_t ptSize);
 static void ttf_close_font(TTF_Font* font);
-static uint32_t ttf_surface_cache_hash(TTF_Font* font, const utf8* text);
-static void ttf_surface_cache_dispose(ttf_cache_entry* entry);
-static void ttf_surface_cache_dispose_all();
-static void ttf_getwidth_cache_dispose_all();
+static void ttf_glyph_cache_invalidate_all();
 static bool ttf_get_size(TTF_Font* font, const utf8* text, int32_t* width, int32_t* height);
 static void ttf_toggle_hinting(bool);
 static TTFSurface* ttf_render(TTF_Font* font, const utf8* text);
@@ -101,10 +138,7 @@ static void ttf_toggle_hinting(bool)
         TTF_SetFontHinting(fontDesc->font, use_hinting ? 1 : 0);
     }
 
-    if (_ttfSurfaceCacheCount)
-    {
-        ttf_surface_cache_dispose_all();
-    }
+    ttf_glyph_cache_invalidate_all();
 }
 
 bool ttf_initialise()
@@ -153,8 +187,7 @@ void ttf_dispose()
     if (!_ttfInitialised)
         return;
 
-    ttf_surface_cache_dispose_all();
-    ttf_getwidth_cache_dispose_all();
+    ttf_glyph_cache_invalidate_all();
 
     for (int32_t i = 0; i < FONT_SIZE_COUNT; i++)
     {
@@ -181,169 +214,250 @@ static void ttf_close_font(TTF_Font* font)
     TTF_CloseFont(font);
 }
 
-static uint32_t ttf_surface_cache_hash(TTF_Font* font, const utf8* text)
+static void ttf_glyph_cache_invalidate_all()
 {
-    uint32_t hash = static_cast<uint32_t>(((reinterpret_cast<uintptr_t>(font) * 23) ^ 0xAAAAAAAA) & 0xFFFFFFFF);
-    for (const utf8* ch = text; *ch != 0; ch++)
-    {
-        hash = ror32(hash, 3) ^ (*ch * 13);
-    }
-    return hash;
+    // Each thread drops its own glyphs the next time it looks one up
+    _ttfGlyphCacheGeneration.fetch_add(1, std::memory_order_acq_rel);
 }
 
-static void ttf_surface_cache_dispose(ttf_cache_entry* entry)
+static ttf_glyph_cache& ttf_glyph_cache_get()
 {
-    if (entry->surface != nullptr)
+    ttf_glyph_cache& cache = _ttfGlyphCache;
+    uint32_t generation = _ttfGlyphCacheGeneration.load(std::memory_order_acquire);
+    if (cache.generation != generation || cache.pages.size() >= TTF_GLYPH_ATLAS_MAX_PAGES)
     {
-        ttf_free_surface(entry->surface);
-        free(entry->text);
-
-        entry->surface = nullptr;
-        entry->font = nullptr;
-        entry->text = nullptr;
+        cache.fonts.clear();
+        cache.pages.clear();
+        cache.generation = generation;
     }
+    return cache;
 }
 
-static void ttf_surface_cache_dispose_all()
+static ttf_font_glyphs& ttf_glyph_cache_get_font(ttf_glyph_cache& cache, TTF_Font* font)
 {
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
-    {
-        ttf_surface_cache_dispose(&_ttfSurfaceCache[i]);
-        _ttfSurfaceCacheCount--;
-    }
-}
+    auto it = cache.fonts.find(font);
+    if (it != cache.fonts.end())
+        return it->second;
 
-void ttf_toggle_hinting()
-{
+    ttf_font_glyphs& fontGlyphs = cache.fonts[font];
     FontLockHelper<std::mutex> lock(_mutex);
-    ttf_toggle_hinting(true);
+    fontGlyphs.composable = TTF_GetFontMetrics(font, &fontGlyphs.metrics) == 0;
+    return fontGlyphs;
 }
 
-TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, const utf8* text)
+static uint8_t* ttf_glyph_cache_allocate(ttf_glyph_cache& cache, int32_t width, int32_t height, int32_t* outPitch)
 {
-    ttf_cache_entry* entry;
-
-    uint32_t hash = ttf_surface_cache_hash(font, text);
-    int32_t index = hash % TTF_SURFACE_CACHE_SIZE;
-
-    FontLockHelper<std::mutex> lock(_mutex);
-
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
+    if (!cache.pages.empty())
     {
-        entry = &_ttfSurfaceCache[index];
-
-        // Check if entry is a hit
-        if (entry->surface == nullptr)
-            break;
-        if (entry->font == font && strcmp(entry->text, text) == 0)
+        ttf_atlas_page& page = cache.pages.back();
+        if (page.shelfX + width > page.width)
         {
-            _ttfSurfaceCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->surface;
+            page.shelfX = 0;
+            page.shelfY += page.shelfHeight;
+            page.shelfHeight = 0;
         }
-
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
+        if (width <= page.width && page.shelfY + height <= page.height)
         {
-            break;
+            uint8_t* pixels = page.pixels.get() + page.shelfY * page.width + page.shelfX;
+            page.shelfX += width;
+            page.shelfHeight = std::max(page.shelfHeight, height);
+            *outPitch = page.width;
+            return pixels;
         }
-
-        // Check if next entry is a hit
-        if (++index >= TTF_SURFACE_CACHE_SIZE)
-            index = 0;
     }
 
-    // Cache miss, replace entry with new surface
-    entry = &_ttfSurfaceCache[index];
-    ttf_surface_cache_dispose(entry);
+    ttf_atlas_page page;
+    page.width = std::max(width, TTF_GLYPH_ATLAS_PAGE_SIZE);
+    page.height = std::max(height, TTF_GLYPH_ATLAS_PAGE_SIZE);
+    page.pixels = std::make_unique<uint8_t[]>(page.width * page.height);
+    page.shelfX = width;
+    page.shelfY = 0;
+    page.shelfHeight = height;
+    *outPitch = page.width;
+    cache.pages.push_back(std::move(page));
+    return cache.pages.back().pixels.get();
+}
 
-    TTFSurface* surface = ttf_render(font, text);
-    if (surface == nullptr)
-    {
+static const ttf_atlas_glyph* ttf_glyph_cache_get_glyph(
+    ttf_glyph_cache& cache, ttf_font_glyphs& fontGlyphs, TTF_Font* font, uint16_t codepoint)
+{
+    auto it = fontGlyphs.glyphs.find(codepoint);
+    if (it != fontGlyphs.glyphs.end())
+        return &it->second;
+
+    // The port keeps the rasterised glyph in its own font cache, copy it out before releasing the lock
+    FontLockHelper<std::mutex> lock(_mutex);
+    TTFGlyph glyph;
+    if (TTF_GetGlyph(font, codepoint, fontGlyphs.metrics.shaded, &glyph) != 0)
         return nullptr;
+
+    ttf_atlas_glyph atlasGlyph = {};
+    atlasGlyph.index = glyph.index;
+    atlasGlyph.minx = static_cast<int16_t>(glyph.minx);
+    atlasGlyph.maxx = static_cast<int16_t>(glyph.maxx);
+    atlasGlyph.miny = static_cast<int16_t>(glyph.miny);
+    atlasGlyph.yoffset = static_cast<int16_t>(glyph.yoffset);
+    atlasGlyph.advance = static_cast<int16_t>(glyph.advance);
+    if (glyph.width > 0 && glyph.rows > 0 && glyph.pixels != nullptr)
+    {
+        int32_t pitch;
+        uint8_t* pixels = ttf_glyph_cache_allocate(cache, glyph.width, glyph.rows, &pitch);
+        for (int32_t row = 0; row < glyph.rows; row++)
+        {
+            std::memcpy(pixels + row * pitch, glyph.pixels + row * glyph.pitch, glyph.width);
+        }
+        atlasGlyph.width = static_cast<uint16_t>(glyph.width);
+        atlasGlyph.rows = static_cast<uint16_t>(glyph.rows);
+        atlasGlyph.pitch = static_cast<uint16_t>(pitch);
+        atlasGlyph.pixels = pixels;
     }
+    return &fontGlyphs.glyphs.emplace(codepoint, atlasGlyph).first->second;
+}
 
-    _ttfSurfaceCacheMissCount++;
-    // printf("CACHE HITS: %d   MISSES: %d)\n", _ttfSurfaceCacheHitCount, _ttfSurfaceCacheMissCount);
+static int32_t ttf_glyph_cache_get_kerning(ttf_font_glyphs& fontGlyphs, TTF_Font* font, uint32_t prevIndex, uint32_t index)
+{
+    uint64_t key = (static_cast<uint64_t>(prevIndex) << 32) | index;
+    auto it = fontGlyphs.kerning.find(key);
+    if (it != fontGlyphs.kerning.end())
+        return it->second;
 
-    _ttfSurfaceCacheCount++;
-    entry->surface = surface;
-    entry->font = font;
-    entry->text = _strdup(text);
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->surface;
+    FontLockHelper<std::mutex> lock(_mutex);
+    int32_t kerning = TTF_GetKerning(font, prevIndex, index);
+    fontGlyphs.kerning.emplace(key, kerning);
+    return kerning;
 }
 
-static void ttf_getwidth_cache_dispose(ttf_getwidth_cache_entry* entry)
+/**
+ * Lays out the glyphs of a string the same way TTF_SizeUTF8 measures it and TTF_RenderUTF8_* draws it.
+ */
+static bool ttf_glyph_cache_layout(
+    ttf_glyph_cache& cache, ttf_font_glyphs& fontGlyphs, TTF_Font* font, const utf8* text, int32_t* outWidth,
+    int32_t* outHeight)
 {
-    if (entry->text != nullptr)
+    int32_t x = 0;
+    int32_t minx = 0;
+    int32_t maxx = 0;
+    int32_t miny = 0;
+    uint32_t prevIndex = 0;
+
+    cache.run.clear();
+    const utf8* ch = text;
+    uint32_t codepoint;
+    while ((codepoint = utf8_get_next(ch, &ch)) != 0)
     {
-        free(entry->text);
+        // The port only handles the basic multilingual plane
+        auto c = static_cast<uint16_t>(codepoint);
+        if (c == 0xFEFF || c == 0xFFFE)
+            continue;
+
+        const ttf_atlas_glyph* glyph = ttf_glyph_cache_get_glyph(cache, fontGlyphs, font, c);
+        if (glyph == nullptr)
+            return false;
 
-        entry->width = 0;
-        entry->font = nullptr;
-        entry->text = nullptr;
+        if (fontGlyphs.metrics.kerning && prevIndex != 0 && glyph->index != 0)
+        {
+            x += ttf_glyph_cache_get_kerning(fontGlyphs, font, prevIndex, glyph->index);
+        }
+        minx = std::min(minx, x + glyph->minx);
+        maxx = std::max(maxx, x + std::max<int32_t>(glyph->advance, glyph->maxx));
+        miny = std::min<int32_t>(miny, glyph->miny);
+        cache.run.push_back({ glyph, x });
+        x += glyph->advance;
+        prevIndex = glyph->index;
     }
+
+    *outWidth = maxx - minx;
+    *outHeight = std::max(fontGlyphs.metrics.ascent - miny, fontGlyphs.metrics.height);
+    return true;
 }
 
-static void ttf_getwidth_cache_dispose_all()
+static TTFSurface* ttf_glyph_cache_compose(ttf_glyph_cache& cache, int32_t width, int32_t height)
 {
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+    cache.surfacePixels.assign(static_cast<size_t>(width) * height, 0);
+    uint8_t* surfacePixels = cache.surfacePixels.data();
+
+    // Compensate for a first glyph with a negative minx, as the string renderers do
+    int32_t xstart = 0;
+    if (!cache.run.empty() && cache.run.front().glyph->minx < 0)
+        xstart = -cache.run.front().glyph->minx;
+
+    for (const auto& entry : cache.run)
     {
-        ttf_getwidth_cache_dispose(&_ttfGetWidthCache[i]);
-        _ttfGetWidthCacheCount--;
+        const ttf_atlas_glyph* glyph = entry.glyph;
+        int32_t dstX = xstart + entry.x + glyph->minx;
+        int32_t colStart = std::max(0, -dstX);
+        int32_t colEnd = std::min<int32_t>(glyph->width, width - dstX);
+        if (colStart >= colEnd)
+            continue;
+
+        for (int32_t row = 0; row < glyph->rows; row++)
+        {
+            int32_t dstY = row + glyph->yoffset;
+            if (dstY < 0 || dstY >= height)
+                continue;
+
+            const uint8_t* src = glyph->pixels + row * glyph->pitch;
+            uint8_t* dst = surfacePixels + dstY * width + dstX;
+            for (int32_t col = colStart; col < colEnd; col++)
+            {
+                dst[col] |= src[col];
+            }
+        }
     }
+
+    cache.surface.pixels = surfacePixels;
+    cache.surface.w = width;
+    cache.surface.h = height;
+    cache.surface.pitch = width;
+    return &cache.surface;
 }
 
-uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, const utf8* text)
+void ttf_toggle_hinting()
 {
-    ttf_getwidth_cache_entry* entry;
-
-    uint32_t hash = ttf_surface_cache_hash(font, text);
-    int32_t index = hash % TTF_GETWIDTH_CACHE_SIZE;
-
     FontLockHelper<std::mutex> lock(_mutex);
+    ttf_toggle_hinting(true);
+}
 
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, const utf8* text)
+{
+    ttf_glyph_cache& cache = ttf_glyph_cache_get();
+    ttf_font_glyphs& fontGlyphs = ttf_glyph_cache_get_font(cache, font);
+    if (!fontGlyphs.composable)
     {
-        entry = &_ttfGetWidthCache[index];
-
-        // Check if entry is a hit
-        if (entry->text == nullptr)
-            break;
-        if (entry->font == font && strcmp(entry->text, text) == 0)
-        {
-            _ttfGetWidthCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->width;
-        }
-
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
+        if (cache.fallbackSurface != nullptr)
         {
-            break;
+            ttf_free_surface(cache.fallbackSurface);
         }
-
-        // Check if next entry is a hit
-        if (++index >= TTF_GETWIDTH_CACHE_SIZE)
-            index = 0;
+        FontLockHelper<std::mutex> lock(_mutex);
+        cache.fallbackSurface = ttf_render(font, text);
+        return cache.fallbackSurface;
     }
 
-    // Cache miss, replace entry with new width
-    entry = &_ttfGetWidthCache[index];
-    ttf_getwidth_cache_dispose(entry);
-
     int32_t width, height;
-    ttf_get_size(font, text, &width, &height);
+    if (!ttf_glyph_cache_layout(cache, fontGlyphs, font, text, &width, &height) || width == 0)
+    {
+        return nullptr;
+    }
+    return ttf_glyph_cache_compose(cache, width, height);
+}
 
-    _ttfGetWidthCacheMissCount++;
+uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, const utf8* text)
+{
+    ttf_glyph_cache& cache = ttf_glyph_cache_get();
+    ttf_font_glyphs& fontGlyphs = ttf_glyph_cache_get_font(cache, font);
 
-    _ttfGetWidthCacheCount++;
-    entry->width = width;
-    entry->font = font;
-    entry->text = _strdup(text);
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->width;
+    int32_t width = 0;
+    int32_t height = 0;
+    if (!fontGlyphs.composable)
+    {
+        FontLockHelper<std::mutex> lock(_mutex);
+        ttf_get_size(font, text, &width, &height);
+    }
+    else if (!ttf_glyph_cache_layout(cache, fontGlyphs, font, text, &width, &height))
+    {
+        return 0;
+    }
+    return width;
 }
 
 TTFFontDescriptor* ttf_get_font_from_sprite_base(uint16_t spriteBase)
@@ -24,8 +24,32 @@ struct TTFSurface
     int32_t pitch;
 };
 
+struct TTFFontMetrics
+{
+    int32_t height;
+    int32_t ascent;
+    bool kerning;
+    bool shaded;
+};
+
+struct TTFGlyph
+{
+    uint32_t index;
+    int32_t minx;
+    int32_t maxx;
+    int32_t miny;
+    int32_t maxy;
+    int32_t yoffset;
+    int32_t advance;
+    int32_t width;
+    int32_t rows;
+    int32_t pitch;
+    const uint8_t* pixels;
+};
+
 TTFFontDescriptor* ttf_get_font_from_sprite_base(uint16_t spriteBase);
 void ttf_toggle_hinting();
+// The returned surface is owned by the calling thread and is only valid until its next call.
 TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, const utf8* text);
 uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, const utf8* text);
 bool ttf_provides_glyph(const TTF_Font* font, codepoint_t codepoint);
@@ -35,6 +59,9 @@ void ttf_free_surface(TTFSurface* surface);
 int TTF_Init(void);
 TTF_Font* TTF_OpenFont(const char* file, int ptsize);
 int TTF_GlyphIsProvided(const TTF_Font* font, codepoint_t ch);
+int TTF_GetFontMetrics(const TTF_Font* font, TTFFontMetrics* metrics);
+int TTF_GetGlyph(TTF_Font* font, uint16_t ch, int shaded, TTFGlyph* glyph);
+int TTF_GetKerning(TTF_Font* font, uint32_t prevIndex, uint32_t index);
 int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h);
 TTFSurface* TTF_RenderUTF8_Solid(TTF_Font* font, const char* text, uint32_t colour);
 TTFSurface* TTF_RenderUTF8_Shaded(TTF_Font* font, const char* text, uint32_t fg, uint32_t bg);
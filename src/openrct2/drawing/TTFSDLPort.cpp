@@ -1126,6 +1126,70 @@ int TTF_GlyphIsProvided(const TTF_Font* font, codepoint_t ch)
     return (FT_Get_Char_Index(font->face, ch));
 }
 
+int TTF_GetFontMetrics(const TTF_Font* font, TTFFontMetrics* metrics)
+{
+    TTF_CHECKPOINTER(font, -1);
+
+    /* Styled and outlined glyphs depend on more than their own bitmap, leave those to the string renderers */
+    if (TTF_HANDLE_STYLE_BOLD(font) || TTF_HANDLE_STYLE_UNDERLINE(font) || TTF_HANDLE_STYLE_STRIKETHROUGH(font)
+        || font->outline > 0)
+    {
+        return -1;
+    }
+
+    metrics->height = font->height;
+    metrics->ascent = font->ascent;
+    metrics->kerning = FT_HAS_KERNING(font->face) && font->kerning;
+    metrics->shaded = TTF_GetFontHinting(font) != 0;
+    return 0;
+}
+
+int TTF_GetGlyph(TTF_Font* font, uint16_t ch, int shaded, TTFGlyph* glyph)
+{
+    FT_Error error;
+    c_glyph* cached;
+    FT_Bitmap* bitmap;
+
+    TTF_CHECKPOINTER(font, -1);
+
+    error = Find_Glyph(font, ch, CACHED_METRICS | (shaded ? CACHED_PIXMAP : CACHED_BITMAP));
+    if (error)
+    {
+        TTF_SetFTError("Couldn't find glyph", error);
+        return -1;
+    }
+    cached = font->current;
+    bitmap = shaded ? &cached->pixmap : &cached->bitmap;
+
+    glyph->index = cached->index;
+    glyph->minx = cached->minx;
+    glyph->maxx = cached->maxx;
+    glyph->miny = cached->miny;
+    glyph->maxy = cached->maxy;
+    glyph->yoffset = cached->yoffset;
+    glyph->advance = cached->advance;
+
+    /* Same clamp as the string renderers, freetype may report a larger pixmap than possible */
+    glyph->width = std::min(static_cast<int>(bitmap->width), cached->maxx - cached->minx);
+    glyph->rows = bitmap->rows;
+    glyph->pitch = bitmap->pitch;
+    glyph->pixels = bitmap->buffer;
+    return 0;
+}
+
+int TTF_GetKerning(TTF_Font* font, uint32_t prevIndex, uint32_t index)
+{
+    FT_Vector delta;
+
+    TTF_CHECKPOINTER(font, 0);
+
+    if (FT_Get_Kerning(font->face, prevIndex, index, ft_kerning_default, &delta) != 0)
+    {
+        return 0;
+    }
+    return delta.x >> 6;
+}
+
 int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h)
 {
     int status;
@@ -31,16 +31,6 @@ using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Ui;
 
-X8WeatherDrawer::X8WeatherDrawer()
-{
-    _weatherPixels = new WeatherPixel[_weatherPixelsCapacity];
-}
-
-X8WeatherDrawer::~X8WeatherDrawer()
-{
-    delete[] _weatherPixels;
-}
-
 void X8WeatherDrawer::SetDPI(rct_drawpixelinfo* dpi)
 {
     _screenDPI = dpi;
@@ -61,29 +51,31 @@ void X8WeatherDrawer::Draw(
 
     uint8_t* screenBits = _screenDPI->bits;
 
-    // Stores the colours of changed pixels
-    WeatherPixel* newPixels = &_weatherPixels[_weatherPixelsCount];
     for (; height != 0; height--)
     {
         uint8_t patternX = pattern[patternYPos * 2];
         if (patternX != 0xFF)
         {
-            if (_weatherPixelsCount < (_weatherPixelsCapacity - static_cast<uint32_t>(width)))
+            uint32_t firstX = (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
+            if (firstX < static_cast<uint32_t>(width))
             {
-                uint32_t finalPixelOffset = width + pixelOffset;
-
-                uint32_t xPixelOffset = pixelOffset;
-                xPixelOffset += (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
+                // Save the whole row as one run rather than recording every pixel's position
+                WeatherRun run;
+                run.Position = pixelOffset + firstX;
+                run.Count = (width - firstX + patternXSpace - 1) / patternXSpace;
+                run.Stride = patternXSpace;
+                run.SavedIndex = static_cast<uint32_t>(_weatherSavedPixels.size());
+                _weatherRuns.push_back(run);
+                _weatherSavedPixels.resize(_weatherSavedPixels.size() + run.Count);
 
                 uint8_t patternPixel = pattern[patternYPos * 2 + 1];
-                for (; xPixelOffset < finalPixelOffset; xPixelOffset += patternXSpace)
+                uint8_t* saved = &_weatherSavedPixels[run.SavedIndex];
+                uint8_t* dst = &screenBits[run.Position];
+                for (uint32_t i = 0; i < run.Count; i++)
                 {
-                    uint8_t current_pixel = screenBits[xPixelOffset];
-                    screenBits[xPixelOffset] = patternPixel;
-                    _weatherPixelsCount++;
-
-                    // Store colour and position
-                    *newPixels++ = { xPixelOffset, current_pixel };
+                    saved[i] = *dst;
+                    *dst = patternPixel;
+                    dst += patternXSpace;
                 }
             }
         }
@@ -96,22 +88,31 @@ void X8WeatherDrawer::Draw(
 
 void X8WeatherDrawer::Restore()
 {
-    if (_weatherPixelsCount > 0)
+    if (!_weatherRuns.empty())
     {
         uint32_t numPixels = (_screenDPI->width + _screenDPI->pitch) * _screenDPI->height;
         uint8_t* bits = _screenDPI->bits;
-        for (uint32_t i = 0; i < _weatherPixelsCount; i++)
+
+        // Undo the runs newest first so pixels hit by more than one layer end up with their original colour
+        for (auto it = _weatherRuns.rbegin(); it != _weatherRuns.rend(); it++)
         {
-            WeatherPixel weatherPixel = _weatherPixels[i];
-            if (weatherPixel.Position >= numPixels)
+            const WeatherRun& run = *it;
+            if (run.Position + (run.Count - 1) * run.Stride >= numPixels)
             {
-                // Pixel out of bounds, bail
-                break;
+                // Run out of bounds, skip
+                continue;
             }
 
-            bits[weatherPixel.Position] = weatherPixel.Colour;
+            const uint8_t* saved = &_weatherSavedPixels[run.SavedIndex];
+            uint8_t* dst = &bits[run.Position];
+            for (uint32_t i = 0; i < run.Count; i++)
+            {
+                *dst = saved[i];
+                dst += run.Stride;
+            }
         }
-        _weatherPixelsCount = 0;
+        _weatherRuns.clear();
+        _weatherSavedPixels.clear();
     }
 }
 
@@ -38,22 +38,20 @@ namespace OpenRCT2
         class X8WeatherDrawer final : public IWeatherDrawer
         {
         private:
-            struct WeatherPixel
+            // One pattern row drawn into a region: every Stride-th pixel from Position, Count pixels in all
+            struct WeatherRun
             {
                 uint32_t Position;
-                uint8_t Colour;
+                uint32_t Count;
+                uint32_t Stride;
+                uint32_t SavedIndex;
             };
 
-            static constexpr uint32_t MaxWeatherPixels = 0xFFFE;
-
-            size_t _weatherPixelsCapacity = MaxWeatherPixels;
-            uint32_t _weatherPixelsCount = 0;
-            WeatherPixel* _weatherPixels = nullptr;
+            std::vector<WeatherRun> _weatherRuns;
+            std::vector<uint8_t> _weatherSavedPixels;
             rct_drawpixelinfo* _screenDPI = nullptr;
 
         public:
-            X8WeatherDrawer();
-            ~X8WeatherDrawer();
             void SetDPI(rct_drawpixelinfo* dpi);
             void Draw(
                 int32_t x, int32_t y, int32_t width, int32_t height, int32_t xStart, int32_t yStart,
@@ -9,8 +9,10 @@
 
 #include "Fonts.h"
 
+#include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../core/String.hpp"
+#include "../drawing/Drawing.h"
 #include "../drawing/TTF.h"
 #include "../localisation/Language.h"
 #include "../localisation/LocalisationService.h"
@@ -140,7 +142,16 @@ static bool LoadCustomConfigFont(LocalisationService& localisationService)
 
 void TryLoadFonts(LocalisationService& localisationService)
 {
+    gfx_text_layout_cache_invalidate();
+
 #ifndef NO_TTF
+    // Nothing is drawn without graphics, so there is no need to keep TrueType faces in memory
+    if (gOpenRCT2NoGraphics)
+    {
+        LoadSpriteFont(localisationService);
+        return;
+    }
+
     auto currentLanguage = localisationService.GetCurrentLanguage();
     TTFontFamily const* fontFamily = LanguagesDescriptors[currentLanguage].font_family;
 
@@ -11,10 +11,13 @@
 
 #include "../Context.h"
 #include "../EditorObjectSelectionSession.h"
+#include "../FrameProfiler.h"
 #include "../Game.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../ReplayManager.h"
+#include "../MemoryReport.h"
+#include "../TickProfiler.h"
 #include "../Version.h"
 #include "../actions/ClimateSetAction.hpp"
 #include "../actions/RideSetPriceAction.hpp"
@@ -39,6 +42,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
+#include "../paint/Paint.h"
 #include "../peep/Staff.h"
 #include "../platform/platform.h"
 #include "../ride/Ride.h"
@@ -65,6 +69,10 @@
 #    include "../drawing/TTF.h"
 #endif
 
+#ifdef ENABLE_SCRIPTING
+#    include "../scripting/ScriptEngine.h"
+#endif
+
 using arguments_t = std::vector<std::string>;
 
 static constexpr const char* ClimateNames[] = {
@@ -224,6 +232,7 @@ static int32_t cc_rides(InteractiveConsole& console, const arguments_t& argv)
                     }
                     else
                     {
+                        ride->Wake();
                         ride->mode = static_cast<RideMode>(mode & 0xFF);
                         invalidate_test_results(ride);
                     }
@@ -644,6 +653,14 @@ static int32_t cc_get(InteractiveConsole& console, const arguments_t& argv)
         {
             console.WriteFormatLine("game_speed %d", gGameSpeed);
         }
+        else if (argv[0] == "turbo")
+        {
+            console.WriteFormatLine("turbo %d (%u ticks per second)", gTurboMode ? 1 : 0, gTurboTicksPerSecond);
+        }
+        else if (argv[0] == "turbo_preview_rate")
+        {
+            console.WriteFormatLine("turbo_preview_rate %d", gTurboPreviewRate);
+        }
         else if (argv[0] == "console_small_font")
         {
             console.WriteFormatLine("console_small_font %d", gConfigInterface.console_small_font);
@@ -673,6 +690,10 @@ static int32_t cc_get(InteractiveConsole& console, const arguments_t& argv)
         {
             console.WriteFormatLine("render_weather_effects %d", gConfigGeneral.render_weather_effects);
         }
+        else if (argv[0] == "show_frame_timings")
+        {
+            console.WriteFormatLine("show_frame_timings %d", gConfigGeneral.show_frame_timings);
+        }
         else if (argv[0] == "render_weather_gloom")
         {
             console.WriteFormatLine("render_weather_gloom %d", gConfigGeneral.render_weather_gloom);
@@ -693,6 +714,14 @@ static int32_t cc_get(InteractiveConsole& console, const arguments_t& argv)
         {
             console.WriteFormatLine("current_rotation %d", get_current_rotation());
         }
+        else if (argv[0] == "paint_arrange_engine")
+        {
+            console.WriteFormatLine("paint_arrange_engine %d", static_cast<int32_t>(gPaintArrangeEngine));
+        }
+        else if (argv[0] == "paint_height_culling")
+        {
+            console.WriteFormatLine("paint_height_culling %d", gPaintHeightCulling);
+        }
 #ifndef NO_TTF
         else if (argv[0] == "enable_hinting")
         {
@@ -897,6 +926,16 @@ static int32_t cc_set(InteractiveConsole& console, const arguments_t& argv)
             gGameSpeed = std::clamp(int_val[0], 1, 8);
             console.Execute("get game_speed");
         }
+        else if (argv[0] == "turbo" && invalidArguments(&invalidArgs, int_valid[0]))
+        {
+            game_set_turbo_mode(int_val[0] != 0);
+            console.Execute("get turbo");
+        }
+        else if (argv[0] == "turbo_preview_rate" && invalidArguments(&invalidArgs, int_valid[0]))
+        {
+            gTurboPreviewRate = std::clamp(int_val[0], 1, static_cast<int32_t>(GAME_UPDATE_FPS));
+            console.Execute("get turbo_preview_rate");
+        }
         else if (argv[0] == "console_small_font" && invalidArguments(&invalidArgs, int_valid[0]))
         {
             gConfigInterface.console_small_font = (int_val[0] != 0);
@@ -936,6 +975,12 @@ static int32_t cc_set(InteractiveConsole& console, const arguments_t& argv)
             config_save_default();
             console.Execute("get render_weather_effects");
         }
+        else if (argv[0] == "show_frame_timings" && invalidArguments(&invalidArgs, int_valid[0]))
+        {
+            gConfigGeneral.show_frame_timings = (int_val[0] != 0);
+            config_save_default();
+            console.Execute("get show_frame_timings");
+        }
         else if (argv[0] == "render_weather_gloom" && invalidArguments(&invalidArgs, int_valid[0]))
         {
             gConfigGeneral.render_weather_gloom = (int_val[0] != 0);
@@ -1011,6 +1056,25 @@ static int32_t cc_set(InteractiveConsole& console, const arguments_t& argv)
             }
             console.Execute("get current_rotation");
         }
+        else if (argv[0] == "paint_arrange_engine" && invalidArguments(&invalidArgs, int_valid[0]))
+        {
+            if (int_val[0] < 0 || int_val[0] > static_cast<int32_t>(PaintArrangeEngine::Flat))
+            {
+                console.WriteLineError("Invalid argument. Valid engines are 0 (linked) and 1 (flat).");
+            }
+            else
+            {
+                gPaintArrangeEngine = static_cast<PaintArrangeEngine>(int_val[0]);
+                gfx_invalidate_screen();
+            }
+            console.Execute("get paint_arrange_engine");
+        }
+        else if (argv[0] == "paint_height_culling" && invalidArguments(&invalidArgs, int_valid[0]))
+        {
+            gPaintHeightCulling = (int_val[0] != 0);
+            gfx_invalidate_screen();
+            console.Execute("get paint_height_culling");
+        }
 #ifndef NO_TTF
         else if (argv[0] == "enable_hinting" && invalidArguments(&invalidArgs, int_valid[0]))
         {
@@ -1205,16 +1269,16 @@ static int32_t cc_remove_floating_objects(InteractiveConsole& console, const arg
 
 static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+    map_for_each_tile_parallel([](const TileElementSpan& span) {
+        for (auto& element : span)
         {
-            // Remove all park fence flags
-            it.element->AsSurface()->SetParkFences(0);
+            if (element.GetType() == TILE_ELEMENT_TYPE_SURFACE)
+            {
+                // Remove all park fence flags
+                element.AsSurface()->SetParkFences(0);
+            }
         }
-    } while (tile_element_iterator_next(&it));
+    });
 
     gfx_invalidate_screen();
 
@@ -1225,7 +1289,7 @@ static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused
 static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     map_reorganise_elements();
-    int32_t tileElementCount = gNextFreeTileElement - gTileElements - 1;
+    int32_t tileElementCount = gNextFreeTileElement - gTileElements.data() - 1;
 
     int32_t rideCount = ride_get_count();
     int32_t spriteCount = 0;
@@ -1262,6 +1326,155 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     return 0;
 }
 
+static int32_t cc_paint_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const auto& stats = viewport_get_paint_stats();
+    console.WriteFormatLine(
+        "Paint sessions: %u (%u columns split, %u shared)", stats.Columns, stats.SplitColumns, stats.SharedColumns);
+    console.WriteFormatLine("Threads: %u", stats.Threads);
+    console.WriteFormatLine(
+        "Generate time: %.2f ms total, %.2f ms longest session", stats.TotalTime * 1000, stats.LongestTime * 1000);
+    console.WriteFormatLine("Wall time: %.2f ms", stats.WallTime * 1000);
+    console.WriteFormatLine(
+        "Generate / arrange / draw: %.2f / %.2f / %.2f ms", stats.GenerateTime * 1000, stats.ArrangeTime * 1000,
+        stats.DrawTime * 1000);
+    console.WriteFormatLine("Load balance: %.0f%%", stats.GetBalance() * 100);
+    return 0;
+}
+
+static int32_t cc_peep_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const auto& stats = peep_get_tick_128_stats();
+    const auto [fewest, most] = std::minmax_element(stats.Peeps.begin(), stats.Peeps.end());
+    console.WriteFormatLine("Buckets: %u (%u to %u peeps each)", static_cast<uint32_t>(stats.NumBuckets), *fewest, *most);
+    console.WriteFormatLine(
+        "128 tick update time: %.3f ms mean, %.3f ms longest, %.3f ms standard deviation", stats.GetMean() * 1000,
+        stats.GetLongest() * 1000, stats.GetStandardDeviation() * 1000);
+    return 0;
+}
+
+static int32_t cc_tick_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    using namespace OpenRCT2::TickProfiler;
+
+    const auto& samples = GetSamples();
+    if (samples.empty())
+    {
+        console.WriteLine("No ticks have been recorded yet.");
+        return 0;
+    }
+
+    console.WriteFormatLine("Last %u ticks, mean / longest:", static_cast<uint32_t>(samples.size()));
+    for (size_t i = 0; i < StageCount; i++)
+    {
+        const auto stage = static_cast<Stage>(i);
+        const auto summary = GetStageSummary(stage);
+        const auto name = std::string(GetStageName(stage));
+        console.WriteFormatLine("  %-20s %8.3f ms %8.3f ms", name.c_str(), summary.Mean * 1000, summary.Longest * 1000);
+    }
+    const auto total = GetTotalSummary();
+    console.WriteFormatLine("  %-20s %8.3f ms %8.3f ms", "total", total.Mean * 1000, total.Longest * 1000);
+    return 0;
+}
+
+static int32_t cc_memory_report(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    uint64_t totalBytes = 0;
+    console.WriteLine("Memory held by each subsystem:");
+    for (const auto& entry : OpenRCT2::MemoryReport::GetEntries())
+    {
+        const auto name = std::string(entry.Name);
+        if (entry.Items != 0)
+        {
+            console.WriteFormatLine(
+                "  %-16s %10.2f MiB %10u items", name.c_str(), entry.Bytes / (1024.0 * 1024.0),
+                static_cast<uint32_t>(entry.Items));
+        }
+        else
+        {
+            console.WriteFormatLine("  %-16s %10.2f MiB", name.c_str(), entry.Bytes / (1024.0 * 1024.0));
+        }
+        totalBytes += entry.Bytes;
+    }
+    console.WriteFormatLine("  %-16s %10.2f MiB", "total", totalBytes / (1024.0 * 1024.0));
+    return 0;
+}
+
+static int32_t cc_plugin_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    using namespace OpenRCT2::Scripting;
+
+    auto& plugins = OpenRCT2::GetContext()->GetScriptEngine().GetPlugins();
+    if (plugins.empty())
+    {
+        console.WriteLine("No plugins are loaded.");
+        return 0;
+    }
+
+    console.WriteLine("Calls, total / longest / last tick time:");
+    for (const auto& plugin : plugins)
+    {
+        const auto& stats = plugin->GetPerformanceStats();
+        console.WriteFormatLine(
+            "%s: %llu calls, %.3f ms / %.3f ms / %.3f ms, %llu ticks over budget, %llu calls throttled",
+            plugin->GetMetadata().Name.c_str(), static_cast<unsigned long long>(stats.Total.Calls),
+            stats.Total.TotalTime * 1000, stats.Total.LongestTime * 1000, stats.LastPeriodTime * 1000,
+            static_cast<unsigned long long>(stats.PeriodsOverSoftBudget),
+            static_cast<unsigned long long>(stats.ThrottledCalls));
+        for (size_t i = 0; i <= NUM_HOOK_TYPES; i++)
+        {
+            const auto& hookStats = stats.Hooks[i];
+            if (hookStats.Calls == 0)
+                continue;
+
+            auto name = i < NUM_HOOK_TYPES ? std::string(GetHookTypeName(static_cast<HOOK_TYPE>(i))) : "other";
+            console.WriteFormatLine(
+                "  %-24s %8llu calls %10.3f ms %8.3f ms", name.c_str(), static_cast<unsigned long long>(hookStats.Calls),
+                hookStats.TotalTime * 1000, hookStats.LongestTime * 1000);
+        }
+    }
+#else
+    console.WriteLine("Plugins are not supported by this build.");
+#endif
+    return 0;
+}
+
+static int32_t cc_frame_stats(InteractiveConsole& console, const arguments_t& argv)
+{
+    using namespace OpenRCT2::FrameProfiler;
+
+    if (!argv.empty())
+    {
+        if (!WriteTrace(argv[0]))
+        {
+            console.WriteLineError("Unable to write the frame trace.");
+            return 1;
+        }
+        console.WriteFormatLine("Wrote %u frames to %s", static_cast<uint32_t>(GetSamples().size()), argv[0].c_str());
+        return 0;
+    }
+
+    const auto& samples = GetSamples();
+    if (samples.empty())
+    {
+        console.WriteLine("No frames have been recorded yet.");
+        return 0;
+    }
+
+    console.WriteFormatLine("Last %u frames, mean / longest:", static_cast<uint32_t>(samples.size()));
+    for (size_t i = 0; i < StageCount; i++)
+    {
+        const auto stage = static_cast<Stage>(i);
+        const auto summary = GetStageSummary(stage);
+        const auto name = std::string(GetStageName(stage));
+        console.WriteFormatLine("  %-20s %8.3f ms %8.3f ms", name.c_str(), summary.Mean * 1000, summary.Longest * 1000);
+    }
+    const auto total = GetTotalSummary();
+    console.WriteFormatLine("  %-20s %8.3f ms %8.3f ms", "total", total.Mean * 1000, total.Longest * 1000);
+    return 0;
+}
+
 static int32_t cc_for_date([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     int32_t year = 0;
@@ -1531,6 +1744,38 @@ static int32_t cc_replay_stop(InteractiveConsole& console, const arguments_t& ar
     return 0;
 }
 
+static int32_t cc_replay_seek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (network_get_mode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <replay_tick>");
+        return 0;
+    }
+
+    bool valid;
+    int32_t replayTick = console_parse_int(argv[0], &valid);
+    if (!valid || replayTick < 0)
+    {
+        console.WriteFormatLine("Invalid tick");
+        return 0;
+    }
+
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (replayManager->SeekPlayback(static_cast<uint32_t>(replayTick)))
+    {
+        console.WriteFormatLine("Replay is now at tick %u", gCurrentTicks);
+        return 1;
+    }
+
+    return 0;
+}
+
 static int32_t cc_replay_normalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (network_get_mode() != NETWORK_MODE_NONE)
@@ -1745,16 +1990,21 @@ static constexpr const utf8* console_variable_table[] = {
     "park_open",
     "climate",
     "game_speed",
+    "turbo",
+    "turbo_preview_rate",
     "console_small_font",
     "location",
     "window_scale",
     "window_limit",
     "render_weather_effects",
     "render_weather_gloom",
+    "show_frame_timings",
     "cheat_sandbox_mode",
     "cheat_disable_clearance_checks",
     "cheat_disable_support_limits",
     "current_rotation",
+    "paint_arrange_engine",
+    "paint_height_culling",
 };
 static constexpr const utf8* console_window_table[] = {
     "object_selection",
@@ -1777,6 +2027,7 @@ static constexpr const console_command console_command_table[] = {
     { "echo", cc_echo, "Echoes the text to the console.", "echo <text>" },
     { "exit", cc_close, "Closes the console.", "exit" },
     { "get", cc_get, "Gets the value of the specified variable.", "get <variable>" },
+    { "frame_stats", cc_frame_stats, "Shows how long each part of the last recorded frames took, or writes them to a CSV file.", "frame_stats [file]" },
     { "help", cc_help, "Lists commands or info about a command.", "help [command]" },
     { "hide", cc_hide, "Hides the console.", "hide" },
     { "load_object", cc_load_object, "Loads the object file into the scenario.\n"
@@ -1784,8 +2035,12 @@ static constexpr const console_command console_command_table[] = {
                                     "This is a safer method opposed to \"open object_selection\".",
                                     "load_object <objectfilenodat>" },
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
+    { "memory_report", cc_memory_report, "Shows how much memory each of the larger subsystems holds.", "memory_report" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "paint_stats", cc_paint_stats, "Shows how the viewport paint work of the last frame was spread across threads.", "paint_stats" },
+    { "plugin_stats", cc_plugin_stats, "Shows how long each plugin and each of its hooks took to run.", "plugin_stats" },
+    { "peep_stats", cc_peep_stats, "Shows how long the 128 tick peep updates of each bucket took the last time it ran.", "peep_stats" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
@@ -1796,6 +2051,7 @@ static constexpr const console_command console_command_table[] = {
     { "set", cc_set, "Sets the variable to the specified value.", "set <variable> <value>" },
     { "show_limits", cc_show_limits, "Shows the map data counts and limits.", "show_limits" },
     { "staff", cc_staff, "Staff management.", "staff <subcommand>" },
+    { "tick_stats", cc_tick_stats, "Shows how long each stage of the game logic took over the last recorded ticks.", "tick_stats" },
     { "terminate", cc_terminate, "Calls std::terminate(), for testing purposes only.", "terminate" },
     { "variables", cc_variables, "Lists all the variables that can be used with get and sometimes set.", "variables" },
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
@@ -1803,6 +2059,7 @@ static constexpr const console_command console_command_table[] = {
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord"},
     { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>"},
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop"},
+    { "replay_seek", cc_replay_seek, "Jumps to a tick of the replay that is playing", "replay_seek <ticks since start>"},
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps", "replay_normalise <input file> <output file>"},
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync", "cc_mp_desync [desync_type, 0 = Random t-shirt color on random peep, 1 = Remove random peep ]"},
 
@@ -15,11 +15,13 @@
 #include "../OpenRCT2.h"
 #include "../actions/SetCheatAction.hpp"
 #include "../audio/audio.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/Imaging.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Localisation.h"
+#include "../paint/Paint.h"
 #include "../platform/Platform2.h"
 #include "../util/Util.h"
 #include "../world/Climate.h"
@@ -28,12 +30,18 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -41,20 +49,94 @@ using namespace OpenRCT2::Drawing;
 
 uint8_t gScreenshotCountdown = 0;
 
-static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo* dpi, const GamePalette& palette)
+// Number of rows giant screenshots are rendered and encoded in at a time
+static constexpr int32_t GiantScreenshotBandHeight = 256;
+
+// Number of rows a screenshot is split into for multithreaded encoding, small enough to give every core a band
+static constexpr uint32_t ScreenshotEncodeBandHeight = 64;
+
+// Write of the last in-game screenshot, the next one waits for it so that both do not pick the same free path
+static std::future<void> _pendingScreenshotWrite;
+
+static Image CreateImageFromDpi(const rct_drawpixelinfo* dpi, const GamePalette& palette)
 {
     auto const pixels8 = dpi->bits;
     auto const pixelsLen = (dpi->width + dpi->pitch) * dpi->height;
+
+    Image image;
+    image.Width = dpi->width;
+    image.Height = dpi->height;
+    image.Depth = 8;
+    image.Stride = dpi->width + dpi->pitch;
+    image.Palette = std::make_unique<GamePalette>(palette);
+    image.Pixels = std::vector<uint8_t>(pixels8, pixels8 + pixelsLen);
+    return image;
+}
+
+static void WaitForPendingScreenshotWrite()
+{
+    if (_pendingScreenshotWrite.valid())
+    {
+        try
+        {
+            _pendingScreenshotWrite.get();
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Unable to write png: %s", e.what());
+        }
+    }
+}
+
+void screenshot_wait_for_pending_write()
+{
+    WaitForPendingScreenshotWrite();
+}
+
+/**
+ * Encodes an image as a PNG. When multithreaded, paletted images are deflated in bands on the job pool instead of in
+ * one go by libpng, the file differs but decodes to the same pixels.
+ */
+static void WriteScreenshotImage(const std::string& path, const Image& image, int32_t compressionLevel, bool multithreaded)
+{
+    if (multithreaded && image.Depth == 8)
+    {
+        Imaging::PngBandWriter writer(path, image.Width, image.Height, *image.Palette, compressionLevel);
+        for (uint32_t top = 0; top < image.Height; top += ScreenshotEncodeBandHeight)
+        {
+            auto rows = std::min(image.Height - top, ScreenshotEncodeBandHeight);
+            writer.WriteBand(image.Pixels.data() + static_cast<size_t>(top) * image.Stride, image.Stride, rows);
+        }
+        writer.Finish();
+    }
+    else
+    {
+        Imaging::WriteToFile(path, image, IMAGE_FORMAT::PNG, compressionLevel);
+    }
+}
+
+/**
+ * Encodes and writes the image on a background thread so the game does not stall on it, the write is tracked as the
+ * pending screenshot write.
+ */
+static void WriteScreenshotImageAsync(const std::string& path, Image image)
+{
+    WaitForPendingScreenshotWrite();
+    _pendingScreenshotWrite = std::async(
+        std::launch::async,
+        [path, image = std::move(image), compressionLevel = gConfigGeneral.screenshot_compression_level,
+         multithreaded = gConfigGeneral.screenshot_multithreaded_encoding]() {
+            WriteScreenshotImage(path, image, compressionLevel, multithreaded);
+        });
+}
+
+static bool WriteDpiToFile(const std::string& path, const rct_drawpixelinfo* dpi, const GamePalette& palette)
+{
     try
     {
-        Image image;
-        image.Width = dpi->width;
-        image.Height = dpi->height;
-        image.Depth = 8;
-        image.Stride = dpi->width + dpi->pitch;
-        image.Palette = std::make_unique<GamePalette>(palette);
-        image.Pixels = std::vector<uint8_t>(pixels8, pixels8 + pixelsLen);
-        Imaging::WriteToFile(path, image, IMAGE_FORMAT::PNG);
+        auto image = CreateImageFromDpi(dpi, palette);
+        WriteScreenshotImage(
+            path, image, gConfigGeneral.screenshot_compression_level, gConfigGeneral.screenshot_multithreaded_encoding);
         return true;
     }
     catch (const std::exception& e)
@@ -157,6 +239,8 @@ static std::optional<std::string> screenshot_get_next_path()
 
 std::string screenshot_dump_png(rct_drawpixelinfo* dpi)
 {
+    WaitForPendingScreenshotWrite();
+
     // Get a free screenshot path
     auto path = screenshot_get_next_path();
 
@@ -165,18 +249,23 @@ std::string screenshot_dump_png(rct_drawpixelinfo* dpi)
         return "";
     }
 
-    if (WriteDpiToFile(path->c_str(), dpi, gPalette))
+    // Only the copy of the pixels is made here, the game carries on while the image is encoded and written
+    try
     {
+        WriteScreenshotImageAsync(*path, CreateImageFromDpi(dpi, gPalette));
         return *path;
     }
-    else
+    catch (const std::exception& e)
     {
+        log_error("Unable to write png: %s", e.what());
         return "";
     }
 }
 
 std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void* pixels)
 {
+    WaitForPendingScreenshotWrite();
+
     auto path = screenshot_get_next_path();
 
     if (path == std::nullopt)
@@ -195,7 +284,7 @@ std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void*
         image.Depth = 32;
         image.Stride = width * 4;
         image.Pixels = std::vector<uint8_t>(pixels8, pixels8 + pixelsLen);
-        Imaging::WriteToFile(path->c_str(), image, IMAGE_FORMAT::PNG_32);
+        WriteScreenshotImageAsync(*path, std::move(image));
         return *path;
     }
     catch (const std::exception& e)
@@ -275,30 +364,27 @@ static CoordsXY GetEdgeTile(int32_t mapSize, int32_t rotation, EdgeType edgeType
     }
 }
 
-static int32_t GetHighestBaseClearanceZ(const CoordsXY& location)
+static int32_t GetTallestVisibleTileTop(int32_t mapSize, int32_t rotation)
 {
-    int32_t z = 0;
-    auto element = map_get_first_element_at(location);
-    if (element != nullptr)
-    {
-        do
+    // Highest base or clearance of every tile in one pass over the elements, tiles without elements stay at 0
+    std::vector<int32_t> tileTops(MAX_TILE_TILE_ELEMENT_POINTERS);
+    map_for_each_tile_in_rows(1, mapSize - 1, [&tileTops](const TileElementSpan& span) {
+        int32_t z = 0;
+        for (const auto& element : span)
         {
-            z = std::max<int32_t>(z, element->GetBaseZ());
-            z = std::max<int32_t>(z, element->GetClearanceZ());
-        } while (!(element++)->IsLastForTile());
-    }
-    return z;
-}
+            z = std::max<int32_t>(z, element.GetBaseZ());
+            z = std::max<int32_t>(z, element.GetClearanceZ());
+        }
+        tileTops[span.Tile.x + span.Tile.y * MAXIMUM_MAP_SIZE_TECHNICAL] = z;
+    });
 
-static int32_t GetTallestVisibleTileTop(int32_t mapSize, int32_t rotation)
-{
     int32_t minViewY = 0;
     for (int32_t y = 1; y < mapSize - 1; y++)
     {
         for (int32_t x = 1; x < mapSize - 1; x++)
         {
             auto location = TileCoordsXY(x, y).ToCoordsXY();
-            int32_t z = GetHighestBaseClearanceZ(location);
+            int32_t z = tileTops[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
             int32_t viewY = translate_3d_to_2d_with_z(rotation, CoordsXYZ(location, z)).y;
             minViewY = std::min(minViewY, viewY);
         }
@@ -377,9 +463,47 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& vi
     viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
 }
 
+/**
+ * Renders the viewport a band of rows at a time and streams the bands to the PNG encoder, so that giant screenshots of
+ * big parks only ever hold a few bands in memory.
+ */
+static void RenderViewportToPng(const rct_viewport& viewport, const std::string_view& path)
+{
+    Imaging::PngBandWriter writer(
+        path, viewport.width, viewport.height, gPalette, gConfigGeneral.screenshot_compression_level);
+
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+    rct_viewport band = viewport;
+    band.height = std::min<int16_t>(viewport.height, GiantScreenshotBandHeight);
+    auto dpi = CreateDPI(band);
+    try
+    {
+        for (int32_t top = 0; top < viewport.height; top += band.height)
+        {
+            band.height = std::min<int32_t>(viewport.height - top, GiantScreenshotBandHeight);
+            band.view_height = band.height * viewport.zoom;
+            band.viewPos.y = viewport.viewPos.y + top * viewport.zoom;
+            dpi.height = band.height;
+            if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+            {
+                std::memset(dpi.bits, PALETTE_INDEX_0, static_cast<size_t>(dpi.width) * dpi.height);
+            }
+
+            RenderViewport(&drawingEngine, band, dpi);
+            writer.WriteBand(dpi.bits, dpi.width + dpi.pitch, dpi.height);
+        }
+        writer.Finish();
+    }
+    catch (const std::exception&)
+    {
+        ReleaseDPI(dpi);
+        throw;
+    }
+    ReleaseDPI(dpi);
+}
+
 void screenshot_giant()
 {
-    rct_drawpixelinfo dpi{};
     try
     {
         auto path = screenshot_get_next_path();
@@ -408,10 +532,7 @@ void screenshot_giant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path->c_str(), &dpi, gPalette);
+        RenderViewportToPng(viewport, *path);
 
         // Show user that screenshot saved successfully
         Formatter ft;
@@ -424,8 +545,6 @@ void screenshot_giant()
         log_error("%s", e.what());
         context_show_error(STR_SCREENSHOT_FAILED, STR_NONE, {});
     }
-
-    ReleaseDPI(dpi);
 }
 
 // TODO: Move this at some point into a more appropriate place.
@@ -437,6 +556,33 @@ template<typename FN> static inline double MeasureFunctionTime(const FN& fn)
     return std::chrono::duration<double>(endTime - startTime).count();
 }
 
+/**
+ * Renders the viewport with and without height culling and counts the pixels that differ, which should always be none.
+ */
+static size_t benchgfx_count_culling_differences(const rct_viewport& viewport, rct_drawpixelinfo& dpi)
+{
+    const size_t size = static_cast<size_t>(dpi.width) * dpi.height;
+    const bool culling = gPaintHeightCulling;
+
+    gPaintHeightCulling = false;
+    std::memset(dpi.bits, PALETTE_INDEX_0, size);
+    RenderViewport(nullptr, viewport, dpi);
+    std::vector<uint8_t> reference(dpi.bits, dpi.bits + size);
+
+    gPaintHeightCulling = true;
+    std::memset(dpi.bits, PALETTE_INDEX_0, size);
+    RenderViewport(nullptr, viewport, dpi);
+    gPaintHeightCulling = culling;
+
+    size_t differences = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (dpi.bits[i] != reference[i])
+            differences++;
+    }
+    return differences;
+}
+
 static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount)
 {
     if (!context->LoadParkFromFile(inputPath))
@@ -468,6 +614,12 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
 
     try
     {
+        size_t cullingDifferences = 0;
+        for (size_t i = 0; i < dpis.size(); i++)
+        {
+            cullingDifferences += benchgfx_count_culling_differences(viewports[i], dpis[i]);
+        }
+
         double totalTime = 0.0;
 
         std::array<double, MAX_ZOOM_LEVEL> zoomAverages;
@@ -506,6 +658,7 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
         }
         std::printf("Total average: %.06fs, %.f FPS\n", average, 1.0 / average);
         std::printf("Time: %.05fs\n", totalTime);
+        std::printf("Height culling: %s, %zu pixels differ\n", gPaintHeightCulling ? "on" : "off", cullingDifferences);
     }
     catch (const std::exception& e)
     {
@@ -602,6 +755,105 @@ static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewpor
     }
 }
 
+static bool IsScreenshotArgCountValid(const char** argv, int32_t argc, bool* giantScreenshot)
+{
+    *giantScreenshot = (argc == 5) && _stricmp(argv[2], "giant") == 0;
+    return argc == 4 || argc == 8 || *giantScreenshot;
+}
+
+/**
+ * Sets up the viewport and rotation described by the screenshot arguments for the loaded park. The arguments start
+ * with the park and output paths.
+ */
+static rct_viewport GetScreenshotViewport(const char** argv, int32_t argc, bool giantScreenshot)
+{
+    rct_viewport viewport{};
+    if (giantScreenshot)
+    {
+        auto zoom = std::atoi(argv[3]);
+        auto rotation = std::atoi(argv[4]) & 3;
+        viewport = GetGiantViewport(gMapSize, rotation, zoom);
+        gCurrentRotation = rotation;
+        return viewport;
+    }
+
+    bool customLocation = false;
+    bool centreMapX = false;
+    bool centreMapY = false;
+    int32_t resolutionWidth = std::atoi(argv[2]);
+    int32_t resolutionHeight = std::atoi(argv[3]);
+    int32_t customX = 0;
+    int32_t customY = 0;
+    int32_t customZoom = 0;
+    int32_t customRotation = 0;
+    if (argc == 8)
+    {
+        customLocation = true;
+        if (argv[4][0] == 'c')
+            centreMapX = true;
+        else
+            customX = std::atoi(argv[4]);
+
+        if (argv[5][0] == 'c')
+            centreMapY = true;
+        else
+            customY = std::atoi(argv[5]);
+
+        customZoom = std::atoi(argv[6]);
+        customRotation = std::atoi(argv[7]) & 3;
+    }
+
+    int32_t mapSize = gMapSize;
+    if (resolutionWidth == 0 || resolutionHeight == 0)
+    {
+        resolutionWidth = (mapSize * 32 * 2) >> customZoom;
+        resolutionHeight = (mapSize * 32 * 1) >> customZoom;
+
+        resolutionWidth += 8;
+        resolutionHeight += 128;
+    }
+
+    viewport.width = resolutionWidth;
+    viewport.height = resolutionHeight;
+    viewport.view_width = viewport.width;
+    viewport.view_height = viewport.height;
+    if (customLocation)
+    {
+        if (centreMapX)
+            customX = (mapSize / 2) * 32 + 16;
+        if (centreMapY)
+            customY = (mapSize / 2) * 32 + 16;
+
+        int32_t z = tile_element_height({ customX, customY });
+        CoordsXYZ coords3d = { customX, customY, z };
+
+        auto coords2d = translate_3d_to_2d_with_z(customRotation, coords3d);
+
+        viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
+                             coords2d.y - ((viewport.view_height << customZoom) / 2) };
+        viewport.zoom = customZoom;
+        gCurrentRotation = customRotation;
+    }
+    else
+    {
+        viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
+        viewport.zoom = gSavedViewZoom;
+        gCurrentRotation = gSavedViewRotation;
+    }
+    return viewport;
+}
+
+static void LoadScreenshotPark(IContext& context, const char* inputPath)
+{
+    if (!context.LoadParkFromFile(inputPath))
+    {
+        throw std::runtime_error("Failed to load park.");
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+}
+
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
 {
     // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
@@ -615,11 +867,12 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
         }
     }
 
-    bool giantScreenshot = (argc == 5) && _stricmp(argv[2], "giant") == 0;
-    if (argc != 4 && argc != 8 && !giantScreenshot)
+    bool giantScreenshot;
+    if (!IsScreenshotArgCountValid(argv, argc, &giantScreenshot))
     {
         std::printf("Usage: openrct2 screenshot <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
         std::printf("Usage: openrct2 screenshot <file> <output_image> giant <zoom> <rotation>\n");
+        std::printf("Usage: openrct2 screenshot serve [<jobs_file>]\n");
         return -1;
     }
 
@@ -628,9 +881,6 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
     try
     {
         core_init();
-        bool customLocation = false;
-        bool centreMapX = false;
-        bool centreMapY = false;
 
         const char* inputPath = argv[0];
         const char* outputPath = argv[1];
@@ -644,99 +894,206 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 
         drawing_engine_init();
 
-        if (!context->LoadParkFromFile(inputPath))
+        LoadScreenshotPark(*context, inputPath);
+
+        auto viewport = GetScreenshotViewport(argv, argc, giantScreenshot);
+        ApplyOptions(options, viewport);
+
+        if (giantScreenshot)
+        {
+            RenderViewportToPng(viewport, outputPath);
+        }
+        else
         {
-            throw std::runtime_error("Failed to load park.");
+            dpi = CreateDPI(viewport);
+
+            RenderViewport(nullptr, viewport, dpi);
+            WriteDpiToFile(outputPath, &dpi, gPalette);
         }
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        exitCode = -1;
+    }
+    ReleaseDPI(dpi);
 
-        gIntroState = IntroState::None;
-        gScreenFlags = SCREEN_FLAGS_PLAYING;
+    drawing_engine_dispose();
 
-        rct_viewport viewport{};
-        if (giantScreenshot)
+    return exitCode;
+}
+
+/**
+ * Splits a screenshot job line into its arguments. Arguments are separated by whitespace, double quotes allow paths
+ * with spaces.
+ */
+static std::vector<std::string> SplitScreenshotJob(const std::string& line)
+{
+    std::vector<std::string> args;
+    size_t i = 0;
+    while (i < line.size())
+    {
+        if (std::isspace(static_cast<unsigned char>(line[i])))
         {
-            auto zoom = std::atoi(argv[3]);
-            auto rotation = std::atoi(argv[4]) & 3;
-            viewport = GetGiantViewport(gMapSize, rotation, zoom);
-            gCurrentRotation = rotation;
+            i++;
+            continue;
+        }
+
+        std::string arg;
+        if (line[i] == '"')
+        {
+            auto closingQuote = line.find('"', i + 1);
+            if (closingQuote == std::string::npos)
+            {
+                throw std::runtime_error("Unterminated quote.");
+            }
+            arg = line.substr(i + 1, closingQuote - i - 1);
+            i = closingQuote + 1;
         }
         else
         {
-            int32_t resolutionWidth = std::atoi(argv[2]);
-            int32_t resolutionHeight = std::atoi(argv[3]);
-            int32_t customX = 0;
-            int32_t customY = 0;
-            int32_t customZoom = 0;
-            int32_t customRotation = 0;
-            if (argc == 8)
+            auto start = i;
+            while (i < line.size() && !std::isspace(static_cast<unsigned char>(line[i])))
             {
-                customLocation = true;
-                if (argv[4][0] == 'c')
-                    centreMapX = true;
-                else
-                    customX = std::atoi(argv[4]);
-
-                if (argv[5][0] == 'c')
-                    centreMapY = true;
-                else
-                    customY = std::atoi(argv[5]);
-
-                customZoom = std::atoi(argv[6]);
-                customRotation = std::atoi(argv[7]) & 3;
+                i++;
             }
+            arg = line.substr(start, i - start);
+        }
+        args.push_back(std::move(arg));
+    }
+    return args;
+}
 
-            int32_t mapSize = gMapSize;
-            if (resolutionWidth == 0 || resolutionHeight == 0)
-            {
-                resolutionWidth = (mapSize * 32 * 2) >> customZoom;
-                resolutionHeight = (mapSize * 32 * 1) >> customZoom;
+/**
+ * Renders screenshot jobs read from a file, or from standard input as they arrive, in one process. Each line holds the
+ * arguments of a single screenshot command. Objects and g1 are only loaded once and the park is only reloaded when
+ * the next job is for a different park. PNGs are encoded and written while the next job renders.
+ */
+int32_t cmdline_for_screenshot_serve(const char* jobsPath, ScreenshotOptions* options)
+{
+    std::ifstream jobsFile;
+    std::istream* jobs = &std::cin;
+    if (jobsPath != nullptr && std::strcmp(jobsPath, "-") != 0)
+    {
+        jobsFile.open(fs::u8path(jobsPath));
+        if (!jobsFile.is_open())
+        {
+            std::printf("Unable to open %s\n", jobsPath);
+            return -1;
+        }
+        jobs = &jobsFile;
+    }
 
-                resolutionWidth += 8;
-                resolutionHeight += 128;
-            }
+    core_init();
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        std::printf("Failed to initialize context.\n");
+        return -1;
+    }
 
-            viewport.width = resolutionWidth;
-            viewport.height = resolutionHeight;
-            viewport.view_width = viewport.width;
-            viewport.view_height = viewport.height;
-            if (customLocation)
-            {
-                if (centreMapX)
-                    customX = (mapSize / 2) * 32 + 16;
-                if (centreMapY)
-                    customY = (mapSize / 2) * 32 + 16;
+    drawing_engine_init();
+
+    int32_t exitCode = 1;
+    std::string loadedPark;
+    std::future<void> pendingWrite;
+    std::string pendingOutputPath;
+    auto finishPendingWrite = [&]() {
+        if (!pendingWrite.valid())
+            return;
+        try
+        {
+            pendingWrite.get();
+            std::printf("ok %s\n", pendingOutputPath.c_str());
+        }
+        catch (const std::exception& e)
+        {
+            std::printf("error %s: %s\n", pendingOutputPath.c_str(), e.what());
+            exitCode = -1;
+        }
+        std::fflush(stdout);
+    };
+
+    std::string line;
+    while (std::getline(*jobs, line))
+    {
+        std::vector<std::string> args;
+        try
+        {
+            args = SplitScreenshotJob(line);
+        }
+        catch (const std::exception& e)
+        {
+            std::printf("error %s: %s\n", line.c_str(), e.what());
+            exitCode = -1;
+            continue;
+        }
+        if (args.empty() || args[0][0] == '#')
+            continue;
 
-                int32_t z = tile_element_height({ customX, customY });
-                CoordsXYZ coords3d = { customX, customY, z };
+        std::vector<const char*> argv;
+        for (const auto& arg : args)
+        {
+            argv.push_back(arg.c_str());
+        }
+        const auto argc = static_cast<int32_t>(argv.size());
 
-                auto coords2d = translate_3d_to_2d_with_z(customRotation, coords3d);
+        bool giantScreenshot;
+        if (!IsScreenshotArgCountValid(argv.data(), argc, &giantScreenshot))
+        {
+            std::printf(
+                "error %s: expected <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n", line.c_str());
+            exitCode = -1;
+            continue;
+        }
 
-                viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
-                                     coords2d.y - ((viewport.view_height << customZoom) / 2) };
-                viewport.zoom = customZoom;
-                gCurrentRotation = customRotation;
+        const std::string outputPath = args[1];
+        rct_drawpixelinfo dpi;
+        try
+        {
+            if (args[0] != loadedPark)
+            {
+                loadedPark.clear();
+                LoadScreenshotPark(*context, args[0].c_str());
+                loadedPark = args[0];
+            }
+
+            auto viewport = GetScreenshotViewport(argv.data(), argc, giantScreenshot);
+            ApplyOptions(options, viewport);
+
+            if (giantScreenshot)
+            {
+                RenderViewportToPng(viewport, outputPath);
+                std::printf("ok %s\n", outputPath.c_str());
             }
             else
             {
-                viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
-                viewport.zoom = gSavedViewZoom;
-                gCurrentRotation = gSavedViewRotation;
+                dpi = CreateDPI(viewport);
+                RenderViewport(nullptr, viewport, dpi);
+                auto image = CreateImageFromDpi(&dpi, gPalette);
+                ReleaseDPI(dpi);
+
+                // Keep one image in flight, so a large batch does not queue up every encoded image in memory
+                finishPendingWrite();
+                pendingOutputPath = outputPath;
+                pendingWrite = std::async(
+                    std::launch::async,
+                    [outputPath, image = std::move(image), compressionLevel = gConfigGeneral.screenshot_compression_level,
+                     multithreaded = gConfigGeneral.screenshot_multithreaded_encoding]() {
+                        WriteScreenshotImage(outputPath, image, compressionLevel, multithreaded);
+                    });
             }
         }
-
-        ApplyOptions(options, viewport);
-
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, &dpi, gPalette);
-    }
-    catch (const std::exception& e)
-    {
-        std::printf("%s\n", e.what());
-        exitCode = -1;
+        catch (const std::exception& e)
+        {
+            ReleaseDPI(dpi);
+            std::printf("error %s: %s\n", outputPath.c_str(), e.what());
+            exitCode = -1;
+        }
+        std::fflush(stdout);
     }
-    ReleaseDPI(dpi);
+    finishPendingWrite();
 
     drawing_engine_dispose();
 
@@ -820,10 +1177,18 @@ void CaptureImage(const CaptureOptions& options)
     gCurrentRotation = options.Rotation;
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, &dpi, gPalette);
-    ReleaseDPI(dpi);
+    if (options.View)
+    {
+        auto dpi = CreateDPI(viewport);
+        RenderViewport(nullptr, viewport, dpi);
+        auto image = CreateImageFromDpi(&dpi, gPalette);
+        ReleaseDPI(dpi);
+        WriteScreenshotImageAsync(outputPath, std::move(image));
+    }
+    else
+    {
+        RenderViewportToPng(viewport, outputPath);
+    }
 
     gCurrentRotation = backupRotation;
 }
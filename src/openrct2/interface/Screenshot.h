@@ -54,9 +54,11 @@ void screenshot_check();
 std::string screenshot_dump();
 std::string screenshot_dump_png(rct_drawpixelinfo* dpi);
 std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void* pixels);
+void screenshot_wait_for_pending_write();
 
 void screenshot_giant();
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
+int32_t cmdline_for_screenshot_serve(const char* jobsPath, ScreenshotOptions* options);
 int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
 
 void CaptureImage(const CaptureOptions& options);
@@ -10,9 +10,11 @@
 #include "Viewport.h"
 
 #include "../Context.h"
+#include "../FrameProfiler.h"
 #include "../Game.h"
 #include "../Input.h"
 #include "../OpenRCT2.h"
+#include "../Tracing.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/JobPool.h"
@@ -32,7 +34,12 @@
 #include "Window_internal.h"
 
 #include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cmath>
 #include <cstring>
+#include <limits>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 
@@ -44,8 +51,6 @@ uint8_t gShowConstuctionRightsRefCount;
 rct_viewport g_viewport_list[MAX_VIEWPORT_COUNT];
 rct_viewport* g_music_tracking_viewport;
 
-static std::unique_ptr<JobPool> _paintJobs;
-
 ScreenCoordsXY gSavedView;
 ZoomLevel gSavedViewZoom;
 uint8_t gSavedViewRotation;
@@ -791,7 +796,7 @@ void viewport_update_smart_vehicle_follow(rct_window* window)
  */
 void viewport_render(
     rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom,
-    std::vector<paint_session>* sessions)
+    std::vector<RecordedPaintSession>* sessions)
 {
     if (right <= viewport->pos.x)
         return;
@@ -832,32 +837,65 @@ void viewport_render(
 #endif
 }
 
-static void record_session(const paint_session* session, std::vector<paint_session>* recorded_sessions, size_t record_index)
+static void record_session(
+    const paint_session* session, std::vector<RecordedPaintSession>* recorded_sessions, size_t record_index)
 {
     // Perform a deep copy of the paint session, use relative offsets.
     // This is done to extract the session for benchmark.
     // Place the copied session at provided record_index, so the caller can decide which columns/paint sessions to copy; there
     // is no column information embedded in the session itself.
-    (*recorded_sessions)[record_index] = (*session);
-    paint_session* session_copy = &recorded_sessions->at(record_index);
-
-    // Mind the offset needs to be calculated against the original `session`, not `session_copy`
-    for (auto& ps : session_copy->PaintStructs)
+    auto& record = recorded_sessions->at(record_index);
+    record.Session = *session;
+    record.Session.EntryPool = nullptr;
+    record.Session.PaintEntryChunks = nullptr;
+    record.Session.EndOfPaintStructArray = nullptr;
+    record.Session.NextFreePaintStruct = nullptr;
+
+    // The chunk list is newest first, flatten it oldest first.
+    std::vector<const PaintEntryPool::Chunk*> chunks;
+    for (auto chunk = session->PaintEntryChunks; chunk != nullptr; chunk = chunk->Next)
+    {
+        chunks.insert(chunks.begin(), chunk);
+    }
+    record.Entries.clear();
+    for (auto chunk : chunks)
+    {
+        const paint_entry* end = chunk == session->PaintEntryChunks ? session->NextFreePaintStruct
+                                                                     : std::end(chunk->Entries);
+        record.Entries.insert(record.Entries.end(), chunk->Entries, end);
+    }
+
+    // Mind the offset needs to be calculated against the original chunks, not the copied entries.
+    const size_t nullIndex = record.Entries.size();
+    auto getIndex = [&chunks, nullIndex](const paint_struct* ps) {
+        if (ps == nullptr)
+            return nullIndex;
+        const auto* entry = reinterpret_cast<const paint_entry*>(ps);
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            if (entry >= chunks[i]->Entries && entry < std::end(chunks[i]->Entries))
+            {
+                return i * PaintEntryPool::EntriesPerChunk + (entry - chunks[i]->Entries);
+            }
+        }
+        return nullIndex;
+    };
+    for (auto& ps : record.Entries)
     {
-        ps.basic.next_quadrant_ps = reinterpret_cast<paint_struct*>(
-            ps.basic.next_quadrant_ps ? int(ps.basic.next_quadrant_ps - &session->PaintStructs[0].basic)
-                                      : std::size(session->PaintStructs));
+        ps.basic.next_quadrant_ps = reinterpret_cast<paint_struct*>(getIndex(ps.basic.next_quadrant_ps));
     }
-    for (auto& quad : session_copy->Quadrants)
+    for (auto& quad : record.Session.Quadrants)
     {
-        quad = reinterpret_cast<paint_struct*>(
-            quad ? int(quad - &session->PaintStructs[0].basic) : std::size(session->Quadrants));
+        quad = reinterpret_cast<paint_struct*>(getIndex(quad));
     }
 }
 
-static void viewport_fill_column(paint_session* session, std::vector<paint_session>* recorded_sessions, size_t record_index)
+static void viewport_fill_column(
+    paint_session* session, std::vector<RecordedPaintSession>* recorded_sessions, size_t record_index, double* generateTime)
 {
+    auto startTime = std::chrono::high_resolution_clock::now();
     PaintSessionGenerate(session);
+    *generateTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
     if (recorded_sessions != nullptr)
     {
         record_session(session, recorded_sessions, record_index);
@@ -865,7 +903,7 @@ static void viewport_fill_column(paint_session* session, std::vector<paint_sessi
     PaintSessionArrange(session);
 }
 
-static void viewport_paint_column(paint_session* session)
+static void viewport_paint_column(paint_session* session, bool release)
 {
     if (session->ViewFlags
             & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE
@@ -893,7 +931,209 @@ static void viewport_paint_column(paint_session* session)
         PaintDrawMoneyStructs(&session->DPI, session->PSStringHead);
     }
 
-    PaintSessionFree(session);
+    if (release)
+    {
+        PaintSessionFree(session);
+    }
+}
+
+/**
+ * Returns the part of the drawing area between the given view coordinates, the drawing area is not grown if it is
+ * smaller.
+ */
+static rct_drawpixelinfo viewport_crop_dpi(rct_drawpixelinfo dpi, int16_t left, int16_t right, int16_t top, int16_t bottom)
+{
+    const int32_t stride = (dpi.width / dpi.zoom_level) + dpi.pitch;
+    if (left >= dpi.x)
+    {
+        int16_t leftPitch = left - dpi.x;
+        dpi.width -= leftPitch;
+        dpi.bits += leftPitch / dpi.zoom_level;
+        dpi.pitch += leftPitch / dpi.zoom_level;
+        dpi.x = left;
+    }
+
+    int16_t paintRight = dpi.x + dpi.width;
+    if (paintRight >= right)
+    {
+        int16_t rightPitch = paintRight - right;
+        paintRight -= rightPitch;
+        dpi.pitch += rightPitch / dpi.zoom_level;
+    }
+    dpi.width = paintRight - dpi.x;
+
+    if (top > dpi.y)
+    {
+        int32_t rows = (top - dpi.y) / dpi.zoom_level;
+        dpi.bits += rows * stride;
+        dpi.remY = std::max(0, dpi.remY - rows);
+        dpi.height -= top - dpi.y;
+        dpi.y = top;
+    }
+    if (dpi.y + dpi.height > bottom)
+    {
+        dpi.height = bottom - dpi.y;
+    }
+    return dpi;
+}
+
+struct PaintColumn
+{
+    int16_t X;
+    int16_t Width;
+    double PredictedCost;
+    double Time;
+    double GenerateTime;
+    paint_session* Session;
+};
+
+// Time spent per pixel row on each 32 pixel column, keyed by viewport and column position.
+// Smoothed over the last few frames so that the splitting of columns does not flicker between frames.
+static std::unordered_map<uint64_t, double> _paintColumnCosts;
+static constexpr size_t PaintColumnCostsMaxEntries = 1 << 14;
+static ViewportPaintStats _paintStats;
+static ViewportPaintStats _lastPaintStats;
+static uint32_t _paintStatsDrawCount;
+
+// Arranged paint sessions of a 32 pixel column of the view, between the top and bottom view coordinates
+struct SharedPaintSession
+{
+    int16_t X;
+    int16_t Top;
+    int16_t Bottom;
+    ZoomLevel Zoom;
+    uint8_t Rotation;
+    uint32_t ViewFlags;
+    paint_session* Session;
+};
+
+// Sessions painted for the viewports of windows this frame. The world does not change while a frame is drawn, so
+// other viewports showing the same part of the world draw these again instead of generating their own.
+static std::vector<SharedPaintSession> _sharedPaintSessions;
+static uint32_t _sharedPaintSessionsDrawCount;
+
+/**
+ * Sessions are only shared between the viewports of windows, screenshots and track design previews paint through
+ * temporary viewports. With a single viewport there is nothing to share with, so nothing is kept.
+ */
+static bool viewport_shares_sessions(const rct_viewport* viewport)
+{
+    int32_t viewportCount = 0;
+    bool isWindowViewport = false;
+    for (const auto& vp : g_viewport_list)
+    {
+        if (vp.width != 0)
+        {
+            viewportCount++;
+            isWindowViewport |= &vp == viewport;
+        }
+    }
+    return isWindowViewport && viewportCount > 1;
+}
+
+static void viewport_release_shared_sessions()
+{
+    for (const auto& shared : _sharedPaintSessions)
+    {
+        PaintSessionFree(shared.Session);
+    }
+    _sharedPaintSessions.clear();
+}
+
+/**
+ * Returns the shared sessions of a column overlapping the given rows, ordered by their top. Must be called with the
+ * shared sessions locked.
+ */
+static std::vector<SharedPaintSession> viewport_find_shared_sessions(
+    int16_t x, ZoomLevel zoom, uint32_t viewFlags, int16_t top, int16_t bottom)
+{
+    std::vector<SharedPaintSession> result;
+    const auto rotation = get_current_rotation();
+    for (const auto& shared : _sharedPaintSessions)
+    {
+        if (shared.X == x && shared.Zoom == zoom && shared.Rotation == rotation && shared.ViewFlags == viewFlags
+            && shared.Top < bottom && shared.Bottom > top)
+        {
+            result.push_back(shared);
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const SharedPaintSession& a, const SharedPaintSession& b) {
+        return a.Top < b.Top;
+    });
+    return result;
+}
+
+static uint64_t viewport_get_column_key(const rct_viewport* viewport, int16_t x)
+{
+    // Screenshots and previews paint through temporary viewports, these only pollute the map until it is cleared
+    auto viewportId = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(viewport));
+    return (viewportId << 16) ^ static_cast<uint16_t>(x);
+}
+
+static double viewport_get_column_cost(const rct_viewport* viewport, int16_t x)
+{
+    auto it = _paintColumnCosts.find(viewport_get_column_key(viewport, x));
+    return it != _paintColumnCosts.end() ? it->second : 0;
+}
+
+static double viewport_get_average_column_cost(const rct_viewport* viewport, int16_t left, int16_t right)
+{
+    double total = 0;
+    int32_t count = 0;
+    for (int16_t x = left; x < right; x += 32)
+    {
+        total += viewport_get_column_cost(viewport, x);
+        count++;
+    }
+    return count > 0 ? total / count : 0;
+}
+
+static void viewport_record_column_costs(
+    const rct_viewport* viewport, const std::vector<PaintColumn>& columns, int32_t height)
+{
+    if (height <= 0)
+        return;
+
+    if (_paintColumnCosts.size() >= PaintColumnCostsMaxEntries)
+    {
+        _paintColumnCosts.clear();
+    }
+
+    // Parts of a split column are summed back up into their column
+    std::unordered_map<int16_t, double> columnTimes;
+    for (const auto& column : columns)
+    {
+        columnTimes[column.X] += column.Time;
+    }
+    for (const auto& [x, time] : columnTimes)
+    {
+        auto& cost = _paintColumnCosts[viewport_get_column_key(viewport, x)];
+        auto costPerRow = time / height;
+        cost = cost == 0 ? costPerRow : (cost * 3 + costPerRow) / 4;
+    }
+}
+
+static void viewport_update_paint_stats_frame()
+{
+    if (_paintStatsDrawCount != gCurrentDrawCount)
+    {
+        _paintStatsDrawCount = gCurrentDrawCount;
+        _lastPaintStats = _paintStats;
+        _paintStats = {};
+    }
+}
+
+double ViewportPaintStats::GetBalance() const
+{
+    if (WallTime <= 0 || Threads == 0)
+        return 1;
+    return std::min(1.0, TotalTime / (WallTime * Threads));
+}
+
+const ViewportPaintStats& viewport_get_paint_stats()
+{
+    viewport_update_paint_stats_frame();
+    return _lastPaintStats;
 }
 
 /**
@@ -908,7 +1148,7 @@ static void viewport_paint_column(paint_session* session)
  */
 void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
-    std::vector<paint_session>* recorded_sessions)
+    std::vector<RecordedPaintSession>* recorded_sessions)
 {
     uint32_t viewFlags = viewport->flags;
     uint16_t width = right - left;
@@ -946,20 +1186,9 @@ void viewport_paint(
     const int16_t rightBorder = dpi1.x + dpi1.width;
     const int16_t alignedX = floor2(dpi1.x, 32);
 
-    std::vector<paint_session*> columns;
-
     bool useMultithreading = gConfigGeneral.multithreading;
-    if (useMultithreading && _paintJobs == nullptr)
-    {
-        _paintJobs = std::make_unique<JobPool>();
-    }
-    else if (useMultithreading == false && _paintJobs != nullptr)
-    {
-        _paintJobs.reset();
-    }
 
     // Create space to record sessions and keep track which index is being drawn
-    size_t index = 0;
     if (recorded_sessions != nullptr)
     {
         const uint16_t columnSize = rightBorder - alignedX;
@@ -967,51 +1196,334 @@ void viewport_paint(
         recorded_sessions->resize(columnCount);
     }
 
-    // Splits the area into 32 pixel columns and renders them
-    for (x = alignedX; x < rightBorder; x += 32, index++)
+    // Splits the area into 32 pixel columns. Columns that were expensive in previous frames are split further so
+    // that a single dense column does not hold up the other threads. Recorded sessions are always whole columns.
+    // Shared sessions are whole columns too, so that they line up between viewports.
+    const bool shareSessions = recorded_sessions == nullptr && viewport_shares_sessions(viewport);
+    const bool splitColumns = useMultithreading && recorded_sessions == nullptr && !shareSessions;
+    viewport_update_paint_stats_frame();
+    const double averageCost = viewport_get_average_column_cost(viewport, alignedX, rightBorder);
+    std::vector<PaintColumn> columns;
+    std::vector<SharedPaintSession> reusedSessions;
+
+    auto addColumn = [&](int16_t columnX, int16_t partX, int16_t partWidth, double cost, int16_t colTop,
+                         int16_t colBottom) {
+        auto& column = columns.emplace_back();
+        column.X = columnX;
+        column.Width = partWidth;
+        column.PredictedCost = cost;
+        auto columnDpi = viewport_crop_dpi(dpi1, partX, partX + partWidth, colTop, colBottom);
+        column.Session = PaintSessionAlloc(&columnDpi, viewFlags);
+    };
+
+    if (shareSessions)
+    {
+        if (_sharedPaintSessionsDrawCount != gCurrentDrawCount)
+        {
+            _sharedPaintSessionsDrawCount = gCurrentDrawCount;
+            viewport_release_shared_sessions();
+        }
+    }
+
+    const int16_t areaBottom = dpi1.y + dpi1.height;
+    for (x = alignedX; x < rightBorder; x += 32)
     {
-        paint_session* session = PaintSessionAlloc(&dpi1, viewFlags);
-        columns.push_back(session);
+        const double cost = viewport_get_column_cost(viewport, x);
+        if (shareSessions)
+        {
+            // Rows of the column another viewport has painted this frame are drawn from its sessions, only the gaps
+            // between them are generated
+            int16_t rowTop = dpi1.y;
+            for (const auto& shared : viewport_find_shared_sessions(x, viewport->zoom, viewFlags, dpi1.y, areaBottom))
+            {
+                if (shared.Bottom <= rowTop)
+                    continue;
+                if (shared.Top > rowTop)
+                {
+                    addColumn(x, x, 32, cost, rowTop, shared.Top);
+                }
+                auto& reused = reusedSessions.emplace_back(shared);
+                reused.Top = std::max(rowTop, shared.Top);
+                reused.Bottom = std::min(areaBottom, shared.Bottom);
+                rowTop = reused.Bottom;
+                _paintStats.SharedColumns++;
+            }
+            if (rowTop < areaBottom)
+            {
+                addColumn(x, x, 32, cost, rowTop, areaBottom);
+            }
+            continue;
+        }
+
+        int16_t numParts = 1;
+        if (splitColumns && averageCost > 0)
+        {
+            if (cost > averageCost * 4)
+                numParts = 4;
+            else if (cost > averageCost * 2)
+                numParts = 2;
+        }
+        if (numParts > 1)
+        {
+            _paintStats.SplitColumns++;
+        }
 
-        rct_drawpixelinfo& dpi2 = session->DPI;
-        if (x >= dpi2.x)
+        const int16_t partWidth = 32 / numParts;
+        for (int16_t part = 0; part < numParts; part++)
         {
-            int16_t leftPitch = x - dpi2.x;
-            dpi2.width -= leftPitch;
-            dpi2.bits += leftPitch / dpi2.zoom_level;
-            dpi2.pitch += leftPitch / dpi2.zoom_level;
-            dpi2.x = x;
+            const int16_t partX = x + part * partWidth;
+            if (partX >= rightBorder)
+                break;
+
+            addColumn(x, partX, partWidth, cost / numParts, dpi1.y, areaBottom);
         }
+    }
+
+    auto fillColumn = [recorded_sessions, alignedX](PaintColumn& column) {
+        Tracing::ScopedSpan traceSpan("paint", "column");
+        auto startTime = std::chrono::high_resolution_clock::now();
+        viewport_fill_column(column.Session, recorded_sessions, (column.X - alignedX) / 32, &column.GenerateTime);
+        column.Time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+    };
 
-        int16_t paintRight = dpi2.x + dpi2.width;
-        if (paintRight >= x + 32)
+    auto startTime = std::chrono::high_resolution_clock::now();
+    if (useMultithreading)
+    {
+        // Queue the most expensive columns first so the cheap ones fill in the gaps at the end
+        std::vector<PaintColumn*> queueOrder;
+        for (auto& column : columns)
         {
-            int16_t rightPitch = paintRight - x - 32;
-            paintRight -= rightPitch;
-            dpi2.pitch += rightPitch / dpi2.zoom_level;
+            queueOrder.push_back(&column);
         }
-        dpi2.width = paintRight - dpi2.x;
+        std::stable_sort(queueOrder.begin(), queueOrder.end(), [](const PaintColumn* a, const PaintColumn* b) {
+            return a->PredictedCost > b->PredictedCost;
+        });
 
-        if (useMultithreading)
+        JobPool paintJobs;
+        for (auto column : queueOrder)
         {
-            _paintJobs->AddTask(
-                [session, recorded_sessions, index]() -> void { viewport_fill_column(session, recorded_sessions, index); });
+            paintJobs.AddTask([column, &fillColumn]() { fillColumn(*column); });
         }
-        else
+        paintJobs.Join();
+    }
+    else
+    {
+        for (auto& column : columns)
         {
-            viewport_fill_column(session, recorded_sessions, index);
+            fillColumn(column);
         }
     }
+    auto wallTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
 
-    if (useMultithreading)
+    viewport_record_column_costs(viewport, columns, height);
+    _paintStats.Columns += static_cast<uint32_t>(columns.size());
+    _paintStats.WallTime += wallTime;
+    _paintStats.Threads = useMultithreading ? static_cast<uint32_t>(JobPool::GetConcurrency()) : 1;
+    for (const auto& column : columns)
     {
-        _paintJobs->Join();
+        _paintStats.TotalTime += column.Time;
+        _paintStats.LongestTime = std::max(_paintStats.LongestTime, column.Time);
+        _paintStats.GenerateTime += column.GenerateTime;
+        _paintStats.ArrangeTime += column.Time - column.GenerateTime;
     }
 
+    // The generated sessions become shared before drawing, drawing does not change them
+    if (shareSessions)
+    {
+        for (const auto& column : columns)
+        {
+            auto& shared = _sharedPaintSessions.emplace_back();
+            shared.X = column.X;
+            shared.Top = column.Session->DPI.y;
+            shared.Bottom = column.Session->DPI.y + column.Session->DPI.height;
+            shared.Zoom = viewport->zoom;
+            shared.Rotation = get_current_rotation();
+            shared.ViewFlags = viewFlags;
+            shared.Session = column.Session;
+        }
+    }
+
+    startTime = std::chrono::high_resolution_clock::now();
     for (auto&& column : columns)
     {
-        viewport_paint_column(column);
+        viewport_paint_column(column.Session, !shareSessions);
+    }
+    for (const auto& reused : reusedSessions)
+    {
+        // Paint structs are in view coordinates, so the session only needs to be pointed at this drawing area
+        paint_session session = *reused.Session;
+        session.DPI = viewport_crop_dpi(dpi1, reused.X, reused.X + 32, reused.Top, reused.Bottom);
+        viewport_paint_column(&session, false);
+    }
+    auto drawTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+    _paintStats.DrawTime += drawTime;
+
+    FrameProfiler::AddTime(FrameProfiler::Stage::ViewportSessions, wallTime);
+    FrameProfiler::AddTime(FrameProfiler::Stage::ViewportDraw, drawTime);
+}
+
+// Scrolling of a viewport as seen over the last frames, to predict which part of the map comes into view next
+struct ViewportPrefetchState
+{
+    bool Valid;
+    uint8_t Rotation;
+    ZoomLevel LastZoom;
+    ScreenCoordsXY LastViewPos;
+    float VelocityX;
+    float VelocityY;
+    ZoomLevel PrefetchZoom;
+    ScreenCoordsXY PrefetchViewPos;
+};
+
+static ViewportPrefetchState _viewportPrefetchStates[MAX_VIEWPORT_COUNT];
+
+// How many frames ahead, at the current scroll speed, images outside the view are prefetched
+static constexpr int32_t ViewportPrefetchFrames = 8;
+
+// Scrolling slower than this many screen pixels per frame does not prefetch anything
+static constexpr float ViewportPrefetchMinSpeed = 2.0f;
+
+static void viewport_collect_paint_struct_images(const paint_struct* ps, std::vector<uint32_t>& images)
+{
+    // Same walk as PaintDrawStruct, attached structs are only drawn for the last child
+    for (; ps != nullptr; ps = ps->children)
+    {
+        images.push_back(ps->image_id & 0x7FFFF);
+        if (ps->children != nullptr)
+            continue;
+
+        for (auto attached = ps->attached_ps; attached != nullptr; attached = attached->next)
+        {
+            images.push_back(attached->image_id & 0x7FFFF);
+            if (attached->flags & PAINT_STRUCT_FLAG_IS_MASKED)
+            {
+                images.push_back(attached->colour_image_id & 0x7FFFF);
+            }
+        }
+    }
+}
+
+static void viewport_collect_rect_images(
+    const rct_viewport* viewport, ZoomLevel zoom, const ScreenRect& rect, std::vector<uint32_t>& images)
+{
+    if (rect.GetWidth() <= 0 || rect.GetHeight() <= 0)
+        return;
+
+    // Align to whole screen pixels of the zoom level, like viewport_paint does
+    const int32_t zoomMask = ~(std::max(1, 1 * zoom) - 1);
+
+    rct_drawpixelinfo dpi;
+    dpi.x = rect.GetLeft() & zoomMask;
+    dpi.y = rect.GetTop() & zoomMask;
+    dpi.width = std::min(rect.GetRight() - dpi.x, static_cast<int32_t>(std::numeric_limits<int16_t>::max()));
+    dpi.height = std::min(rect.GetBottom() - dpi.y, static_cast<int32_t>(std::numeric_limits<int16_t>::max()));
+    dpi.zoom_level = zoom;
+
+    paint_session* session = PaintSessionAlloc(&dpi, viewport->flags);
+    PaintSessionGenerate(session);
+    PaintSessionArrange(session);
+    for (const paint_struct* ps = session->PaintHead.next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+    {
+        viewport_collect_paint_struct_images(ps, images);
+    }
+    PaintSessionFree(session);
+}
+
+/**
+ * Adds the images painted in the parts of the predicted view that are outside the current view.
+ */
+static void viewport_collect_uncovered_images(
+    const rct_viewport* viewport, ZoomLevel zoom, const ScreenRect& predicted, const ScreenRect& current,
+    std::vector<uint32_t>& images)
+{
+    const int32_t middleTop = std::max(predicted.GetTop(), current.GetTop());
+    const int32_t middleBottom = std::min(predicted.GetBottom(), current.GetBottom());
+    if (middleTop >= middleBottom || predicted.GetLeft() >= current.GetRight() || predicted.GetRight() <= current.GetLeft())
+    {
+        // No overlap at all, the whole predicted view is new
+        viewport_collect_rect_images(viewport, zoom, predicted, images);
+        return;
     }
+
+    const int32_t left = predicted.GetLeft();
+    const int32_t right = predicted.GetRight();
+    viewport_collect_rect_images(viewport, zoom, { left, predicted.GetTop(), right, middleTop }, images);
+    viewport_collect_rect_images(viewport, zoom, { left, middleBottom, right, predicted.GetBottom() }, images);
+    viewport_collect_rect_images(viewport, zoom, { left, middleTop, current.GetLeft(), middleBottom }, images);
+    viewport_collect_rect_images(viewport, zoom, { current.GetRight(), middleTop, right, middleBottom }, images);
+}
+
+/**
+ * Predicts the part of the map a scrolling or zooming viewport is about to show and collects the images painted
+ * there, so drawing engines that cache images can load them before they are drawn. Returns the zoom level the
+ * images will be drawn at.
+ */
+ZoomLevel viewport_get_prefetch_images(const rct_viewport* viewport, std::vector<uint32_t>& images)
+{
+    if (viewport < std::begin(g_viewport_list) || viewport >= std::end(g_viewport_list) || viewport->width == 0)
+        return viewport->zoom;
+
+    auto& state = _viewportPrefetchStates[viewport - g_viewport_list];
+    const uint8_t rotation = get_current_rotation();
+    if (!state.Valid || state.Rotation != rotation)
+    {
+        state = {};
+        state.Valid = true;
+        state.Rotation = rotation;
+        state.LastZoom = viewport->zoom;
+        state.LastViewPos = viewport->viewPos;
+        state.PrefetchZoom = viewport->zoom;
+        state.PrefetchViewPos = viewport->viewPos;
+        return viewport->zoom;
+    }
+
+    const ScreenRect current{ viewport->viewPos.x, viewport->viewPos.y, viewport->viewPos.x + viewport->view_width,
+                              viewport->viewPos.y + viewport->view_height };
+
+    if (viewport->zoom != state.LastZoom)
+    {
+        // Zooming out keeps going the same way more often than not, prefetch the ring the next zoom level adds
+        const bool zoomingOut = viewport->zoom > state.LastZoom;
+        state.LastZoom = viewport->zoom;
+        state.LastViewPos = viewport->viewPos;
+        state.VelocityX = 0;
+        state.VelocityY = 0;
+        state.PrefetchZoom = viewport->zoom;
+        state.PrefetchViewPos = viewport->viewPos;
+        if (!zoomingOut || viewport->zoom >= ZoomLevel::max())
+            return viewport->zoom;
+
+        const ZoomLevel nextZoom = viewport->zoom + 1;
+        const int32_t halfWidth = viewport->view_width / 2;
+        const int32_t halfHeight = viewport->view_height / 2;
+        const ScreenRect predicted{ current.GetLeft() - halfWidth, current.GetTop() - halfHeight,
+                                    current.GetRight() + halfWidth, current.GetBottom() + halfHeight };
+        viewport_collect_uncovered_images(viewport, nextZoom, predicted, current, images);
+        return nextZoom;
+    }
+
+    const auto delta = viewport->viewPos - state.LastViewPos;
+    state.LastViewPos = viewport->viewPos;
+    state.VelocityX = (state.VelocityX + delta.x) / 2;
+    state.VelocityY = (state.VelocityY + delta.y) / 2;
+
+    const float minSpeed = ViewportPrefetchMinSpeed * std::max(1, 1 * viewport->zoom);
+    if (std::abs(state.VelocityX) < minSpeed && std::abs(state.VelocityY) < minSpeed)
+        return viewport->zoom;
+
+    // Each prefetch covers the given number of frames of scrolling, only look ahead again after half of that
+    const auto lookAheadX = static_cast<int32_t>(state.VelocityX * ViewportPrefetchFrames);
+    const auto lookAheadY = static_cast<int32_t>(state.VelocityY * ViewportPrefetchFrames);
+    const auto moved = viewport->viewPos - state.PrefetchViewPos;
+    if (std::abs(moved.x) * 2 < std::abs(lookAheadX) && std::abs(moved.y) * 2 < std::abs(lookAheadY))
+        return viewport->zoom;
+
+    state.PrefetchViewPos = viewport->viewPos;
+    const ScreenRect predicted{ current.GetLeft() + lookAheadX, current.GetTop() + lookAheadY,
+                                current.GetRight() + lookAheadX, current.GetBottom() + lookAheadY };
+    viewport_collect_uncovered_images(viewport, viewport->zoom, predicted, current, images);
+    return viewport->zoom;
 }
 
 static void viewport_paint_weather_gloom(rct_drawpixelinfo* dpi)
@@ -1097,6 +1609,96 @@ CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z)
     return ret.Rotate(inverseRotation);
 }
 
+// Entities are drawn up to this far around their position, and can be as high up as the highest tile element
+static constexpr int32_t EntityViewMargin = 128;
+static constexpr int32_t EntityViewMaxHeight = MAX_ELEMENT_HEIGHT * COORDS_Z_STEP;
+
+static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> _visibleTileMarks;
+
+static bool viewport_add_visible_tiles(const rct_viewport* viewport, size_t maxTiles, std::vector<TileCoordsXY>& tiles)
+{
+    const int32_t left = viewport->viewPos.x - EntityViewMargin;
+    const int32_t right = viewport->viewPos.x + viewport->view_width + EntityViewMargin;
+    const int32_t top = viewport->viewPos.y - EntityViewMargin;
+    const int32_t bottom = viewport->viewPos.y + viewport->view_height + EntityViewMaxHeight + EntityViewMargin;
+
+    // Bounds of the view on the map, a view at the bottom of the map can see entities high up further down the map
+    int32_t minX = std::numeric_limits<int32_t>::max();
+    int32_t minY = std::numeric_limits<int32_t>::max();
+    int32_t maxX = std::numeric_limits<int32_t>::min();
+    int32_t maxY = std::numeric_limits<int32_t>::min();
+    for (const auto& corner : { ScreenCoordsXY{ left, top }, ScreenCoordsXY{ right, top }, ScreenCoordsXY{ left, bottom },
+                                ScreenCoordsXY{ right, bottom } })
+    {
+        auto mapPos = viewport_coord_to_map_coord(corner, 0);
+        minX = std::min(minX, mapPos.x);
+        minY = std::min(minY, mapPos.y);
+        maxX = std::max(maxX, mapPos.x);
+        maxY = std::max(maxY, mapPos.y);
+    }
+    const int32_t tileLeft = std::clamp(minX / COORDS_XY_STEP, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    const int32_t tileTop = std::clamp(minY / COORDS_XY_STEP, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    const int32_t tileRight = std::clamp(maxX / COORDS_XY_STEP, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    const int32_t tileBottom = std::clamp(maxY / COORDS_XY_STEP, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    if (static_cast<size_t>(tileRight - tileLeft + 1) * (tileBottom - tileTop + 1) > maxTiles)
+        return false;
+
+    // The view is a diamond on the map, only keep the tiles of the bounds that are inside it
+    const auto rotation = get_current_rotation();
+    for (int32_t y = tileTop; y <= tileBottom; y++)
+    {
+        for (int32_t x = tileLeft; x <= tileRight; x++)
+        {
+            auto screenPos = translate_3d_to_2d_with_z(
+                rotation, { x * COORDS_XY_STEP + COORDS_XY_HALF_TILE, y * COORDS_XY_STEP + COORDS_XY_HALF_TILE, 0 });
+            if (screenPos.x + 32 < left || screenPos.x - 32 > right || screenPos.y + 16 < top || screenPos.y - 16 > bottom)
+                continue;
+
+            const auto index = static_cast<size_t>(x + y * MAXIMUM_MAP_SIZE_TECHNICAL);
+            if (!_visibleTileMarks[index])
+            {
+                _visibleTileMarks[index] = true;
+                tiles.push_back({ x, y });
+            }
+        }
+    }
+    return true;
+}
+
+static void viewport_clear_visible_tile_marks(const std::vector<TileCoordsXY>& tiles)
+{
+    for (const auto& tile : tiles)
+    {
+        _visibleTileMarks[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL] = false;
+    }
+}
+
+bool viewport_get_visible_tiles(const rct_viewport* viewport, size_t maxTiles, std::vector<TileCoordsXY>& tiles)
+{
+    tiles.clear();
+    bool result = viewport_add_visible_tiles(viewport, maxTiles, tiles);
+    viewport_clear_visible_tile_marks(tiles);
+    return result;
+}
+
+bool viewports_get_visible_tiles(size_t maxTiles, std::vector<TileCoordsXY>& tiles)
+{
+    tiles.clear();
+    bool result = true;
+    for (const auto& viewport : g_viewport_list)
+    {
+        if (viewport.width == 0)
+            continue;
+        if (tiles.size() > maxTiles || !viewport_add_visible_tiles(&viewport, maxTiles - tiles.size(), tiles))
+        {
+            result = false;
+            break;
+        }
+    }
+    viewport_clear_visible_tile_marks(tiles);
+    return result;
+}
+
 /**
  *
  *  rct2: 0x00664689
@@ -1275,26 +1877,29 @@ void viewport_set_visibility(uint8_t mode)
 /**
  * Checks if a paint_struct sprite type is in the filter mask.
  */
-static bool PSSpriteTypeIsInFilter(paint_struct* ps, uint16_t filter)
+// Number of bits of the interaction filter, see PSSpriteTypeFilterBit
+static constexpr int32_t InteractionFilterBits = VIEWPORT_INTERACTION_ITEM_BANNER - 2;
+
+/**
+ * Returns the bit of the interaction filter that excludes the paint struct, or -1 when it can never be interacted with.
+ */
+static int32_t PSSpriteTypeFilterBit(const paint_struct* ps)
 {
     if (ps->sprite_type == VIEWPORT_INTERACTION_ITEM_NONE
         || ps->sprite_type == 11 // 11 as a type seems to not exist, maybe part of the typo mentioned later on.
         || ps->sprite_type > VIEWPORT_INTERACTION_ITEM_BANNER)
-        return false;
+        return -1;
 
-    uint16_t mask;
     if (ps->sprite_type == VIEWPORT_INTERACTION_ITEM_BANNER)
         // I think CS made a typo here. Let's replicate the original behaviour.
-        mask = 1 << (ps->sprite_type - 3);
-    else
-        mask = 1 << (ps->sprite_type - 1);
-
-    if (filter & mask)
-    {
-        return false;
-    }
+        return ps->sprite_type - 3;
+    return ps->sprite_type - 1;
+}
 
-    return true;
+static bool PSSpriteTypeIsInFilter(paint_struct* ps, uint16_t filter)
+{
+    auto bit = PSSpriteTypeFilterBit(ps);
+    return bit != -1 && !(filter & (1 << bit));
 }
 
 /**
@@ -1669,18 +2274,120 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
             viewLoc.x &= (0xFFFF * myviewport->zoom) & 0xFFFF;
             viewLoc.y &= (0xFFFF * myviewport->zoom) & 0xFFFF;
         }
+        info = viewport_pick(viewLoc, myviewport->zoom, myviewport->flags, flags & 0xFFFF);
+    }
+    return info;
+}
+
+/**
+ * Hit tests of a point are answered from a small cache of points that have been painted before, so that the tooltip,
+ * tool and cursor queries of the same mouse position only paint it once. Each entry keeps the topmost hit for every
+ * filter bit, which is enough to answer a query with any filter from a single paint. Entries are stale once anything
+ * is invalidated, the game ticks, the view rotates or the tile elements move.
+ */
+struct ViewportPickEntry
+{
+    bool Valid;
+    ScreenCoordsXY ViewCoords;
+    ZoomLevel Zoom;
+    uint32_t ViewFlags;
+    uint8_t Rotation;
+    uint32_t Ticks;
+    uint32_t Revision;
+    const TileElement* TileElements;
+    // Topmost hit of each filter bit and its position in the paint order, 0 when nothing of that type was hit
+    InteractionInfo Hits[InteractionFilterBits];
+    uint32_t Order[InteractionFilterBits];
+};
+
+static constexpr size_t ViewportPickBufferSize = 64;
+static ViewportPickEntry _viewportPickBuffer[ViewportPickBufferSize];
+static uint32_t _viewportPickRevision;
+
+static void viewport_pick_fill(paint_session* session, ViewportPickEntry& entry)
+{
+    // Same walk as set_interaction_info_from_paint_session, the last hit in paint order is the topmost
+    rct_drawpixelinfo* dpi = &session->DPI;
+    uint32_t order = 0;
+    auto record = [&entry, &order](const paint_struct* ps) {
+        auto bit = PSSpriteTypeFilterBit(ps);
+        if (bit != -1)
+        {
+            entry.Hits[bit] = { ps };
+            entry.Order[bit] = ++order;
+        }
+    };
+
+    std::fill(std::begin(entry.Order), std::end(entry.Order), 0);
+    paint_struct* ps = &session->PaintHead;
+    while ((ps = ps->next_quadrant_ps) != nullptr)
+    {
+        paint_struct* old_ps = ps;
+        paint_struct* next_ps = ps;
+        while (next_ps != nullptr)
+        {
+            ps = next_ps;
+            if (is_sprite_interacted_with(dpi, ps->image_id, { ps->x, ps->y }))
+            {
+                record(ps);
+            }
+            next_ps = ps->children;
+        }
+
+        for (attached_paint_struct* attached_ps = ps->attached_ps; attached_ps != nullptr; attached_ps = attached_ps->next)
+        {
+            if (is_sprite_interacted_with(dpi, attached_ps->image_id, { (attached_ps->x + ps->x), (attached_ps->y + ps->y) }))
+            {
+                record(ps);
+            }
+        }
+
+        ps = old_ps;
+    }
+}
+
+InteractionInfo viewport_pick(const ScreenCoordsXY& viewCoords, ZoomLevel zoom, uint32_t viewFlags, uint16_t filter)
+{
+    auto hash = (static_cast<uint32_t>(viewCoords.x) * 73856093u) ^ (static_cast<uint32_t>(viewCoords.y) * 19349663u);
+    auto& entry = _viewportPickBuffer[hash % ViewportPickBufferSize];
+    const auto rotation = get_current_rotation();
+    const TileElement* tileElements = gTileElements.data();
+    if (!entry.Valid || entry.ViewCoords != viewCoords || entry.Zoom != zoom || entry.ViewFlags != viewFlags
+        || entry.Rotation != rotation || entry.Ticks != gCurrentTicks || entry.Revision != _viewportPickRevision
+        || entry.TileElements != tileElements)
+    {
         rct_drawpixelinfo dpi;
-        dpi.x = viewLoc.x;
-        dpi.y = viewLoc.y;
+        dpi.x = viewCoords.x;
+        dpi.y = viewCoords.y;
         dpi.height = 1;
-        dpi.zoom_level = myviewport->zoom;
+        dpi.zoom_level = zoom;
         dpi.width = 1;
 
-        paint_session* session = PaintSessionAlloc(&dpi, myviewport->flags);
+        paint_session* session = PaintSessionAlloc(&dpi, viewFlags);
         PaintSessionGenerate(session);
         PaintSessionArrange(session);
-        info = set_interaction_info_from_paint_session(session, flags & 0xFFFF);
+        viewport_pick_fill(session, entry);
         PaintSessionFree(session);
+
+        entry.Valid = true;
+        entry.ViewCoords = viewCoords;
+        entry.Zoom = zoom;
+        entry.ViewFlags = viewFlags;
+        entry.Rotation = rotation;
+        entry.Ticks = gCurrentTicks;
+        entry.Revision = _viewportPickRevision;
+        entry.TileElements = tileElements;
+    }
+
+    InteractionInfo info{};
+    uint32_t topOrder = 0;
+    for (int32_t bit = 0; bit < InteractionFilterBits; bit++)
+    {
+        if (!(filter & (1 << bit)) && entry.Order[bit] > topOrder)
+        {
+            info = entry.Hits[bit];
+            topOrder = entry.Order[bit];
+        }
     }
     return info;
 }
@@ -1690,6 +2397,8 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
  */
 void viewport_invalidate(rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom)
 {
+    _viewportPickRevision++;
+
     // if unknown viewport visibility, use the containing window to discover the status
     if (viewport->visibility == VisibilityCache::Unknown)
     {
@@ -1736,6 +2445,138 @@ void viewport_invalidate(rct_viewport* viewport, int32_t left, int32_t top, int3
     }
 }
 
+// Invalidations of the world are collected on a grid in 2D map coordinates at zoom 0 and only projected onto the
+// viewports once per frame, so the many overlapping invalidations of moving sprites turn into a few rectangles. Each
+// cell stores the furthest zoom level it has to be redrawn at plus one, 0 for clean cells or 0xFF for all zoom levels.
+static constexpr int32_t InvalidationCellShiftX = 6;
+static constexpr int32_t InvalidationCellShiftY = 5;
+static constexpr int32_t InvalidationGridLeft = -(MAXIMUM_MAP_SIZE_BIG + 256);
+static constexpr int32_t InvalidationGridTop = -(2080 + 512);
+static constexpr int32_t InvalidationGridColumns = (2 * (MAXIMUM_MAP_SIZE_BIG + 256)) >> InvalidationCellShiftX;
+static constexpr int32_t InvalidationGridRows = (MAXIMUM_MAP_SIZE_BIG + 256 - InvalidationGridTop) >> InvalidationCellShiftY;
+static constexpr uint8_t InvalidationAllZoomLevels = 0xFF;
+
+static uint8_t _invalidationGrid[InvalidationGridRows][InvalidationGridColumns];
+// Dirty columns of each row and the dirty rows, empty when begin >= end.
+static int16_t _invalidationRowBegin[InvalidationGridRows];
+static int16_t _invalidationRowEnd[InvalidationGridRows];
+static int32_t _invalidationRowsBegin;
+static int32_t _invalidationRowsEnd;
+
+static void viewports_invalidate_now(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom)
+{
+    for (int32_t i = 0; i < MAX_VIEWPORT_COUNT; i++)
+    {
+        rct_viewport* viewport = &g_viewport_list[i];
+        if (viewport->width != 0 && (maxZoom == -1 || viewport->zoom <= maxZoom))
+        {
+            viewport_invalidate(viewport, left, top, right, bottom);
+        }
+    }
+}
+
+void viewports_invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom)
+{
+    // Anything that changes what is drawn changes what is picked
+    _viewportPickRevision++;
+
+    if (gOpenRCT2Headless || left >= right || top >= bottom)
+        return;
+
+    const int32_t firstColumn = (left - InvalidationGridLeft) >> InvalidationCellShiftX;
+    const int32_t lastColumn = (right - 1 - InvalidationGridLeft) >> InvalidationCellShiftX;
+    const int32_t firstRow = (top - InvalidationGridTop) >> InvalidationCellShiftY;
+    const int32_t lastRow = (bottom - 1 - InvalidationGridTop) >> InvalidationCellShiftY;
+    if (firstColumn < 0 || firstRow < 0 || lastColumn >= InvalidationGridColumns || lastRow >= InvalidationGridRows)
+    {
+        // Too far outside of the map to be collected
+        viewports_invalidate_now(left, top, right, bottom, maxZoom);
+        return;
+    }
+
+    const uint8_t value = maxZoom == -1 ? InvalidationAllZoomLevels : static_cast<uint8_t>(maxZoom + 1);
+    for (int32_t row = firstRow; row <= lastRow; row++)
+    {
+        auto cells = _invalidationGrid[row];
+        for (int32_t column = firstColumn; column <= lastColumn; column++)
+        {
+            cells[column] = std::max(cells[column], value);
+        }
+
+        if (_invalidationRowBegin[row] >= _invalidationRowEnd[row])
+        {
+            _invalidationRowBegin[row] = firstColumn;
+            _invalidationRowEnd[row] = lastColumn + 1;
+        }
+        else
+        {
+            _invalidationRowBegin[row] = std::min<int16_t>(_invalidationRowBegin[row], firstColumn);
+            _invalidationRowEnd[row] = std::max<int16_t>(_invalidationRowEnd[row], lastColumn + 1);
+        }
+    }
+
+    if (_invalidationRowsBegin >= _invalidationRowsEnd)
+    {
+        _invalidationRowsBegin = firstRow;
+        _invalidationRowsEnd = lastRow + 1;
+    }
+    else
+    {
+        _invalidationRowsBegin = std::min(_invalidationRowsBegin, firstRow);
+        _invalidationRowsEnd = std::max(_invalidationRowsEnd, lastRow + 1);
+    }
+}
+
+void viewports_flush_invalidations()
+{
+    for (int32_t row = _invalidationRowsBegin; row < _invalidationRowsEnd; row++)
+    {
+        const int32_t begin = _invalidationRowBegin[row];
+        const int32_t end = _invalidationRowEnd[row];
+        if (begin >= end)
+            continue;
+
+        auto cells = _invalidationGrid[row];
+        const int32_t top = InvalidationGridTop + (row << InvalidationCellShiftY);
+        const int32_t bottom = top + (1 << InvalidationCellShiftY);
+        for (int32_t i = 0; i < MAX_VIEWPORT_COUNT; i++)
+        {
+            rct_viewport* viewport = &g_viewport_list[i];
+            if (viewport->width == 0)
+                continue;
+
+            // Merge runs of neighbouring cells that need redrawing at the zoom level of this viewport
+            auto isDirty = [viewport](uint8_t cell) {
+                return cell == InvalidationAllZoomLevels || (cell != 0 && viewport->zoom <= cell - 1);
+            };
+            int32_t column = begin;
+            while (column < end)
+            {
+                if (!isDirty(cells[column]))
+                {
+                    column++;
+                    continue;
+                }
+
+                const int32_t runBegin = column;
+                while (column < end && isDirty(cells[column]))
+                {
+                    column++;
+                }
+                viewport_invalidate(
+                    viewport, InvalidationGridLeft + (runBegin << InvalidationCellShiftX), top,
+                    InvalidationGridLeft + (column << InvalidationCellShiftX), bottom);
+            }
+        }
+
+        std::fill(cells + begin, cells + end, 0);
+        _invalidationRowBegin[row] = 0;
+        _invalidationRowEnd[row] = 0;
+    }
+    _invalidationRowsBegin = 0;
+    _invalidationRowsEnd = 0;
+}
+
 static rct_viewport* viewport_find_from_point(const ScreenCoordsXY& screenCoords)
 {
     rct_window* w = window_find_from_point(screenCoords);
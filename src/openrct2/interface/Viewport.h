@@ -17,6 +17,7 @@
 #include <vector>
 
 struct paint_session;
+struct RecordedPaintSession;
 struct paint_struct;
 struct rct_drawpixelinfo;
 struct Peep;
@@ -98,6 +99,26 @@ struct InteractionInfo
 
 #define MAX_VIEWPORT_COUNT WINDOW_LIMIT_MAX
 
+/**
+ * How the viewport paint work of a frame was spread across threads.
+ */
+struct ViewportPaintStats
+{
+    uint32_t Columns;       // Number of paint sessions (work units) generated
+    uint32_t SplitColumns;  // 32 pixel columns split into smaller work units because they were expensive before
+    uint32_t SharedColumns; // Parts of columns drawn from the sessions of another viewport instead of generated
+    uint32_t Threads;       // Number of threads available to generate the sessions
+    double TotalTime;       // Time spent generating all sessions added together, in seconds
+    double LongestTime;     // Time spent generating the most expensive session, in seconds
+    double WallTime;        // Time from queuing the first session until all sessions were generated, in seconds
+    double GenerateTime;    // Part of the total time spent generating the paint structs of the sessions, in seconds
+    double ArrangeTime;     // Part of the total time spent sorting the paint structs of the sessions, in seconds
+    double DrawTime;        // Time spent drawing the generated sessions, in seconds
+
+    // 1 if the work was spread perfectly over all threads, lower if threads were left waiting.
+    double GetBalance() const;
+};
+
 /**
  * A reference counter for whether something is forcing the grid lines to show. When the counter
  * is decremented to 0, the grid lines are hidden.
@@ -129,16 +150,20 @@ void viewport_update_smart_staff_follow(rct_window* window, Peep* peep);
 void viewport_update_smart_vehicle_follow(rct_window* window);
 void viewport_render(
     rct_drawpixelinfo* dpi, const rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom,
-    std::vector<paint_session>* sessions = nullptr);
+    std::vector<RecordedPaintSession>* sessions = nullptr);
 void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom,
-    std::vector<paint_session>* sessions = nullptr);
+    std::vector<RecordedPaintSession>* sessions = nullptr);
+ZoomLevel viewport_get_prefetch_images(const rct_viewport* viewport, std::vector<uint32_t>& images);
 
 CoordsXYZ viewport_adjust_for_map_height(const ScreenCoordsXY& startCoords);
 
 CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z);
 std::optional<CoordsXY> screen_pos_to_map_pos(const ScreenCoordsXY& screenCoords, int32_t* direction);
 
+// Returns the paint stats of the last completed frame.
+const ViewportPaintStats& viewport_get_paint_stats();
+
 void show_gridlines();
 void hide_gridlines();
 void show_land_rights();
@@ -147,10 +172,26 @@ void show_construction_rights();
 void hide_construction_rights();
 void viewport_set_visibility(uint8_t mode);
 
+/**
+ * Gets the tiles that entities standing on can be seen in the view of the viewport, a few entities just outside of the
+ * view are included. Meant for going through the entities in view with EntityTileList rather than through every
+ * entity, returns false when more than maxTiles tiles would be needed and going through every entity is cheaper.
+ */
+bool viewport_get_visible_tiles(const rct_viewport* viewport, size_t maxTiles, std::vector<TileCoordsXY>& tiles);
+/**
+ * Same as viewport_get_visible_tiles for the views of all viewports together, each tile is only listed once.
+ */
+bool viewports_get_visible_tiles(size_t maxTiles, std::vector<TileCoordsXY>& tiles);
+
 InteractionInfo get_map_coordinates_from_pos(const ScreenCoordsXY& screenCoords, int32_t flags);
 InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const ScreenCoordsXY& screenCoords, int32_t flags);
 
 InteractionInfo set_interaction_info_from_paint_session(paint_session* session, uint16_t filter);
+/**
+ * Returns the topmost interaction at a point of the view at the given zoom, excluding the types set in the filter.
+ * Points that were picked before are answered without painting them again while nothing has changed.
+ */
+InteractionInfo viewport_pick(const ScreenCoordsXY& viewCoords, ZoomLevel zoom, uint32_t viewFlags, uint16_t filter);
 InteractionInfo ViewportInteractionGetItemLeft(const ScreenCoordsXY& screenCoords);
 bool ViewportInteractionLeftOver(const ScreenCoordsXY& screenCoords);
 bool ViewportInteractionLeftClick(const ScreenCoordsXY& screenCoords);
@@ -162,6 +203,15 @@ CoordsXY ViewportInteractionGetTileStartAtCursor(const ScreenCoordsXY& screenCoo
 void sub_68B2B7(paint_session* session, const CoordsXY& mapCoords);
 
 void viewport_invalidate(rct_viewport* viewport, int32_t left, int32_t top, int32_t right, int32_t bottom);
+/**
+ * Invalidates an area in 2D map coordinates at zoom 0 on all viewports with a zoom level up to maxZoom, or all viewports
+ * if maxZoom is -1. The area is only projected onto the viewports by the next viewports_flush_invalidations call.
+ */
+void viewports_invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom, int32_t maxZoom = -1);
+/**
+ * Passes the areas collected by viewports_invalidate on to the drawing engine, called once per frame before drawing.
+ */
+void viewports_flush_invalidations();
 
 std::optional<CoordsXY> screen_get_map_xy(const ScreenCoordsXY& screenCoords, rct_viewport** viewport);
 std::optional<CoordsXY> screen_get_map_xy_with_z(const ScreenCoordsXY& screenCoords, int16_t z);
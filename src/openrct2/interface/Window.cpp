@@ -33,10 +33,12 @@
 #include "Window_internal.h"
 
 #include <algorithm>
+#include <bitset>
 #include <cmath>
 #include <functional>
 #include <iterator>
 #include <list>
+#include <unordered_set>
 
 std::list<std::shared_ptr<rct_window>> g_window_list;
 rct_window* gWindowAudioExclusive;
@@ -51,6 +53,13 @@ TextInputSession* gTextInput;
 
 uint16_t gWindowUpdateTicks;
 uint16_t gWindowMapFlashingFlags;
+
+// Invalidations requested by class or number are collected here and applied to the matching windows once per frame by
+// window_flush_invalidations, so that the many requests made while the park updates each cost a single window scan.
+static std::bitset<256> _pendingClassInvalidations;
+static std::unordered_set<uint32_t> _pendingNumberInvalidations;
+static std::unordered_set<uint64_t> _pendingWidgetInvalidations;
+static constexpr uint64_t PendingWidgetAnyNumber = 1ULL << 48;
 colour_t gCurrentWindowColours[4];
 
 // converted from uint16_t values at 0x009A41EC - 0x009A4230
@@ -454,22 +463,6 @@ rct_widgetindex window_find_widget_from_point(rct_window* w, const ScreenCoordsX
     return widget_index;
 }
 
-/**
- * Invalidates the specified window.
- *  rct2: 0x006EB13A
- *
- * @param window The window to invalidate (esi).
- */
-template<typename _TPred> static void window_invalidate_by_condition(_TPred pred)
-{
-    window_visit_each([pred](rct_window* w) {
-        if (pred(w))
-        {
-            w->Invalidate();
-        }
-    });
-}
-
 /**
  * Invalidates all windows with the specified window class.
  *  rct2: 0x006EC3AC
@@ -477,7 +470,10 @@ template<typename _TPred> static void window_invalidate_by_condition(_TPred pred
  */
 void window_invalidate_by_class(rct_windowclass cls)
 {
-    window_invalidate_by_condition([cls](rct_window* w) -> bool { return w->classification == cls; });
+    if (gOpenRCT2Headless)
+        return;
+
+    _pendingClassInvalidations[cls] = true;
 }
 
 /**
@@ -486,8 +482,10 @@ void window_invalidate_by_class(rct_windowclass cls)
  */
 void window_invalidate_by_number(rct_windowclass cls, rct_windownumber number)
 {
-    window_invalidate_by_condition(
-        [cls, number](rct_window* w) -> bool { return w->classification == cls && w->number == number; });
+    if (gOpenRCT2Headless || _pendingClassInvalidations[cls])
+        return;
+
+    _pendingNumberInvalidations.insert((static_cast<uint32_t>(cls) << 16) | number);
 }
 
 /**
@@ -537,12 +535,11 @@ template<typename _TPred> static void widget_invalidate_by_condition(_TPred pred
  */
 void widget_invalidate_by_class(rct_windowclass cls, rct_widgetindex widgetIndex)
 {
-    window_visit_each([cls, widgetIndex](rct_window* w) {
-        if (w->classification == cls)
-        {
-            widget_invalidate(w, widgetIndex);
-        }
-    });
+    if (gOpenRCT2Headless || _pendingClassInvalidations[cls])
+        return;
+
+    _pendingWidgetInvalidations.insert(
+        PendingWidgetAnyNumber | (static_cast<uint64_t>(cls) << 32) | static_cast<uint16_t>(widgetIndex));
 }
 
 /**
@@ -551,12 +548,40 @@ void widget_invalidate_by_class(rct_windowclass cls, rct_widgetindex widgetIndex
  */
 void widget_invalidate_by_number(rct_windowclass cls, rct_windownumber number, rct_widgetindex widgetIndex)
 {
-    window_visit_each([cls, number, widgetIndex](rct_window* w) {
-        if (w->classification == cls && w->number == number)
+    if (gOpenRCT2Headless || _pendingClassInvalidations[cls])
+        return;
+
+    _pendingWidgetInvalidations.insert(
+        (static_cast<uint64_t>(cls) << 32) | (static_cast<uint64_t>(number) << 16) | static_cast<uint16_t>(widgetIndex));
+}
+
+void window_flush_invalidations()
+{
+    if (_pendingClassInvalidations.none() && _pendingNumberInvalidations.empty() && _pendingWidgetInvalidations.empty())
+        return;
+
+    window_visit_each([](rct_window* w) {
+        if (_pendingClassInvalidations[w->classification]
+            || _pendingNumberInvalidations.count((static_cast<uint32_t>(w->classification) << 16) | w->number) != 0)
+        {
+            w->Invalidate();
+            return;
+        }
+
+        for (auto key : _pendingWidgetInvalidations)
         {
-            widget_invalidate(w, widgetIndex);
+            auto cls = static_cast<rct_windowclass>(key >> 32);
+            auto number = static_cast<rct_windownumber>(key >> 16);
+            if (cls == w->classification && ((key & PendingWidgetAnyNumber) || number == w->number))
+            {
+                widget_invalidate(w, static_cast<rct_widgetindex>(key & 0xFFFF));
+            }
         }
     });
+
+    _pendingClassInvalidations.reset();
+    _pendingNumberInvalidations.clear();
+    _pendingWidgetInvalidations.clear();
 }
 
 /**
@@ -10,8 +10,12 @@
 #include "LanguagePack.h"
 
 #include "../common.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/Memory.hpp"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
 #include "../core/RTL.h"
 #include "../core/String.hpp"
 #include "../core/StringBuilder.h"
@@ -20,7 +24,9 @@
 #include "Localisation.h"
 
 #include <algorithm>
+#include <limits>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // Don't try to load more than language files that exceed 64 MiB
@@ -34,6 +40,26 @@ constexpr int32_t ObjectOverrideMaxStringCount = 3;
 constexpr rct_string_id ScenarioOverrideBase = 0x7000;
 constexpr int32_t ScenarioOverrideMaxStringCount = 3;
 
+// Language cache format version which when incremented forces a rebuild
+constexpr uint32_t LANGUAGE_CACHE_MAGIC_NUMBER = 0x474E414C; // LANG
+constexpr uint16_t LANGUAGE_CACHE_VERSION = 1;
+constexpr uint32_t LANGUAGE_CACHE_NO_STRING = std::numeric_limits<uint32_t>::max();
+
+/**
+ * The parsed form of a language file. The header is followed by the offset of each string in the string data, the string
+ * data itself and then the object and scenario overrides.
+ */
+struct LanguageCacheHeader
+{
+    uint32_t MagicNumber;
+    uint16_t Version;
+    uint16_t LanguageId;
+    uint64_t SourceLength;
+    uint64_t SourceHash;
+    uint32_t StringCount;
+    uint32_t StringDataLength;
+};
+
 struct ObjectOverride
 {
     char name[8] = { 0 };
@@ -50,7 +76,12 @@ class LanguagePack final : public ILanguagePack
 {
 private:
     uint16_t const _id;
-    std::vector<std::string> _strings;
+    // Every string of the main table null terminated one after another, either parsed into _stringData or mapped from
+    // the language cache. Strings set at runtime are kept apart in _runtimeStrings.
+    std::string _stringData;
+    std::unique_ptr<OpenRCT2::MemoryMappedFile> _cacheFile;
+    std::vector<const utf8*> _strings;
+    std::unordered_map<rct_string_id, std::string> _runtimeStrings;
     std::vector<ObjectOverride> _objectOverrides;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
@@ -60,19 +91,21 @@ private:
     std::string _currentGroup;
     ObjectOverride* _currentObjectOverride = nullptr;
     ScenarioOverride* _currentScenarioOverride = nullptr;
+    std::vector<uint32_t> _stringOffsets;
 
 public:
-    static LanguagePack* FromFile(uint16_t id, const utf8* path)
+    static LanguagePack* FromFile(uint16_t id, const utf8* path, const std::string& cachePath)
     {
         Guard::ArgumentNotNull(path);
 
         // Load file directly into memory
         utf8* fileData = nullptr;
+        size_t fileLength = 0;
         try
         {
             OpenRCT2::FileStream fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
 
-            size_t fileLength = static_cast<size_t>(fs.GetLength());
+            fileLength = static_cast<size_t>(fs.GetLength());
             if (fileLength > MAX_LANGUAGE_SIZE)
             {
                 throw IOException("Language file too large.");
@@ -89,8 +122,21 @@ public:
             return nullptr;
         }
 
-        // Parse the memory as text
-        LanguagePack* result = FromText(id, fileData);
+        // Only parse the text if the cache is out of date
+        auto sourceHash = GetSourceHash(fileData, fileLength);
+        LanguagePack* result = nullptr;
+        if (!cachePath.empty())
+        {
+            result = TryReadCache(id, cachePath, fileLength, sourceHash);
+        }
+        if (result == nullptr)
+        {
+            result = FromText(id, fileData);
+            if (!cachePath.empty())
+            {
+                result->WriteCache(cachePath, fileLength, sourceHash);
+            }
+        }
 
         Memory::Free(fileData);
         return result;
@@ -112,10 +158,13 @@ public:
             ParseLine(&reader);
         }
 
+        SetStrings(_stringData.data(), _stringOffsets);
+
         // Clean up the parsing work data
         _currentGroup = std::string();
         _currentObjectOverride = nullptr;
         _currentScenarioOverride = nullptr;
+        _stringOffsets = {};
     }
 
     uint16_t GetId() const override
@@ -130,17 +179,24 @@ public:
 
     void RemoveString(rct_string_id stringId) override
     {
-        if (_strings.size() >= static_cast<size_t>(stringId))
+        if (_strings.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId] = std::string();
+            _strings[stringId] = nullptr;
+            _runtimeStrings.erase(stringId);
         }
     }
 
     void SetString(rct_string_id stringId, const std::string& str) override
     {
-        if (_strings.size() >= static_cast<size_t>(stringId))
+        if (str.empty())
         {
-            _strings[stringId] = str;
+            RemoveString(stringId);
+        }
+        else if (_strings.size() > static_cast<size_t>(stringId))
+        {
+            auto& runtimeString = _runtimeStrings[stringId];
+            runtimeString = str;
+            _strings[stringId] = runtimeString.c_str();
         }
     }
 
@@ -180,9 +236,9 @@ public:
         }
         else
         {
-            if ((_strings.size() > static_cast<size_t>(stringId)) && !_strings[stringId].empty())
+            if (_strings.size() > static_cast<size_t>(stringId))
             {
-                return _strings[stringId].c_str();
+                return _strings[stringId];
             }
             else
             {
@@ -235,6 +291,166 @@ public:
     }
 
 private:
+    explicit LanguagePack(uint16_t id)
+        : _id(id)
+    {
+    }
+
+    /**
+     * Points each string id at its string within the given string data, empty strings are left as nullptr.
+     */
+    void SetStrings(const utf8* stringData, const std::vector<uint32_t>& offsets)
+    {
+        _strings.resize(offsets.size());
+        for (size_t i = 0; i < offsets.size(); i++)
+        {
+            auto str = offsets[i] == LANGUAGE_CACHE_NO_STRING ? nullptr : stringData + offsets[i];
+            _strings[i] = (str == nullptr || str[0] == '\0') ? nullptr : str;
+        }
+    }
+
+    static uint64_t GetSourceHash(const utf8* data, size_t length)
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < length; i++)
+        {
+            hash = (hash ^ static_cast<uint8_t>(data[i])) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    static LanguagePack* TryReadCache(uint16_t id, const std::string& cachePath, uint64_t sourceLength, uint64_t sourceHash)
+    {
+        if (!File::Exists(cachePath))
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            // The string data is used straight from the mapped cache
+            auto cacheFile = std::make_unique<OpenRCT2::MemoryMappedFile>(cachePath);
+            auto ms = OpenRCT2::MemoryStream(cacheFile->GetData(), cacheFile->GetSize(), OpenRCT2::MEMORY_ACCESS::READ);
+
+            auto header = ms.ReadValue<LanguageCacheHeader>();
+            if (header.MagicNumber != LANGUAGE_CACHE_MAGIC_NUMBER || header.Version != LANGUAGE_CACHE_VERSION
+                || header.LanguageId != id || header.SourceLength != sourceLength || header.SourceHash != sourceHash)
+            {
+                log_verbose("Language cache out of date: %s", cachePath.c_str());
+                return nullptr;
+            }
+
+            std::vector<uint32_t> offsets(header.StringCount);
+            ms.Read(offsets.data(), offsets.size() * sizeof(uint32_t));
+            auto stringData = reinterpret_cast<const utf8*>(cacheFile->GetData() + ms.GetPosition());
+            ms.Seek(header.StringDataLength, OpenRCT2::STREAM_SEEK_CURRENT);
+            if (header.StringDataLength != 0 && stringData[header.StringDataLength - 1] != '\0')
+            {
+                throw IOException("Invalid string data.");
+            }
+            for (auto offset : offsets)
+            {
+                if (offset != LANGUAGE_CACHE_NO_STRING && offset >= header.StringDataLength)
+                {
+                    throw IOException("Invalid string offset.");
+                }
+            }
+
+            auto result = std::unique_ptr<LanguagePack>(new LanguagePack(id));
+            result->SetStrings(stringData, offsets);
+
+            auto numObjectOverrides = ms.ReadValue<uint32_t>();
+            for (uint32_t i = 0; i < numObjectOverrides; i++)
+            {
+                auto& objectOverride = result->_objectOverrides.emplace_back();
+                ms.Read(objectOverride.name, sizeof(objectOverride.name));
+                for (auto& str : objectOverride.strings)
+                {
+                    str = ms.ReadStdString();
+                }
+            }
+
+            auto numScenarioOverrides = ms.ReadValue<uint32_t>();
+            for (uint32_t i = 0; i < numScenarioOverrides; i++)
+            {
+                auto& scenarioOverride = result->_scenarioOverrides.emplace_back();
+                scenarioOverride.filename = ms.ReadStdString();
+                for (auto& str : scenarioOverride.strings)
+                {
+                    str = ms.ReadStdString();
+                }
+            }
+
+            result->_cacheFile = std::move(cacheFile);
+            return result.release();
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("Unable to read language cache %s: %s", cachePath.c_str(), e.what());
+            return nullptr;
+        }
+    }
+
+    void WriteCache(const std::string& cachePath, uint64_t sourceLength, uint64_t sourceHash) const
+    {
+        try
+        {
+            OpenRCT2::MemoryStream ms;
+
+            LanguageCacheHeader header{};
+            header.MagicNumber = LANGUAGE_CACHE_MAGIC_NUMBER;
+            header.Version = LANGUAGE_CACHE_VERSION;
+            header.LanguageId = _id;
+            header.SourceLength = sourceLength;
+            header.SourceHash = sourceHash;
+            header.StringCount = static_cast<uint32_t>(_strings.size());
+            header.StringDataLength = static_cast<uint32_t>(_stringData.size());
+            ms.WriteValue(header);
+
+            for (auto str : _strings)
+            {
+                auto offset = str == nullptr ? LANGUAGE_CACHE_NO_STRING : static_cast<uint32_t>(str - _stringData.data());
+                ms.WriteValue<uint32_t>(offset);
+            }
+            ms.Write(_stringData.data(), _stringData.size());
+
+            ms.WriteValue<uint32_t>(static_cast<uint32_t>(_objectOverrides.size()));
+            for (const auto& objectOverride : _objectOverrides)
+            {
+                ms.Write(objectOverride.name, sizeof(objectOverride.name));
+                for (const auto& str : objectOverride.strings)
+                {
+                    ms.WriteString(str);
+                }
+            }
+
+            ms.WriteValue<uint32_t>(static_cast<uint32_t>(_scenarioOverrides.size()));
+            for (const auto& scenarioOverride : _scenarioOverrides)
+            {
+                ms.WriteString(scenarioOverride.filename);
+                for (const auto& str : scenarioOverride.strings)
+                {
+                    ms.WriteString(str);
+                }
+            }
+
+            // Write to a new file and swap it in, another instance may still have the old cache mapped
+            auto tempPath = cachePath + ".tmp";
+            Path::CreateDirectory(Path::GetDirectory(cachePath));
+            File::WriteAllBytes(tempPath, ms.GetData(), static_cast<size_t>(ms.GetLength()));
+            File::Delete(cachePath);
+            if (!File::Move(tempPath, cachePath))
+            {
+                File::Delete(tempPath);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("Unable to write language cache %s: %s", cachePath.c_str(), e.what());
+        }
+    }
+
     ObjectOverride* GetObjectOverride(const std::string& objectIdentifier)
     {
         for (auto& oo : _objectOverrides)
@@ -581,11 +797,13 @@ private:
         if (_currentGroup.empty())
         {
             // Make sure the list is big enough to contain this string id
-            if (static_cast<size_t>(stringId) >= _strings.size())
+            if (static_cast<size_t>(stringId) >= _stringOffsets.size())
             {
-                _strings.resize(stringId + 1);
+                _stringOffsets.resize(stringId + 1, LANGUAGE_CACHE_NO_STRING);
             }
-            _strings[stringId] = s;
+            _stringOffsets[stringId] = static_cast<uint32_t>(_stringData.size());
+            _stringData.append(s);
+            _stringData.push_back('\0');
         }
         else
         {
@@ -644,9 +862,9 @@ private:
 
 namespace LanguagePackFactory
 {
-    ILanguagePack* FromFile(uint16_t id, const utf8* path)
+    ILanguagePack* FromFile(uint16_t id, const utf8* path, const std::string& cachePath)
     {
-        auto languagePack = LanguagePack::FromFile(id, path);
+        auto languagePack = LanguagePack::FromFile(id, path, cachePath);
         return languagePack;
     }
 
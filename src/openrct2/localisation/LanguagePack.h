@@ -30,6 +30,10 @@ struct ILanguagePack
 
 namespace LanguagePackFactory
 {
-    ILanguagePack* FromFile(uint16_t id, const utf8* path);
+    /**
+     * Loads a language file. If a cache path is given, the parsed strings are cached there and the cache is used as
+     * long as the language file does not change.
+     */
+    ILanguagePack* FromFile(uint16_t id, const utf8* path, const std::string& cachePath = {});
     ILanguagePack* FromText(uint16_t id, const utf8* text);
 } // namespace LanguagePackFactory
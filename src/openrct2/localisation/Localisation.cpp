@@ -30,11 +30,14 @@
 #include "Localisation.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <ctype.h>
 #include <iterator>
 #include <limits.h>
+#include <unordered_map>
+#include <vector>
 
 thread_local char gCommonStringFormatBuffer[512];
 
@@ -1219,6 +1222,122 @@ static void format_string_part_from_raw(utf8** dest, size_t* size, const utf8* s
     }
 }
 
+/**
+ * A language string split into literal runs, which are copied verbatim, and the format codes that consume arguments.
+ */
+struct format_token
+{
+    const utf8* literal;
+    uint32_t length;
+    uint32_t code;
+};
+
+struct format_token_range
+{
+    uint32_t first;
+    uint32_t count;
+};
+
+struct format_token_cache
+{
+    uint32_t generation = 0;
+    std::unordered_map<rct_string_id, format_token_range> ranges;
+    std::vector<format_token> tokens;
+};
+
+static std::atomic<uint32_t> _formatTokenCacheGeneration{ 1 };
+static thread_local format_token_cache _formatTokenCache;
+
+/**
+ * Drops the tokenised language strings, needs to be called whenever a language string is added, removed or replaced.
+ */
+void format_string_cache_invalidate()
+{
+    _formatTokenCacheGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
+static void format_string_tokenise(const utf8* src, std::vector<format_token>& tokens)
+{
+    const utf8* runStart = src;
+    for (;;)
+    {
+        const utf8* ch = src;
+        uint32_t code = utf8_get_next(src, &src);
+        if (code == 0)
+        {
+            if (ch > runStart)
+                tokens.push_back({ runStart, static_cast<uint32_t>(ch - runStart), 0 });
+            break;
+        }
+
+        if (code < ' ')
+        {
+            // Skip the inline arguments, see format_string_part_from_raw
+            if (code <= 4)
+                src += 1;
+            else if (code > 22)
+                src += 4;
+            else if (code > 16)
+                src += 2;
+        }
+        else if (code > 'z' && (code < FORMAT_COLOUR_CODE_START || code == FORMAT_COMMA1DP16))
+        {
+            if (ch > runStart)
+                tokens.push_back({ runStart, static_cast<uint32_t>(ch - runStart), 0 });
+            tokens.push_back({ nullptr, 0, code });
+            runStart = src;
+        }
+    }
+}
+
+static void format_string_part_from_tokens(utf8** dest, size_t* size, rct_string_id format, char** args)
+{
+    format_token_cache& cache = _formatTokenCache;
+    uint32_t generation = _formatTokenCacheGeneration.load(std::memory_order_acquire);
+    if (cache.generation != generation)
+    {
+        cache.ranges.clear();
+        cache.tokens.clear();
+        cache.generation = generation;
+    }
+
+    format_token_range range;
+    auto it = cache.ranges.find(format);
+    if (it != cache.ranges.end())
+    {
+        range = it->second;
+    }
+    else
+    {
+        range.first = static_cast<uint32_t>(cache.tokens.size());
+        format_string_tokenise(language_get_string(format), cache.tokens);
+        range.count = static_cast<uint32_t>(cache.tokens.size()) - range.first;
+        cache.ranges.emplace(format, range);
+    }
+
+    // Nested string ids can append to the token list, so tokens are copied rather than referenced
+    for (uint32_t i = range.first; i < range.first + range.count && *size > 1; i++)
+    {
+        format_token token = cache.tokens[i];
+        if (token.code != 0)
+        {
+            format_string_code(token.code, dest, size, args);
+        }
+        else if (token.length < *size)
+        {
+            std::memcpy(*dest, token.literal, token.length);
+            *dest += token.length;
+            *size -= token.length;
+        }
+        else
+        {
+            // Not enough room for the whole run, let the raw formatter truncate at a character boundary
+            format_string_part_from_raw(dest, size, token.literal, args);
+            return;
+        }
+    }
+}
+
 static void format_string_part(utf8** dest, size_t* size, rct_string_id format, char** args)
 {
     if (format == STR_NONE)
@@ -1231,8 +1350,7 @@ static void format_string_part(utf8** dest, size_t* size, rct_string_id format,
     else if (format < USER_STRING_START)
     {
         // Language string
-        const utf8* rawString = language_get_string(format);
-        format_string_part_from_raw(dest, size, rawString, args);
+        format_string_part_from_tokens(dest, size, format, args);
     }
     else if (format <= USER_STRING_END)
     {
@@ -29,6 +29,7 @@ std::string format_string(rct_string_id format, const void* args);
 void format_string(char* dest, size_t size, rct_string_id format, const void* args);
 void format_string_raw(char* dest, size_t size, const char* src, const void* args);
 void format_string_to_upper(char* dest, size_t size, rct_string_id format, const void* args);
+void format_string_cache_invalidate();
 void generate_string_file();
 
 /**
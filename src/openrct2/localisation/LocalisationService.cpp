@@ -16,6 +16,7 @@
 #include "../object/ObjectManager.h"
 #include "Language.h"
 #include "LanguagePack.h"
+#include "Localisation.h"
 #include "StringIds.h"
 
 #include <stdexcept>
@@ -74,6 +75,13 @@ std::string LocalisationService::GetLanguagePath(uint32_t languageId) const
     return languagePath;
 }
 
+std::string LocalisationService::GetLanguageCachePath(uint32_t languageId) const
+{
+    auto locale = std::string(LanguagesDescriptors[languageId].locale);
+    auto cacheDirectory = _env->GetDirectoryPath(DIRBASE::CACHE);
+    return Path::Combine(cacheDirectory, "language", locale + ".dat");
+}
+
 void LocalisationService::OpenLanguage(int32_t id)
 {
     CloseLanguages();
@@ -87,11 +95,13 @@ void LocalisationService::OpenLanguage(int32_t id)
     {
         filename = GetLanguagePath(LANGUAGE_ENGLISH_UK);
         _languageFallback = std::unique_ptr<ILanguagePack>(
-            LanguagePackFactory::FromFile(LANGUAGE_ENGLISH_UK, filename.c_str()));
+            LanguagePackFactory::FromFile(LANGUAGE_ENGLISH_UK, filename.c_str(), GetLanguageCachePath(LANGUAGE_ENGLISH_UK)));
     }
 
     filename = GetLanguagePath(id);
-    _languageCurrent = std::unique_ptr<ILanguagePack>(LanguagePackFactory::FromFile(id, filename.c_str()));
+    _languageCurrent = std::unique_ptr<ILanguagePack>(
+        LanguagePackFactory::FromFile(id, filename.c_str(), GetLanguageCachePath(id)));
+    format_string_cache_invalidate();
     if (_languageCurrent != nullptr)
     {
         _currentLanguage = id;
@@ -108,6 +118,7 @@ void LocalisationService::CloseLanguages()
     _languageFallback = nullptr;
     _languageCurrent = nullptr;
     _currentLanguage = LANGUAGE_UNDEFINED;
+    format_string_cache_invalidate();
 }
 
 std::tuple<rct_string_id, rct_string_id, rct_string_id> LocalisationService::GetLocalisedScenarioStrings(
@@ -133,6 +144,7 @@ rct_string_id LocalisationService::AllocateObjectString(const std::string& targe
     auto stringId = _availableObjectStringIds.top();
     _availableObjectStringIds.pop();
     _languageCurrent->SetString(stringId, target);
+    format_string_cache_invalidate();
     return stringId;
 }
 
@@ -143,6 +155,7 @@ void LocalisationService::FreeObjectString(rct_string_id stringId)
         if (_languageCurrent != nullptr)
         {
             _languageCurrent->RemoveString(stringId);
+            format_string_cache_invalidate();
         }
         _availableObjectStringIds.push(stringId);
     }
@@ -59,6 +59,7 @@ namespace OpenRCT2::Localisation
             const std::string& scenarioFilename) const;
         rct_string_id GetObjectOverrideStringId(const std::string_view& legacyIdentifier, uint8_t index) const;
         std::string GetLanguagePath(uint32_t languageId) const;
+        std::string GetLanguageCachePath(uint32_t languageId) const;
 
         void OpenLanguage(int32_t id);
         void CloseLanguages();
@@ -156,8 +156,12 @@ void News::UpdateCurrentItem()
     if (gNewsItems.IsEmpty())
         return;
 
-    auto intent = Intent(INTENT_ACTION_INVALIDATE_TICKER_NEWS);
-    context_broadcast_intent(&intent);
+    // The ticker is redrawn every tick to scroll the text in, which is only of use if there is a window to draw it in
+    if (!gOpenRCT2Headless)
+    {
+        auto intent = Intent(INTENT_ACTION_INVALIDATE_TICKER_NEWS);
+        context_broadcast_intent(&intent);
+    }
 
     // Update the current news item
     TickCurrent();
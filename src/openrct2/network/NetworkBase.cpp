@@ -14,6 +14,7 @@
 #include "../GameStateSnapshots.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
+#include "../Tracing.h"
 #include "../actions/LoadOrQuitAction.hpp"
 #include "../actions/NetworkModifyGroupAction.hpp"
 #include "../actions/PeepPickupAction.hpp"
@@ -28,13 +29,14 @@
 #include "network.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <stdexcept>
 
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "3"
+#define NETWORK_STREAM_VERSION "15"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -44,6 +46,30 @@ static int32_t _pickup_peep_old_x = LOCATION_NULL;
 // with uint16_t and needs some spare room for other data in the packet.
 static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 
+// Packets handled for each client per update, a client sending faster than that can not hold up the game loop.
+static constexpr uint32_t MAX_PACKETS_PER_CLIENT_UPDATE = 128;
+
+// New connections are accepted one per HANDSHAKE_INTERVAL milliseconds on average, with bursts of up to
+// HANDSHAKE_BURST, and only while fewer than MAX_PENDING_HANDSHAKES clients are still joining. Others wait in the
+// listen backlog, so a flood of connections can not hold up the game loop.
+static constexpr uint32_t HANDSHAKE_INTERVAL = 100;
+static constexpr uint32_t HANDSHAKE_BURST = 8;
+static constexpr size_t MAX_PENDING_HANDSHAKES = 16;
+
+// Clients report the map area their main view shows at most this often, in milliseconds
+static constexpr uint32_t VIEWPORT_REPORT_INTERVAL = 500;
+// Players are of interest to a client while their last action is within this many map units of its view
+static constexpr int32_t INTEREST_AREA_MARGIN = 8 * COORDS_XY_STEP;
+// With interest management, every client still gets the pings of all players in every this many ping lists
+static constexpr uint32_t FULL_PING_LIST_INTERVAL = 4;
+
+// How far back a standby can replay the tick stream to a client failing over to it
+static constexpr uint32_t STANDBY_BACKLOG_TICKS = 60 * GAME_UPDATE_FPS;
+
+// A client failing over tries the standby this many times, as it may not have taken over yet
+static constexpr uint32_t FAILOVER_ATTEMPTS = 10;
+static constexpr uint32_t FAILOVER_RETRY_DELAY = 1000;
+
 #ifndef DISABLE_NETWORK
 
 #    include "../Cheats.h"
@@ -58,7 +84,9 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include "../core/Path.hpp"
 #    include "../core/String.hpp"
 #    include "../interface/Chat.h"
+#    include "../interface/Viewport.h"
 #    include "../interface/Window.h"
+#    include "../interface/Window_internal.h"
 #    include "../localisation/Date.h"
 #    include "../localisation/Localisation.h"
 #    include "../object/ObjectManager.h"
@@ -123,9 +151,13 @@ NetworkBase::NetworkBase()
     client_command_handlers[NetworkCommand::Event] = &NetworkBase::Client_Handle_EVENT;
     client_command_handlers[NetworkCommand::GameInfo] = &NetworkBase::Client_Handle_GAMEINFO;
     client_command_handlers[NetworkCommand::Token] = &NetworkBase::Client_Handle_TOKEN;
+    client_command_handlers[NetworkCommand::ObjectsManifest] = &NetworkBase::Client_Handle_OBJECTS_MANIFEST;
     client_command_handlers[NetworkCommand::ObjectsList] = &NetworkBase::Client_Handle_OBJECTS_LIST;
+    client_command_handlers[NetworkCommand::Objects] = &NetworkBase::Client_Handle_OBJECTS;
     client_command_handlers[NetworkCommand::Scripts] = &NetworkBase::Client_Handle_SCRIPTS;
     client_command_handlers[NetworkCommand::GameState] = &NetworkBase::Client_Handle_GAMESTATE;
+    client_command_handlers[NetworkCommand::Resume] = &NetworkBase::Client_Handle_RESUME;
+    client_command_handlers[NetworkCommand::TileChecksums] = &NetworkBase::Client_Handle_TILE_CHECKSUMS;
 
     server_command_handlers[NetworkCommand::Auth] = &NetworkBase::Server_Handle_AUTH;
     server_command_handlers[NetworkCommand::Chat] = &NetworkBase::Server_Handle_CHAT;
@@ -133,9 +165,22 @@ NetworkBase::NetworkBase()
     server_command_handlers[NetworkCommand::Ping] = &NetworkBase::Server_Handle_PING;
     server_command_handlers[NetworkCommand::GameInfo] = &NetworkBase::Server_Handle_GAMEINFO;
     server_command_handlers[NetworkCommand::Token] = &NetworkBase::Server_Handle_TOKEN;
+    server_command_handlers[NetworkCommand::ObjectsListRequest] = &NetworkBase::Server_Handle_OBJECTS_LIST_REQUEST;
+    server_command_handlers[NetworkCommand::ObjectsRequest] = &NetworkBase::Server_Handle_OBJECTS_REQUEST;
     server_command_handlers[NetworkCommand::MapRequest] = &NetworkBase::Server_Handle_MAPREQUEST;
     server_command_handlers[NetworkCommand::RequestGameState] = &NetworkBase::Server_Handle_REQUEST_GAMESTATE;
+    server_command_handlers[NetworkCommand::RequestTileChecksums] = &NetworkBase::Server_Handle_REQUEST_TILE_CHECKSUMS;
     server_command_handlers[NetworkCommand::Heartbeat] = &NetworkBase::Server_Handle_HEARTBEAT;
+    server_command_handlers[NetworkCommand::Viewport] = &NetworkBase::Server_Handle_VIEWPORT;
+
+    // Spectators can only watch, their chat and game actions are not handled
+    relay_command_handlers[NetworkCommand::Auth] = &NetworkBase::Relay_Handle_AUTH;
+    relay_command_handlers[NetworkCommand::GameInfo] = &NetworkBase::Server_Handle_GAMEINFO;
+    relay_command_handlers[NetworkCommand::Token] = &NetworkBase::Server_Handle_TOKEN;
+    relay_command_handlers[NetworkCommand::ObjectsListRequest] = &NetworkBase::Server_Handle_OBJECTS_LIST_REQUEST;
+    relay_command_handlers[NetworkCommand::ObjectsRequest] = &NetworkBase::Server_Handle_OBJECTS_REQUEST;
+    relay_command_handlers[NetworkCommand::MapRequest] = &NetworkBase::Relay_Handle_MAPREQUEST;
+    relay_command_handlers[NetworkCommand::Heartbeat] = &NetworkBase::Server_Handle_HEARTBEAT;
 
     _chat_log_fs << std::unitbuf;
     _server_log_fs << std::unitbuf;
@@ -191,11 +236,23 @@ void NetworkBase::Close()
         CloseConnection();
 
         client_connection_list.clear();
+        _relayBacklog.clear();
+        _standbyBacklog.clear();
+        _standbyTakeOverTick.reset();
+        {
+            // Results of verifications still running are dropped when they come in, their connections are gone
+            std::lock_guard<std::mutex> lock(_completedAuthsMutex);
+            _completedAuths.clear();
+        }
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
         player_list.clear();
         group_list.clear();
         _serverTickData.clear();
+        _desyncTileChecksums.reset();
+        _stateChecksumHistory.clear();
+        _mapSnapshot.reset();
+        _mapInflater.reset();
         _pendingPlayerLists.clear();
         _pendingPlayerInfo.clear();
 
@@ -225,11 +282,13 @@ void NetworkBase::CloseConnection()
     if (mode == NETWORK_MODE_CLIENT)
     {
         _serverConnection.reset();
+        _relayListenSocket.reset();
     }
     else if (mode == NETWORK_MODE_SERVER)
     {
         _listenSocket.reset();
         _advertiser.reset();
+        _ioThread.reset();
     }
 
     mode = NETWORK_MODE_NONE;
@@ -263,6 +322,8 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     _lastConnectStatus = SocketStatus::Closed;
     _clientMapLoaded = false;
     _serverTickData.clear();
+    _pendingObjectManifest.reset();
+    _mapAwaitingObjects.reset();
 
     BeginChatLog();
     BeginServerLog();
@@ -340,6 +401,39 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     return true;
 }
 
+bool NetworkBase::BeginRelay(const std::string& host, uint16_t port, uint16_t relayPort, const std::string& relayAddress)
+{
+    if (!BeginClient(host, port))
+        return false;
+
+    log_verbose("Begin listening for spectators");
+    _relayListenSocket = CreateTcpSocket();
+    try
+    {
+        _relayListenSocket->Listen(relayAddress, relayPort);
+    }
+    catch (const std::exception& ex)
+    {
+        Console::Error::WriteLine(ex.what());
+        Close();
+        return false;
+    }
+    _handshakeCredit = HANDSHAKE_INTERVAL * HANDSHAKE_BURST;
+    Console::WriteLine("Relaying %s:%u to spectators on port %u", host.c_str(), port, relayPort);
+    return true;
+}
+
+bool NetworkBase::BeginStandby(const std::string& host, uint16_t port, uint16_t standbyPort, const std::string& standbyAddress)
+{
+    if (!BeginClient(host, port))
+        return false;
+
+    _standbyPort = standbyPort;
+    _standbyAddress = standbyAddress;
+    Console::WriteLine("Standing by for %s:%u, taking over on port %u", host.c_str(), port, standbyPort);
+    return true;
+}
+
 bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
 {
     Close();
@@ -396,6 +490,7 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
 
     status = NETWORK_STATUS_CONNECTED;
     listening_port = port;
+    _handshakeCredit = HANDSHAKE_INTERVAL * HANDSHAKE_BURST;
     _serverState.gamestateSnapshotsEnabled = gConfigNetwork.desync_debugging;
     _advertiser = CreateServerAdvertiser(listening_port);
 
@@ -469,6 +564,8 @@ void NetworkBase::Update()
             break;
     }
 
+    ProcessDesyncReport();
+
     // If the Close() was called during the update, close it for real
     _closeLock = false;
     if (_requireClose)
@@ -476,6 +573,7 @@ void NetworkBase::Update()
         Close();
         if (_requireReconnect)
         {
+            _requireReconnect = false;
             Reconnect();
         }
     }
@@ -487,9 +585,14 @@ void NetworkBase::Flush()
     {
         _serverConnection->SendQueuedPackets();
     }
-    else
+    else if (_ioThread != nullptr)
     {
-        for (auto& it : client_connection_list)
+        _ioThread->Wake();
+    }
+    // The spectators of a relay, or clients that joined before a standby took over
+    for (auto& it : client_connection_list)
+    {
+        if (!it->IsServicedByIoThread())
         {
             it->SendQueuedPackets();
         }
@@ -498,6 +601,13 @@ void NetworkBase::Flush()
 
 void NetworkBase::UpdateServer()
 {
+    ProcessCompletedAuths();
+
+    if (_standbyTakeOverTick.has_value())
+    {
+        Standby_RetirePrimaryPlayers();
+    }
+
     for (auto& connection : client_connection_list)
     {
         // This can be called multiple times before the connection is removed.
@@ -526,10 +636,300 @@ void NetworkBase::UpdateServer()
         _advertiser->Update();
     }
 
-    std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-    if (tcpSocket != nullptr)
+    _handshakeCredit = std::min(_handshakeCredit + _currentDeltaTime, HANDSHAKE_INTERVAL * HANDSHAKE_BURST);
+    if (_handshakeCredit >= HANDSHAKE_INTERVAL && CountPendingHandshakes() < MAX_PENDING_HANDSHAKES)
+    {
+        std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
+        if (tcpSocket != nullptr)
+        {
+            _handshakeCredit -= HANDSHAKE_INTERVAL;
+            AddClient(std::move(tcpSocket));
+        }
+    }
+}
+
+size_t NetworkBase::CountPendingHandshakes() const
+{
+    return std::count_if(client_connection_list.begin(), client_connection_list.end(), [](const auto& connection) {
+        return !connection->IsDisconnected && connection->AuthStatus != NetworkAuth::Ok;
+    });
+}
+
+// Copies a packet for sending on, the copy can be shared by any number of connections
+static std::shared_ptr<NetworkPacket> CopyPacket(const NetworkPacket& packet)
+{
+    auto copy = std::make_shared<NetworkPacket>(packet.GetCommand());
+    copy->Data = packet.Data;
+    copy->Header.Size = static_cast<uint16_t>(copy->Data.size());
+    return copy;
+}
+
+static uint32_t PeekUInt32(const NetworkPacket& packet, size_t offset)
+{
+    uint32_t value = 0;
+    if (offset + sizeof(value) <= packet.Data.size())
+    {
+        std::memcpy(&value, &packet.Data[offset], sizeof(value));
+        value = ByteSwapBE(value);
+    }
+    return value;
+}
+
+bool NetworkBase::IsRelay() const
+{
+    return _relayListenSocket != nullptr;
+}
+
+void NetworkBase::UpdateRelay()
+{
+    for (auto& connection : client_connection_list)
+    {
+        if (!connection->IsDisconnected && !ProcessConnection(*connection))
+        {
+            connection->IsDisconnected = true;
+        }
+    }
+    client_connection_list.remove_if([](const auto& connection) { return connection->IsDisconnected; });
+
+    // Spectators that join from now on start at the current tick
+    while (!_relayBacklog.empty() && _relayBacklog.front().first < gCurrentTicks)
+    {
+        _relayBacklog.pop_front();
+    }
+
+    // There is nothing to show spectators before the relay has the map itself
+    if (!_clientMapLoaded)
+        return;
+
+    _handshakeCredit = std::min(_handshakeCredit + _currentDeltaTime, HANDSHAKE_INTERVAL * HANDSHAKE_BURST);
+    if (_handshakeCredit >= HANDSHAKE_INTERVAL && CountPendingHandshakes() < MAX_PENDING_HANDSHAKES)
+    {
+        std::unique_ptr<ITcpSocket> tcpSocket = _relayListenSocket->Accept();
+        if (tcpSocket != nullptr)
+        {
+            _handshakeCredit -= HANDSHAKE_INTERVAL;
+            AddClient(std::move(tcpSocket));
+        }
+    }
+}
+
+/**
+ * Passes a packet from the upstream server on to the spectators unchanged, so it is only serialised once however many
+ * spectators there are.
+ */
+void NetworkBase::Relay_Forward(const NetworkPacket& packet)
+{
+    const auto command = packet.GetCommand();
+    switch (command)
+    {
+        case NetworkCommand::Tick:
+        case NetworkCommand::GameAction:
+        case NetworkCommand::Map:
+        case NetworkCommand::Chat:
+        case NetworkCommand::PlayerList:
+        case NetworkCommand::PlayerInfo:
+        case NetworkCommand::PingList:
+        case NetworkCommand::GroupList:
+        case NetworkCommand::Event:
+            break;
+        default:
+            return;
+    }
+
+    auto forwarded = CopyPacket(packet);
+    if (command == NetworkCommand::Tick || command == NetworkCommand::GameAction)
+    {
+        // Both start with the tick they are for
+        _relayBacklog.emplace_back(PeekUInt32(packet, 0), forwarded);
+    }
+
+    for (auto& connection : client_connection_list)
+    {
+        if (connection->IsRelayJoined && !connection->IsDisconnected)
+        {
+            connection->QueuePacket(forwarded);
+        }
+    }
+}
+
+/**
+ * Spectators do not need to be known to the upstream server, so they are not verified. They all see the game as the
+ * relay's own player.
+ */
+void NetworkBase::Relay_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet)
+{
+    if (connection.AuthStatus == NetworkAuth::Ok)
+        return;
+
+    const char* gameversion = packet.ReadString();
+    connection.AuthStatus = gameversion != nullptr && network_get_version() == gameversion ? NetworkAuth::Ok
+                                                                                            : NetworkAuth::BadVersion;
+
+    NetworkPacket response(NetworkCommand::Auth);
+    response << static_cast<uint32_t>(connection.AuthStatus) << player_id;
+    if (connection.AuthStatus == NetworkAuth::Ok)
+    {
+        connection.QueuePacket(std::move(response));
+
+        Server_Send_OBJECTS_MANIFEST(connection);
+        Server_Send_SCRIPTS(connection);
+    }
+    else
+    {
+        response.WriteString(network_get_version().c_str());
+        connection.QueuePacket(std::move(response));
+        connection.Disconnect();
+    }
+}
+
+void NetworkBase::Relay_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    if (connection.IsRelayJoined || !Server_Read_MAPREQUEST(connection, packet))
+        return;
+
+    // Spectators joining on the same tick share the map snapshot
+    Server_Send_MAP(&connection);
+    Server_Send_GROUPLIST(connection);
+    Server_Send_PLAYERLIST(connection, gCurrentTicks);
+    for (const auto& [tick, backlogPacket] : _relayBacklog)
+    {
+        if (tick >= gCurrentTicks)
+        {
+            connection.QueuePacket(backlogPacket);
+        }
+    }
+    connection.IsRelayJoined = true;
+}
+
+bool NetworkBase::IsStandby() const
+{
+    return _standbyPort != 0;
+}
+
+void NetworkBase::Standby_Record(const NetworkPacket& packet)
+{
+    const auto command = packet.GetCommand();
+    if (command != NetworkCommand::Tick && command != NetworkCommand::GameAction)
+        return;
+
+    // Both start with the tick they are for
+    _standbyBacklog.emplace_back(PeekUInt32(packet, 0), CopyPacket(packet));
+    while (_standbyBacklog.front().first + STANDBY_BACKLOG_TICKS < gCurrentTicks)
+    {
+        _standbyBacklog.pop_front();
+    }
+}
+
+/**
+ * Turns the standby into the server when the connection to the primary is lost. The game carries on from the tick the
+ * standby is on, so clients that were at most that far can resume without the map.
+ */
+void NetworkBase::Standby_TakeOver()
+{
+    Console::WriteLine("Lost the primary at tick %u, taking over on port %u", gCurrentTicks, _standbyPort);
+
+    auto listenSocket = CreateTcpSocket();
+    try
+    {
+        listenSocket->Listen(_standbyAddress, _standbyPort);
+    }
+    catch (const std::exception& ex)
+    {
+        Console::Error::WriteLine(ex.what());
+        Close();
+        return;
+    }
+
+    _serverConnection.reset();
+    _listenSocket = std::move(listenSocket);
+    mode = NETWORK_MODE_SERVER;
+    status = NETWORK_STATUS_CONNECTED;
+    listening_port = _standbyPort;
+    _handshakeCredit = HANDSHAKE_INTERVAL * HANDSHAKE_BURST;
+    _serverState.state = NetworkServerState::Ok;
+    _serverState.gamestateSnapshotsEnabled = gConfigNetwork.desync_debugging;
+    _serverTickData.clear();
+    _pendingPlayerLists.clear();
+    _pendingPlayerInfo.clear();
+    _userManager.Load();
+
+    // Packets from the primary for ticks the standby has not run yet may be incomplete. Their game actions are still
+    // queued, so they are run and sent out again by this server on the current tick.
+    while (!_standbyBacklog.empty() && _standbyBacklog.back().first >= gCurrentTicks)
+    {
+        _standbyBacklog.pop_back();
+    }
+    _standbyTakeOverTick = gCurrentTicks;
+
+    // The primary's players stay until none of their replayable game actions are left in the backlog
+    auto player = GetPlayerByID(player_id);
+    if (player == nullptr)
     {
-        AddClient(std::move(tcpSocket));
+        player = AddPlayer(gConfigNetwork.player_name, "");
+        player_id = player->Id;
+    }
+    player->Flags |= NETWORK_PLAYER_FLAG_ISSERVER;
+    player->Group = 0;
+    _playerListInvalidated = true;
+
+    _advertiser = CreateServerAdvertiser(listening_port);
+}
+
+void NetworkBase::Standby_RetirePrimaryPlayers()
+{
+    if (!_standbyBacklog.empty() && _standbyBacklog.front().first < *_standbyTakeOverTick)
+        return;
+
+    std::set<const NetworkPlayer*> connectedPlayers;
+    for (const auto& connection : client_connection_list)
+    {
+        connectedPlayers.insert(connection->Player);
+    }
+    player_list.erase(
+        std::remove_if(
+            player_list.begin(), player_list.end(),
+            [&](const auto& player) { return player->Id != player_id && connectedPlayers.count(player.get()) == 0; }),
+        player_list.end());
+    _playerListInvalidated = true;
+    _standbyTakeOverTick.reset();
+}
+
+/**
+ * Checks a client failing over can carry on from its tick: the standby must have taken over after that tick, still
+ * have everything that happened since and agree on the state of the random number generator at that tick.
+ */
+bool NetworkBase::Standby_CanResume(uint32_t tick, uint32_t srand0) const
+{
+    if (!_standbyTakeOverTick.has_value() || tick > *_standbyTakeOverTick || _standbyBacklog.empty()
+        || _standbyBacklog.front().first > tick)
+    {
+        return false;
+    }
+
+    for (const auto& [backlogTick, packet] : _standbyBacklog)
+    {
+        if (backlogTick == tick && packet->GetCommand() == NetworkCommand::Tick)
+        {
+            return PeekUInt32(*packet, sizeof(uint32_t)) == srand0;
+        }
+    }
+    return false;
+}
+
+void NetworkBase::Standby_Send_RESUME(NetworkConnection& connection, uint32_t tick)
+{
+    NetworkPacket packet(NetworkCommand::Resume);
+    packet << tick;
+    connection.QueuePacket(std::move(packet));
+
+    // The players as of the client's tick, the game actions replayed to it refer to them
+    Server_Send_PLAYERLIST(connection, tick);
+    for (const auto& [backlogTick, backlogPacket] : _standbyBacklog)
+    {
+        if (backlogTick >= tick)
+        {
+            connection.QueuePacket(backlogPacket);
+        }
     }
 }
 
@@ -541,6 +941,19 @@ void NetworkBase::UpdateClient()
     {
         case NETWORK_STATUS_CONNECTING:
         {
+            if (_failoverRetryTime != 0)
+            {
+                // The game stays on the last tick from the old server until the standby is reached
+                if (platform_get_ticks() < _failoverRetryTime)
+                    break;
+
+                _failoverRetryTime = 0;
+                _lastConnectStatus = SocketStatus::Closed;
+                _serverConnection = std::make_unique<NetworkConnection>();
+                _serverConnection->Socket = CreateTcpSocket();
+                _serverConnection->Socket->ConnectAsync(_host, _port);
+            }
+
             switch (_serverConnection->Socket->GetStatus())
             {
                 case SocketStatus::Resolving:
@@ -597,6 +1010,13 @@ void NetworkBase::UpdateClient()
                         Console::Error::WriteLine(error);
                     }
 
+                    if (_resumeOnConnect && ++_failoverAttempts < FAILOVER_ATTEMPTS)
+                    {
+                        _failoverRetryTime = platform_get_ticks() + FAILOVER_RETRY_DELAY;
+                        break;
+                    }
+                    _resumeOnConnect = false;
+
                     Close();
                     context_force_close_window_by_class(WC_NETWORK_STATUS);
                     context_show_error(STR_UNABLE_TO_CONNECT_TO_SERVER, STR_NONE, {});
@@ -609,6 +1029,18 @@ void NetworkBase::UpdateClient()
         {
             if (!ProcessConnection(*_serverConnection))
             {
+                if (_clientMapLoaded && IsStandby())
+                {
+                    Standby_TakeOver();
+                    break;
+                }
+                if (_clientMapLoaded && _failoverPort != 0)
+                {
+                    FailOver();
+                    break;
+                }
+                _resumeOnConnect = false;
+
                 // Do not show disconnect message window when password window closed/canceled
                 if (_serverConnection->AuthStatus == NetworkAuth::RequirePassword)
                 {
@@ -643,6 +1075,15 @@ void NetworkBase::UpdateClient()
                     Client_Send_HEARTBEAT(*_serverConnection);
                     _lastSentHeartbeat = ticks;
                 }
+                if (_clientMapLoaded && ticks - _lastViewportReportTime >= VIEWPORT_REPORT_INTERVAL)
+                {
+                    Client_Send_VIEWPORT();
+                    _lastViewportReportTime = ticks;
+                }
+                if (IsRelay())
+                {
+                    UpdateRelay();
+                }
             }
 
             break;
@@ -650,6 +1091,19 @@ void NetworkBase::UpdateClient()
     }
 }
 
+/**
+ * Reconnects to the standby the server announced, asking to carry on from the current tick.
+ */
+void NetworkBase::FailOver()
+{
+    Console::WriteLine("Lost the connection to the server, failing over to %s:%u", _failoverHost.c_str(), _failoverPort);
+    _host = _failoverHost;
+    _port = _failoverPort;
+    Reconnect();
+    _resumeOnConnect = true;
+    _failoverAttempts = 0;
+}
+
 std::vector<std::unique_ptr<NetworkPlayer>>::iterator NetworkBase::GetPlayerIteratorByID(uint8_t id)
 {
     auto it = std::find_if(player_list.begin(), player_list.end(), [&id](std::unique_ptr<NetworkPlayer> const& player) {
@@ -716,6 +1170,14 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
 {
+    // All clients get the same copy of the packet
+    auto sharedPacket = std::make_shared<NetworkPacket>(packet);
+    sharedPacket->Header.Size = static_cast<uint16_t>(sharedPacket->Data.size());
+    if (IsStandby())
+    {
+        Standby_Record(*sharedPacket);
+    }
+
     for (auto& client_connection : client_connection_list)
     {
         if (client_connection->IsDisconnected)
@@ -735,8 +1197,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        auto packetCopy = packet;
-        client_connection->QueuePacket(std::move(packetCopy), front);
+        client_connection->QueuePacket(sharedPacket, front);
     }
 }
 
@@ -761,7 +1222,7 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        rct_sprite_checksum checksum = sprite_checksum();
+        rct_sprite_checksum checksum = sprite_rolling_checksum();
         std::string clientSpriteHash = checksum.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
@@ -770,6 +1231,31 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
         }
     }
 
+    if (storedTick.stateChecksums)
+    {
+        const auto& serverChecksums = *storedTick.stateChecksums;
+        const auto clientChecksums = network_compute_state_checksums(serverChecksums.tileRow);
+        if (!(clientChecksums == serverChecksums))
+        {
+            if (clientChecksums.tileElements != serverChecksums.tileElements)
+            {
+                log_info(
+                    "Tile element hash mismatch in rows %u to %u", serverChecksums.tileRow,
+                    serverChecksums.tileRow + NetworkChecksumTileRows - 1);
+                _desyncTileChecksums = std::make_pair(tick, clientChecksums);
+            }
+            if (clientChecksums.rides != serverChecksums.rides)
+            {
+                log_info("Ride state hash mismatch");
+            }
+            if (clientChecksums.finances != serverChecksums.finances)
+            {
+                log_info("Park finances hash mismatch");
+            }
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -794,10 +1280,20 @@ bool NetworkBase::CheckDesynchronizaton()
         intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ str_desync });
         context_open_intent(&intent);
 
-        if (!gConfigNetwork.stay_connected)
+        if (IsStandby())
+        {
+            // A standby out of sync is of no use to take over, start again with a new copy of the map
+            Console::Error::WriteLine("Out of sync with the primary at tick %u, joining again", gCurrentTicks);
+            Reconnect();
+        }
+        else if (!gConfigNetwork.stay_connected)
         {
             Close();
         }
+        else if (_desyncTileChecksums.has_value())
+        {
+            Client_Send_RequestTileChecksums(_desyncTileChecksums->first);
+        }
 
         return true;
     }
@@ -828,7 +1324,7 @@ void NetworkBase::KickPlayer(int32_t playerId)
             char str_disconnect_msg[256];
             format_string(str_disconnect_msg, 256, STR_MULTIPLAYER_KICKED_REASON, nullptr);
             Server_Send_SETDISCONNECTMSG(*client_connection, str_disconnect_msg);
-            client_connection->Socket->Disconnect();
+            client_connection->Disconnect();
             break;
         }
     }
@@ -843,7 +1339,7 @@ void NetworkBase::ServerClientDisconnected()
 {
     if (GetMode() == NETWORK_MODE_CLIENT)
     {
-        _serverConnection->Socket->Disconnect();
+        _serverConnection->Disconnect();
     }
 }
 
@@ -1204,10 +1700,65 @@ void NetworkBase::Client_Send_RequestGameState(uint32_t tick)
     _serverConnection->QueuePacket(std::move(packet));
 }
 
+void NetworkBase::Client_Send_RequestTileChecksums(uint32_t tick)
+{
+    log_verbose("Requesting tile checksums from server for tick %u", tick);
+
+    NetworkPacket packet(NetworkCommand::RequestTileChecksums);
+    packet << tick;
+    _serverConnection->QueuePacket(std::move(packet));
+}
+
+// The part of the map the main view shows, the corners are projected at ground level
+static std::optional<MapRange> GetMainViewportRange()
+{
+    auto* mainWindow = window_get_main();
+    if (mainWindow == nullptr || mainWindow->viewport == nullptr)
+        return std::nullopt;
+
+    const auto* viewport = mainWindow->viewport;
+    const int32_t width = viewport->view_width;
+    const int32_t height = viewport->view_height;
+    const ScreenCoordsXY corners[] = {
+        viewport->viewPos,
+        viewport->viewPos + ScreenCoordsXY{ width, 0 },
+        viewport->viewPos + ScreenCoordsXY{ 0, height },
+        viewport->viewPos + ScreenCoordsXY{ width, height },
+    };
+    auto first = viewport_coord_to_map_coord(corners[0], 0);
+    MapRange range(first, first);
+    for (const auto& corner : corners)
+    {
+        auto mapCoords = viewport_coord_to_map_coord(corner, 0);
+        range = MapRange(
+            std::min(range.GetLeft(), mapCoords.x), std::min(range.GetTop(), mapCoords.y),
+            std::max(range.GetRight(), mapCoords.x), std::max(range.GetBottom(), mapCoords.y));
+    }
+    return range;
+}
+
+void NetworkBase::Client_Send_VIEWPORT()
+{
+    auto range = GetMainViewportRange();
+    if (!range.has_value())
+        return;
+
+    // Only sent when the view has moved
+    if (_lastReportedViewport.has_value() && _lastReportedViewport->Point1 == range->Point1
+        && _lastReportedViewport->Point2 == range->Point2)
+        return;
+
+    NetworkPacket packet(NetworkCommand::Viewport);
+    packet << range->GetLeft() << range->GetTop() << range->GetRight() << range->GetBottom();
+    _serverConnection->QueuePacket(std::move(packet));
+    _lastReportedViewport = range;
+}
+
 void NetworkBase::Client_Send_TOKEN()
 {
     log_verbose("requesting token");
     NetworkPacket packet(NetworkCommand::Token);
+    packet << (gConfigNetwork.compress_traffic ? NetworkCompression::Deflate : NetworkCompression::None);
     _serverConnection->AuthStatus = NetworkAuth::Requested;
     _serverConnection->QueuePacket(std::move(packet));
 }
@@ -1237,6 +1788,24 @@ void NetworkBase::Client_Send_MAPREQUEST(const std::vector<std::string>& objects
         log_verbose("client requests object %s", object.c_str());
         packet.Write(reinterpret_cast<const uint8_t*>(object.c_str()), 8);
     }
+    if (_resumeOnConnect)
+    {
+        // The game is still loaded, a standby can send what happened since instead of the map
+        packet << gCurrentTicks << scenario_rand_state().s0;
+    }
+    _serverConnection->QueuePacket(std::move(packet));
+}
+
+void NetworkBase::Client_Send_OBJECTS_REQUEST(const std::vector<std::string>& objects)
+{
+    log_verbose("client requests %u objects", uint32_t(objects.size()));
+    NetworkPacket packet(NetworkCommand::ObjectsRequest);
+    packet << static_cast<uint32_t>(objects.size());
+    for (const auto& object : objects)
+    {
+        log_verbose("client requests object %s", object.c_str());
+        packet.Write(reinterpret_cast<const uint8_t*>(object.c_str()), 8);
+    }
     _serverConnection->QueuePacket(std::move(packet));
 }
 
@@ -1245,6 +1814,31 @@ void NetworkBase::Server_Send_TOKEN(NetworkConnection& connection)
     NetworkPacket packet(NetworkCommand::Token);
     packet << static_cast<uint32_t>(connection.Challenge.size());
     packet.Write(connection.Challenge.data(), connection.Challenge.size());
+    packet << (connection.IsCompressionEnabled() ? NetworkCompression::Deflate : NetworkCompression::None);
+    connection.QueuePacket(std::move(packet));
+}
+
+/**
+ * Sends a hash of the objects list, a client that has been through the same list before already has all the objects
+ * and does not need the list.
+ */
+void NetworkBase::Server_Send_OBJECTS_MANIFEST(NetworkConnection& connection)
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    auto objects = objManager.GetPackableObjects();
+
+    auto sha1 = Crypt::CreateSHA1();
+    for (const auto* object : objects)
+    {
+        sha1->Update(object->ObjectEntry.name, 8);
+        sha1->Update(&object->ObjectEntry.checksum, sizeof(object->ObjectEntry.checksum));
+        sha1->Update(&object->ObjectEntry.flags, sizeof(object->ObjectEntry.flags));
+    }
+    auto manifest = sha1->Finish();
+
+    NetworkPacket packet(NetworkCommand::ObjectsManifest);
+    packet << static_cast<uint32_t>(objects.size());
+    packet.Write(manifest.data(), manifest.size());
     connection.QueuePacket(std::move(packet));
 }
 
@@ -1278,6 +1872,32 @@ void NetworkBase::Server_Send_OBJECTS_LIST(
     }
 }
 
+/**
+ * Sends the objects a client is missing, packed the way they are in a saved game. They are split into chunks like the
+ * map, a single empty chunk is sent when there is nothing to pack.
+ */
+void NetworkBase::Server_Send_OBJECTS(
+    NetworkConnection& connection, std::vector<const ObjectRepositoryItem*>& objects) const
+{
+    log_verbose("Server sends %u objects", uint32_t(objects.size()));
+
+    auto ms = OpenRCT2::MemoryStream();
+    GetContext()->GetObjectRepository().WritePackedObjects(&ms, objects);
+    const auto* data = static_cast<const uint8_t*>(ms.GetData());
+    const size_t size = static_cast<size_t>(ms.GetLength());
+
+    size_t offset = 0;
+    do
+    {
+        const size_t datasize = std::min<size_t>(CHUNK_SIZE, size - offset);
+        NetworkPacket packet(NetworkCommand::Objects);
+        packet << static_cast<uint32_t>(size) << static_cast<uint32_t>(offset);
+        packet.Write(data + offset, datasize);
+        connection.QueuePacket(std::move(packet));
+        offset += datasize;
+    } while (offset < size);
+}
+
 void NetworkBase::Server_Send_SCRIPTS(NetworkConnection& connection) const
 {
     NetworkPacket packet(NetworkCommand::Scripts);
@@ -1327,16 +1947,17 @@ NetworkStats_t NetworkBase::GetStats() const
     NetworkStats_t stats = {};
     if (mode == NETWORK_MODE_CLIENT)
     {
-        stats = _serverConnection->Stats;
+        stats = _serverConnection->GetStats();
     }
     else
     {
         for (auto& connection : client_connection_list)
         {
+            const auto connectionStats = connection->GetStats();
             for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
             {
-                stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
-                stats.bytesSent[n] += connection->Stats.bytesSent[n];
+                stats.bytesReceived[n] += connectionStats.bytesReceived[n];
+                stats.bytesSent[n] += connectionStats.bytesSent[n];
             }
         }
     }
@@ -1359,7 +1980,7 @@ void NetworkBase::Server_Send_AUTH(NetworkConnection& connection)
     connection.QueuePacket(std::move(packet));
     if (connection.AuthStatus != NetworkAuth::Ok && connection.AuthStatus != NetworkAuth::RequirePassword)
     {
-        connection.Socket->Disconnect();
+        connection.Disconnect();
     }
 }
 
@@ -1379,13 +2000,25 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
-    auto header = save_for_network(objects);
+    // The game state does not change while packets are handled, so clients joining on the same tick can all be sent
+    // the same map. Sending the map to everyone is done after loading a park, which may not advance the tick.
+    std::vector<uint8_t> mapForAll;
+    if (connection == nullptr)
+    {
+        _mapSnapshot.reset();
+        mapForAll = save_for_network(objects);
+    }
+    else if (!_mapSnapshot || _mapSnapshot->Tick != gCurrentTicks || _mapSnapshot->Objects != objects)
+    {
+        _mapSnapshot = MapSnapshot{ gCurrentTicks, objects, save_for_network(objects) };
+    }
+    const auto& header = connection != nullptr ? _mapSnapshot->Data : mapForAll;
     if (header.empty())
     {
         if (connection)
         {
             connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
-            connection->Socket->Disconnect();
+            connection->Disconnect();
         }
         return;
     }
@@ -1409,6 +2042,8 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
 
 std::vector<uint8_t> NetworkBase::save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const
 {
+    OpenRCT2::Tracing::ScopedSpan traceSpan("save_load", "save_for_network");
+
     std::vector<uint8_t> header;
     bool RLEState = gUseRLE;
     gUseRLE = false;
@@ -1461,12 +2096,14 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
     }
     else
     {
+        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        auto sharedPacket = std::make_shared<const NetworkPacket>(std::move(packet));
         for (auto playerId : playerIds)
         {
             auto conn = GetPlayerConnection(playerId);
             if (conn != nullptr && !conn->IsDisconnected)
             {
-                conn->QueuePacket(packet);
+                conn->QueuePacket(sharedPacket);
             }
         }
     }
@@ -1503,6 +2140,7 @@ void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
     packet << gCurrentTicks << action->GetType() << stream;
 
     SendPacketToClients(packet);
+    _gameActionsSinceChecksum = true;
 }
 
 void NetworkBase::Server_Send_TICK()
@@ -1510,24 +2148,44 @@ void NetworkBase::Server_Send_TICK()
     NetworkPacket packet(NetworkCommand::Tick);
     packet << gCurrentTicks << scenario_rand_state().s0;
     uint32_t flags = 0;
-    // Simple counter which limits how often a sprite checksum gets sent.
-    // This can get somewhat expensive, so we don't want to push it every tick in release,
-    // but debug version can check more often.
-    static int32_t checksum_counter = 0;
-    checksum_counter++;
-    if (checksum_counter >= 100)
+    // Limit how often the checksums get sent, they are not free to compute. Game actions are the usual cause of a
+    // desync, so the tick after some were sent is always checked.
+    const auto checkInterval = static_cast<uint32_t>(std::max(gConfigNetwork.desync_check_interval, 1));
+    _ticksSinceChecksum++;
+    if (_ticksSinceChecksum >= checkInterval || _gameActionsSinceChecksum)
     {
-        checksum_counter = 0;
-        flags |= NETWORK_TICK_FLAG_CHECKSUMS;
+        _ticksSinceChecksum = 0;
+        _gameActionsSinceChecksum = false;
+        flags |= NETWORK_TICK_FLAG_CHECKSUMS | NETWORK_TICK_FLAG_STATE_CHECKSUMS;
     }
     // Send flags always, so we can understand packet structure on the other end,
     // and allow for some expansion.
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        rct_sprite_checksum checksum = sprite_checksum();
+        rct_sprite_checksum checksum = sprite_rolling_checksum();
         packet.WriteString(checksum.ToString().c_str());
     }
+    if (flags & NETWORK_TICK_FLAG_STATE_CHECKSUMS)
+    {
+        // Each checksum covers the next few rows of the map
+        if (_checksumTileRow >= static_cast<uint32_t>(std::max<int16_t>(gMapSize, 0)))
+        {
+            _checksumTileRow = 0;
+        }
+        auto checksums = network_compute_state_checksums(_checksumTileRow);
+        _checksumTileRow += NetworkChecksumTileRows;
+
+        packet << checksums.tileRow << checksums.tileElements << checksums.rides << checksums.finances;
+
+        // Enough history to cover clients running a few seconds behind at the shortest check interval
+        constexpr size_t MaxStateChecksumHistory = 128;
+        _stateChecksumHistory.emplace_back(gCurrentTicks, std::move(checksums));
+        while (_stateChecksumHistory.size() > MaxStateChecksumHistory)
+        {
+            _stateChecksumHistory.pop_front();
+        }
+    }
 
     SendPacketToClients(packet);
 }
@@ -1556,6 +2214,17 @@ void NetworkBase::Server_Send_PLAYERLIST()
     SendPacketToClients(packet);
 }
 
+void NetworkBase::Server_Send_PLAYERLIST(NetworkConnection& connection, uint32_t tick)
+{
+    NetworkPacket packet(NetworkCommand::PlayerList);
+    packet << tick << static_cast<uint8_t>(player_list.size());
+    for (auto& player : player_list)
+    {
+        player->Write(packet);
+    }
+    connection.QueuePacket(std::move(packet));
+}
+
 void NetworkBase::Client_Send_PING()
 {
     NetworkPacket packet(NetworkCommand::Ping);
@@ -1573,15 +2242,61 @@ void NetworkBase::Server_Send_PING()
     SendPacketToClients(packet, true);
 }
 
+bool NetworkBase::IsPlayerOfInterest(const NetworkConnection& connection, const NetworkPlayer& player) const
+{
+    if (!connection.InterestArea.has_value() || connection.Player == &player)
+        return true;
+
+    const auto& coords = player.LastActionCoord;
+    if (coords.isNull())
+        return false;
+
+    const auto& area = *connection.InterestArea;
+    return coords.x >= area.GetLeft() - INTEREST_AREA_MARGIN && coords.x <= area.GetRight() + INTEREST_AREA_MARGIN
+        && coords.y >= area.GetTop() - INTEREST_AREA_MARGIN && coords.y <= area.GetBottom() + INTEREST_AREA_MARGIN;
+}
+
 void NetworkBase::Server_Send_PINGLIST()
 {
-    NetworkPacket packet(NetworkCommand::PingList);
-    packet << static_cast<uint8_t>(player_list.size());
-    for (auto& player : player_list)
+    _pingListsSent++;
+    if (!gConfigNetwork.interest_management || _pingListsSent % FULL_PING_LIST_INTERVAL == 0)
     {
-        packet << player->Id << player->Ping;
+        NetworkPacket packet(NetworkCommand::PingList);
+        packet << static_cast<uint8_t>(player_list.size());
+        for (auto& player : player_list)
+        {
+            packet << player->Id << player->Ping;
+        }
+        SendPacketToClients(packet);
+        return;
+    }
+
+    // In between full lists, clients only get the pings of the players acting in the area they look at
+    std::vector<const NetworkPlayer*> players;
+    for (auto& connection : client_connection_list)
+    {
+        if (connection->IsDisconnected)
+            continue;
+
+        players.clear();
+        for (auto& player : player_list)
+        {
+            if (IsPlayerOfInterest(*connection, *player))
+            {
+                players.push_back(player.get());
+            }
+        }
+        if (players.empty())
+            continue;
+
+        NetworkPacket packet(NetworkCommand::PingList);
+        packet << static_cast<uint8_t>(players.size());
+        for (auto player : players)
+        {
+            packet << player->Id << player->Ping;
+        }
+        connection->QueuePacket(std::move(packet));
     }
-    SendPacketToClients(packet);
 }
 
 void NetworkBase::Server_Send_SETDISCONNECTMSG(NetworkConnection& connection, const char* msg)
@@ -1591,6 +2306,135 @@ void NetworkBase::Server_Send_SETDISCONNECTMSG(NetworkConnection& connection, co
     connection.QueuePacket(std::move(packet));
 }
 
+static const char* GetCommandName(NetworkCommand command)
+{
+    switch (command)
+    {
+        case NetworkCommand::Auth:
+            return "auth";
+        case NetworkCommand::Map:
+            return "map";
+        case NetworkCommand::Chat:
+            return "chat";
+        case NetworkCommand::Tick:
+            return "tick";
+        case NetworkCommand::PlayerList:
+            return "playerList";
+        case NetworkCommand::Ping:
+            return "ping";
+        case NetworkCommand::PingList:
+            return "pingList";
+        case NetworkCommand::DisconnectMessage:
+            return "disconnectMessage";
+        case NetworkCommand::GameInfo:
+            return "gameInfo";
+        case NetworkCommand::ShowError:
+            return "showError";
+        case NetworkCommand::GroupList:
+            return "groupList";
+        case NetworkCommand::Event:
+            return "event";
+        case NetworkCommand::Token:
+            return "token";
+        case NetworkCommand::ObjectsList:
+            return "objectsList";
+        case NetworkCommand::MapRequest:
+            return "mapRequest";
+        case NetworkCommand::GameAction:
+            return "gameAction";
+        case NetworkCommand::PlayerInfo:
+            return "playerInfo";
+        case NetworkCommand::RequestGameState:
+            return "requestGameState";
+        case NetworkCommand::GameState:
+            return "gameState";
+        case NetworkCommand::Scripts:
+            return "scripts";
+        case NetworkCommand::Heartbeat:
+            return "heartbeat";
+        case NetworkCommand::Resume:
+            return "resume";
+        case NetworkCommand::Compressed:
+            return "compressed";
+        case NetworkCommand::RequestTileChecksums:
+            return "requestTileChecksums";
+        case NetworkCommand::TileChecksums:
+            return "tileChecksums";
+        case NetworkCommand::Viewport:
+            return "viewport";
+        case NetworkCommand::ObjectsManifest:
+            return "objectsManifest";
+        case NetworkCommand::ObjectsListRequest:
+            return "objectsListRequest";
+        case NetworkCommand::ObjectsRequest:
+            return "objectsRequest";
+        case NetworkCommand::Objects:
+            return "objects";
+        default:
+            return nullptr;
+    }
+}
+
+static json_t GetConnectionStatsAsJson(const NetworkConnection& connection)
+{
+    const auto stats = connection.GetDetailedStats();
+    const auto trafficStats = connection.GetStats();
+
+    json_t commands = json_t::object();
+    for (size_t i = 0; i < stats.commands.size(); i++)
+    {
+        const auto& commandStats = stats.commands[i];
+        const auto* name = GetCommandName(static_cast<NetworkCommand>(i));
+        if (name == nullptr || (commandStats.packetsSent == 0 && commandStats.packetsReceived == 0))
+            continue;
+
+        commands[name] = {
+            { "packetsSent", commandStats.packetsSent },
+            { "packetsReceived", commandStats.packetsReceived },
+            { "bytesSent", commandStats.bytesSent },
+            { "bytesReceived", commandStats.bytesReceived },
+            { "handlerTime", commandStats.handlerTime * 1000 },
+        };
+    }
+
+    json_t jsonObj = {
+        { "player", connection.Player != nullptr ? json_t(connection.Player->Name) : json_t() },
+        { "bytesSent", trafficStats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] },
+        { "bytesReceived", trafficStats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] },
+        { "queuedPackets", connection.GetQueuedPacketCount() },
+        { "maxQueuedPackets", stats.maxQueuedPackets },
+        { "pendingSendBytes", connection.GetPendingSendBytes() },
+        { "pingHistogram", stats.pingHistogram },
+        { "commands", commands },
+    };
+    return jsonObj;
+}
+
+json_t NetworkBase::GetStatsAsJson() const
+{
+    json_t connections = json_t::array();
+    if (mode == NETWORK_MODE_CLIENT)
+    {
+        if (_serverConnection != nullptr)
+        {
+            connections.push_back(GetConnectionStatsAsJson(*_serverConnection));
+        }
+    }
+    else
+    {
+        for (const auto& connection : client_connection_list)
+        {
+            connections.push_back(GetConnectionStatsAsJson(*connection));
+        }
+    }
+
+    json_t jsonObj = {
+        { "pingBuckets", NetworkPingBuckets },
+        { "connections", connections },
+    };
+    return jsonObj;
+}
+
 json_t NetworkBase::GetServerInfoAsJson() const
 {
     json_t jsonObj = {
@@ -1617,6 +2461,12 @@ void NetworkBase::Server_Send_GAMEINFO(NetworkConnection& connection)
 
     jsonObj["provider"] = jsonProvider;
 
+    // Where clients go if this server goes away
+    if (!gConfigNetwork.failover_host.empty())
+    {
+        jsonObj["failover"] = { { "host", gConfigNetwork.failover_host }, { "port", gConfigNetwork.failover_port } };
+    }
+
     packet.WriteString(jsonObj.dump().c_str());
     packet << _serverState.gamestateSnapshotsEnabled;
 
@@ -1661,6 +2511,14 @@ void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName,
 
 bool NetworkBase::ProcessConnection(NetworkConnection& connection)
 {
+    if (connection.IsServicedByIoThread())
+    {
+        return ProcessReceivedPackets(connection);
+    }
+
+    // The server is trusted to send at a sensible rate, but clients and spectators are not
+    const uint32_t maxPackets = &connection == _serverConnection.get() ? UINT32_MAX : MAX_PACKETS_PER_CLIENT_UPDATE;
+    uint32_t numPackets = 0;
     NetworkReadPacket packetStatus;
     do
     {
@@ -1681,6 +2539,7 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
                 {
                     return false;
                 }
+                numPackets++;
                 break;
             case NetworkReadPacket::MoreData:
                 // more data required to be read
@@ -1689,7 +2548,7 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
                 // could not read anything from socket
                 break;
         }
-    } while (packetStatus == NetworkReadPacket::Success);
+    } while (packetStatus == NetworkReadPacket::Success && numPackets < maxPackets);
 
     connection.SendQueuedPackets();
 
@@ -1705,19 +2564,82 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
     return true;
 }
 
+/**
+ * Handles the packets that the I/O thread has read for the connection since the last update. The socket is only ever
+ * touched by that thread, sending the packets queued here is left to it as well.
+ */
+bool NetworkBase::ProcessReceivedPackets(NetworkConnection& connection)
+{
+    _receivedPackets.clear();
+    bool isOpen = connection.TakeReceivedPackets(_receivedPackets, MAX_PACKETS_PER_CLIENT_UPDATE);
+    for (auto& packet : _receivedPackets)
+    {
+        ProcessPacket(connection, packet);
+        if (connection.Socket == nullptr)
+        {
+            return false;
+        }
+    }
+    _receivedPackets.clear();
+
+    if (!isOpen)
+    {
+        if (!connection.GetLastDisconnectReason())
+        {
+            connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+        }
+        return false;
+    }
+
+    if (!connection.ReceivedPacketRecently())
+    {
+        if (!connection.GetLastDisconnectReason())
+        {
+            connection.SetLastDisconnectReason(STR_MULTIPLAYER_NO_DATA);
+        }
+        return false;
+    }
+
+    return true;
+}
+
 void NetworkBase::ProcessPacket(NetworkConnection& connection, NetworkPacket& packet)
 {
-    const auto& handlerList = GetMode() == NETWORK_MODE_SERVER ? server_command_handlers : client_command_handlers;
-    auto it = handlerList.find(packet.GetCommand());
-    if (it != handlerList.end())
+    const auto traceName = OpenRCT2::Tracing::IsEnabled() ? "packet " + std::to_string(EnumValue(packet.GetCommand()))
+                                                          : std::string();
+    OpenRCT2::Tracing::ScopedSpan traceSpan("network", traceName);
+
+    const auto* handlerList = &client_command_handlers;
+    if (GetMode() == NETWORK_MODE_SERVER)
+        handlerList = &server_command_handlers;
+    else if (&connection != _serverConnection.get())
+        handlerList = &relay_command_handlers;
+
+    auto it = handlerList->find(packet.GetCommand());
+    if (it != handlerList->end())
     {
         auto commandHandler = it->second;
         if (connection.AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
         {
+            const auto startTime = std::chrono::high_resolution_clock::now();
             (this->*commandHandler)(connection, packet);
+
+            const auto handlerTime = std::chrono::high_resolution_clock::now() - startTime;
+            connection.AddHandlerTime(packet.GetCommand(), std::chrono::duration<double>(handlerTime).count());
         }
     }
 
+    if (&connection == _serverConnection.get())
+    {
+        if (IsRelay())
+        {
+            Relay_Forward(packet);
+        }
+        if (IsStandby())
+        {
+            Standby_Record(packet);
+        }
+    }
     packet.Clear();
 }
 
@@ -1927,6 +2849,10 @@ void NetworkBase::ProcessDisconnectedClients()
         {
             ServerClientDisconnected(connection);
             RemovePlayer(connection);
+            if (connection->IsServicedByIoThread())
+            {
+                _ioThread->Remove(*connection);
+            }
 
             it = client_connection_list.erase(it);
         }
@@ -1947,6 +2873,14 @@ void NetworkBase::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     // Store connection
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
+    if (GetMode() == NETWORK_MODE_SERVER)
+    {
+        if (_ioThread == nullptr)
+        {
+            _ioThread = std::make_unique<NetworkIoThread>();
+        }
+        _ioThread->Add(*connection);
+    }
 
     client_connection_list.push_back(std::move(connection));
 }
@@ -1986,6 +2920,7 @@ void NetworkBase::ServerClientDisconnected(std::unique_ptr<NetworkConnection>& c
 
     // Log player disconnected event
     AppendServerLog(text);
+    AppendServerLog("Connection stats for " + connection_player->Name + ": " + GetConnectionStatsAsJson(*connection).dump());
 
     ProcessPlayerLeftPluginHooks(connection_player->Id);
 }
@@ -2136,7 +3071,7 @@ void NetworkBase::Client_Handle_TOKEN(NetworkConnection& connection, NetworkPack
     {
         log_error("Failed to load key %s", keyPath);
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_VERIFICATION_FAILURE);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         return;
     }
 
@@ -2153,13 +3088,21 @@ void NetworkBase::Client_Handle_TOKEN(NetworkConnection& connection, NetworkPack
     {
         log_error("Failed to sign server's challenge.");
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_VERIFICATION_FAILURE);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         return;
     }
     // Don't keep private key in memory. There's no need and it may get leaked
     // when process dump gets collected at some point in future.
     _key.Unload();
 
+    // Older servers do not send this, which reads as no compression
+    auto compression = NetworkCompression::None;
+    packet >> compression;
+    if (compression == NetworkCompression::Deflate)
+    {
+        connection.EnableCompression();
+    }
+
     const char* password = String::IsNullOrEmpty(gCustomPassword) ? "" : gCustomPassword;
     Client_Send_AUTH(gConfigNetwork.player_name.c_str(), password, pubkey.c_str(), signature);
 }
@@ -2206,6 +3149,38 @@ void NetworkBase::Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection,
     }
 }
 
+void NetworkBase::Server_Handle_VIEWPORT(NetworkConnection& connection, NetworkPacket& packet)
+{
+    int32_t left{}, top{}, right{}, bottom{};
+    packet >> left >> top >> right >> bottom;
+    connection.InterestArea = MapRange(left, top, right, bottom).Normalise();
+}
+
+void NetworkBase::Server_Handle_REQUEST_TILE_CHECKSUMS(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t tick;
+    packet >> tick;
+
+    // The newest entry wins, ticks can repeat when a different park is loaded
+    auto it = std::find_if(_stateChecksumHistory.rbegin(), _stateChecksumHistory.rend(), [tick](const auto& entry) {
+        return entry.first == tick;
+    });
+    if (it == _stateChecksumHistory.rend())
+    {
+        log_verbose("No tile checksums kept for tick %u", tick);
+        return;
+    }
+
+    const auto& checksums = it->second;
+    NetworkPacket packetChecksums(NetworkCommand::TileChecksums);
+    packetChecksums << tick << checksums.tileRow << static_cast<uint32_t>(checksums.tileRegions.size());
+    for (auto regionHash : checksums.tileRegions)
+    {
+        packetChecksums << regionHash;
+    }
+    connection.QueuePacket(std::move(packetChecksums));
+}
+
 void NetworkBase::Server_Handle_HEARTBEAT(NetworkConnection& connection, NetworkPacket& packet)
 {
     log_verbose("Client %s heartbeat", connection.Socket->GetHostName());
@@ -2224,37 +3199,37 @@ void NetworkBase::Client_Handle_AUTH(NetworkConnection& connection, NetworkPacke
             break;
         case NetworkAuth::BadName:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_BAD_PLAYER_NAME);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NetworkAuth::BadVersion:
         {
             const char* version = packet.ReadString();
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_INCORRECT_SOFTWARE_VERSION, &version);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         }
         case NetworkAuth::BadPassword:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_BAD_PASSWORD);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NetworkAuth::VerificationFailure:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_VERIFICATION_FAILURE);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NetworkAuth::Full:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_SERVER_FULL);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         case NetworkAuth::RequirePassword:
             context_open_window_view(WV_NETWORK_PASSWORD);
             break;
         case NetworkAuth::UnknownKeyDisallowed:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_UNKNOWN_KEY_DISALLOWED);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
         default:
             connection.SetLastDisconnectReason(STR_MULTIPLAYER_RECEIVED_INVALID_DATA);
-            connection.Socket->Disconnect();
+            connection.Disconnect();
             break;
     }
 }
@@ -2270,10 +3245,7 @@ void NetworkBase::Server_Client_Joined(const char* name, const std::string& keyh
         format_string(text, 256, STR_MULTIPLAYER_PLAYER_HAS_JOINED_THE_GAME, &player_name);
         chat_history_add(text);
 
-        auto context = GetContext();
-        auto& objManager = context->GetObjectManager();
-        auto objects = objManager.GetPackableObjects();
-        Server_Send_OBJECTS_LIST(connection, objects);
+        Server_Send_OBJECTS_MANIFEST(connection);
         Server_Send_SCRIPTS(connection);
 
         // Log player joining event
@@ -2286,8 +3258,16 @@ void NetworkBase::Server_Client_Joined(const char* name, const std::string& keyh
     }
 }
 
-void NetworkBase::Server_Handle_TOKEN(NetworkConnection& connection, [[maybe_unused]] NetworkPacket& packet)
+void NetworkBase::Server_Handle_TOKEN(NetworkConnection& connection, NetworkPacket& packet)
 {
+    // The client can read compressed packets from here on if it offers compression, including the token itself
+    auto compression = NetworkCompression::None;
+    packet >> compression;
+    if (compression == NetworkCompression::Deflate && gConfigNetwork.compress_traffic)
+    {
+        connection.EnableCompression();
+    }
+
     uint8_t token_size = 10 + (rand() & 0x7f);
     connection.Challenge.resize(token_size);
     for (int32_t i = 0; i < token_size; i++)
@@ -2297,6 +3277,38 @@ void NetworkBase::Server_Handle_TOKEN(NetworkConnection& connection, [[maybe_unu
     Server_Send_TOKEN(connection);
 }
 
+void NetworkBase::Client_Handle_OBJECTS_MANIFEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t totalObjects = 0;
+    packet >> totalObjects;
+    Crypt::Sha1Algorithm::Result manifest;
+    const auto* data = packet.Read(manifest.size());
+    if (data == nullptr)
+    {
+        connection.SetLastDisconnectReason(STR_MULTIPLAYER_RECEIVED_INVALID_DATA);
+        connection.Disconnect();
+        return;
+    }
+    std::memcpy(manifest.data(), data, manifest.size());
+
+    _missingObjects.clear();
+    _objectsBuffer.clear();
+    _mapAwaitingObjects.reset();
+    if (totalObjects == 0 || _knownObjectManifests.count(manifest) != 0)
+    {
+        log_verbose("client already has the %u objects of the server", totalObjects);
+        _pendingObjectManifest.reset();
+    }
+    else
+    {
+        // The list is asked for along with the map, so the objects missing from it are downloaded while the map is
+        // still coming in rather than being packed into it
+        _pendingObjectManifest = manifest;
+        connection.QueuePacket(NetworkPacket(NetworkCommand::ObjectsListRequest));
+    }
+    Client_Send_MAPREQUEST({});
+}
+
 void NetworkBase::Client_Handle_OBJECTS_LIST(NetworkConnection& connection, NetworkPacket& packet)
 {
     auto& repo = GetContext()->GetObjectRepository();
@@ -2314,24 +3326,30 @@ void NetworkBase::Client_Handle_OBJECTS_LIST(NetworkConnection& connection, Netw
     if (totalObjects > OBJECT_ENTRY_COUNT)
     {
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_SERVER_INVALID_REQUEST);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         log_warning("Server sent invalid amount of objects");
         return;
     }
 
     if (totalObjects > 0)
     {
-        char objectListMsg[256];
-        const uint32_t args[] = {
-            index + 1,
-            totalObjects,
-        };
-        format_string(objectListMsg, 256, STR_MULTIPLAYER_RECEIVING_OBJECTS_LIST, &args);
-
-        auto intent = Intent(WC_NETWORK_STATUS);
-        intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ objectListMsg });
-        intent.putExtra(INTENT_EXTRA_CALLBACK, []() -> void { gNetwork.Close(); });
-        context_open_intent(&intent);
+        // The whole list usually arrives within a single update, so reopening the status window for every object of a
+        // park with thousands of custom objects only slows the join down
+        static constexpr uint32_t OBJECTS_PER_STATUS_UPDATE = 64;
+        if (index % OBJECTS_PER_STATUS_UPDATE == 0 || index + 1 == totalObjects)
+        {
+            char objectListMsg[256];
+            const uint32_t args[] = {
+                index + 1,
+                totalObjects,
+            };
+            format_string(objectListMsg, 256, STR_MULTIPLAYER_RECEIVING_OBJECTS_LIST, &args);
+
+            auto intent = Intent(WC_NETWORK_STATUS);
+            intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ objectListMsg });
+            intent.putExtra(INTENT_EXTRA_CALLBACK, []() -> void { gNetwork.Close(); });
+            context_open_intent(&intent);
+        }
 
         char objectName[12]{};
         std::memcpy(objectName, packet.Read(8), 8);
@@ -2340,27 +3358,97 @@ void NetworkBase::Client_Handle_OBJECTS_LIST(NetworkConnection& connection, Netw
         uint32_t flags = 0;
         packet >> checksum >> flags;
 
-        const auto* object = repo.FindObjectLegacy(objectName);
-        // This could potentially request the object if checksums don't match, but since client
-        // won't replace its version with server-provided one, we don't do that.
-        if (object == nullptr)
-        {
-            log_verbose("Requesting object %s with checksum %x from server", objectName, checksum);
-            _missingObjects.push_back(objectName);
-        }
-        else if (object->ObjectEntry.checksum != checksum || object->ObjectEntry.flags != flags)
+        const auto* object = repo.FindObjectLegacy(objectName);
+        // This could potentially request the object if checksums don't match, but since client
+        // won't replace its version with server-provided one, we don't do that.
+        if (object == nullptr)
+        {
+            log_verbose("Requesting object %s with checksum %x from server", objectName, checksum);
+            _missingObjects.push_back(objectName);
+        }
+        else if (object->ObjectEntry.checksum != checksum || object->ObjectEntry.flags != flags)
+        {
+            log_warning(
+                "Object %s has different checksum/flags (%x/%x) than server (%x/%x).", objectName, object->ObjectEntry.checksum,
+                object->ObjectEntry.flags, checksum, flags);
+        }
+    }
+
+    if (index + 1 >= totalObjects)
+    {
+        log_verbose("client received object list, it has %u entries", totalObjects);
+        if (_missingObjects.empty())
+        {
+            Client_ObjectsReceived();
+        }
+        else
+        {
+            Client_Send_OBJECTS_REQUEST(_missingObjects);
+        }
+        _missingObjects.clear();
+    }
+}
+
+void NetworkBase::Client_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t size = 0;
+    uint32_t offset = 0;
+    packet >> size >> offset;
+    const size_t chunksize = packet.Header.Size - packet.BytesRead;
+    if (offset == 0)
+    {
+        _objectsBuffer.clear();
+    }
+    if (offset != _objectsBuffer.size() || offset + chunksize > size)
+    {
+        connection.SetLastDisconnectReason(STR_MULTIPLAYER_RECEIVED_INVALID_DATA);
+        connection.Disconnect();
+        log_warning("Server sent objects out of order");
+        return;
+    }
+    if (chunksize > 0)
+    {
+        const auto* data = packet.Read(chunksize);
+        _objectsBuffer.insert(_objectsBuffer.end(), data, data + chunksize);
+    }
+    if (_objectsBuffer.size() < size)
+    {
+        return;
+    }
+
+    auto& repo = GetContext()->GetObjectRepository();
+    auto ms = MemoryStream(_objectsBuffer.data(), _objectsBuffer.size());
+    try
+    {
+        while (ms.GetPosition() < ms.GetLength())
         {
-            log_warning(
-                "Object %s has different checksum/flags (%x/%x) than server (%x/%x).", objectName, object->ObjectEntry.checksum,
-                object->ObjectEntry.flags, checksum, flags);
+            repo.ExportPackedObject(&ms);
         }
     }
+    catch (const std::exception& e)
+    {
+        log_warning("Failed to read the objects sent by the server: %s", e.what());
+    }
+    _objectsBuffer.clear();
+    _objectsBuffer.shrink_to_fit();
+    Client_ObjectsReceived();
+}
 
-    if (index + 1 >= totalObjects)
+/**
+ * Called once the client has all the objects of the server, loads the map if it came in first.
+ */
+void NetworkBase::Client_ObjectsReceived()
+{
+    if (_pendingObjectManifest.has_value())
     {
-        log_verbose("client received object list, it has %u entries", totalObjects);
-        Client_Send_MAPREQUEST(_missingObjects);
-        _missingObjects.clear();
+        _knownObjectManifests.insert(*_pendingObjectManifest);
+        _pendingObjectManifest.reset();
+    }
+    if (_mapAwaitingObjects.has_value())
+    {
+        auto size = *_mapAwaitingObjects;
+        _mapAwaitingObjects.reset();
+        Client_LoadReceivedMap(size);
     }
 }
 
@@ -2424,7 +3512,11 @@ void NetworkBase::Client_Handle_GAMESTATE(NetworkConnection& connection, Network
         const GameStateSnapshot_t* desyncSnapshot = snapshots->GetLinkedSnapshot(tick);
         if (desyncSnapshot)
         {
-            GameStateCompareData_t cmpData = snapshots->Compare(serverSnapshot, *desyncSnapshot);
+            if (_desyncReport.valid())
+            {
+                log_warning("Desync report for tick %u skipped, the previous report is still being written.", tick);
+                return;
+            }
 
             std::string outputPath = GetContext()->GetPlatformEnvironment()->GetDirectoryPath(
                 DIRBASE::USER, DIRID::LOG_DESYNCS);
@@ -2438,32 +3530,115 @@ void NetworkBase::Client_Handle_GAMESTATE(NetworkConnection& connection, Network
 
             std::string outputFile = Path::Combine(outputPath, uniqueFileName);
 
-            if (snapshots->LogCompareDataToFile(outputFile, cmpData))
-            {
-                log_info("Wrote desync report to '%s'", outputFile.c_str());
+            // Comparing a full park takes long enough to stall the game, the result is picked up in Update
+            _desyncReport = snapshots->CompareAndLogToFileAsync(serverSnapshot, *desyncSnapshot, outputFile);
+            _desyncReportFileName = uniqueFileName;
+        }
+    }
+}
 
-                auto ft = Formatter();
-                ft.Add<char*>(uniqueFileName);
+void NetworkBase::Client_Handle_TILE_CHECKSUMS([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t tick;
+    uint32_t tileRow;
+    uint32_t numRegions;
+    packet >> tick >> tileRow >> numRegions;
 
-                char str_desync[1024];
-                format_string(str_desync, sizeof(str_desync), STR_DESYNC_REPORT, ft.Data());
+    if (!_desyncTileChecksums.has_value() || _desyncTileChecksums->first != tick)
+        return;
 
-                auto intent = Intent(WC_NETWORK_STATUS);
-                intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ str_desync });
-                context_open_intent(&intent);
-            }
+    const auto& clientChecksums = _desyncTileChecksums->second;
+    if (clientChecksums.tileRow != tileRow || clientChecksums.tileRegions.size() != numRegions)
+    {
+        log_warning("Tile checksums for tick %u cover a different part of the map, the map size differs", tick);
+        return;
+    }
+
+    for (uint32_t i = 0; i < numRegions; i++)
+    {
+        uint64_t serverRegionHash;
+        packet >> serverRegionHash;
+        if (serverRegionHash != clientChecksums.tileRegions[i])
+        {
+            constexpr auto regionSize = static_cast<int32_t>(NetworkChecksumRegionSize);
+            auto origin = network_get_checksum_region_origin(tileRow, i);
+            log_warning(
+                "Tile elements out of sync at tick %u in tiles %d, %d to %d, %d", tick, origin.x, origin.y,
+                origin.x + regionSize - 1, origin.y + regionSize - 1);
         }
     }
+    _desyncTileChecksums.reset();
+}
+
+void NetworkBase::ProcessDesyncReport()
+{
+    if (!_desyncReport.valid() || _desyncReport.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+        return;
+
+    if (!_desyncReport.get())
+        return;
+
+    log_info("Wrote desync report to '%s'", _desyncReportFileName.c_str());
+
+    auto ft = Formatter();
+    ft.Add<const char*>(_desyncReportFileName.c_str());
+
+    char str_desync[1024];
+    format_string(str_desync, sizeof(str_desync), STR_DESYNC_REPORT, ft.Data());
+
+    auto intent = Intent(WC_NETWORK_STATUS);
+    intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ str_desync });
+    context_open_intent(&intent);
 }
 
 void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    if (!Server_Read_MAPREQUEST(connection, packet))
+        return;
+
+    // A client failing over adds the tick it is on and its random state
+    bool resumed = false;
+    if (IsStandby() && packet.Header.Size - packet.BytesRead >= 2 * sizeof(uint32_t))
+    {
+        uint32_t tick, srand0;
+        packet >> tick >> srand0;
+        resumed = Standby_CanResume(tick, srand0);
+        if (resumed)
+        {
+            Standby_Send_RESUME(connection, tick);
+        }
+    }
+
+    const char* player_name = static_cast<const char*>(connection.Player->Name.c_str());
+    if (!resumed)
+    {
+        Server_Send_MAP(&connection);
+    }
+    Server_Send_EVENT_PLAYER_JOINED(player_name);
+    Server_Send_GROUPLIST(connection);
+}
+
+/**
+ * Reads the objects a joining client is missing into the connection. Returns false and disconnects the client if the
+ * request is invalid.
+ */
+bool NetworkBase::Server_Read_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    return Server_Read_REQUESTED_OBJECTS(connection, packet, connection.RequestedObjects);
+}
+
+/**
+ * Reads a list of object names a client asked for. Returns false and disconnects the client if the request is invalid.
+ */
+bool NetworkBase::Server_Read_REQUESTED_OBJECTS(
+    NetworkConnection& connection, NetworkPacket& packet, std::vector<const ObjectRepositoryItem*>& objects)
 {
     uint32_t size;
     packet >> size;
     if (size > OBJECT_ENTRY_COUNT)
     {
         connection.SetLastDisconnectReason(STR_MULTIPLAYER_CLIENT_INVALID_REQUEST);
-        connection.Socket->Disconnect();
+        connection.Disconnect();
         std::string playerName = "(unknown)";
         if (connection.Player)
         {
@@ -2472,7 +3647,7 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
         std::string text = std::string("Player ") + playerName + std::string(" requested invalid amount of objects");
         AppendServerLog(text);
         log_warning(text.c_str());
-        return;
+        return false;
     }
     log_verbose("Client requested %u objects", size);
     auto& repo = GetContext()->GetObjectRepository();
@@ -2489,128 +3664,188 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
         }
         else
         {
-            connection.RequestedObjects.push_back(item);
+            objects.push_back(item);
         }
     }
+    return true;
+}
 
-    const char* player_name = static_cast<const char*>(connection.Player->Name.c_str());
-    Server_Send_MAP(&connection);
-    Server_Send_EVENT_PLAYER_JOINED(player_name);
-    Server_Send_GROUPLIST(connection);
+void NetworkBase::Server_Handle_OBJECTS_LIST_REQUEST(
+    NetworkConnection& connection, [[maybe_unused]] NetworkPacket& packet)
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    Server_Send_OBJECTS_LIST(connection, objManager.GetPackableObjects());
 }
 
-void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet)
+void NetworkBase::Server_Handle_OBJECTS_REQUEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    std::vector<const ObjectRepositoryItem*> objects;
+    if (Server_Read_REQUESTED_OBJECTS(connection, packet, objects))
+    {
+        Server_Send_OBJECTS(connection, objects);
+    }
+}
+
+static std::optional<std::string> ReadOptionalString(NetworkPacket& packet)
+{
+    const char* str = packet.ReadString();
+    return str != nullptr ? std::optional<std::string>(str) : std::nullopt;
+}
+
+/**
+ * Runs on a worker thread, must only touch the pending auth.
+ */
+static void VerifyAuthSignature(NetworkPendingAuth& auth)
 {
-    if (connection.AuthStatus != NetworkAuth::Ok)
+    if (!auth.PublicKey.has_value())
+        return;
+
+    try
     {
-        const char* gameversion = packet.ReadString();
-        const char* name = packet.ReadString();
-        const char* password = packet.ReadString();
-        const char* pubkey = packet.ReadString();
-        uint32_t sigsize;
-        packet >> sigsize;
-        if (pubkey == nullptr)
+        auto ms = MemoryStream(auth.PublicKey->data(), auth.PublicKey->size());
+        if (auth.Key.LoadPublic(&ms))
         {
-            connection.AuthStatus = NetworkAuth::VerificationFailure;
+            auth.Verified = auth.Key.Verify(auth.Challenge.data(), auth.Challenge.size(), auth.Signature);
         }
-        else
-        {
-            try
-            {
-                std::vector<uint8_t> signature;
-                signature.resize(sigsize);
+    }
+    catch (const std::exception&)
+    {
+        auth.Verified = false;
+    }
+}
 
-                const uint8_t* signatureData = packet.Read(sigsize);
-                if (signatureData == nullptr)
-                {
-                    throw std::runtime_error("Failed to read packet.");
-                }
+void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet)
+{
+    // Further attempts are ignored until the signature of the last one has been verified
+    if (connection.AuthStatus == NetworkAuth::Ok || connection.PendingAuthId != 0)
+        return;
 
-                std::memcpy(signature.data(), signatureData, sigsize);
+    auto auth = std::make_unique<NetworkPendingAuth>();
+    auth->GameVersion = ReadOptionalString(packet);
+    auth->Name = ReadOptionalString(packet);
+    auth->Password = ReadOptionalString(packet);
+    auth->PublicKey = ReadOptionalString(packet);
+    uint32_t sigsize;
+    packet >> sigsize;
+    const uint8_t* signatureData = packet.Read(sigsize);
+    if (signatureData == nullptr)
+    {
+        log_verbose("Signature verification failed, invalid data!");
+        auth->PublicKey.reset();
+    }
+    else
+    {
+        auth->Signature.assign(signatureData, signatureData + sigsize);
+    }
+    auth->Challenge = connection.Challenge;
 
-                auto ms = MemoryStream(pubkey, strlen(pubkey));
-                if (!connection.Key.LoadPublic(&ms))
-                {
-                    throw std::runtime_error("Failed to load public key.");
-                }
+    // Zero is left for connections without an auth in progress
+    if (++_nextAuthId == 0)
+        _nextAuthId++;
+    auth->Id = _nextAuthId;
+    connection.PendingAuthId = auth->Id;
 
-                bool verified = connection.Key.Verify(connection.Challenge.data(), connection.Challenge.size(), signature);
-                const std::string hash = connection.Key.PublicKeyHash();
-                if (verified)
-                {
-                    log_verbose("Signature verification ok. Hash %s", hash.c_str());
-                    if (gConfigNetwork.known_keys_only && _userManager.GetUserByHash(hash) == nullptr)
-                    {
-                        log_verbose("Hash %s, not known", hash.c_str());
-                        connection.AuthStatus = NetworkAuth::UnknownKeyDisallowed;
-                    }
-                    else
-                    {
-                        connection.AuthStatus = NetworkAuth::Verified;
-                    }
-                }
-                else
-                {
-                    connection.AuthStatus = NetworkAuth::VerificationFailure;
-                    log_verbose("Signature verification failed!");
-                }
-            }
-            catch (const std::exception&)
-            {
-                connection.AuthStatus = NetworkAuth::VerificationFailure;
-                log_verbose("Signature verification failed, invalid data!");
-            }
-        }
+    _authJobs.AddTask([this, auth = std::move(auth)]() mutable {
+        VerifyAuthSignature(*auth);
+        std::lock_guard<std::mutex> lock(_completedAuthsMutex);
+        _completedAuths.push_back(std::move(auth));
+    });
+}
+
+void NetworkBase::ProcessCompletedAuths()
+{
+    std::deque<std::unique_ptr<NetworkPendingAuth>> completedAuths;
+    {
+        std::lock_guard<std::mutex> lock(_completedAuthsMutex);
+        completedAuths.swap(_completedAuths);
+    }
+
+    for (auto& auth : completedAuths)
+    {
+        auto it = std::find_if(client_connection_list.begin(), client_connection_list.end(), [&auth](const auto& connection) {
+            return connection->PendingAuthId == auth->Id;
+        });
+        // The client may have left while it was being verified
+        if (it == client_connection_list.end() || (*it)->IsDisconnected)
+            continue;
 
-        bool passwordless = false;
-        if (connection.AuthStatus == NetworkAuth::Verified)
+        auto& connection = **it;
+        connection.PendingAuthId = 0;
+        connection.Key = std::move(auth->Key);
+        Server_Complete_AUTH(connection, *auth);
+    }
+}
+
+void NetworkBase::Server_Complete_AUTH(NetworkConnection& connection, const NetworkPendingAuth& auth)
+{
+    if (auth.Verified)
+    {
+        const std::string hash = connection.Key.PublicKeyHash();
+        log_verbose("Signature verification ok. Hash %s", hash.c_str());
+        if (gConfigNetwork.known_keys_only && _userManager.GetUserByHash(hash) == nullptr)
         {
-            const NetworkGroup* group = GetGroupByID(GetGroupIDByHash(connection.Key.PublicKeyHash()));
-            passwordless = group->CanPerformCommand(MISC_COMMAND_PASSWORDLESS_LOGIN);
+            log_verbose("Hash %s, not known", hash.c_str());
+            connection.AuthStatus = NetworkAuth::UnknownKeyDisallowed;
         }
-        if (!gameversion || network_get_version() != gameversion)
+        else
         {
-            connection.AuthStatus = NetworkAuth::BadVersion;
+            connection.AuthStatus = NetworkAuth::Verified;
         }
-        else if (!name)
+    }
+    else
+    {
+        connection.AuthStatus = NetworkAuth::VerificationFailure;
+        log_verbose("Signature verification failed!");
+    }
+
+    bool passwordless = false;
+    if (connection.AuthStatus == NetworkAuth::Verified)
+    {
+        const NetworkGroup* group = GetGroupByID(GetGroupIDByHash(connection.Key.PublicKeyHash()));
+        passwordless = group->CanPerformCommand(MISC_COMMAND_PASSWORDLESS_LOGIN);
+    }
+    if (!auth.GameVersion.has_value() || network_get_version() != *auth.GameVersion)
+    {
+        connection.AuthStatus = NetworkAuth::BadVersion;
+    }
+    else if (!auth.Name.has_value())
+    {
+        connection.AuthStatus = NetworkAuth::BadName;
+    }
+    else if (!passwordless)
+    {
+        if ((!auth.Password.has_value() || auth.Password->empty()) && !_password.empty())
         {
-            connection.AuthStatus = NetworkAuth::BadName;
+            connection.AuthStatus = NetworkAuth::RequirePassword;
         }
-        else if (!passwordless)
+        else if (auth.Password.has_value() && _password != *auth.Password)
         {
-            if ((!password || strlen(password) == 0) && !_password.empty())
-            {
-                connection.AuthStatus = NetworkAuth::RequirePassword;
-            }
-            else if (password && _password != password)
-            {
-                connection.AuthStatus = NetworkAuth::BadPassword;
-            }
+            connection.AuthStatus = NetworkAuth::BadPassword;
         }
+    }
 
-        if (static_cast<size_t>(gConfigNetwork.maxplayers) <= player_list.size())
-        {
-            connection.AuthStatus = NetworkAuth::Full;
-        }
-        else if (connection.AuthStatus == NetworkAuth::Verified)
+    if (static_cast<size_t>(gConfigNetwork.maxplayers) <= player_list.size())
+    {
+        connection.AuthStatus = NetworkAuth::Full;
+    }
+    else if (connection.AuthStatus == NetworkAuth::Verified)
+    {
+        const std::string hash = connection.Key.PublicKeyHash();
+        if (ProcessPlayerAuthenticatePluginHooks(connection, *auth.Name, hash))
         {
-            const std::string hash = connection.Key.PublicKeyHash();
-            if (ProcessPlayerAuthenticatePluginHooks(connection, name, hash))
-            {
-                connection.AuthStatus = NetworkAuth::Ok;
-                Server_Client_Joined(name, hash, connection);
-            }
-            else
-            {
-                connection.AuthStatus = NetworkAuth::VerificationFailure;
-            }
+            connection.AuthStatus = NetworkAuth::Ok;
+            Server_Client_Joined(auth.Name->c_str(), hash, connection);
         }
-        else if (connection.AuthStatus != NetworkAuth::RequirePassword)
+        else
         {
-            log_error("Unknown failure (%d) while authenticating client", connection.AuthStatus);
+            connection.AuthStatus = NetworkAuth::VerificationFailure;
         }
-        Server_Send_AUTH(connection);
     }
+    else if (connection.AuthStatus != NetworkAuth::RequirePassword)
+    {
+        log_error("Unknown failure (%d) while authenticating client", connection.AuthStatus);
+    }
+    Server_Send_AUTH(connection);
 }
 
 void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
@@ -2631,6 +3866,7 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
 
         _serverTickData.clear();
         _clientMapLoaded = false;
+        _resumeOnConnect = false;
     }
     if (size > chunk_buffer.size())
     {
@@ -2649,69 +3885,137 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
     context_open_intent(&intent);
 
     std::memcpy(&chunk_buffer[offset], const_cast<void*>(static_cast<const void*>(packet.Read(chunksize))), chunksize);
+
+    // Inflate each chunk as it arrives rather than the whole map once the last one is in
+    const size_t header_len = strlen("open2_sv6_zlib") + 1;
+    if (offset == 0)
+    {
+        _mapInflater.reset();
+        if (static_cast<size_t>(chunksize) >= header_len
+            && strcmp("open2_sv6_zlib", reinterpret_cast<char*>(&chunk_buffer[0])) == 0)
+        {
+            _mapInflater = std::make_unique<ZlibInflater>();
+            _mapInflaterOffset = header_len;
+        }
+    }
+    if (_mapInflater != nullptr)
+    {
+        const size_t end = offset + chunksize;
+        if (offset > _mapInflaterOffset || !_mapInflater->Write(&chunk_buffer[_mapInflaterOffset], end - _mapInflaterOffset))
+        {
+            // Chunks out of order or bad data, leave it to a full inflate once everything is in
+            _mapInflater.reset();
+        }
+        else
+        {
+            _mapInflaterOffset = end;
+        }
+    }
+
     if (offset + chunksize == size)
     {
-        // Allow queue processing of game actions again.
-        GameActions::ResumeQueue();
+        if (_pendingObjectManifest.has_value())
+        {
+            // The objects the map needs are still being downloaded, it is loaded once they are in
+            _mapAwaitingObjects = size;
+            return;
+        }
+        Client_LoadReceivedMap(size);
+    }
+}
+
+void NetworkBase::Client_LoadReceivedMap(uint32_t size)
+{
+    const size_t header_len = strlen("open2_sv6_zlib") + 1;
+
+    // Allow queue processing of game actions again.
+    GameActions::ResumeQueue();
 
-        context_force_close_window_by_class(WC_NETWORK_STATUS);
-        bool has_to_free = false;
-        uint8_t* data = &chunk_buffer[0];
-        size_t data_size = size;
-        // zlib-compressed
-        if (strcmp("open2_sv6_zlib", reinterpret_cast<char*>(&chunk_buffer[0])) == 0)
+    context_force_close_window_by_class(WC_NETWORK_STATUS);
+    bool has_to_free = false;
+    uint8_t* data = &chunk_buffer[0];
+    size_t data_size = size;
+    std::vector<uint8_t> inflated;
+    // zlib-compressed
+    if (strcmp("open2_sv6_zlib", reinterpret_cast<char*>(&chunk_buffer[0])) == 0)
+    {
+        log_verbose("Received zlib-compressed sv6 map");
+        if (_mapInflater != nullptr && _mapInflater->IsFinished())
+        {
+            inflated = _mapInflater->TakeOutput();
+            data = inflated.data();
+            data_size = inflated.size();
+        }
+        else
         {
-            log_verbose("Received zlib-compressed sv6 map");
             has_to_free = true;
-            size_t header_len = strlen("open2_sv6_zlib") + 1;
             data = util_zlib_inflate(&chunk_buffer[header_len], size - header_len, &data_size);
             if (data == nullptr)
             {
                 log_warning("Failed to decompress data sent from server.");
+                _mapInflater.reset();
                 Close();
                 return;
             }
         }
-        else
-        {
-            log_verbose("Assuming received map is in plain sv6 format");
-        }
+    }
+    else
+    {
+        log_verbose("Assuming received map is in plain sv6 format");
+    }
+    _mapInflater.reset();
 
-        auto ms = MemoryStream(data, data_size);
-        if (LoadMap(&ms))
-        {
-            game_load_init();
-            game_load_scripts();
-            _serverState.tick = gCurrentTicks;
-            // window_network_status_open("Loaded new map from network");
-            _serverState.state = NetworkServerState::Ok;
-            _clientMapLoaded = true;
-            gFirstTimeSaving = true;
+    auto ms = MemoryStream(data, data_size);
+    if (LoadMap(&ms))
+    {
+        game_load_init();
+        game_load_scripts();
+        _serverState.tick = gCurrentTicks;
+        // window_network_status_open("Loaded new map from network");
+        _serverState.state = NetworkServerState::Ok;
+        _clientMapLoaded = true;
+        gFirstTimeSaving = true;
 
-            // Notify user he is now online and which shortcut key enables chat
-            network_chat_show_connected_message();
+        // Notify user he is now online and which shortcut key enables chat
+        network_chat_show_connected_message();
 
-            // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
-            fix_invalid_vehicle_sprite_sizes();
+        // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
+        fix_invalid_vehicle_sprite_sizes();
 
-            // NOTE: Game actions are normally processed before processing the player list.
-            // Given that during map load game actions are buffered we have to process the
-            // player list first to have valid players for the queued game actions.
-            ProcessPlayerList();
-        }
-        else
-        {
-            // Something went wrong, game is not loaded. Return to main screen.
-            auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
-            GameActions::Execute(&loadOrQuitAction);
-        }
-        if (has_to_free)
-        {
-            free(data);
-        }
+        // NOTE: Game actions are normally processed before processing the player list.
+        // Given that during map load game actions are buffered we have to process the
+        // player list first to have valid players for the queued game actions.
+        ProcessPlayerList();
+    }
+    else
+    {
+        // Something went wrong, game is not loaded. Return to main screen.
+        // An object may have gone missing since a manifest was remembered, the next join goes through the list again
+        _knownObjectManifests.clear();
+        auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
+        GameActions::Execute(&loadOrQuitAction);
+    }
+    if (has_to_free)
+    {
+        free(data);
     }
 }
 
+void NetworkBase::Client_Handle_RESUME([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t tick;
+    packet >> tick;
+    log_info("Resuming from tick %u", tick);
+
+    // The park is still loaded, the ticks and game actions since follow
+    _resumeOnConnect = false;
+    _clientMapLoaded = true;
+    _serverState.state = NetworkServerState::Ok;
+    GameActions::ResumeQueue();
+    context_force_close_window_by_class(WC_NETWORK_STATUS);
+    network_chat_show_connected_message();
+}
+
 bool NetworkBase::LoadMap(IStream* stream)
 {
     bool result = false;
@@ -2892,6 +4196,10 @@ void NetworkBase::Server_Handle_CHAT(NetworkConnection& connection, NetworkPacke
 
 void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
 {
+    // Replayed by the standby once it accepts the resume
+    if (_resumeOnConnect)
+        return;
+
     uint32_t tick;
     uint32_t actionType;
     packet >> tick >> actionType;
@@ -2923,7 +4231,7 @@ void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection&
         }
     }
 
-    GameActions::Enqueue(std::move(action), tick);
+    GameActions::EnqueueConcurrent(std::move(action), tick);
 }
 
 void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet)
@@ -2995,11 +4303,15 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
     // Set player to sender, should be 0 if sent from client.
     ga->SetPlayer(NetworkPlayerId_t{ connection.Player->Id });
 
-    GameActions::Enqueue(std::move(ga), tick);
+    GameActions::EnqueueConcurrent(std::move(ga), tick);
 }
 
 void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
 {
+    // Replayed by the standby once it accepts the resume
+    if (_resumeOnConnect)
+        return;
+
     uint32_t srand0;
     uint32_t flags;
     uint32_t serverTick;
@@ -3018,6 +4330,12 @@ void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connect
             tickData.spriteHash = text;
         }
     }
+    if (flags & NETWORK_TICK_FLAG_STATE_CHECKSUMS)
+    {
+        NetworkStateChecksums_t checksums;
+        packet >> checksums.tileRow >> checksums.tileElements >> checksums.rides >> checksums.finances;
+        tickData.stateChecksums = checksums;
+    }
 
     // Don't let the history grow too much.
     while (_serverTickData.size() >= 100)
@@ -3070,6 +4388,7 @@ void NetworkBase::Server_Handle_PING(NetworkConnection& connection, [[maybe_unus
     {
         ping = 0;
     }
+    connection.AddPing(static_cast<uint32_t>(ping));
     if (connection.Player)
     {
         connection.Player->Ping = ping;
@@ -3097,6 +4416,10 @@ void NetworkBase::Client_Handle_PINGLIST([[maybe_unused]] NetworkConnection& con
 
 void NetworkBase::Client_Handle_SETDISCONNECTMSG(NetworkConnection& connection, NetworkPacket& packet)
 {
+    // Told to leave, so not one to fail over from or to take over from
+    _failoverPort = 0;
+    _standbyPort = 0;
+
     static std::string msg;
     const char* disconnectmsg = packet.ReadString();
     if (disconnectmsg)
@@ -3192,6 +4515,10 @@ void NetworkBase::Client_Handle_GAMEINFO([[maybe_unused]] NetworkConnection& con
             ServerProviderEmail = Json::GetString(jsonProvider["email"]);
             ServerProviderWebsite = Json::GetString(jsonProvider["website"]);
         }
+
+        json_t jsonFailover = jsonData["failover"];
+        _failoverHost = jsonFailover.is_object() ? Json::GetString(jsonFailover["host"]) : std::string();
+        _failoverPort = jsonFailover.is_object() ? Json::GetNumber<uint16_t>(jsonFailover["port"]) : 0;
     }
 
     network_chat_show_server_greeting();
@@ -3227,6 +4554,16 @@ int32_t network_begin_server(int32_t port, const std::string& address)
     return gNetwork.BeginServer(port, address);
 }
 
+int32_t network_begin_relay(const std::string& host, int32_t port, int32_t relayPort, const std::string& relayAddress)
+{
+    return gNetwork.BeginRelay(host, port, relayPort, relayAddress);
+}
+
+int32_t network_begin_standby(const std::string& host, int32_t port, int32_t standbyPort, const std::string& standbyAddress)
+{
+    return gNetwork.BeginStandby(host, port, standbyPort, standbyAddress);
+}
+
 void network_update()
 {
     gNetwork.Update();
@@ -3973,6 +5310,11 @@ json_t network_get_server_info_as_json()
 {
     return gNetwork.GetServerInfoAsJson();
 }
+
+json_t network_get_stats_as_json()
+{
+    return gNetwork.GetStatsAsJson();
+}
 #else
 int32_t network_get_mode()
 {
@@ -4031,6 +5373,14 @@ int32_t network_begin_server(int32_t port, const std::string& address)
 {
     return 1;
 }
+int32_t network_begin_relay(const std::string& host, int32_t port, int32_t relayPort, const std::string& relayAddress)
+{
+    return 1;
+}
+int32_t network_begin_standby(const std::string& host, int32_t port, int32_t standbyPort, const std::string& standbyAddress)
+{
+    return 1;
+}
 int32_t network_get_num_players()
 {
     return 1;
@@ -4238,4 +5588,8 @@ json_t network_get_server_info_as_json()
 {
     return {};
 }
+json_t network_get_stats_as_json()
+{
+    return {};
+}
 #endif /* DISABLE_NETWORK */
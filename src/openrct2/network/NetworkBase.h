@@ -1,17 +1,43 @@
 #pragma once
 
 #include "../actions/GameAction.h"
+#include "../core/Crypt.h"
+#include "../core/JobPool.h"
+#include "../util/Util.h"
+#include "NetworkChecksums.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkIoThread.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
 #include "NetworkUser.h"
 
+#include <deque>
 #include <fstream>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <set>
 
 #ifndef DISABLE_NETWORK
 
+// The auth packet of a joining client, while its signature is verified on a worker thread
+struct NetworkPendingAuth
+{
+    uint32_t Id{};
+    std::optional<std::string> GameVersion;
+    std::optional<std::string> Name;
+    std::optional<std::string> Password;
+    std::optional<std::string> PublicKey;
+    std::vector<uint8_t> Signature;
+    std::vector<uint8_t> Challenge;
+
+    // Results of the verification
+    NetworkKey Key;
+    bool Verified{};
+};
+
 class NetworkBase
 {
 public:
@@ -20,6 +46,8 @@ public:
 public: // Uncategorized
     bool BeginServer(uint16_t port, const std::string& address);
     bool BeginClient(const std::string& host, uint16_t port);
+    bool BeginRelay(const std::string& host, uint16_t port, uint16_t relayPort, const std::string& relayAddress);
+    bool BeginStandby(const std::string& host, uint16_t port, uint16_t standbyPort, const std::string& standbyAddress);
 
 public: // Common
     void SetEnvironment(const std::shared_ptr<OpenRCT2::IPlatformEnvironment>& env);
@@ -43,7 +71,9 @@ public: // Common
     void CloseChatLog();
     NetworkStats_t GetStats() const;
     json_t GetServerInfoAsJson() const;
+    json_t GetStatsAsJson() const;
     bool ProcessConnection(NetworkConnection& connection);
+    bool ProcessReceivedPackets(NetworkConnection& connection);
     void CloseConnection();
     NetworkPlayer* AddPlayer(const std::string& name, const std::string& keyhash);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
@@ -81,21 +111,30 @@ public: // Server
     void Server_Send_TICK();
     void Server_Send_PLAYERINFO(int32_t playerId);
     void Server_Send_PLAYERLIST();
+    void Server_Send_PLAYERLIST(NetworkConnection& connection, uint32_t tick);
     void Server_Send_PING();
     void Server_Send_PINGLIST();
+    bool IsPlayerOfInterest(const NetworkConnection& connection, const NetworkPlayer& player) const;
     void Server_Send_SETDISCONNECTMSG(NetworkConnection& connection, const char* msg);
     void Server_Send_GAMEINFO(NetworkConnection& connection);
     void Server_Send_SHOWERROR(NetworkConnection& connection, rct_string_id title, rct_string_id message);
     void Server_Send_GROUPLIST(NetworkConnection& connection);
     void Server_Send_EVENT_PLAYER_JOINED(const char* playerName);
     void Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName, const char* reason);
+    void Server_Send_OBJECTS_MANIFEST(NetworkConnection& connection);
     void Server_Send_OBJECTS_LIST(NetworkConnection& connection, const std::vector<const ObjectRepositoryItem*>& objects) const;
+    void Server_Send_OBJECTS(NetworkConnection& connection, std::vector<const ObjectRepositoryItem*>& objects) const;
     void Server_Send_SCRIPTS(NetworkConnection& connection) const;
 
     // Handlers
     void Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Handle_REQUEST_TILE_CHECKSUMS(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_HEARTBEAT(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Handle_VIEWPORT(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Complete_AUTH(NetworkConnection& connection, const NetworkPendingAuth& auth);
+    void ProcessCompletedAuths();
+    size_t CountPendingHandshakes() const;
     void Server_Client_Joined(const char* name, const std::string& keyhash, NetworkConnection& connection);
     void Server_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
@@ -103,6 +142,26 @@ public: // Server
     void Server_Handle_GAMEINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_TOKEN(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet);
+    bool Server_Read_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet);
+    bool Server_Read_REQUESTED_OBJECTS(
+        NetworkConnection& connection, NetworkPacket& packet, std::vector<const ObjectRepositoryItem*>& objects);
+    void Server_Handle_OBJECTS_LIST_REQUEST(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Handle_OBJECTS_REQUEST(NetworkConnection& connection, NetworkPacket& packet);
+
+public: // Relay
+    bool IsRelay() const;
+    void UpdateRelay();
+    void Relay_Forward(const NetworkPacket& packet);
+    void Relay_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
+    void Relay_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet);
+
+public: // Standby
+    bool IsStandby() const;
+    void Standby_Record(const NetworkPacket& packet);
+    void Standby_TakeOver();
+    void Standby_RetirePrimaryPlayers();
+    bool Standby_CanResume(uint32_t tick, uint32_t srand0) const;
+    void Standby_Send_RESUME(NetworkConnection& connection, uint32_t tick);
 
 public: // Client
     void Reconnect();
@@ -117,14 +176,17 @@ public: // Client
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
+    void ProcessDesyncReport();
     bool IsDesynchronised();
     NetworkServerState_t GetServerState() const;
     void ServerClientDisconnected();
     bool LoadMap(OpenRCT2::IStream* stream);
     void UpdateClient();
+    void FailOver();
 
     // Packet dispatchers.
     void Client_Send_RequestGameState(uint32_t tick);
+    void Client_Send_RequestTileChecksums(uint32_t tick);
     void Client_Send_TOKEN();
     void Client_Send_AUTH(
         const std::string& name, const std::string& password, const std::string& pubkey, const std::vector<uint8_t>& signature);
@@ -133,11 +195,14 @@ public: // Client
     void Client_Send_PING();
     void Client_Send_GAMEINFO();
     void Client_Send_MAPREQUEST(const std::vector<std::string>& objects);
+    void Client_Send_OBJECTS_REQUEST(const std::vector<std::string>& objects);
     void Client_Send_HEARTBEAT(NetworkConnection& connection) const;
+    void Client_Send_VIEWPORT();
 
     // Handlers.
     void Client_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_LoadReceivedMap(uint32_t size);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
@@ -151,9 +216,14 @@ public: // Client
     void Client_Handle_GROUPLIST(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_EVENT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_TOKEN(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_OBJECTS_MANIFEST(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_OBJECTS_LIST(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_ObjectsReceived();
     void Client_Handle_SCRIPTS(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_RESUME(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_TILE_CHECKSUMS(NetworkConnection& connection, NetworkPacket& packet);
 
     std::vector<uint8_t> _challenge;
     std::map<uint32_t, GameAction::Callback_t> _gameActionCallbacks;
@@ -192,8 +262,33 @@ private: // Server Data
     std::string _serverLogPath;
     std::string _serverLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
     std::ofstream _server_log_fs;
+
+    struct MapSnapshot
+    {
+        uint32_t Tick;
+        std::vector<const ObjectRepositoryItem*> Objects;
+        std::vector<uint8_t> Data;
+    };
+
+    // The compressed map last sent to a joining client, reused for other clients joining on the same tick.
+    std::optional<MapSnapshot> _mapSnapshot;
+    uint32_t _ticksSinceChecksum = 0;
+    uint32_t _checksumTileRow = 0;
+    bool _gameActionsSinceChecksum = false;
+    // State checksums of the last ticks they were sent for, so clients that went out of sync can ask for the region hashes
+    std::deque<std::pair<uint32_t, NetworkStateChecksums_t>> _stateChecksumHistory;
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
+    uint32_t _handshakeCredit = 0;
+    uint32_t _pingListsSent = 0;
+    uint32_t _nextAuthId = 0;
+    std::deque<std::unique_ptr<NetworkPendingAuth>> _completedAuths;
+    std::mutex _completedAuthsMutex;
+    // Declared after the results it adds to, so that its tasks are joined before those are destroyed
+    JobPool _authJobs;
+    // Services the sockets of client_connection_list, declared after it so it is stopped before the connections go
+    std::unique_ptr<NetworkIoThread> _ioThread;
+    std::vector<NetworkPacket> _receivedPackets;
 
 private: // Client Data
     struct PlayerListUpdate
@@ -206,6 +301,7 @@ private: // Client Data
         uint32_t srand0;
         uint32_t tick;
         std::string spriteHash;
+        std::optional<NetworkStateChecksums_t> stateChecksums;
     };
 
     std::unordered_map<NetworkCommand, CommandHandler> client_command_handlers;
@@ -213,14 +309,32 @@ private: // Client Data
     std::map<uint32_t, PlayerListUpdate> _pendingPlayerLists;
     std::multimap<uint32_t, NetworkPlayer> _pendingPlayerInfo;
     std::map<uint32_t, ServerTickData_t> _serverTickData;
+    // The client's own state checksums for the tick where the tile elements went out of sync
+    std::optional<std::pair<uint32_t, NetworkStateChecksums_t>> _desyncTileChecksums;
     std::vector<std::string> _missingObjects;
+    // Manifests of object lists the client has been through before and has every object of, so it can skip the list
+    std::set<Crypt::Sha1Algorithm::Result> _knownObjectManifests;
+    // The manifest being negotiated while the objects the client is missing are still to arrive
+    std::optional<Crypt::Sha1Algorithm::Result> _pendingObjectManifest;
+    std::vector<uint8_t> _objectsBuffer;
+    // Size of a map that was received before the missing objects, it is loaded once they are in
+    std::optional<uint32_t> _mapAwaitingObjects;
+
+    // Inflates a compressed map while it is being downloaded, along with how much of chunk_buffer it has been given.
+    std::unique_ptr<ZlibInflater> _mapInflater;
+    size_t _mapInflaterOffset = 0;
     std::string _host;
     std::string _chatLogPath;
     std::string _chatLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
     std::string _password;
     OpenRCT2::MemoryStream _serverGameState;
+    // The desync report being written in the background and the name of its file.
+    std::future<bool> _desyncReport;
+    std::string _desyncReportFileName;
     NetworkServerState_t _serverState;
     uint32_t _lastSentHeartbeat = 0;
+    uint32_t _lastViewportReportTime = 0;
+    std::optional<MapRange> _lastReportedViewport;
     uint32_t last_ping_sent_time = 0;
     uint32_t server_connect_time = 0;
     uint32_t _actionId;
@@ -230,6 +344,35 @@ private: // Client Data
     SocketStatus _lastConnectStatus = SocketStatus::Closed;
     bool _requireReconnect = false;
     bool _clientMapLoaded = false;
+
+    // Standby server announced by the server, which the client reconnects to if the server goes away. The client
+    // then asks to carry on from its current tick rather than downloading the map again.
+    std::string _failoverHost;
+    uint16_t _failoverPort = 0;
+    bool _resumeOnConnect = false;
+    uint32_t _failoverAttempts = 0;
+    uint32_t _failoverRetryTime = 0;
+
+private: // Relay Data
+    // A relay is a client of the upstream server that serves the game to spectators. Spectators are kept in
+    // client_connection_list, which a client has no other use for.
+    std::unordered_map<NetworkCommand, CommandHandler> relay_command_handlers;
+    std::unique_ptr<ITcpSocket> _relayListenSocket;
+    // Tick and game action packets from upstream for the ticks the relay has not run yet, a spectator loading the
+    // relay's map needs them as well
+    std::deque<std::pair<uint32_t, std::shared_ptr<const NetworkPacket>>> _relayBacklog;
+
+private: // Standby Data
+    // A standby follows the primary server as a client and takes over as the server on the standby port when the
+    // primary goes away, with the game state it already has.
+    uint16_t _standbyPort = 0;
+    std::string _standbyAddress;
+    // The tick and game action packets of the last STANDBY_BACKLOG_TICKS ticks, first those from the primary and after
+    // taking over its own, replayed to clients that fail over so they can carry on from the tick they stopped at
+    std::deque<std::pair<uint32_t, std::shared_ptr<const NetworkPacket>>> _standbyBacklog;
+    // The tick the standby took over on while the primary's packets are still in the backlog, clients can only resume
+    // from before it
+    std::optional<uint32_t> _standbyTakeOverTick;
 };
 
 #endif // DISABLE_NETWORK
@@ -0,0 +1,166 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkChecksums.h"
+
+#    include "../management/Finance.h"
+#    include "../ride/Ride.h"
+#    include "../world/Map.h"
+#    include "../world/Park.h"
+
+#    include <algorithm>
+#    include <cstring>
+
+static uint64_t checksum_mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return value;
+}
+
+template<typename T> static void checksum_add(uint64_t& hash, const T& value)
+{
+    static_assert(sizeof(T) <= sizeof(uint64_t));
+    uint64_t word = 0;
+    std::memcpy(&word, &value, sizeof(T));
+    hash = checksum_mix(hash ^ word);
+}
+
+static uint32_t checksum_get_map_size()
+{
+    return static_cast<uint32_t>(std::max<int16_t>(gMapSize, 0));
+}
+
+static void checksum_add_tile_element(uint64_t& hash, const TileElement& element)
+{
+    // Only the placing player's map has ghosts, and inserting or removing one moves the last element flag of the tile
+    // on that map alone, so the flags that depend on ghosts are left out.
+    auto copy = element;
+    copy.Flags &= ~(TILE_ELEMENT_FLAG_LAST_TILE | TILE_ELEMENT_FLAG_GHOST);
+
+    uint64_t words[sizeof(TileElement) / sizeof(uint64_t)];
+    static_assert(sizeof(words) == sizeof(TileElement));
+    std::memcpy(words, &copy, sizeof(words));
+    for (auto word : words)
+    {
+        checksum_add(hash, word);
+    }
+}
+
+static uint64_t checksum_tile_region(uint32_t left, uint32_t top, uint32_t right, uint32_t bottom)
+{
+    uint64_t hash = 0;
+    for (uint32_t y = top; y < bottom; y++)
+    {
+        for (uint32_t x = left; x < right; x++)
+        {
+            const auto* element = map_get_first_element_at(TileCoordsXY(x, y).ToCoordsXY());
+            if (element == nullptr)
+                continue;
+
+            do
+            {
+                // Ghosts only exist for the player that is placing something
+                if (element->IsGhost())
+                    continue;
+
+                checksum_add_tile_element(hash, *element);
+            } while (!(element++)->IsLastForTile());
+        }
+    }
+    return hash;
+}
+
+static std::vector<uint64_t> checksum_tile_regions(uint32_t firstRow, uint32_t numRows)
+{
+    std::vector<uint64_t> regions;
+    const auto mapSize = checksum_get_map_size();
+    const auto lastRow = std::min(firstRow + numRows, mapSize);
+    for (uint32_t top = firstRow; top < lastRow; top += NetworkChecksumRegionSize)
+    {
+        const auto bottom = std::min(top + NetworkChecksumRegionSize, lastRow);
+        for (uint32_t left = 0; left < mapSize; left += NetworkChecksumRegionSize)
+        {
+            const auto right = std::min(left + NetworkChecksumRegionSize, mapSize);
+            regions.push_back(checksum_tile_region(left, top, right, bottom));
+        }
+    }
+    return regions;
+}
+
+static uint64_t checksum_rides()
+{
+    // Only simulated fields are used, rides also hold names, window state and pointers that differ between players
+    uint64_t hash = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        checksum_add(hash, ride.id);
+        checksum_add(hash, ride.status);
+        checksum_add(hash, ride.lifecycle_flags);
+        checksum_add(hash, ride.num_riders);
+        checksum_add(hash, ride.cur_num_customers);
+        checksum_add(hash, ride.total_customers);
+        checksum_add(hash, ride.total_profit);
+        checksum_add(hash, ride.income_per_hour);
+        checksum_add(hash, ride.value);
+        checksum_add(hash, ride.reliability);
+        checksum_add(hash, ride.downtime);
+        checksum_add(hash, ride.breakdown_reason);
+        checksum_add(hash, ride.mechanic_status);
+        for (auto price : ride.price)
+        {
+            checksum_add(hash, price);
+        }
+    }
+    return hash;
+}
+
+static uint64_t checksum_finances()
+{
+    uint64_t hash = 0;
+    checksum_add(hash, gCash);
+    checksum_add(hash, gBankLoan);
+    checksum_add(hash, gBankLoanInterestRate);
+    checksum_add(hash, gCurrentExpenditure);
+    checksum_add(hash, gCurrentProfit);
+    checksum_add(hash, gHistoricalProfit);
+    checksum_add(hash, gParkValue);
+    checksum_add(hash, gCompanyValue);
+    return hash;
+}
+
+NetworkStateChecksums_t network_compute_state_checksums(uint32_t tileRow)
+{
+    NetworkStateChecksums_t checksums;
+    checksums.tileRow = tileRow;
+    checksums.tileRegions = checksum_tile_regions(tileRow, NetworkChecksumTileRows);
+    for (auto regionHash : checksums.tileRegions)
+    {
+        checksum_add(checksums.tileElements, regionHash);
+    }
+    checksums.rides = checksum_rides();
+    checksums.finances = checksum_finances();
+    return checksums;
+}
+
+TileCoordsXY network_get_checksum_region_origin(uint32_t tileRow, size_t regionIndex)
+{
+    const auto regionsPerRow = std::max<size_t>(
+        (checksum_get_map_size() + NetworkChecksumRegionSize - 1) / NetworkChecksumRegionSize, 1);
+    const auto x = (regionIndex % regionsPerRow) * NetworkChecksumRegionSize;
+    const auto y = tileRow + (regionIndex / regionsPerRow) * NetworkChecksumRegionSize;
+    return TileCoordsXY(static_cast<int32_t>(x), static_cast<int32_t>(y));
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,47 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Location.hpp"
+
+#include <vector>
+
+// Number of map rows hashed for each checksum, the map is covered over several checksums so each one stays cheap.
+constexpr uint32_t NetworkChecksumTileRows = 16;
+// The rows of a checksum are hashed in square regions of this many tiles a side and the tile element hash is made from
+// the region hashes, so a client that went out of sync can compare them with the server's to find where the map differs.
+constexpr uint32_t NetworkChecksumRegionSize = 8;
+
+/**
+ * Hashes of the parts of the game state that are not entities, sent along with the sprite checksum so that a desync
+ * tells which part of the game state went out of sync first.
+ */
+struct NetworkStateChecksums_t
+{
+    uint32_t tileRow = 0; // First map row that is part of the tile element hash
+    uint64_t tileElements = 0;
+    uint64_t rides = 0;
+    uint64_t finances = 0;
+    // Hashes of the regions that make up tileElements in row order, these are only sent when asked for
+    std::vector<uint64_t> tileRegions;
+
+    bool operator==(const NetworkStateChecksums_t& other) const
+    {
+        return tileRow == other.tileRow && tileElements == other.tileElements && rides == other.rides
+            && finances == other.finances;
+    }
+};
+
+NetworkStateChecksums_t network_compute_state_checksums(uint32_t tileRow);
+/**
+ * Returns the first tile of a region of the tile element hash that starts at the given row.
+ */
+TileCoordsXY network_get_checksum_region_origin(uint32_t tileRow, size_t regionIndex);
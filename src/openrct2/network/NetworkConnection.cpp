@@ -17,8 +17,34 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <algorithm>
+#    include <cstring>
+#    include <exception>
+#    include <zlib.h>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
-constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
+constexpr size_t CoalescedSendSize = 1024 * 64; // Stop adding packets to the send buffer once it is this large.
+constexpr size_t DeflateChunkSize = 1024 * 16;  // Queued packets are deflated in pieces of about this size.
+constexpr size_t MaxCompressedPacketSize = 1024 * 60; // Deflated data is split to fit the 16-bit size of a packet.
+// A compressed packet never needs to inflate to more than a few send buffers, beyond this the peer is misbehaving
+constexpr size_t MaxPendingInflatedSize = 1024 * 1024 * 4;
+// Traffic is mostly small packets sent a tick at a time, a low level keeps the cost per connection down
+constexpr int32_t NetworkCompressionLevel = 3;
+
+static void AppendPacket(std::vector<uint8_t>& buffer, const NetworkPacket& packet)
+{
+    auto header = packet.Header;
+    header.Size = static_cast<uint16_t>(packet.Data.size());
+
+    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    header.Size += sizeof(header.Id);
+    header.Size = Convert::HostToNetwork(header.Size);
+    header.Id = ByteSwapBE(header.Id);
+
+    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+}
 
 NetworkConnection::NetworkConnection()
 {
@@ -27,10 +53,164 @@ NetworkConnection::NetworkConnection()
 
 NetworkConnection::~NetworkConnection()
 {
+    if (_deflateStream != nullptr)
+    {
+        deflateEnd(_deflateStream.get());
+    }
+    if (_inflateStream != nullptr)
+    {
+        inflateEnd(_inflateStream.get());
+    }
     delete[] _lastDisconnectReason;
 }
 
 NetworkReadPacket NetworkConnection::ReadPacket()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return ReadNextPacket();
+}
+
+void NetworkConnection::ServiceSocket(size_t maxReceivedPackets)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_socketClosed)
+        return;
+
+    try
+    {
+        while (_receivedPackets.size() < maxReceivedPackets)
+        {
+            auto status = ReadNextPacket();
+            if (status == NetworkReadPacket::Disconnected)
+            {
+                _socketClosed = true;
+                return;
+            }
+            if (status != NetworkReadPacket::Success)
+                break;
+
+            _receivedPackets.push_back(std::move(InboundPacket));
+            InboundPacket.Clear();
+        }
+        SendOutboundPackets();
+    }
+    catch (const std::exception& ex)
+    {
+        log_error("Closing connection: %s", ex.what());
+        _socketClosed = true;
+    }
+}
+
+bool NetworkConnection::TakeReceivedPackets(std::vector<NetworkPacket>& packets, size_t maxPackets)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < maxPackets && !_receivedPackets.empty(); i++)
+    {
+        packets.push_back(std::move(_receivedPackets.front()));
+        _receivedPackets.pop_front();
+    }
+    return !_socketClosed || !_receivedPackets.empty();
+}
+
+NetworkReadPacket NetworkConnection::ReadNextPacket()
+{
+    while (true)
+    {
+        // Packets that came in together inside a compressed packet are handed out one at a time
+        if (ReadInflatedPacket())
+        {
+            return NetworkReadPacket::Success;
+        }
+
+        auto status = ReadPacketFromSocket();
+        if (status != NetworkReadPacket::Success || InboundPacket.GetCommand() != NetworkCommand::Compressed)
+        {
+            return status;
+        }
+
+        if (!InflateInboundPacket())
+        {
+            log_error("Received invalid compressed data, closing connection.");
+            return NetworkReadPacket::Disconnected;
+        }
+    }
+}
+
+bool NetworkConnection::InflateInboundPacket()
+{
+    if (_inflateStream == nullptr)
+    {
+        auto stream = std::make_unique<z_stream>();
+        if (inflateInit(stream.get()) != Z_OK)
+        {
+            return false;
+        }
+        _inflateStream = std::move(stream);
+    }
+
+    if (_inflatedPosition != 0)
+    {
+        _inflated.erase(_inflated.begin(), _inflated.begin() + _inflatedPosition);
+        _inflatedPosition = 0;
+    }
+
+    auto& strm = *_inflateStream;
+    strm.next_in = InboundPacket.GetData();
+    strm.avail_in = static_cast<uInt>(InboundPacket.Data.size());
+    do
+    {
+        const size_t offset = _inflated.size();
+        if (offset >= MaxPendingInflatedSize)
+        {
+            return false;
+        }
+        _inflated.resize(offset + DeflateChunkSize);
+        strm.next_out = _inflated.data() + offset;
+        strm.avail_out = static_cast<uInt>(DeflateChunkSize);
+        int result = inflate(&strm, Z_SYNC_FLUSH);
+        _inflated.resize(offset + DeflateChunkSize - strm.avail_out);
+        if (result != Z_OK && result != Z_BUF_ERROR)
+        {
+            return false;
+        }
+    } while (strm.avail_out == 0);
+
+    InboundPacket.Clear();
+    return true;
+}
+
+bool NetworkConnection::ReadInflatedPacket()
+{
+    // Never overwrite a packet that is partly read from the socket
+    const size_t available = _inflated.size() - _inflatedPosition;
+    if (available < sizeof(PacketHeader) || InboundPacket.BytesTransferred != 0)
+    {
+        return false;
+    }
+
+    const uint8_t* src = _inflated.data() + _inflatedPosition;
+    PacketHeader header;
+    std::memcpy(&header, src, sizeof(header));
+    header.Size = Convert::NetworkToHost(header.Size);
+    header.Id = ByteSwapBE(header.Id);
+    header.Size -= sizeof(header.Id);
+
+    const size_t packetSize = sizeof(header) + header.Size;
+    if (available < packetSize)
+    {
+        return false;
+    }
+
+    InboundPacket.Header = header;
+    InboundPacket.Data.assign(src + sizeof(header), src + packetSize);
+    InboundPacket.BytesTransferred = packetSize;
+    _inflatedPosition += packetSize;
+
+    RecordPacketStats(InboundPacket, static_cast<uint32_t>(packetSize), false, false);
+    return true;
+}
+
+NetworkReadPacket NetworkConnection::ReadPacketFromSocket()
 {
     size_t bytesRead = 0;
 
@@ -68,28 +248,29 @@ NetworkReadPacket NetworkConnection::ReadPacket()
 
     // Read packet body.
     {
-        const size_t missingLength = header.Size - (InboundPacket.BytesTransferred - sizeof(header));
-
-        uint8_t buffer[NetworkBufferSize];
+        const size_t receivedLength = InboundPacket.BytesTransferred - sizeof(header);
+        const size_t missingLength = header.Size - receivedLength;
 
         if (missingLength > 0)
         {
-            NetworkReadPacket status = Socket->ReceiveData(buffer, std::min(missingLength, NetworkBufferSize), &bytesRead);
+            // Receive straight into the packet instead of going through a temporary buffer
+            InboundPacket.Data.resize(header.Size);
+            NetworkReadPacket status = Socket->ReceiveData(
+                InboundPacket.Data.data() + receivedLength, missingLength, &bytesRead);
             if (status != NetworkReadPacket::Success)
             {
                 return status;
             }
 
             InboundPacket.BytesTransferred += bytesRead;
-            InboundPacket.Write(buffer, bytesRead);
         }
 
-        if (InboundPacket.Data.size() == header.Size)
+        if (InboundPacket.BytesTransferred - sizeof(header) == header.Size)
         {
             // Received complete packet.
             _lastPacketTime = platform_get_ticks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket, static_cast<uint32_t>(InboundPacket.BytesTransferred), false);
 
             return NetworkReadPacket::Success;
         }
@@ -98,79 +279,232 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+void NetworkConnection::WriteToSendBuffer(const NetworkPacket& packet)
 {
-    auto header = packet.Header;
+    AppendPacket(_sendBuffer, packet);
+    RecordPacketStats(packet, static_cast<uint32_t>(sizeof(PacketHeader) + packet.Data.size()), true);
+}
 
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
+void NetworkConnection::EnableCompression()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_deflateStream != nullptr)
+        return;
 
-    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
-    // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
-    header.Size = Convert::HostToNetwork(header.Size);
-    header.Id = ByteSwapBE(header.Id);
+    auto stream = std::make_unique<z_stream>();
+    if (deflateInit(stream.get(), NetworkCompressionLevel) != Z_OK)
+    {
+        log_error("Unable to initialise network compression.");
+        return;
+    }
+    _deflateStream = std::move(stream);
+}
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+void NetworkConnection::FlushDeflateInput()
+{
+    if (_deflateInput.empty())
+        return;
 
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
-    if (sent > 0)
+    // A sync flush ends the output on a byte boundary, so the other end can inflate all of it straight away while the
+    // stream keeps the history of everything sent before
+    auto& strm = *_deflateStream;
+    std::vector<uint8_t> output(deflateBound(&strm, static_cast<uLong>(_deflateInput.size())) + 16);
+    strm.next_in = _deflateInput.data();
+    strm.avail_in = static_cast<uInt>(_deflateInput.size());
+    size_t outputLength = 0;
+    do
     {
-        packet.BytesTransferred += sent;
-    }
+        if (outputLength == output.size())
+        {
+            output.resize(output.size() * 2);
+        }
+        strm.next_out = output.data() + outputLength;
+        strm.avail_out = static_cast<uInt>(output.size() - outputLength);
+        int result = deflate(&strm, Z_SYNC_FLUSH);
+        outputLength = output.size() - strm.avail_out;
+        if (result == Z_STREAM_ERROR)
+        {
+            log_error("Unable to compress network packets.");
+            break;
+        }
+    } while (strm.avail_out == 0);
+    _deflateInput.clear();
 
-    bool sendComplete = packet.BytesTransferred == buffer.size();
-    if (sendComplete)
+    for (size_t offset = 0; offset < outputLength; offset += MaxCompressedPacketSize)
     {
-        RecordPacketStats(packet, true);
+        const size_t length = std::min(outputLength - offset, MaxCompressedPacketSize);
+        NetworkPacket packet(NetworkCommand::Compressed);
+        packet.Write(output.data() + offset, length);
+        WriteToSendBuffer(packet);
     }
-    return sendComplete;
 }
 
 void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
 {
-    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
+    packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+    QueuePacket(std::make_shared<const NetworkPacket>(std::move(packet)), front);
+}
+
+// Whether a packet of the command only carries state that a later packet of the same command fully replaces.
+static bool IsSupersededByNewer(NetworkCommand command)
+{
+    switch (command)
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
-        if (front)
+        case NetworkCommand::PingList:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void NetworkConnection::QueuePacket(std::shared_ptr<const NetworkPacket> packet, bool front)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (AuthStatus == NetworkAuth::Ok || !packet->CommandRequiresAuth())
+    {
+        if (IsSupersededByNewer(packet->GetCommand()))
         {
-            // If the first packet was already partially sent add new packet to second position
-            if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
-            {
-                auto it = _outboundPackets.begin();
-                it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
-            }
-            else
+            // Connections that can not keep up only get the latest one instead of every packet that piled up
+            auto it = std::find_if(_outboundPackets.begin(), _outboundPackets.end(), [&packet](const auto& queued) {
+                return queued->GetCommand() == packet->GetCommand();
+            });
+            if (it != _outboundPackets.end())
             {
-                _outboundPackets.push_front(std::move(packet));
+                *it = std::move(packet);
+                return;
             }
         }
+
+        if (front)
+        {
+            // Packets that are partially sent have already been moved to the send buffer
+            _outboundPackets.push_front(std::move(packet));
+        }
         else
         {
             _outboundPackets.push_back(std::move(packet));
         }
+        _detailedStats.maxQueuedPackets = std::max(_detailedStats.maxQueuedPackets, _outboundPackets.size());
     }
 }
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    std::lock_guard<std::mutex> lock(_mutex);
+    SendOutboundPackets();
+}
+
+void NetworkConnection::Disconnect()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    Socket->Disconnect();
+}
+
+bool NetworkConnection::IsCompressionEnabled() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _deflateStream != nullptr;
+}
+
+size_t NetworkConnection::GetQueuedPacketCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _outboundPackets.size();
+}
+
+size_t NetworkConnection::GetPendingSendBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _sendBuffer.size() - _sendBufferPosition;
+}
+
+NetworkStats_t NetworkConnection::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+NetworkConnectionStats_t NetworkConnection::GetDetailedStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _detailedStats;
+}
+
+void NetworkConnection::AddHandlerTime(NetworkCommand command, double time)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto commandIndex = EnumValue(command);
+    if (commandIndex < _detailedStats.commands.size())
     {
-        _outboundPackets.pop_front();
+        _detailedStats.commands[commandIndex].handlerTime += time;
+    }
+}
+
+void NetworkConnection::AddPing(uint32_t ping)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _detailedStats.AddPing(ping);
+}
+
+void NetworkConnection::SendOutboundPackets()
+{
+    while (true)
+    {
+        // Send the queued packets together, a tick with a few game actions would otherwise need a send for each of them
+        while (!_outboundPackets.empty() && _sendBuffer.size() < CoalescedSendSize)
+        {
+            const auto& packet = *_outboundPackets.front();
+            if (_deflateStream != nullptr)
+            {
+                AppendPacket(_deflateInput, packet);
+                RecordPacketStats(packet, static_cast<uint32_t>(sizeof(PacketHeader) + packet.Data.size()), true, false);
+                if (_deflateInput.size() >= DeflateChunkSize)
+                {
+                    FlushDeflateInput();
+                }
+            }
+            else
+            {
+                WriteToSendBuffer(packet);
+            }
+            _outboundPackets.pop_front();
+        }
+        if (_deflateStream != nullptr)
+        {
+            FlushDeflateInput();
+        }
+        if (_sendBufferPosition >= _sendBuffer.size())
+        {
+            return;
+        }
+
+        size_t sent = Socket->SendData(_sendBuffer.data() + _sendBufferPosition, _sendBuffer.size() - _sendBufferPosition);
+        _sendBufferPosition += sent;
+        if (_sendBufferPosition < _sendBuffer.size())
+        {
+            // Socket buffer is full, the rest goes out with the next flush
+            return;
+        }
+
+        _sendBuffer.clear();
+        _sendBufferPosition = 0;
+        if (_outboundPackets.empty())
+        {
+            return;
+        }
     }
 }
 
 void NetworkConnection::ResetLastPacketTime()
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     _lastPacketTime = platform_get_ticks();
 }
 
 bool NetworkConnection::ReceivedPacketRecently()
 {
 #    ifndef DEBUG
+    std::lock_guard<std::mutex> lock(_mutex);
     if (platform_get_ticks() > _lastPacketTime + 7000)
     {
         return false;
@@ -207,9 +541,12 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+/**
+ * Packets that went out or came in inside a compressed packet are not on the wire themselves, they only count towards
+ * the statistics of their command. The traffic is counted by the compressed packets.
+ */
+void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, uint32_t packetSize, bool sending, bool onWire)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     NetworkStatisticsGroup trafficGroup;
 
     switch (packet.GetCommand())
@@ -225,15 +562,33 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
             break;
     }
 
+    const auto commandIndex = EnumValue(packet.GetCommand());
+    auto* commandStats = commandIndex < _detailedStats.commands.size() ? &_detailedStats.commands[commandIndex] : nullptr;
     if (sending)
     {
-        Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        if (onWire)
+        {
+            _stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
+            _stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        }
+        if (commandStats != nullptr)
+        {
+            commandStats->packetsSent++;
+            commandStats->bytesSent += packetSize;
+        }
     }
     else
     {
-        Stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        if (onWire)
+        {
+            _stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
+            _stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        }
+        if (commandStats != nullptr)
+        {
+            commandStats->packetsReceived++;
+            commandStats->bytesReceived += packetSize;
+        }
     }
 }
 
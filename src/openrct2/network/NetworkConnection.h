@@ -11,6 +11,7 @@
 
 #ifndef DISABLE_NETWORK
 #    include "../common.h"
+#    include "../world/Location.hpp"
 #    include "NetworkKey.h"
 #    include "NetworkPacket.h"
 #    include "NetworkTypes.h"
@@ -18,29 +19,61 @@
 
 #    include <deque>
 #    include <memory>
+#    include <mutex>
+#    include <optional>
 #    include <vector>
 
 class NetworkPlayer;
 struct ObjectRepositoryItem;
+struct z_stream_s;
 
+/**
+ * A connection is either read and written by the game thread, or its socket is serviced by a NetworkIoThread. The
+ * packet queues, the socket and the statistics are then shared between both threads and only touched under the lock of
+ * the connection, everything else still belongs to the game thread.
+ */
 class NetworkConnection final
 {
 public:
     std::unique_ptr<ITcpSocket> Socket = nullptr;
     NetworkPacket InboundPacket;
     NetworkAuth AuthStatus = NetworkAuth::None;
-    NetworkStats_t Stats = {};
     NetworkPlayer* Player = nullptr;
     uint32_t PingTime = 0;
     NetworkKey Key;
     std::vector<uint8_t> Challenge;
+    uint32_t PendingAuthId = 0; // Set while the signature of the auth packet is verified on a worker thread
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
     bool IsDisconnected = false;
+    bool IsRelayJoined = false; // Spectator of a relay that has been sent the map, the upstream packets follow it
+    std::optional<MapRange> InterestArea; // The map area the client last reported its main view to show
 
     NetworkConnection();
     ~NetworkConnection();
 
     NetworkReadPacket ReadPacket();
+
+    /**
+     * Reads packets from the socket into the received queue until it holds maxReceivedPackets, then sends the queued
+     * packets. Called by the NetworkIoThread that services the connection.
+     */
+    void ServiceSocket(size_t maxReceivedPackets);
+
+    /**
+     * Moves up to maxPackets received packets to the end of packets, for connections serviced by a NetworkIoThread.
+     * Returns false once the socket is closed and every packet read before that has been taken.
+     */
+    bool TakeReceivedPackets(std::vector<NetworkPacket>& packets, size_t maxPackets);
+
+    bool IsServicedByIoThread() const
+    {
+        return _servicedByIoThread;
+    }
+    void SetServicedByIoThread(bool value)
+    {
+        _servicedByIoThread = value;
+    }
+
     void QueuePacket(NetworkPacket&& packet, bool front = false);
     void QueuePacket(const NetworkPacket& packet, bool front = false)
     {
@@ -48,7 +81,26 @@ public:
         return QueuePacket(std::move(copy), front);
     }
 
+    // Queues a packet that can be shared with other connections, the packet must not change once queued.
+    void QueuePacket(std::shared_ptr<const NetworkPacket> packet, bool front = false);
+
     void SendQueuedPackets();
+    void Disconnect();
+
+    /**
+     * Packets sent from now on are deflated as one stream and sent inside NetworkCommand::Compressed packets, once the
+     * other end has agreed to it. Compressed packets are read from any connection.
+     */
+    void EnableCompression();
+    bool IsCompressionEnabled() const;
+
+    size_t GetQueuedPacketCount() const;
+    size_t GetPendingSendBytes() const;
+    NetworkStats_t GetStats() const;
+    NetworkConnectionStats_t GetDetailedStats() const;
+    void AddHandlerTime(NetworkCommand command, double time);
+    void AddPing(uint32_t ping);
+
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
 
@@ -57,12 +109,32 @@ public:
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
+    mutable std::mutex _mutex;
+    bool _servicedByIoThread = false;
+    bool _socketClosed = false; // Set by the NetworkIoThread once the socket has been closed or has failed
+    std::deque<NetworkPacket> _receivedPackets;
+    NetworkStats_t _stats = {};
+    NetworkConnectionStats_t _detailedStats;
+    std::deque<std::shared_ptr<const NetworkPacket>> _outboundPackets;
+    std::vector<uint8_t> _sendBuffer; // Queued packets that are written to the socket together
+    size_t _sendBufferPosition = 0;
     uint32_t _lastPacketTime = 0;
     utf8* _lastDisconnectReason = nullptr;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    std::unique_ptr<z_stream_s> _deflateStream;
+    std::vector<uint8_t> _deflateInput; // Packets waiting to be deflated into the send buffer
+    std::unique_ptr<z_stream_s> _inflateStream;
+    std::vector<uint8_t> _inflated; // Inflated packets that have not been read yet
+    size_t _inflatedPosition = 0;
+
+    NetworkReadPacket ReadNextPacket();
+    NetworkReadPacket ReadPacketFromSocket();
+    void SendOutboundPackets();
+    bool InflateInboundPacket();
+    bool ReadInflatedPacket();
+    void FlushDeflateInput();
+    void RecordPacketStats(const NetworkPacket& packet, uint32_t packetSize, bool sending, bool onWire = true);
+    void WriteToSendBuffer(const NetworkPacket& packet);
 };
 
 #endif // DISABLE_NETWORK
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkIoThread.h"
+
+#    include "NetworkConnection.h"
+
+#    include <algorithm>
+#    include <chrono>
+
+// The sockets can not be waited on through ITcpSocket, so they are polled at this interval when there is nothing to send
+constexpr auto IoPollInterval = std::chrono::milliseconds(1);
+// Packets read ahead for each connection, beyond this the data is left in the socket until the game thread catches up
+constexpr size_t MaxReceivedPackets = 256;
+
+NetworkIoThread::NetworkIoThread()
+{
+    _thread = std::thread([this]() { Run(); });
+}
+
+NetworkIoThread::~NetworkIoThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wakeCondition.notify_one();
+    _thread.join();
+}
+
+void NetworkIoThread::Add(NetworkConnection& connection)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    connection.SetServicedByIoThread(true);
+    _connections.push_back(&connection);
+}
+
+void NetworkIoThread::Remove(NetworkConnection& connection)
+{
+    // Waits for the pass over the sockets that may be using the connection
+    std::lock_guard<std::mutex> lock(_mutex);
+    _connections.erase(std::remove(_connections.begin(), _connections.end(), &connection), _connections.end());
+    connection.SetServicedByIoThread(false);
+}
+
+void NetworkIoThread::Wake()
+{
+    // Not taking the lock means a wake can be missed while a pass is about to wait, it then waits for the poll interval
+    _woken = true;
+    _wakeCondition.notify_one();
+}
+
+void NetworkIoThread::Run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stop)
+    {
+        _woken = false;
+        for (auto connection : _connections)
+        {
+            connection->ServiceSocket(MaxReceivedPackets);
+        }
+        _wakeCondition.wait_for(lock, IoPollInterval, [this]() { return _stop || _woken; });
+    }
+}
+
+#endif // DISABLE_NETWORK
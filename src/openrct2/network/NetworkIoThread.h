@@ -0,0 +1,51 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+#    include "../common.h"
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+class NetworkConnection;
+
+/**
+ * Reads, frames and sends the packets of the connections given to it on a thread of its own, so a slow or misbehaving
+ * peer never holds up the game thread inside a socket call. The packets read are queued on their connection until the
+ * game thread takes them with NetworkConnection::TakeReceivedPackets.
+ */
+class NetworkIoThread final
+{
+public:
+    NetworkIoThread();
+    ~NetworkIoThread();
+
+    void Add(NetworkConnection& connection);
+    // The connection is no longer touched once this returns, so it can be destroyed
+    void Remove(NetworkConnection& connection);
+    // Sends the packets queued so far without waiting for the next pass over the sockets
+    void Wake();
+
+private:
+    std::vector<NetworkConnection*> _connections;
+    std::mutex _mutex;
+    std::condition_variable _wakeCondition;
+    std::atomic<bool> _woken = { false };
+    bool _stop = false;
+    std::thread _thread;
+
+    void Run();
+};
+
+#endif // DISABLE_NETWORK
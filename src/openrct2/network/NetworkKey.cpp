@@ -24,6 +24,9 @@ NetworkKey::~NetworkKey()
 {
 }
 
+NetworkKey::NetworkKey(NetworkKey&&) noexcept = default;
+NetworkKey& NetworkKey::operator=(NetworkKey&&) noexcept = default;
+
 void NetworkKey::Unload()
 {
     _key = nullptr;
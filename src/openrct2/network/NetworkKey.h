@@ -33,6 +33,8 @@ class NetworkKey final
 public:
     NetworkKey();
     ~NetworkKey();
+    NetworkKey(NetworkKey&&) noexcept;
+    NetworkKey& operator=(NetworkKey&&) noexcept;
     bool Generate();
     bool LoadPrivate(OpenRCT2::IStream* stream);
     bool LoadPublic(OpenRCT2::IStream* stream);
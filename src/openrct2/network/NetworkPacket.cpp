@@ -42,7 +42,7 @@ void NetworkPacket::Clear()
     Data.clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
     switch (GetCommand())
     {
@@ -50,7 +50,11 @@ bool NetworkPacket::CommandRequiresAuth()
         case NetworkCommand::Auth:
         case NetworkCommand::Token:
         case NetworkCommand::GameInfo:
+        case NetworkCommand::ObjectsManifest:
+        case NetworkCommand::ObjectsListRequest:
         case NetworkCommand::ObjectsList:
+        case NetworkCommand::ObjectsRequest:
+        case NetworkCommand::Objects:
         case NetworkCommand::MapRequest:
         case NetworkCommand::Heartbeat:
             return false;
@@ -14,6 +14,8 @@
 #include "../ride/RideTypes.h"
 #include "../util/Util.h"
 
+#include <array>
+
 enum
 {
     SERVER_EVENT_PLAYER_JOINED,
@@ -23,6 +25,7 @@ enum
 enum
 {
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
+    NETWORK_TICK_FLAG_STATE_CHECKSUMS = 1 << 1,
 };
 
 enum
@@ -83,12 +86,28 @@ enum class NetworkCommand : uint32_t
     GameState,
     Scripts,
     Heartbeat,
+    Resume,
+    Compressed,
+    RequestTileChecksums,
+    TileChecksums,
+    Viewport,
+    ObjectsManifest,
+    ObjectsListRequest,
+    ObjectsRequest,
+    Objects,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
 
 static_assert(NetworkCommand::GameInfo == static_cast<NetworkCommand>(9), "Master server expects this to be 9");
 
+// Compression of a connection's traffic, offered by the client with its token request and confirmed by the server
+enum class NetworkCompression : uint8_t
+{
+    None,
+    Deflate,
+};
+
 enum class NetworkServerState
 {
     Ok,
@@ -146,3 +165,30 @@ struct NetworkStats_t
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
 };
+
+struct NetworkCommandStats_t
+{
+    uint32_t packetsReceived = 0;
+    uint32_t packetsSent = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t bytesSent = 0;
+    double handlerTime = 0; // Seconds spent handling the received packets
+};
+
+// Upper bounds of the ping histogram buckets in milliseconds, the last bucket holds all pings above them.
+constexpr std::array<uint32_t, 7> NetworkPingBuckets = { 25, 50, 100, 200, 400, 800, 1600 };
+
+struct NetworkConnectionStats_t
+{
+    std::array<NetworkCommandStats_t, EnumValue(NetworkCommand::Max)> commands{};
+    std::array<uint32_t, NetworkPingBuckets.size() + 1> pingHistogram{};
+    size_t maxQueuedPackets = 0;
+
+    void AddPing(uint32_t ping)
+    {
+        size_t bucket = 0;
+        while (bucket < NetworkPingBuckets.size() && ping > NetworkPingBuckets[bucket])
+            bucket++;
+        pingHistogram[bucket]++;
+    }
+};
@@ -26,11 +26,32 @@
 #    include "network.h"
 
 #    include <algorithm>
+#    include <atomic>
+#    include <chrono>
+#    include <mutex>
 #    include <numeric>
 #    include <optional>
+#    include <thread>
+#    include <unordered_set>
 
 using namespace OpenRCT2;
 
+// Probes are plain connections to the game port. Only a few are open at a time and they are started at a steady rate, so
+// probing a long list does not flood the network or look like an attack to the servers.
+constexpr size_t LATENCY_PROBE_WORKERS = 16;
+constexpr auto LATENCY_PROBE_INTERVAL = std::chrono::milliseconds(20);
+
+struct ServerLatencyProbes
+{
+    std::vector<std::string> Addresses;
+    std::atomic<size_t> NextAddress{};
+    std::atomic<bool> Cancelled{};
+
+    std::mutex Mutex;
+    std::chrono::steady_clock::time_point NextProbeTime;
+    std::vector<std::pair<std::string, uint32_t>> Results;
+};
+
 int32_t ServerListEntry::CompareTo(const ServerListEntry& other) const
 {
     const auto& a = *this;
@@ -58,6 +79,15 @@ int32_t ServerListEntry::CompareTo(const ServerListEntry& other) const
         return a.RequiresPassword ? 1 : -1;
     }
 
+    if (a.Latency != b.Latency)
+    {
+        if (!a.Latency.has_value() || !b.Latency.has_value())
+        {
+            return a.Latency.has_value() ? -1 : 1;
+        }
+        return *a.Latency < *b.Latency ? -1 : 1;
+    }
+
     if (a.Players != b.Players)
     {
         return a.Players > b.Players ? -1 : 1;
@@ -111,22 +141,77 @@ std::optional<ServerListEntry> ServerListEntry::FromJson(json_t& server)
     }
 }
 
-void ServerList::Sort()
+static bool IsBefore(const ServerListEntry& a, const ServerListEntry& b)
 {
-    _serverEntries.erase(
-        std::unique(
-            _serverEntries.begin(), _serverEntries.end(),
-            [](const ServerListEntry& a, const ServerListEntry& b) {
-                if (a.Favourite == b.Favourite)
-                {
-                    return String::Equals(a.Address, b.Address, true);
-                }
-                return false;
-            }),
-        _serverEntries.end());
-    std::sort(_serverEntries.begin(), _serverEntries.end(), [](const ServerListEntry& a, const ServerListEntry& b) {
-        return a.CompareTo(b) < 0;
-    });
+    return a.CompareTo(b) < 0;
+}
+
+static std::string GetDuplicateKey(const ServerListEntry& entry)
+{
+    // A favourite may also be listed as an online server, only duplicates within the same group are dropped
+    return (entry.Favourite ? "*" : "") + String::ToUpper(entry.Address);
+}
+
+static std::pair<std::string, uint16_t> ParseAddress(std::string address)
+{
+    uint16_t port = static_cast<uint16_t>(gConfigNetwork.default_port);
+    auto beginBracketIndex = address.find('[');
+    auto endBracketIndex = address.find(']');
+    auto dotIndex = address.find('.');
+    auto colonIndex = address.find_last_of(':');
+    if (colonIndex != std::string::npos && (endBracketIndex != std::string::npos || dotIndex != std::string::npos))
+    {
+        int32_t parsedPort;
+        if (std::sscanf(&address[colonIndex + 1], "%d", &parsedPort) > 0)
+        {
+            port = static_cast<uint16_t>(parsedPort);
+            address = address.substr(0, colonIndex);
+        }
+    }
+    if (beginBracketIndex != std::string::npos && endBracketIndex != std::string::npos)
+    {
+        address = address.substr(beginBracketIndex + 1, endBracketIndex - beginBracketIndex - 1);
+    }
+    return { address, port };
+}
+
+static void RunLatencyProbes(std::shared_ptr<ServerLatencyProbes> probes)
+{
+    size_t index;
+    while (!probes->Cancelled && (index = probes->NextAddress++) < probes->Addresses.size())
+    {
+        // Probes are spaced out across all the workers, not per worker
+        std::chrono::steady_clock::time_point startTime;
+        {
+            std::lock_guard<std::mutex> lock(probes->Mutex);
+            startTime = std::max(std::chrono::steady_clock::now(), probes->NextProbeTime);
+            probes->NextProbeTime = startTime + LATENCY_PROBE_INTERVAL;
+        }
+        std::this_thread::sleep_until(startTime);
+        if (probes->Cancelled)
+        {
+            break;
+        }
+
+        const auto& address = probes->Addresses[index];
+        try
+        {
+            auto [host, port] = ParseAddress(address);
+            auto socket = CreateTcpSocket();
+            auto connectStartTime = std::chrono::steady_clock::now();
+            socket->Connect(host, port);
+            auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - connectStartTime);
+            socket->Close();
+
+            std::lock_guard<std::mutex> lock(probes->Mutex);
+            probes->Results.emplace_back(address, static_cast<uint32_t>(latency.count()));
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to probe %s: %s", address.c_str(), e.what());
+        }
+    }
 }
 
 ServerListEntry& ServerList::GetServer(size_t index)
@@ -141,21 +226,59 @@ size_t ServerList::GetCount() const
 
 void ServerList::Add(const ServerListEntry& entry)
 {
-    _serverEntries.push_back(entry);
-    Sort();
+    AddRange({ entry });
 }
 
 void ServerList::AddRange(const std::vector<ServerListEntry>& entries)
 {
-    _serverEntries.insert(_serverEntries.end(), entries.begin(), entries.end());
-    Sort();
+    std::unordered_set<std::string> listed;
+    for (const auto& entry : _serverEntries)
+    {
+        listed.insert(GetDuplicateKey(entry));
+    }
+
+    auto oldCount = _serverEntries.size();
+    for (const auto& entry : entries)
+    {
+        if (listed.insert(GetDuplicateKey(entry)).second)
+        {
+            _serverEntries.push_back(entry);
+        }
+    }
+
+    // The list is kept sorted, so only the new servers need sorting before they are merged in
+    auto middle = _serverEntries.begin() + oldCount;
+    std::sort(middle, _serverEntries.end(), IsBefore);
+    std::inplace_merge(_serverEntries.begin(), middle, _serverEntries.end(), IsBefore);
 }
 
 void ServerList::Clear()
 {
+    CancelLatencyProbes();
     _serverEntries.clear();
 }
 
+size_t ServerList::Reposition(size_t index)
+{
+    // Everything else is still sorted, so the new place is found with a binary search on the side the server moves to
+    auto begin = _serverEntries.begin();
+    auto end = _serverEntries.end();
+    auto it = begin + index;
+    if (it != begin && IsBefore(*it, *(it - 1)))
+    {
+        auto destination = std::upper_bound(begin, it, *it, IsBefore);
+        std::rotate(destination, it, it + 1);
+        return destination - begin;
+    }
+    if (it + 1 != end && IsBefore(*(it + 1), *it))
+    {
+        auto destination = std::lower_bound(it + 1, end, *it, IsBefore);
+        std::rotate(it, it + 1, destination);
+        return (destination - begin) - 1;
+    }
+    return index;
+}
+
 std::vector<ServerListEntry> ServerList::ReadFavourites() const
 {
     log_verbose("server_list_read(...)");
@@ -400,6 +523,68 @@ std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync
 #    endif
 }
 
+void ServerList::BeginLatencyProbes()
+{
+    CancelLatencyProbes();
+
+    auto probes = std::make_shared<ServerLatencyProbes>();
+    for (const auto& entry : _serverEntries)
+    {
+        probes->Addresses.push_back(entry.Address);
+    }
+    std::sort(probes->Addresses.begin(), probes->Addresses.end());
+    probes->Addresses.erase(std::unique(probes->Addresses.begin(), probes->Addresses.end()), probes->Addresses.end());
+
+    // Workers are detached so that cancelling never waits for a connection attempt to time out
+    auto numWorkers = std::min(LATENCY_PROBE_WORKERS, probes->Addresses.size());
+    for (size_t i = 0; i < numWorkers; i++)
+    {
+        std::thread(RunLatencyProbes, probes).detach();
+    }
+    _latencyProbes = probes;
+}
+
+void ServerList::CancelLatencyProbes()
+{
+    if (_latencyProbes != nullptr)
+    {
+        _latencyProbes->Cancelled = true;
+        _latencyProbes = nullptr;
+    }
+}
+
+bool ServerList::MergeLatencyResults()
+{
+    if (_latencyProbes == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<std::pair<std::string, uint32_t>> results;
+    {
+        std::lock_guard<std::mutex> lock(_latencyProbes->Mutex);
+        results.swap(_latencyProbes->Results);
+    }
+
+    for (const auto& [address, latency] : results)
+    {
+        // An address can be listed twice, as a favourite and as an online server
+        for (;;)
+        {
+            auto it = std::find_if(_serverEntries.begin(), _serverEntries.end(), [&](const ServerListEntry& entry) {
+                return entry.Address == address && entry.Latency != latency;
+            });
+            if (it == _serverEntries.end())
+            {
+                break;
+            }
+            it->Latency = latency;
+            Reposition(it - _serverEntries.begin());
+        }
+    }
+    return !results.empty();
+}
+
 uint32_t ServerList::GetTotalPlayerCount() const
 {
     return std::accumulate(_serverEntries.begin(), _serverEntries.end(), 0, [](uint32_t acc, const ServerListEntry& entry) {
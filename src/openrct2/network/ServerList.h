@@ -13,12 +13,14 @@
 #include "../core/JsonFwd.hpp"
 
 #include <future>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 struct INetworkEndpoint;
+struct ServerLatencyProbes;
 
 struct ServerListEntry
 {
@@ -31,6 +33,8 @@ struct ServerListEntry
     uint8_t Players{};
     uint8_t MaxPlayers{};
     bool Local{};
+    // Time taken to open a connection to the server in milliseconds, unset until it has been probed
+    std::optional<uint32_t> Latency;
 
     int32_t CompareTo(const ServerListEntry& other) const;
     bool IsVersionValid() const;
@@ -49,8 +53,8 @@ class ServerList
 {
 private:
     std::vector<ServerListEntry> _serverEntries;
+    std::shared_ptr<ServerLatencyProbes> _latencyProbes;
 
-    void Sort();
     std::vector<ServerListEntry> ReadFavourites() const;
     bool WriteFavourites(const std::vector<ServerListEntry>& entries) const;
     std::future<std::vector<ServerListEntry>> FetchLocalServerListAsync(const INetworkEndpoint& broadcastEndpoint) const;
@@ -62,12 +66,31 @@ public:
     void AddRange(const std::vector<ServerListEntry>& entries);
     void Clear();
 
+    /**
+     * Moves a server that has been changed to its place in the sorted list without sorting the whole list again.
+     * @return The new index of the server.
+     */
+    size_t Reposition(size_t index);
+
     void ReadAndAddFavourites();
     void WriteFavourites() const;
 
     std::future<std::vector<ServerListEntry>> FetchLocalServerListAsync() const;
     std::future<std::vector<ServerListEntry>> FetchOnlineServerListAsync() const;
     uint32_t GetTotalPlayerCount() const;
+
+    /**
+     * Starts measuring the latency of every listed server in the background, a few servers at a time. Results are only
+     * applied to the list by MergeLatencyResults so the list is never changed from another thread.
+     */
+    void BeginLatencyProbes();
+    void CancelLatencyProbes();
+
+    /**
+     * Applies the latencies measured since the last call, moving each probed server to its new place in the list.
+     * @return True if any server was updated.
+     */
+    bool MergeLatencyResults();
 };
 
 class MasterServerException : public std::exception
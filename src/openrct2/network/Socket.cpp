@@ -10,6 +10,7 @@
 #ifndef DISABLE_NETWORK
 
 #    include <atomic>
+#    include <cerrno>
 #    include <chrono>
 #    include <cmath>
 #    include <cstring>
@@ -459,19 +460,23 @@ public:
 
             do
             {
-                // Sleep for a bit
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
                 fd_set writeFD;
                 FD_ZERO(&writeFD);
 #    pragma warning(push)
 #    pragma warning(disable : 4548) // expression before comma has no effect; expected expression with side-effect
                 FD_SET(_socket, &writeFD);
 #    pragma warning(pop)
+                // Wait for the socket to become writable rather than sleeping, so the connection is picked up as soon as
+                // it is made. This also keeps the time taken to connect usable as a latency measurement.
                 timeval timeout{};
                 timeout.tv_sec = 0;
-                timeout.tv_usec = 0;
-                if (select(static_cast<int32_t>(_socket + 1), nullptr, &writeFD, nullptr, &timeout) > 0)
+                timeout.tv_usec = 100 * 1000;
+                auto selectResult = select(static_cast<int32_t>(_socket + 1), nullptr, &writeFD, nullptr, &timeout);
+                if (selectResult == SOCKET_ERROR && LAST_SOCKET_ERROR() != EINTR)
+                {
+                    throw SocketException("select failed with error: " + std::to_string(LAST_SOCKET_ERROR()));
+                }
+                if (selectResult > 0)
                 {
                     error = 0;
                     len = sizeof(error);
@@ -479,11 +484,12 @@ public:
                     {
                         throw SocketException("getsockopt failed with error: " + std::to_string(LAST_SOCKET_ERROR()));
                     }
-                    if (error == 0)
+                    if (error != 0)
                     {
-                        _status = SocketStatus::Connected;
-                        return;
+                        throw SocketException("Connection failed: " + std::to_string(error));
                     }
+                    _status = SocketStatus::Connected;
+                    return;
                 }
             } while ((std::chrono::system_clock::now() - connectStartTime) < CONNECT_TIMEOUT);
 
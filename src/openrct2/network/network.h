@@ -45,6 +45,8 @@ void network_reconnect();
 void network_shutdown_client();
 int32_t network_begin_client(const std::string& host, int32_t port);
 int32_t network_begin_server(int32_t port, const std::string& address);
+int32_t network_begin_relay(const std::string& host, int32_t port, int32_t relayPort, const std::string& relayAddress);
+int32_t network_begin_standby(const std::string& host, int32_t port, int32_t standbyPort, const std::string& standbyAddress);
 
 int32_t network_get_mode();
 int32_t network_get_status();
@@ -121,3 +123,4 @@ std::string network_get_version();
 NetworkStats_t network_get_stats();
 NetworkServerState_t network_get_server_state();
 json_t network_get_server_info_as_json();
+json_t network_get_stats_as_json();
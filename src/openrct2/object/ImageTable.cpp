@@ -16,6 +16,7 @@
 #include "../core/FileScanner.h"
 #include "../core/IStream.hpp"
 #include "../core/Json.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
@@ -24,15 +25,34 @@
 #include "ObjectFactory.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <memory>
 #include <stdexcept>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+// Magic number and version of the image cache files, increment the version to ignore existing cache files
+static constexpr uint32_t IMAGE_CACHE_MAGIC_NUMBER = 0x474D4943; // CIMG
+static constexpr uint32_t IMAGE_CACHE_VERSION = 1;
+
+/**
+ * An image of an object that is stored as PNG, along with how it is imported.
+ */
+struct ImageTable::PngImage
+{
+    std::string Path;
+    std::vector<uint8_t> Data;
+    int16_t X = 0;
+    int16_t Y = 0;
+    bool Raw = false;
+};
+
 struct ImageTable::RequiredImage
 {
     rct_g1_element g1{};
+    // Owned copy of the pixel data, empty when g1 points into the base graphics which outlive all objects
+    std::unique_ptr<uint8_t[]> data;
     std::unique_ptr<RequiredImage> next_zoom;
 
     bool HasData() const
@@ -43,28 +63,35 @@ struct ImageTable::RequiredImage
     RequiredImage() = default;
     RequiredImage(const RequiredImage&) = delete;
 
+    RequiredImage(const rct_g1_element& orig, std::unique_ptr<uint8_t[]> origData)
+        : g1(orig)
+        , data(std::move(origData))
+    {
+        g1.offset = data.get();
+    }
+
     RequiredImage(const rct_g1_element& orig)
     {
-        auto length = g1_calculate_data_size(&orig);
         g1 = orig;
-        g1.offset = new uint8_t[length];
-        std::memcpy(g1.offset, orig.offset, length);
+        CopyData(orig);
         g1.flags &= ~G1_FLAG_HAS_ZOOM_SPRITE;
     }
 
-    RequiredImage(uint32_t idx, std::function<const rct_g1_element*(uint32_t)> getter)
+    RequiredImage(uint32_t idx, std::function<const rct_g1_element*(uint32_t)> getter, bool copyData)
     {
         auto orig = getter(idx);
         if (orig != nullptr)
         {
-            auto length = g1_calculate_data_size(orig);
             g1 = *orig;
-            g1.offset = new uint8_t[length];
-            std::memcpy(g1.offset, orig->offset, length);
+            if (copyData)
+            {
+                CopyData(*orig);
+            }
             if ((g1.flags & G1_FLAG_HAS_ZOOM_SPRITE) && g1.zoomed_offset != 0)
             {
                 // Fetch image for next zoom level
-                next_zoom = std::make_unique<RequiredImage>(static_cast<uint32_t>(idx - g1.zoomed_offset), getter);
+                next_zoom = std::make_unique<RequiredImage>(
+                    static_cast<uint32_t>(idx - g1.zoomed_offset), getter, copyData);
                 if (!next_zoom->HasData())
                 {
                     next_zoom = nullptr;
@@ -74,9 +101,13 @@ struct ImageTable::RequiredImage
         }
     }
 
-    ~RequiredImage()
+private:
+    void CopyData(const rct_g1_element& orig)
     {
-        delete[] g1.offset;
+        auto length = g1_calculate_data_size(&orig);
+        data = std::make_unique<uint8_t[]>(length);
+        std::memcpy(data.get(), orig.offset, length);
+        g1.offset = data.get();
     }
 };
 
@@ -98,7 +129,7 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
                 {
                     result.push_back(std::make_unique<RequiredImage>(
                         static_cast<uint32_t>(SPR_CSG_BEGIN + i),
-                        [](uint32_t idx) -> const rct_g1_element* { return gfx_get_g1_element(idx); }));
+                        [](uint32_t idx) -> const rct_g1_element* { return gfx_get_g1_element(idx); }, false));
                 }
             }
         }
@@ -111,7 +142,8 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
             for (auto i : range)
             {
                 result.push_back(std::make_unique<RequiredImage>(
-                    static_cast<uint32_t>(i), [](uint32_t idx) -> const rct_g1_element* { return gfx_get_g1_element(idx); }));
+                    static_cast<uint32_t>(i), [](uint32_t idx) -> const rct_g1_element* { return gfx_get_g1_element(idx); },
+                    false));
             }
         }
     }
@@ -129,62 +161,182 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
     }
     else
     {
-        try
-        {
-            auto imageData = context->GetData(s);
-            auto image = Imaging::ReadFromBuffer(imageData, IMAGE_FORMAT::PNG_32);
-
-            ImageImporter importer;
-            auto importResult = importer.Import(image, 0, 0, ImageImporter::IMPORT_FLAGS::RLE);
-
-            result.push_back(std::make_unique<RequiredImage>(importResult.Element));
-        }
-        catch (const std::exception& e)
-        {
-            auto msg = String::StdFormat("Unable to load image '%s': %s", s.c_str(), e.what());
-            context->LogWarning(ObjectError::BadImageTable, msg.c_str());
-            result.push_back(std::make_unique<RequiredImage>());
-        }
+        result.push_back(ImportPngImage(context, ReadPngImage(context, s)));
     }
     return result;
 }
 
-std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(IReadObjectContext* context, json_t& el)
+static bool IsPngImage(const json_t& jsonImage)
 {
-    Guard::Assert(el.is_object(), "ImageTable::ParseImages expects parameter el to be object");
+    if (jsonImage.is_object())
+    {
+        return true;
+    }
+    if (jsonImage.is_string())
+    {
+        auto s = jsonImage.get<std::string>();
+        return !s.empty() && !String::StartsWith(s, "$CSG") && !String::StartsWith(s, "$G1")
+            && !String::StartsWith(s, "$RCT2:OBJDATA/");
+    }
+    return false;
+}
 
-    auto path = Json::GetString(el["path"]);
-    auto x = Json::GetNumber<int16_t>(el["x"]);
-    auto y = Json::GetNumber<int16_t>(el["y"]);
-    auto raw = Json::GetString(el["format"]) == "raw";
+ImageTable::PngImage ImageTable::ReadPngImage(IReadObjectContext* context, json_t& jsonImage)
+{
+    if (jsonImage.is_string())
+    {
+        return ReadPngImage(context, jsonImage.get<std::string>());
+    }
 
-    std::vector<std::unique_ptr<RequiredImage>> result;
+    Guard::Assert(jsonImage.is_object(), "ImageTable::ReadPngImage expects parameter jsonImage to be object");
+    auto png = ReadPngImage(context, Json::GetString(jsonImage["path"]));
+    png.X = Json::GetNumber<int16_t>(jsonImage["x"]);
+    png.Y = Json::GetNumber<int16_t>(jsonImage["y"]);
+    png.Raw = Json::GetString(jsonImage["format"]) == "raw";
+    return png;
+}
+
+ImageTable::PngImage ImageTable::ReadPngImage(IReadObjectContext* context, const std::string& path)
+{
+    PngImage png;
+    png.Path = path;
+    try
+    {
+        png.Data = context->GetData(path);
+    }
+    catch (const std::exception&)
+    {
+        // Reported when the image is imported
+    }
+    return png;
+}
+
+std::unique_ptr<ImageTable::RequiredImage> ImageTable::ImportPngImage(IReadObjectContext* context, const PngImage& png)
+{
     try
     {
         auto flags = ImageImporter::IMPORT_FLAGS::NONE;
-        if (!raw)
+        if (!png.Raw)
         {
             flags = static_cast<ImageImporter::IMPORT_FLAGS>(flags | ImageImporter::IMPORT_FLAGS::RLE);
         }
-        auto imageData = context->GetData(path);
-        auto image = Imaging::ReadFromBuffer(imageData, IMAGE_FORMAT::PNG_32);
+        auto image = Imaging::ReadFromBuffer(png.Data, IMAGE_FORMAT::PNG_32);
 
         ImageImporter importer;
-        auto importResult = importer.Import(image, 0, 0, flags);
-        auto g1Element = importResult.Element;
-        g1Element.x_offset = x;
-        g1Element.y_offset = y;
-        result.push_back(std::make_unique<RequiredImage>(g1Element));
+        auto importResult = importer.Import(image, png.X, png.Y, flags);
+        return std::make_unique<RequiredImage>(importResult.Element);
     }
     catch (const std::exception& e)
     {
-        auto msg = String::StdFormat("Unable to load image '%s': %s", path.c_str(), e.what());
+        auto msg = String::StdFormat("Unable to load image '%s': %s", png.Path.c_str(), e.what());
         context->LogWarning(ObjectError::BadImageTable, msg.c_str());
-        result.push_back(std::make_unique<RequiredImage>());
+        return std::make_unique<RequiredImage>();
+    }
+}
+
+/**
+ * Returns the path of the cache file for the given PNG images. The name is a hash of the image data and how the images
+ * are imported, so objects that change their images get a new cache file.
+ */
+std::string ImageTable::GetImageCachePath(const std::vector<PngImage>& pngImages)
+{
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325;
+    auto addToHash = [&hash](const void* data, size_t length) {
+        auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < length; i++)
+        {
+            hash = (hash ^ bytes[i]) * 0x100000001B3;
+        }
+    };
+    for (const auto& png : pngImages)
+    {
+        const uint64_t length = png.Data.size();
+        addToHash(&length, sizeof(length));
+        addToHash(png.Data.data(), png.Data.size());
+        addToHash(&png.X, sizeof(png.X));
+        addToHash(&png.Y, sizeof(png.Y));
+        addToHash(&png.Raw, sizeof(png.Raw));
+    }
+
+    const auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), "images");
+    return Path::Combine(directory, String::StdFormat("%016" PRIx64 ".dat", hash));
+}
+
+/**
+ * Reads the images of a cache file, returns an empty list if there is no valid cache file with the given number of
+ * images.
+ */
+std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ReadImageCache(const std::string& path, size_t count)
+{
+    std::vector<std::unique_ptr<RequiredImage>> result;
+    if (!File::Exists(path))
+    {
+        return result;
+    }
+
+    try
+    {
+        auto data = File::ReadAllBytes(path);
+        auto ms = MemoryStream(data.data(), data.size());
+        if (ms.ReadValue<uint32_t>() != IMAGE_CACHE_MAGIC_NUMBER || ms.ReadValue<uint32_t>() != IMAGE_CACHE_VERSION
+            || ms.ReadValue<uint32_t>() != count)
+        {
+            return result;
+        }
+
+        result.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            rct_g1_element g1{};
+            g1.width = ms.ReadValue<int16_t>();
+            g1.height = ms.ReadValue<int16_t>();
+            g1.x_offset = ms.ReadValue<int16_t>();
+            g1.y_offset = ms.ReadValue<int16_t>();
+            g1.flags = ms.ReadValue<uint16_t>();
+            g1.zoomed_offset = ms.ReadValue<uint16_t>();
+
+            auto length = ms.ReadValue<uint32_t>();
+            auto imageData = std::make_unique<uint8_t[]>(length);
+            ms.Read(imageData.get(), length);
+            result.push_back(std::make_unique<RequiredImage>(g1, std::move(imageData)));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to read image cache '%s': %s", path.c_str(), e.what());
+        result.clear();
     }
     return result;
 }
 
+void ImageTable::WriteImageCache(const std::string& path, const std::vector<const RequiredImage*>& images)
+{
+    MemoryStream ms;
+    ms.WriteValue<uint32_t>(IMAGE_CACHE_MAGIC_NUMBER);
+    ms.WriteValue<uint32_t>(IMAGE_CACHE_VERSION);
+    ms.WriteValue<uint32_t>(static_cast<uint32_t>(images.size()));
+    for (const auto* image : images)
+    {
+        const auto& g1 = image->g1;
+        ms.WriteValue<int16_t>(g1.width);
+        ms.WriteValue<int16_t>(g1.height);
+        ms.WriteValue<int16_t>(g1.x_offset);
+        ms.WriteValue<int16_t>(g1.y_offset);
+        ms.WriteValue<uint16_t>(g1.flags);
+        ms.WriteValue<uint16_t>(g1.zoomed_offset);
+
+        auto length = static_cast<uint32_t>(g1_calculate_data_size(&g1));
+        ms.WriteValue<uint32_t>(length);
+        ms.Write(g1.offset, length);
+    }
+
+    Path::CreateDirectory(Path::GetDirectory(path));
+    auto data = static_cast<const uint8_t*>(ms.GetData());
+    File::WriteAllBytesAsync(path, std::vector<uint8_t>(data, data + ms.GetLength()));
+}
+
 std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectImages(
     IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range)
 {
@@ -202,7 +354,8 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
             if (i >= 0 && i < numImages)
             {
                 result.push_back(std::make_unique<RequiredImage>(
-                    static_cast<uint32_t>(i), [images](uint32_t idx) -> const rct_g1_element* { return &images[idx]; }));
+                    static_cast<uint32_t>(i), [images](uint32_t idx) -> const rct_g1_element* { return &images[idx]; },
+                    true));
             }
             else
             {
@@ -288,16 +441,7 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
     return objectPath;
 }
 
-ImageTable::~ImageTable()
-{
-    if (_data == nullptr)
-    {
-        for (auto& entry : _entries)
-        {
-            delete[] entry.offset;
-        }
-    }
-}
+ImageTable::~ImageTable() = default;
 
 void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 {
@@ -359,6 +503,7 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
         }
 
         _data = std::move(data);
+        _dataSize += dataSize;
         _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
     }
     catch (const std::exception&)
@@ -378,29 +523,62 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
         std::vector<std::unique_ptr<RequiredImage>> allImages;
         auto jsonImages = root["images"];
 
+        // Decoding PNG images is slow, so they are only decoded the first time and taken from the image cache after
+        std::vector<PngImage> pngImages;
         for (auto& jsonImage : jsonImages)
         {
-            if (jsonImage.is_string())
+            if (IsPngImage(jsonImage))
             {
-                auto strImage = jsonImage.get<std::string>();
-                auto images = ParseImages(context, strImage);
-                allImages.insert(
-                    allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+                pngImages.push_back(ReadPngImage(context, jsonImage));
+            }
+        }
+        std::string cachePath;
+        std::vector<std::unique_ptr<RequiredImage>> cachedImages;
+        if (!pngImages.empty())
+        {
+            cachePath = GetImageCachePath(pngImages);
+            cachedImages = ReadImageCache(cachePath, pngImages.size());
+        }
+
+        size_t pngIndex = 0;
+        std::vector<const RequiredImage*> decodedImages;
+        for (auto& jsonImage : jsonImages)
+        {
+            if (IsPngImage(jsonImage))
+            {
+                if (!cachedImages.empty())
+                {
+                    allImages.push_back(std::move(cachedImages[pngIndex]));
+                }
+                else
+                {
+                    allImages.push_back(ImportPngImage(context, pngImages[pngIndex]));
+                    decodedImages.push_back(allImages.back().get());
+                }
+                pngIndex++;
             }
-            else if (jsonImage.is_object())
+            else if (jsonImage.is_string())
             {
-                auto images = ParseImages(context, jsonImage);
+                auto strImage = jsonImage.get<std::string>();
+                auto images = ParseImages(context, strImage);
                 allImages.insert(
                     allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
             }
         }
 
-        // Now add all the images to the image table
+        // Images that could not be loaded are not cached so they are reported again the next time
+        auto allDecoded = std::all_of(
+            decodedImages.begin(), decodedImages.end(), [](const RequiredImage* image) { return image->HasData(); });
+        if (!decodedImages.empty() && allDecoded)
+        {
+            WriteImageCache(cachePath, decodedImages);
+        }
+
+        // Now add all the images to the image table, their data is moved into the table rather than copied again
         auto imagesStartIndex = GetCount();
         for (const auto& img : allImages)
         {
-            const auto& g1 = img->g1;
-            AddImage(&g1);
+            AddImage(img->g1, std::move(img->data));
         }
 
         // Add all the zoom images at the very end of the image table.
@@ -408,7 +586,7 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
         for (size_t j = 0; j < allImages.size(); j++)
         {
             const auto tableIndex = imagesStartIndex + j;
-            const auto* img = allImages[j].get();
+            auto* img = allImages[j].get();
             if (img->next_zoom != nullptr)
             {
                 img = img->next_zoom.get();
@@ -424,7 +602,7 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
                     {
                         g1b.zoomed_offset = -1;
                     }
-                    AddImage(&g1b);
+                    AddImage(g1b, std::move(img->data));
                     img = img->next_zoom.get();
                 }
             }
@@ -434,16 +612,28 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
 
 void ImageTable::AddImage(const rct_g1_element* g1)
 {
-    rct_g1_element newg1 = *g1;
     auto length = g1_calculate_data_size(g1);
     if (length == 0)
     {
+        rct_g1_element newg1 = *g1;
         newg1.offset = nullptr;
+        _entries.push_back(newg1);
     }
     else
     {
-        newg1.offset = new uint8_t[length];
-        std::copy_n(g1->offset, length, newg1.offset);
+        auto data = std::make_unique<uint8_t[]>(length);
+        std::copy_n(g1->offset, length, data.get());
+        AddImage(*g1, std::move(data));
+    }
+}
+
+void ImageTable::AddImage(const rct_g1_element& g1, std::unique_ptr<uint8_t[]> data)
+{
+    auto& newg1 = _entries.emplace_back(g1);
+    if (data != nullptr)
+    {
+        newg1.offset = data.get();
+        _dataSize += g1_calculate_data_size(&newg1);
+        _imageData.push_back(std::move(data));
     }
-    _entries.push_back(newg1);
 }
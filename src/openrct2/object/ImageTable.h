@@ -26,21 +26,32 @@ class ImageTable
 {
 private:
     std::unique_ptr<uint8_t[]> _data;
+    // Pixel data of images added one at a time, images taken from the base graphics point into those instead
+    std::vector<std::unique_ptr<uint8_t[]>> _imageData;
     std::vector<rct_g1_element> _entries;
+    // Size of the pixel data owned by the table
+    size_t _dataSize = 0;
 
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
      */
     struct RequiredImage;
+    struct PngImage;
     static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ParseImages(IReadObjectContext* context, std::string s);
     /**
-     * @note root is deliberately left non-const: json_t behaviour changes when const
+     * @note jsonImage is deliberately left non-const: json_t behaviour changes when const
      */
-    static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ParseImages(IReadObjectContext* context, json_t& el);
+    static PngImage ReadPngImage(IReadObjectContext* context, json_t& jsonImage);
+    static PngImage ReadPngImage(IReadObjectContext* context, const std::string& path);
+    static std::unique_ptr<RequiredImage> ImportPngImage(IReadObjectContext* context, const PngImage& png);
+    static std::string GetImageCachePath(const std::vector<PngImage>& pngImages);
+    static std::vector<std::unique_ptr<RequiredImage>> ReadImageCache(const std::string& path, size_t count);
+    static void WriteImageCache(const std::string& path, const std::vector<const RequiredImage*>& images);
     static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadObjectImages(
         IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
     static std::vector<int32_t> ParseRange(std::string s);
     static std::string FindLegacyObject(const std::string& name);
+    void AddImage(const rct_g1_element& g1, std::unique_ptr<uint8_t[]> data);
 
 public:
     ImageTable() = default;
@@ -61,5 +72,9 @@ public:
     {
         return static_cast<uint32_t>(_entries.size());
     }
+    size_t GetMemoryUsage() const
+    {
+        return _dataSize + _entries.capacity() * sizeof(rct_g1_element);
+    }
     void AddImage(const rct_g1_element* g1);
 };
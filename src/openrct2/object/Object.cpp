@@ -76,14 +76,14 @@ std::string Object::GetString(ObjectStringID index) const
     auto sz = GetOverrideString(static_cast<uint8_t>(index));
     if (sz.empty())
     {
-        sz = GetStringTable().GetString(index);
+        sz = std::string(GetStringTable().GetString(index));
     }
     return sz;
 }
 
 std::string Object::GetString(int32_t language, ObjectStringID index) const
 {
-    return GetStringTable().GetString(language, index);
+    return std::string(GetStringTable().GetString(language, index));
 }
 
 rct_object_entry Object::GetScgWallsHeader()
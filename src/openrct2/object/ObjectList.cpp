@@ -92,23 +92,24 @@ bool find_object_in_entry_group(const rct_object_entry* entry, ObjectType* entry
         return false;
     }
 
+    // Loaded objects are always repository items, so the object is found through the repository lookup rather than
+    // by comparing the entry against every loaded object of its type
     auto& objectMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto maxObjects = object_entry_group_counts[EnumValue(objectType)];
-    for (int32_t i = 0; i < maxObjects; i++)
+    auto loadedObj = objectMgr.GetLoadedObject(entry);
+    if (loadedObj == nullptr || !object_entry_compare(loadedObj->GetObjectEntry(), entry))
     {
-        auto loadedObj = objectMgr.GetLoadedObject(objectType, i);
-        if (loadedObj != nullptr)
-        {
-            auto thisEntry = object_entry_get_entry(objectType, i);
-            if (object_entry_compare(thisEntry, entry))
-            {
-                *entry_type = objectType;
-                *entryIndex = i;
-                return true;
-            }
-        }
+        return false;
     }
-    return false;
+
+    auto index = objectMgr.GetLoadedObjectEntryIndex(loadedObj);
+    if (index == OBJECT_ENTRY_INDEX_NULL || loadedObj->GetObjectType() != objectType)
+    {
+        return false;
+    }
+
+    *entry_type = objectType;
+    *entryIndex = index;
+    return true;
 }
 
 void get_type_entry_index(size_t index, ObjectType* outObjectType, ObjectEntryIndex* outEntryIndex)
@@ -12,8 +12,10 @@
 #include "../Context.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../localisation/StringIds.h"
+#include "../paint/tile_element/Paint.TileElement.h"
 #include "../util/Util.h"
 #include "FootpathItemObject.h"
 #include "LargeSceneryObject.h"
@@ -27,14 +29,25 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <memory>
 #include <mutex>
-#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
+// Number of the slowest objects to log after loading a set of objects
+static constexpr size_t NumSlowestObjectsToLog = 5;
+
 class ObjectManager final : public IObjectManager
 {
 private:
+    struct ObjectLoadTime
+    {
+        const ObjectRepositoryItem* Item = nullptr;
+        double ReadTime = 0;
+        double LoadTime = 0;
+    };
+
     IObjectRepository& _objectRepository;
     std::vector<std::unique_ptr<Object>> _loadedObjects;
     std::array<std::vector<ObjectEntryIndex>, RIDE_TYPE_COUNT> _rideTypeToObjectMap;
@@ -50,6 +63,7 @@ public:
 
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        tile_element_paint_cache_invalidate();
     }
 
     ~ObjectManager() override
@@ -125,6 +139,7 @@ public:
                         _loadedObjects[slot] = std::move(object);
                         UpdateSceneryGroupIndexes();
                         ResetTypeToRideEntryIndexMap();
+                        tile_element_paint_cache_invalidate();
                     }
                 }
             }
@@ -157,6 +172,7 @@ public:
         LoadDefaultObjects();
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        tile_element_paint_cache_invalidate();
         log_verbose("%u / %u new objects loaded", numNewLoadedObjects, requiredObjects.size());
     }
 
@@ -185,6 +201,7 @@ public:
         {
             UpdateSceneryGroupIndexes();
             ResetTypeToRideEntryIndexMap();
+            tile_element_paint_cache_invalidate();
         }
     }
 
@@ -196,6 +213,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        tile_element_paint_cache_invalidate();
     }
 
     void ResetObjects() override
@@ -210,6 +228,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        tile_element_paint_cache_invalidate();
     }
 
     std::vector<const ObjectRepositoryItem*> GetPackableObjects() override
@@ -572,42 +591,34 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     std::vector<std::unique_ptr<Object>> LoadObjects(
         std::vector<const ObjectRepositoryItem*>& requiredObjects, size_t* outNewObjectsLoaded)
     {
+        using Clock = std::chrono::high_resolution_clock;
+
         std::vector<std::unique_ptr<Object>> objects;
         std::vector<Object*> loadedObjects;
         std::vector<rct_object_entry> badObjects;
         objects.resize(OBJECT_ENTRY_COUNT);
         loadedObjects.reserve(OBJECT_ENTRY_COUNT);
 
-        // Read objects
+        // Objects that are already loaded are moved over to the new list, look them up by pointer rather than searching
+        std::unordered_map<const Object*, size_t> loadedObjectIndices;
+        for (size_t i = 0; i < _loadedObjects.size(); i++)
+        {
+            if (_loadedObjects[i] != nullptr)
+            {
+                loadedObjectIndices.emplace(_loadedObjects[i].get(), i);
+            }
+        }
+
+        // Time spent reading and loading each new object, each task only writes the slot of its own object
+        std::vector<ObjectLoadTime> loadTimes(requiredObjects.size());
+
+        // Read objects, the cost of an object varies a lot (a ride with thousands of images against a small scenery
+        // item) so each object is a task of its own for the scheduler to balance
         std::mutex commonMutex;
-        ParallelFor(requiredObjects, [this, &commonMutex, requiredObjects, &objects, &badObjects, &loadedObjects](size_t i) {
+        JobPool::ParallelFor(requiredObjects.size(), 1, [&](size_t i) {
             auto requiredObject = requiredObjects[i];
             std::unique_ptr<Object> object;
             if (requiredObject != nullptr)
@@ -617,7 +628,11 @@ private:
                 {
                     // Object requires to be loaded, if the object successfully loads it will register it
                     // as a loaded object otherwise placed into the badObjects list.
+                    auto startTime = Clock::now();
                     object = _objectRepository.LoadObject(requiredObject);
+                    loadTimes[i].Item = requiredObject;
+                    loadTimes[i].ReadTime = std::chrono::duration<double>(Clock::now() - startTime).count();
+
                     std::lock_guard<std::mutex> guard(commonMutex);
                     if (object == nullptr)
                     {
@@ -637,23 +652,28 @@ private:
                     // we can move the element out safely. This is required as the resulting list must contain all loaded
                     // objects and not just the newly loaded ones.
                     std::lock_guard<std::mutex> guard(commonMutex);
-                    auto it = std::find_if(_loadedObjects.begin(), _loadedObjects.end(), [loadedObject](const auto& obj) {
-                        return obj.get() == loadedObject;
-                    });
-                    if (it != _loadedObjects.end())
+                    auto it = loadedObjectIndices.find(loadedObject);
+                    if (it != loadedObjectIndices.end())
                     {
-                        object = std::move(*it);
+                        object = std::move(_loadedObjects[it->second]);
+                        loadedObjectIndices.erase(it);
                     }
                 }
             }
             objects[i] = std::move(object);
         });
 
-        // Load objects
-        for (auto obj : loadedObjects)
+        // Load objects in the order of the list so that they get the same image ids no matter which thread read them
+        for (size_t i = 0; i < objects.size() && i < loadTimes.size(); i++)
         {
-            obj->Load();
+            if (loadTimes[i].Item != nullptr && objects[i] != nullptr)
+            {
+                auto startTime = Clock::now();
+                objects[i]->Load();
+                loadTimes[i].LoadTime = std::chrono::duration<double>(Clock::now() - startTime).count();
+            }
         }
+        LogSlowestObjects(loadTimes);
 
         if (!badObjects.empty())
         {
@@ -736,6 +756,25 @@ private:
         Console::Error::WriteLine("[%s] Object could not be loaded.", objName);
     }
 
+    static void LogSlowestObjects(std::vector<ObjectLoadTime> loadTimes)
+    {
+        loadTimes.erase(
+            std::remove_if(
+                loadTimes.begin(), loadTimes.end(), [](const ObjectLoadTime& lt) { return lt.Item == nullptr; }),
+            loadTimes.end());
+        std::sort(loadTimes.begin(), loadTimes.end(), [](const ObjectLoadTime& a, const ObjectLoadTime& b) {
+            return a.ReadTime + a.LoadTime > b.ReadTime + b.LoadTime;
+        });
+
+        for (size_t i = 0; i < loadTimes.size() && i < NumSlowestObjectsToLog; i++)
+        {
+            const auto& lt = loadTimes[i];
+            log_verbose(
+                "Object %s took %.2f ms to read and %.2f ms to load", lt.Item->Path.c_str(), lt.ReadTime * 1000,
+                lt.LoadTime * 1000);
+        }
+    }
+
     static int32_t GetIndexFromTypeEntry(ObjectType objectType, size_t entryIndex)
     {
         int32_t result = 0;
@@ -16,15 +16,18 @@
 #include "../core/Console.hpp"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/LocalisationService.h"
 #include "../object/Object.h"
+#include "../platform/Platform2.h"
 #include "../platform/platform.h"
 #include "../rct12/SawyerChunkReader.h"
 #include "../rct12/SawyerChunkWriter.h"
@@ -38,8 +41,13 @@
 #include "RideObject.h"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 // windows.h defines CP_UTF8
@@ -240,6 +248,13 @@ class ObjectRepository final : public IObjectRepository
     ObjectIdentifierMap _newItemMap;
     ObjectEntryMap _itemMap;
 
+    std::unique_ptr<FileWatcher> _objectFileWatcher;
+    std::mutex _changedObjectFilesMutex;
+    std::unordered_set<std::string> _changedObjectFiles;
+    std::future<std::vector<ObjectRepositoryItem>> _reloadedObjects;
+    std::vector<ObjectRepositoryItem> _pendingReloadedObjects;
+    uint32_t _lastHotReloadCheckTick{};
+
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
         : _env(env)
@@ -249,6 +264,11 @@ public:
 
     ~ObjectRepository() final
     {
+        _objectFileWatcher = nullptr;
+        if (_reloadedObjects.valid())
+        {
+            _reloadedObjects.wait();
+        }
         ClearItems();
     }
 
@@ -425,7 +445,128 @@ public:
         }
     }
 
+    void EnableHotReloading() override
+    {
+        try
+        {
+            auto base = _env->GetDirectoryPath(DIRBASE::USER, DIRID::OBJECT);
+            _objectFileWatcher = std::make_unique<FileWatcher>(base);
+            _objectFileWatcher->OnFileChanged = [this](const std::string& path) {
+                std::lock_guard<std::mutex> guard(_changedObjectFilesMutex);
+                _changedObjectFiles.emplace(path);
+            };
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to enable hot reloading of objects: %s", e.what());
+        }
+    }
+
+    /**
+     * Reads the object files changed since the last check on a background thread and swaps the new items into the
+     * repository once they are ready, so the game thread never waits on the disk.
+     */
+    void UpdateHotReloading() override
+    {
+        if (_objectFileWatcher == nullptr)
+            return;
+
+        if (_reloadedObjects.valid() && _reloadedObjects.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            auto items = _reloadedObjects.get();
+            std::move(items.begin(), items.end(), std::back_inserter(_pendingReloadedObjects));
+        }
+
+        auto tick = Platform::GetTicks();
+        if (tick - _lastHotReloadCheckTick <= 1000)
+            return;
+        _lastHotReloadCheckTick = tick;
+
+        // The object selection holds pointers into the item list, only apply the changes while it is closed
+        if (!_pendingReloadedObjects.empty() && window_find_by_class(WC_EDITOR_OBJECT_SELECTION) == nullptr)
+        {
+            ApplyReloadedObjects();
+        }
+
+        std::vector<std::string> paths;
+        {
+            std::lock_guard<std::mutex> guard(_changedObjectFilesMutex);
+            for (const auto& path : _changedObjectFiles)
+            {
+                if (IsObjectFile(path) && File::Exists(path))
+                {
+                    paths.push_back(path);
+                }
+            }
+            _changedObjectFiles.clear();
+        }
+        if (paths.empty() || _reloadedObjects.valid())
+            return;
+
+        auto language = LocalisationService_GetCurrentLanguage();
+        _reloadedObjects = std::async(std::launch::async, [this, language, paths]() {
+            std::vector<ObjectRepositoryItem> items;
+            for (const auto& path : paths)
+            {
+                try
+                {
+                    auto result = _fileIndex.Create(language, path);
+                    if (std::get<0>(result))
+                    {
+                        items.push_back(std::move(std::get<1>(result)));
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    Console::Error::WriteLine("Unable to reload object '%s': %s", path.c_str(), e.what());
+                }
+            }
+            return items;
+        });
+    }
+
 private:
+    static bool IsObjectFile(const std::string& path)
+    {
+        auto extension = Path::GetExtension(path);
+        return String::Equals(extension, ".dat", true) || String::Equals(extension, ".pob", true)
+            || String::Equals(extension, ".json", true) || String::Equals(extension, ".parkobj", true);
+    }
+
+    /**
+     * Swaps the reloaded items into the repository. Items of objects that are loaded stay pending until the object
+     * is unloaded, swapping them would change the park under the game's feet.
+     */
+    void ApplyReloadedObjects()
+    {
+        std::vector<ObjectRepositoryItem> inUse;
+        for (auto& item : _pendingReloadedObjects)
+        {
+            auto existing = std::find_if(_items.begin(), _items.end(), [&item](const ObjectRepositoryItem& ori) {
+                return Path::Equals(ori.Path, item.Path);
+            });
+            if (existing == _items.end())
+            {
+                if (AddItem(item))
+                {
+                    Console::WriteLine("Added object '%s'", item.Path.c_str());
+                }
+            }
+            else if (existing->LoadedObject != nullptr)
+            {
+                inUse.push_back(std::move(item));
+            }
+            else
+            {
+                item.Id = existing->Id;
+                *existing = std::move(item);
+                Console::WriteLine("Reloaded object '%s'", existing->Path.c_str());
+            }
+        }
+        _pendingReloadedObjects = std::move(inUse);
+        BuildLookupTables();
+    }
+
     void ClearItems()
     {
         _items.clear();
@@ -445,7 +586,11 @@ private:
             _items[i].Id = i;
         }
 
-        // Rebuild item map
+        BuildLookupTables();
+    }
+
+    void BuildLookupTables()
+    {
         _itemMap.clear();
         _newItemMap.clear();
         for (size_t i = 0; i < _items.size(); i++)
@@ -85,6 +85,9 @@ struct IObjectRepository
 
     virtual void ExportPackedObject(OpenRCT2::IStream* stream) abstract;
     virtual void WritePackedObjects(OpenRCT2::IStream* stream, std::vector<const ObjectRepositoryItem*>& objects) abstract;
+
+    virtual void EnableHotReloading() abstract;
+    virtual void UpdateHotReloading() abstract;
 };
 
 std::unique_ptr<IObjectRepository> CreateObjectRepository(const std::shared_ptr<OpenRCT2::IPlatformEnvironment>& env);
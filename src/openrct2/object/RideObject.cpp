@@ -24,6 +24,7 @@
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Track.h"
+#include "../ride/VehiclePaint.h"
 #include "ObjectRepository.h"
 
 #include <algorithm>
@@ -361,6 +362,19 @@ void RideObject::Load()
             }
         }
     }
+
+    // Inverted cars can use the sprites of the previous entry, so all image ids need to be set first
+    if (!gOpenRCT2NoGraphics)
+    {
+        for (int32_t i = 0; i < RCT2_MAX_VEHICLES_PER_RIDE_ENTRY; i++)
+        {
+            rct_ride_entry_vehicle* vehicleEntry = &_legacyType.vehicles[i];
+            if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT)
+            {
+                vehicle_sprite_build_lookup(vehicleEntry, i > 0);
+            }
+        }
+    }
 }
 
 void RideObject::Unload()
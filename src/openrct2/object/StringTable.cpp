@@ -48,6 +48,11 @@ static bool StringIsBlank(const utf8* str)
     return true;
 }
 
+StringTable::StringTable()
+{
+    _preferred.fill(NoEntry);
+}
+
 void StringTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream, ObjectStringID id)
 {
     try
@@ -68,6 +73,7 @@ void StringTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream, O
                 entry.LanguageId = languageId;
                 entry.Text = stringAsUtf8;
                 _strings.push_back(entry);
+                AddToIndex(_strings.size() - 1);
             }
         }
     }
@@ -118,28 +124,53 @@ void StringTable::ReadJson(json_t& root)
     Sort();
 }
 
-std::string StringTable::GetString(ObjectStringID id) const
+uint16_t StringTable::GetKey(uint8_t language, ObjectStringID id)
+{
+    return static_cast<uint16_t>((static_cast<uint8_t>(id) << 8) | language);
+}
+
+void StringTable::AddToIndex(size_t index)
 {
-    for (auto& string : _strings)
+    const auto& entry = _strings[index];
+    _keys.push_back(GetKey(entry.LanguageId, entry.Id));
+
+    auto id = static_cast<size_t>(entry.Id);
+    if (id < MaxStringIds && _preferred[id] == NoEntry)
     {
-        if (string.Id == id)
-        {
-            return string.Text;
-        }
+        _preferred[id] = static_cast<uint16_t>(index);
     }
-    return std::string();
 }
 
-std::string StringTable::GetString(uint8_t language, ObjectStringID id) const
+void StringTable::RebuildIndex()
 {
-    for (auto& string : _strings)
+    _keys.clear();
+    _keys.reserve(_strings.size());
+    _preferred.fill(NoEntry);
+    for (size_t i = 0; i < _strings.size(); i++)
     {
-        if (string.LanguageId == language && string.Id == id)
-        {
-            return string.Text;
-        }
+        AddToIndex(i);
+    }
+}
+
+std::string_view StringTable::GetString(ObjectStringID id) const
+{
+    auto index = static_cast<size_t>(id);
+    if (index >= MaxStringIds || _preferred[index] == NoEntry)
+    {
+        return {};
+    }
+    return _strings[_preferred[index]].Text;
+}
+
+std::string_view StringTable::GetString(uint8_t language, ObjectStringID id) const
+{
+    auto key = GetKey(language, id);
+    auto it = std::find(_keys.begin(), _keys.end(), key);
+    if (it == _keys.end())
+    {
+        return {};
     }
-    return std::string();
+    return _strings[it - _keys.begin()].Text;
 }
 
 void StringTable::SetString(ObjectStringID id, uint8_t language, const std::string& text)
@@ -149,6 +180,7 @@ void StringTable::SetString(ObjectStringID id, uint8_t language, const std::stri
     entry.LanguageId = language;
     entry.Text = text;
     _strings.push_back(entry);
+    AddToIndex(_strings.size() - 1);
 }
 
 void StringTable::Sort()
@@ -184,4 +216,5 @@ void StringTable::Sort()
         }
         return a.Id < b.Id;
     });
+    RebuildIndex();
 }
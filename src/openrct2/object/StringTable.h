@@ -13,7 +13,9 @@
 #include "../core/JsonFwd.hpp"
 #include "../localisation/Language.h"
 
+#include <array>
 #include <string>
+#include <string_view>
 #include <vector>
 
 struct IReadObjectContext;
@@ -41,14 +43,29 @@ struct StringTableEntry
     std::string Text;
 };
 
+/**
+ * Strings of an object in all the languages it provides. Lookups go through an index that is kept alongside the
+ * entries, the returned views stay valid until the table is next changed.
+ */
 class StringTable
 {
 private:
+    static constexpr size_t MaxStringIds = static_cast<size_t>(ObjectStringID::VEHICLE_NAME) + 1;
+    static constexpr uint16_t NoEntry = 0xFFFF;
+
     std::vector<StringTableEntry> _strings;
+    // Language and string id of each entry, packed so a lookup does not touch the entries themselves
+    std::vector<uint16_t> _keys;
+    // Entry used for each string id when no language is asked for, the first one after sorting
+    std::array<uint16_t, MaxStringIds> _preferred;
+
     static ObjectStringID ParseStringId(const std::string& s);
+    static uint16_t GetKey(uint8_t language, ObjectStringID id);
+    void AddToIndex(size_t index);
+    void RebuildIndex();
 
 public:
-    StringTable() = default;
+    StringTable();
     StringTable(const StringTable&) = delete;
     StringTable& operator=(const StringTable&) = delete;
 
@@ -58,7 +75,7 @@ public:
      */
     void ReadJson(json_t& root);
     void Sort();
-    std::string GetString(ObjectStringID id) const;
-    std::string GetString(uint8_t language, ObjectStringID id) const;
+    std::string_view GetString(ObjectStringID id) const;
+    std::string_view GetString(uint8_t language, ObjectStringID id) const;
     void SetString(ObjectStringID id, uint8_t language, const std::string& text);
 };
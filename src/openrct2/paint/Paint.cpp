@@ -22,9 +22,13 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <vector>
 
 using namespace OpenRCT2;
 
+PaintArrangeEngine gPaintArrangeEngine = PaintArrangeEngine::Linked;
+bool gPaintHeightCulling = true;
+
 // Globals for paint clipping
 uint8_t gClipHeight = 128; // Default to middle value
 CoordsXY gClipSelectionA = { 0, 0 };
@@ -74,7 +78,7 @@ static constexpr int32_t CalculatePositionHash(const paint_struct& ps, uint8_t r
     return pos.x + pos.y;
 }
 
-static void PaintSessionAddPSToQuadrant(paint_session* session, paint_struct* ps)
+void PaintSessionAddPSToQuadrant(paint_session* session, paint_struct* ps)
 {
     auto positionHash = CalculatePositionHash(*ps, session->CurrentRotation);
     uint32_t paintQuadrantIndex = std::clamp(positionHash / 32, 0, MAX_PAINT_QUADRANTS - 1);
@@ -84,6 +88,11 @@ static void PaintSessionAddPSToQuadrant(paint_session* session, paint_struct* ps
 
     session->QuadrantBackIndex = std::min(session->QuadrantBackIndex, paintQuadrantIndex);
     session->QuadrantFrontIndex = std::max(session->QuadrantFrontIndex, paintQuadrantIndex);
+
+    if (session->Recording != nullptr)
+    {
+        session->Recording->QuadrantEntries.push_back(ps);
+    }
 }
 
 static constexpr bool ImageWithinDPI(const ScreenCoordsXY& imagePos, const rct_g1_element& g1, const rct_drawpixelinfo& dpi)
@@ -196,6 +205,7 @@ void PaintSessionGenerate(paint_session* session)
     uint16_t num_vertical_quadrants = (dpi->height + 2128) >> 5;
 
     session->CurrentRotation = get_current_rotation();
+    tile_element_paint_cache_begin(session);
     switch (get_current_rotation())
     {
         case 0:
@@ -293,6 +303,7 @@ void PaintSessionGenerate(paint_session* session)
             }
             break;
     }
+    tile_element_paint_cache_end(session);
 }
 
 template<uint8_t>
@@ -443,46 +454,204 @@ static paint_struct* PaintArrangeStructsHelper(paint_struct* ps_next, uint16_t q
     return nullptr;
 }
 
+/**
+ * Links the quadrants into a single list starting at the paint head, back to front.
+ */
+static void PaintSessionLinkQuadrants(paint_session* session)
+{
+    paint_struct* ps = &session->PaintHead;
+    ps->next_quadrant_ps = nullptr;
+
+    uint32_t quadrantIndex = session->QuadrantBackIndex;
+    do
+    {
+        paint_struct* ps_next = session->Quadrants[quadrantIndex];
+        if (ps_next != nullptr)
+        {
+            ps->next_quadrant_ps = ps_next;
+            do
+            {
+                ps = ps_next;
+                ps_next = ps_next->next_quadrant_ps;
+
+            } while (ps_next != nullptr);
+        }
+    } while (++quadrantIndex <= session->QuadrantFrontIndex);
+}
+
 /**
  *
  *  rct2: 0x00688217
  */
-void PaintSessionArrange(paint_session* session)
+static void PaintSessionArrangeLinked(paint_session* session)
 {
     paint_struct* psHead = &session->PaintHead;
 
-    paint_struct* ps = psHead;
-    ps->next_quadrant_ps = nullptr;
+    paint_struct* ps_cache = PaintArrangeStructsHelper(
+        psHead, session->QuadrantBackIndex & 0xFFFF, PAINT_QUADRANT_FLAG_NEXT, session->CurrentRotation);
 
     uint32_t quadrantIndex = session->QuadrantBackIndex;
-    if (quadrantIndex != UINT32_MAX)
+    while (++quadrantIndex < session->QuadrantFrontIndex)
+    {
+        ps_cache = PaintArrangeStructsHelper(ps_cache, quadrantIndex & 0xFFFF, 0, session->CurrentRotation);
+    }
+}
+
+/**
+ * The fields of a paint struct the arrangement looks at, kept together so the bounding box comparisons run over a
+ * flat array rather than chasing next_quadrant_ps.
+ */
+struct PaintArrangeNode
+{
+    paint_struct_bound_box Bounds;
+    uint16_t QuadrantIndex;
+    uint8_t QuadrantFlags;
+    paint_struct* PS;
+};
+
+/**
+ * Same steps as PaintArrangeStructsHelperRotation, on the flat array. Index 0 is the paint head. A paint struct that
+ * has to be drawn before an earlier one is rotated into place rather than relinked. Returns the index of the node
+ * the next quadrant continues from.
+ */
+template<uint8_t _TRotation>
+static size_t PaintArrangeNodesHelperRotation(
+    std::vector<PaintArrangeNode>& nodes, size_t start, uint16_t quadrantIndex, uint8_t flag)
+{
+    const size_t count = nodes.size();
+
+    size_t cache = start;
+    while (true)
+    {
+        if (cache + 1 == count)
+            return cache;
+        if (quadrantIndex <= nodes[cache + 1].QuadrantIndex)
+            break;
+        cache++;
+    }
+
+    for (size_t i = cache + 1; i < count; i++)
     {
-        do
+        auto& node = nodes[i];
+        if (node.QuadrantIndex > quadrantIndex + 1)
         {
-            paint_struct* ps_next = session->Quadrants[quadrantIndex];
-            if (ps_next != nullptr)
-            {
-                ps->next_quadrant_ps = ps_next;
-                do
-                {
-                    ps = ps_next;
-                    ps_next = ps_next->next_quadrant_ps;
+            node.QuadrantFlags = PAINT_QUADRANT_FLAG_BIGGER;
+            break;
+        }
+        else if (node.QuadrantIndex == quadrantIndex + 1)
+        {
+            node.QuadrantFlags = PAINT_QUADRANT_FLAG_NEXT | PAINT_QUADRANT_FLAG_IDENTICAL;
+        }
+        else if (node.QuadrantIndex == quadrantIndex)
+        {
+            node.QuadrantFlags = flag | PAINT_QUADRANT_FLAG_IDENTICAL;
+        }
+    }
 
-                } while (ps_next != nullptr);
-            }
-        } while (++quadrantIndex <= session->QuadrantFrontIndex);
+    size_t before = cache;
+    while (true)
+    {
+        while (true)
+        {
+            if (before + 1 == count)
+                return cache;
+            const auto flags = nodes[before + 1].QuadrantFlags;
+            if (flags & PAINT_QUADRANT_FLAG_BIGGER)
+                return cache;
+            if (flags & PAINT_QUADRANT_FLAG_IDENTICAL)
+                break;
+            before++;
+        }
 
-        paint_struct* ps_cache = PaintArrangeStructsHelper(
-            psHead, session->QuadrantBackIndex & 0xFFFF, PAINT_QUADRANT_FLAG_NEXT, session->CurrentRotation);
+        nodes[before + 1].QuadrantFlags &= ~PAINT_QUADRANT_FLAG_IDENTICAL;
+        const paint_struct_bound_box initialBBox = nodes[before + 1].Bounds;
 
-        quadrantIndex = session->QuadrantBackIndex;
-        while (++quadrantIndex < session->QuadrantFrontIndex)
+        for (size_t i = before + 2; i < count; i++)
         {
-            ps_cache = PaintArrangeStructsHelper(ps_cache, quadrantIndex & 0xFFFF, 0, session->CurrentRotation);
+            const auto flags = nodes[i].QuadrantFlags;
+            if (flags & PAINT_QUADRANT_FLAG_BIGGER)
+                break;
+            if (!(flags & PAINT_QUADRANT_FLAG_NEXT))
+                continue;
+
+            if (CheckBoundingBox<_TRotation>(initialBBox, nodes[i].Bounds))
+            {
+                std::rotate(nodes.begin() + before + 1, nodes.begin() + i, nodes.begin() + i + 1);
+            }
         }
     }
 }
 
+static size_t PaintArrangeNodesHelper(
+    std::vector<PaintArrangeNode>& nodes, size_t start, uint16_t quadrantIndex, uint8_t flag, uint8_t rotation)
+{
+    switch (rotation)
+    {
+        case 0:
+            return PaintArrangeNodesHelperRotation<0>(nodes, start, quadrantIndex, flag);
+        case 1:
+            return PaintArrangeNodesHelperRotation<1>(nodes, start, quadrantIndex, flag);
+        case 2:
+            return PaintArrangeNodesHelperRotation<2>(nodes, start, quadrantIndex, flag);
+        case 3:
+            return PaintArrangeNodesHelperRotation<3>(nodes, start, quadrantIndex, flag);
+    }
+    return start;
+}
+
+static void PaintSessionArrangeFlat(paint_session* session)
+{
+    // Reused between calls, each paint thread arranges one session at a time.
+    thread_local std::vector<PaintArrangeNode> nodes;
+    nodes.clear();
+
+    for (paint_struct* ps = &session->PaintHead; ps != nullptr; ps = ps->next_quadrant_ps)
+    {
+        nodes.push_back({ ps->bounds, ps->quadrant_index, 0, ps });
+    }
+
+    size_t cache = PaintArrangeNodesHelper(
+        nodes, 0, session->QuadrantBackIndex & 0xFFFF, PAINT_QUADRANT_FLAG_NEXT, session->CurrentRotation);
+
+    uint32_t quadrantIndex = session->QuadrantBackIndex;
+    while (++quadrantIndex < session->QuadrantFrontIndex)
+    {
+        cache = PaintArrangeNodesHelper(nodes, cache, quadrantIndex & 0xFFFF, 0, session->CurrentRotation);
+    }
+
+    for (size_t i = 1; i < nodes.size(); i++)
+    {
+        nodes[i - 1].PS->next_quadrant_ps = nodes[i].PS;
+        nodes[i].PS->quadrant_flags = nodes[i].QuadrantFlags;
+    }
+    nodes.back().PS->next_quadrant_ps = nullptr;
+}
+
+void PaintSessionArrange(paint_session* session)
+{
+    PaintSessionArrange(session, gPaintArrangeEngine);
+}
+
+void PaintSessionArrange(paint_session* session, PaintArrangeEngine engine)
+{
+    if (session->QuadrantBackIndex == UINT32_MAX)
+    {
+        session->PaintHead.next_quadrant_ps = nullptr;
+        return;
+    }
+
+    PaintSessionLinkQuadrants(session);
+    switch (engine)
+    {
+        case PaintArrangeEngine::Linked:
+            PaintSessionArrangeLinked(session);
+            break;
+        case PaintArrangeEngine::Flat:
+            PaintSessionArrangeFlat(session);
+            break;
+    }
+}
+
 static void PaintDrawStruct(paint_session* session, paint_struct* ps)
 {
     rct_drawpixelinfo* dpi = &session->DPI;
@@ -719,6 +888,67 @@ void PaintSessionFree([[maybe_unused]] paint_session* session)
     GetContext()->GetPainter()->ReleaseSession(session);
 }
 
+PaintEntryPool::Chunk* PaintEntryPool::AllocateChunk()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_freeChunks == nullptr)
+    {
+        _chunks.push_back(std::make_unique<Chunk>());
+        _freeChunks = _chunks.back().get();
+        _freeChunks->Next = nullptr;
+    }
+
+    auto chunk = _freeChunks;
+    _freeChunks = chunk->Next;
+    chunk->Next = nullptr;
+    return chunk;
+}
+
+void PaintEntryPool::FreeChunks(Chunk* chunks)
+{
+    if (chunks == nullptr)
+        return;
+
+    auto last = chunks;
+    while (last->Next != nullptr)
+    {
+        last = last->Next;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    last->Next = _freeChunks;
+    _freeChunks = chunks;
+}
+
+size_t PaintEntryPool::GetChunkCount()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _chunks.size();
+}
+
+bool paint_session::AllocatePaintEntryChunk() noexcept
+{
+    if (EntryPool == nullptr)
+        return false;
+
+    PaintEntryPool::Chunk* chunk;
+    try
+    {
+        chunk = EntryPool->AllocateChunk();
+    }
+    catch (const std::bad_alloc&)
+    {
+        log_error("Unable to allocate paint entries, some sprites will not be drawn.");
+        return false;
+    }
+
+    chunk->Next = PaintEntryChunks;
+    PaintEntryChunks = chunk;
+    NextFreePaintStruct = chunk->Entries;
+    EndOfPaintStructArray = chunk->Entries + std::size(chunk->Entries);
+    return true;
+}
+
 /**
  *  rct2: 0x006861AC, 0x00686337, 0x006864D0, 0x0068666B, 0x0098196C
  *
@@ -14,7 +14,12 @@
 #include "../interface/Colour.h"
 #include "../world/Location.hpp"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 struct TileElement;
+struct TilePaintCache;
 enum ViewportInteractionItem : uint8_t;
 
 #pragma pack(push, 1)
@@ -134,10 +139,60 @@ struct tunnel_entry
 #define MAX_PAINT_QUADRANTS 512
 #define TUNNEL_MAX_COUNT 65
 
+/**
+ * Hands out fixed size chunks of paint entries so that a paint session can grow as far as its view requires.
+ * Chunks given back by a session are kept for the next one, once warmed up painting a frame does not allocate.
+ */
+class PaintEntryPool
+{
+public:
+    static constexpr size_t EntriesPerChunk = 512;
+
+    struct Chunk
+    {
+        paint_entry Entries[EntriesPerChunk];
+        Chunk* Next;
+    };
+
+private:
+    std::vector<std::unique_ptr<Chunk>> _chunks;
+    Chunk* _freeChunks = nullptr;
+    std::mutex _mutex;
+
+public:
+    Chunk* AllocateChunk();
+    void FreeChunks(Chunk* chunks);
+    size_t GetChunkCount();
+};
+
+enum class PaintEntryType : uint8_t
+{
+    Normal,
+    Attached,
+    String,
+};
+
+/**
+ * The paint entries allocated and the paint structs added to quadrants while a recording is attached to a session.
+ */
+struct PaintRecording
+{
+    std::vector<std::pair<paint_entry*, PaintEntryType>> Entries;
+    std::vector<paint_struct*> QuadrantEntries;
+
+    void Clear()
+    {
+        Entries.clear();
+        QuadrantEntries.clear();
+    }
+};
+
 struct paint_session
 {
     rct_drawpixelinfo DPI;
-    paint_entry PaintStructs[4000];
+    PaintEntryPool* EntryPool;
+    // Chunks holding the paint entries of this session, the chunk currently being filled comes first.
+    PaintEntryPool::Chunk* PaintEntryChunks;
     paint_struct* Quadrants[MAX_PAINT_QUADRANTS];
     paint_struct PaintHead;
     uint32_t ViewFlags;
@@ -169,30 +224,37 @@ struct paint_session
     uint8_t Unk141E9DB;
     uint16_t WaterHeight;
     uint32_t TrackColours[4];
+    TilePaintCache* TileCache;
+    PaintRecording* Recording;
 
-    constexpr bool NoPaintStructsAvailable() noexcept
+    bool NoPaintStructsAvailable() noexcept
     {
-        return NextFreePaintStruct >= EndOfPaintStructArray;
+        return NextFreePaintStruct >= EndOfPaintStructArray && !AllocatePaintEntryChunk();
     }
 
-    constexpr paint_struct* AllocateNormalPaintEntry(paint_struct&& entry) noexcept
+    bool AllocatePaintEntryChunk() noexcept;
+
+    paint_struct* AllocateNormalPaintEntry(paint_struct&& entry) noexcept
     {
+        RecordPaintEntry(PaintEntryType::Normal);
         NextFreePaintStruct->basic = entry;
         LastPS = &NextFreePaintStruct->basic;
         NextFreePaintStruct++;
         return LastPS;
     }
 
-    constexpr attached_paint_struct* AllocateAttachedPaintEntry(attached_paint_struct&& entry) noexcept
+    attached_paint_struct* AllocateAttachedPaintEntry(attached_paint_struct&& entry) noexcept
     {
+        RecordPaintEntry(PaintEntryType::Attached);
         NextFreePaintStruct->attached = entry;
         LastAttachedPS = &NextFreePaintStruct->attached;
         NextFreePaintStruct++;
         return LastAttachedPS;
     }
 
-    constexpr paint_string_struct* AllocateStringPaintEntry(paint_string_struct&& entry) noexcept
+    paint_string_struct* AllocateStringPaintEntry(paint_string_struct&& entry) noexcept
     {
+        RecordPaintEntry(PaintEntryType::String);
         NextFreePaintStruct->string = entry;
         if (LastPSString == nullptr)
         {
@@ -206,10 +268,40 @@ struct paint_session
         NextFreePaintStruct++;
         return LastPSString;
     }
+
+private:
+    void RecordPaintEntry(PaintEntryType type)
+    {
+        if (Recording != nullptr)
+        {
+            Recording->Entries.emplace_back(NextFreePaintStruct, type);
+        }
+    }
+};
+
+/**
+ * A paint session copied out for the sprite sort benchmark. The paint entries of all chunks are flattened into
+ * Entries in allocation order and the quadrant links hold indices into it, Entries.size() standing in for nullptr.
+ */
+struct RecordedPaintSession
+{
+    paint_session Session;
+    std::vector<paint_entry> Entries;
 };
 
 extern paint_session gPaintSession;
 
+enum class PaintArrangeEngine : uint8_t
+{
+    // Sorts the quadrant linked lists in place.
+    Linked,
+    // Sorts a flat copy of the quadrant lists, then relinks them.
+    Flat,
+};
+extern PaintArrangeEngine gPaintArrangeEngine;
+// Skip tiles whose tallest element can not reach the view before they are looked up in the tile paint cache.
+extern bool gPaintHeightCulling;
+
 // Globals for paint clipping
 extern uint8_t gClipHeight;
 extern CoordsXY gClipSelectionA;
@@ -266,7 +358,9 @@ void PaintFloatingMoneyEffect(
 paint_session* PaintSessionAlloc(rct_drawpixelinfo* dpi, uint32_t viewFlags);
 void PaintSessionFree(paint_session* session);
 void PaintSessionGenerate(paint_session* session);
+void PaintSessionAddPSToQuadrant(paint_session* session, paint_struct* ps);
 void PaintSessionArrange(paint_session* session);
+void PaintSessionArrange(paint_session* session, PaintArrangeEngine engine);
 void PaintDrawStructs(paint_session* session);
 void PaintDrawMoneyStructs(rct_drawpixelinfo* dpi, paint_string_struct* ps);
 
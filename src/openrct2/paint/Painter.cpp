@@ -9,6 +9,7 @@
 
 #include "Painter.h"
 
+#include "../FrameProfiler.h"
 #include "../Game.h"
 #include "../Intro.h"
 #include "../OpenRCT2.h"
@@ -18,6 +19,8 @@
 #include "../drawing/IDrawingEngine.h"
 #include "../interface/Chat.h"
 #include "../interface/InteractiveConsole.h"
+#include "../interface/Viewport.h"
+#include "../interface/Window.h"
 #include "../localisation/FormatCodes.h"
 #include "../localisation/Language.h"
 #include "../paint/Paint.h"
@@ -43,22 +46,41 @@ void Painter::Paint(IDrawingEngine& de)
     }
     else
     {
-        de.PaintWindows();
+        {
+            FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Invalidation);
+            window_flush_invalidations();
+            viewports_flush_invalidations();
+        }
+        {
+            FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Windows);
+            de.PaintWindows();
+        }
 
-        update_palette_effects();
-        _uiContext->Draw(dpi);
+        {
+            FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Interface);
+            update_palette_effects();
+            _uiContext->Draw(dpi);
+        }
 
         if ((gScreenFlags & SCREEN_FLAGS_TITLE_DEMO) && !title_should_hide_version_info())
         {
+            FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Text);
             DrawOpenRCT2(dpi, { 0, _uiContext->GetHeight() - 20 });
         }
 
-        gfx_draw_pickedup_peep(dpi);
-        gfx_invalidate_pickedup_peep();
+        {
+            FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Interface);
+            gfx_draw_pickedup_peep(dpi);
+            gfx_invalidate_pickedup_peep();
+        }
 
-        de.PaintWeather();
+        {
+            FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Weather);
+            de.PaintWeather();
+        }
     }
 
+    FrameProfiler::ScopedStage profileStage(FrameProfiler::Stage::Text);
     auto* replayManager = GetContext()->GetReplayManager();
     const char* text = nullptr;
 
@@ -76,6 +98,10 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(dpi);
     }
+    if (gConfigGeneral.show_frame_timings)
+    {
+        PaintFrameTimings(dpi);
+    }
     gCurrentDrawCount++;
 }
 
@@ -127,6 +153,41 @@ void Painter::PaintFPS(rct_drawpixelinfo* dpi)
     gfx_set_dirty_blocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { gLastDrawStringX + 16, 16 } });
 }
 
+void Painter::PaintFrameTimings(rct_drawpixelinfo* dpi)
+{
+    // Top right corner below the toolbar, clear of the FPS counter in the middle
+    ScreenCoordsXY screenCoords(_uiContext->GetWidth() - 150, 30);
+    const ScreenCoordsXY topLeft = screenCoords;
+    int32_t maxWidth = 0;
+
+    auto drawLine = [&](std::string_view name, const FrameProfiler::StageSummary& summary) {
+        utf8 buffer[64] = { 0 };
+        utf8* ch = buffer;
+        ch = utf8_write_codepoint(ch, FORMAT_SMALLFONT);
+        ch = utf8_write_codepoint(ch, FORMAT_OUTLINE);
+        ch = utf8_write_codepoint(ch, FORMAT_WHITE);
+
+        snprintf(
+            ch, 64 - (ch - buffer), "%.*s: %.2f / %.2f ms", static_cast<int>(name.size()), name.data(),
+            summary.Mean * 1000, summary.Longest * 1000);
+
+        gfx_draw_string(dpi, buffer, 0, screenCoords);
+        maxWidth = std::max(maxWidth, gfx_get_string_width(buffer));
+        screenCoords.y += 10;
+    };
+
+    for (size_t i = 0; i < FrameProfiler::StageCount; i++)
+    {
+        const auto stage = static_cast<FrameProfiler::Stage>(i);
+        drawLine(FrameProfiler::GetStageName(stage), FrameProfiler::GetStageSummary(stage));
+    }
+    drawLine("total", FrameProfiler::GetTotalSummary());
+    drawLine("tick_lateness", FrameProfiler::GetTickLatenessSummary());
+
+    // Make area dirty so the text doesn't get drawn over the last
+    gfx_set_dirty_blocks({ topLeft - ScreenCoordsXY{ 4, 4 }, screenCoords + ScreenCoordsXY{ maxWidth + 4, 4 } });
+}
+
 void Painter::MeasureFPS()
 {
     _frames++;
@@ -161,8 +222,11 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
     }
 
     session->DPI = *dpi;
-    session->EndOfPaintStructArray = &session->PaintStructs[4000 - 1];
-    session->NextFreePaintStruct = session->PaintStructs;
+    session->EntryPool = &_paintEntryPool;
+    session->PaintEntryChunks = nullptr;
+    // The first chunk is taken on the first paint struct allocation.
+    session->EndOfPaintStructArray = nullptr;
+    session->NextFreePaintStruct = nullptr;
     session->LastPS = nullptr;
     session->LastAttachedPS = nullptr;
     session->ViewFlags = viewFlags;
@@ -177,11 +241,17 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
     session->WoodenSupportsPrependTo = nullptr;
     session->CurrentlyDrawnItem = nullptr;
     session->SurfaceElement = nullptr;
+    session->TileCache = nullptr;
+    session->Recording = nullptr;
 
     return session;
 }
 
 void Painter::ReleaseSession(paint_session* session)
 {
+    _paintEntryPool.FreeChunks(session->PaintEntryChunks);
+    session->PaintEntryChunks = nullptr;
+    session->EndOfPaintStructArray = nullptr;
+    session->NextFreePaintStruct = nullptr;
     _freePaintSessions.push_back(session);
 }
@@ -36,6 +36,7 @@ namespace OpenRCT2
         {
         private:
             std::shared_ptr<Ui::IUiContext> const _uiContext;
+            PaintEntryPool _paintEntryPool;
             std::vector<std::unique_ptr<paint_session>> _paintSessionPool;
             std::vector<paint_session*> _freePaintSessions;
             time_t _lastSecond = 0;
@@ -52,6 +53,7 @@ namespace OpenRCT2
         private:
             void PaintReplayNotice(rct_drawpixelinfo* dpi, const char* text);
             void PaintFPS(rct_drawpixelinfo* dpi);
+            void PaintFrameTimings(rct_drawpixelinfo* dpi);
             void MeasureFPS();
         };
     } // namespace Paint
@@ -449,6 +449,27 @@ static constexpr const uint16_t word_97B3C4[] = {
 };
 // clang-format on
 
+// From this zoom level on, the stacked pieces of a support column are a few pixels tall each
+static constexpr ZoomLevel SupportColumnLodZoom = 2;
+
+/**
+ * Adds a piece of a support column. When zoomed out, pieces above the first one are added as children of the one
+ * below rather than as paint structs of their own, tall coasters otherwise fill the paint sort with these.
+ */
+static void PaintSupportColumnPiece(
+    paint_session* session, bool& columnStarted, uint32_t imageId, const CoordsXYZ& offset, const CoordsXYZ& boundBoxLength)
+{
+    if (columnStarted && session->DPI.zoom_level >= SupportColumnLodZoom)
+    {
+        PaintAddImageAsChild(session, imageId, offset, boundBoxLength, offset);
+    }
+    else
+    {
+        PaintAddImageAsParent(session, imageId, offset, boundBoxLength);
+    }
+    columnStarted = true;
+}
+
 /**
  * Adds paint structs for wooden supports.
  *  rct2: 0x006629BC
@@ -567,6 +588,7 @@ bool wooden_a_supports_paint_setup(
     }
 
     // Draw repeated supports for left over space
+    bool columnStarted = false;
     while (height != 0)
     {
         if ((z & 16) == 0 && height >= 2 && z + 16 != session->WaterHeight)
@@ -574,7 +596,7 @@ bool wooden_a_supports_paint_setup(
             // Full support
             int32_t imageId = WoodenSupportImageIds[supportType].full | imageColourFlags;
             uint8_t ah = height == 2 ? 23 : 28;
-            PaintAddImageAsParent(session, imageId, 0, 0, 32, 32, ah, z);
+            PaintSupportColumnPiece(session, columnStarted, imageId, { 0, 0, z }, { 32, 32, ah });
             hasSupports = true;
             z += 32;
             height -= 2;
@@ -584,7 +606,7 @@ bool wooden_a_supports_paint_setup(
             // Half support
             int32_t imageId = WoodenSupportImageIds[supportType].half | imageColourFlags;
             uint8_t ah = height == 1 ? 7 : 12;
-            PaintAddImageAsParent(session, imageId, 0, 0, 32, 32, ah, z);
+            PaintSupportColumnPiece(session, columnStarted, imageId, { 0, 0, z }, { 32, 32, ah });
             hasSupports = true;
             z += 16;
             height -= 1;
@@ -934,6 +956,7 @@ bool metal_a_supports_paint_setup(
     height += heightDiff;
     // 6632e6
 
+    bool columnStarted = false;
     for (uint8_t count = 0;; count++)
     {
         if (count >= 4)
@@ -959,7 +982,7 @@ bool metal_a_supports_paint_setup(
         if (count == 3 && z == 0x10)
             image_id++;
 
-        PaintAddImageAsParent(session, image_id, xOffset, yOffset, 0, 0, z - 1, height);
+        PaintSupportColumnPiece(session, columnStarted, image_id, { xOffset, yOffset, height }, { 0, 0, z - 1 });
 
         height += z;
     }
@@ -1122,6 +1145,7 @@ bool metal_b_supports_paint_setup(
 
     int16_t endHeight;
 
+    bool columnStarted = false;
     int32_t i = 1;
     while (true)
     {
@@ -1149,9 +1173,9 @@ bool metal_b_supports_paint_setup(
             }
         }
 
-        PaintAddImageAsParent(
-            session, imageId | imageColourFlags, SupportBoundBoxes[segment].x, SupportBoundBoxes[segment].y, 0, 0,
-            beamLength - 1, baseHeight);
+        PaintSupportColumnPiece(
+            session, columnStarted, imageId | imageColourFlags, { SupportBoundBoxes[segment], baseHeight },
+            { 0, 0, beamLength - 1 });
 
         baseHeight += beamLength;
         i++;
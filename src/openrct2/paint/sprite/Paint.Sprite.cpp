@@ -19,6 +19,98 @@
 #include "../../world/Sprite.h"
 #include "../Paint.h"
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+struct sprite_paint_entry
+{
+    int16_t left;
+    int16_t top;
+    int16_t right;
+    int16_t bottom;
+    uint16_t spriteIndex;
+};
+
+/**
+ * Entities bucketed by tile with their screen bounds inline, so a paint column can reject the entities outside its DPI
+ * without reading each sprite. Rebuilt by the first paint after any entity moves.
+ */
+struct sprite_paint_index
+{
+    std::mutex mutex;
+    std::atomic<uint64_t> revision{ 0 };
+    std::vector<uint32_t> tileStarts;
+    std::vector<sprite_paint_entry> entries;
+
+    // Scratch space for the rebuild
+    std::vector<sprite_paint_entry> unsorted;
+    std::vector<uint32_t> unsortedTiles;
+    std::vector<uint32_t> nextSlot;
+};
+
+static sprite_paint_index _spritePaintIndex;
+
+static constexpr size_t SPRITE_PAINT_INDEX_NUM_TILES = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+
+static uint64_t sprite_paint_index_get_revision()
+{
+    return (static_cast<uint64_t>(GetEntityListRevision()) << 32) | GetEntitySpatialRevision();
+}
+
+static void sprite_paint_index_rebuild(sprite_paint_index& index)
+{
+    index.tileStarts.assign(SPRITE_PAINT_INDEX_NUM_TILES + 1, 0);
+    index.unsorted.clear();
+    index.unsortedTiles.clear();
+
+    // Visit sprites in descending index order, which is the order the quadrant lists keep. Only the hot fields are read.
+    const auto& hot = gSpriteHotFields;
+    for (int32_t i = static_cast<int32_t>(sprite_get_allocated_count()) - 1; i >= 0; i--)
+    {
+        if (hot.ListId[i] == EntityListId::Free)
+            continue;
+        const int32_t x = hot.X[i];
+        const int32_t y = hot.Y[i];
+        if (x < 0 || x >= MAXIMUM_MAP_SIZE_BIG || y < 0 || y >= MAXIMUM_MAP_SIZE_BIG)
+            continue;
+
+        uint32_t tileIndex = (x / COORDS_XY_STEP) * MAXIMUM_MAP_SIZE_TECHNICAL + (y / COORDS_XY_STEP);
+        index.unsorted.push_back({ hot.Left[i], hot.Top[i], hot.Right[i], hot.Bottom[i], static_cast<uint16_t>(i) });
+        index.unsortedTiles.push_back(tileIndex);
+        index.tileStarts[tileIndex + 1]++;
+    }
+
+    for (size_t i = 0; i < SPRITE_PAINT_INDEX_NUM_TILES; i++)
+    {
+        index.tileStarts[i + 1] += index.tileStarts[i];
+    }
+
+    // Stable counting sort into the tile buckets
+    index.entries.resize(index.unsorted.size());
+    index.nextSlot.assign(index.tileStarts.begin(), index.tileStarts.end() - 1);
+    for (size_t i = 0; i < index.unsorted.size(); i++)
+    {
+        index.entries[index.nextSlot[index.unsortedTiles[i]]++] = index.unsorted[i];
+    }
+}
+
+static const sprite_paint_index& sprite_paint_index_get()
+{
+    // Paint sessions can run on several threads at once, but entities never move while they do
+    auto revision = sprite_paint_index_get_revision();
+    if (_spritePaintIndex.revision.load(std::memory_order_acquire) != revision)
+    {
+        std::lock_guard<std::mutex> lock(_spritePaintIndex.mutex);
+        if (_spritePaintIndex.revision.load(std::memory_order_relaxed) != revision)
+        {
+            sprite_paint_index_rebuild(_spritePaintIndex);
+            _spritePaintIndex.revision.store(revision, std::memory_order_release);
+        }
+    }
+    return _spritePaintIndex;
+}
+
 /**
  * Paint Quadrant
  *  rct2: 0x0069E8B0
@@ -43,8 +135,26 @@ void sprite_paint_setup(paint_session* session, const uint16_t x, const uint16_t
 
     const bool highlightPathIssues = (session->ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES);
 
-    for (const auto* spr : EntityTileList({ x, y }))
+    const auto& index = sprite_paint_index_get();
+    size_t tileIndex = (x / COORDS_XY_STEP) * MAXIMUM_MAP_SIZE_TECHNICAL + (y / COORDS_XY_STEP);
+    for (uint32_t i = index.tileStarts[tileIndex]; i < index.tileStarts[tileIndex + 1]; i++)
     {
+        const auto& entry = index.entries[i];
+
+        dpi = &session->DPI;
+
+        if (dpi->y + dpi->height <= entry.top || entry.bottom <= dpi->y || dpi->x + dpi->width <= entry.left
+            || entry.right <= dpi->x)
+        {
+            continue;
+        }
+
+        const auto* spr = GetEntity(entry.spriteIndex);
+        if (spr == nullptr)
+        {
+            continue;
+        }
+
         if (highlightPathIssues)
         {
             const auto peep = spr->As<Peep>();
@@ -81,14 +191,6 @@ void sprite_paint_setup(paint_session* session, const uint16_t x, const uint16_t
             }
         }
 
-        dpi = &session->DPI;
-
-        if (dpi->y + dpi->height <= spr->sprite_top || spr->sprite_bottom <= dpi->y || dpi->x + dpi->width <= spr->sprite_left
-            || spr->sprite_right <= dpi->x)
-        {
-            continue;
-        }
-
         int32_t image_direction = session->CurrentRotation;
         image_direction <<= 3;
         image_direction += spr->sprite_direction;
@@ -29,6 +29,7 @@
 #include "Paint.TileElement.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iterator>
 
@@ -291,16 +292,57 @@ static constexpr const tile_surface_boundary_data _tileSurfaceBoundaries[4] =
 };
 // clang-format on
 
-static const TerrainSurfaceObject* get_surface_object(size_t index)
+/**
+ * The loaded terrain objects by index. Every surface tile asks for its own and its neighbours' objects several times,
+ * so they are resolved once per thread instead of going through the object manager each time.
+ */
+struct surface_paint_objects
 {
-    TerrainSurfaceObject* result{};
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::TerrainSurface, index);
-    if (obj != nullptr)
+    uint32_t generation = 0;
+    const TerrainSurfaceObject* surfaces[MAX_TERRAIN_SURFACE_OBJECTS]{};
+    const TerrainEdgeObject* edges[MAX_TERRAIN_EDGE_OBJECTS]{};
+};
+
+static std::atomic<uint32_t> _surfacePaintObjectsGeneration = { 1 };
+
+static const surface_paint_objects& get_surface_paint_objects()
+{
+    thread_local surface_paint_objects objects;
+    auto generation = _surfacePaintObjectsGeneration.load(std::memory_order_relaxed);
+    if (objects.generation != generation)
     {
-        return static_cast<TerrainSurfaceObject*>(obj);
+        auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
+        for (size_t i = 0; i < std::size(objects.surfaces); i++)
+        {
+            objects.surfaces[i] = static_cast<TerrainSurfaceObject*>(objMgr.GetLoadedObject(ObjectType::TerrainSurface, i));
+        }
+        for (size_t i = 0; i < std::size(objects.edges); i++)
+        {
+            objects.edges[i] = static_cast<TerrainEdgeObject*>(objMgr.GetLoadedObject(ObjectType::TerrainEdge, i));
+        }
+        objects.generation = generation;
     }
-    return result;
+    return objects;
+}
+
+/**
+ * Drops the resolved terrain objects, required whenever objects are loaded or unloaded.
+ */
+void surface_paint_invalidate_objects()
+{
+    _surfacePaintObjectsGeneration++;
+}
+
+static const TerrainSurfaceObject* get_surface_object(size_t index)
+{
+    const auto& objects = get_surface_paint_objects();
+    return index < std::size(objects.surfaces) ? objects.surfaces[index] : nullptr;
+}
+
+static const TerrainEdgeObject* get_edge_object(size_t index)
+{
+    const auto& objects = get_surface_paint_objects();
+    return index < std::size(objects.edges) ? objects.edges[index] : nullptr;
 }
 
 static uint32_t get_surface_image(
@@ -359,12 +401,10 @@ static bool surface_should_smooth(uint8_t index)
 static uint32_t get_edge_image_with_offset(uint8_t index, uint32_t offset)
 {
     uint32_t result = 0;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::TerrainEdge, index);
+    auto obj = get_edge_object(index);
     if (obj != nullptr)
     {
-        auto tobj = static_cast<TerrainEdgeObject*>(obj);
-        return tobj->BaseImageId + offset;
+        return obj->BaseImageId + offset;
     }
     return result;
 }
@@ -392,12 +432,10 @@ static uint32_t get_tunnel_image(ObjectEntryIndex index, uint8_t type)
                                                              36, 48, 60, 72, 76, 80, 84, 88, 92, 96, 100 };
 
     bool hasDoors = false;
-    auto& objMgr = OpenRCT2::GetContext()->GetObjectManager();
-    auto obj = objMgr.GetLoadedObject(ObjectType::TerrainEdge, index);
+    auto obj = get_edge_object(index);
     if (obj != nullptr)
     {
-        auto tobj = static_cast<TerrainEdgeObject*>(obj);
-        hasDoors = tobj->HasDoors;
+        hasDoors = obj->HasDoors;
     }
 
     if (!hasDoors && type >= REGULAR_TUNNEL_TYPE_COUNT && type < std::size(offsets))
@@ -9,20 +9,25 @@
 
 #include "Paint.TileElement.h"
 
+#include "../../Cheats.h"
 #include "../../Game.h"
 #include "../../Input.h"
+#include "../../OpenRCT2.h"
 #include "../../config/Config.h"
 #include "../../drawing/Drawing.h"
 #include "../../interface/Viewport.h"
 #include "../../localisation/Localisation.h"
+#include "../../peep/Staff.h"
 #include "../../ride/RideData.h"
 #include "../../ride/TrackData.h"
+#include "../../ride/TrackDesign.h"
 #include "../../ride/TrackPaint.h"
 #include "../../sprites.h"
 #include "../../world/Banner.h"
 #include "../../world/Entrance.h"
 #include "../../world/Footpath.h"
 #include "../../world/Scenery.h"
+#include "../../world/SmallScenery.h"
 #include "../../world/Sprite.h"
 #include "../../world/Surface.h"
 #include "../Paint.h"
@@ -31,6 +36,13 @@
 #include "Paint.Surface.h"
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 #ifdef __TESTPAINT__
 uint16_t testPaintVerticalTunnelHeight;
@@ -38,10 +50,92 @@ uint16_t testPaintVerticalTunnelHeight;
 
 static void blank_tiles_paint(paint_session* session, int32_t x, int32_t y);
 static void sub_68B3FB(paint_session* session, int32_t x, int32_t y);
+#ifndef __TESTPAINT__
+static void tile_element_paint_setup_cached(paint_session* session, int32_t x, int32_t y);
+#endif
 
 const int32_t SEGMENTS_ALL = SEGMENT_B4 | SEGMENT_B8 | SEGMENT_BC | SEGMENT_C0 | SEGMENT_C4 | SEGMENT_C8 | SEGMENT_CC
     | SEGMENT_D0 | SEGMENT_D4;
 
+/**
+ * Screen y of the tile's top corner at height 0, before zoom.
+ */
+static int32_t tile_element_paint_get_screen_y(uint8_t rotation, int32_t x, int32_t y)
+{
+    switch (rotation)
+    {
+        case 0:
+            return (x + y) >> 1;
+        case 1:
+            return (y - (x + 32)) >> 1;
+        case 2:
+            return (-(x + 32 + y + 32)) >> 1;
+        case 3:
+            return (x - (y + 32)) >> 1;
+    }
+    return 0;
+}
+
+/**
+ * The tallest thing sub_68B3FB expects the tile to draw, used to skip tiles that can not reach the view.
+ */
+static uint16_t tile_element_paint_get_max_height(const TileElement* element, bool partOfVirtualFloor)
+{
+    uint16_t max_height = 0;
+    do
+    {
+        max_height = std::max(max_height, static_cast<uint16_t>(element->GetClearanceZ()));
+    } while (!(element++)->IsLastForTile());
+
+    element--;
+
+    if (element->GetType() == TILE_ELEMENT_TYPE_SURFACE && (element->AsSurface()->GetWaterHeight() > 0))
+    {
+        max_height = element->AsSurface()->GetWaterHeight();
+    }
+
+#ifndef __TESTPAINT__
+    if (partOfVirtualFloor)
+    {
+        // We must pretend this tile is at least as tall as the virtual floor
+        max_height = std::max(max_height, virtual_floor_get_height());
+    }
+#endif // __TESTPAINT__
+
+    return max_height;
+}
+
+#ifndef __TESTPAINT__
+/**
+ * Whether sub_68B3FB would leave the tile without painting anything, because the tile is entirely above the view or
+ * its tallest element does not reach up into it. Most tiles a paint column walks lie below the view, only in case
+ * something tall on them pokes up into it. Checking this before the tile cache saves hashing the tile and its
+ * neighbours for them. Uses the exact same bounds as sub_68B3FB, so it never changes the image.
+ */
+static bool tile_element_paint_is_out_of_view(paint_session* session, int32_t x, int32_t y)
+{
+    if ((session->ViewFlags & VIEWPORT_FLAG_CLIP_VIEW) || gConfigGeneral.virtual_floor_style != VirtualFloorStyles::Off)
+        return false;
+
+    // The selection arrow is painted before sub_68B3FB culls the tile.
+    if ((gMapSelectFlags & MAP_SELECT_FLAG_ENABLE_ARROW) && x == gMapSelectArrowPosition.x && y == gMapSelectArrowPosition.y)
+        return false;
+
+    const TileElement* tileElement = map_get_first_element_at({ x, y });
+    if (tileElement == nullptr)
+        return false;
+
+    const rct_drawpixelinfo* dpi = &session->DPI;
+    int32_t dx = tile_element_paint_get_screen_y(session->CurrentRotation, x, y);
+    if (dx + 52 <= dpi->y)
+        return true;
+
+    dx -= tile_element_paint_get_max_height(tileElement, false) + 32;
+    dx -= dpi->height;
+    return dx >= dpi->y;
+}
+#endif
+
 /**
  *
  *  rct2: 0x0068B35F
@@ -55,6 +149,20 @@ void tile_element_paint_setup(paint_session* session, int32_t x, int32_t y)
         session->Unk141E9DB = 0;
         session->WaterHeight = 0xFFFF;
 
+#ifndef __TESTPAINT__
+        if (gPaintHeightCulling && tile_element_paint_is_out_of_view(session, x, y))
+        {
+            // Sprites painted after this tile still take their map position from it.
+            session->MapPosition = { x, y };
+            return;
+        }
+
+        if (session->TileCache != nullptr)
+        {
+            tile_element_paint_setup_cached(session, x, y);
+            return;
+        }
+#endif
         sub_68B3FB(session, x, y);
     }
     else if (!(session->ViewFlags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND))
@@ -167,27 +275,20 @@ static void sub_68B3FB(paint_session* session, int32_t x, int32_t y)
     }
 #endif // __TESTPAINT__
 
-    int32_t dx = 0;
+    int32_t dx = tile_element_paint_get_screen_y(rotation, x, y);
     switch (rotation)
     {
-        case 0:
-            dx = x + y;
-            break;
         case 1:
             x += 32;
-            dx = y - x;
             break;
         case 2:
             x += 32;
             y += 32;
-            dx = -(x + y);
             break;
         case 3:
             y += 32;
-            dx = x - y;
             break;
     }
-    dx >>= 1;
     // Display little yellow arrow when building footpaths?
     if ((gMapSelectFlags & MAP_SELECT_FLAG_ENABLE_ARROW) && session->MapPosition.x == gMapSelectArrowPosition.x
         && session->MapPosition.y == gMapSelectArrowPosition.y)
@@ -208,32 +309,8 @@ static void sub_68B3FB(paint_session* session, int32_t x, int32_t y)
     if (bx <= dpi->y)
         return;
 
-    const TileElement* element = tile_element; // push tile_element
-
-    uint16_t max_height = 0;
-    do
-    {
-        max_height = std::max(max_height, static_cast<uint16_t>(element->GetClearanceZ()));
-    } while (!(element++)->IsLastForTile());
-
-    element--;
-
-    if (element->GetType() == TILE_ELEMENT_TYPE_SURFACE && (element->AsSurface()->GetWaterHeight() > 0))
-    {
-        max_height = element->AsSurface()->GetWaterHeight();
-    }
-
-#ifndef __TESTPAINT__
-    if (partOfVirtualFloor)
-    {
-        // We must pretend this tile is at least as tall as the virtual floor
-        max_height = std::max(max_height, virtual_floor_get_height());
-    }
-#endif // __TESTPAINT__
-
+    uint16_t max_height = tile_element_paint_get_max_height(tile_element, partOfVirtualFloor);
     dx -= max_height + 32;
-
-    element = tile_element; // pop tile_element
     dx -= dpi->height;
     if (dx >= dpi->y)
         return;
@@ -383,6 +460,553 @@ static void sub_68B3FB(paint_session* session, int32_t x, int32_t y)
     }
 }
 
+#ifndef __TESTPAINT__
+
+// Marks a session pointer that a cached tile left as it was, or set to nullptr. Other values are entry indices.
+static constexpr uint32_t TilePaintPointerUnchanged = std::numeric_limits<uint32_t>::max();
+static constexpr uint32_t TilePaintPointerNull = TilePaintPointerUnchanged - 1;
+
+// Number of session generations a column cache may go unused before it is dropped.
+static constexpr uint32_t TilePaintCacheMaxAge = 4096;
+static constexpr size_t TilePaintCacheMaxColumns = 1024;
+
+/**
+ * The session state a tile leaves behind for the sprites and tiles that are painted after it.
+ */
+struct TilePaintState
+{
+    CoordsXY SpritePosition;
+    CoordsXY MapPosition;
+    const void* CurrentlyDrawnItem;
+    ViewportInteractionItem InteractionType;
+    support_height SupportSegments[9];
+    support_height Support;
+    tunnel_entry LeftTunnels[TUNNEL_MAX_COUNT];
+    uint8_t LeftTunnelCount;
+    tunnel_entry RightTunnels[TUNNEL_MAX_COUNT];
+    uint8_t RightTunnelCount;
+    uint8_t VerticalTunnelHeight;
+    const TileElement* SurfaceElement;
+    TileElement* PathElementOnSameHeight;
+    TileElement* TrackElementOnSameHeight;
+    bool DidPassSurface;
+    uint8_t Unk141E9DB;
+    uint16_t WaterHeight;
+};
+
+/**
+ * The paint entries a tile generated, with the pointers between them stored as entry index + 1 so that they can be
+ * copied into any session.
+ */
+struct TilePaintCacheEntry
+{
+    uint64_t Key;
+    uint32_t LastUsed;
+    bool Valid;
+    std::vector<paint_entry> Entries;
+    std::vector<PaintEntryType> EntryTypes;
+    std::vector<uint32_t> QuadrantEntries;
+    uint32_t LastPS;
+    uint32_t LastAttachedPS;
+    uint32_t WoodenSupportsPrependTo;
+    TilePaintState State;
+};
+
+/**
+ * Cached tiles for one paint column. The paint structs generated for a tile depend on the area being painted, so each
+ * distinct column has its own cache and a column is only ever painted by one thread at a time.
+ */
+struct TilePaintCache
+{
+    uint32_t Generation;
+    uint32_t LastUsed;
+    uint32_t Uses;
+    bool InUse;
+    std::unordered_map<uint32_t, TilePaintCacheEntry> Tiles;
+    PaintRecording Recording;
+    std::vector<paint_entry*> ReplayEntries;
+};
+
+static std::unordered_map<uint64_t, std::unique_ptr<TilePaintCache>> _tilePaintCaches;
+static std::mutex _tilePaintCacheMutex;
+static uint32_t _tilePaintCacheClock;
+static std::atomic<uint32_t> _tilePaintCacheGeneration = { 0 };
+
+static constexpr uint64_t TilePaintHashBasis = 0xCBF29CE484222325;
+
+static uint64_t tile_paint_hash(uint64_t hash, const void* data, size_t size)
+{
+    auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
+
+template<typename T> static uint64_t tile_paint_hash(uint64_t hash, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    return tile_paint_hash(hash, &value, sizeof(value));
+}
+
+/**
+ * Any global state that changes what tile elements paint as.
+ */
+static uint64_t tile_paint_cache_get_global_hash()
+{
+    uint64_t hash = TilePaintHashBasis;
+    hash = tile_paint_hash(hash, gMapSelectFlags);
+    hash = tile_paint_hash(hash, gMapSelectType);
+    hash = tile_paint_hash(hash, gMapSelectPositionA);
+    hash = tile_paint_hash(hash, gMapSelectPositionB);
+    hash = tile_paint_hash(hash, gMapSelectArrowPosition);
+    hash = tile_paint_hash(hash, gMapSelectArrowDirection);
+    for (const auto& tile : gMapSelectionTiles)
+    {
+        hash = tile_paint_hash(hash, tile);
+    }
+    for (const auto& spawn : gPeepSpawns)
+    {
+        hash = tile_paint_hash(hash, spawn);
+    }
+    hash = tile_paint_hash(hash, gMapBaseZ);
+    hash = tile_paint_hash(hash, gClipHeight);
+    hash = tile_paint_hash(hash, gClipSelectionA);
+    hash = tile_paint_hash(hash, gClipSelectionB);
+    hash = tile_paint_hash(hash, gScreenFlags);
+    hash = tile_paint_hash(hash, gCheatsSandboxMode);
+    hash = tile_paint_hash(hash, gPaintWidePathsAsGhost);
+    hash = tile_paint_hash(hash, gPaintBlockedTiles);
+    hash = tile_paint_hash(hash, gShowSupportSegmentHeights);
+    hash = tile_paint_hash(hash, gConfigGeneral.landscape_smoothing);
+    return hash;
+}
+
+/**
+ * Whether an element always paints the same for the same element data, i.e. it has no animation, scrolling text or
+ * dependency on ride state.
+ */
+static bool tile_paint_cache_is_element_static(const TileElement& element)
+{
+    switch (element.GetType())
+    {
+        case TILE_ELEMENT_TYPE_SURFACE:
+            return true;
+        case TILE_ELEMENT_TYPE_PATH:
+            return !element.AsPath()->IsQueue();
+        case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+        {
+            auto entry = element.AsSmallScenery()->GetEntry();
+            return entry != nullptr && !scenery_small_entry_has_flag(entry, SMALL_SCENERY_FLAG_ANIMATED);
+        }
+        case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+        {
+            auto entry = element.AsLargeScenery()->GetEntry();
+            return entry != nullptr && entry->large_scenery.scrolling_mode == SCROLLING_MODE_NONE;
+        }
+        case TILE_ELEMENT_TYPE_WALL:
+        {
+            auto entry = element.AsWall()->GetEntry();
+            return entry != nullptr && entry->wall.scrolling_mode == SCROLLING_MODE_NONE
+                && !(entry->wall.flags2 & WALL_SCENERY_2_ANIMATED);
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * Hashes everything painting the tile depends on: its own elements, the neighbouring elements surface edges are
+ * drawn against and the session state carried over from the previous tile. Returns std::nullopt if the tile can not
+ * be cached.
+ */
+static std::optional<uint64_t> tile_paint_cache_get_key(const paint_session* session, const CoordsXY& pos)
+{
+    const TileElement* firstElement = map_get_first_element_at(pos);
+    if (firstElement == nullptr)
+        return std::nullopt;
+
+    uint64_t hash = TilePaintHashBasis;
+    hash = tile_paint_hash(hash, pos);
+    hash = tile_paint_hash(hash, firstElement);
+    hash = tile_paint_hash(hash, session->LastPS != nullptr);
+    hash = tile_paint_hash(hash, session->LastAttachedPS != nullptr);
+    hash = tile_paint_hash(hash, session->WoodenSupportsPrependTo != nullptr);
+
+    const TileElement* element = firstElement;
+    do
+    {
+        if (!tile_paint_cache_is_element_static(*element))
+            return std::nullopt;
+        hash = tile_paint_hash(hash, *element);
+    } while (!(element++)->IsLastForTile());
+
+    for (const auto& offset : CoordsDirectionDelta)
+    {
+        element = map_get_first_element_at(pos + offset);
+        if (element == nullptr)
+            continue;
+        do
+        {
+            hash = tile_paint_hash(hash, *element);
+        } while (!(element++)->IsLastForTile());
+    }
+    return hash;
+}
+
+static void tile_paint_state_save(const paint_session* session, TilePaintState& state)
+{
+    state.SpritePosition = session->SpritePosition;
+    state.MapPosition = session->MapPosition;
+    state.CurrentlyDrawnItem = session->CurrentlyDrawnItem;
+    state.InteractionType = session->InteractionType;
+    std::copy(std::begin(session->SupportSegments), std::end(session->SupportSegments), state.SupportSegments);
+    state.Support = session->Support;
+    std::copy(std::begin(session->LeftTunnels), std::end(session->LeftTunnels), state.LeftTunnels);
+    state.LeftTunnelCount = session->LeftTunnelCount;
+    std::copy(std::begin(session->RightTunnels), std::end(session->RightTunnels), state.RightTunnels);
+    state.RightTunnelCount = session->RightTunnelCount;
+    state.VerticalTunnelHeight = session->VerticalTunnelHeight;
+    state.SurfaceElement = session->SurfaceElement;
+    state.PathElementOnSameHeight = session->PathElementOnSameHeight;
+    state.TrackElementOnSameHeight = session->TrackElementOnSameHeight;
+    state.DidPassSurface = session->DidPassSurface;
+    state.Unk141E9DB = session->Unk141E9DB;
+    state.WaterHeight = session->WaterHeight;
+}
+
+static void tile_paint_state_load(paint_session* session, const TilePaintState& state)
+{
+    session->SpritePosition = state.SpritePosition;
+    session->MapPosition = state.MapPosition;
+    session->CurrentlyDrawnItem = state.CurrentlyDrawnItem;
+    session->InteractionType = state.InteractionType;
+    std::copy(std::begin(state.SupportSegments), std::end(state.SupportSegments), session->SupportSegments);
+    session->Support = state.Support;
+    std::copy(std::begin(state.LeftTunnels), std::end(state.LeftTunnels), session->LeftTunnels);
+    session->LeftTunnelCount = state.LeftTunnelCount;
+    std::copy(std::begin(state.RightTunnels), std::end(state.RightTunnels), session->RightTunnels);
+    session->RightTunnelCount = state.RightTunnelCount;
+    session->VerticalTunnelHeight = state.VerticalTunnelHeight;
+    session->SurfaceElement = state.SurfaceElement;
+    session->PathElementOnSameHeight = state.PathElementOnSameHeight;
+    session->TrackElementOnSameHeight = state.TrackElementOnSameHeight;
+    session->DidPassSurface = state.DidPassSurface;
+    session->Unk141E9DB = state.Unk141E9DB;
+    session->WaterHeight = state.WaterHeight;
+}
+
+/**
+ * Paint structs that were already in the session when the tile started, the tile may link its own structs to them.
+ */
+struct TilePaintExternals
+{
+    paint_struct* LastPS;
+    attached_paint_struct* LastAttachedPS;
+    paint_struct* WoodenSupportsPrependTo;
+    attached_paint_struct* LastPSAttached;
+    paint_struct* LastPSChildren;
+    attached_paint_struct* LastAttachedPSNext;
+    paint_struct* WoodenSupportsPrependToChildren;
+
+    explicit TilePaintExternals(const paint_session* session)
+        : LastPS(session->LastPS)
+        , LastAttachedPS(session->LastAttachedPS)
+        , WoodenSupportsPrependTo(session->WoodenSupportsPrependTo)
+        , LastPSAttached(LastPS != nullptr ? LastPS->attached_ps : nullptr)
+        , LastPSChildren(LastPS != nullptr ? LastPS->children : nullptr)
+        , LastAttachedPSNext(LastAttachedPS != nullptr ? LastAttachedPS->next : nullptr)
+        , WoodenSupportsPrependToChildren(WoodenSupportsPrependTo != nullptr ? WoodenSupportsPrependTo->children : nullptr)
+    {
+    }
+
+    bool WereModified() const
+    {
+        return (LastPS != nullptr && (LastPS->attached_ps != LastPSAttached || LastPS->children != LastPSChildren))
+            || (LastAttachedPS != nullptr && LastAttachedPS->next != LastAttachedPSNext)
+            || (WoodenSupportsPrependTo != nullptr && WoodenSupportsPrependTo->children != WoodenSupportsPrependToChildren);
+    }
+};
+
+/**
+ * Converts the recorded entries of a tile into a cache entry. Returns false if the tile linked its paint structs to
+ * anything it did not create itself.
+ */
+static bool tile_paint_cache_store(
+    const paint_session* session, const PaintRecording& recording, const TilePaintExternals& externals,
+    TilePaintCacheEntry& entry)
+{
+    if (externals.WereModified())
+        return false;
+
+    const auto& recorded = recording.Entries;
+    auto getIndex = [&recorded](const void* ptr) -> std::optional<uint32_t> {
+        for (size_t i = 0; i < recorded.size(); i++)
+        {
+            if (recorded[i].first == ptr)
+                return static_cast<uint32_t>(i);
+        }
+        return std::nullopt;
+    };
+    auto encode = [&getIndex](auto* ptr, auto*& out) {
+        if (ptr == nullptr)
+        {
+            out = nullptr;
+            return true;
+        }
+        auto index = getIndex(ptr);
+        if (!index)
+            return false;
+        out = reinterpret_cast<std::remove_reference_t<decltype(out)>>(static_cast<uintptr_t>(*index) + 1);
+        return true;
+    };
+    auto encodeSessionPointer = [&getIndex](const void* ptr, const void* startPtr) -> std::optional<uint32_t> {
+        if (ptr == startPtr)
+            return TilePaintPointerUnchanged;
+        if (ptr == nullptr)
+            return TilePaintPointerNull;
+        return getIndex(ptr);
+    };
+
+    entry.Entries.resize(recorded.size());
+    entry.EntryTypes.resize(recorded.size());
+    for (size_t i = 0; i < recorded.size(); i++)
+    {
+        const auto& source = *recorded[i].first;
+        auto& target = entry.Entries[i];
+        target = source;
+        entry.EntryTypes[i] = recorded[i].second;
+        switch (recorded[i].second)
+        {
+            case PaintEntryType::Normal:
+                target.basic.next_quadrant_ps = nullptr;
+                if (!encode(source.basic.attached_ps, target.basic.attached_ps)
+                    || !encode(source.basic.children, target.basic.children))
+                {
+                    return false;
+                }
+                break;
+            case PaintEntryType::Attached:
+                if (!encode(source.attached.next, target.attached.next))
+                    return false;
+                break;
+            case PaintEntryType::String:
+                return false;
+        }
+    }
+
+    entry.QuadrantEntries.clear();
+    for (auto ps : recording.QuadrantEntries)
+    {
+        auto index = getIndex(ps);
+        if (!index)
+            return false;
+        entry.QuadrantEntries.push_back(*index);
+    }
+
+    auto lastPS = encodeSessionPointer(session->LastPS, externals.LastPS);
+    auto lastAttachedPS = encodeSessionPointer(session->LastAttachedPS, externals.LastAttachedPS);
+    auto woodenSupportsPrependTo = encodeSessionPointer(
+        session->WoodenSupportsPrependTo, externals.WoodenSupportsPrependTo);
+    if (!lastPS || !lastAttachedPS || !woodenSupportsPrependTo)
+        return false;
+    entry.LastPS = *lastPS;
+    entry.LastAttachedPS = *lastAttachedPS;
+    entry.WoodenSupportsPrependTo = *woodenSupportsPrependTo;
+
+    tile_paint_state_save(session, entry.State);
+    return true;
+}
+
+static void tile_paint_cache_replay(paint_session* session, TilePaintCache& cache, const TilePaintCacheEntry& entry)
+{
+    auto& entries = cache.ReplayEntries;
+    entries.resize(entry.Entries.size());
+    for (size_t i = 0; i < entry.Entries.size(); i++)
+    {
+        // Out of memory, drop the whole tile rather than leave it half linked.
+        if (session->NoPaintStructsAvailable())
+            return;
+
+        entries[i] = session->NextFreePaintStruct++;
+        *entries[i] = entry.Entries[i];
+    }
+
+    auto decode = [&entries](auto*& ptr) {
+        if (ptr != nullptr)
+        {
+            auto index = reinterpret_cast<uintptr_t>(ptr) - 1;
+            ptr = reinterpret_cast<std::remove_reference_t<decltype(ptr)>>(entries[index]);
+        }
+    };
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        if (entry.EntryTypes[i] == PaintEntryType::Normal)
+        {
+            decode(entries[i]->basic.attached_ps);
+            decode(entries[i]->basic.children);
+        }
+        else
+        {
+            decode(entries[i]->attached.next);
+        }
+    }
+    for (auto index : entry.QuadrantEntries)
+    {
+        PaintSessionAddPSToQuadrant(session, &entries[index]->basic);
+    }
+
+    if (entry.LastPS != TilePaintPointerUnchanged)
+        session->LastPS = entry.LastPS == TilePaintPointerNull ? nullptr : &entries[entry.LastPS]->basic;
+    if (entry.LastAttachedPS != TilePaintPointerUnchanged)
+        session->LastAttachedPS = entry.LastAttachedPS == TilePaintPointerNull ? nullptr
+                                                                               : &entries[entry.LastAttachedPS]->attached;
+    if (entry.WoodenSupportsPrependTo != TilePaintPointerUnchanged)
+        session->WoodenSupportsPrependTo = entry.WoodenSupportsPrependTo == TilePaintPointerNull
+            ? nullptr
+            : &entries[entry.WoodenSupportsPrependTo]->basic;
+    tile_paint_state_load(session, entry.State);
+}
+
+/**
+ * Paints a tile from the column cache when its contents have not changed since the last time, records it otherwise.
+ */
+static void tile_element_paint_setup_cached(paint_session* session, int32_t x, int32_t y)
+{
+    auto& cache = *session->TileCache;
+    auto key = tile_paint_cache_get_key(session, { x, y });
+    if (!key)
+    {
+        sub_68B3FB(session, x, y);
+        return;
+    }
+
+    const uint32_t tileIndex = (static_cast<uint32_t>(x / COORDS_XY_STEP) << 16) | static_cast<uint32_t>(y / COORDS_XY_STEP);
+    auto& entry = cache.Tiles[tileIndex];
+    entry.LastUsed = cache.Uses;
+    if (entry.Valid && entry.Key == *key)
+    {
+        tile_paint_cache_replay(session, cache, entry);
+        return;
+    }
+
+    TilePaintExternals externals(session);
+    cache.Recording.Clear();
+    session->Recording = &cache.Recording;
+    sub_68B3FB(session, x, y);
+    session->Recording = nullptr;
+
+    entry.Key = *key;
+    entry.Valid = tile_paint_cache_store(session, cache.Recording, externals, entry);
+}
+
+void tile_element_paint_cache_begin(paint_session* session)
+{
+    session->TileCache = nullptr;
+
+    // Patrol areas, track design selections and the virtual floor are not part of the tile data.
+    if (gStaffDrawPatrolAreas != SPRITE_INDEX_NULL || gTrackDesignSaveMode || virtual_floor_is_enabled())
+        return;
+
+    const auto& dpi = session->DPI;
+    uint64_t key = tile_paint_cache_get_global_hash();
+    key = tile_paint_hash(key, dpi.x);
+    key = tile_paint_hash(key, dpi.y);
+    key = tile_paint_hash(key, dpi.width);
+    key = tile_paint_hash(key, dpi.height);
+    key = tile_paint_hash(key, static_cast<int8_t>(dpi.zoom_level));
+    key = tile_paint_hash(key, session->CurrentRotation);
+    key = tile_paint_hash(key, session->ViewFlags);
+
+    std::lock_guard<std::mutex> lock(_tilePaintCacheMutex);
+    _tilePaintCacheClock++;
+    if (_tilePaintCacheClock % TilePaintCacheMaxAge == 0 || _tilePaintCaches.size() >= TilePaintCacheMaxColumns)
+    {
+        for (auto it = _tilePaintCaches.begin(); it != _tilePaintCaches.end();)
+        {
+            const auto& column = *it->second;
+            // Start over if there are too many columns, views are most likely being scrolled.
+            const bool isOld = _tilePaintCacheClock - column.LastUsed >= TilePaintCacheMaxAge
+                || _tilePaintCaches.size() >= TilePaintCacheMaxColumns;
+            if (!column.InUse && isOld)
+                it = _tilePaintCaches.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    auto& cache = _tilePaintCaches[key];
+    if (cache == nullptr)
+    {
+        cache = std::make_unique<TilePaintCache>();
+        cache->Generation = _tilePaintCacheGeneration;
+    }
+    else if (cache->InUse)
+    {
+        // Another session is painting the same area, leave it to that one.
+        return;
+    }
+
+    if (cache->Generation != _tilePaintCacheGeneration)
+    {
+        cache->Generation = _tilePaintCacheGeneration;
+        cache->Tiles.clear();
+    }
+    cache->InUse = true;
+    cache->LastUsed = _tilePaintCacheClock;
+    cache->Uses++;
+    session->TileCache = cache.get();
+}
+
+void tile_element_paint_cache_end(paint_session* session)
+{
+    auto cache = session->TileCache;
+    if (cache == nullptr)
+        return;
+
+    // A column paints the same tiles every time, tiles not painted now can no longer be cached.
+    for (auto it = cache->Tiles.begin(); it != cache->Tiles.end();)
+    {
+        if (it->second.LastUsed != cache->Uses)
+            it = cache->Tiles.erase(it);
+        else
+            ++it;
+    }
+
+    std::lock_guard<std::mutex> lock(_tilePaintCacheMutex);
+    cache->InUse = false;
+    session->TileCache = nullptr;
+}
+
+/**
+ * Drops all cached tiles, required whenever the tile element storage moves or objects are loaded or unloaded.
+ */
+void tile_element_paint_cache_invalidate()
+{
+    _tilePaintCacheGeneration++;
+    surface_paint_invalidate_objects();
+}
+
+#else
+
+void tile_element_paint_cache_begin(paint_session* session)
+{
+    session->TileCache = nullptr;
+}
+
+void tile_element_paint_cache_end(paint_session* session)
+{
+}
+
+void tile_element_paint_cache_invalidate()
+{
+    surface_paint_invalidate_objects();
+}
+
+#endif // __TESTPAINT__
+
 void paint_util_push_tunnel_left(paint_session* session, uint16_t height, uint8_t type)
 {
     session->LeftTunnels[session->LeftTunnelCount] = { static_cast<uint8_t>((height / 16)), type };
@@ -101,10 +101,14 @@ void paint_util_set_segment_support_height(paint_session* session, int32_t segme
 uint16_t paint_util_rotate_segments(uint16_t segments, uint8_t rotation);
 
 void tile_element_paint_setup(paint_session* session, int32_t x, int32_t y);
+void tile_element_paint_cache_begin(paint_session* session);
+void tile_element_paint_cache_end(paint_session* session);
+void tile_element_paint_cache_invalidate();
 
 void entrance_paint(paint_session* session, uint8_t direction, int32_t height, const TileElement* tile_element);
 void banner_paint(paint_session* session, uint8_t direction, int32_t height, const TileElement* tile_element);
 void surface_paint(paint_session* session, uint8_t direction, uint16_t height, const TileElement* tileElement);
+void surface_paint_invalidate_objects();
 void path_paint(paint_session* session, uint16_t height, const TileElement* tileElement);
 void scenery_paint(paint_session* session, uint8_t direction, int32_t height, const TileElement* tileElement);
 void fence_paint(paint_session* session, uint8_t direction, int32_t height, const TileElement* tileElement);
@@ -1900,6 +1900,38 @@ Ride* Guest::FindBestRideToGoOn()
     return mostExcitingRide;
 }
 
+/**
+ * Calls fn with the ride index of every track element on the tiles within 10 tiles of the given location. Most tiles
+ * around a guest are path or scenery, those are skipped without reading their elements.
+ */
+template<typename TFn> static void peep_for_each_nearby_track_ride(const CoordsXY& loc, TFn fn)
+{
+    constexpr auto searchRadius = 10 * 32;
+    int32_t cx = floor2(loc.x, 32);
+    int32_t cy = floor2(loc.y, 32);
+    for (int32_t tileX = cx - searchRadius; tileX <= cx + searchRadius; tileX += COORDS_XY_STEP)
+    {
+        for (int32_t tileY = cy - searchRadius; tileY <= cy + searchRadius; tileY += COORDS_XY_STEP)
+        {
+            if (!map_is_location_valid({ tileX, tileY }))
+                continue;
+            if (!map_tile_may_contain({ tileX, tileY }, TILE_ELEMENT_TYPE_TRACK))
+                continue;
+
+            auto tileElement = map_get_first_element_at({ tileX, tileY });
+            if (tileElement == nullptr)
+                continue;
+            do
+            {
+                if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
+                {
+                    fn(tileElement->AsTrack()->GetRideIndex());
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+}
+
 std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
 {
     std::bitset<MAX_RIDES> rideConsideration;
@@ -1921,30 +1953,9 @@ std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
     else
     {
         // Take nearby rides into consideration
-        constexpr auto radius = 10 * 32;
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
-            {
-                if (map_is_location_valid({ tileX, tileY }))
-                {
-                    auto tileElement = map_get_first_element_at({ tileX, tileY });
-                    if (tileElement != nullptr)
-                    {
-                        do
-                        {
-                            if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
-                            {
-                                auto rideIndex = tileElement->AsTrack()->GetRideIndex();
-                                rideConsideration[rideIndex] = true;
-                            }
-                        } while (!(tileElement++)->IsLastForTile());
-                    }
-                }
-            }
-        }
+        peep_for_each_nearby_track_ride({ x, y }, [&rideConsideration](ride_id_t rideIndex) {
+            rideConsideration[rideIndex] = true;
+        });
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         for (auto& ride : GetRideManager())
@@ -3025,15 +3036,7 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
         }
     }
 
-    for (auto litter : EntityList<Litter>(EntityListId::Litter))
-    {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
-        {
-            num_rubbish++;
-        }
-    }
+    ForEachEntityInRange<Litter>(CoordsXY{ centre_x, centre_y }, 160, [&num_rubbish](Litter*) { num_rubbish++; });
 
     if (num_fountains >= 5 && num_rubbish < 20)
         return PEEP_THOUGHT_TYPE_FOUNTAINS;
@@ -3183,34 +3186,16 @@ template<typename T> static void peep_head_for_nearest_ride(Guest* peep, bool co
     else
     {
         // Take nearby rides into consideration
-        constexpr auto searchRadius = 10 * 32;
-        int32_t cx = floor2(peep->x, 32);
-        int32_t cy = floor2(peep->y, 32);
-        for (auto x = cx - searchRadius; x <= cx + searchRadius; x += COORDS_XY_STEP)
-        {
-            for (auto y = cy - searchRadius; y <= cy + searchRadius; y += COORDS_XY_STEP)
+        peep_for_each_nearby_track_ride({ peep->x, peep->y }, [&rideConsideration, &predicate](ride_id_t rideIndex) {
+            if (!rideConsideration[rideIndex])
             {
-                if (map_is_location_valid({ x, y }))
+                auto ride = get_ride(rideIndex);
+                if (ride != nullptr && predicate(*ride))
                 {
-                    auto tileElement = map_get_first_element_at({ x, y });
-                    if (tileElement != nullptr)
-                    {
-                        do
-                        {
-                            if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
-                            {
-                                auto rideIndex = tileElement->AsTrack()->GetRideIndex();
-                                auto ride = get_ride(rideIndex);
-                                if (ride != nullptr && predicate(*ride))
-                                {
-                                    rideConsideration[rideIndex] = true;
-                                }
-                            }
-                        } while (!(tileElement++)->IsLastForTile());
-                    }
+                    rideConsideration[rideIndex] = true;
                 }
             }
-        }
+        });
     }
 
     // Filter the considered rides
@@ -5381,6 +5366,13 @@ void Guest::UpdateWalking()
         }
     }
 
+    // Sit out the walking updates of the steps that were already taken, actions still play in the meantime
+    if (SimulationLodWalkDelay > 0 && (Action == PeepActionType::None1 || Action == PeepActionType::None2))
+    {
+        SimulationLodWalkDelay--;
+        return;
+    }
+
     // Check if vehicle is blocking the destination tile
     auto curPos = TileCoordsXYZ(CoordsXYZ{ x, y, z });
     auto dstPos = TileCoordsXYZ(CoordsXYZ{ DestinationX, DestinationY, NextLoc.z });
@@ -6274,9 +6266,10 @@ static void peep_update_walking_break_scenery(Peep* peep)
         return;
     }
 
-    for (auto inner_peep : EntityList<Staff>(EntityListId::Peep))
+    for (auto spriteIndex : staff_get_sprite_indices())
     {
-        if (inner_peep->AssignedStaffType != StaffType::Security)
+        auto inner_peep = GetEntity<Staff>(spriteIndex);
+        if (inner_peep == nullptr || inner_peep->AssignedStaffType != StaffType::Security)
             continue;
 
         if (inner_peep->x == LOCATION_NULL)
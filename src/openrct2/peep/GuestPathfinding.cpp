@@ -17,10 +17,16 @@
 #include "../util/Util.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/Park.h"
 #include "Peep.h"
 #include "Staff.h"
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 static bool _peepPathFindIsStaff;
 static int8_t _peepPathFindNumJunctions;
@@ -41,6 +47,67 @@ utf8 gPathFindDebugPeepName[256];
 
 static int32_t guest_surface_path_finding(Peep* peep);
 
+/* Results of the heuristic search along a single edge of a junction.
+ * Everything the search reads from the guest goes into the key, so a
+ * cached result is exactly what the search would return for any guest
+ * with the same goal, history and limits. The cache only has to be
+ * cleared when the paths it walked over may have changed, see
+ * peep_pathfind_cache_invalidate(). Staff are never cached as their
+ * searches also depend on their patrol areas. */
+struct PathSearchKey
+{
+    TileCoordsXYZ Start;
+    TileCoordsXYZ Goal;
+    rct12_xyzd8 History[4];
+    int32_t TilesChecked;
+    ride_id_t QueueRideIndex;
+    uint8_t Edge;
+    uint8_t MaxJunctions;
+    uint8_t IgnoreForeignQueues;
+    uint8_t Padding[3];
+
+    bool operator==(const PathSearchKey& other) const
+    {
+        return std::memcmp(this, &other, sizeof(PathSearchKey)) == 0;
+    }
+};
+
+// The key is compared and hashed as raw bytes so it must not contain any implicit padding
+static_assert(sizeof(PathSearchKey) == 52);
+
+struct PathSearchKeyHash
+{
+    size_t operator()(const PathSearchKey& key) const
+    {
+        // FNV-1a
+        auto data = reinterpret_cast<const uint8_t*>(&key);
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < sizeof(PathSearchKey); i++)
+        {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+        return hash;
+    }
+};
+
+struct PathSearchResult
+{
+    uint16_t Score;
+    uint8_t Steps;
+};
+
+// Stops the cache from growing unbounded on large parks between path edits
+static constexpr size_t PathSearchCacheMaxEntries = 1 << 16;
+
+static std::unordered_map<PathSearchKey, PathSearchResult, PathSearchKeyHash> _peepPathSearchCache;
+
+/* Whether each path element the searches have passed over is a thin junction,
+ * see path_is_thin_junction(). This only depends on the path and its
+ * neighbours so it is kept across searches and cleared along with the search
+ * cache. The key is the location together with the properties of the path
+ * element that decide which neighbours are looked at. */
+static std::unordered_map<uint64_t, bool> _pathThinJunctionCache;
+
 /* A junction history for the peep pathfinding heuristic search
  * The magic number 16 is the largest value returned by
  * peep_pathfind_get_max_number_junctions() which should eventually
@@ -509,7 +576,7 @@ static uint8_t peep_pathfind_get_max_number_junctions(Peep* peep)
  * since entrances and ride queues coming off a path should not result in
  * the path being considered a junction.
  */
-static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
+static bool path_is_thin_junction_uncached(PathElement* path, const TileCoordsXYZ& loc)
 {
     uint8_t edges = path->GetEdges();
 
@@ -541,6 +608,267 @@ static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
     return thin_junction;
 }
 
+static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
+{
+    uint64_t key = static_cast<uint16_t>(loc.x);
+    key |= static_cast<uint64_t>(static_cast<uint16_t>(loc.y)) << 16;
+    key |= static_cast<uint64_t>(static_cast<uint16_t>(loc.z)) << 32;
+    key |= static_cast<uint64_t>(path->GetEdges()) << 48;
+    key |= static_cast<uint64_t>(path->IsSloped()) << 52;
+    key |= static_cast<uint64_t>(path->GetSlopeDirection() & 3) << 53;
+
+    auto it = _pathThinJunctionCache.find(key);
+    if (it != _pathThinJunctionCache.end())
+        return it->second;
+
+    bool result = path_is_thin_junction_uncached(path, loc);
+    if (_pathThinJunctionCache.size() >= PathSearchCacheMaxEntries)
+        _pathThinJunctionCache.clear();
+    _pathThinJunctionCache.emplace(key, result);
+    return result;
+}
+
+/* Route fields for the long range pathfinding park option.
+ * A route field holds the number of steps from every path element that can
+ * reach a goal to that goal, found by a breadth first search outwards from the
+ * goal. Guests then only need to step towards the neighbour closest to the goal
+ * rather than run the heuristic search, which gives up after a set number of
+ * junctions. As with the search cache the fields only depend on the paths and
+ * are dropped in peep_pathfind_cache_invalidate(). */
+struct RouteFieldKey
+{
+    TileCoordsXYZ Goal;
+    ride_id_t QueueRideIndex;
+    bool IgnoreForeignQueues;
+
+    bool operator==(const RouteFieldKey& other) const
+    {
+        return Goal == other.Goal && QueueRideIndex == other.QueueRideIndex
+            && IgnoreForeignQueues == other.IgnoreForeignQueues;
+    }
+};
+
+struct RouteField
+{
+    RouteFieldKey Key;
+    // Pairs of node key and steps to the goal, sorted by node key
+    std::vector<std::pair<uint32_t, uint16_t>> Steps;
+};
+
+// Each field has an entry for every path element connected to its goal, so only a few are kept
+static constexpr size_t RouteFieldMaxCount = 16;
+static constexpr size_t RouteFieldMaxNodes = 0xFFFF;
+
+static std::vector<RouteField> _routeFields;
+
+static bool _pathfindCacheInvalidationSuspended = false;
+
+static uint32_t route_field_node_key(int32_t x, int32_t y, int32_t z)
+{
+    return (static_cast<uint32_t>(x & 0xFF) << 16) | (static_cast<uint32_t>(y & 0xFF) << 8) | static_cast<uint32_t>(z & 0xFF);
+}
+
+/* Whether guests looking for the given goal will walk over the path element,
+ * following the same rules as peep_pathfind_heuristic_search(). */
+static bool route_field_can_walk(PathElement* path, const RouteFieldKey& key)
+{
+    if (path->IsWide())
+        return false;
+    if (path->IsQueue() && bitcount(path->GetEdges()) == 2 && key.IgnoreForeignQueues
+        && path->GetRideIndex() != key.QueueRideIndex && path->GetRideIndex() != RIDE_ID_NULL)
+    {
+        return false;
+    }
+    return true;
+}
+
+/* The height at which a guest walking off the path element in the given
+ * direction arrives on the next tile, and the path element there if any, the
+ * same way as footpath_element_next_in_direction() finds it. */
+static TileElement* route_field_step(
+    const TileCoordsXY& from, TileElement* pathElement, Direction direction, TileCoordsXY& outTo, int32_t& outZ)
+{
+    outZ = pathElement->base_height;
+    auto* path = pathElement->AsPath();
+    if (path->IsSloped() && path->GetSlopeDirection() == direction)
+    {
+        outZ += 2;
+    }
+
+    outTo = from + TileDirectionDelta[direction];
+    if (!map_is_location_valid(outTo.ToCoordsXY()))
+        return nullptr;
+
+    TileElement* nextTileElement = map_get_first_element_at(outTo.ToCoordsXY());
+    do
+    {
+        if (nextTileElement == nullptr)
+            break;
+        if (nextTileElement->IsGhost())
+            continue;
+        if (nextTileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (!IsValidPathZAndDirection(nextTileElement, outZ, direction))
+            continue;
+        return nextTileElement;
+    } while (!(nextTileElement++)->IsLastForTile());
+    return nullptr;
+}
+
+/* Whether a step that arrives on the given tile reaches the goal: a path goal
+ * (end of a queue) is reached when arriving on its path element, any other goal
+ * (ride entrance, shop, park entrance) when arriving at its height. */
+static bool route_field_step_reaches_goal(
+    const RouteFieldKey& key, const TileCoordsXY& to, int32_t arrivalZ, const TileElement* arrivalPath)
+{
+    if (to.x != key.Goal.x || to.y != key.Goal.y)
+        return false;
+    int32_t z = arrivalPath != nullptr ? arrivalPath->base_height : arrivalZ;
+    return z == key.Goal.z;
+}
+
+static RouteField route_field_build(const RouteFieldKey& key)
+{
+    std::unordered_map<uint32_t, uint16_t> steps;
+    std::vector<TileCoordsXYZ> queue;
+
+    // Adds every walkable path element next to the target that leads into it, isGoal tells whether the target is the
+    // goal tile itself rather than a path element already in the field.
+    auto addPredecessors = [&](const TileCoordsXYZ& target, bool isGoal, uint16_t targetSteps) {
+        for (Direction direction = 0; direction < NumOrthogonalDirections; direction++)
+        {
+            TileCoordsXY from = TileCoordsXY(target.x, target.y) + TileDirectionDelta[direction_reverse(direction)];
+            if (!map_is_location_valid(from.ToCoordsXY()))
+                continue;
+
+            TileElement* tileElement = map_get_first_element_at(from.ToCoordsXY());
+            do
+            {
+                if (tileElement == nullptr)
+                    break;
+                if (tileElement->IsGhost() || tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+                    continue;
+
+                auto* path = tileElement->AsPath();
+                if (!(path_get_permitted_edges(path) & (1 << direction)))
+                    continue;
+                if (!route_field_can_walk(path, key))
+                    continue;
+
+                TileCoordsXY to;
+                int32_t arrivalZ;
+                TileElement* arrivalPath = route_field_step(from, tileElement, direction, to, arrivalZ);
+                if (isGoal)
+                {
+                    if (!route_field_step_reaches_goal(key, to, arrivalZ, arrivalPath))
+                        continue;
+                }
+                else if (arrivalPath == nullptr || arrivalPath->base_height != target.z)
+                {
+                    continue;
+                }
+
+                auto nodeKey = route_field_node_key(from.x, from.y, tileElement->base_height);
+                if (steps.size() < RouteFieldMaxNodes && steps.emplace(nodeKey, targetSteps + 1).second)
+                {
+                    queue.emplace_back(from.x, from.y, tileElement->base_height);
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    };
+
+    addPredecessors(key.Goal, true, 0);
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        auto node = queue[i];
+        addPredecessors(node, false, steps[route_field_node_key(node.x, node.y, node.z)]);
+    }
+
+    RouteField field;
+    field.Key = key;
+    field.Steps.assign(steps.begin(), steps.end());
+    std::sort(field.Steps.begin(), field.Steps.end());
+    return field;
+}
+
+static const RouteField& route_field_get(const RouteFieldKey& key)
+{
+    for (const auto& field : _routeFields)
+    {
+        if (field.Key == key)
+            return field;
+    }
+
+    if (_routeFields.size() >= RouteFieldMaxCount)
+        _routeFields.erase(_routeFields.begin());
+    _routeFields.push_back(route_field_build(key));
+    return _routeFields.back();
+}
+
+static std::optional<uint16_t> route_field_get_steps(const RouteField& field, uint32_t nodeKey)
+{
+    auto it = std::lower_bound(
+        field.Steps.begin(), field.Steps.end(), nodeKey,
+        [](const std::pair<uint32_t, uint16_t>& entry, uint32_t value) { return entry.first < value; });
+    if (it == field.Steps.end() || it->first != nodeKey)
+        return std::nullopt;
+    return it->second;
+}
+
+/* Chooses the permitted edge that leads closest to the goal according to its
+ * route field. Ties go to the lowest edge so every client picks the same one.
+ * Returns INVALID_DIRECTION if the goal cannot be reached from here. */
+static Direction route_field_choose_direction(const TileCoordsXYZ& loc, uint8_t permittedEdges)
+{
+    RouteFieldKey key{ gPeepPathFindGoalPosition, gPeepPathFindQueueRideIndex, gPeepPathFindIgnoreForeignQueues };
+    const auto& field = route_field_get(key);
+
+    Direction bestDirection = INVALID_DIRECTION;
+    uint32_t bestSteps = std::numeric_limits<uint32_t>::max();
+    TileCoordsXY from(loc.x, loc.y);
+    TileElement* tileElement = map_get_first_element_at(from.ToCoordsXY());
+    do
+    {
+        if (tileElement == nullptr)
+            break;
+        if (tileElement->IsGhost() || tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (tileElement->base_height != loc.z)
+            continue;
+
+        for (Direction direction = 0; direction < NumOrthogonalDirections; direction++)
+        {
+            if (!(permittedEdges & (1 << direction)))
+                continue;
+
+            TileCoordsXY to;
+            int32_t arrivalZ;
+            TileElement* arrivalPath = route_field_step(from, tileElement, direction, to, arrivalZ);
+            uint32_t steps;
+            if (route_field_step_reaches_goal(key, to, arrivalZ, arrivalPath))
+            {
+                steps = 0;
+            }
+            else
+            {
+                if (arrivalPath == nullptr)
+                    continue;
+                auto fieldSteps = route_field_get_steps(field, route_field_node_key(to.x, to.y, arrivalPath->base_height));
+                if (!fieldSteps)
+                    continue;
+                steps = *fieldSteps;
+            }
+
+            if (steps < bestSteps)
+            {
+                bestSteps = steps;
+                bestDirection = direction;
+            }
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return bestDirection;
+}
+
 static int32_t CalculateHeuristicPathingScore(const TileCoordsXYZ& loc1, const TileCoordsXYZ& loc2)
 {
     auto xDelta = abs(loc1.x - loc2.x) * 32;
@@ -1323,6 +1651,15 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
         return INVALID_DIRECTION;
 
     permitted_edges &= 0xF;
+
+    // Guests in parks with long range pathfinding follow the route field to their goal whenever it can be reached
+    if ((gParkFlags & PARK_FLAGS_LONG_RANGE_PATHFINDING) && !_peepPathFindIsStaff)
+    {
+        Direction direction = route_field_choose_direction(loc, permitted_edges);
+        if (direction != INVALID_DIRECTION)
+            return direction;
+    }
+
     uint8_t edges = permitted_edges;
     if (isThin && peep->PathfindGoal.x == goal.x && peep->PathfindGoal.y == goal.y && peep->PathfindGoal.z == goal.z)
     {
@@ -1503,9 +1840,46 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
             }
 #endif // defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
 
-            peep_pathfind_heuristic_search(
-                { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
-                endJunctionList, endDirectionList, &endXYZ, &endSteps);
+            bool useCache = peep->AssignedPeepType == PeepType::Guest;
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+            // Cached results do not record the junctions of the search path
+            useCache = useCache && !gPathFindDebug;
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+
+            PathSearchKey searchKey{};
+            if (useCache)
+            {
+                searchKey.Start = { loc.x, loc.y, height };
+                searchKey.Goal = goal;
+                std::copy(std::begin(peep->PathfindHistory), std::end(peep->PathfindHistory), searchKey.History);
+                searchKey.TilesChecked = _peepPathFindTilesChecked;
+                searchKey.QueueRideIndex = gPeepPathFindQueueRideIndex;
+                searchKey.Edge = static_cast<uint8_t>(test_edge);
+                searchKey.MaxJunctions = static_cast<uint8_t>(_peepPathFindMaxJunctions);
+                searchKey.IgnoreForeignQueues = gPeepPathFindIgnoreForeignQueues ? 1 : 0;
+            }
+
+            auto cachedSearch = useCache ? _peepPathSearchCache.find(searchKey) : _peepPathSearchCache.end();
+            if (cachedSearch != _peepPathSearchCache.end())
+            {
+                score = cachedSearch->second.Score;
+                endSteps = cachedSearch->second.Steps;
+            }
+            else
+            {
+                peep_pathfind_heuristic_search(
+                    { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
+                    endJunctionList, endDirectionList, &endXYZ, &endSteps);
+
+                if (useCache)
+                {
+                    if (_peepPathSearchCache.size() >= PathSearchCacheMaxEntries)
+                    {
+                        _peepPathSearchCache.clear();
+                    }
+                    _peepPathSearchCache.emplace(searchKey, PathSearchResult{ score, endSteps });
+                }
+            }
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
             if (gPathFindDebug)
@@ -1622,6 +1996,21 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
     return chosen_edge;
 }
 
+void peep_pathfind_cache_invalidate()
+{
+    if (_pathfindCacheInvalidationSuspended)
+        return;
+
+    _peepPathSearchCache.clear();
+    _pathThinJunctionCache.clear();
+    _routeFields.clear();
+}
+
+void peep_pathfind_cache_suspend_invalidation(bool suspend)
+{
+    _pathfindCacheInvalidationSuspended = suspend;
+}
+
 /**
  * Gets the nearest park entrance relative to point, by using Manhattan distance.
  * @param x x coordinate of location
@@ -41,6 +41,14 @@ extern bool gPeepPathFindIgnoreForeignQueues;
 // the direction the peep should walk in from the current tile.
 Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep);
 
+// Forget all cached heuristic search results. Must be called whenever footpaths, entrances, banners, tracks or the
+// wide flags of footpaths may have changed, otherwise guests would keep walking towards stale routes.
+void peep_pathfind_cache_invalidate();
+
+// Makes peep_pathfind_cache_invalidate() do nothing until called again with false. Only for changes that are undone
+// before any guest looks for a path again, such as removing the provisional elements around the guest update.
+void peep_pathfind_cache_suspend_invalidation(bool suspend);
+
 // Test whether the given tile can be walked onto, if the peep is currently at height currentZ and
 // moving in direction currentDirection.
 bool IsValidPathZAndDirection(TileElement* tileElement, int32_t currentZ, int32_t currentDirection);
@@ -14,11 +14,13 @@
 #include "../Game.h"
 #include "../Input.h"
 #include "../OpenRCT2.h"
+#include "../ReplayManager.h"
 #include "../actions/GameAction.h"
 #include "../audio/AudioMixer.h"
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../management/Finance.h"
@@ -48,6 +50,9 @@
 #include "Staff.h"
 
 #include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cmath>
 #include <iterator>
 #include <limits>
 
@@ -62,6 +67,7 @@ uint8_t gGuestInitialHunger;
 uint8_t gGuestInitialThirst;
 
 uint32_t gNextGuestNumber;
+InternedStringTable gPeepNames;
 
 uint8_t gPeepWarningThrottle[16];
 
@@ -69,6 +75,10 @@ static uint8_t _unk_F1AEF0;
 static TileElement* _peepRideEntranceExitElement;
 
 static void* _crowdSoundChannel = nullptr;
+// Tiles in view of the music tracking viewport, kept to not allocate every tick
+static std::vector<TileCoordsXY> _crowdNoiseTiles;
+
+static PeepTick128Stats _tick128Stats{};
 
 static void peep_128_tick_update(Peep* peep, int32_t index);
 static void peep_release_balloon(Guest* peep, int16_t spawn_height);
@@ -372,21 +382,84 @@ Peep* try_get_guest(uint16_t spriteIndex)
 
 int32_t peep_get_staff_count()
 {
-    auto list = EntityList<Staff>(EntityListId::Peep);
-    auto count = std::distance(list.begin(), list.end());
-
-    return count;
+    return static_cast<int32_t>(staff_get_sprite_indices().size());
 }
 
 /**
  *
  *  rct2: 0x0068F0A9
  */
+// Most walking steps a guest takes at once with the simulation level of detail
+static constexpr uint8_t SimulationLodMaxWalkSteps = 8;
+// Views covering more tiles than this see most of the park, guests are then all updated in full detail
+static constexpr size_t SimulationLodMaxVisibleTiles = 16384;
+
+static bool _simulationLodActive;
+static std::vector<TileCoordsXY> _simulationLodVisibleTiles;
+static std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _simulationLodVisibleTileMarks;
+
+/**
+ * The simulation level of detail lets guests that can not be seen walk along the path of a tile in a few larger steps
+ * instead of one pixel step per update. They then sit out the walking updates of the steps they took ahead, so they
+ * reach the tile edges and their destinations in the same update as before and only the positions in between are
+ * skipped. Never used in multiplayer or while a replay is recorded or played as it changes the game state.
+ */
+static void peep_simulation_lod_prepare()
+{
+    for (const auto& tile : _simulationLodVisibleTiles)
+    {
+        _simulationLodVisibleTileMarks[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL] = false;
+    }
+    _simulationLodVisibleTiles.clear();
+
+    _simulationLodActive = gConfigGeneral.simulation_level_of_detail && network_get_mode() == NETWORK_MODE_NONE;
+    auto context = OpenRCT2::GetContext();
+    if (_simulationLodActive && context != nullptr)
+    {
+        auto replayManager = context->GetReplayManager();
+        if (replayManager != nullptr && (replayManager->IsRecording() || replayManager->IsReplaying()))
+        {
+            _simulationLodActive = false;
+        }
+    }
+    if (!_simulationLodActive)
+        return;
+
+    if (!viewports_get_visible_tiles(SimulationLodMaxVisibleTiles, _simulationLodVisibleTiles))
+    {
+        _simulationLodVisibleTiles.clear();
+        _simulationLodActive = false;
+        return;
+    }
+    for (const auto& tile : _simulationLodVisibleTiles)
+    {
+        _simulationLodVisibleTileMarks[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL] = true;
+    }
+}
+
+static bool peep_simulation_lod_can_walk_ahead(const Peep* peep)
+{
+    if (!_simulationLodActive || peep->AssignedPeepType != PeepType::Guest || peep->State != PeepState::Walking)
+        return false;
+    if (peep->Action != PeepActionType::None1 && peep->Action != PeepActionType::None2)
+        return false;
+
+    auto tile = TileCoordsXY(CoordsXY{ peep->x, peep->y });
+    if (tile.x < 0 || tile.y < 0 || tile.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tile.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return false;
+    return !_simulationLodVisibleTileMarks[tile.x + tile.y * MAXIMUM_MAP_SIZE_TECHNICAL];
+}
+
 void peep_update_all()
 {
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    peep_simulation_lod_prepare();
+
+    double tick128Time = 0;
+    uint32_t tick128Peeps = 0;
+
     int32_t i = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Peep>(EntityListId::Peep))
@@ -397,7 +470,11 @@ void peep_update_all()
         }
         else
         {
+            auto startTime = std::chrono::high_resolution_clock::now();
             peep_128_tick_update(peep, i);
+            tick128Time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+            tick128Peeps++;
+
             if (peep->sprite_identifier == SpriteIdentifier::Peep)
             {
                 peep->Update();
@@ -406,6 +483,41 @@ void peep_update_all()
 
         i++;
     }
+
+    const auto bucket = gCurrentTicks & 0x7F;
+    _tick128Stats.Time[bucket] = tick128Time;
+    _tick128Stats.Peeps[bucket] = tick128Peeps;
+}
+
+double PeepTick128Stats::GetMean() const
+{
+    double total = 0;
+    for (auto time : Time)
+    {
+        total += time;
+    }
+    return total / NumBuckets;
+}
+
+double PeepTick128Stats::GetLongest() const
+{
+    return *std::max_element(Time.begin(), Time.end());
+}
+
+double PeepTick128Stats::GetStandardDeviation() const
+{
+    const double mean = GetMean();
+    double variance = 0;
+    for (auto time : Time)
+    {
+        variance += (time - mean) * (time - mean);
+    }
+    return std::sqrt(variance / NumBuckets);
+}
+
+const PeepTick128Stats& peep_get_tick_128_stats()
+{
+    return _tick128Stats;
 }
 
 /**
@@ -542,6 +654,55 @@ void Peep::StateReset()
 /** rct2: 0x00981D7C, 0x00981D7E */
 static constexpr const CoordsXY word_981D7C[4] = { { -2, 0 }, { 0, 2 }, { 2, 0 }, { 0, -2 } };
 
+uint8_t Peep::GetWalkingDirection(const CoordsXY& loc) const
+{
+    CoordsXY difference = { loc.x - DestinationX, loc.y - DestinationY };
+    if (abs(difference.x) < abs(difference.y))
+    {
+        return difference.y >= 0 ? 24 : 8;
+    }
+    return difference.x >= 0 ? 0 : 16;
+}
+
+void Peep::AdvanceWalkingFrame()
+{
+    WalkingFrameNum++;
+    const rct_peep_animation* peepAnimation = &GetPeepAnimation(SpriteType);
+    const uint8_t* imageOffset = peepAnimation[EnumValue(ActionSpriteType)].frame_offsets;
+    if (WalkingFrameNum >= peepAnimation[EnumValue(ActionSpriteType)].num_frames)
+    {
+        WalkingFrameNum = 0;
+    }
+    ActionSpriteImageOffset = imageOffset[WalkingFrameNum];
+}
+
+/**
+ * Takes the walking steps after the one to loc at once, for as long as they stay on the tile and do not reach the
+ * destination. Every step is one of the walking updates the guest sits out afterwards.
+ */
+CoordsXY Peep::WalkAhead(const CoordsXY& loc)
+{
+    auto result = loc;
+    uint8_t steps = 1;
+    while (steps < SimulationLodMaxWalkSteps)
+    {
+        if (abs(result.x - DestinationX) + abs(result.y - DestinationY) <= DestinationTolerance)
+            break;
+
+        auto direction = GetWalkingDirection(result);
+        auto nextPos = result + word_981D7C[direction / 8];
+        if (nextPos.ToTileStart() != result.ToTileStart())
+            break;
+
+        sprite_direction = direction;
+        AdvanceWalkingFrame();
+        result = nextPos;
+        steps++;
+    }
+    SimulationLodWalkDelay = steps - 1;
+    return result;
+}
+
 std::optional<CoordsXY> Peep::UpdateAction()
 {
     int16_t xy_distance;
@@ -577,35 +738,9 @@ std::optional<CoordsXY> Peep::UpdateAction(int16_t& xy_distance)
         {
             return std::nullopt;
         }
-        int32_t nextDirection = 0;
-        if (x_delta < y_delta)
-        {
-            nextDirection = 8;
-            if (diffrenceLoc.y >= 0)
-            {
-                nextDirection = 24;
-            }
-        }
-        else
-        {
-            nextDirection = 16;
-            if (diffrenceLoc.x >= 0)
-            {
-                nextDirection = 0;
-            }
-        }
-        sprite_direction = nextDirection;
-        CoordsXY loc = { x, y };
-        loc += word_981D7C[nextDirection / 8];
-        WalkingFrameNum++;
-        const rct_peep_animation* peepAnimation = &GetPeepAnimation(SpriteType);
-        const uint8_t* imageOffset = peepAnimation[EnumValue(ActionSpriteType)].frame_offsets;
-        if (WalkingFrameNum >= peepAnimation[EnumValue(ActionSpriteType)].num_frames)
-        {
-            WalkingFrameNum = 0;
-        }
-        ActionSpriteImageOffset = imageOffset[WalkingFrameNum];
-        return loc;
+        sprite_direction = GetWalkingDirection({ x, y });
+        AdvanceWalkingFrame();
+        return CoordsXY{ x, y } + word_981D7C[sprite_direction / 8];
     }
 
     const rct_peep_animation* peepAnimation = &GetPeepAnimation(SpriteType);
@@ -685,6 +820,7 @@ void peep_window_state_update(Peep* peep)
             auto ride = get_ride(peep->CurrentRide);
             if (ride != nullptr)
             {
+                ride->Wake();
                 ride->num_riders++;
                 ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_MAIN | RIDE_INVALIDATE_RIDE_LIST;
             }
@@ -816,7 +952,7 @@ void peep_sprite_remove(Peep* peep)
     }
     else
     {
-        gStaffModes[peep->StaffId] = StaffMode::None;
+        staff_set_mode(peep->StaffId, StaffMode::None);
         peep->AssignedPeepType = PeepType::Invalid;
         staff_update_greyed_patrol_areas();
         peep->AssignedPeepType = PeepType::Staff;
@@ -996,6 +1132,11 @@ void Peep::SetState(PeepState new_state)
 {
     peep_decrement_num_riders(this);
     State = new_state;
+    SimulationLodWalkDelay = 0;
+    if (AssignedPeepType == PeepType::Staff)
+    {
+        staff_update_on_patrol(AsStaff());
+    }
     peep_window_state_update(this);
 }
 
@@ -1343,21 +1484,38 @@ void peep_update_crowd_noise()
 
     // Count the number of peeps visible
     auto visiblePeeps = 0;
-
-    for (auto peep : EntityList<Guest>(EntityListId::Peep))
-    {
+    auto countPeep = [viewport, &visiblePeeps](const Guest* peep) {
         if (peep->sprite_left == LOCATION_NULL)
-            continue;
+            return;
         if (viewport->viewPos.x > peep->sprite_right)
-            continue;
+            return;
         if (viewport->viewPos.x + viewport->view_width < peep->sprite_left)
-            continue;
+            return;
         if (viewport->viewPos.y > peep->sprite_bottom)
-            continue;
+            return;
         if (viewport->viewPos.y + viewport->view_height < peep->sprite_top)
-            continue;
+            return;
 
         visiblePeeps += peep->State == PeepState::Queuing ? 1 : 2;
+    };
+
+    // Only the guests on tiles in view are gone through, unless the view covers more tiles than there are guests
+    if (viewport_get_visible_tiles(viewport, GetEntityListCount(EntityListId::Peep), _crowdNoiseTiles))
+    {
+        for (const auto& tile : _crowdNoiseTiles)
+        {
+            for (auto peep : EntityTileList<Guest>(tile.ToCoordsXY()))
+            {
+                countPeep(peep);
+            }
+        }
+    }
+    else
+    {
+        for (auto peep : EntityList<Guest>(EntityListId::Peep))
+        {
+            countPeep(peep);
+        }
     }
 
     // This function doesn't account for the fact that the screen might be so big that 100 peeps could potentially be very
@@ -1687,7 +1845,7 @@ Peep* Peep::Generate(const CoordsXYZ& coords)
     peep->GuestNumRides = 0;
     std::fill_n(peep->RideTypesBeenOn, 16, 0x00);
     peep->Id = gNextGuestNumber++;
-    peep->Name = nullptr;
+    peep->NameStorage = nullptr;
 
     money32 cash = (scenario_rand() & 0x3) * 100 - 100 + gGuestInitialCash;
     if (cash < 0)
@@ -1922,7 +2080,8 @@ void Peep::FormatActionTo(Formatter& ft) const
 
 void Peep::FormatNameTo(Formatter& ft) const
 {
-    if (Name == nullptr)
+    auto name = gPeepNames.Get(NameId);
+    if (name == nullptr)
     {
         if (AssignedPeepType == PeepType::Staff)
         {
@@ -1954,7 +2113,7 @@ void Peep::FormatNameTo(Formatter& ft) const
     }
     else
     {
-        ft.Add<rct_string_id>(STR_STRING).Add<const char*>(Name);
+        ft.Add<rct_string_id>(STR_STRING).Add<const char*>(name);
     }
 }
 
@@ -1967,25 +2126,12 @@ std::string Peep::GetName() const
 
 bool Peep::SetName(const std::string_view& value)
 {
-    if (value.empty())
-    {
-        std::free(Name);
-        Name = nullptr;
-        return true;
-    }
-    else
-    {
-        auto newNameMemory = static_cast<char*>(std::malloc(value.size() + 1));
-        if (newNameMemory != nullptr)
-        {
-            std::memcpy(newNameMemory, value.data(), value.size());
-            newNameMemory[value.size()] = '\0';
-            std::free(Name);
-            Name = newNameMemory;
-            return true;
-        }
-    }
-    return false;
+    // Intern before releasing so that setting the same name again does not drop it from the table in between
+    auto newNameId = gPeepNames.Intern(value);
+    gPeepNames.Release(NameId);
+    NameStorage = nullptr;
+    NameId = newNameId;
+    return true;
 }
 
 /**
@@ -3002,6 +3148,10 @@ void Peep::PerformNextAction(uint8_t& pathing_result, TileElement*& tile_result)
     CoordsXY truncatedNewLoc = newLoc.ToTileStart();
     if (truncatedNewLoc == CoordsXY{ NextLoc })
     {
+        if (peep_simulation_lod_can_walk_ahead(this))
+        {
+            newLoc = WalkAhead(newLoc);
+        }
         int16_t height = GetZOnSlope(newLoc.x, newLoc.y);
         MoveTo({ newLoc.x, newLoc.y, height });
         return;
@@ -3166,7 +3316,7 @@ int32_t peep_compare(const uint16_t sprite_index_a, const uint16_t sprite_index_
         return static_cast<int32_t>(peep_a->AssignedPeepType) - static_cast<int32_t>(peep_b->AssignedPeepType);
     }
 
-    if (peep_a->Name == nullptr && peep_b->Name == nullptr)
+    if (peep_a->NameId == INTERNED_STRING_NULL && peep_b->NameId == INTERNED_STRING_NULL)
     {
         if (gParkFlags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES)
         {
@@ -11,6 +11,7 @@
 #define _PEEP_H_
 
 #include "../common.h"
+#include "../core/InternedStringTable.h"
 #include "../management/Finance.h"
 #include "../rct12/RCT12.h"
 #include "../ride/Ride.h"
@@ -21,6 +22,7 @@
 #include "../world/SpriteBase.h"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <optional>
 
@@ -613,7 +615,13 @@ public:
 
 struct Peep : SpriteBase
 {
-    char* Name;
+    // Custom name in gPeepNames. The union keeps the entity as large as when the name was a pointer, the sprite checksums
+    // hash the raw entity so its layout has to stay the same.
+    union
+    {
+        interned_string_id NameId;
+        void* NameStorage;
+    };
     CoordsXYZ NextLoc;
     uint8_t NextFlags;
     bool OutsideOfPark;
@@ -732,6 +740,8 @@ struct Peep : SpriteBase
     rct12_xyzd8 PathfindGoal;
     rct12_xyzd8 PathfindHistory[4];
     uint8_t WalkingFrameNum;
+    // Walking updates to sit out for steps already taken with the simulation level of detail
+    uint8_t SimulationLodWalkDelay;
     // 0x3F Litter Count split into lots of 3 with time, 0xC0 Time since last recalc
     uint8_t LitterCount;
     union
@@ -831,6 +841,9 @@ private:
     void UpdateFalling();
     void Update1();
     void UpdatePicked();
+    uint8_t GetWalkingDirection(const CoordsXY& loc) const;
+    void AdvanceWalkingFrame();
+    CoordsXY WalkAhead(const CoordsXY& loc);
 };
 
 struct Guest : Peep
@@ -1064,12 +1077,32 @@ extern uint8_t gGuestInitialThirst;
 
 extern uint32_t gNextGuestNumber;
 
+// Custom names of guests and staff, many guests often share the same name
+extern InternedStringTable gPeepNames;
+
 extern uint8_t gPeepWarningThrottle[16];
 
+/**
+ * How long the 128 tick updates took for each bucket of peeps, a bucket being the peeps whose index in the peep list
+ * equals the current tick modulo 128.
+ */
+struct PeepTick128Stats
+{
+    static constexpr size_t NumBuckets = 128;
+
+    std::array<double, NumBuckets> Time;    // Time spent in the 128 tick updates the last time each bucket ran, in seconds
+    std::array<uint32_t, NumBuckets> Peeps; // Number of peeps updated the last time each bucket ran
+
+    double GetMean() const;
+    double GetLongest() const;
+    double GetStandardDeviation() const;
+};
+
 Peep* try_get_guest(uint16_t spriteIndex);
 int32_t peep_get_staff_count();
 bool peep_can_be_picked_up(Peep* peep);
 void peep_update_all();
+const PeepTick128Stats& peep_get_tick_128_stats();
 void peep_problem_warnings_update();
 void peep_stop_crowd_noise();
 void peep_update_crowd_noise();
@@ -41,7 +41,9 @@
 #include "Peep.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
+#include <vector>
 
 /**
  * Monthly staff wages
@@ -83,6 +85,43 @@ colour_t gStaffSecurityColour;
 // Maximum manhattan distance that litter can be for a handyman to seek to it
 const uint16_t MAX_LITTER_DISTANCE = 3 * COORDS_XY_STEP;
 
+static std::vector<uint16_t> _staffSpriteIndices;
+static uint32_t _staffSpriteIndicesRevision;
+// Where each staff id is in _staffSpriteIndices, only used while the staff ids are unique
+static uint16_t _staffSpriteIndexPositions[STAFF_MAX_COUNT];
+static bool _staffIdsUnique;
+
+namespace
+{
+    struct StaffIdSet
+    {
+        uint32_t Words[(STAFF_MAX_COUNT + 31) / 32];
+
+        bool Get(int32_t staffIndex) const
+        {
+            return (Words[staffIndex / 32] & (1u << (staffIndex % 32))) != 0;
+        }
+
+        void Set(int32_t staffIndex, bool value)
+        {
+            if (value)
+                Words[staffIndex / 32] |= (1u << (staffIndex % 32));
+            else
+                Words[staffIndex / 32] &= ~(1u << (staffIndex % 32));
+        }
+    };
+} // namespace
+
+// For every patrol square, the staff whose patrol area contains it whatever their mode
+static StaffIdSet _staffPatrolCoverage[STAFF_PATROL_AREA_SIZE * 32];
+// Staff in StaffMode::Patrol
+static StaffIdSet _staffPatrolModes;
+// Staff that were patrolling or heading to an inspection when their state was last set. Leaving those states does not
+// always go through Peep::SetState, so stale staff are dropped when they are looked up.
+static StaffIdSet _staffOnPatrol;
+static bool _staffDispatchInvalid = true;
+static std::vector<Staff*> _staffOnPatrolAt;
+
 template<> bool SpriteBase::Is<Staff>() const
 {
     auto peep = As<Peep>();
@@ -102,6 +141,28 @@ void staff_reset_modes()
         gStaffModes[i] = StaffMode::Walk;
 
     staff_update_greyed_patrol_areas();
+    staff_dispatch_invalidate();
+}
+
+const std::vector<uint16_t>& staff_get_sprite_indices()
+{
+    const auto revision = GetEntityListRevision();
+    if (_staffSpriteIndicesRevision != revision)
+    {
+        _staffSpriteIndices.clear();
+        std::fill(std::begin(_staffSpriteIndexPositions), std::end(_staffSpriteIndexPositions), UINT16_MAX);
+        _staffIdsUnique = true;
+        for (auto peep : EntityList<Staff>(EntityListId::Peep))
+        {
+            if (peep->StaffId >= STAFF_MAX_COUNT || _staffSpriteIndexPositions[peep->StaffId] != UINT16_MAX)
+                _staffIdsUnique = false;
+            else
+                _staffSpriteIndexPositions[peep->StaffId] = static_cast<uint16_t>(_staffSpriteIndices.size());
+            _staffSpriteIndices.push_back(peep->sprite_index);
+        }
+        _staffSpriteIndicesRevision = revision;
+    }
+    return _staffSpriteIndices;
 }
 
 /**
@@ -415,6 +476,10 @@ void staff_set_patrol_area(int32_t staffIndex, const CoordsXY& coords, bool valu
     {
         *addr &= ~(1 << bitIndex);
     }
+    if (staffIndex < STAFF_MAX_COUNT)
+    {
+        _staffPatrolCoverage[offset * 32 + bitIndex].Set(staffIndex, value);
+    }
 }
 
 void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
@@ -422,6 +487,140 @@ void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
     int32_t peepOffset = staffIndex * STAFF_PATROL_AREA_SIZE;
     auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
     gStaffPatrolAreas[peepOffset + offset] ^= (1 << bitIndex);
+    if (staffIndex < STAFF_MAX_COUNT)
+    {
+        auto& coverage = _staffPatrolCoverage[offset * 32 + bitIndex];
+        coverage.Set(staffIndex, !coverage.Get(staffIndex));
+    }
+}
+
+void staff_clear_patrol_area(int32_t staffIndex)
+{
+    int32_t peepOffset = staffIndex * STAFF_PATROL_AREA_SIZE;
+    for (int32_t offset = 0; offset < STAFF_PATROL_AREA_SIZE; offset++)
+    {
+        for (int32_t bitIndex = 0; bitIndex < 32; bitIndex++)
+        {
+            if (gStaffPatrolAreas[peepOffset + offset] & (1u << bitIndex))
+            {
+                _staffPatrolCoverage[offset * 32 + bitIndex].Set(staffIndex, false);
+            }
+        }
+        gStaffPatrolAreas[peepOffset + offset] = 0;
+    }
+}
+
+void staff_set_mode(int32_t staffIndex, StaffMode mode)
+{
+    gStaffModes[staffIndex] = mode;
+    if (staffIndex < STAFF_MAX_COUNT)
+    {
+        _staffPatrolModes.Set(staffIndex, mode == StaffMode::Patrol);
+    }
+}
+
+static bool staff_is_on_patrol(const Staff* staff)
+{
+    return staff->State == PeepState::Patrolling || staff->State == PeepState::HeadingToInspection;
+}
+
+void staff_update_on_patrol(const Staff* staff)
+{
+    if (staff->StaffId < STAFF_MAX_COUNT)
+    {
+        _staffOnPatrol.Set(staff->StaffId, staff_is_on_patrol(staff));
+    }
+}
+
+void staff_dispatch_invalidate()
+{
+    _staffDispatchInvalid = true;
+}
+
+static void staff_dispatch_rebuild()
+{
+    std::memset(_staffPatrolCoverage, 0, sizeof(_staffPatrolCoverage));
+    _staffPatrolModes = {};
+    _staffOnPatrol = {};
+    for (int32_t staffIndex = 0; staffIndex < STAFF_MAX_COUNT; staffIndex++)
+    {
+        _staffPatrolModes.Set(staffIndex, gStaffModes[staffIndex] == StaffMode::Patrol);
+        int32_t peepOffset = staffIndex * STAFF_PATROL_AREA_SIZE;
+        for (int32_t offset = 0; offset < STAFF_PATROL_AREA_SIZE; offset++)
+        {
+            for (int32_t bitIndex = 0; bitIndex < 32; bitIndex++)
+            {
+                if (gStaffPatrolAreas[peepOffset + offset] & (1u << bitIndex))
+                {
+                    _staffPatrolCoverage[offset * 32 + bitIndex].Set(staffIndex, true);
+                }
+            }
+        }
+    }
+    for (auto peep : EntityList<Staff>(EntityListId::Peep))
+    {
+        if (staff_is_on_patrol(peep))
+        {
+            staff_update_on_patrol(peep);
+        }
+    }
+    _staffDispatchInvalid = false;
+}
+
+const std::vector<Staff*>& staff_get_on_patrol_at(const CoordsXY& loc, bool anyPatrolArea)
+{
+    _staffOnPatrolAt.clear();
+    const auto& spriteIndices = staff_get_sprite_indices();
+    if (!_staffIdsUnique)
+    {
+        // Staff ids are only shared in broken parks, the sets can not tell those staff apart so every one is checked
+        for (auto spriteIndex : spriteIndices)
+        {
+            auto staff = GetEntity<Staff>(spriteIndex);
+            if (staff != nullptr && staff_is_on_patrol(staff)
+                && (anyPatrolArea || gStaffModes[staff->StaffId] != StaffMode::Patrol || staff->IsPatrolAreaSet(loc)))
+            {
+                _staffOnPatrolAt.push_back(staff);
+            }
+        }
+        return _staffOnPatrolAt;
+    }
+
+    if (_staffDispatchInvalid)
+    {
+        staff_dispatch_rebuild();
+    }
+
+    auto [offset, bitIndex] = getPatrolAreaOffsetIndex(loc);
+    const auto& coverage = _staffPatrolCoverage[offset * 32 + bitIndex];
+    for (int32_t word = 0; word < static_cast<int32_t>(std::size(_staffOnPatrol.Words)); word++)
+    {
+        uint32_t candidates = _staffOnPatrol.Words[word];
+        if (!anyPatrolArea)
+        {
+            candidates &= coverage.Words[word] | ~_staffPatrolModes.Words[word];
+        }
+        while (candidates != 0)
+        {
+            int32_t staffIndex = word * 32 + bitscanforward(static_cast<int32_t>(candidates));
+            candidates &= candidates - 1;
+
+            auto position = _staffSpriteIndexPositions[staffIndex];
+            auto staff = position != UINT16_MAX ? GetEntity<Staff>(spriteIndices[position]) : nullptr;
+            if (staff == nullptr || !staff_is_on_patrol(staff))
+            {
+                _staffOnPatrol.Set(staffIndex, false);
+                continue;
+            }
+            _staffOnPatrolAt.push_back(staff);
+        }
+    }
+
+    // Same order as a walk of the staff list, callers that pick the first of equals still pick the same staff
+    std::sort(_staffOnPatrolAt.begin(), _staffOnPatrolAt.end(), [](const Staff* a, const Staff* b) {
+        return _staffSpriteIndexPositions[a->StaffId] < _staffSpriteIndexPositions[b->StaffId];
+    });
+    return _staffOnPatrolAt;
 }
 
 /**
@@ -432,24 +631,57 @@ void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
+    // Only the tiles that can hold litter within MAX_LITTER_DISTANCE need to be searched
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>(EntityListId::Litter))
+    bool nearestLitterTied = false;
+    for (int32_t tileY = floor2(y - MAX_LITTER_DISTANCE, COORDS_XY_STEP); tileY <= y + MAX_LITTER_DISTANCE;
+         tileY += COORDS_XY_STEP)
     {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
-
-        if (distance < nearestLitterDist)
+        for (int32_t tileX = floor2(x - MAX_LITTER_DISTANCE, COORDS_XY_STEP); tileX <= x + MAX_LITTER_DISTANCE;
+             tileX += COORDS_XY_STEP)
         {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
+            if (!map_is_location_valid({ tileX, tileY }))
+                continue;
+
+            for (auto litter : EntityTileList<Litter>({ tileX, tileY }))
+            {
+                uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
+                if (distance > MAX_LITTER_DISTANCE || distance > nearestLitterDist)
+                    continue;
+
+                if (distance == nearestLitterDist)
+                {
+                    nearestLitterTied |= CoordsXY{ litter->x, litter->y }.ToTileStart()
+                        != CoordsXY{ nearestLitter->x, nearestLitter->y }.ToTileStart();
+                    continue;
+                }
+                nearestLitterDist = distance;
+                nearestLitter = litter;
+                nearestLitterTied = false;
+            }
         }
     }
 
-    if (nearestLitterDist > MAX_LITTER_DISTANCE)
+    if (nearestLitter == nullptr)
     {
         return INVALID_DIRECTION;
     }
 
+    if (nearestLitterTied)
+    {
+        // Litter on different tiles is equally near, the one that comes first in the litter list is the one to go for
+        for (auto litter : EntityList<Litter>(EntityListId::Litter))
+        {
+            uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
+            if (distance == nearestLitterDist)
+            {
+                nearestLitter = litter;
+                break;
+            }
+        }
+    }
+
     auto litterTile = CoordsXY{ nearestLitter->x, nearestLitter->y }.ToTileStart();
 
     if (!IsLocationInPatrol(litterTile))
@@ -975,23 +1207,10 @@ bool Staff::DoMiscPathFinding()
  */
 void Staff::EntertainerUpdateNearbyPeeps() const
 {
-    for (auto guest : EntityList<Guest>(EntityListId::Peep))
-    {
-        if (guest->x == LOCATION_NULL)
-            continue;
-
+    ForEachEntityInRange<Guest>({ x, y }, 96, [this](Guest* guest) {
         int16_t z_dist = abs(z - guest->z);
         if (z_dist > 48)
-            continue;
-
-        int16_t x_dist = abs(x - guest->x);
-        int16_t y_dist = abs(y - guest->y);
-
-        if (x_dist > 96)
-            continue;
-
-        if (y_dist > 96)
-            continue;
+            return;
 
         if (guest->State == PeepState::Walking)
         {
@@ -1002,7 +1221,7 @@ void Staff::EntertainerUpdateNearbyPeeps() const
             guest->TimeInQueue = std::max(0, guest->TimeInQueue - 200);
             guest->HappinessTarget = std::min(guest->HappinessTarget + 3, PEEP_MAX_HAPPINESS);
         }
-    }
+    });
 }
 
 /**
@@ -1465,7 +1684,7 @@ void Staff::UpdateHeadingToInspect()
         DestinationTolerance = 2;
         sprite_direction = PeepDirection << 3;
 
-        z = rideEntranceExitElement->base_height * 4;
+        MoveTo({ x, y, rideEntranceExitElement->base_height * 4 });
         SubState = 4;
         // Falls through into SubState 4
     }
@@ -1576,7 +1795,7 @@ void Staff::UpdateAnswering()
         DestinationTolerance = 2;
         sprite_direction = PeepDirection << 3;
 
-        z = rideEntranceExitElement->base_height * 4;
+        MoveTo({ x, y, rideEntranceExitElement->base_height * 4 });
         SubState = 4;
         // Falls through into SubState 4
     }
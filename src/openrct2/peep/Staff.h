@@ -13,6 +13,8 @@
 #include "../common.h"
 #include "Peep.h"
 
+#include <vector>
+
 #define STAFF_MAX_COUNT 200
 // The number of elements in the gStaffPatrolAreas array per staff member. Every bit in the array represents a 4x4 square.
 // Right now, it's a 32-bit array like in RCT2. 32 * 128 = 4096 bits, which is also the number of 4x4 squares on a 256x256 map.
@@ -64,12 +66,32 @@ extern colour_t gStaffMechanicColour;
 extern colour_t gStaffSecurityColour;
 
 void staff_reset_modes();
+/**
+ * The sprite indices of all staff members in peep list order. The peep list also holds every guest in the park, so code
+ * that looks for staff often should go through this, it is only rebuilt when the entity lists change.
+ */
+const std::vector<uint16_t>& staff_get_sprite_indices();
 void staff_set_name(uint16_t spriteIndex, const char* name);
 bool staff_hire_new_member(StaffType staffType, EntertainerCostume entertainerType);
 void staff_update_greyed_patrol_areas();
 bool staff_is_patrol_area_set_for_type(StaffType type, const CoordsXY& coords);
 void staff_set_patrol_area(int32_t staffIndex, const CoordsXY& coords, bool value);
 void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords);
+void staff_clear_patrol_area(int32_t staffIndex);
+void staff_set_mode(int32_t staffIndex, StaffMode mode);
+/**
+ * The staff that are patrolling or heading to an inspection and may walk to loc, in the order of
+ * staff_get_sprite_indices. Unless anyPatrolArea is set, staff with a patrol area are only included when it covers loc.
+ * The result is looked up from the patrol coverage of each square and the staff known to be on patrol, and stays valid
+ * until the next call.
+ */
+const std::vector<Staff*>& staff_get_on_patrol_at(const CoordsXY& loc, bool anyPatrolArea);
+void staff_update_on_patrol(const Staff* staff);
+/**
+ * Makes the staff lookups rebuild from gStaffModes, gStaffPatrolAreas and the staff states. Needed after those are
+ * written in bulk, such as when a park is loaded.
+ */
+void staff_dispatch_invalidate();
 colour_t staff_get_colour(StaffType staffType);
 bool staff_set_colour(StaffType staffType, colour_t value);
 uint32_t staff_get_available_entertainer_costumes();
@@ -18,6 +18,9 @@
 #    include <cstring>
 #    include <ctime>
 #    include <pwd.h>
+#    include <signal.h>
+#    include <sys/wait.h>
+#    include <unistd.h>
 
 namespace Platform
 {
@@ -157,6 +160,28 @@ namespace Platform
 #    else
         log_warning("Emscripten cannot execute processes. The commandline was '%s'.", command.c_str());
         return -1;
+#    endif // __EMSCRIPTEN__
+    }
+
+    int32_t ForkProcess()
+    {
+#    ifndef __EMSCRIPTEN__
+        // Anything buffered would otherwise be written by both processes
+        fflush(stdout);
+        fflush(stderr);
+        return fork();
+#    else
+        return -1;
+#    endif // __EMSCRIPTEN__
+    }
+
+    void StopProcess(int32_t pid)
+    {
+#    ifndef __EMSCRIPTEN__
+        if (kill(pid, SIGTERM) == 0)
+        {
+            waitpid(pid, nullptr, 0);
+        }
 #    endif // __EMSCRIPTEN__
     }
 } // namespace Platform
@@ -43,6 +43,17 @@ namespace Platform
 #if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__)) || defined(__FreeBSD__)
     std::string GetEnvironmentPath(const char* name);
     std::string GetHomePath();
+
+    /**
+     * Starts a copy of the calling process that shares its memory copy on write. Returns the id of the new process to
+     * the caller, 0 to the new process and -1 if no process could be started.
+     */
+    int32_t ForkProcess();
+
+    /**
+     * Asks a process started by ForkProcess to exit and waits until it has.
+     */
+    void StopProcess(int32_t pid);
 #endif
 
     std::string FormatShortDate(std::time_t timestamp);
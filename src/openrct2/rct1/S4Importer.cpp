@@ -20,6 +20,7 @@
 #include "../core/FileStream.h"
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -1124,6 +1125,8 @@ private:
         ImportPeeps();
         ImportLitter();
         ImportMiscSprites();
+        // The vehicles and litter write their positions and screen bounds directly
+        sprite_hot_fields_sync_all();
     }
 
     void ImportVehicles()
@@ -1391,6 +1394,7 @@ private:
         // The RCT2/OpenRCT2 structures are bigger than in RCT1, so set them to zero
         std::fill(std::begin(gStaffModes), std::end(gStaffModes), StaffMode::None);
         std::fill(std::begin(gStaffPatrolAreas), std::end(gStaffPatrolAreas), 0);
+        staff_dispatch_invalidate();
 
         std::fill(std::begin(_s4.staff_modes), std::end(_s4.staff_modes), 0);
 
@@ -2003,10 +2007,14 @@ private:
     {
         gMapBaseZ = 7;
 
-        for (uint32_t index = 0, dstOffset = 0; index < RCT1_MAX_TILE_ELEMENTS; index++)
-        {
+        // Room for the RCT1 elements plus the blank surfaces that fill the rest of the map
+        map_reset_tile_element_store(RCT1_MAX_TILE_ELEMENTS + MAX_TILE_TILE_ELEMENT_POINTERS);
+
+        // Each element only writes its own slot, so they are converted in parallel. Banners are imported afterwards as
+        // they go into the shared banner list.
+        JobPool::ParallelFor(RCT1_MAX_TILE_ELEMENTS, [this](size_t index) {
             auto src = &_s4.tile_elements[index];
-            auto dst = &gTileElements[index + dstOffset];
+            auto dst = &gTileElements[index];
             if (src->base_height == RCT12_MAX_ELEMENT_HEIGHT)
             {
                 std::memcpy(dst, src, sizeof(*src));
@@ -2015,7 +2023,8 @@ private:
             {
                 ImportTileElement(dst, src);
             }
-        }
+        });
+        ImportBanners();
 
         ClearExtraTileEntries();
         FixWalls();
@@ -2257,13 +2266,6 @@ private:
                     dst2->SetIndex(BANNER_INDEX_NULL);
                 dst2->SetPosition(src2->GetPosition());
                 dst2->SetAllowedEdges(src2->GetAllowedEdges());
-
-                if (index < std::size(_s4.banners))
-                {
-                    auto srcBanner = &_s4.banners[index];
-                    auto dstBanner = GetBanner(index);
-                    ImportBanner(dstBanner, srcBanner);
-                }
                 break;
             }
             default:
@@ -2271,6 +2273,21 @@ private:
         }
     }
 
+    void ImportBanners()
+    {
+        for (const auto& src : _s4.tile_elements)
+        {
+            if (src.base_height == RCT12_MAX_ELEMENT_HEIGHT || src.GetType() != TILE_ELEMENT_TYPE_BANNER)
+                continue;
+
+            auto index = src.AsBanner()->GetIndex();
+            if (index < std::size(_s4.banners))
+            {
+                ImportBanner(GetBanner(index), &_s4.banners[index]);
+            }
+        }
+    }
+
     void ImportResearch()
     {
         // All available objects must be loaded before this method is called as it
@@ -2755,14 +2772,14 @@ private:
         std::fill(std::begin(gTileElementTilePointers), std::end(gTileElementTilePointers), nullptr);
 
         // Get the first free map element
-        TileElement* nextFreeTileElement = gTileElements;
+        TileElement* nextFreeTileElement = gTileElements.data();
         for (size_t i = 0; i < RCT1_MAX_MAP_SIZE * RCT1_MAX_MAP_SIZE; i++)
         {
             while (!(nextFreeTileElement++)->IsLastForTile())
                 ;
         }
 
-        TileElement* tileElement = gTileElements;
+        TileElement* tileElement = gTileElements.data();
         TileElement** tilePointer = gTileElementTilePointers;
 
         // 128 rows of map data from RCT1 map
@@ -2804,6 +2821,7 @@ private:
         }
 
         gNextFreeTileElement = nextFreeTileElement;
+        map_reset_tile_element_blocks();
     }
 
     void FixWalls()
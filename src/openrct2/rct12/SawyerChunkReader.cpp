@@ -40,6 +40,15 @@ public:
     }
 };
 
+class SawyerChunkDestinationTooSmallException : public SawyerChunkException
+{
+public:
+    SawyerChunkDestinationTooSmallException()
+        : SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL)
+    {
+    }
+};
+
 SawyerChunkReader::SawyerChunkReader(OpenRCT2::IStream* stream)
     : _stream(stream)
 {
@@ -143,22 +152,67 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-    auto chunkLength = chunk->GetLength();
-    if (chunkLength > length)
-    {
-        std::memcpy(dst, chunkData, length);
-    }
-    else
+    uint64_t originalPosition = _stream->GetPosition();
+    try
     {
-        std::memcpy(dst, chunkData, chunkLength);
-        auto remainingLength = length - chunkLength;
-        if (remainingLength > 0)
+        auto header = _stream->ReadValue<sawyercoding_chunk_header>();
+        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
+        // Streams in memory are decoded from in place, anything else has to be read into a buffer first
+        std::unique_ptr<uint8_t[]> compressedData;
+        const uint8_t* src = static_cast<const uint8_t*>(_stream->GetData());
+        if (src != nullptr)
         {
-            auto offset = static_cast<uint8_t*>(dst) + chunkLength;
-            std::fill_n(offset, remainingLength, 0x00);
+            auto position = _stream->GetPosition();
+            if (_stream->GetLength() - position < header.length)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+            }
+            src += position;
+            _stream->Seek(header.length, OpenRCT2::STREAM_SEEK_CURRENT);
         }
+        else
+        {
+            compressedData = std::unique_ptr<uint8_t[]>(new uint8_t[header.length]);
+            if (_stream->TryRead(compressedData.get(), header.length) != header.length)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+            }
+            src = compressedData.get();
+        }
+
+        // Chunks usually decode to exactly the size of the destination, so they are decoded straight into it. Only
+        // chunks that turn out to be larger go through a temporary buffer so that they can be truncated.
+        size_t uncompressedLength;
+        try
+        {
+            uncompressedLength = DecodeChunk(dst, length, src, header);
+        }
+        catch (const SawyerChunkDestinationTooSmallException&)
+        {
+            auto buffer = std::unique_ptr<void, decltype(&FreeLargeTempBuffer)>(
+                AllocateLargeTempBuffer(), &FreeLargeTempBuffer);
+            uncompressedLength = DecodeChunk(buffer.get(), MAX_UNCOMPRESSED_CHUNK_SIZE, src, header);
+            uncompressedLength = std::min(uncompressedLength, length);
+            std::memcpy(dst, buffer.get(), uncompressedLength);
+        }
+
+        if (uncompressedLength == 0)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+        }
+        if (uncompressedLength < length)
+        {
+            auto offset = static_cast<uint8_t*>(dst) + uncompressedLength;
+            std::fill_n(offset, length - uncompressedLength, 0x00);
+        }
+    }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
     }
 }
 
@@ -170,7 +224,7 @@ size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void*
         case CHUNK_ENCODING_NONE:
             if (header.length > dstCapacity)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                throw SawyerChunkDestinationTooSmallException();
             }
             std::memcpy(dst, src, header.length);
             resultLength = header.length;
@@ -218,7 +272,7 @@ size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const vo
             }
             if (dst8 + count > dstEnd)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                throw SawyerChunkDestinationTooSmallException();
             }
 
             std::fill_n(dst8, count, src8[i]);
@@ -232,7 +286,7 @@ size_t SawyerChunkReader::DecodeChunkRLE(void* dst, size_t dstCapacity, const vo
             }
             if (dst8 + rleCodeByte + 1 > dstEnd)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                throw SawyerChunkDestinationTooSmallException();
             }
             if (i + 1 + rleCodeByte + 1 > srcLength)
             {
@@ -256,6 +310,14 @@ size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const
     {
         if (src8[i] == 0xFF)
         {
+            if (i + 1 >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (dst8 >= dstEnd)
+            {
+                throw SawyerChunkDestinationTooSmallException();
+            }
             *dst8++ = src8[++i];
         }
         else
@@ -263,9 +325,9 @@ size_t SawyerChunkReader::DecodeChunkRepeat(void* dst, size_t dstCapacity, const
             size_t count = (src8[i] & 7) + 1;
             const uint8_t* copySrc = dst8 + static_cast<int32_t>(src8[i] >> 3) - 32;
 
-            if (dst8 + count >= dstEnd || copySrc + count >= dstEnd)
+            if (dst8 + count > dstEnd || copySrc + count > dstEnd)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                throw SawyerChunkDestinationTooSmallException();
             }
 
             std::memcpy(dst8, copySrc, count);
@@ -279,7 +341,7 @@ size_t SawyerChunkReader::DecodeChunkRotate(void* dst, size_t dstCapacity, const
 {
     if (srcLength > dstCapacity)
     {
-        throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+        throw SawyerChunkDestinationTooSmallException();
     }
 
     auto src8 = static_cast<const uint8_t*>(src);
@@ -10,11 +10,31 @@
 #include "SawyerChunkWriter.h"
 
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../util/SawyerCoding.h"
 
 // Maximum buffer size to store compressed data, maximum of 16 MiB
 constexpr size_t MAX_COMPRESSED_CHUNK_SIZE = 16 * 1024 * 1024;
 
+struct EncodedChunk
+{
+    // Left uninitialised, only the pages the encoder writes to are ever touched
+    std::unique_ptr<uint8_t[]> Data;
+    size_t Length = 0;
+};
+
+static EncodedChunk EncodeChunk(const void* src, size_t length, SAWYER_ENCODING encoding)
+{
+    sawyercoding_chunk_header header;
+    header.encoding = static_cast<uint8_t>(encoding);
+    header.length = static_cast<uint32_t>(length);
+
+    EncodedChunk result;
+    result.Data = std::unique_ptr<uint8_t[]>(new uint8_t[MAX_COMPRESSED_CHUNK_SIZE]);
+    result.Length = sawyercoding_write_chunk_buffer(result.Data.get(), static_cast<const uint8_t*>(src), header);
+    return result;
+}
+
 SawyerChunkWriter::SawyerChunkWriter(OpenRCT2::IStream* stream)
     : _stream(stream)
 {
@@ -27,14 +47,21 @@ void SawyerChunkWriter::WriteChunk(const SawyerChunk* chunk)
 
 void SawyerChunkWriter::WriteChunk(const void* src, size_t length, SAWYER_ENCODING encoding)
 {
-    sawyercoding_chunk_header header;
-    header.encoding = static_cast<uint8_t>(encoding);
-    header.length = static_cast<uint32_t>(length);
+    auto encoded = EncodeChunk(src, length, encoding);
+    _stream->Write(encoded.Data.get(), encoded.Length);
+}
 
-    auto data = std::make_unique<uint8_t[]>(MAX_COMPRESSED_CHUNK_SIZE);
-    size_t dataLength = sawyercoding_write_chunk_buffer(data.get(), static_cast<const uint8_t*>(src), header);
+void SawyerChunkWriter::WriteChunks(const std::vector<SawyerChunkSource>& chunks)
+{
+    std::vector<EncodedChunk> encoded(chunks.size());
+    JobPool::ParallelFor(chunks.size(), [&chunks, &encoded](size_t i) {
+        encoded[i] = EncodeChunk(chunks[i].Data, chunks[i].Length, chunks[i].Encoding);
+    });
 
-    _stream->Write(data.get(), dataLength);
+    for (const auto& chunk : encoded)
+    {
+        _stream->Write(chunk.Data.get(), chunk.Length);
+    }
 }
 
 /**
@@ -13,12 +13,23 @@
 #include "SawyerChunk.h"
 
 #include <memory>
+#include <vector>
 
 namespace OpenRCT2
 {
     struct IStream;
 }
 
+/**
+ * The data of a chunk that is yet to be encoded.
+ */
+struct SawyerChunkSource
+{
+    const void* Data;
+    size_t Length;
+    SAWYER_ENCODING Encoding;
+};
+
 /**
  * Writes sawyer encoding chunks to a data stream. This can be used to write
  * SC6 and SV6 files.
@@ -43,6 +54,12 @@ public:
      */
     void WriteChunk(const void* src, size_t length, SAWYER_ENCODING encoding);
 
+    /**
+     * Encodes the given chunks in parallel and writes them to the stream in order. The bytes written are the same
+     * as calling WriteChunk for each chunk one after another.
+     */
+    void WriteChunks(const std::vector<SawyerChunkSource>& chunks);
+
     /**
      * Writes a track chunk to the stream containing the given buffer.
      * @param src The source buffer.
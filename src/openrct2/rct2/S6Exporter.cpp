@@ -13,10 +13,12 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../Tracing.h"
 #include "../common.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/String.hpp"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -50,7 +52,9 @@
 #include <algorithm>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <iterator>
+#include <memory>
 #include <optional>
 
 S6Exporter::S6Exporter()
@@ -108,31 +112,57 @@ void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
         objRepo.WritePackedObjects(stream, ExportObjectsList);
     }
 
+    // The remaining chunks do not depend on each other, so they are encoded in parallel
+    std::vector<SawyerChunkSource> chunks;
+
     // 3: Write available objects chunk
-    chunkWriter.WriteChunk(_s6.objects, sizeof(_s6.objects), SAWYER_ENCODING::ROTATE);
+    chunks.push_back({ _s6.objects, sizeof(_s6.objects), SAWYER_ENCODING::ROTATE });
 
     // 4: Misc fields (data, rand...) chunk
-    chunkWriter.WriteChunk(&_s6.elapsed_months, 16, SAWYER_ENCODING::RLECOMPRESSED);
+    chunks.push_back({ &_s6.elapsed_months, 16, SAWYER_ENCODING::RLECOMPRESSED });
 
     // 5: Map elements + sprites and other fields chunk
-    chunkWriter.WriteChunk(&_s6.tile_elements, 0x180000, SAWYER_ENCODING::RLECOMPRESSED);
+    chunks.push_back({ &_s6.tile_elements, 0x180000, SAWYER_ENCODING::RLECOMPRESSED });
 
     if (_s6.header.type == S6_TYPE_SCENARIO)
     {
         // 6 to 13:
-        chunkWriter.WriteChunk(&_s6.next_free_tile_element_pointer_index, 0x27104C, SAWYER_ENCODING::RLECOMPRESSED);
-        chunkWriter.WriteChunk(&_s6.guests_in_park, 4, SAWYER_ENCODING::RLECOMPRESSED);
-        chunkWriter.WriteChunk(&_s6.last_guests_in_park, 8, SAWYER_ENCODING::RLECOMPRESSED);
-        chunkWriter.WriteChunk(&_s6.park_rating, 2, SAWYER_ENCODING::RLECOMPRESSED);
-        chunkWriter.WriteChunk(&_s6.active_research_types, 1082, SAWYER_ENCODING::RLECOMPRESSED);
-        chunkWriter.WriteChunk(&_s6.current_expenditure, 16, SAWYER_ENCODING::RLECOMPRESSED);
-        chunkWriter.WriteChunk(&_s6.park_value, 4, SAWYER_ENCODING::RLECOMPRESSED);
-        chunkWriter.WriteChunk(&_s6.completed_company_value, 0x761E8, SAWYER_ENCODING::RLECOMPRESSED);
+        chunks.push_back({ &_s6.next_free_tile_element_pointer_index, 0x27104C, SAWYER_ENCODING::RLECOMPRESSED });
+        chunks.push_back({ &_s6.guests_in_park, 4, SAWYER_ENCODING::RLECOMPRESSED });
+        chunks.push_back({ &_s6.last_guests_in_park, 8, SAWYER_ENCODING::RLECOMPRESSED });
+        chunks.push_back({ &_s6.park_rating, 2, SAWYER_ENCODING::RLECOMPRESSED });
+        chunks.push_back({ &_s6.active_research_types, 1082, SAWYER_ENCODING::RLECOMPRESSED });
+        chunks.push_back({ &_s6.current_expenditure, 16, SAWYER_ENCODING::RLECOMPRESSED });
+        chunks.push_back({ &_s6.park_value, 4, SAWYER_ENCODING::RLECOMPRESSED });
+        chunks.push_back({ &_s6.completed_company_value, 0x761E8, SAWYER_ENCODING::RLECOMPRESSED });
     }
     else
     {
         // 6: Everything else...
-        chunkWriter.WriteChunk(&_s6.next_free_tile_element_pointer_index, 0x2E8570, SAWYER_ENCODING::RLECOMPRESSED);
+        chunks.push_back({ &_s6.next_free_tile_element_pointer_index, 0x2E8570, SAWYER_ENCODING::RLECOMPRESSED });
+    }
+    chunkWriter.WriteChunks(chunks);
+
+    // OpenRCT2 chunks: tile elements and sprites past the RCT2 limits
+    if (!_extraTileElements.empty() || !_extraSprites.empty())
+    {
+        rct_s6_extension_header extensionHeader{};
+        extensionHeader.magic_number = S6_EXTENSION_MAGIC_NUMBER;
+        extensionHeader.version = S6_EXTENSION_VERSION;
+        extensionHeader.num_tile_elements = static_cast<uint32_t>(_extraTileElements.size());
+        extensionHeader.num_sprites = static_cast<uint32_t>(_extraSprites.size());
+        chunkWriter.WriteChunk(&extensionHeader, SAWYER_ENCODING::ROTATE);
+        if (!_extraTileElements.empty())
+        {
+            chunkWriter.WriteChunk(
+                _extraTileElements.data(), _extraTileElements.size() * sizeof(RCT12TileElement),
+                SAWYER_ENCODING::RLECOMPRESSED);
+        }
+        if (!_extraSprites.empty())
+        {
+            chunkWriter.WriteChunk(
+                _extraSprites.data(), _extraSprites.size() * sizeof(RCT2Sprite), SAWYER_ENCODING::RLECOMPRESSED);
+        }
     }
 
     // Determine number of bytes written
@@ -481,6 +511,9 @@ void S6Exporter::ExportParkName()
 
 void S6Exporter::ExportRides()
 {
+    // Dormant rides have not counted the ticks they skipped yet
+    Ride::WakeAll();
+
     const Ride nullRide{};
     for (int32_t index = 0; index < RCT12_MAX_RIDES_IN_PARK; index++)
     {
@@ -943,14 +976,36 @@ void S6Exporter::ExportMarketingCampaigns()
 
 void S6Exporter::ExportSprites()
 {
+    static_assert(
+        MAX_SPRITES - RCT2_MAX_SPRITES <= (16 * 1024 * 1024) / sizeof(RCT2Sprite), "The extra sprites do not fit in one chunk");
+
     // Sprites needs to be reset before they get used.
     // Might as well reset them in here to zero out the space and improve
     // compression ratios. Especially useful for multiplayer servers that
     // use zlib on the sent stream.
+    // Only the slots up to the last chunk in use are written, sprites past the RCT2 limit go to an OpenRCT2 chunk.
+    sprite_release_unused_chunks();
+    sprite_allocate(RCT2_MAX_SPRITES);
     sprite_clear_all_unused();
-    for (int32_t i = 0; i < RCT2_MAX_SPRITES; i++)
-    {
-        ExportSprite(&_s6.sprites[i], reinterpret_cast<const rct_sprite*>(GetEntity(i)));
+    const size_t numSprites = sprite_get_allocated_count();
+    _extraSprites.clear();
+    _extraSprites.resize(numSprites - RCT2_MAX_SPRITES);
+    auto getDst = [this](size_t index) {
+        return index < RCT2_MAX_SPRITES ? &_s6.sprites[index] : &_extraSprites[index - RCT2_MAX_SPRITES];
+    };
+
+    JobPool::ParallelFor(numSprites, [this, &getDst](size_t i) {
+        ExportSprite(getDst(i), reinterpret_cast<const rct_sprite*>(GetEntity(i)));
+    });
+
+    // User strings are numbered in the order they are allocated, so the names are exported in sprite order afterwards
+    for (size_t i = 0; i < numSprites; i++)
+    {
+        auto src = reinterpret_cast<const rct_sprite*>(GetEntity(i));
+        if (src->generic.sprite_identifier == SpriteIdentifier::Peep)
+        {
+            ExportPeepName(&getDst(i)->peep, &src->peep);
+        }
     }
 
     for (int32_t i = 0; i < static_cast<uint8_t>(EntityListId::Count); i++)
@@ -958,11 +1013,14 @@ void S6Exporter::ExportSprites()
         _s6.sprite_lists_head[i] = gSpriteListHead[i];
         _s6.sprite_lists_count[i] = gSpriteListCount[i];
     }
+    // The slots that are not written are free, the importer adds them back
+    _s6.sprite_lists_count[static_cast<uint8_t>(EntityListId::Free)] -= static_cast<uint16_t>(MAX_SPRITES - numSprites);
+    sprite_release_unused_chunks();
 }
 
 void S6Exporter::ExportSprite(RCT2Sprite* dst, const rct_sprite* src)
 {
-    std::memset(dst, 0, sizeof(rct_sprite));
+    std::memset(dst, 0, sizeof(*dst));
     switch (src->generic.sprite_identifier)
     {
         case SpriteIdentifier::Null:
@@ -1096,14 +1154,13 @@ void S6Exporter::ExportSpriteVehicle(RCT2SpriteVehicle* dst, const Vehicle* src)
     dst->target_seat_rotation = src->target_seat_rotation;
 }
 
-void S6Exporter::ExportSpritePeep(RCT2SpritePeep* dst, const Peep* src)
+void S6Exporter::ExportPeepName(RCT2SpritePeep* dst, const Peep* src)
 {
-    ExportSpriteCommonProperties(dst, static_cast<const SpriteBase*>(src));
-
     auto generateName = true;
-    if (src->Name != nullptr)
+    auto name = gPeepNames.Get(src->NameId);
+    if (name != nullptr)
     {
-        auto stringId = AllocateUserString(src->Name);
+        auto stringId = AllocateUserString(name);
         if (stringId != std::nullopt)
         {
             dst->name_string_idx = *stringId;
@@ -1113,7 +1170,7 @@ void S6Exporter::ExportSpritePeep(RCT2SpritePeep* dst, const Peep* src)
         {
             log_warning(
                 "Unable to allocate user string for peep #%d (%s) during S6 export.", static_cast<int>(src->sprite_index),
-                src->Name);
+                name);
         }
     }
     if (generateName)
@@ -1137,6 +1194,11 @@ void S6Exporter::ExportSpritePeep(RCT2SpritePeep* dst, const Peep* src)
             dst->name_string_idx = STR_GUEST_X;
         }
     }
+}
+
+void S6Exporter::ExportSpritePeep(RCT2SpritePeep* dst, const Peep* src)
+{
+    ExportSpriteCommonProperties(dst, static_cast<const SpriteBase*>(src));
 
     dst->next_x = src->NextLoc.x;
     dst->next_y = src->NextLoc.y;
@@ -1414,10 +1476,22 @@ void S6Exporter::ExportMapAnimations()
 
 void S6Exporter::ExportTileElements()
 {
-    for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
-    {
+    static_assert(
+        MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - RCT2_MAX_TILE_ELEMENTS <= (16 * 1024 * 1024) / sizeof(RCT12TileElement),
+        "The extra tile elements do not fit in one chunk");
+
+    // The elements have just been reorganised, everything after the last one in use is free space and stays zeroed
+    // Elements past the RCT2 limit are written to an OpenRCT2 chunk after the RCT2 ones
+    const auto numElements = static_cast<size_t>(gNextFreeTileElement - gTileElements.data());
+    const auto numS6Elements = std::min<size_t>(numElements, RCT2_MAX_TILE_ELEMENTS);
+    _extraTileElements.clear();
+    _extraTileElements.resize(numElements - numS6Elements);
+
+    // Elements are converted independently of each other, so they are split across the job pool
+    JobPool::ParallelFor(numElements, [this](size_t index) {
         auto src = &gTileElements[index];
-        auto dst = &_s6.tile_elements[index];
+        auto dst = index < RCT2_MAX_TILE_ELEMENTS ? &_s6.tile_elements[index]
+                                                  : &_extraTileElements[index - RCT2_MAX_TILE_ELEMENTS];
         if (src->base_height == MAX_ELEMENT_HEIGHT)
         {
             std::memcpy(dst, src, sizeof(*dst));
@@ -1431,7 +1505,7 @@ void S6Exporter::ExportTileElements()
             else
                 ExportTileElement(dst, src);
         }
-    }
+    });
     _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
 }
 
@@ -1681,12 +1755,13 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+// Autosaves that are still being written to disk
+static std::future<void> _backgroundSave;
+
 /**
- *
- *  rct2: 0x006754F5
- * @param flags bit 0: pack objects, 1: save as scenario
+ * Copies the current park into a new exporter, this has to happen on the game thread.
  */
-int32_t scenario_save(const utf8* path, int32_t flags)
+static std::unique_ptr<S6Exporter> scenario_export(const utf8* path, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
     {
@@ -1705,32 +1780,63 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     map_reorganise_elements();
     viewport_set_saved_view();
 
+    auto s6exporter = std::make_unique<S6Exporter>();
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
+        s6exporter->ExportObjectsList = objManager.GetPackableObjects();
+    }
+    s6exporter->RemoveTracklessRides = true;
+    s6exporter->Export();
+    return s6exporter;
+}
+
+/**
+ * Encodes an exported park and writes it to the file, only reads the state copied by scenario_export.
+ */
+static void scenario_write(S6Exporter& s6exporter, const utf8* path, int32_t flags)
+{
+    if (flags & S6_SAVE_FLAG_SCENARIO)
+    {
+        s6exporter.SaveScenario(path);
+    }
+    else
+    {
+        s6exporter.SaveGame(path);
+    }
+}
+
+void scenario_wait_for_background_save()
+{
+    if (_backgroundSave.valid())
+    {
+        _backgroundSave.get();
+    }
+}
+
+/**
+ *
+ *  rct2: 0x006754F5
+ * @param flags bit 0: pack objects, 1: save as scenario
+ */
+int32_t scenario_save(const utf8* path, int32_t flags)
+{
+    OpenRCT2::Tracing::ScopedSpan traceSpan("save_load", "save");
+
+    // Do not let an autosave still being written race with this one
+    scenario_wait_for_background_save();
+
     bool result = false;
-    auto s6exporter = new S6Exporter();
     try
     {
-        if (flags & S6_SAVE_FLAG_EXPORT)
-        {
-            auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
-            s6exporter->ExportObjectsList = objManager.GetPackableObjects();
-        }
-        s6exporter->RemoveTracklessRides = true;
-        s6exporter->Export();
-        if (flags & S6_SAVE_FLAG_SCENARIO)
-        {
-            s6exporter->SaveScenario(path);
-        }
-        else
-        {
-            s6exporter->SaveGame(path);
-        }
+        auto s6exporter = scenario_export(path, flags);
+        scenario_write(*s6exporter, path, flags);
         result = true;
     }
     catch (const std::exception& e)
     {
         log_error("Unable to save park: '%s'", e.what());
     }
-    delete s6exporter;
 
     gfx_invalidate_screen();
 
@@ -1740,3 +1846,46 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     }
     return result;
 }
+
+bool scenario_save_in_background(const utf8* path, int32_t flags, std::function<void()> prepareFn)
+{
+    OpenRCT2::Tracing::ScopedSpan traceSpan("save_load", "save_export");
+
+    // Packing objects reads the object repository, which is only safe to do on the game thread
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        if (prepareFn)
+            prepareFn();
+        return scenario_save(path, flags);
+    }
+
+    scenario_wait_for_background_save();
+
+    std::shared_ptr<S6Exporter> s6exporter;
+    try
+    {
+        s6exporter = scenario_export(path, flags);
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to save park: '%s'", e.what());
+        return false;
+    }
+
+    _backgroundSave = std::async(
+        std::launch::async, [s6exporter, savePath = std::string(path), flags, prepareFn = std::move(prepareFn)]() {
+            OpenRCT2::Tracing::ScopedSpan writeSpan("save_load", "save_write");
+            if (prepareFn)
+                prepareFn();
+
+            try
+            {
+                scenario_write(*s6exporter, savePath.c_str(), flags);
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to save park: '%s'", e.what());
+            }
+        });
+    return true;
+}
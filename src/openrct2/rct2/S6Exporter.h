@@ -51,11 +51,14 @@ public:
     void ExportSpriteCommonProperties(RCT12SpriteBase* dst, const SpriteBase* src);
     void ExportSpriteVehicle(RCT2SpriteVehicle* dst, const Vehicle* src);
     void ExportSpritePeep(RCT2SpritePeep* dst, const Peep* src);
+    void ExportPeepName(RCT2SpritePeep* dst, const Peep* src);
     void ExportSpriteMisc(RCT12SpriteBase* dst, const SpriteBase* src);
     void ExportSpriteLitter(RCT12SpriteLitter* dst, const Litter* src);
 
 private:
     rct_s6_data _s6{};
+    std::vector<RCT12TileElement> _extraTileElements;
+    std::vector<RCT2Sprite> _extraSprites;
     std::vector<std::string> _userStrings;
 
     void Save(OpenRCT2::IStream* stream, bool isScenario);
@@ -15,8 +15,9 @@
 #include "../ParkImporter.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
-#include "../core/FileStream.h"
+#include "../core/File.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/Random.hpp"
 #include "../core/String.hpp"
@@ -65,6 +66,8 @@ private:
 
     const utf8* _s6Path = nullptr;
     rct_s6_data _s6{};
+    std::vector<RCT12TileElement> _extraTileElements;
+    std::vector<RCT2Sprite> _extraSprites;
     uint8_t _gameVersion = 0;
     bool _isSV7 = false;
 
@@ -93,16 +96,20 @@ public:
 
     ParkLoadResult LoadSavedGame(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
-        auto result = LoadFromStream(&fs, false, skipObjectCheck);
+        // Reading the whole file at once lets the chunks be decoded from memory without further copies
+        auto data = File::ReadAllBytes(path);
+        auto ms = OpenRCT2::MemoryStream(data.data(), data.size(), OpenRCT2::MEMORY_ACCESS::READ);
+        auto result = LoadFromStream(&ms, false, skipObjectCheck);
         _s6Path = path;
         return result;
     }
 
     ParkLoadResult LoadScenario(const utf8* path, bool skipObjectCheck = false) override
     {
-        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
-        auto result = LoadFromStream(&fs, true, skipObjectCheck);
+        // Reading the whole file at once lets the chunks be decoded from memory without further copies
+        auto data = File::ReadAllBytes(path);
+        auto ms = OpenRCT2::MemoryStream(data.data(), data.size(), OpenRCT2::MEMORY_ACCESS::READ);
+        auto result = LoadFromStream(&ms, true, skipObjectCheck);
         _s6Path = path;
         return result;
     }
@@ -175,12 +182,54 @@ public:
             chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
             chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 3048816);
         }
+        ReadExtensionChunks(chunkReader, stream);
 
         _s6Path = path;
 
         return ParkLoadResult(GetRequiredObjects());
     }
 
+    /**
+     * Reads the OpenRCT2 chunks that follow the RCT2 ones, if there are any before the checksum.
+     */
+    void ReadExtensionChunks(SawyerChunkReader& chunkReader, OpenRCT2::IStream* stream)
+    {
+        _extraTileElements.clear();
+        _extraSprites.clear();
+        if (stream->GetPosition() + sizeof(uint32_t) >= stream->GetLength())
+        {
+            return;
+        }
+
+        rct_s6_extension_header extensionHeader{};
+        auto headerChunk = chunkReader.ReadChunk();
+        std::memcpy(&extensionHeader, headerChunk->GetData(), std::min(headerChunk->GetLength(), sizeof(extensionHeader)));
+        if (extensionHeader.magic_number != S6_EXTENSION_MAGIC_NUMBER)
+        {
+            throw IOException("Invalid extension chunk.");
+        }
+
+        if (extensionHeader.num_tile_elements > 0)
+        {
+            if (extensionHeader.num_tile_elements > MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - RCT2_MAX_TILE_ELEMENTS)
+            {
+                throw IOException("Too many tile elements.");
+            }
+            _extraTileElements.resize(extensionHeader.num_tile_elements);
+            chunkReader.ReadChunk(_extraTileElements.data(), _extraTileElements.size() * sizeof(RCT12TileElement));
+        }
+
+        if (extensionHeader.num_sprites > 0)
+        {
+            if (extensionHeader.num_sprites > MAX_SPRITES - RCT2_MAX_SPRITES)
+            {
+                throw IOException("Too many sprites.");
+            }
+            _extraSprites.resize(extensionHeader.num_sprites);
+            chunkReader.ReadChunk(_extraSprites.data(), _extraSprites.size() * sizeof(RCT2Sprite));
+        }
+    }
+
     bool GetDetails(scenario_index_entry* dst) override
     {
         *dst = {};
@@ -407,6 +456,7 @@ public:
         gGrassSceneryTileLoopPosition = _s6.grass_and_scenery_tilepos;
         std::memcpy(gStaffPatrolAreas, _s6.patrol_areas, sizeof(_s6.patrol_areas));
         std::memcpy(gStaffModes, _s6.staff_modes, sizeof(_s6.staff_modes));
+        staff_dispatch_invalidate();
         // unk_13CA73E
         // pad_13CA73F
         // unk_13CA740
@@ -1043,9 +1093,27 @@ public:
 
     void ImportTileElements()
     {
-        for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
+        // Elements past the RCT2 limit follow on from the ones in the RCT2 chunk
+        const uint32_t numStoredElements = _extraTileElements.empty()
+            ? RCT2_MAX_TILE_ELEMENTS
+            : static_cast<uint32_t>(RCT2_MAX_TILE_ELEMENTS + _extraTileElements.size());
+        auto getElement = [this](uint32_t index) -> const RCT12TileElement& {
+            return index < RCT2_MAX_TILE_ELEMENTS ? _s6.tile_elements[index]
+                                                  : _extraTileElements[index - RCT2_MAX_TILE_ELEMENTS];
+        };
+
+        // Only the element runs of the tiles are used, everything after them is free space
+        uint32_t numElements = 0;
+        for (size_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS && numElements < numStoredElements; i++)
+        {
+            while (numElements < numStoredElements && !getElement(numElements++).IsLastForTile())
+                ;
+        }
+
+        map_reset_tile_element_store(numElements);
+        for (uint32_t index = 0; index < numElements; index++)
         {
-            auto src = &_s6.tile_elements[index];
+            auto src = &getElement(index);
             auto dst = &gTileElements[index];
             if (src->base_height == RCT12_MAX_ELEMENT_HEIGHT)
             {
@@ -1299,9 +1367,17 @@ public:
 
     void ImportSprites()
     {
-        for (int32_t i = 0; i < RCT2_MAX_SPRITES; i++)
+        // Sprites past the RCT2 limit follow on from the ones in the RCT2 chunk
+        const size_t numSprites = RCT2_MAX_SPRITES + _extraSprites.size();
+        sprite_allocate(numSprites);
+        if (sprite_get_allocated_count() != numSprites)
+        {
+            // The slots past the imported ones would not be linked into the free list
+            throw IOException("Invalid sprite count.");
+        }
+        for (size_t i = 0; i < numSprites; i++)
         {
-            auto src = &_s6.sprites[i];
+            auto src = i < RCT2_MAX_SPRITES ? &_s6.sprites[i] : &_extraSprites[i - RCT2_MAX_SPRITES];
             auto dst = GetEntity(i);
             ImportSprite(reinterpret_cast<rct_sprite*>(dst), src);
         }
@@ -1312,7 +1388,10 @@ public:
             gSpriteListCount[i] = _s6.sprite_lists_count[i];
         }
         // This list contains the number of free slots. Increase it according to our own sprite limit.
-        gSpriteListCount[static_cast<uint8_t>(EntityListId::Free)] += (MAX_SPRITES - RCT2_MAX_SPRITES);
+        gSpriteListCount[static_cast<uint8_t>(EntityListId::Free)] += static_cast<uint16_t>(MAX_SPRITES - numSprites);
+        IncrementEntityListRevision();
+        sprite_hot_fields_sync_all();
+        sprite_release_unused_chunks();
     }
 
     void ImportSprite(rct_sprite* dst, const RCT2Sprite* src)
@@ -83,6 +83,10 @@ static constexpr const int32_t RideInspectionInterval[] = {
 
 static std::vector<Ride> _rides;
 
+// Passes of Ride::UpdateAll, dormant rides count the passes they skipped from these
+static uint32_t _rideUpdatePass;
+static ride_id_t _rideUpdatePassRide = RIDE_ID_NULL;
+
 bool gGotoStartPlacementMode = false;
 
 money16 gTotalRideValueForMoney;
@@ -1985,13 +1989,54 @@ void Ride::UpdateAll()
 
     window_update_viewport_ride_music();
 
-    // Update rides
+    // Update rides. Dormant rides are only updated on the ticks their breakdown and inspection timers run and on the
+    // tick their customer count is due, the counters of the ticks in between are caught up when they are woken.
+    _rideUpdatePass++;
+    const bool isTimerTick = (gCurrentTicks & 255) == 0;
     for (auto& ride : GetRideManager())
+    {
+        if (ride.dormant && !isTimerTick && ride.dormant_wake_pass != _rideUpdatePass)
+            continue;
+
+        _rideUpdatePassRide = ride.id;
+        ride.Wake();
         ride.Update();
+        if (ride.CanBeDormant())
+        {
+            ride.dormant = true;
+            ride.dormant_since_pass = _rideUpdatePass;
+            ride.dormant_wake_pass = _rideUpdatePass + (960 - ride.num_customers_timeout);
+        }
+    }
+    _rideUpdatePassRide = RIDE_ID_NULL;
 
     ride_music_update_final();
 }
 
+/**
+ * Puts a dormant ride back into the update after catching up the counters of the passes it skipped. Must be called
+ * before anything changes the state that Ride::CanBeDormant() looked at.
+ */
+void Ride::Wake()
+{
+    if (!dormant)
+        return;
+
+    // Rides that come after the one being updated have not had the current pass yet
+    uint32_t lastPass = _rideUpdatePass;
+    if (_rideUpdatePassRide != RIDE_ID_NULL && id >= _rideUpdatePassRide)
+        lastPass--;
+
+    num_customers_timeout += static_cast<uint16_t>(lastPass - dormant_since_pass);
+    dormant = false;
+}
+
+void Ride::WakeAll()
+{
+    for (auto& ride : GetRideManager())
+        ride.Wake();
+}
+
 std::unique_ptr<TrackDesign> Ride::SaveToTrackDesign() const
 {
     if (!(lifecycle_flags & RIDE_LIFECYCLE_TESTED))
@@ -2017,6 +2062,45 @@ std::unique_ptr<TrackDesign> Ride::SaveToTrackDesign() const
     return td;
 }
 
+/**
+ * Whether every update until the next timer tick or customer count would only advance num_customers_timeout. That
+ * holds for open shops and for closed rides nobody is on, as long as their stations are not counting down.
+ */
+bool Ride::CanBeDormant() const
+{
+    if (status == RIDE_STATUS_OPEN)
+    {
+        if (!ride_type_has_flag(type, RIDE_TYPE_FLAG_IS_SHOP))
+            return false;
+        if (ride_type_has_flag(type, RIDE_TYPE_FLAG_MUSIC_ON_DEFAULT | RIDE_TYPE_FLAG_ALLOW_MUSIC)
+            && (lifecycle_flags & RIDE_LIFECYCLE_MUSIC))
+            return false;
+    }
+    else if (status != RIDE_STATUS_CLOSED || num_riders != 0)
+    {
+        return false;
+    }
+
+    if (type == RIDE_TYPE_CHAIRLIFT || type == RIDE_TYPE_SPIRAL_SLIDE || vehicle_change_timeout != 0)
+        return false;
+    if (lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_DUE_INSPECTION))
+        return false;
+
+    // Closed races, dodgems and block sectioned rides only clear their depart flag, the others count down
+    // their depart time until it reaches 0 or 127
+    if (type == RIDE_TYPE_MAZE || mode == RideMode::Race || mode == RideMode::Dodgems || IsBlockSectioned())
+        return true;
+    for (const auto& station : stations)
+    {
+        if (station.Start.isNull())
+            continue;
+        const int32_t time = station.Depart & STATION_DEPART_MASK;
+        if (time != 0 && time != 127)
+            return false;
+    }
+    return true;
+}
+
 /**
  *
  *  rct2: 0x006ABE73
@@ -2712,7 +2796,10 @@ Peep* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspect
     Peep* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
-    for (auto peep : EntityList<Staff>(EntityListId::Peep))
+    // Only mechanics on patrol can answer, and inside the park only those whose patrol covers the entrance
+    auto location = entrancePosition.ToTileStart();
+    bool inPark = map_is_location_in_park(location);
+    for (auto peep : staff_get_on_patrol_at(location, !inPark))
     {
         if (peep->AssignedStaffType != StaffType::Mechanic)
             continue;
@@ -2736,10 +2823,8 @@ Peep* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspect
                 continue;
         }
 
-        auto location = entrancePosition.ToTileStart();
-        if (map_is_location_in_park(location))
-            if (!peep->AsStaff()->IsLocationInPatrol(location))
-                continue;
+        if (inPark && !peep->IsLocationInPatrol(location))
+            continue;
 
         if (peep->x == LOCATION_NULL)
             continue;
@@ -2869,6 +2954,37 @@ static void ride_music_update(Ride* ride)
 
 #pragma region Measurement functions
 
+// Only the few rides with a measurement are updated each tick, the list is rebuilt when a measurement comes or goes
+static uint32_t _rideMeasurementRevision = 0;
+static uint32_t _measuredRidesRevision = 0;
+static std::vector<ride_id_t> _measuredRides;
+
+RideMeasurement::RideMeasurement()
+{
+    _rideMeasurementRevision++;
+}
+
+RideMeasurement::~RideMeasurement()
+{
+    _rideMeasurementRevision++;
+}
+
+static void ride_measurements_refresh_measured_rides()
+{
+    if (_measuredRidesRevision == _rideMeasurementRevision)
+        return;
+
+    _measuredRidesRevision = _rideMeasurementRevision;
+    _measuredRides.clear();
+    for (auto& ride : GetRideManager())
+    {
+        if (ride.measurement != nullptr)
+        {
+            _measuredRides.push_back(ride.id);
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006B64F2
@@ -2952,9 +3068,16 @@ void ride_measurements_update()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
+    ride_measurements_refresh_measured_rides();
+
     // For each ride measurement
-    for (auto& ride : GetRideManager())
+    for (auto rideId : _measuredRides)
     {
+        auto ridePtr = get_ride(rideId);
+        if (ridePtr == nullptr)
+            continue;
+
+        auto& ride = *ridePtr;
         auto measurement = ride.measurement.get();
         if (measurement != nullptr && (ride.lifecycle_flags & RIDE_LIFECYCLE_ON_TRACK) && ride.status != RIDE_STATUS_SIMULATING)
         {
@@ -4742,6 +4865,7 @@ bool Ride::CreateVehicles(const CoordsXYE& element, bool isApplying)
 
     // Initialise station departs
     // 006DDDD0:
+    Wake();
     lifecycle_flags |= RIDE_LIFECYCLE_ON_TRACK;
     for (int32_t i = 0; i < MAX_STATIONS; i++)
     {
@@ -7129,6 +7253,7 @@ void Ride::Delete()
     custom_name = {};
     measurement = {};
     type = RIDE_TYPE_NULL;
+    dormant = false;
 }
 
 void Ride::Renew()
@@ -180,6 +180,12 @@ struct RideMeasurement
     int8_t lateral[MAX_ITEMS]{};
     uint8_t velocity[MAX_ITEMS]{};
     uint8_t altitude[MAX_ITEMS]{};
+
+    // Creating or destroying a measurement tells ride_measurements_update to look for the measured rides again
+    RideMeasurement();
+    ~RideMeasurement();
+    RideMeasurement(const RideMeasurement&) = delete;
+    RideMeasurement& operator=(const RideMeasurement&) = delete;
 };
 
 enum class RideClassification
@@ -368,6 +374,11 @@ public:
     // They don't require export/import.
     uint8_t current_issues;
     uint32_t last_issue_time;
+    // Dormant rides are left out of Ride::UpdateAll until they are woken, see Ride::Wake().
+    // They don't require export/import.
+    bool dormant;
+    uint32_t dormant_since_pass;
+    uint32_t dormant_wake_pass;
     RideStation stations[MAX_STATIONS];
     uint16_t inversions;
     uint16_t holes;
@@ -377,6 +388,7 @@ public:
 
 private:
     void Update();
+    bool CanBeDormant() const;
     void UpdateChairlift();
     void UpdateSpiralSlide();
     void UpdateQueueLength(StationIndex stationIndex);
@@ -392,6 +404,7 @@ public:
     bool IsRide() const;
     void Renew();
     void Delete();
+    void Wake();
     void Crash(uint8_t vehicleIndex);
     void SetToDefaultInspectionInterval();
     void SetRideEntry(int32_t rideEntry);
@@ -438,6 +451,7 @@ public:
     void FormatStatusTo(Formatter&) const;
 
     static void UpdateAll();
+    static void WakeAll();
     static bool NameExists(const std::string_view& name, ride_id_t excludeRideId = RIDE_ID_NULL);
 
     std::unique_ptr<TrackDesign> SaveToTrackDesign() const;
@@ -503,7 +517,8 @@ enum
     RIDE_LIFECYCLE_CABLE_LIFT_HILL_COMPONENT_USED = 1 << 16,
     RIDE_LIFECYCLE_CABLE_LIFT = 1 << 17,
     RIDE_LIFECYCLE_NOT_CUSTOM_DESIGN = 1 << 18,   // Used for the Award for Best Custom-designed Rides
-    RIDE_LIFECYCLE_SIX_FLAGS_DEPRECATED = 1 << 19 // Not used anymore
+    RIDE_LIFECYCLE_SIX_FLAGS_DEPRECATED = 1 << 19, // Not used anymore
+    RIDE_LIFECYCLE_RATINGS_PENDING = 1 << 20,      // Finished testing, rated out of turn by ride_ratings_update_all
 };
 
 // Constants used by the ride_type->flags property at 0x008
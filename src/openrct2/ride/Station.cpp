@@ -323,6 +323,10 @@ static void ride_invalidate_station_start(Ride* ride, StationIndex stationIndex,
     if (tileElement == nullptr)
         return;
 
+    // Idle stations keep asking for the same light every tick, only repaint when it actually changes
+    if (tileElement->AsTrack()->HasGreenLight() == greenLight)
+        return;
+
     tileElement->AsTrack()->SetHasGreenLight(greenLight);
 
     // Invalidate map tile
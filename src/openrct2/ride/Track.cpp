@@ -671,6 +671,7 @@ bool track_add_station_element(CoordsXYZD loc, ride_id_t rideIndex, int32_t flag
             ride->stations[stationIndex].Start.x = loc.x;
             ride->stations[stationIndex].Start.y = loc.y;
             ride->stations[stationIndex].Height = loc.z / COORDS_Z_STEP;
+            ride->Wake();
             ride->stations[stationIndex].Depart = 1;
             ride->stations[stationIndex].Length = 0;
             ride->num_stations++;
@@ -763,6 +764,7 @@ bool track_add_station_element(CoordsXYZD loc, ride_id_t rideIndex, int32_t flag
                     {
                         ride->stations[stationIndex].Start = loc;
                         ride->stations[stationIndex].Height = loc.z / COORDS_Z_STEP;
+                        ride->Wake();
                         ride->stations[stationIndex].Depart = 1;
                         ride->stations[stationIndex].Length = stationLength;
                         ride->num_stations++;
@@ -899,6 +901,7 @@ bool track_remove_station_element(const CoordsXYZD& loc, ride_id_t rideIndex, in
                     {
                         ride->stations[stationIndex].Start = currentLoc;
                         ride->stations[stationIndex].Height = currentLoc.z / COORDS_Z_STEP;
+                        ride->Wake();
                         ride->stations[stationIndex].Depart = 1;
                         ride->stations[stationIndex].Length = stationLength != 0 ? stationLength : byte_F441D1;
                         ride->num_stations++;
@@ -15,7 +15,7 @@
 #include <iterator>
 
 // clang-format off
-const rct_track_coordinates FlatTrackCoordinates[TrackElemType::Count] = {
+constexpr const rct_track_coordinates FlatTrackCoordinates[TrackElemType::Count] = {
     {    0,    0,    0,    0,    0,    0 },
     {    0,    0,    0,    0,    0,    0 },
     {    0,    0,    0,    0,    0,    0 },
@@ -271,7 +271,7 @@ const rct_track_coordinates FlatTrackCoordinates[TrackElemType::Count] = {
     {    0,    1,   96,    0,    0,  -32 },
 };
 
-const rct_track_coordinates TrackCoordinates[TrackElemType::Count] = {
+constexpr const rct_track_coordinates TrackCoordinates[TrackElemType::Count] = {
         { 0, 0, 0, 0, 0, 0 },       // ELEM_FLAT
         { 0, 0, 0, 0, 0, 0 },       // ELEM_END_STATION
         { 0, 0, 0, 0, 0, 0 },       // ELEM_BEGIN_STATION
@@ -531,7 +531,7 @@ const rct_track_coordinates TrackCoordinates[TrackElemType::Count] = {
 };
 
 /** rct2: 0x0099BA64 */
-const uint8_t TrackSequenceProperties[][MaxSequencesPerPiece] = {
+constexpr const uint8_t TrackSequenceProperties[][MaxSequencesPerPiece] = {
     { 0 },
     /* TrackElemType::EndStation */    { TRACK_SEQUENCE_FLAG_DIRECTION_1 | TRACK_SEQUENCE_FLAG_DIRECTION_3 | TRACK_SEQUENCE_FLAG_ORIGIN | TRACK_SEQUENCE_FLAG_DISALLOW_DOORS, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
     /* TrackElemType::BeginStation */  { TRACK_SEQUENCE_FLAG_DIRECTION_1 | TRACK_SEQUENCE_FLAG_DIRECTION_3 | TRACK_SEQUENCE_FLAG_ORIGIN | TRACK_SEQUENCE_FLAG_DISALLOW_DOORS, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
@@ -791,7 +791,7 @@ const uint8_t TrackSequenceProperties[][MaxSequencesPerPiece] = {
 };
 
 /** rct2: 0x0099CA64 */
-const uint8_t FlatRideTrackSequenceProperties[][MaxSequencesPerPiece] = {
+constexpr const uint8_t FlatRideTrackSequenceProperties[][MaxSequencesPerPiece] = {
     { 0 },
     /* 1 */ { TRACK_SEQUENCE_FLAG_DIRECTION_1 | TRACK_SEQUENCE_FLAG_DIRECTION_3 | TRACK_SEQUENCE_FLAG_ORIGIN, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
     /* 2 */ { TRACK_SEQUENCE_FLAG_DIRECTION_1 | TRACK_SEQUENCE_FLAG_DIRECTION_3 | TRACK_SEQUENCE_FLAG_ORIGIN, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
@@ -2937,7 +2937,7 @@ static constexpr const rct_preview_track TrackBlocks255[] = {
 };
 
 // rct2: 0x00994638
-const rct_preview_track *TrackBlocks[TrackElemType::Count] = {
+constexpr const rct_preview_track* const TrackBlocks[TrackElemType::Count] = {
     TrackBlocks000,
     TrackBlocks001,
     TrackBlocks002,
@@ -3297,7 +3297,7 @@ static constexpr const rct_preview_track FlatRideTrackBlocks255[] = {
 };
 
 // rct2: 0x00994A38
-const rct_preview_track *FlatRideTrackBlocks[TrackElemType::Count] = {
+constexpr const rct_preview_track* const FlatRideTrackBlocks[TrackElemType::Count] = {
     TrackBlocks000,
     TrackBlocks001,
     TrackBlocks002,
@@ -3556,7 +3556,7 @@ const rct_preview_track *FlatRideTrackBlocks[TrackElemType::Count] = {
     FlatRideTrackBlocks255
 };
 
-const uint8_t TrackPieceLengths[TrackElemType::Count] = {
+constexpr const uint8_t TrackPieceLengths[TrackElemType::Count] = {
     32,     // TrackElemType::Flat
     32,     // TrackElemType::EndStation
     32,     // TrackElemType::BeginStation
@@ -3816,7 +3816,7 @@ const uint8_t TrackPieceLengths[TrackElemType::Count] = {
 };
 
 // rct2: 0x00998C95
-const track_curve_chain gTrackCurveChain[TrackElemType::Count] = {
+constexpr const track_curve_chain gTrackCurveChain[TrackElemType::Count] = {
     { TRACK_CURVE_NONE, TRACK_CURVE_NONE },
     { RideConstructionSpecialPieceSelected | TrackElemType::EndStation, RideConstructionSpecialPieceSelected | TrackElemType::EndStation },
     { RideConstructionSpecialPieceSelected | TrackElemType::EndStation, RideConstructionSpecialPieceSelected | TrackElemType::EndStation },
@@ -4076,7 +4076,7 @@ const track_curve_chain gTrackCurveChain[TrackElemType::Count] = {
 };
 
 // rct2: 0x00999095
-const track_curve_chain gFlatRideTrackCurveChain[TrackElemType::Count] = {
+constexpr const track_curve_chain gFlatRideTrackCurveChain[TrackElemType::Count] = {
     { 0, 0 },
     { 257, 257 },
     { 257, 257 },
@@ -4335,7 +4335,7 @@ const track_curve_chain gFlatRideTrackCurveChain[TrackElemType::Count] = {
     { 0, 57088 },
 };
 
-const track_descriptor gTrackDescriptors[142] = {
+constexpr const track_descriptor gTrackDescriptors[142] = {
     {   true,   TRACK_SLOPE_DOWN_60,    TRACK_BANK_NONE,    TRACK_CURVE_NONE,               TRACK_SLOPE_DOWN_60,    TRACK_BANK_NONE,    TrackElemType::DiagDown60                                     },
     {   true,   TRACK_SLOPE_DOWN_60,    TRACK_BANK_NONE,    TRACK_CURVE_NONE,               TRACK_SLOPE_DOWN_25,    TRACK_BANK_NONE,    TrackElemType::DiagDown60ToDown25                      },
     {   true,   TRACK_SLOPE_DOWN_60,    TRACK_BANK_NONE,    TRACK_CURVE_NONE,               TRACK_SLOPE_NONE,       TRACK_BANK_NONE,    TrackElemType::DiagDown60ToFlat                             },
@@ -4481,7 +4481,7 @@ const track_descriptor gTrackDescriptors[142] = {
 };
 
 /** rct2: 0x00993D1C */
-const int16_t AlternativeTrackTypes[TrackElemType::Count] = {
+constexpr const int16_t AlternativeTrackTypes[TrackElemType::Count] = {
     TrackElemType::FlatCovered,                        // TrackElemType::Flat
     -1,
     -1,
@@ -4741,7 +4741,7 @@ const int16_t AlternativeTrackTypes[TrackElemType::Count] = {
 };
 
 /** rct2: 0x0099DA34 */
-const money32 TrackPricing[] = {
+constexpr const money32 TrackPricing[] = {
     65536,  // TrackElemType::Flat
     98304,  // TrackElemType::EndStation
     98304,  // TrackElemType::BeginStation
@@ -5001,7 +5001,7 @@ const money32 TrackPricing[] = {
 };
 
 /** rct2: 0x0099DE34 */
-const money32 FlatRideTrackPricing[] = {
+constexpr const money32 FlatRideTrackPricing[] = {
     65536,
     98304,
     98304,
@@ -5258,7 +5258,7 @@ const money32 FlatRideTrackPricing[] = {
 };
 
 /** rct2: 0x0099E228, 0x0099E229, 0x0099E22A, 0x0099E22B */
-const dodgems_track_size DodgemsTrackSize[] = {
+constexpr const dodgems_track_size DodgemsTrackSize[] = {
     { 0,    0,  0,      0 },
     { 0,    0,  0,      0 },
     { 0,    0,  0,      0 },
@@ -5515,7 +5515,7 @@ const dodgems_track_size DodgemsTrackSize[] = {
 };
 
 /** rct2: 0x0099EA1C */
-const uint8_t TrackElementMirrorMap[] = {
+constexpr const uint8_t TrackElementMirrorMap[] = {
     TrackElemType::Flat,
     TrackElemType::EndStation,
     TrackElemType::BeginStation,
@@ -5775,7 +5775,7 @@ const uint8_t TrackElementMirrorMap[] = {
 };
 
 /** rct2: 0x00999694 */
-const uint32_t TrackHeightMarkerPositions[TrackElemType::Count] = {
+constexpr const uint32_t TrackHeightMarkerPositions[TrackElemType::Count] = {
     (1 << 0), // TrackElemType::Flat
     (1 << 0), // TrackElemType::EndStation
     (1 << 0), // TrackElemType::BeginStation
@@ -6035,7 +6035,7 @@ const uint32_t TrackHeightMarkerPositions[TrackElemType::Count] = {
 };
 
 /** rct2: 0x00999A94 */
-const uint8_t TrackSequenceElementAllowedWallEdges[][MaxSequencesPerPiece] = {
+constexpr const uint8_t TrackSequenceElementAllowedWallEdges[][MaxSequencesPerPiece] = {
     { 0b1010,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0 }, // TrackElemType::Flat
     {      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0 }, // TrackElemType::EndStation
     {      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0 }, // TrackElemType::BeginStation
@@ -6295,7 +6295,7 @@ const uint8_t TrackSequenceElementAllowedWallEdges[][MaxSequencesPerPiece] = {
 };
 
 /** rct2: 0x0099AA94 */
-const uint8_t FlatRideTrackSequenceElementAllowedWallEdges[][MaxSequencesPerPiece] = {
+constexpr const uint8_t FlatRideTrackSequenceElementAllowedWallEdges[][MaxSequencesPerPiece] = {
     { 0b1010,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0 },
     {      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0 },
     {      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0 },
@@ -6552,7 +6552,7 @@ const uint8_t FlatRideTrackSequenceElementAllowedWallEdges[][MaxSequencesPerPiec
 };
 
 /** rct2: 0x0099443C */
-const uint16_t FlatTrackFlags[] = {
+constexpr const uint16_t FlatTrackFlags[] = {
     /*                                                                 */   TRACK_ELEM_FLAG_ALLOW_LIFT_HILL,
     /*                                                                 */   0,
     /*                                                                 */   0,
@@ -6810,7 +6810,7 @@ const uint16_t FlatTrackFlags[] = {
 };
 
 /** rct2: 0x0099423C */
-const uint16_t TrackFlags[] = {
+constexpr const uint16_t TrackFlags[] = {
     /* TrackElemType::Flat                                          */   TRACK_ELEM_FLAG_ALLOW_LIFT_HILL,
     /* TrackElemType::EndStation                                    */   0,
     /* TrackElemType::BeginStation                                  */   0,
@@ -7069,3 +7069,90 @@ const uint16_t TrackFlags[] = {
     /*                                                              */   TRACK_ELEM_FLAG_UP | TRACK_ELEM_FLAG_NORMAL_TO_INVERSION | TRACK_ELEM_FLAG_INVERSION_TO_NORMAL,
 };
 // clang-format on
+
+static constexpr std::array<track_swing_amount, TrackElemType::Count> GetTrackSwingAmounts()
+{
+    std::array<track_swing_amount, TrackElemType::Count> result{};
+    auto set = [&result](std::initializer_list<track_type_t> trackTypes, int8_t firstHalf, int8_t secondHalf) {
+        for (auto trackType : trackTypes)
+        {
+            result[trackType] = { firstHalf, secondHalf };
+        }
+    };
+
+    using namespace TrackElemType;
+    set({ LeftQuarterTurn5Tiles, BankedLeftQuarterTurn5Tiles, LeftQuarterTurn5TilesUp25, LeftQuarterTurn5TilesDown25,
+          LeftQuarterTurn5TilesCovered, LeftHalfBankedHelixUpLarge, LeftHalfBankedHelixDownLarge,
+          LeftQuarterBankedHelixLargeUp, LeftQuarterBankedHelixLargeDown, LeftQuarterHelixLargeUp,
+          LeftQuarterHelixLargeDown, LeftBankedQuarterTurn5TileUp25, LeftBankedQuarterTurn5TileDown25 },
+        14, 14);
+    set({ RightQuarterTurn5Tiles, BankedRightQuarterTurn5Tiles, RightQuarterTurn5TilesUp25, RightQuarterTurn5TilesDown25,
+          RightQuarterTurn5TilesCovered, RightHalfBankedHelixUpLarge, RightHalfBankedHelixDownLarge,
+          RightQuarterBankedHelixLargeUp, RightQuarterBankedHelixLargeDown, RightQuarterHelixLargeUp,
+          RightQuarterHelixLargeDown, RightBankedQuarterTurn5TileUp25, RightBankedQuarterTurn5TileDown25 },
+        -14, -14);
+    set({ SBendLeft, SBendLeftCovered }, 14, -15);
+    set({ SBendRight, SBendRightCovered }, -14, 15);
+    set({ LeftQuarterTurn3Tiles, LeftBankedQuarterTurn3Tiles, LeftQuarterTurn3TilesUp25, LeftQuarterTurn3TilesDown25,
+          LeftQuarterTurn3TilesCovered, LeftHalfBankedHelixUpSmall, LeftHalfBankedHelixDownSmall,
+          LeftBankToLeftQuarterTurn3TilesUp25, LeftQuarterTurn3TilesDown25ToLeftBank, LeftCurvedLiftHill,
+          LeftBankedQuarterTurn3TileUp25, LeftBankedQuarterTurn3TileDown25 },
+        13, 13);
+    set({ RightQuarterTurn3Tiles, RightBankedQuarterTurn3Tiles, RightQuarterTurn3TilesUp25, RightQuarterTurn3TilesDown25,
+          RightQuarterTurn3TilesCovered, RightHalfBankedHelixUpSmall, RightHalfBankedHelixDownSmall,
+          RightBankToRightQuarterTurn3TilesUp25, RightQuarterTurn3TilesDown25ToRightBank, RightCurvedLiftHill,
+          RightBankedQuarterTurn3TileUp25, RightBankedQuarterTurn3TileDown25 },
+        -13, -13);
+    set({ LeftQuarterTurn1Tile, LeftQuarterTurn1TileUp60, LeftQuarterTurn1TileDown60 }, 12, 12);
+    set({ RightQuarterTurn1Tile, RightQuarterTurn1TileUp60, RightQuarterTurn1TileDown60 }, -12, -12);
+    set({ LeftEighthToDiag, LeftEighthToOrthogonal, LeftEighthBankToDiag, LeftEighthBankToOrthogonal }, 15, 15);
+    set({ RightEighthToDiag, RightEighthToOrthogonal, RightEighthBankToDiag, RightEighthBankToOrthogonal }, -15, -15);
+    return result;
+}
+
+constexpr const std::array<track_swing_amount, TrackElemType::Count> TrackSwingAmounts = GetTrackSwingAmounts();
+
+#pragma region Compile time checks
+
+static constexpr bool TrackElementMirrorMapIsSymmetric()
+{
+    for (size_t i = 0; i < TrackElemType::Count; i++)
+    {
+        if (TrackElementMirrorMap[TrackElementMirrorMap[i]] != i)
+            return false;
+    }
+    return true;
+}
+
+static constexpr bool TrackSwingAmountsAreMirrored()
+{
+    for (size_t i = 0; i < TrackElemType::Count; i++)
+    {
+        const auto& swing = TrackSwingAmounts[i];
+        const auto& mirrored = TrackSwingAmounts[TrackElementMirrorMap[i]];
+        if (mirrored.first_half != -swing.first_half || mirrored.second_half != -swing.second_half)
+            return false;
+    }
+    return true;
+}
+
+static constexpr bool TrackBlocksAreTerminated(const rct_preview_track* const* trackBlocks)
+{
+    for (size_t i = 0; i < TrackElemType::Count; i++)
+    {
+        size_t sequence = 0;
+        while (trackBlocks[i][sequence].index != 255)
+        {
+            if (trackBlocks[i][sequence].index != sequence || ++sequence > MaxSequencesPerPiece)
+                return false;
+        }
+    }
+    return true;
+}
+
+static_assert(TrackElementMirrorMapIsSymmetric(), "Mirroring a piece twice must give the same piece");
+static_assert(TrackSwingAmountsAreMirrored(), "Mirrored pieces must swing cars the opposite way");
+static_assert(TrackBlocksAreTerminated(TrackBlocks), "Track blocks must be numbered in order and fit in a piece");
+static_assert(TrackBlocksAreTerminated(FlatRideTrackBlocks), "Track blocks must be numbered in order and fit in a piece");
+
+#pragma endregion
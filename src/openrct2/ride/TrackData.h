@@ -13,6 +13,8 @@
 #include "Track.h"
 #include "TrackPaint.h"
 
+#include <array>
+
 constexpr const uint8_t MaxSequencesPerPiece = 16;
 
 // 0x009968BB, 0x009968BC, 0x009968BD, 0x009968BF, 0x009968C1, 0x009968C3
@@ -23,8 +25,8 @@ extern const rct_track_coordinates FlatTrackCoordinates[TrackElemType::Count];
 extern const uint8_t TrackSequenceProperties[TrackElemType::Count][MaxSequencesPerPiece];
 extern const uint8_t FlatRideTrackSequenceProperties[TrackElemType::Count][MaxSequencesPerPiece];
 
-extern const rct_preview_track* TrackBlocks[TrackElemType::Count];
-extern const rct_preview_track* FlatRideTrackBlocks[TrackElemType::Count];
+extern const rct_preview_track* const TrackBlocks[TrackElemType::Count];
+extern const rct_preview_track* const FlatRideTrackBlocks[TrackElemType::Count];
 
 extern const uint8_t TrackPieceLengths[TrackElemType::Count];
 
@@ -74,3 +76,15 @@ extern const uint8_t FlatRideTrackSequenceElementAllowedWallEdges[256][16];
 
 extern const uint16_t FlatTrackFlags[256];
 extern const uint16_t TrackFlags[256];
+
+/**
+ * How strongly a piece swings the cars of swinging vehicles, as the shift applied to the velocity, positive to the left
+ * and negative to the right. Only the S-bends swing differently in the second half of the piece.
+ */
+struct track_swing_amount
+{
+    int8_t first_half;
+    int8_t second_half;
+};
+
+extern const std::array<track_swing_amount, TrackElemType::Count> TrackSwingAmounts;
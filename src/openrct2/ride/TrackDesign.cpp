@@ -10,9 +10,12 @@
 #include "TrackDesign.h"
 
 #include "../Cheats.h"
+#include "../Context.h"
 #include "../Game.h"
 #include "../OpenRCT2.h"
+#include "../PlatformEnvironment.h"
 #include "../TrackImporter.h"
+#include "../Version.h"
 #include "../actions/FootpathPlaceFromTrackAction.hpp"
 #include "../actions/FootpathRemoveAction.hpp"
 #include "../actions/LargeSceneryPlaceAction.hpp"
@@ -32,6 +35,8 @@
 #include "../audio/audio.h"
 #include "../core/DataSerialiser.h"
 #include "../core/File.h"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Localisation.h"
@@ -58,15 +63,21 @@
 #include "TrackDesignRepository.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <iterator>
 #include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+static constexpr uint32_t TRACK_PREVIEW_CACHE_MAGIC_NUMBER = 0x56505443; // CTPV
+static constexpr uint32_t TRACK_PREVIEW_CACHE_VERSION = 1;
+
 struct map_backup
 {
-    TileElement tile_elements[MAX_TILE_ELEMENTS];
+    // Moving the store does not move its elements, so the pointers into it stay valid
+    TileElementStore tile_elements;
     TileElement* tile_pointers[MAX_TILE_TILE_ELEMENT_POINTERS];
     TileElement* next_free_tile_element;
     uint16_t map_size_units;
@@ -94,6 +105,9 @@ static bool _trackDesignPlaceStateHasScenery = false;
 static bool _trackDesignPlaceStatePlaceScenery = true;
 static bool _trackDesignPlaceIsReplay = false;
 
+// Tile element store the previews are placed in, kept between previews so it is only allocated once
+static TileElementStore _trackPreviewTileElements;
+
 static std::unique_ptr<map_backup> track_design_preview_backup_map();
 
 static void track_design_preview_restore_map(map_backup* backup);
@@ -1510,8 +1524,7 @@ static int32_t track_design_place_maze(TrackDesign* td6, const CoordsXYZ& coords
 
 static bool track_design_place_ride(TrackDesign* td6, const CoordsXYZ& origin, Ride* ride)
 {
-    const rct_preview_track** trackBlockArray = (ride_type_has_flag(td6->type, RIDE_TYPE_FLAG_HAS_TRACK)) ? TrackBlocks
-                                                                                                          : FlatRideTrackBlocks;
+    auto trackBlockArray = (ride_type_has_flag(td6->type, RIDE_TYPE_FLAG_HAS_TRACK)) ? TrackBlocks : FlatRideTrackBlocks;
 
     _trackPreviewOrigin = origin;
     if (_trackDesignPlaceOperation == PTD_OPERATION_DRAW_OUTLINES)
@@ -1992,13 +2005,13 @@ static bool track_design_place_preview(TrackDesign* td6, money32* cost, Ride** o
  *
  *  rct2: 0x006D1EF0
  */
-void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
+bool track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
 {
     // Make a copy of the map
     auto mapBackup = track_design_preview_backup_map();
     if (mapBackup == nullptr)
     {
-        return;
+        return false;
     }
     track_design_preview_clear_map();
 
@@ -2014,7 +2027,7 @@ void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
     {
         std::fill_n(pixels, TRACK_PREVIEW_IMAGE_SIZE * 4, 0x00);
         track_design_preview_restore_map(mapBackup.get());
-        return;
+        return false;
     }
     td6->cost = cost;
     td6->track_flags = flags & 7;
@@ -2097,6 +2110,138 @@ void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
 
     ride->Delete();
     track_design_preview_restore_map(mapBackup.get());
+    return true;
+}
+
+/**
+ * The preview depends on the design, on which of its objects are available and on the code drawing it, so the cache
+ * file is named after a hash of all of these. A design that changes or gets new objects simply gets a new cache file.
+ */
+static std::string track_design_get_preview_cache_path(const std::string& path, const TrackDesign* td6)
+{
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325;
+    auto addToHash = [&hash](const void* data, size_t length) {
+        auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < length; i++)
+        {
+            hash = (hash ^ bytes[i]) * 0x100000001B3;
+        }
+    };
+
+    auto fileData = File::ReadAllBytes(path);
+    addToHash(fileData.data(), fileData.size());
+    addToHash(gVersionInfoFull, std::strlen(gVersionInfoFull));
+
+    // The track manager loads the objects of the design before drawing it, otherwise they have to be loaded already
+    const bool isTrackManager = (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) != 0;
+    auto isAvailable = [isTrackManager](const rct_object_entry* entry) -> uint8_t {
+        if (isTrackManager)
+        {
+            return object_repository_find_object_by_entry(entry) != nullptr;
+        }
+        ObjectType entryType;
+        ObjectEntryIndex entryIndex;
+        return find_object_in_entry_group(entry, &entryType, &entryIndex);
+    };
+    auto vehicleAvailable = isAvailable(&td6->vehicle_object);
+    addToHash(&vehicleAvailable, sizeof(vehicleAvailable));
+    for (const auto& scenery : td6->scenery_elements)
+    {
+        auto sceneryAvailable = isAvailable(&scenery.scenery_object);
+        addToHash(&sceneryAvailable, sizeof(sceneryAvailable));
+    }
+
+    const auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), "trackpreviews");
+    return Path::Combine(directory, String::StdFormat("%016" PRIx64 ".dat", hash));
+}
+
+static bool track_design_read_preview_cache(const std::string& cachePath, TrackDesign* td6, uint8_t* pixels)
+{
+    if (!File::Exists(cachePath))
+    {
+        return false;
+    }
+
+    try
+    {
+        auto data = File::ReadAllBytes(cachePath);
+        auto ms = MemoryStream(data.data(), data.size());
+        if (ms.ReadValue<uint32_t>() != TRACK_PREVIEW_CACHE_MAGIC_NUMBER
+            || ms.ReadValue<uint32_t>() != TRACK_PREVIEW_CACHE_VERSION)
+        {
+            return false;
+        }
+        auto cost = ms.ReadValue<money32>();
+        auto trackFlags = ms.ReadValue<uint8_t>();
+
+        size_t pixelsSize = 0;
+        auto compressed = static_cast<uint8_t*>(const_cast<void*>(ms.GetDataAtPosition()));
+        auto decompressed = std::unique_ptr<uint8_t, decltype(&std::free)>(
+            util_zlib_inflate(compressed, static_cast<size_t>(ms.GetLength() - ms.GetPosition()), &pixelsSize), &std::free);
+        if (decompressed == nullptr || pixelsSize != TRACK_PREVIEW_IMAGE_SIZE * 4)
+        {
+            return false;
+        }
+
+        std::copy_n(decompressed.get(), pixelsSize, pixels);
+        td6->cost = cost;
+        td6->track_flags = trackFlags;
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to read track design preview cache '%s': %s", cachePath.c_str(), e.what());
+        return false;
+    }
+}
+
+static void track_design_write_preview_cache(const std::string& cachePath, const TrackDesign* td6, const uint8_t* pixels)
+{
+    auto compressed = util_zlib_deflate(pixels, TRACK_PREVIEW_IMAGE_SIZE * 4);
+    if (!compressed)
+    {
+        return;
+    }
+
+    MemoryStream ms;
+    ms.WriteValue<uint32_t>(TRACK_PREVIEW_CACHE_MAGIC_NUMBER);
+    ms.WriteValue<uint32_t>(TRACK_PREVIEW_CACHE_VERSION);
+    ms.WriteValue<money32>(td6->cost);
+    ms.WriteValue<uint8_t>(td6->track_flags);
+    ms.Write(compressed->data(), compressed->size());
+
+    Path::CreateDirectory(Path::GetDirectory(cachePath));
+    auto data = static_cast<const uint8_t*>(ms.GetData());
+    File::WriteAllBytesAsync(cachePath, std::vector<uint8_t>(data, data + ms.GetLength()));
+}
+
+bool track_design_draw_preview(const std::string& path, TrackDesign* td6, uint8_t* pixels)
+{
+    std::string cachePath;
+    try
+    {
+        cachePath = track_design_get_preview_cache_path(path, td6);
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to find track design preview cache for '%s': %s", path.c_str(), e.what());
+        return track_design_draw_preview(td6, pixels);
+    }
+
+    if (track_design_read_preview_cache(cachePath, td6, pixels))
+    {
+        return true;
+    }
+
+    // Designs that fail to place are not cached so the problem shows again the next time
+    if (!track_design_draw_preview(td6, pixels))
+    {
+        return false;
+    }
+    track_design_write_preview_cache(cachePath, td6, pixels);
+    return true;
 }
 
 /**
@@ -2109,9 +2254,16 @@ static std::unique_ptr<map_backup> track_design_preview_backup_map()
     auto backup = std::make_unique<map_backup>();
     if (backup != nullptr)
     {
-        std::memcpy(backup->tile_elements, gTileElements, sizeof(backup->tile_elements));
         std::memcpy(backup->tile_pointers, gTileElementTilePointers, sizeof(backup->tile_pointers));
         backup->next_free_tile_element = gNextFreeTileElement;
+
+        // The map's store is set aside rather than copied, the preview is placed in a store of its own
+        backup->tile_elements = std::move(gTileElements);
+        gTileElements = std::move(_trackPreviewTileElements);
+        if (gTileElements.size() < MAX_TILE_TILE_ELEMENT_POINTERS)
+        {
+            map_reset_tile_element_store(MAX_TILE_TILE_ELEMENT_POINTERS);
+        }
         backup->map_size_units = gMapSizeUnits;
         backup->map_size_units_minus_2 = gMapSizeMinus2;
         backup->map_size = gMapSize;
@@ -2126,9 +2278,11 @@ static std::unique_ptr<map_backup> track_design_preview_backup_map()
  */
 static void track_design_preview_restore_map(map_backup* backup)
 {
-    std::memcpy(gTileElements, backup->tile_elements, sizeof(backup->tile_elements));
+    _trackPreviewTileElements = std::move(gTileElements);
+    gTileElements = std::move(backup->tile_elements);
     std::memcpy(gTileElementTilePointers, backup->tile_pointers, sizeof(backup->tile_pointers));
     gNextFreeTileElement = backup->next_free_tile_element;
+    map_reset_tile_element_blocks();
     gMapSizeUnits = backup->map_size_units;
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
@@ -211,7 +211,13 @@ int32_t place_virtual_track(TrackDesign* td6, uint8_t ptdOperation, bool placeSc
 ///////////////////////////////////////////////////////////////////////////////
 // Track design preview
 ///////////////////////////////////////////////////////////////////////////////
-void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels);
+bool track_design_draw_preview(TrackDesign* td6, uint8_t* pixels);
+
+/**
+ * Same as above for the design read from path, reusing a preview drawn earlier when the design and the availability of
+ * its objects have not changed since.
+ */
+bool track_design_draw_preview(const std::string& path, TrackDesign* td6, uint8_t* pixels);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Track design saving
@@ -27,6 +27,9 @@
 #include "TrackData.h"
 #include "TrackDesign.h"
 
+#include <array>
+#include <memory>
+
 // clang-format off
 /* rct2: 0x007667AC */
 static constexpr TileCoordsXY EntranceOffsetEdgeNE[] = {
@@ -2135,6 +2138,31 @@ void track_paint_util_left_corkscrew_up_supports(paint_session* session, Directi
  *
  *  rct2: 0x006C4794
  */
+using TrackPaintFunctionTable = std::array<std::array<TRACK_PAINT_FUNCTION, TrackElemType::Count>, RIDE_TYPE_COUNT>;
+
+/**
+ * The paint function of every ride and track type, so painting an element is a table lookup rather than a call
+ * through the switch of the ride type's function getter. The getters only depend on the track type, so the table
+ * is filled once on first use.
+ */
+static const TrackPaintFunctionTable& GetTrackPaintFunctions()
+{
+    static const auto table = []() {
+        auto result = std::make_unique<TrackPaintFunctionTable>();
+        for (size_t rideType = 0; rideType < RIDE_TYPE_COUNT; rideType++)
+        {
+            auto& functions = (*result)[rideType];
+            TRACK_PAINT_FUNCTION_GETTER paintFunctionGetter = RideTypeDescriptors[rideType].TrackPaintFunction;
+            for (int32_t trackType = 0; trackType < TrackElemType::Count; trackType++)
+            {
+                functions[trackType] = paintFunctionGetter != nullptr ? paintFunctionGetter(trackType) : nullptr;
+            }
+        }
+        return result;
+    }();
+    return *table;
+}
+
 void track_paint(paint_session* session, Direction direction, int32_t height, const TileElement* tileElement)
 {
     ride_id_t rideIndex = tileElement->AsTrack()->GetRideIndex();
@@ -2190,18 +2218,14 @@ void track_paint(paint_session* session, Direction direction, int32_t height, co
             session->TrackColours[SCHEME_3] = ghost_id;
         }
 
-        if (ride->type >= RIDE_TYPE_COUNT)
+        if (ride->type >= RIDE_TYPE_COUNT || trackType >= TrackElemType::Count)
         {
             return;
         }
-        TRACK_PAINT_FUNCTION_GETTER paintFunctionGetter = RideTypeDescriptors[ride->type].TrackPaintFunction;
-        if (paintFunctionGetter != nullptr)
+        TRACK_PAINT_FUNCTION paintFunction = GetTrackPaintFunctions()[ride->type][trackType];
+        if (paintFunction != nullptr)
         {
-            TRACK_PAINT_FUNCTION paintFunction = paintFunctionGetter(trackType);
-            if (paintFunction != nullptr)
-            {
-                paintFunction(session, rideIndex, trackSequence, direction, height, tileElement);
-            }
+            paintFunction(session, rideIndex, trackSequence, direction, height, tileElement);
         }
     }
 }
@@ -781,7 +781,7 @@ static bool vehicle_move_info_valid(VehicleTrackSubposition trackSubposition, in
     {
         return false;
     }
-    if (offset >= gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->size)
+    if (offset >= gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection].size)
     {
         return false;
     }
@@ -796,7 +796,7 @@ static const rct_vehicle_info* vehicle_get_move_info(
         static constexpr const rct_vehicle_info zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->info[offset];
+    return &gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection].info[offset];
 }
 
 const rct_vehicle_info* Vehicle::GetMoveInfo() const
@@ -810,7 +810,7 @@ static uint16_t vehicle_get_move_info_size(VehicleTrackSubposition trackSubposit
     {
         return 0;
     }
-    return gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->size;
+    return gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection].size;
 }
 
 uint16_t Vehicle::GetTrackProgress() const
@@ -1099,6 +1099,62 @@ static void vehicle_sounds_update_window_setup()
         OpenRCT2::Audio::gVolumeAdjustZoom = 70;
 }
 
+/**
+ * Returns the map area containing every vehicle that can pass Vehicle::SoundCanPlay for the listening viewport, or
+ * nothing if going through the train list is cheaper than going through the tiles of that area.
+ */
+static std::optional<MapRange> vehicle_sounds_update_get_audible_range()
+{
+    const auto* viewport = g_music_tracking_viewport;
+    if (viewport == nullptr)
+        return std::nullopt;
+
+    // Same area as SoundCanPlay, widened by the largest distance between a vehicle's position and its sprite bounds
+    constexpr int32_t spriteMargin = 128;
+    int32_t left = viewport->viewPos.x - spriteMargin;
+    int32_t top = viewport->viewPos.y - spriteMargin;
+    int32_t right = viewport->viewPos.x + viewport->view_width + spriteMargin;
+    int32_t bottom = viewport->viewPos.y + viewport->view_height + spriteMargin;
+    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
+    {
+        left -= viewport->view_width / 4;
+        top -= viewport->view_height / 4;
+        right += viewport->view_width / 4;
+        bottom += viewport->view_height / 4;
+    }
+
+    // Map positions of the screen corners at the lowest and highest possible vehicle height
+    constexpr int32_t maxVehicleZ = 255 * COORDS_Z_STEP;
+    const ScreenCoordsXY corners[] = { { left, top }, { right, top }, { left, bottom }, { right, bottom } };
+    int32_t minX = std::numeric_limits<int32_t>::max();
+    int32_t minY = std::numeric_limits<int32_t>::max();
+    int32_t maxX = std::numeric_limits<int32_t>::min();
+    int32_t maxY = std::numeric_limits<int32_t>::min();
+    for (const auto& corner : corners)
+    {
+        for (auto z : { 0, maxVehicleZ })
+        {
+            auto mapPos = viewport_coord_to_map_coord(corner, z);
+            minX = std::min(minX, mapPos.x);
+            minY = std::min(minY, mapPos.y);
+            maxX = std::max(maxX, mapPos.x);
+            maxY = std::max(maxY, mapPos.y);
+        }
+    }
+    minX = std::max(minX, 0);
+    minY = std::max(minY, 0);
+    maxX = std::min<int32_t>(maxX, gMapSizeMaxXY);
+    maxY = std::min<int32_t>(maxY, gMapSizeMaxXY);
+    if (minX > maxX || minY > maxY)
+        return MapRange(0, 0, -1, -1);
+
+    auto numTiles = static_cast<size_t>((maxX - minX) / COORDS_XY_STEP + 1) * ((maxY - minY) / COORDS_XY_STEP + 1);
+    if (numTiles >= GetEntityListCount(EntityListId::TrainHead))
+        return std::nullopt;
+
+    return MapRange(floor2(minX, COORDS_XY_STEP), floor2(minY, COORDS_XY_STEP), maxX, maxY);
+}
+
 static uint8_t vehicle_sounds_update_get_pan_volume(OpenRCT2::Audio::VehicleSoundParams* sound_params)
 {
     uint8_t vol1 = 0xFF;
@@ -1274,14 +1330,38 @@ void vehicle_sounds_update()
     if (!OpenRCT2::Audio::IsAvailable())
         return;
 
-    std::vector<OpenRCT2::Audio::VehicleSoundParams> vehicleSoundParamsList;
+    // Kept between calls so the list is not allocated every tick
+    static std::vector<OpenRCT2::Audio::VehicleSoundParams> vehicleSoundParamsList;
+    vehicleSoundParamsList.clear();
     vehicleSoundParamsList.reserve(OpenRCT2::Audio::MaxVehicleSounds);
 
     vehicle_sounds_update_window_setup();
 
-    for (auto vehicle : EntityList<Vehicle>(EntityListId::TrainHead))
+    // On large parks most trains are far from the listening viewport, so only look at the tiles near it when the
+    // viewport covers fewer tiles than there are trains
+    auto audibleRange = vehicle_sounds_update_get_audible_range();
+    if (audibleRange)
     {
-        vehicle->UpdateSoundParams(vehicleSoundParamsList);
+        for (int32_t y = audibleRange->GetTop(); y <= audibleRange->GetBottom(); y += COORDS_XY_STEP)
+        {
+            for (int32_t x = audibleRange->GetLeft(); x <= audibleRange->GetRight(); x += COORDS_XY_STEP)
+            {
+                for (auto vehicle : EntityTileList<Vehicle>({ x, y }))
+                {
+                    if (vehicle->IsHead())
+                    {
+                        vehicle->UpdateSoundParams(vehicleSoundParamsList);
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for (auto vehicle : EntityList<Vehicle>(EntityListId::TrainHead))
+        {
+            vehicle->UpdateSoundParams(vehicleSoundParamsList);
+        }
     }
 
     // Stop all playing sounds that no longer have priority to play after vehicle_update_sound_params
@@ -1290,7 +1370,7 @@ void vehicle_sounds_update()
         if (vehicle_sound.id != OpenRCT2::Audio::SoundIdNull)
         {
             bool keepPlaying = false;
-            for (auto vehicleSoundParams : vehicleSoundParamsList)
+            for (const auto& vehicleSoundParams : vehicleSoundParamsList)
             {
                 if (vehicle_sound.id == vehicleSoundParams.id)
                 {
@@ -1544,6 +1624,7 @@ void Vehicle::UpdateMeasurements()
     if (status == Vehicle::Status::TravellingBoat)
     {
         curRide->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+        curRide->lifecycle_flags |= RIDE_LIFECYCLE_RATINGS_PENDING;
         curRide->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
         curRide->lifecycle_flags &= ~RIDE_LIFECYCLE_TEST_IN_PROGRESS;
         ClearUpdateFlag(VEHICLE_UPDATE_FLAG_TESTING);
@@ -3025,6 +3106,7 @@ static void test_finish(Ride& ride)
 {
     ride.lifecycle_flags &= ~RIDE_LIFECYCLE_TEST_IN_PROGRESS;
     ride.lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride.lifecycle_flags |= RIDE_LIFECYCLE_RATINGS_PENDING;
 
     for (int32_t i = ride.num_stations - 1; i >= 1; i--)
     {
@@ -3163,6 +3245,7 @@ void Vehicle::UpdateDepartingBoatHire()
     if (curRide == nullptr)
         return;
 
+    curRide->Wake();
     curRide->stations[current_station].Depart &= STATION_DEPART_FLAG;
     uint8_t waitingTime = std::max(curRide->min_waiting_time, static_cast<uint8_t>(3));
     waitingTime = std::min(waitingTime, static_cast<uint8_t>(127));
@@ -3442,6 +3525,7 @@ void Vehicle::FinishDeparting()
 
     if (curRide->mode != RideMode::Race && !curRide->IsBlockSectioned())
     {
+        curRide->Wake();
         curRide->stations[current_station].Depart &= STATION_DEPART_FLAG;
         uint8_t waitingTime = 3;
         if (curRide->depart_flags & RIDE_DEPART_WAIT_FOR_MINIMUM_LENGTH)
@@ -4277,6 +4361,7 @@ void Vehicle::UpdateTravellingCableLift()
         return;
 
     // This is slightly different to the vanilla function
+    curRide->Wake();
     curRide->stations[current_station].Depart &= STATION_DEPART_FLAG;
     uint8_t waitingTime = 3;
     if (curRide->depart_flags & RIDE_DEPART_WAIT_FOR_MINIMUM_LENGTH)
@@ -6801,122 +6886,8 @@ static void block_brakes_open_previous_section(Ride& ride, const CoordsXYZ& vehi
 
 int32_t Vehicle::GetSwingAmount() const
 {
-    int32_t trackType = GetTrackType();
-    switch (trackType)
-    {
-        case TrackElemType::LeftQuarterTurn5Tiles:
-        case TrackElemType::BankedLeftQuarterTurn5Tiles:
-        case TrackElemType::LeftQuarterTurn5TilesUp25:
-        case TrackElemType::LeftQuarterTurn5TilesDown25:
-        case TrackElemType::LeftQuarterTurn5TilesCovered:
-        case TrackElemType::LeftHalfBankedHelixUpLarge:
-        case TrackElemType::LeftHalfBankedHelixDownLarge:
-        case TrackElemType::LeftQuarterBankedHelixLargeUp:
-        case TrackElemType::LeftQuarterBankedHelixLargeDown:
-        case TrackElemType::LeftQuarterHelixLargeUp:
-        case TrackElemType::LeftQuarterHelixLargeDown:
-        case TrackElemType::LeftBankedQuarterTurn5TileUp25:
-        case TrackElemType::LeftBankedQuarterTurn5TileDown25:
-            // loc_6D67E1
-            return 14;
-
-        case TrackElemType::RightQuarterTurn5Tiles:
-        case TrackElemType::BankedRightQuarterTurn5Tiles:
-        case TrackElemType::RightQuarterTurn5TilesUp25:
-        case TrackElemType::RightQuarterTurn5TilesDown25:
-        case TrackElemType::RightQuarterTurn5TilesCovered:
-        case TrackElemType::RightHalfBankedHelixUpLarge:
-        case TrackElemType::RightHalfBankedHelixDownLarge:
-        case TrackElemType::RightQuarterBankedHelixLargeUp:
-        case TrackElemType::RightQuarterBankedHelixLargeDown:
-        case TrackElemType::RightQuarterHelixLargeUp:
-        case TrackElemType::RightQuarterHelixLargeDown:
-        case TrackElemType::RightBankedQuarterTurn5TileUp25:
-        case TrackElemType::RightBankedQuarterTurn5TileDown25:
-            // loc_6D6804
-            return -14;
-
-        case TrackElemType::SBendLeft:
-        case TrackElemType::SBendLeftCovered:
-            // loc_6D67EF
-            if (track_progress < 48)
-            {
-                return 14;
-            }
-            else
-            {
-                return -15;
-            }
-
-        case TrackElemType::SBendRight:
-        case TrackElemType::SBendRightCovered:
-            // loc_6D67CC
-            if (track_progress < 48)
-            {
-                return -14;
-            }
-            else
-            {
-                return 15;
-            }
-
-        case TrackElemType::LeftQuarterTurn3Tiles:
-        case TrackElemType::LeftBankedQuarterTurn3Tiles:
-        case TrackElemType::LeftQuarterTurn3TilesUp25:
-        case TrackElemType::LeftQuarterTurn3TilesDown25:
-        case TrackElemType::LeftQuarterTurn3TilesCovered:
-        case TrackElemType::LeftHalfBankedHelixUpSmall:
-        case TrackElemType::LeftHalfBankedHelixDownSmall:
-        case TrackElemType::LeftBankToLeftQuarterTurn3TilesUp25:
-        case TrackElemType::LeftQuarterTurn3TilesDown25ToLeftBank:
-        case TrackElemType::LeftCurvedLiftHill:
-        case TrackElemType::LeftBankedQuarterTurn3TileUp25:
-        case TrackElemType::LeftBankedQuarterTurn3TileDown25:
-            // loc_6D67BE
-            return 13;
-
-        case TrackElemType::RightQuarterTurn3Tiles:
-        case TrackElemType::RightBankedQuarterTurn3Tiles:
-        case TrackElemType::RightQuarterTurn3TilesUp25:
-        case TrackElemType::RightQuarterTurn3TilesDown25:
-        case TrackElemType::RightQuarterTurn3TilesCovered:
-        case TrackElemType::RightHalfBankedHelixUpSmall:
-        case TrackElemType::RightHalfBankedHelixDownSmall:
-        case TrackElemType::RightBankToRightQuarterTurn3TilesUp25:
-        case TrackElemType::RightQuarterTurn3TilesDown25ToRightBank:
-        case TrackElemType::RightCurvedLiftHill:
-        case TrackElemType::RightBankedQuarterTurn3TileUp25:
-        case TrackElemType::RightBankedQuarterTurn3TileDown25:
-            // loc_6D67B0
-            return -13;
-
-        case TrackElemType::LeftQuarterTurn1Tile:
-        case TrackElemType::LeftQuarterTurn1TileUp60:
-        case TrackElemType::LeftQuarterTurn1TileDown60:
-            // loc_6D67A2
-            return 12;
-
-        case TrackElemType::RightQuarterTurn1Tile:
-        case TrackElemType::RightQuarterTurn1TileUp60:
-        case TrackElemType::RightQuarterTurn1TileDown60:
-            // loc_6D6794
-            return -12;
-
-        case TrackElemType::LeftEighthToDiag:
-        case TrackElemType::LeftEighthToOrthogonal:
-        case TrackElemType::LeftEighthBankToDiag:
-        case TrackElemType::LeftEighthBankToOrthogonal:
-            // loc_6D67D3
-            return 15;
-
-        case TrackElemType::RightEighthToDiag:
-        case TrackElemType::RightEighthToOrthogonal:
-        case TrackElemType::RightEighthBankToDiag:
-        case TrackElemType::RightEighthBankToOrthogonal:
-            // loc_6D67F6
-            return -15;
-    }
-    return 0;
+    const auto& swing = TrackSwingAmounts[GetTrackType()];
+    return track_progress < 48 ? swing.first_half : swing.second_half;
 }
 
 /**
@@ -34,6 +34,19 @@ struct VehicleColour
     uint8_t Ternary;
 };
 
+/**
+ * How a car of a vehicle entry is drawn at a pitch and bank rotation, see vehicle_sprite_build_lookup.
+ */
+struct VehicleSpriteLookup
+{
+    uint32_t ImageId;
+    uint8_t ImageDirectionShift;
+    uint8_t BoundBox;
+    uint8_t BoundBoxDirectionShift;
+    uint8_t BoundBoxDirectionXor;
+    uint8_t Flags;
+};
+
 #ifdef __TESTPAINT__
 #    pragma pack(push, 1)
 #endif // __TESTPAINT__
@@ -97,6 +110,7 @@ struct rct_ride_entry_vehicle
     uint8_t pad_62[6] = {};                 // 0x62 , 0x7B
     std::vector<std::array<CoordsXY, 3>> peep_loading_waypoints = {};
     std::vector<int8_t> peep_loading_positions = {}; // previously 0x61 , 0x7B
+    std::vector<VehicleSpriteLookup> sprite_lookup = {};
 };
 #ifdef __TESTPAINT__
 #    pragma pack(pop)
@@ -953,17 +953,51 @@ static void vehicle_sprite_paint(
     vehicle_visual_splash_effect(session, z, vehicle, vehicleEntry);
 }
 
+/**
+ * The pitch, bank and image direction of a car resolved to the image and bounding box of the sprite group that draws
+ * it. The state of the car that changes every frame (swinging, spinning, animation and restraints) is added when the
+ * car is painted, so a resolution only depends on the vehicle entry and can be looked up from a table.
+ */
+struct VehicleSpriteQuery
+{
+    uint8_t Pitch{};
+    uint8_t BankRotation{};
+    bool UseInvertedSprites{};
+    track_type_t TrackType{};
+    bool TrackTypeUsed{};
+
+    int32_t Resolutions{};
+    const rct_ride_entry_vehicle* Entry{};
+    int32_t ImageId{};
+    int32_t BoundBox{};
+    bool CanUseRestraints{};
+
+    track_type_t GetTrackType()
+    {
+        TrackTypeUsed = true;
+        return TrackType;
+    }
+
+    void Resolve(const rct_ride_entry_vehicle* entry, int32_t imageId, int32_t boundBox, bool canUseRestraints)
+    {
+        Resolutions++;
+        Entry = entry;
+        ImageId = imageId;
+        BoundBox = boundBox;
+        CanUseRestraints = canUseRestraints;
+    }
+};
+
 // 6D520E
 static void vehicle_sprite_paint_6D520E(
-    paint_session* session, const Vehicle* vehicle, int32_t ebx, int32_t ecx, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+    VehicleSpriteQuery& query, int32_t ebx, int32_t ecx, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    vehicle_sprite_paint(session, vehicle, ebx + vehicle->SwingSprite, ecx, z, vehicleEntry);
+    query.Resolve(vehicleEntry, ebx, ecx, false);
 }
 
 // 6D51EB
 static void vehicle_sprite_paint_6D51EB(
-    paint_session* session, const Vehicle* vehicle, int32_t ebx, int32_t z, const rct_ride_entry_vehicle* vehicleEntry)
+    VehicleSpriteQuery& query, int32_t ebx, const rct_ride_entry_vehicle* vehicleEntry, bool canUseRestraints)
 {
     int32_t ecx = ebx / 2;
     if (vehicleEntry->flags & VEHICLE_ENTRY_FLAG_11)
@@ -974,119 +1008,89 @@ static void vehicle_sprite_paint_6D51EB(
     {
         ebx = ebx / 8;
     }
-    ebx = (ebx * vehicleEntry->base_num_frames) + vehicle->SwingSprite + vehicleEntry->base_image_id;
-    vehicle_sprite_paint(session, vehicle, ebx, ecx, z, vehicleEntry);
+    ebx = (ebx * vehicleEntry->base_num_frames) + vehicleEntry->base_image_id;
+    query.Resolve(vehicleEntry, ebx, ecx, canUseRestraints);
 }
 
 // 6D51DE
 static void vehicle_sprite_paint_6D51DE(
-    paint_session* session, const Vehicle* vehicle, int32_t ebx, int32_t z, const rct_ride_entry_vehicle* vehicleEntry)
+    VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->restraints_position < 64)
-    {
-        vehicle_sprite_paint_6D51EB(session, vehicle, ebx, z, vehicleEntry);
-        return;
-    }
-    if (!(vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_RESTRAINT_ANIMATION))
-    {
-        vehicle_sprite_paint_6D51EB(session, vehicle, ebx, z, vehicleEntry);
-        return;
-    }
-    if (ebx & 7)
-    {
-        vehicle_sprite_paint_6D51EB(session, vehicle, ebx, z, vehicleEntry);
-        return;
-    }
-    int32_t ecx = ebx / 2;
-    ebx = ebx / 8;
-    ebx += ((vehicle->restraints_position - 64) / 64) * 4;
-    ebx *= vehicleEntry->base_num_frames;
-    ebx += vehicleEntry->restraint_image_id;
-    vehicle_sprite_paint(session, vehicle, ebx, ecx, z, vehicleEntry);
+    // Whether the restraints are open is only known when painting, see vehicle_sprite_paint_resolved
+    bool canUseRestraints = (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_RESTRAINT_ANIMATION) && !(imageDirection & 7);
+    vehicle_sprite_paint_6D51EB(query, imageDirection, vehicleEntry, canUseRestraints);
 }
 
 // 6D51DE
-static void vehicle_sprite_0_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+    vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
 }
 
 // 6D4EE7
-static void vehicle_sprite_0_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection / 4) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4F34
-static void vehicle_sprite_0_2(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_2(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = (imageDirection / 2) + 108;
         int32_t ebx = ((imageDirection + 16) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4F0C
-static void vehicle_sprite_0_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 4) + 8) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4F5C
-static void vehicle_sprite_0_4(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_4(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = ((imageDirection / 2) ^ 8) + 108;
         int32_t ebx = ((imageDirection + 48) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4F84
-static void vehicle_sprite_0_5(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_5(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1094,20 +1098,18 @@ static void vehicle_sprite_0_5(
     {
         int32_t ecx = (imageDirection / 8) + 124;
         int32_t ebx = ((imageDirection / 8) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_2(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4FE4
-static void vehicle_sprite_0_6(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_6(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1115,20 +1117,18 @@ static void vehicle_sprite_0_6(
     {
         int32_t ecx = (imageDirection / 8) + 128;
         int32_t ebx = (((imageDirection / 8) + 8) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_2(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D5055
-static void vehicle_sprite_0_7(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_7(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1136,20 +1136,18 @@ static void vehicle_sprite_0_7(
     {
         int32_t ecx = (imageDirection / 8) + 132;
         int32_t ebx = (((imageDirection / 8) + 16) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_2(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D50C6
-static void vehicle_sprite_0_8(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_8(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1157,20 +1155,18 @@ static void vehicle_sprite_0_8(
     {
         int32_t ecx = (imageDirection / 8) + 136;
         int32_t ebx = (((imageDirection / 8) + 24) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_2(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D5137
-static void vehicle_sprite_0_9(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_9(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1178,20 +1174,18 @@ static void vehicle_sprite_0_9(
     {
         int32_t ecx = (imageDirection / 8) + 140;
         int32_t ebx = (((imageDirection / 8) + 32) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_2(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4FB1
-static void vehicle_sprite_0_10(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_10(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1199,20 +1193,18 @@ static void vehicle_sprite_0_10(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 124;
         int32_t ebx = (((imageDirection / 8) + 4) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D501B
-static void vehicle_sprite_0_11(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_11(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1220,20 +1212,18 @@ static void vehicle_sprite_0_11(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 128;
         int32_t ebx = (((imageDirection / 8) + 12) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D508C
-static void vehicle_sprite_0_12(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_12(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1241,20 +1231,18 @@ static void vehicle_sprite_0_12(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 132;
         int32_t ebx = (((imageDirection / 8) + 20) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D50FD
-static void vehicle_sprite_0_13(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_13(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1262,20 +1250,18 @@ static void vehicle_sprite_0_13(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 136;
         int32_t ebx = (((imageDirection / 8) + 28) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D516E
-static void vehicle_sprite_0_14(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_14(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -1283,318 +1269,294 @@ static void vehicle_sprite_0_14(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 140;
         int32_t ebx = (((imageDirection / 8) + 36) * vehicleEntry->base_num_frames) + vehicleEntry->inline_twist_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0_2(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4EE4
-static void vehicle_sprite_0_16(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_16(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     vehicleEntry--;
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection / 4) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4F31
-static void vehicle_sprite_0_17(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_17(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     vehicleEntry--;
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = (imageDirection / 2) + 108;
         int32_t ebx = ((imageDirection + 16) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4F09
-static void vehicle_sprite_0_18(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_18(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     vehicleEntry--;
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 4) + 8) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4F59
-static void vehicle_sprite_0_19(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0_19(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     vehicleEntry--;
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_BANKED)
     {
         int32_t ecx = ((imageDirection / 2) ^ 8) + 108;
         int32_t ebx = ((imageDirection + 48) * vehicleEntry->base_num_frames) + vehicleEntry->banked_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D51D7
-static void vehicle_sprite_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3DE4:
-    switch (vehicle->bank_rotation)
+    switch (query.BankRotation)
     {
         case 0:
-            vehicle_sprite_0_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_0(query, imageDirection, vehicleEntry);
             break;
         case 1:
-            vehicle_sprite_0_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_1(query, imageDirection, vehicleEntry);
             break;
         case 2:
-            vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_2(query, imageDirection, vehicleEntry);
             break;
         case 3:
-            vehicle_sprite_0_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_3(query, imageDirection, vehicleEntry);
             break;
         case 4:
-            vehicle_sprite_0_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_4(query, imageDirection, vehicleEntry);
             break;
         case 5:
-            vehicle_sprite_0_5(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_5(query, imageDirection, vehicleEntry);
             break;
         case 6:
-            vehicle_sprite_0_6(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_6(query, imageDirection, vehicleEntry);
             break;
         case 7:
-            vehicle_sprite_0_7(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_7(query, imageDirection, vehicleEntry);
             break;
         case 8:
-            vehicle_sprite_0_8(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_8(query, imageDirection, vehicleEntry);
             break;
         case 9:
-            vehicle_sprite_0_9(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_9(query, imageDirection, vehicleEntry);
             break;
         case 10:
-            vehicle_sprite_0_10(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_10(query, imageDirection, vehicleEntry);
             break;
         case 11:
-            vehicle_sprite_0_11(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_11(query, imageDirection, vehicleEntry);
             break;
         case 12:
-            vehicle_sprite_0_12(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_12(query, imageDirection, vehicleEntry);
             break;
         case 13:
-            vehicle_sprite_0_13(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_13(query, imageDirection, vehicleEntry);
             break;
         case 14:
-            vehicle_sprite_0_14(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_14(query, imageDirection, vehicleEntry);
             break;
         case 15:
-            vehicle_sprite_0_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_0(query, imageDirection, vehicleEntry);
             break;
         case 16:
-            vehicle_sprite_0_16(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_16(query, imageDirection, vehicleEntry);
             break;
         case 17:
-            vehicle_sprite_0_17(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_17(query, imageDirection, vehicleEntry);
             break;
         case 18:
-            vehicle_sprite_0_18(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_18(query, imageDirection, vehicleEntry);
             break;
         case 19:
-            vehicle_sprite_0_19(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_0_19(query, imageDirection, vehicleEntry);
             break;
     }
 }
 
 // 6D4614
-static void vehicle_sprite_1_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_1_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPES)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection / 8) * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4662
-static void vehicle_sprite_1_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_1_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (imageDirection * vehicleEntry->base_num_frames) + vehicleEntry->flat_to_gentle_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D46DB
-static void vehicle_sprite_1_2(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_1_2(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_WHILE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection / 8) * vehicleEntry->base_num_frames) + vehicleEntry->flat_bank_to_gentle_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_1_1(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_1_1(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D467D
-static void vehicle_sprite_1_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_1_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection + 32) * vehicleEntry->base_num_frames) + vehicleEntry->flat_to_gentle_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D46FD
-static void vehicle_sprite_1_4(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_1_4(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_WHILE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 4) * vehicleEntry->base_num_frames)
             + vehicleEntry->flat_bank_to_gentle_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_1_3(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_1_3(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D460D
-static void vehicle_sprite_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3C04:
-    switch (vehicle->bank_rotation)
+    switch (query.BankRotation)
     {
         case 0:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 1:
-            vehicle_sprite_1_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_1(query, imageDirection, vehicleEntry);
             break;
         case 2:
-            vehicle_sprite_1_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_2(query, imageDirection, vehicleEntry);
             break;
         case 3:
-            vehicle_sprite_1_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_3(query, imageDirection, vehicleEntry);
             break;
         case 4:
-            vehicle_sprite_1_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_4(query, imageDirection, vehicleEntry);
             break;
         case 5:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 6:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 7:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 8:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 9:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 10:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 11:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 12:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 13:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 14:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 15:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_0(query, imageDirection, vehicleEntry);
             break;
         case 16:
-            vehicle_sprite_1_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_1(query, imageDirection, vehicleEntry);
             break;
         case 17:
-            vehicle_sprite_1_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_2(query, imageDirection, vehicleEntry);
             break;
         case 18:
-            vehicle_sprite_1_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_3(query, imageDirection, vehicleEntry);
             break;
         case 19:
-            vehicle_sprite_1_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_1_4(query, imageDirection, vehicleEntry);
             break;
     }
 }
 
 // 6D4791
-static void vehicle_sprite_2_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_2_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPES)
     {
@@ -1602,42 +1564,38 @@ static void vehicle_sprite_2_0(
         {
             int32_t ecx = (imageDirection / 2) + 16;
             int32_t ebx = (((imageDirection / 8) + 8) * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
         else
         {
             int32_t ecx = (imageDirection / 2) + 16;
             int32_t ebx = ((imageDirection + 8) * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4833
-static void vehicle_sprite_2_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_2_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = (imageDirection / 2) + 16;
         int32_t ebx = ((imageDirection / 8) * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_to_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D48D6
-static void vehicle_sprite_2_2(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_2_2(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TURNS)
     {
@@ -1646,43 +1604,39 @@ static void vehicle_sprite_2_2(
         {
             ecx += 108;
             int32_t ebx = (imageDirection * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
         else
         {
             ecx += 16;
             int32_t ebx = (imageDirection * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
     }
     else
     {
-        vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4858
-static void vehicle_sprite_2_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_2_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = (imageDirection / 2) + 16;
         int32_t ebx = (((imageDirection / 8) + 4) * vehicleEntry->base_num_frames)
             + vehicleEntry->gentle_slope_to_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4910
-static void vehicle_sprite_2_4(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_2_4(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TURNS)
     {
@@ -1692,289 +1646,269 @@ static void vehicle_sprite_2_4(
             ecx = (ecx ^ 8) + 108;
             int32_t ebx = ((imageDirection + 32) * vehicleEntry->base_num_frames)
                 + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
         else
         {
             ecx += 16;
             int32_t ebx = ((imageDirection + 32) * vehicleEntry->base_num_frames)
                 + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
     }
     else
     {
-        vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D476C
-static void vehicle_sprite_2(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_2(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3CA4:
-    switch (vehicle->bank_rotation)
+    switch (query.BankRotation)
     {
         case 0:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 1:
-            vehicle_sprite_2_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_1(query, imageDirection, vehicleEntry);
             break;
         case 2:
-            vehicle_sprite_2_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_2(query, imageDirection, vehicleEntry);
             break;
         case 3:
-            vehicle_sprite_2_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_3(query, imageDirection, vehicleEntry);
             break;
         case 4:
-            vehicle_sprite_2_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_4(query, imageDirection, vehicleEntry);
             break;
         case 5:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 6:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 7:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 8:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 9:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 10:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 11:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 12:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 13:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 14:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 15:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_0(query, imageDirection, vehicleEntry);
             break;
         case 16:
-            vehicle_sprite_2_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_1(query, imageDirection, vehicleEntry);
             break;
         case 17:
-            vehicle_sprite_2_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_2(query, imageDirection, vehicleEntry);
             break;
         case 18:
-            vehicle_sprite_2_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_3(query, imageDirection, vehicleEntry);
             break;
         case 19:
-            vehicle_sprite_2_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_2_4(query, imageDirection, vehicleEntry);
             break;
     }
 }
 
 // 6D49DC
-static void vehicle_sprite_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (!(vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_STEEP_SLOPES))
     {
-        vehicle_sprite_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_2(query, imageDirection, vehicleEntry);
     }
     else
     {
         int32_t ecx = (imageDirection / 4) + 32;
         int32_t ebx = ((imageDirection / 4) * vehicleEntry->base_num_frames) + vehicleEntry->steep_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
 }
 
 // 6D4A31
-static void vehicle_sprite_4(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_4(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (!(vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_STEEP_SLOPES))
     {
-        vehicle_sprite_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_2(query, imageDirection, vehicleEntry);
     }
     else
     {
         int32_t ecx = (imageDirection / 2) + 40;
         int32_t ebx = ((imageDirection + 16) * vehicleEntry->base_num_frames) + vehicleEntry->steep_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
 }
 
 // 6D463D
-static void vehicle_sprite_5_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_5_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPES)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 4) * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D469B
-static void vehicle_sprite_5_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_5_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection + 64) * vehicleEntry->base_num_frames) + vehicleEntry->flat_to_gentle_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4722
-static void vehicle_sprite_5_2(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_5_2(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_WHILE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 8) * vehicleEntry->base_num_frames)
             + vehicleEntry->flat_bank_to_gentle_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_5_1(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_5_1(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D46B9
-static void vehicle_sprite_5_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_5_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection + 96) * vehicleEntry->base_num_frames) + vehicleEntry->flat_to_gentle_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4747
-static void vehicle_sprite_5_4(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_5_4(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_FLAT_TO_GENTLE_SLOPE_WHILE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 12) * vehicleEntry->base_num_frames)
             + vehicleEntry->flat_bank_to_gentle_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_5_3(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_5_3(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4636
-static void vehicle_sprite_5(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_5(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3C54:
-    switch (vehicle->bank_rotation)
+    switch (query.BankRotation)
     {
         case 0:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 1:
-            vehicle_sprite_5_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_1(query, imageDirection, vehicleEntry);
             break;
         case 2:
-            vehicle_sprite_5_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_2(query, imageDirection, vehicleEntry);
             break;
         case 3:
-            vehicle_sprite_5_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_3(query, imageDirection, vehicleEntry);
             break;
         case 4:
-            vehicle_sprite_5_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_4(query, imageDirection, vehicleEntry);
             break;
         case 5:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 6:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 7:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 8:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 9:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 10:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 11:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 12:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 13:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 14:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 15:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_0(query, imageDirection, vehicleEntry);
             break;
         case 16:
-            vehicle_sprite_5_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_1(query, imageDirection, vehicleEntry);
             break;
         case 17:
-            vehicle_sprite_5_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_2(query, imageDirection, vehicleEntry);
             break;
         case 18:
-            vehicle_sprite_5_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_3(query, imageDirection, vehicleEntry);
             break;
         case 19:
-            vehicle_sprite_5_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_5_4(query, imageDirection, vehicleEntry);
             break;
     }
 }
 
 // 6D47E4
-static void vehicle_sprite_6_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_6_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPES)
     {
@@ -1982,43 +1916,39 @@ static void vehicle_sprite_6_0(
         {
             int32_t ecx = ((imageDirection / 2) ^ 8) + 16;
             int32_t ebx = (((imageDirection / 8) + 12) * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
         else
         {
             int32_t ecx = ((imageDirection / 2) ^ 8) + 16;
             int32_t ebx = ((imageDirection + 40) * vehicleEntry->base_num_frames) + vehicleEntry->gentle_slope_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4880
-static void vehicle_sprite_6_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_6_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = ((imageDirection / 2) ^ 8) + 16;
         int32_t ebx = (((imageDirection / 8) + 8) * vehicleEntry->base_num_frames)
             + vehicleEntry->gentle_slope_to_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4953
-static void vehicle_sprite_6_2(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_6_2(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TURNS)
     {
@@ -2028,44 +1958,40 @@ static void vehicle_sprite_6_2(
             ecx += 108;
             int32_t ebx = ((imageDirection + 64) * vehicleEntry->base_num_frames)
                 + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
         else
         {
             ecx = (ecx ^ 8) + 16;
             int32_t ebx = ((imageDirection + 64) * vehicleEntry->base_num_frames)
                 + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
     }
     else
     {
-        vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D48AB
-static void vehicle_sprite_6_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_6_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = ((imageDirection / 2) ^ 8) + 16;
         int32_t ebx = (((imageDirection / 8) + 12) * vehicleEntry->base_num_frames)
             + vehicleEntry->gentle_slope_to_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4996
-static void vehicle_sprite_6_4(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_6_4(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_GENTLE_SLOPE_BANKED_TURNS)
     {
@@ -2075,272 +2001,247 @@ static void vehicle_sprite_6_4(
             ecx = (ecx ^ 8) + 108;
             int32_t ebx = ((imageDirection + 96) * vehicleEntry->base_num_frames)
                 + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
         else
         {
             ecx = (ecx ^ 8) + 16;
             int32_t ebx = ((imageDirection + 96) * vehicleEntry->base_num_frames)
                 + vehicleEntry->gentle_slope_bank_turn_image_id;
-            vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+            vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
         }
     }
     else
     {
-        vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D47DD
-static void vehicle_sprite_6(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_6(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3CF4:
-    switch (vehicle->bank_rotation)
+    switch (query.BankRotation)
     {
         case 0:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 1:
-            vehicle_sprite_6_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_1(query, imageDirection, vehicleEntry);
             break;
         case 2:
-            vehicle_sprite_6_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_2(query, imageDirection, vehicleEntry);
             break;
         case 3:
-            vehicle_sprite_6_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_3(query, imageDirection, vehicleEntry);
             break;
         case 4:
-            vehicle_sprite_6_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_4(query, imageDirection, vehicleEntry);
             break;
         case 5:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 6:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 7:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 8:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 9:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 10:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 11:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 12:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 13:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 14:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 15:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_0(query, imageDirection, vehicleEntry);
             break;
         case 16:
-            vehicle_sprite_6_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_1(query, imageDirection, vehicleEntry);
             break;
         case 17:
-            vehicle_sprite_6_2(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_2(query, imageDirection, vehicleEntry);
             break;
         case 18:
-            vehicle_sprite_6_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_3(query, imageDirection, vehicleEntry);
             break;
         case 19:
-            vehicle_sprite_6_4(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_6_4(query, imageDirection, vehicleEntry);
             break;
     }
 }
 
 // 6D4A05
-static void vehicle_sprite_7(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_7(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_STEEP_SLOPES)
     {
         int32_t ecx = ((imageDirection / 4) ^ 4) + 32;
         int32_t ebx = (((imageDirection / 4) + 8) * vehicleEntry->base_num_frames) + vehicleEntry->steep_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_6(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4A59
-static void vehicle_sprite_8(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_8(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_STEEP_SLOPES)
     {
         int32_t ecx = ((imageDirection / 2) ^ 8) + 40;
         int32_t ebx = ((imageDirection + 48) * vehicleEntry->base_num_frames) + vehicleEntry->steep_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_6(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4A81
-static void vehicle_sprite_9(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_9(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 56;
         int32_t ebx = ((imageDirection / 8) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4AE8
-static void vehicle_sprite_10(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_10(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 2) + 60;
         int32_t ebx = ((imageDirection + 8) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4B57
-static void vehicle_sprite_11(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_11(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 76;
         int32_t ebx = (((imageDirection / 8) + 72) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4BB7
-static void vehicle_sprite_12(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_12(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 80;
         int32_t ebx = (((imageDirection / 8) + 80) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4C17
-static void vehicle_sprite_13(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_13(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 84;
         int32_t ebx = (((imageDirection / 8) + 88) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4C77
-static void vehicle_sprite_14(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_14(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 88;
         int32_t ebx = (((imageDirection / 8) + 96) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4CD7
-static void vehicle_sprite_15(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_15(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 92;
         int32_t ebx = (((imageDirection / 8) + 104) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4D37
-static void vehicle_sprite_16(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_16(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_VERTICAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 96;
         int32_t ebx = (((imageDirection / 8) + 112) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_4(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_4(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4AA3
-static void vehicle_sprite_17(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_17(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
-        if ((vehicle->GetTrackType()) != TrackElemType::Down90ToDown60
-            && (vehicle->GetTrackType()) != TrackElemType::Down60ToDown90)
+        if (query.GetTrackType() != TrackElemType::Down90ToDown60 && query.GetTrackType() != TrackElemType::Down60ToDown90)
         {
             vehicleEntry--;
         }
@@ -2349,23 +2250,21 @@ static void vehicle_sprite_17(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 56;
         int32_t ebx = (((imageDirection / 8) + 4) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_8(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_8(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4B0D
-static void vehicle_sprite_18(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_18(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
-        if ((vehicle->GetTrackType()) != TrackElemType::Down90 && (vehicle->GetTrackType()) != TrackElemType::Down90ToDown60
-            && (vehicle->GetTrackType()) != TrackElemType::Down60ToDown90)
+        if (query.GetTrackType() != TrackElemType::Down90 && query.GetTrackType() != TrackElemType::Down90ToDown60
+            && query.GetTrackType() != TrackElemType::Down60ToDown90)
         {
             vehicleEntry--;
         }
@@ -2374,20 +2273,18 @@ static void vehicle_sprite_18(
     {
         int32_t ecx = ((imageDirection / 2) ^ 8) + 60;
         int32_t ebx = ((imageDirection + 40) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_8(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_8(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4B80
-static void vehicle_sprite_19(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_19(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -2395,20 +2292,18 @@ static void vehicle_sprite_19(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 76;
         int32_t ebx = (((imageDirection / 8) + 76) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_8(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_8(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4BE0
-static void vehicle_sprite_20(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_20(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -2416,20 +2311,18 @@ static void vehicle_sprite_20(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 80;
         int32_t ebx = (((imageDirection / 8) + 84) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_8(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_8(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4C40
-static void vehicle_sprite_21(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_21(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -2437,20 +2330,18 @@ static void vehicle_sprite_21(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 84;
         int32_t ebx = (((imageDirection / 8) + 92) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_8(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_8(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4CA0
-static void vehicle_sprite_22(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_22(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -2458,20 +2349,18 @@ static void vehicle_sprite_22(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 88;
         int32_t ebx = (((imageDirection / 8) + 100) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_8(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_8(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4D00
-static void vehicle_sprite_23(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_23(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
@@ -2479,418 +2368,383 @@ static void vehicle_sprite_23(
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 92;
         int32_t ebx = (((imageDirection / 8) + 108) * vehicleEntry->base_num_frames) + vehicleEntry->vertical_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_8(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_8(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D51A5
-static void vehicle_sprite_24(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_24(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES))
+    if (query.UseInvertedSprites)
     {
         vehicleEntry--;
     }
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_CORKSCREWS)
     {
-        int32_t eax = ((vehicle->vehicle_sprite_type - 24) * 4);
+        int32_t eax = ((query.Pitch - 24) * 4);
         int32_t ecx = (imageDirection / 8) + eax + 144;
         int32_t ebx = (((imageDirection / 8) + eax) * vehicleEntry->base_num_frames) + vehicleEntry->corkscrew_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_paint_6D51DE(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_6D51DE(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4D67
-static void vehicle_sprite_50_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_50_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_SLOPES)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection / 8) * vehicleEntry->base_num_frames) + vehicleEntry->diagonal_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4DB5
-static void vehicle_sprite_50_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_50_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = ((imageDirection / 8) * vehicleEntry->base_num_frames)
             + vehicleEntry->diagonal_to_gentle_slope_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4DD3
-static void vehicle_sprite_50_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_50_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 4) * vehicleEntry->base_num_frames)
             + vehicleEntry->diagonal_to_gentle_slope_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4D60
-static void vehicle_sprite_50(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_50(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3D44:
-    switch (vehicle->bank_rotation)
+    switch (query.BankRotation)
     {
         case 0:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 1:
-            vehicle_sprite_50_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_1(query, imageDirection, vehicleEntry);
             break;
         case 2:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 3:
-            vehicle_sprite_50_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_3(query, imageDirection, vehicleEntry);
             break;
         case 4:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 5:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 6:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 7:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 8:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 9:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 10:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 11:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 12:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 13:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 14:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 15:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 16:
-            vehicle_sprite_50_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_1(query, imageDirection, vehicleEntry);
             break;
         case 17:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
         case 18:
-            vehicle_sprite_50_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_3(query, imageDirection, vehicleEntry);
             break;
         case 19:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_50_0(query, imageDirection, vehicleEntry);
             break;
     }
 }
 
 // 6D4E3A
-static void vehicle_sprite_51(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_51(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 100;
         int32_t ebx = (((imageDirection / 8) + 8) * vehicleEntry->base_num_frames) + vehicleEntry->diagonal_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4E8F
-static void vehicle_sprite_52(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_52(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_SLOPES)
     {
         int32_t ecx = (imageDirection / 8) + 104;
         int32_t ebx = (((imageDirection / 8) + 16) * vehicleEntry->base_num_frames) + vehicleEntry->diagonal_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4D90
-static void vehicle_sprite_53_0(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_53_0(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_SLOPES)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 4) * vehicleEntry->base_num_frames) + vehicleEntry->diagonal_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4DF4
-static void vehicle_sprite_53_1(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_53_1(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 8) * vehicleEntry->base_num_frames)
             + vehicleEntry->diagonal_to_gentle_slope_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4E15
-static void vehicle_sprite_53_3(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_53_3(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_GENTLE_SLOPE_BANKED_TRANSITIONS)
     {
         int32_t ecx = imageDirection / 2;
         int32_t ebx = (((imageDirection / 8) + 12) * vehicleEntry->base_num_frames)
             + vehicleEntry->diagonal_to_gentle_slope_bank_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4D89
-static void vehicle_sprite_53(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_53(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3D94:
-    switch (vehicle->bank_rotation)
+    switch (query.BankRotation)
     {
         case 0:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 1:
-            vehicle_sprite_53_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_1(query, imageDirection, vehicleEntry);
             break;
         case 2:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 3:
-            vehicle_sprite_53_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_3(query, imageDirection, vehicleEntry);
             break;
         case 4:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 5:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 6:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 7:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 8:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 9:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 10:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 11:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 12:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 13:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 14:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 15:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 16:
-            vehicle_sprite_53_1(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_1(query, imageDirection, vehicleEntry);
             break;
         case 17:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
         case 18:
-            vehicle_sprite_53_3(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_3(query, imageDirection, vehicleEntry);
             break;
         case 19:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
+            vehicle_sprite_53_0(query, imageDirection, vehicleEntry);
             break;
     }
 }
 
 // 6D4E63
-static void vehicle_sprite_54(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_54(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_SLOPES)
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 100;
         int32_t ebx = (((imageDirection / 8) + 12) * vehicleEntry->base_num_frames) + vehicleEntry->diagonal_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4EB8
-static void vehicle_sprite_55(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_55(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_DIAGONAL_SLOPES)
     {
         int32_t ecx = ((imageDirection / 8) ^ 2) + 104;
         int32_t ebx = (((imageDirection / 8) + 20) * vehicleEntry->base_num_frames) + vehicleEntry->diagonal_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_0(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_0(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D47DA
-static void vehicle_sprite_56(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_56(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     vehicleEntry--;
-    vehicle_sprite_6(session, vehicle, imageDirection, z, vehicleEntry);
+    vehicle_sprite_6(query, imageDirection, vehicleEntry);
 }
 
 // 6D4A02
-static void vehicle_sprite_57(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_57(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     vehicleEntry--;
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_STEEP_SLOPES)
     {
         int32_t ecx = ((imageDirection / 4) ^ 4) + 32;
         int32_t ebx = (((imageDirection / 4) + 8) * vehicleEntry->base_num_frames) + vehicleEntry->steep_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_6(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4A56
-static void vehicle_sprite_58(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_58(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     vehicleEntry--;
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_STEEP_SLOPES)
     {
         int32_t ecx = ((imageDirection / 2) ^ 8) + 40;
         int32_t ebx = ((imageDirection + 48) * vehicleEntry->base_num_frames) + vehicleEntry->steep_slope_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_6(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_6(query, imageDirection, vehicleEntry);
     }
 }
 
 // 6D4773
-static void vehicle_sprite_59(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry)
+static void vehicle_sprite_59(VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry)
 {
     if (vehicleEntry->sprite_flags & VEHICLE_SPRITE_FLAG_CURVED_LIFT_HILL)
     {
         int32_t ecx = (imageDirection / 2) + 16;
         int32_t ebx = (imageDirection * vehicleEntry->base_num_frames) + vehicleEntry->curved_lift_hill_image_id;
-        vehicle_sprite_paint_6D520E(session, vehicle, ebx, ecx, z, vehicleEntry);
+        vehicle_sprite_paint_6D520E(query, ebx, ecx, vehicleEntry);
     }
     else
     {
-        vehicle_sprite_2(session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_2(query, imageDirection, vehicleEntry);
     }
 }
 
 // 0x009A3B14:
 using vehicle_sprite_func = void (*)(
-    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry);
+    VehicleSpriteQuery& query, int32_t imageDirection, const rct_ride_entry_vehicle* vehicleEntry);
 
 // clang-format off
 static constexpr const vehicle_sprite_func vehicle_sprite_funcs[] = {
@@ -3113,6 +2967,199 @@ void vehicle_visual_splash_effect(
     }
 }
 
+enum
+{
+    VEHICLE_SPRITE_LOOKUP_FLAG_RESOLVED = 1 << 0,
+    VEHICLE_SPRITE_LOOKUP_FLAG_NO_SPRITE = 1 << 1,
+    VEHICLE_SPRITE_LOOKUP_FLAG_PREVIOUS_ENTRY = 1 << 2,
+    VEHICLE_SPRITE_LOOKUP_FLAG_RESTRAINTS = 1 << 3,
+};
+
+static constexpr uint8_t VehicleSpriteLookupBankRotations = 20;
+static constexpr int32_t VehicleSpriteLookupDirections = 32;
+static constexpr uint8_t VehicleSpriteLookupMaxShift = 5;
+
+static size_t vehicle_sprite_lookup_index(bool inverted, uint8_t pitch, uint8_t bankRotation)
+{
+    return ((inverted ? std::size(vehicle_sprite_funcs) : 0) + pitch) * VehicleSpriteLookupBankRotations + bankRotation;
+}
+
+static VehicleSpriteQuery vehicle_sprite_resolve(
+    uint8_t pitch, uint8_t bankRotation, bool inverted, track_type_t trackType, int32_t imageDirection,
+    const rct_ride_entry_vehicle* vehicleEntry)
+{
+    VehicleSpriteQuery query;
+    query.Pitch = pitch;
+    query.BankRotation = bankRotation;
+    query.UseInvertedSprites = inverted;
+    query.TrackType = trackType;
+    if (pitch < std::size(vehicle_sprite_funcs))
+    {
+        vehicle_sprite_funcs[pitch](query, imageDirection, vehicleEntry);
+    }
+    return query;
+}
+
+static bool vehicle_sprite_fit_image(
+    const VehicleSpriteQuery* queries, const rct_ride_entry_vehicle* entry, VehicleSpriteLookup& lookup)
+{
+    for (uint8_t shift = 0; shift <= VehicleSpriteLookupMaxShift; shift++)
+    {
+        bool fits = true;
+        for (int32_t direction = 0; direction < VehicleSpriteLookupDirections && fits; direction++)
+        {
+            fits = queries[direction].ImageId == queries[0].ImageId + (direction >> shift) * entry->base_num_frames;
+        }
+        if (fits)
+        {
+            lookup.ImageId = queries[0].ImageId;
+            lookup.ImageDirectionShift = shift;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool vehicle_sprite_fit_bound_box(const VehicleSpriteQuery* queries, VehicleSpriteLookup& lookup)
+{
+    for (uint8_t shift = 0; shift <= VehicleSpriteLookupMaxShift; shift++)
+    {
+        // A direction that selects a single bit tells whether the xor flips that bit
+        int32_t directionXor = 0;
+        for (int32_t bit = 0; (1 << (bit + shift)) < VehicleSpriteLookupDirections; bit++)
+        {
+            if (queries[1 << (bit + shift)].BoundBox < queries[0].BoundBox)
+            {
+                directionXor |= 1 << bit;
+            }
+        }
+        int32_t offset = queries[0].BoundBox - directionXor;
+        if (offset < 0 || offset > UINT8_MAX)
+        {
+            continue;
+        }
+
+        bool fits = true;
+        for (int32_t direction = 0; direction < VehicleSpriteLookupDirections && fits; direction++)
+        {
+            fits = queries[direction].BoundBox == ((direction >> shift) ^ directionXor) + offset;
+        }
+        if (fits)
+        {
+            lookup.BoundBox = static_cast<uint8_t>(offset);
+            lookup.BoundBoxDirectionShift = shift;
+            lookup.BoundBoxDirectionXor = static_cast<uint8_t>(directionXor);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Resolves a pitch and bank rotation for every image direction and fits the results to a formula of the direction.
+ * Anything that does not fit, or that depends on the track the car is on, is left unresolved and goes through the
+ * sprite functions when painting.
+ */
+static VehicleSpriteLookup vehicle_sprite_build_lookup_entry(
+    const rct_ride_entry_vehicle* vehicleEntry, uint8_t pitch, uint8_t bankRotation, bool inverted)
+{
+    VehicleSpriteLookup lookup{};
+
+    VehicleSpriteQuery queries[VehicleSpriteLookupDirections];
+    for (int32_t direction = 0; direction < VehicleSpriteLookupDirections; direction++)
+    {
+        queries[direction] = vehicle_sprite_resolve(
+            pitch, bankRotation, inverted, TrackElemType::Flat, direction, vehicleEntry);
+        const auto& query = queries[direction];
+        if (query.TrackTypeUsed || query.Resolutions != queries[0].Resolutions || query.Resolutions > 1)
+        {
+            return lookup;
+        }
+    }
+
+    if (queries[0].Resolutions == 0)
+    {
+        lookup.Flags = VEHICLE_SPRITE_LOOKUP_FLAG_RESOLVED | VEHICLE_SPRITE_LOOKUP_FLAG_NO_SPRITE;
+        return lookup;
+    }
+
+    const auto* entry = queries[0].Entry;
+    if (entry != vehicleEntry && entry != vehicleEntry - 1)
+    {
+        return lookup;
+    }
+    bool canUseRestraints = queries[0].CanUseRestraints;
+    for (int32_t direction = 0; direction < VehicleSpriteLookupDirections; direction++)
+    {
+        const auto& query = queries[direction];
+        if (query.Entry != entry || query.ImageId < 0 || query.BoundBox < 0
+            || query.CanUseRestraints != (canUseRestraints && !(direction & 7)))
+        {
+            return lookup;
+        }
+    }
+
+    if (!vehicle_sprite_fit_image(queries, entry, lookup) || !vehicle_sprite_fit_bound_box(queries, lookup))
+    {
+        return {};
+    }
+    lookup.Flags = VEHICLE_SPRITE_LOOKUP_FLAG_RESOLVED;
+    if (entry != vehicleEntry)
+    {
+        lookup.Flags |= VEHICLE_SPRITE_LOOKUP_FLAG_PREVIOUS_ENTRY;
+    }
+    if (canUseRestraints)
+    {
+        lookup.Flags |= VEHICLE_SPRITE_LOOKUP_FLAG_RESTRAINTS;
+    }
+    return lookup;
+}
+
+/**
+ * Precomputes which sprite group and bounding box every pitch and bank rotation of a car uses, so painting a car does
+ * not have to go through the sprite functions and their checks of the vehicle entry flags. The entry needs its image
+ * ids set. Inverted cars are drawn with the entry after their own one and fall back to the previous entry for some
+ * pitches, so those are only resolved when there is a previous entry.
+ */
+void vehicle_sprite_build_lookup(rct_ride_entry_vehicle* vehicleEntry, bool hasPreviousEntry)
+{
+    auto& table = vehicleEntry->sprite_lookup;
+    table.assign(vehicle_sprite_lookup_index(true, 0, 0) * 2, VehicleSpriteLookup{});
+    for (bool inverted : { false, true })
+    {
+        if (inverted && !hasPreviousEntry)
+        {
+            continue;
+        }
+        for (uint8_t pitch = 0; pitch < std::size(vehicle_sprite_funcs); pitch++)
+        {
+            for (uint8_t bankRotation = 0; bankRotation < VehicleSpriteLookupBankRotations; bankRotation++)
+            {
+                table[vehicle_sprite_lookup_index(inverted, pitch, bankRotation)] = vehicle_sprite_build_lookup_entry(
+                    vehicleEntry, pitch, bankRotation, inverted);
+            }
+        }
+    }
+}
+
+// 6D51DE
+static void vehicle_sprite_paint_resolved(
+    paint_session* session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
+    const rct_ride_entry_vehicle* vehicleEntry, int32_t imageId, int32_t boundBox, bool canUseRestraints)
+{
+    if (canUseRestraints && vehicle->restraints_position >= 64)
+    {
+        imageId = (imageDirection / 8) + ((vehicle->restraints_position - 64) / 64) * 4;
+        imageId *= vehicleEntry->base_num_frames;
+        imageId += vehicleEntry->restraint_image_id;
+    }
+    else
+    {
+        imageId += vehicle->SwingSprite;
+    }
+    vehicle_sprite_paint(session, vehicle, imageId, boundBox, z, vehicleEntry);
+}
+
 /**
  *
  *  rct2: 0x006D45F8
@@ -3121,9 +3168,34 @@ void vehicle_visual_default(
     paint_session* session, int32_t imageDirection, int32_t z, const Vehicle* vehicle,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->vehicle_sprite_type < std::size(vehicle_sprite_funcs))
+    bool inverted = vehicle->HasUpdateFlag(VEHICLE_UPDATE_FLAG_USE_INVERTED_SPRITES);
+    auto pitch = vehicle->vehicle_sprite_type;
+    auto bankRotation = vehicle->bank_rotation;
+    if (pitch < std::size(vehicle_sprite_funcs) && bankRotation < VehicleSpriteLookupBankRotations
+        && !vehicleEntry->sprite_lookup.empty())
+    {
+        const auto& lookup = vehicleEntry->sprite_lookup[vehicle_sprite_lookup_index(inverted, pitch, bankRotation)];
+        if (lookup.Flags & VEHICLE_SPRITE_LOOKUP_FLAG_RESOLVED)
+        {
+            if (lookup.Flags & VEHICLE_SPRITE_LOOKUP_FLAG_NO_SPRITE)
+            {
+                return;
+            }
+            const auto* entry = (lookup.Flags & VEHICLE_SPRITE_LOOKUP_FLAG_PREVIOUS_ENTRY) ? vehicleEntry - 1 : vehicleEntry;
+            int32_t imageId = lookup.ImageId + (imageDirection >> lookup.ImageDirectionShift) * entry->base_num_frames;
+            int32_t boundBox = ((imageDirection >> lookup.BoundBoxDirectionShift) ^ lookup.BoundBoxDirectionXor)
+                + lookup.BoundBox;
+            bool canUseRestraints = (lookup.Flags & VEHICLE_SPRITE_LOOKUP_FLAG_RESTRAINTS) && !(imageDirection & 7);
+            vehicle_sprite_paint_resolved(session, vehicle, imageDirection, z, entry, imageId, boundBox, canUseRestraints);
+            return;
+        }
+    }
+
+    auto query = vehicle_sprite_resolve(pitch, bankRotation, inverted, vehicle->GetTrackType(), imageDirection, vehicleEntry);
+    if (query.Resolutions != 0)
     {
-        vehicle_sprite_funcs[vehicle->vehicle_sprite_type](session, vehicle, imageDirection, z, vehicleEntry);
+        vehicle_sprite_paint_resolved(
+            session, vehicle, imageDirection, z, query.Entry, query.ImageId, query.BoundBox, query.CanUseRestraints);
     }
 }
 
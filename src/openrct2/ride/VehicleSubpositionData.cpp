@@ -23889,1842 +23889,1842 @@ namespace RightLane
 
 CREATE_VEHICLE_INFO(TrackVehicleInfo_000000, { { 0, 0, 0, 0, 0, 0 } })
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListDefault[] = {
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C,
-    &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408, &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4,
-    &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_8E39EE, &TrackVehicleInfo_8E3AB6, &TrackVehicleInfo_8E3B87, &TrackVehicleInfo_8E3C4F,
-    &TrackVehicleInfo_8E3D0E, &TrackVehicleInfo_8E3DCD, &TrackVehicleInfo_8E3E95, &TrackVehicleInfo_8E3F66, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DB70E, &TrackVehicleInfo_8DBA70, &TrackVehicleInfo_8DBDD2, &TrackVehicleInfo_8DC134, &TrackVehicleInfo_8DC496, &TrackVehicleInfo_8DC7F8,
-    &TrackVehicleInfo_8DCB5A, &TrackVehicleInfo_8DCEBC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E7AFA, &TrackVehicleInfo_8E80A5, &TrackVehicleInfo_8E8650, &TrackVehicleInfo_8E8BFB, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EC3AA, &TrackVehicleInfo_8EC715, &TrackVehicleInfo_8ECA80, &TrackVehicleInfo_8ECDEB, &TrackVehicleInfo_8ED156, &TrackVehicleInfo_8ED4C1,
-    &TrackVehicleInfo_8ED82C, &TrackVehicleInfo_8EDB97, &TrackVehicleInfo_8C6C32, &TrackVehicleInfo_8C6D78, &TrackVehicleInfo_8C6EBE, &TrackVehicleInfo_8C7004,
-    &TrackVehicleInfo_8C714A, &TrackVehicleInfo_8C7290, &TrackVehicleInfo_8C73D6, &TrackVehicleInfo_8C751C, &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8,
-    &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_8C7B7A, &TrackVehicleInfo_8C7CC0, &TrackVehicleInfo_8C7E06, &TrackVehicleInfo_8C7F4C,
-    &TrackVehicleInfo_8EFA5A, &TrackVehicleInfo_8EFDAA, &TrackVehicleInfo_8F00FA, &TrackVehicleInfo_8F044A, &TrackVehicleInfo_8F079A, &TrackVehicleInfo_8F08BC,
-    &TrackVehicleInfo_8F09DE, &TrackVehicleInfo_8F0B00, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554,
-    &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80,
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5,
-    &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408,
-    &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4, &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C,
-    &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18,
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01,
-    &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890,
-    &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496, &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D,
-    &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94,
-    &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923, &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8,
-    &TrackVehicleInfo_8F8C82, &TrackVehicleInfo_8F9143, &TrackVehicleInfo_8F9616, &TrackVehicleInfo_8F9AE9, &TrackVehicleInfo_8F9FAA, &TrackVehicleInfo_8FA46B,
-    &TrackVehicleInfo_8FA93E, &TrackVehicleInfo_8FAE11, &TrackVehicleInfo_8FB2D2, &TrackVehicleInfo_8FB793, &TrackVehicleInfo_8FBC66, &TrackVehicleInfo_8FC139,
-    &TrackVehicleInfo_8FC5FA, &TrackVehicleInfo_8FCABB, &TrackVehicleInfo_8FCF8E, &TrackVehicleInfo_8FD461, &TrackVehicleInfo_8F0C22, &TrackVehicleInfo_8F141F,
-    &TrackVehicleInfo_8F1C2E, &TrackVehicleInfo_8F243D, &TrackVehicleInfo_8F2C3A, &TrackVehicleInfo_8F3437, &TrackVehicleInfo_8F3C46, &TrackVehicleInfo_8F4455,
-    &TrackVehicleInfo_8F4C52, &TrackVehicleInfo_8F544F, &TrackVehicleInfo_8F5C5E, &TrackVehicleInfo_8F646D, &TrackVehicleInfo_8F6C6A, &TrackVehicleInfo_8F7467,
-    &TrackVehicleInfo_8F7C76, &TrackVehicleInfo_8F8485, &TrackVehicleInfo_8E402E, &TrackVehicleInfo_8E4270, &TrackVehicleInfo_8E44B2, &TrackVehicleInfo_8E46F4,
-    &TrackVehicleInfo_8E4936, &TrackVehicleInfo_8E4B78, &TrackVehicleInfo_8E4DBA, &TrackVehicleInfo_8E4FFC, &TrackVehicleInfo_8E523E, &TrackVehicleInfo_8E5480,
-    &TrackVehicleInfo_8E56C2, &TrackVehicleInfo_8E5904, &TrackVehicleInfo_8E5B46, &TrackVehicleInfo_8E5D88, &TrackVehicleInfo_8E5FCA, &TrackVehicleInfo_8E620C,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_8B0EB2, &TrackVehicleInfo_8B12B6, &TrackVehicleInfo_8B16C3, &TrackVehicleInfo_8B1AC7, &TrackVehicleInfo_8B1EC2, &TrackVehicleInfo_8B22BD,
-    &TrackVehicleInfo_8B26C1, &TrackVehicleInfo_8B2ACE, &TrackVehicleInfo_8B2ED2, &TrackVehicleInfo_8B32D6, &TrackVehicleInfo_8B36E3, &TrackVehicleInfo_8B3AE7,
-    &TrackVehicleInfo_8B3EE2, &TrackVehicleInfo_8B42DD, &TrackVehicleInfo_8B46E1, &TrackVehicleInfo_8B4AEE, &TrackVehicleInfo_8B4EF2, &TrackVehicleInfo_8B52F6,
-    &TrackVehicleInfo_8B5703, &TrackVehicleInfo_8B5B07, &TrackVehicleInfo_8B5F02, &TrackVehicleInfo_8B62FD, &TrackVehicleInfo_8B6701, &TrackVehicleInfo_8B6B0E,
-    &TrackVehicleInfo_8B6F12, &TrackVehicleInfo_8B7316, &TrackVehicleInfo_8B7723, &TrackVehicleInfo_8B7B27, &TrackVehicleInfo_8B7F22, &TrackVehicleInfo_8B831D,
-    &TrackVehicleInfo_8B8721, &TrackVehicleInfo_8B8B2E, &TrackVehicleInfo_968C6E, &TrackVehicleInfo_968D90, &TrackVehicleInfo_968EB2, &TrackVehicleInfo_968FD4,
-    &TrackVehicleInfo_96957E, &TrackVehicleInfo_9696A0, &TrackVehicleInfo_9697C2, &TrackVehicleInfo_9698E4, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9048E8, &TrackVehicleInfo_904A0A, &TrackVehicleInfo_904B2C, &TrackVehicleInfo_904C4E,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9690F6, &TrackVehicleInfo_969218,
-    &TrackVehicleInfo_96933A, &TrackVehicleInfo_96945C, &TrackVehicleInfo_969A06, &TrackVehicleInfo_969B28, &TrackVehicleInfo_969C4A, &TrackVehicleInfo_969D6C,
-    &TrackVehicleInfo_904D72, &TrackVehicleInfo_905314, &TrackVehicleInfo_9058B6, &TrackVehicleInfo_905E58, &TrackVehicleInfo_96D4AE, &TrackVehicleInfo_96D9A5,
-    &TrackVehicleInfo_96DE9C, &TrackVehicleInfo_96E393, &TrackVehicleInfo_96E88A, &TrackVehicleInfo_96ED81, &TrackVehicleInfo_96F278, &TrackVehicleInfo_96F76F,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_971042, &TrackVehicleInfo_971539,
-    &TrackVehicleInfo_971A30, &TrackVehicleInfo_971F27, &TrackVehicleInfo_96FC66, &TrackVehicleInfo_97015D, &TrackVehicleInfo_970654, &TrackVehicleInfo_970B4B,
-    &TrackVehicleInfo_97241E, &TrackVehicleInfo_9729ED, &TrackVehicleInfo_972FBC, &TrackVehicleInfo_97358B, &TrackVehicleInfo_9063FA, &TrackVehicleInfo_906EAC,
-    &TrackVehicleInfo_90795E, &TrackVehicleInfo_908410, &TrackVehicleInfo_90B98A, &TrackVehicleInfo_90BC5C, &TrackVehicleInfo_90BF2E, &TrackVehicleInfo_90C200,
-    &TrackVehicleInfo_90E02A, &TrackVehicleInfo_90E14C, &TrackVehicleInfo_90E26E, &TrackVehicleInfo_90E390, &TrackVehicleInfo_90E4B2, &TrackVehicleInfo_90E5D4,
-    &TrackVehicleInfo_90E6F6, &TrackVehicleInfo_90E818, &TrackVehicleInfo_90E93A, &TrackVehicleInfo_90EB34, &TrackVehicleInfo_90ED2E, &TrackVehicleInfo_90EF28,
-    &TrackVehicleInfo_9100F2, &TrackVehicleInfo_9102EC, &TrackVehicleInfo_9104E6, &TrackVehicleInfo_9106E0, &TrackVehicleInfo_90F122, &TrackVehicleInfo_90F31C,
-    &TrackVehicleInfo_90F516, &TrackVehicleInfo_90F710, &TrackVehicleInfo_90F90A, &TrackVehicleInfo_90FB04, &TrackVehicleInfo_90FCFE, &TrackVehicleInfo_90FEF8,
-    &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8, &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_9108DA, &TrackVehicleInfo_910BA3,
-    &TrackVehicleInfo_910E75, &TrackVehicleInfo_911147, &TrackVehicleInfo_911F58, &TrackVehicleInfo_91222A, &TrackVehicleInfo_9124FC, &TrackVehicleInfo_9127CE,
-    &TrackVehicleInfo_911419, &TrackVehicleInfo_9116E2, &TrackVehicleInfo_9119B4, &TrackVehicleInfo_911C86, &TrackVehicleInfo_912AA0, &TrackVehicleInfo_912D69,
-    &TrackVehicleInfo_91303B, &TrackVehicleInfo_91330D, &TrackVehicleInfo_9135DF, &TrackVehicleInfo_9138A8, &TrackVehicleInfo_913B7A, &TrackVehicleInfo_913E4C,
-    &TrackVehicleInfo_914C5D, &TrackVehicleInfo_914F2F, &TrackVehicleInfo_915201, &TrackVehicleInfo_9154D3, &TrackVehicleInfo_91411E, &TrackVehicleInfo_9143E7,
-    &TrackVehicleInfo_9146B9, &TrackVehicleInfo_91498B, &TrackVehicleInfo_9157A5, &TrackVehicleInfo_915A6E, &TrackVehicleInfo_915D40, &TrackVehicleInfo_916012,
-    &TrackVehicleInfo_9162E6, &TrackVehicleInfo_916408, &TrackVehicleInfo_91652A, &TrackVehicleInfo_91664C, &TrackVehicleInfo_91676E, &TrackVehicleInfo_916890,
-    &TrackVehicleInfo_9169B2, &TrackVehicleInfo_916AD4, &TrackVehicleInfo_91707E, &TrackVehicleInfo_9172C0, &TrackVehicleInfo_917502, &TrackVehicleInfo_917744,
-    &TrackVehicleInfo_91828E, &TrackVehicleInfo_9183B0, &TrackVehicleInfo_9184D2, &TrackVehicleInfo_9185F4, &TrackVehicleInfo_9194F6, &TrackVehicleInfo_919645,
-    &TrackVehicleInfo_919794, &TrackVehicleInfo_9198E3, &TrackVehicleInfo_919A32, &TrackVehicleInfo_919B81, &TrackVehicleInfo_919CD0, &TrackVehicleInfo_919E1F,
-    &TrackVehicleInfo_918716, &TrackVehicleInfo_91884A, &TrackVehicleInfo_91897E, &TrackVehicleInfo_918AB2, &TrackVehicleInfo_916BF6, &TrackVehicleInfo_916D18,
-    &TrackVehicleInfo_916E3A, &TrackVehicleInfo_916F5C, &TrackVehicleInfo_917986, &TrackVehicleInfo_917BC8, &TrackVehicleInfo_917E0A, &TrackVehicleInfo_91804C,
-    &TrackVehicleInfo_91906E, &TrackVehicleInfo_919190, &TrackVehicleInfo_9192B2, &TrackVehicleInfo_9193D4, &TrackVehicleInfo_91A4AA, &TrackVehicleInfo_91A5F9,
-    &TrackVehicleInfo_91A748, &TrackVehicleInfo_91A897, &TrackVehicleInfo_919F6E, &TrackVehicleInfo_91A0BD, &TrackVehicleInfo_91A20C, &TrackVehicleInfo_91A35B,
-    &TrackVehicleInfo_918BE6, &TrackVehicleInfo_918D08, &TrackVehicleInfo_918E2A, &TrackVehicleInfo_918F4C, &TrackVehicleInfo_91A9E6, &TrackVehicleInfo_91AB2C,
-    &TrackVehicleInfo_91AC72, &TrackVehicleInfo_91ADB8, &TrackVehicleInfo_91AEFE, &TrackVehicleInfo_91B044, &TrackVehicleInfo_91B18A, &TrackVehicleInfo_91B2D0,
-    &TrackVehicleInfo_91B416, &TrackVehicleInfo_91B55C, &TrackVehicleInfo_91B6A2, &TrackVehicleInfo_91B7E8, &TrackVehicleInfo_91B92E, &TrackVehicleInfo_91BA74,
-    &TrackVehicleInfo_91BBBA, &TrackVehicleInfo_91BD00, &TrackVehicleInfo_95787E, &TrackVehicleInfo_9579A0, &TrackVehicleInfo_957AC2, &TrackVehicleInfo_957BE4,
-    &TrackVehicleInfo_957D06, &TrackVehicleInfo_957E28, &TrackVehicleInfo_957F4A, &TrackVehicleInfo_95806C, &TrackVehicleInfo_95818E, &TrackVehicleInfo_9582B0,
-    &TrackVehicleInfo_9583D2, &TrackVehicleInfo_9584F4, &TrackVehicleInfo_958616, &TrackVehicleInfo_958738, &TrackVehicleInfo_95885A, &TrackVehicleInfo_95897C,
-    &TrackVehicleInfo_958A9E, &TrackVehicleInfo_958BC0, &TrackVehicleInfo_958CE2, &TrackVehicleInfo_958E04, &TrackVehicleInfo_958F26, &TrackVehicleInfo_959048,
-    &TrackVehicleInfo_95916A, &TrackVehicleInfo_95928C, &TrackVehicleInfo_9593AE, &TrackVehicleInfo_9594E2, &TrackVehicleInfo_959616, &TrackVehicleInfo_95974A,
-    &TrackVehicleInfo_95987E, &TrackVehicleInfo_9599B2, &TrackVehicleInfo_959AE6, &TrackVehicleInfo_959C1A, &TrackVehicleInfo_95A65E, &TrackVehicleInfo_95A780,
-    &TrackVehicleInfo_95A8A2, &TrackVehicleInfo_95A9C4, &TrackVehicleInfo_95AAE6, &TrackVehicleInfo_95AC08, &TrackVehicleInfo_95AD2A, &TrackVehicleInfo_95AE4C,
-    &TrackVehicleInfo_959D4E, &TrackVehicleInfo_959E70, &TrackVehicleInfo_959F92, &TrackVehicleInfo_95A0B4, &TrackVehicleInfo_95A1D6, &TrackVehicleInfo_95A2F8,
-    &TrackVehicleInfo_95A41A, &TrackVehicleInfo_95A53C, &TrackVehicleInfo_95AF6E, &TrackVehicleInfo_95B090, &TrackVehicleInfo_95B1B2, &TrackVehicleInfo_95B2D4,
-    &TrackVehicleInfo_95B3F6, &TrackVehicleInfo_95B518, &TrackVehicleInfo_95B63A, &TrackVehicleInfo_95B75C, &TrackVehicleInfo_91BE46, &TrackVehicleInfo_91C001,
-    &TrackVehicleInfo_91C1BC, &TrackVehicleInfo_91C377, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_91C532, &TrackVehicleInfo_91C894, &TrackVehicleInfo_91CBF6, &TrackVehicleInfo_91CF58, &TrackVehicleInfo_91D2BA, &TrackVehicleInfo_91D61C,
-    &TrackVehicleInfo_91D97E, &TrackVehicleInfo_91DCE0, &TrackVehicleInfo_91E042, &TrackVehicleInfo_91E3A4, &TrackVehicleInfo_91E706, &TrackVehicleInfo_91EA68,
-    &TrackVehicleInfo_91EDCA, &TrackVehicleInfo_91F12C, &TrackVehicleInfo_91F48E, &TrackVehicleInfo_91F7F0, &TrackVehicleInfo_920E82, &TrackVehicleInfo_9210E8,
-    &TrackVehicleInfo_921357, &TrackVehicleInfo_9215BD, &TrackVehicleInfo_92181A, &TrackVehicleInfo_921A77, &TrackVehicleInfo_921CDD, &TrackVehicleInfo_921F4C,
-    &TrackVehicleInfo_91FB52, &TrackVehicleInfo_91FDB8, &TrackVehicleInfo_920027, &TrackVehicleInfo_92028D, &TrackVehicleInfo_9204EA, &TrackVehicleInfo_920747,
-    &TrackVehicleInfo_9209AD, &TrackVehicleInfo_920C1C, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690,
-    &TrackVehicleInfo_9221B2, &TrackVehicleInfo_9237A6, &TrackVehicleInfo_924D9A, &TrackVehicleInfo_92638E, &TrackVehicleInfo_922CAC, &TrackVehicleInfo_9242A0,
-    &TrackVehicleInfo_925894, &TrackVehicleInfo_926E88, &TrackVehicleInfo_927982, &TrackVehicleInfo_928F76, &TrackVehicleInfo_92A56A, &TrackVehicleInfo_92BB5E,
-    &TrackVehicleInfo_92847C, &TrackVehicleInfo_929A70, &TrackVehicleInfo_92B064, &TrackVehicleInfo_92C658, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DD21E, &TrackVehicleInfo_8DD580, &TrackVehicleInfo_8DD8E2, &TrackVehicleInfo_8DDC44, &TrackVehicleInfo_8DDFA6, &TrackVehicleInfo_8DE308,
-    &TrackVehicleInfo_8DE66A, &TrackVehicleInfo_8DE9CC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E91A6, &TrackVehicleInfo_8E9751, &TrackVehicleInfo_8E9CFC, &TrackVehicleInfo_8EA2A7, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EDF02, &TrackVehicleInfo_8EE26D, &TrackVehicleInfo_8EE5D8, &TrackVehicleInfo_8EE943, &TrackVehicleInfo_8EECAE, &TrackVehicleInfo_8EF019,
-    &TrackVehicleInfo_8EF384, &TrackVehicleInfo_8EF6EF, &TrackVehicleInfo_92D152, &TrackVehicleInfo_92D6F4, &TrackVehicleInfo_92DC96, &TrackVehicleInfo_92E238,
-    &TrackVehicleInfo_92E7DA, &TrackVehicleInfo_92ED7C, &TrackVehicleInfo_92F31E, &TrackVehicleInfo_92F8C0, &TrackVehicleInfo_92FE62, &TrackVehicleInfo_930524,
-    &TrackVehicleInfo_930BE6, &TrackVehicleInfo_9312A8, &TrackVehicleInfo_93196A, &TrackVehicleInfo_93202C, &TrackVehicleInfo_9326EE, &TrackVehicleInfo_932DB0,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_979BD6, &TrackVehicleInfo_97A0A9, &TrackVehicleInfo_97A57C, &TrackVehicleInfo_97AA4F,
-    &TrackVehicleInfo_973B5A, &TrackVehicleInfo_97402D, &TrackVehicleInfo_974500, &TrackVehicleInfo_9749D3, &TrackVehicleInfo_974EA6, &TrackVehicleInfo_975379,
-    &TrackVehicleInfo_97584C, &TrackVehicleInfo_975D1F, &TrackVehicleInfo_8FDFAA, &TrackVehicleInfo_8FE210, &TrackVehicleInfo_8FE47F, &TrackVehicleInfo_8FE6E5,
-    &TrackVehicleInfo_8FE942, &TrackVehicleInfo_8FEB9F, &TrackVehicleInfo_8FEE05, &TrackVehicleInfo_8FF074, &TrackVehicleInfo_94F14E, &TrackVehicleInfo_94F810,
-    &TrackVehicleInfo_94FED2, &TrackVehicleInfo_950594, &TrackVehicleInfo_950C56, &TrackVehicleInfo_951318, &TrackVehicleInfo_9519DA, &TrackVehicleInfo_95209C,
-    &TrackVehicleInfo_90C4D2, &TrackVehicleInfo_90C8D6, &TrackVehicleInfo_90CCDA, &TrackVehicleInfo_90D0DE, &TrackVehicleInfo_90D4E2, &TrackVehicleInfo_90D7B4,
-    &TrackVehicleInfo_90DA86, &TrackVehicleInfo_90DD58, &TrackVehicleInfo_908EC2, &TrackVehicleInfo_909974, &TrackVehicleInfo_90A426, &TrackVehicleInfo_90AED8,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_960BEE, &TrackVehicleInfo_960E54,
-    &TrackVehicleInfo_9610C3, &TrackVehicleInfo_961329, &TrackVehicleInfo_961586, &TrackVehicleInfo_9617E3, &TrackVehicleInfo_961A49, &TrackVehicleInfo_961CB8,
-    &TrackVehicleInfo_95F8BE, &TrackVehicleInfo_95FB24, &TrackVehicleInfo_95FD93, &TrackVehicleInfo_95FFF9, &TrackVehicleInfo_960256, &TrackVehicleInfo_9604B3,
-    &TrackVehicleInfo_960719, &TrackVehicleInfo_960988, &TrackVehicleInfo_95B87E, &TrackVehicleInfo_95BC82, &TrackVehicleInfo_95C08F, &TrackVehicleInfo_95C493,
-    &TrackVehicleInfo_95C88E, &TrackVehicleInfo_95CC89, &TrackVehicleInfo_95D08D, &TrackVehicleInfo_95D49A, &TrackVehicleInfo_95D89E, &TrackVehicleInfo_95DCA2,
-    &TrackVehicleInfo_95E0AF, &TrackVehicleInfo_95E4B3, &TrackVehicleInfo_95E8AE, &TrackVehicleInfo_95ECA9, &TrackVehicleInfo_95F0AD, &TrackVehicleInfo_95F4BA,
-    &TrackVehicleInfo_961F1E, &TrackVehicleInfo_962040, &TrackVehicleInfo_962162, &TrackVehicleInfo_962284, &TrackVehicleInfo_9623A6, &TrackVehicleInfo_9624C8,
-    &TrackVehicleInfo_9625EA, &TrackVehicleInfo_96270C, &TrackVehicleInfo_96313E, &TrackVehicleInfo_963260, &TrackVehicleInfo_963382, &TrackVehicleInfo_9634A4,
-    &TrackVehicleInfo_9635C6, &TrackVehicleInfo_9636E8, &TrackVehicleInfo_96380A, &TrackVehicleInfo_96392C, &TrackVehicleInfo_96282E, &TrackVehicleInfo_962950,
-    &TrackVehicleInfo_962A72, &TrackVehicleInfo_962B94, &TrackVehicleInfo_962CB6, &TrackVehicleInfo_962DD8, &TrackVehicleInfo_962EFA, &TrackVehicleInfo_96301C,
-    &TrackVehicleInfo_963A4E, &TrackVehicleInfo_963B70, &TrackVehicleInfo_963C92, &TrackVehicleInfo_963DB4, &TrackVehicleInfo_963ED6, &TrackVehicleInfo_963FF8,
-    &TrackVehicleInfo_96411A, &TrackVehicleInfo_96423C, &TrackVehicleInfo_96435E, &TrackVehicleInfo_964480, &TrackVehicleInfo_9645A2, &TrackVehicleInfo_9646C4,
-    &TrackVehicleInfo_96557E, &TrackVehicleInfo_9656A0, &TrackVehicleInfo_9657C2, &TrackVehicleInfo_9658E4, &TrackVehicleInfo_9647E6, &TrackVehicleInfo_964908,
-    &TrackVehicleInfo_964A2A, &TrackVehicleInfo_964B4C, &TrackVehicleInfo_965A06, &TrackVehicleInfo_965B28, &TrackVehicleInfo_965C4A, &TrackVehicleInfo_965D6C,
-    &TrackVehicleInfo_9650F6, &TrackVehicleInfo_965218, &TrackVehicleInfo_96533A, &TrackVehicleInfo_96545C, &TrackVehicleInfo_966316, &TrackVehicleInfo_966438,
-    &TrackVehicleInfo_96655A, &TrackVehicleInfo_96667C, &TrackVehicleInfo_964C6E, &TrackVehicleInfo_964D90, &TrackVehicleInfo_964EB2, &TrackVehicleInfo_964FD4,
-    &TrackVehicleInfo_965E8E, &TrackVehicleInfo_965FB0, &TrackVehicleInfo_9660D2, &TrackVehicleInfo_9661F4, &TrackVehicleInfo_96679E, &TrackVehicleInfo_9668C0,
-    &TrackVehicleInfo_9669E2, &TrackVehicleInfo_966B04, &TrackVehicleInfo_966C26, &TrackVehicleInfo_966D48, &TrackVehicleInfo_966E6A, &TrackVehicleInfo_966F8C,
-    &TrackVehicleInfo_9670AE, &TrackVehicleInfo_9671E2, &TrackVehicleInfo_967316, &TrackVehicleInfo_96744A, &TrackVehicleInfo_96757E, &TrackVehicleInfo_9676B2,
-    &TrackVehicleInfo_9677E6, &TrackVehicleInfo_96791A, &TrackVehicleInfo_96835E, &TrackVehicleInfo_968480, &TrackVehicleInfo_9685A2, &TrackVehicleInfo_9686C4,
-    &TrackVehicleInfo_9687E6, &TrackVehicleInfo_968908, &TrackVehicleInfo_968A2A, &TrackVehicleInfo_968B4C, &TrackVehicleInfo_967A4E, &TrackVehicleInfo_967B70,
-    &TrackVehicleInfo_967C92, &TrackVehicleInfo_967DB4, &TrackVehicleInfo_967ED6, &TrackVehicleInfo_967FF8, &TrackVehicleInfo_96811A, &TrackVehicleInfo_96823C,
-    &TrackVehicleInfo_969E8E, &TrackVehicleInfo_96A1F0, &TrackVehicleInfo_96A552, &TrackVehicleInfo_96A8B4, &TrackVehicleInfo_96B99E, &TrackVehicleInfo_96BD00,
-    &TrackVehicleInfo_96C062, &TrackVehicleInfo_96C3C4, &TrackVehicleInfo_96AC16, &TrackVehicleInfo_96AF78, &TrackVehicleInfo_96B2DA, &TrackVehicleInfo_96B63C,
-    &TrackVehicleInfo_96C726, &TrackVehicleInfo_96CA88, &TrackVehicleInfo_96CDEA, &TrackVehicleInfo_96D14C, &TrackVehicleInfo_9761F2, &TrackVehicleInfo_9766C5,
-    &TrackVehicleInfo_976B98, &TrackVehicleInfo_97706B, &TrackVehicleInfo_97753E, &TrackVehicleInfo_977A11, &TrackVehicleInfo_977EE4, &TrackVehicleInfo_9783B7,
-    &TrackVehicleInfo_97888A, &TrackVehicleInfo_978D5D, &TrackVehicleInfo_979230, &TrackVehicleInfo_979703,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListDefault[] = {
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C,
+    TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408, TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4,
+    TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_8E39EE, TrackVehicleInfo_8E3AB6, TrackVehicleInfo_8E3B87, TrackVehicleInfo_8E3C4F,
+    TrackVehicleInfo_8E3D0E, TrackVehicleInfo_8E3DCD, TrackVehicleInfo_8E3E95, TrackVehicleInfo_8E3F66, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DB70E, TrackVehicleInfo_8DBA70, TrackVehicleInfo_8DBDD2, TrackVehicleInfo_8DC134, TrackVehicleInfo_8DC496, TrackVehicleInfo_8DC7F8,
+    TrackVehicleInfo_8DCB5A, TrackVehicleInfo_8DCEBC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E7AFA, TrackVehicleInfo_8E80A5, TrackVehicleInfo_8E8650, TrackVehicleInfo_8E8BFB, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EC3AA, TrackVehicleInfo_8EC715, TrackVehicleInfo_8ECA80, TrackVehicleInfo_8ECDEB, TrackVehicleInfo_8ED156, TrackVehicleInfo_8ED4C1,
+    TrackVehicleInfo_8ED82C, TrackVehicleInfo_8EDB97, TrackVehicleInfo_8C6C32, TrackVehicleInfo_8C6D78, TrackVehicleInfo_8C6EBE, TrackVehicleInfo_8C7004,
+    TrackVehicleInfo_8C714A, TrackVehicleInfo_8C7290, TrackVehicleInfo_8C73D6, TrackVehicleInfo_8C751C, TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8,
+    TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_8C7B7A, TrackVehicleInfo_8C7CC0, TrackVehicleInfo_8C7E06, TrackVehicleInfo_8C7F4C,
+    TrackVehicleInfo_8EFA5A, TrackVehicleInfo_8EFDAA, TrackVehicleInfo_8F00FA, TrackVehicleInfo_8F044A, TrackVehicleInfo_8F079A, TrackVehicleInfo_8F08BC,
+    TrackVehicleInfo_8F09DE, TrackVehicleInfo_8F0B00, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554,
+    TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80,
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5,
+    TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408,
+    TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4, TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C,
+    TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18,
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01,
+    TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890,
+    TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496, TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D,
+    TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94,
+    TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923, TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8,
+    TrackVehicleInfo_8F8C82, TrackVehicleInfo_8F9143, TrackVehicleInfo_8F9616, TrackVehicleInfo_8F9AE9, TrackVehicleInfo_8F9FAA, TrackVehicleInfo_8FA46B,
+    TrackVehicleInfo_8FA93E, TrackVehicleInfo_8FAE11, TrackVehicleInfo_8FB2D2, TrackVehicleInfo_8FB793, TrackVehicleInfo_8FBC66, TrackVehicleInfo_8FC139,
+    TrackVehicleInfo_8FC5FA, TrackVehicleInfo_8FCABB, TrackVehicleInfo_8FCF8E, TrackVehicleInfo_8FD461, TrackVehicleInfo_8F0C22, TrackVehicleInfo_8F141F,
+    TrackVehicleInfo_8F1C2E, TrackVehicleInfo_8F243D, TrackVehicleInfo_8F2C3A, TrackVehicleInfo_8F3437, TrackVehicleInfo_8F3C46, TrackVehicleInfo_8F4455,
+    TrackVehicleInfo_8F4C52, TrackVehicleInfo_8F544F, TrackVehicleInfo_8F5C5E, TrackVehicleInfo_8F646D, TrackVehicleInfo_8F6C6A, TrackVehicleInfo_8F7467,
+    TrackVehicleInfo_8F7C76, TrackVehicleInfo_8F8485, TrackVehicleInfo_8E402E, TrackVehicleInfo_8E4270, TrackVehicleInfo_8E44B2, TrackVehicleInfo_8E46F4,
+    TrackVehicleInfo_8E4936, TrackVehicleInfo_8E4B78, TrackVehicleInfo_8E4DBA, TrackVehicleInfo_8E4FFC, TrackVehicleInfo_8E523E, TrackVehicleInfo_8E5480,
+    TrackVehicleInfo_8E56C2, TrackVehicleInfo_8E5904, TrackVehicleInfo_8E5B46, TrackVehicleInfo_8E5D88, TrackVehicleInfo_8E5FCA, TrackVehicleInfo_8E620C,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_8B0EB2, TrackVehicleInfo_8B12B6, TrackVehicleInfo_8B16C3, TrackVehicleInfo_8B1AC7, TrackVehicleInfo_8B1EC2, TrackVehicleInfo_8B22BD,
+    TrackVehicleInfo_8B26C1, TrackVehicleInfo_8B2ACE, TrackVehicleInfo_8B2ED2, TrackVehicleInfo_8B32D6, TrackVehicleInfo_8B36E3, TrackVehicleInfo_8B3AE7,
+    TrackVehicleInfo_8B3EE2, TrackVehicleInfo_8B42DD, TrackVehicleInfo_8B46E1, TrackVehicleInfo_8B4AEE, TrackVehicleInfo_8B4EF2, TrackVehicleInfo_8B52F6,
+    TrackVehicleInfo_8B5703, TrackVehicleInfo_8B5B07, TrackVehicleInfo_8B5F02, TrackVehicleInfo_8B62FD, TrackVehicleInfo_8B6701, TrackVehicleInfo_8B6B0E,
+    TrackVehicleInfo_8B6F12, TrackVehicleInfo_8B7316, TrackVehicleInfo_8B7723, TrackVehicleInfo_8B7B27, TrackVehicleInfo_8B7F22, TrackVehicleInfo_8B831D,
+    TrackVehicleInfo_8B8721, TrackVehicleInfo_8B8B2E, TrackVehicleInfo_968C6E, TrackVehicleInfo_968D90, TrackVehicleInfo_968EB2, TrackVehicleInfo_968FD4,
+    TrackVehicleInfo_96957E, TrackVehicleInfo_9696A0, TrackVehicleInfo_9697C2, TrackVehicleInfo_9698E4, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9048E8, TrackVehicleInfo_904A0A, TrackVehicleInfo_904B2C, TrackVehicleInfo_904C4E,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9690F6, TrackVehicleInfo_969218,
+    TrackVehicleInfo_96933A, TrackVehicleInfo_96945C, TrackVehicleInfo_969A06, TrackVehicleInfo_969B28, TrackVehicleInfo_969C4A, TrackVehicleInfo_969D6C,
+    TrackVehicleInfo_904D72, TrackVehicleInfo_905314, TrackVehicleInfo_9058B6, TrackVehicleInfo_905E58, TrackVehicleInfo_96D4AE, TrackVehicleInfo_96D9A5,
+    TrackVehicleInfo_96DE9C, TrackVehicleInfo_96E393, TrackVehicleInfo_96E88A, TrackVehicleInfo_96ED81, TrackVehicleInfo_96F278, TrackVehicleInfo_96F76F,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_971042, TrackVehicleInfo_971539,
+    TrackVehicleInfo_971A30, TrackVehicleInfo_971F27, TrackVehicleInfo_96FC66, TrackVehicleInfo_97015D, TrackVehicleInfo_970654, TrackVehicleInfo_970B4B,
+    TrackVehicleInfo_97241E, TrackVehicleInfo_9729ED, TrackVehicleInfo_972FBC, TrackVehicleInfo_97358B, TrackVehicleInfo_9063FA, TrackVehicleInfo_906EAC,
+    TrackVehicleInfo_90795E, TrackVehicleInfo_908410, TrackVehicleInfo_90B98A, TrackVehicleInfo_90BC5C, TrackVehicleInfo_90BF2E, TrackVehicleInfo_90C200,
+    TrackVehicleInfo_90E02A, TrackVehicleInfo_90E14C, TrackVehicleInfo_90E26E, TrackVehicleInfo_90E390, TrackVehicleInfo_90E4B2, TrackVehicleInfo_90E5D4,
+    TrackVehicleInfo_90E6F6, TrackVehicleInfo_90E818, TrackVehicleInfo_90E93A, TrackVehicleInfo_90EB34, TrackVehicleInfo_90ED2E, TrackVehicleInfo_90EF28,
+    TrackVehicleInfo_9100F2, TrackVehicleInfo_9102EC, TrackVehicleInfo_9104E6, TrackVehicleInfo_9106E0, TrackVehicleInfo_90F122, TrackVehicleInfo_90F31C,
+    TrackVehicleInfo_90F516, TrackVehicleInfo_90F710, TrackVehicleInfo_90F90A, TrackVehicleInfo_90FB04, TrackVehicleInfo_90FCFE, TrackVehicleInfo_90FEF8,
+    TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8, TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_9108DA, TrackVehicleInfo_910BA3,
+    TrackVehicleInfo_910E75, TrackVehicleInfo_911147, TrackVehicleInfo_911F58, TrackVehicleInfo_91222A, TrackVehicleInfo_9124FC, TrackVehicleInfo_9127CE,
+    TrackVehicleInfo_911419, TrackVehicleInfo_9116E2, TrackVehicleInfo_9119B4, TrackVehicleInfo_911C86, TrackVehicleInfo_912AA0, TrackVehicleInfo_912D69,
+    TrackVehicleInfo_91303B, TrackVehicleInfo_91330D, TrackVehicleInfo_9135DF, TrackVehicleInfo_9138A8, TrackVehicleInfo_913B7A, TrackVehicleInfo_913E4C,
+    TrackVehicleInfo_914C5D, TrackVehicleInfo_914F2F, TrackVehicleInfo_915201, TrackVehicleInfo_9154D3, TrackVehicleInfo_91411E, TrackVehicleInfo_9143E7,
+    TrackVehicleInfo_9146B9, TrackVehicleInfo_91498B, TrackVehicleInfo_9157A5, TrackVehicleInfo_915A6E, TrackVehicleInfo_915D40, TrackVehicleInfo_916012,
+    TrackVehicleInfo_9162E6, TrackVehicleInfo_916408, TrackVehicleInfo_91652A, TrackVehicleInfo_91664C, TrackVehicleInfo_91676E, TrackVehicleInfo_916890,
+    TrackVehicleInfo_9169B2, TrackVehicleInfo_916AD4, TrackVehicleInfo_91707E, TrackVehicleInfo_9172C0, TrackVehicleInfo_917502, TrackVehicleInfo_917744,
+    TrackVehicleInfo_91828E, TrackVehicleInfo_9183B0, TrackVehicleInfo_9184D2, TrackVehicleInfo_9185F4, TrackVehicleInfo_9194F6, TrackVehicleInfo_919645,
+    TrackVehicleInfo_919794, TrackVehicleInfo_9198E3, TrackVehicleInfo_919A32, TrackVehicleInfo_919B81, TrackVehicleInfo_919CD0, TrackVehicleInfo_919E1F,
+    TrackVehicleInfo_918716, TrackVehicleInfo_91884A, TrackVehicleInfo_91897E, TrackVehicleInfo_918AB2, TrackVehicleInfo_916BF6, TrackVehicleInfo_916D18,
+    TrackVehicleInfo_916E3A, TrackVehicleInfo_916F5C, TrackVehicleInfo_917986, TrackVehicleInfo_917BC8, TrackVehicleInfo_917E0A, TrackVehicleInfo_91804C,
+    TrackVehicleInfo_91906E, TrackVehicleInfo_919190, TrackVehicleInfo_9192B2, TrackVehicleInfo_9193D4, TrackVehicleInfo_91A4AA, TrackVehicleInfo_91A5F9,
+    TrackVehicleInfo_91A748, TrackVehicleInfo_91A897, TrackVehicleInfo_919F6E, TrackVehicleInfo_91A0BD, TrackVehicleInfo_91A20C, TrackVehicleInfo_91A35B,
+    TrackVehicleInfo_918BE6, TrackVehicleInfo_918D08, TrackVehicleInfo_918E2A, TrackVehicleInfo_918F4C, TrackVehicleInfo_91A9E6, TrackVehicleInfo_91AB2C,
+    TrackVehicleInfo_91AC72, TrackVehicleInfo_91ADB8, TrackVehicleInfo_91AEFE, TrackVehicleInfo_91B044, TrackVehicleInfo_91B18A, TrackVehicleInfo_91B2D0,
+    TrackVehicleInfo_91B416, TrackVehicleInfo_91B55C, TrackVehicleInfo_91B6A2, TrackVehicleInfo_91B7E8, TrackVehicleInfo_91B92E, TrackVehicleInfo_91BA74,
+    TrackVehicleInfo_91BBBA, TrackVehicleInfo_91BD00, TrackVehicleInfo_95787E, TrackVehicleInfo_9579A0, TrackVehicleInfo_957AC2, TrackVehicleInfo_957BE4,
+    TrackVehicleInfo_957D06, TrackVehicleInfo_957E28, TrackVehicleInfo_957F4A, TrackVehicleInfo_95806C, TrackVehicleInfo_95818E, TrackVehicleInfo_9582B0,
+    TrackVehicleInfo_9583D2, TrackVehicleInfo_9584F4, TrackVehicleInfo_958616, TrackVehicleInfo_958738, TrackVehicleInfo_95885A, TrackVehicleInfo_95897C,
+    TrackVehicleInfo_958A9E, TrackVehicleInfo_958BC0, TrackVehicleInfo_958CE2, TrackVehicleInfo_958E04, TrackVehicleInfo_958F26, TrackVehicleInfo_959048,
+    TrackVehicleInfo_95916A, TrackVehicleInfo_95928C, TrackVehicleInfo_9593AE, TrackVehicleInfo_9594E2, TrackVehicleInfo_959616, TrackVehicleInfo_95974A,
+    TrackVehicleInfo_95987E, TrackVehicleInfo_9599B2, TrackVehicleInfo_959AE6, TrackVehicleInfo_959C1A, TrackVehicleInfo_95A65E, TrackVehicleInfo_95A780,
+    TrackVehicleInfo_95A8A2, TrackVehicleInfo_95A9C4, TrackVehicleInfo_95AAE6, TrackVehicleInfo_95AC08, TrackVehicleInfo_95AD2A, TrackVehicleInfo_95AE4C,
+    TrackVehicleInfo_959D4E, TrackVehicleInfo_959E70, TrackVehicleInfo_959F92, TrackVehicleInfo_95A0B4, TrackVehicleInfo_95A1D6, TrackVehicleInfo_95A2F8,
+    TrackVehicleInfo_95A41A, TrackVehicleInfo_95A53C, TrackVehicleInfo_95AF6E, TrackVehicleInfo_95B090, TrackVehicleInfo_95B1B2, TrackVehicleInfo_95B2D4,
+    TrackVehicleInfo_95B3F6, TrackVehicleInfo_95B518, TrackVehicleInfo_95B63A, TrackVehicleInfo_95B75C, TrackVehicleInfo_91BE46, TrackVehicleInfo_91C001,
+    TrackVehicleInfo_91C1BC, TrackVehicleInfo_91C377, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_91C532, TrackVehicleInfo_91C894, TrackVehicleInfo_91CBF6, TrackVehicleInfo_91CF58, TrackVehicleInfo_91D2BA, TrackVehicleInfo_91D61C,
+    TrackVehicleInfo_91D97E, TrackVehicleInfo_91DCE0, TrackVehicleInfo_91E042, TrackVehicleInfo_91E3A4, TrackVehicleInfo_91E706, TrackVehicleInfo_91EA68,
+    TrackVehicleInfo_91EDCA, TrackVehicleInfo_91F12C, TrackVehicleInfo_91F48E, TrackVehicleInfo_91F7F0, TrackVehicleInfo_920E82, TrackVehicleInfo_9210E8,
+    TrackVehicleInfo_921357, TrackVehicleInfo_9215BD, TrackVehicleInfo_92181A, TrackVehicleInfo_921A77, TrackVehicleInfo_921CDD, TrackVehicleInfo_921F4C,
+    TrackVehicleInfo_91FB52, TrackVehicleInfo_91FDB8, TrackVehicleInfo_920027, TrackVehicleInfo_92028D, TrackVehicleInfo_9204EA, TrackVehicleInfo_920747,
+    TrackVehicleInfo_9209AD, TrackVehicleInfo_920C1C, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690,
+    TrackVehicleInfo_9221B2, TrackVehicleInfo_9237A6, TrackVehicleInfo_924D9A, TrackVehicleInfo_92638E, TrackVehicleInfo_922CAC, TrackVehicleInfo_9242A0,
+    TrackVehicleInfo_925894, TrackVehicleInfo_926E88, TrackVehicleInfo_927982, TrackVehicleInfo_928F76, TrackVehicleInfo_92A56A, TrackVehicleInfo_92BB5E,
+    TrackVehicleInfo_92847C, TrackVehicleInfo_929A70, TrackVehicleInfo_92B064, TrackVehicleInfo_92C658, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DD21E, TrackVehicleInfo_8DD580, TrackVehicleInfo_8DD8E2, TrackVehicleInfo_8DDC44, TrackVehicleInfo_8DDFA6, TrackVehicleInfo_8DE308,
+    TrackVehicleInfo_8DE66A, TrackVehicleInfo_8DE9CC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E91A6, TrackVehicleInfo_8E9751, TrackVehicleInfo_8E9CFC, TrackVehicleInfo_8EA2A7, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EDF02, TrackVehicleInfo_8EE26D, TrackVehicleInfo_8EE5D8, TrackVehicleInfo_8EE943, TrackVehicleInfo_8EECAE, TrackVehicleInfo_8EF019,
+    TrackVehicleInfo_8EF384, TrackVehicleInfo_8EF6EF, TrackVehicleInfo_92D152, TrackVehicleInfo_92D6F4, TrackVehicleInfo_92DC96, TrackVehicleInfo_92E238,
+    TrackVehicleInfo_92E7DA, TrackVehicleInfo_92ED7C, TrackVehicleInfo_92F31E, TrackVehicleInfo_92F8C0, TrackVehicleInfo_92FE62, TrackVehicleInfo_930524,
+    TrackVehicleInfo_930BE6, TrackVehicleInfo_9312A8, TrackVehicleInfo_93196A, TrackVehicleInfo_93202C, TrackVehicleInfo_9326EE, TrackVehicleInfo_932DB0,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_979BD6, TrackVehicleInfo_97A0A9, TrackVehicleInfo_97A57C, TrackVehicleInfo_97AA4F,
+    TrackVehicleInfo_973B5A, TrackVehicleInfo_97402D, TrackVehicleInfo_974500, TrackVehicleInfo_9749D3, TrackVehicleInfo_974EA6, TrackVehicleInfo_975379,
+    TrackVehicleInfo_97584C, TrackVehicleInfo_975D1F, TrackVehicleInfo_8FDFAA, TrackVehicleInfo_8FE210, TrackVehicleInfo_8FE47F, TrackVehicleInfo_8FE6E5,
+    TrackVehicleInfo_8FE942, TrackVehicleInfo_8FEB9F, TrackVehicleInfo_8FEE05, TrackVehicleInfo_8FF074, TrackVehicleInfo_94F14E, TrackVehicleInfo_94F810,
+    TrackVehicleInfo_94FED2, TrackVehicleInfo_950594, TrackVehicleInfo_950C56, TrackVehicleInfo_951318, TrackVehicleInfo_9519DA, TrackVehicleInfo_95209C,
+    TrackVehicleInfo_90C4D2, TrackVehicleInfo_90C8D6, TrackVehicleInfo_90CCDA, TrackVehicleInfo_90D0DE, TrackVehicleInfo_90D4E2, TrackVehicleInfo_90D7B4,
+    TrackVehicleInfo_90DA86, TrackVehicleInfo_90DD58, TrackVehicleInfo_908EC2, TrackVehicleInfo_909974, TrackVehicleInfo_90A426, TrackVehicleInfo_90AED8,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_960BEE, TrackVehicleInfo_960E54,
+    TrackVehicleInfo_9610C3, TrackVehicleInfo_961329, TrackVehicleInfo_961586, TrackVehicleInfo_9617E3, TrackVehicleInfo_961A49, TrackVehicleInfo_961CB8,
+    TrackVehicleInfo_95F8BE, TrackVehicleInfo_95FB24, TrackVehicleInfo_95FD93, TrackVehicleInfo_95FFF9, TrackVehicleInfo_960256, TrackVehicleInfo_9604B3,
+    TrackVehicleInfo_960719, TrackVehicleInfo_960988, TrackVehicleInfo_95B87E, TrackVehicleInfo_95BC82, TrackVehicleInfo_95C08F, TrackVehicleInfo_95C493,
+    TrackVehicleInfo_95C88E, TrackVehicleInfo_95CC89, TrackVehicleInfo_95D08D, TrackVehicleInfo_95D49A, TrackVehicleInfo_95D89E, TrackVehicleInfo_95DCA2,
+    TrackVehicleInfo_95E0AF, TrackVehicleInfo_95E4B3, TrackVehicleInfo_95E8AE, TrackVehicleInfo_95ECA9, TrackVehicleInfo_95F0AD, TrackVehicleInfo_95F4BA,
+    TrackVehicleInfo_961F1E, TrackVehicleInfo_962040, TrackVehicleInfo_962162, TrackVehicleInfo_962284, TrackVehicleInfo_9623A6, TrackVehicleInfo_9624C8,
+    TrackVehicleInfo_9625EA, TrackVehicleInfo_96270C, TrackVehicleInfo_96313E, TrackVehicleInfo_963260, TrackVehicleInfo_963382, TrackVehicleInfo_9634A4,
+    TrackVehicleInfo_9635C6, TrackVehicleInfo_9636E8, TrackVehicleInfo_96380A, TrackVehicleInfo_96392C, TrackVehicleInfo_96282E, TrackVehicleInfo_962950,
+    TrackVehicleInfo_962A72, TrackVehicleInfo_962B94, TrackVehicleInfo_962CB6, TrackVehicleInfo_962DD8, TrackVehicleInfo_962EFA, TrackVehicleInfo_96301C,
+    TrackVehicleInfo_963A4E, TrackVehicleInfo_963B70, TrackVehicleInfo_963C92, TrackVehicleInfo_963DB4, TrackVehicleInfo_963ED6, TrackVehicleInfo_963FF8,
+    TrackVehicleInfo_96411A, TrackVehicleInfo_96423C, TrackVehicleInfo_96435E, TrackVehicleInfo_964480, TrackVehicleInfo_9645A2, TrackVehicleInfo_9646C4,
+    TrackVehicleInfo_96557E, TrackVehicleInfo_9656A0, TrackVehicleInfo_9657C2, TrackVehicleInfo_9658E4, TrackVehicleInfo_9647E6, TrackVehicleInfo_964908,
+    TrackVehicleInfo_964A2A, TrackVehicleInfo_964B4C, TrackVehicleInfo_965A06, TrackVehicleInfo_965B28, TrackVehicleInfo_965C4A, TrackVehicleInfo_965D6C,
+    TrackVehicleInfo_9650F6, TrackVehicleInfo_965218, TrackVehicleInfo_96533A, TrackVehicleInfo_96545C, TrackVehicleInfo_966316, TrackVehicleInfo_966438,
+    TrackVehicleInfo_96655A, TrackVehicleInfo_96667C, TrackVehicleInfo_964C6E, TrackVehicleInfo_964D90, TrackVehicleInfo_964EB2, TrackVehicleInfo_964FD4,
+    TrackVehicleInfo_965E8E, TrackVehicleInfo_965FB0, TrackVehicleInfo_9660D2, TrackVehicleInfo_9661F4, TrackVehicleInfo_96679E, TrackVehicleInfo_9668C0,
+    TrackVehicleInfo_9669E2, TrackVehicleInfo_966B04, TrackVehicleInfo_966C26, TrackVehicleInfo_966D48, TrackVehicleInfo_966E6A, TrackVehicleInfo_966F8C,
+    TrackVehicleInfo_9670AE, TrackVehicleInfo_9671E2, TrackVehicleInfo_967316, TrackVehicleInfo_96744A, TrackVehicleInfo_96757E, TrackVehicleInfo_9676B2,
+    TrackVehicleInfo_9677E6, TrackVehicleInfo_96791A, TrackVehicleInfo_96835E, TrackVehicleInfo_968480, TrackVehicleInfo_9685A2, TrackVehicleInfo_9686C4,
+    TrackVehicleInfo_9687E6, TrackVehicleInfo_968908, TrackVehicleInfo_968A2A, TrackVehicleInfo_968B4C, TrackVehicleInfo_967A4E, TrackVehicleInfo_967B70,
+    TrackVehicleInfo_967C92, TrackVehicleInfo_967DB4, TrackVehicleInfo_967ED6, TrackVehicleInfo_967FF8, TrackVehicleInfo_96811A, TrackVehicleInfo_96823C,
+    TrackVehicleInfo_969E8E, TrackVehicleInfo_96A1F0, TrackVehicleInfo_96A552, TrackVehicleInfo_96A8B4, TrackVehicleInfo_96B99E, TrackVehicleInfo_96BD00,
+    TrackVehicleInfo_96C062, TrackVehicleInfo_96C3C4, TrackVehicleInfo_96AC16, TrackVehicleInfo_96AF78, TrackVehicleInfo_96B2DA, TrackVehicleInfo_96B63C,
+    TrackVehicleInfo_96C726, TrackVehicleInfo_96CA88, TrackVehicleInfo_96CDEA, TrackVehicleInfo_96D14C, TrackVehicleInfo_9761F2, TrackVehicleInfo_9766C5,
+    TrackVehicleInfo_976B98, TrackVehicleInfo_97706B, TrackVehicleInfo_97753E, TrackVehicleInfo_977A11, TrackVehicleInfo_977EE4, TrackVehicleInfo_9783B7,
+    TrackVehicleInfo_97888A, TrackVehicleInfo_978D5D, TrackVehicleInfo_979230, TrackVehicleInfo_979703,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListChairliftGoingOut[] = {
-    &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04,
-    &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48,
-    &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CFB6E, &TrackVehicleInfo_8CFC90,
-    &TrackVehicleInfo_8CFDB2, &TrackVehicleInfo_8CFED4, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8CE906, &TrackVehicleInfo_8CEA28, &TrackVehicleInfo_8CEB4A, &TrackVehicleInfo_8CEC6C, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_8CED8E, &TrackVehicleInfo_8CEEC2, &TrackVehicleInfo_8CEFF6, &TrackVehicleInfo_8CF12A, &TrackVehicleInfo_8CFFF6, &TrackVehicleInfo_8D0118,
-    &TrackVehicleInfo_8D023A, &TrackVehicleInfo_8D035C, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_8CF6E6, &TrackVehicleInfo_8CF808, &TrackVehicleInfo_8CF92A, &TrackVehicleInfo_8CFA4C, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_8CF25E, &TrackVehicleInfo_8CF380, &TrackVehicleInfo_8CF4A2, &TrackVehicleInfo_8CF5C4, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_8FD922, &TrackVehicleInfo_8FD975, &TrackVehicleInfo_8FD9D1, &TrackVehicleInfo_8FDA24,
-    &TrackVehicleInfo_8FDA6E, &TrackVehicleInfo_8FDBB4, &TrackVehicleInfo_8FDD03, &TrackVehicleInfo_8FDE5B, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DB70E, &TrackVehicleInfo_8DBA70, &TrackVehicleInfo_8DBDD2, &TrackVehicleInfo_8DC134, &TrackVehicleInfo_8DC496, &TrackVehicleInfo_8DC7F8,
-    &TrackVehicleInfo_8DCB5A, &TrackVehicleInfo_8DCEBC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E7AFA, &TrackVehicleInfo_8E80A5, &TrackVehicleInfo_8E8650, &TrackVehicleInfo_8E8BFB, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EC3AA, &TrackVehicleInfo_8EC715, &TrackVehicleInfo_8ECA80, &TrackVehicleInfo_8ECDEB, &TrackVehicleInfo_8ED156, &TrackVehicleInfo_8ED4C1,
-    &TrackVehicleInfo_8ED82C, &TrackVehicleInfo_8EDB97, &TrackVehicleInfo_8C6C32, &TrackVehicleInfo_8C6D78, &TrackVehicleInfo_8C6EBE, &TrackVehicleInfo_8C7004,
-    &TrackVehicleInfo_8C714A, &TrackVehicleInfo_8C7290, &TrackVehicleInfo_8C73D6, &TrackVehicleInfo_8C751C, &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8,
-    &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_8C7B7A, &TrackVehicleInfo_8C7CC0, &TrackVehicleInfo_8C7E06, &TrackVehicleInfo_8C7F4C,
-    &TrackVehicleInfo_8EFA5A, &TrackVehicleInfo_8EFDAA, &TrackVehicleInfo_8F00FA, &TrackVehicleInfo_8F044A, &TrackVehicleInfo_8F079A, &TrackVehicleInfo_8F08BC,
-    &TrackVehicleInfo_8F09DE, &TrackVehicleInfo_8F0B00, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554,
-    &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80,
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5,
-    &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408,
-    &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4, &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C,
-    &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18,
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01,
-    &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890,
-    &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496, &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D,
-    &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94,
-    &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923, &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8,
-    &TrackVehicleInfo_8F8C82, &TrackVehicleInfo_8F9143, &TrackVehicleInfo_8F9616, &TrackVehicleInfo_8F9AE9, &TrackVehicleInfo_8F9FAA, &TrackVehicleInfo_8FA46B,
-    &TrackVehicleInfo_8FA93E, &TrackVehicleInfo_8FAE11, &TrackVehicleInfo_8FB2D2, &TrackVehicleInfo_8FB793, &TrackVehicleInfo_8FBC66, &TrackVehicleInfo_8FC139,
-    &TrackVehicleInfo_8FC5FA, &TrackVehicleInfo_8FCABB, &TrackVehicleInfo_8FCF8E, &TrackVehicleInfo_8FD461, &TrackVehicleInfo_8F0C22, &TrackVehicleInfo_8F141F,
-    &TrackVehicleInfo_8F1C2E, &TrackVehicleInfo_8F243D, &TrackVehicleInfo_8F2C3A, &TrackVehicleInfo_8F3437, &TrackVehicleInfo_8F3C46, &TrackVehicleInfo_8F4455,
-    &TrackVehicleInfo_8F4C52, &TrackVehicleInfo_8F544F, &TrackVehicleInfo_8F5C5E, &TrackVehicleInfo_8F646D, &TrackVehicleInfo_8F6C6A, &TrackVehicleInfo_8F7467,
-    &TrackVehicleInfo_8F7C76, &TrackVehicleInfo_8F8485, &TrackVehicleInfo_8E402E, &TrackVehicleInfo_8E4270, &TrackVehicleInfo_8E44B2, &TrackVehicleInfo_8E46F4,
-    &TrackVehicleInfo_8E4936, &TrackVehicleInfo_8E4B78, &TrackVehicleInfo_8E4DBA, &TrackVehicleInfo_8E4FFC, &TrackVehicleInfo_8E523E, &TrackVehicleInfo_8E5480,
-    &TrackVehicleInfo_8E56C2, &TrackVehicleInfo_8E5904, &TrackVehicleInfo_8E5B46, &TrackVehicleInfo_8E5D88, &TrackVehicleInfo_8E5FCA, &TrackVehicleInfo_8E620C,
-    &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04,
-    &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_8B0EB2, &TrackVehicleInfo_8B12B6, &TrackVehicleInfo_8B16C3, &TrackVehicleInfo_8B1AC7, &TrackVehicleInfo_8B1EC2, &TrackVehicleInfo_8B22BD,
-    &TrackVehicleInfo_8B26C1, &TrackVehicleInfo_8B2ACE, &TrackVehicleInfo_8B2ED2, &TrackVehicleInfo_8B32D6, &TrackVehicleInfo_8B36E3, &TrackVehicleInfo_8B3AE7,
-    &TrackVehicleInfo_8B3EE2, &TrackVehicleInfo_8B42DD, &TrackVehicleInfo_8B46E1, &TrackVehicleInfo_8B4AEE, &TrackVehicleInfo_8B4EF2, &TrackVehicleInfo_8B52F6,
-    &TrackVehicleInfo_8B5703, &TrackVehicleInfo_8B5B07, &TrackVehicleInfo_8B5F02, &TrackVehicleInfo_8B62FD, &TrackVehicleInfo_8B6701, &TrackVehicleInfo_8B6B0E,
-    &TrackVehicleInfo_8B6F12, &TrackVehicleInfo_8B7316, &TrackVehicleInfo_8B7723, &TrackVehicleInfo_8B7B27, &TrackVehicleInfo_8B7F22, &TrackVehicleInfo_8B831D,
-    &TrackVehicleInfo_8B8721, &TrackVehicleInfo_8B8B2E, &TrackVehicleInfo_968C6E, &TrackVehicleInfo_968D90, &TrackVehicleInfo_968EB2, &TrackVehicleInfo_968FD4,
-    &TrackVehicleInfo_96957E, &TrackVehicleInfo_9696A0, &TrackVehicleInfo_9697C2, &TrackVehicleInfo_9698E4, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9048E8, &TrackVehicleInfo_904A0A, &TrackVehicleInfo_904B2C, &TrackVehicleInfo_904C4E,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9690F6, &TrackVehicleInfo_969218,
-    &TrackVehicleInfo_96933A, &TrackVehicleInfo_96945C, &TrackVehicleInfo_969A06, &TrackVehicleInfo_969B28, &TrackVehicleInfo_969C4A, &TrackVehicleInfo_969D6C,
-    &TrackVehicleInfo_904D72, &TrackVehicleInfo_905314, &TrackVehicleInfo_9058B6, &TrackVehicleInfo_905E58, &TrackVehicleInfo_96D4AE, &TrackVehicleInfo_96D9A5,
-    &TrackVehicleInfo_96DE9C, &TrackVehicleInfo_96E393, &TrackVehicleInfo_96E88A, &TrackVehicleInfo_96ED81, &TrackVehicleInfo_96F278, &TrackVehicleInfo_96F76F,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_971042, &TrackVehicleInfo_971539,
-    &TrackVehicleInfo_971A30, &TrackVehicleInfo_971F27, &TrackVehicleInfo_96FC66, &TrackVehicleInfo_97015D, &TrackVehicleInfo_970654, &TrackVehicleInfo_970B4B,
-    &TrackVehicleInfo_97241E, &TrackVehicleInfo_9729ED, &TrackVehicleInfo_972FBC, &TrackVehicleInfo_97358B, &TrackVehicleInfo_9063FA, &TrackVehicleInfo_906EAC,
-    &TrackVehicleInfo_90795E, &TrackVehicleInfo_908410, &TrackVehicleInfo_90B98A, &TrackVehicleInfo_90BC5C, &TrackVehicleInfo_90BF2E, &TrackVehicleInfo_90C200,
-    &TrackVehicleInfo_90E02A, &TrackVehicleInfo_90E14C, &TrackVehicleInfo_90E26E, &TrackVehicleInfo_90E390, &TrackVehicleInfo_90E4B2, &TrackVehicleInfo_90E5D4,
-    &TrackVehicleInfo_90E6F6, &TrackVehicleInfo_90E818, &TrackVehicleInfo_90E93A, &TrackVehicleInfo_90EB34, &TrackVehicleInfo_90ED2E, &TrackVehicleInfo_90EF28,
-    &TrackVehicleInfo_9100F2, &TrackVehicleInfo_9102EC, &TrackVehicleInfo_9104E6, &TrackVehicleInfo_9106E0, &TrackVehicleInfo_90F122, &TrackVehicleInfo_90F31C,
-    &TrackVehicleInfo_90F516, &TrackVehicleInfo_90F710, &TrackVehicleInfo_90F90A, &TrackVehicleInfo_90FB04, &TrackVehicleInfo_90FCFE, &TrackVehicleInfo_90FEF8,
-    &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8, &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_9108DA, &TrackVehicleInfo_910BA3,
-    &TrackVehicleInfo_910E75, &TrackVehicleInfo_911147, &TrackVehicleInfo_911F58, &TrackVehicleInfo_91222A, &TrackVehicleInfo_9124FC, &TrackVehicleInfo_9127CE,
-    &TrackVehicleInfo_911419, &TrackVehicleInfo_9116E2, &TrackVehicleInfo_9119B4, &TrackVehicleInfo_911C86, &TrackVehicleInfo_912AA0, &TrackVehicleInfo_912D69,
-    &TrackVehicleInfo_91303B, &TrackVehicleInfo_91330D, &TrackVehicleInfo_9135DF, &TrackVehicleInfo_9138A8, &TrackVehicleInfo_913B7A, &TrackVehicleInfo_913E4C,
-    &TrackVehicleInfo_914C5D, &TrackVehicleInfo_914F2F, &TrackVehicleInfo_915201, &TrackVehicleInfo_9154D3, &TrackVehicleInfo_91411E, &TrackVehicleInfo_9143E7,
-    &TrackVehicleInfo_9146B9, &TrackVehicleInfo_91498B, &TrackVehicleInfo_9157A5, &TrackVehicleInfo_915A6E, &TrackVehicleInfo_915D40, &TrackVehicleInfo_916012,
-    &TrackVehicleInfo_9162E6, &TrackVehicleInfo_916408, &TrackVehicleInfo_91652A, &TrackVehicleInfo_91664C, &TrackVehicleInfo_91676E, &TrackVehicleInfo_916890,
-    &TrackVehicleInfo_9169B2, &TrackVehicleInfo_916AD4, &TrackVehicleInfo_91707E, &TrackVehicleInfo_9172C0, &TrackVehicleInfo_917502, &TrackVehicleInfo_917744,
-    &TrackVehicleInfo_91828E, &TrackVehicleInfo_9183B0, &TrackVehicleInfo_9184D2, &TrackVehicleInfo_9185F4, &TrackVehicleInfo_9194F6, &TrackVehicleInfo_919645,
-    &TrackVehicleInfo_919794, &TrackVehicleInfo_9198E3, &TrackVehicleInfo_919A32, &TrackVehicleInfo_919B81, &TrackVehicleInfo_919CD0, &TrackVehicleInfo_919E1F,
-    &TrackVehicleInfo_918716, &TrackVehicleInfo_91884A, &TrackVehicleInfo_91897E, &TrackVehicleInfo_918AB2, &TrackVehicleInfo_916BF6, &TrackVehicleInfo_916D18,
-    &TrackVehicleInfo_916E3A, &TrackVehicleInfo_916F5C, &TrackVehicleInfo_917986, &TrackVehicleInfo_917BC8, &TrackVehicleInfo_917E0A, &TrackVehicleInfo_91804C,
-    &TrackVehicleInfo_91906E, &TrackVehicleInfo_919190, &TrackVehicleInfo_9192B2, &TrackVehicleInfo_9193D4, &TrackVehicleInfo_91A4AA, &TrackVehicleInfo_91A5F9,
-    &TrackVehicleInfo_91A748, &TrackVehicleInfo_91A897, &TrackVehicleInfo_919F6E, &TrackVehicleInfo_91A0BD, &TrackVehicleInfo_91A20C, &TrackVehicleInfo_91A35B,
-    &TrackVehicleInfo_918BE6, &TrackVehicleInfo_918D08, &TrackVehicleInfo_918E2A, &TrackVehicleInfo_918F4C, &TrackVehicleInfo_91A9E6, &TrackVehicleInfo_91AB2C,
-    &TrackVehicleInfo_91AC72, &TrackVehicleInfo_91ADB8, &TrackVehicleInfo_91AEFE, &TrackVehicleInfo_91B044, &TrackVehicleInfo_91B18A, &TrackVehicleInfo_91B2D0,
-    &TrackVehicleInfo_91B416, &TrackVehicleInfo_91B55C, &TrackVehicleInfo_91B6A2, &TrackVehicleInfo_91B7E8, &TrackVehicleInfo_91B92E, &TrackVehicleInfo_91BA74,
-    &TrackVehicleInfo_91BBBA, &TrackVehicleInfo_91BD00, &TrackVehicleInfo_95787E, &TrackVehicleInfo_9579A0, &TrackVehicleInfo_957AC2, &TrackVehicleInfo_957BE4,
-    &TrackVehicleInfo_957D06, &TrackVehicleInfo_957E28, &TrackVehicleInfo_957F4A, &TrackVehicleInfo_95806C, &TrackVehicleInfo_95818E, &TrackVehicleInfo_9582B0,
-    &TrackVehicleInfo_9583D2, &TrackVehicleInfo_9584F4, &TrackVehicleInfo_958616, &TrackVehicleInfo_958738, &TrackVehicleInfo_95885A, &TrackVehicleInfo_95897C,
-    &TrackVehicleInfo_958A9E, &TrackVehicleInfo_958BC0, &TrackVehicleInfo_958CE2, &TrackVehicleInfo_958E04, &TrackVehicleInfo_958F26, &TrackVehicleInfo_959048,
-    &TrackVehicleInfo_95916A, &TrackVehicleInfo_95928C, &TrackVehicleInfo_9593AE, &TrackVehicleInfo_9594E2, &TrackVehicleInfo_959616, &TrackVehicleInfo_95974A,
-    &TrackVehicleInfo_95987E, &TrackVehicleInfo_9599B2, &TrackVehicleInfo_959AE6, &TrackVehicleInfo_959C1A, &TrackVehicleInfo_95A65E, &TrackVehicleInfo_95A780,
-    &TrackVehicleInfo_95A8A2, &TrackVehicleInfo_95A9C4, &TrackVehicleInfo_95AAE6, &TrackVehicleInfo_95AC08, &TrackVehicleInfo_95AD2A, &TrackVehicleInfo_95AE4C,
-    &TrackVehicleInfo_959D4E, &TrackVehicleInfo_959E70, &TrackVehicleInfo_959F92, &TrackVehicleInfo_95A0B4, &TrackVehicleInfo_95A1D6, &TrackVehicleInfo_95A2F8,
-    &TrackVehicleInfo_95A41A, &TrackVehicleInfo_95A53C, &TrackVehicleInfo_95AF6E, &TrackVehicleInfo_95B090, &TrackVehicleInfo_95B1B2, &TrackVehicleInfo_95B2D4,
-    &TrackVehicleInfo_95B3F6, &TrackVehicleInfo_95B518, &TrackVehicleInfo_95B63A, &TrackVehicleInfo_95B75C, &TrackVehicleInfo_91BE46, &TrackVehicleInfo_91C001,
-    &TrackVehicleInfo_91C1BC, &TrackVehicleInfo_91C377,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListChairliftGoingOut[] = {
+    TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04,
+    TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48,
+    TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CFB6E, TrackVehicleInfo_8CFC90,
+    TrackVehicleInfo_8CFDB2, TrackVehicleInfo_8CFED4, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8CE906, TrackVehicleInfo_8CEA28, TrackVehicleInfo_8CEB4A, TrackVehicleInfo_8CEC6C, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_8CED8E, TrackVehicleInfo_8CEEC2, TrackVehicleInfo_8CEFF6, TrackVehicleInfo_8CF12A, TrackVehicleInfo_8CFFF6, TrackVehicleInfo_8D0118,
+    TrackVehicleInfo_8D023A, TrackVehicleInfo_8D035C, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_8CF6E6, TrackVehicleInfo_8CF808, TrackVehicleInfo_8CF92A, TrackVehicleInfo_8CFA4C, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_8CF25E, TrackVehicleInfo_8CF380, TrackVehicleInfo_8CF4A2, TrackVehicleInfo_8CF5C4, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_8FD922, TrackVehicleInfo_8FD975, TrackVehicleInfo_8FD9D1, TrackVehicleInfo_8FDA24,
+    TrackVehicleInfo_8FDA6E, TrackVehicleInfo_8FDBB4, TrackVehicleInfo_8FDD03, TrackVehicleInfo_8FDE5B, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DB70E, TrackVehicleInfo_8DBA70, TrackVehicleInfo_8DBDD2, TrackVehicleInfo_8DC134, TrackVehicleInfo_8DC496, TrackVehicleInfo_8DC7F8,
+    TrackVehicleInfo_8DCB5A, TrackVehicleInfo_8DCEBC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E7AFA, TrackVehicleInfo_8E80A5, TrackVehicleInfo_8E8650, TrackVehicleInfo_8E8BFB, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EC3AA, TrackVehicleInfo_8EC715, TrackVehicleInfo_8ECA80, TrackVehicleInfo_8ECDEB, TrackVehicleInfo_8ED156, TrackVehicleInfo_8ED4C1,
+    TrackVehicleInfo_8ED82C, TrackVehicleInfo_8EDB97, TrackVehicleInfo_8C6C32, TrackVehicleInfo_8C6D78, TrackVehicleInfo_8C6EBE, TrackVehicleInfo_8C7004,
+    TrackVehicleInfo_8C714A, TrackVehicleInfo_8C7290, TrackVehicleInfo_8C73D6, TrackVehicleInfo_8C751C, TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8,
+    TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_8C7B7A, TrackVehicleInfo_8C7CC0, TrackVehicleInfo_8C7E06, TrackVehicleInfo_8C7F4C,
+    TrackVehicleInfo_8EFA5A, TrackVehicleInfo_8EFDAA, TrackVehicleInfo_8F00FA, TrackVehicleInfo_8F044A, TrackVehicleInfo_8F079A, TrackVehicleInfo_8F08BC,
+    TrackVehicleInfo_8F09DE, TrackVehicleInfo_8F0B00, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554,
+    TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80,
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5,
+    TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408,
+    TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4, TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C,
+    TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18,
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01,
+    TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890,
+    TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496, TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D,
+    TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94,
+    TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923, TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8,
+    TrackVehicleInfo_8F8C82, TrackVehicleInfo_8F9143, TrackVehicleInfo_8F9616, TrackVehicleInfo_8F9AE9, TrackVehicleInfo_8F9FAA, TrackVehicleInfo_8FA46B,
+    TrackVehicleInfo_8FA93E, TrackVehicleInfo_8FAE11, TrackVehicleInfo_8FB2D2, TrackVehicleInfo_8FB793, TrackVehicleInfo_8FBC66, TrackVehicleInfo_8FC139,
+    TrackVehicleInfo_8FC5FA, TrackVehicleInfo_8FCABB, TrackVehicleInfo_8FCF8E, TrackVehicleInfo_8FD461, TrackVehicleInfo_8F0C22, TrackVehicleInfo_8F141F,
+    TrackVehicleInfo_8F1C2E, TrackVehicleInfo_8F243D, TrackVehicleInfo_8F2C3A, TrackVehicleInfo_8F3437, TrackVehicleInfo_8F3C46, TrackVehicleInfo_8F4455,
+    TrackVehicleInfo_8F4C52, TrackVehicleInfo_8F544F, TrackVehicleInfo_8F5C5E, TrackVehicleInfo_8F646D, TrackVehicleInfo_8F6C6A, TrackVehicleInfo_8F7467,
+    TrackVehicleInfo_8F7C76, TrackVehicleInfo_8F8485, TrackVehicleInfo_8E402E, TrackVehicleInfo_8E4270, TrackVehicleInfo_8E44B2, TrackVehicleInfo_8E46F4,
+    TrackVehicleInfo_8E4936, TrackVehicleInfo_8E4B78, TrackVehicleInfo_8E4DBA, TrackVehicleInfo_8E4FFC, TrackVehicleInfo_8E523E, TrackVehicleInfo_8E5480,
+    TrackVehicleInfo_8E56C2, TrackVehicleInfo_8E5904, TrackVehicleInfo_8E5B46, TrackVehicleInfo_8E5D88, TrackVehicleInfo_8E5FCA, TrackVehicleInfo_8E620C,
+    TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04,
+    TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_8B0EB2, TrackVehicleInfo_8B12B6, TrackVehicleInfo_8B16C3, TrackVehicleInfo_8B1AC7, TrackVehicleInfo_8B1EC2, TrackVehicleInfo_8B22BD,
+    TrackVehicleInfo_8B26C1, TrackVehicleInfo_8B2ACE, TrackVehicleInfo_8B2ED2, TrackVehicleInfo_8B32D6, TrackVehicleInfo_8B36E3, TrackVehicleInfo_8B3AE7,
+    TrackVehicleInfo_8B3EE2, TrackVehicleInfo_8B42DD, TrackVehicleInfo_8B46E1, TrackVehicleInfo_8B4AEE, TrackVehicleInfo_8B4EF2, TrackVehicleInfo_8B52F6,
+    TrackVehicleInfo_8B5703, TrackVehicleInfo_8B5B07, TrackVehicleInfo_8B5F02, TrackVehicleInfo_8B62FD, TrackVehicleInfo_8B6701, TrackVehicleInfo_8B6B0E,
+    TrackVehicleInfo_8B6F12, TrackVehicleInfo_8B7316, TrackVehicleInfo_8B7723, TrackVehicleInfo_8B7B27, TrackVehicleInfo_8B7F22, TrackVehicleInfo_8B831D,
+    TrackVehicleInfo_8B8721, TrackVehicleInfo_8B8B2E, TrackVehicleInfo_968C6E, TrackVehicleInfo_968D90, TrackVehicleInfo_968EB2, TrackVehicleInfo_968FD4,
+    TrackVehicleInfo_96957E, TrackVehicleInfo_9696A0, TrackVehicleInfo_9697C2, TrackVehicleInfo_9698E4, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9048E8, TrackVehicleInfo_904A0A, TrackVehicleInfo_904B2C, TrackVehicleInfo_904C4E,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9690F6, TrackVehicleInfo_969218,
+    TrackVehicleInfo_96933A, TrackVehicleInfo_96945C, TrackVehicleInfo_969A06, TrackVehicleInfo_969B28, TrackVehicleInfo_969C4A, TrackVehicleInfo_969D6C,
+    TrackVehicleInfo_904D72, TrackVehicleInfo_905314, TrackVehicleInfo_9058B6, TrackVehicleInfo_905E58, TrackVehicleInfo_96D4AE, TrackVehicleInfo_96D9A5,
+    TrackVehicleInfo_96DE9C, TrackVehicleInfo_96E393, TrackVehicleInfo_96E88A, TrackVehicleInfo_96ED81, TrackVehicleInfo_96F278, TrackVehicleInfo_96F76F,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_971042, TrackVehicleInfo_971539,
+    TrackVehicleInfo_971A30, TrackVehicleInfo_971F27, TrackVehicleInfo_96FC66, TrackVehicleInfo_97015D, TrackVehicleInfo_970654, TrackVehicleInfo_970B4B,
+    TrackVehicleInfo_97241E, TrackVehicleInfo_9729ED, TrackVehicleInfo_972FBC, TrackVehicleInfo_97358B, TrackVehicleInfo_9063FA, TrackVehicleInfo_906EAC,
+    TrackVehicleInfo_90795E, TrackVehicleInfo_908410, TrackVehicleInfo_90B98A, TrackVehicleInfo_90BC5C, TrackVehicleInfo_90BF2E, TrackVehicleInfo_90C200,
+    TrackVehicleInfo_90E02A, TrackVehicleInfo_90E14C, TrackVehicleInfo_90E26E, TrackVehicleInfo_90E390, TrackVehicleInfo_90E4B2, TrackVehicleInfo_90E5D4,
+    TrackVehicleInfo_90E6F6, TrackVehicleInfo_90E818, TrackVehicleInfo_90E93A, TrackVehicleInfo_90EB34, TrackVehicleInfo_90ED2E, TrackVehicleInfo_90EF28,
+    TrackVehicleInfo_9100F2, TrackVehicleInfo_9102EC, TrackVehicleInfo_9104E6, TrackVehicleInfo_9106E0, TrackVehicleInfo_90F122, TrackVehicleInfo_90F31C,
+    TrackVehicleInfo_90F516, TrackVehicleInfo_90F710, TrackVehicleInfo_90F90A, TrackVehicleInfo_90FB04, TrackVehicleInfo_90FCFE, TrackVehicleInfo_90FEF8,
+    TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8, TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_9108DA, TrackVehicleInfo_910BA3,
+    TrackVehicleInfo_910E75, TrackVehicleInfo_911147, TrackVehicleInfo_911F58, TrackVehicleInfo_91222A, TrackVehicleInfo_9124FC, TrackVehicleInfo_9127CE,
+    TrackVehicleInfo_911419, TrackVehicleInfo_9116E2, TrackVehicleInfo_9119B4, TrackVehicleInfo_911C86, TrackVehicleInfo_912AA0, TrackVehicleInfo_912D69,
+    TrackVehicleInfo_91303B, TrackVehicleInfo_91330D, TrackVehicleInfo_9135DF, TrackVehicleInfo_9138A8, TrackVehicleInfo_913B7A, TrackVehicleInfo_913E4C,
+    TrackVehicleInfo_914C5D, TrackVehicleInfo_914F2F, TrackVehicleInfo_915201, TrackVehicleInfo_9154D3, TrackVehicleInfo_91411E, TrackVehicleInfo_9143E7,
+    TrackVehicleInfo_9146B9, TrackVehicleInfo_91498B, TrackVehicleInfo_9157A5, TrackVehicleInfo_915A6E, TrackVehicleInfo_915D40, TrackVehicleInfo_916012,
+    TrackVehicleInfo_9162E6, TrackVehicleInfo_916408, TrackVehicleInfo_91652A, TrackVehicleInfo_91664C, TrackVehicleInfo_91676E, TrackVehicleInfo_916890,
+    TrackVehicleInfo_9169B2, TrackVehicleInfo_916AD4, TrackVehicleInfo_91707E, TrackVehicleInfo_9172C0, TrackVehicleInfo_917502, TrackVehicleInfo_917744,
+    TrackVehicleInfo_91828E, TrackVehicleInfo_9183B0, TrackVehicleInfo_9184D2, TrackVehicleInfo_9185F4, TrackVehicleInfo_9194F6, TrackVehicleInfo_919645,
+    TrackVehicleInfo_919794, TrackVehicleInfo_9198E3, TrackVehicleInfo_919A32, TrackVehicleInfo_919B81, TrackVehicleInfo_919CD0, TrackVehicleInfo_919E1F,
+    TrackVehicleInfo_918716, TrackVehicleInfo_91884A, TrackVehicleInfo_91897E, TrackVehicleInfo_918AB2, TrackVehicleInfo_916BF6, TrackVehicleInfo_916D18,
+    TrackVehicleInfo_916E3A, TrackVehicleInfo_916F5C, TrackVehicleInfo_917986, TrackVehicleInfo_917BC8, TrackVehicleInfo_917E0A, TrackVehicleInfo_91804C,
+    TrackVehicleInfo_91906E, TrackVehicleInfo_919190, TrackVehicleInfo_9192B2, TrackVehicleInfo_9193D4, TrackVehicleInfo_91A4AA, TrackVehicleInfo_91A5F9,
+    TrackVehicleInfo_91A748, TrackVehicleInfo_91A897, TrackVehicleInfo_919F6E, TrackVehicleInfo_91A0BD, TrackVehicleInfo_91A20C, TrackVehicleInfo_91A35B,
+    TrackVehicleInfo_918BE6, TrackVehicleInfo_918D08, TrackVehicleInfo_918E2A, TrackVehicleInfo_918F4C, TrackVehicleInfo_91A9E6, TrackVehicleInfo_91AB2C,
+    TrackVehicleInfo_91AC72, TrackVehicleInfo_91ADB8, TrackVehicleInfo_91AEFE, TrackVehicleInfo_91B044, TrackVehicleInfo_91B18A, TrackVehicleInfo_91B2D0,
+    TrackVehicleInfo_91B416, TrackVehicleInfo_91B55C, TrackVehicleInfo_91B6A2, TrackVehicleInfo_91B7E8, TrackVehicleInfo_91B92E, TrackVehicleInfo_91BA74,
+    TrackVehicleInfo_91BBBA, TrackVehicleInfo_91BD00, TrackVehicleInfo_95787E, TrackVehicleInfo_9579A0, TrackVehicleInfo_957AC2, TrackVehicleInfo_957BE4,
+    TrackVehicleInfo_957D06, TrackVehicleInfo_957E28, TrackVehicleInfo_957F4A, TrackVehicleInfo_95806C, TrackVehicleInfo_95818E, TrackVehicleInfo_9582B0,
+    TrackVehicleInfo_9583D2, TrackVehicleInfo_9584F4, TrackVehicleInfo_958616, TrackVehicleInfo_958738, TrackVehicleInfo_95885A, TrackVehicleInfo_95897C,
+    TrackVehicleInfo_958A9E, TrackVehicleInfo_958BC0, TrackVehicleInfo_958CE2, TrackVehicleInfo_958E04, TrackVehicleInfo_958F26, TrackVehicleInfo_959048,
+    TrackVehicleInfo_95916A, TrackVehicleInfo_95928C, TrackVehicleInfo_9593AE, TrackVehicleInfo_9594E2, TrackVehicleInfo_959616, TrackVehicleInfo_95974A,
+    TrackVehicleInfo_95987E, TrackVehicleInfo_9599B2, TrackVehicleInfo_959AE6, TrackVehicleInfo_959C1A, TrackVehicleInfo_95A65E, TrackVehicleInfo_95A780,
+    TrackVehicleInfo_95A8A2, TrackVehicleInfo_95A9C4, TrackVehicleInfo_95AAE6, TrackVehicleInfo_95AC08, TrackVehicleInfo_95AD2A, TrackVehicleInfo_95AE4C,
+    TrackVehicleInfo_959D4E, TrackVehicleInfo_959E70, TrackVehicleInfo_959F92, TrackVehicleInfo_95A0B4, TrackVehicleInfo_95A1D6, TrackVehicleInfo_95A2F8,
+    TrackVehicleInfo_95A41A, TrackVehicleInfo_95A53C, TrackVehicleInfo_95AF6E, TrackVehicleInfo_95B090, TrackVehicleInfo_95B1B2, TrackVehicleInfo_95B2D4,
+    TrackVehicleInfo_95B3F6, TrackVehicleInfo_95B518, TrackVehicleInfo_95B63A, TrackVehicleInfo_95B75C, TrackVehicleInfo_91BE46, TrackVehicleInfo_91C001,
+    TrackVehicleInfo_91C1BC, TrackVehicleInfo_91C377,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListChairliftGoingBack[] = {
-    &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48,
-    &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04,
-    &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8D023A, &TrackVehicleInfo_8D035C,
-    &TrackVehicleInfo_8CFFF6, &TrackVehicleInfo_8D0118, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8CF4A2, &TrackVehicleInfo_8CF5C4, &TrackVehicleInfo_8CF25E, &TrackVehicleInfo_8CF380, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_8CF92A, &TrackVehicleInfo_8CFA4C, &TrackVehicleInfo_8CF6E6, &TrackVehicleInfo_8CF808, &TrackVehicleInfo_8CFDB2, &TrackVehicleInfo_8CFED4,
-    &TrackVehicleInfo_8CFB6E, &TrackVehicleInfo_8CFC90, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_8CEFF6, &TrackVehicleInfo_8CF12A, &TrackVehicleInfo_8CED8E, &TrackVehicleInfo_8CEEC2, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_8CEB4A, &TrackVehicleInfo_8CEC6C, &TrackVehicleInfo_8CE906, &TrackVehicleInfo_8CEA28, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_8FDBB4, &TrackVehicleInfo_8FDD03, &TrackVehicleInfo_8FDE5B, &TrackVehicleInfo_8FDA6E,
-    &TrackVehicleInfo_8FDA24, &TrackVehicleInfo_8FD922, &TrackVehicleInfo_8FD975, &TrackVehicleInfo_8FD9D1, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DB70E, &TrackVehicleInfo_8DBA70, &TrackVehicleInfo_8DBDD2, &TrackVehicleInfo_8DC134, &TrackVehicleInfo_8DC496, &TrackVehicleInfo_8DC7F8,
-    &TrackVehicleInfo_8DCB5A, &TrackVehicleInfo_8DCEBC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E7AFA, &TrackVehicleInfo_8E80A5, &TrackVehicleInfo_8E8650, &TrackVehicleInfo_8E8BFB, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EC3AA, &TrackVehicleInfo_8EC715, &TrackVehicleInfo_8ECA80, &TrackVehicleInfo_8ECDEB, &TrackVehicleInfo_8ED156, &TrackVehicleInfo_8ED4C1,
-    &TrackVehicleInfo_8ED82C, &TrackVehicleInfo_8EDB97, &TrackVehicleInfo_8C6C32, &TrackVehicleInfo_8C6D78, &TrackVehicleInfo_8C6EBE, &TrackVehicleInfo_8C7004,
-    &TrackVehicleInfo_8C714A, &TrackVehicleInfo_8C7290, &TrackVehicleInfo_8C73D6, &TrackVehicleInfo_8C751C, &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8,
-    &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_8C7B7A, &TrackVehicleInfo_8C7CC0, &TrackVehicleInfo_8C7E06, &TrackVehicleInfo_8C7F4C,
-    &TrackVehicleInfo_8EFA5A, &TrackVehicleInfo_8EFDAA, &TrackVehicleInfo_8F00FA, &TrackVehicleInfo_8F044A, &TrackVehicleInfo_8F079A, &TrackVehicleInfo_8F08BC,
-    &TrackVehicleInfo_8F09DE, &TrackVehicleInfo_8F0B00, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554,
-    &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80,
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5,
-    &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408,
-    &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4, &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C,
-    &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18,
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01,
-    &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890,
-    &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496, &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D,
-    &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94,
-    &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923, &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8,
-    &TrackVehicleInfo_8F8C82, &TrackVehicleInfo_8F9143, &TrackVehicleInfo_8F9616, &TrackVehicleInfo_8F9AE9, &TrackVehicleInfo_8F9FAA, &TrackVehicleInfo_8FA46B,
-    &TrackVehicleInfo_8FA93E, &TrackVehicleInfo_8FAE11, &TrackVehicleInfo_8FB2D2, &TrackVehicleInfo_8FB793, &TrackVehicleInfo_8FBC66, &TrackVehicleInfo_8FC139,
-    &TrackVehicleInfo_8FC5FA, &TrackVehicleInfo_8FCABB, &TrackVehicleInfo_8FCF8E, &TrackVehicleInfo_8FD461, &TrackVehicleInfo_8F0C22, &TrackVehicleInfo_8F141F,
-    &TrackVehicleInfo_8F1C2E, &TrackVehicleInfo_8F243D, &TrackVehicleInfo_8F2C3A, &TrackVehicleInfo_8F3437, &TrackVehicleInfo_8F3C46, &TrackVehicleInfo_8F4455,
-    &TrackVehicleInfo_8F4C52, &TrackVehicleInfo_8F544F, &TrackVehicleInfo_8F5C5E, &TrackVehicleInfo_8F646D, &TrackVehicleInfo_8F6C6A, &TrackVehicleInfo_8F7467,
-    &TrackVehicleInfo_8F7C76, &TrackVehicleInfo_8F8485, &TrackVehicleInfo_8E402E, &TrackVehicleInfo_8E4270, &TrackVehicleInfo_8E44B2, &TrackVehicleInfo_8E46F4,
-    &TrackVehicleInfo_8E4936, &TrackVehicleInfo_8E4B78, &TrackVehicleInfo_8E4DBA, &TrackVehicleInfo_8E4FFC, &TrackVehicleInfo_8E523E, &TrackVehicleInfo_8E5480,
-    &TrackVehicleInfo_8E56C2, &TrackVehicleInfo_8E5904, &TrackVehicleInfo_8E5B46, &TrackVehicleInfo_8E5D88, &TrackVehicleInfo_8E5FCA, &TrackVehicleInfo_8E620C,
-    &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48, &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04, &TrackVehicleInfo_8CDE26, &TrackVehicleInfo_8CDF48,
-    &TrackVehicleInfo_8CDBE2, &TrackVehicleInfo_8CDD04,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListChairliftGoingBack[] = {
+    TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48,
+    TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04,
+    TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8D023A, TrackVehicleInfo_8D035C,
+    TrackVehicleInfo_8CFFF6, TrackVehicleInfo_8D0118, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8CF4A2, TrackVehicleInfo_8CF5C4, TrackVehicleInfo_8CF25E, TrackVehicleInfo_8CF380, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_8CF92A, TrackVehicleInfo_8CFA4C, TrackVehicleInfo_8CF6E6, TrackVehicleInfo_8CF808, TrackVehicleInfo_8CFDB2, TrackVehicleInfo_8CFED4,
+    TrackVehicleInfo_8CFB6E, TrackVehicleInfo_8CFC90, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_8CEFF6, TrackVehicleInfo_8CF12A, TrackVehicleInfo_8CED8E, TrackVehicleInfo_8CEEC2, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_8CEB4A, TrackVehicleInfo_8CEC6C, TrackVehicleInfo_8CE906, TrackVehicleInfo_8CEA28, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_8FDBB4, TrackVehicleInfo_8FDD03, TrackVehicleInfo_8FDE5B, TrackVehicleInfo_8FDA6E,
+    TrackVehicleInfo_8FDA24, TrackVehicleInfo_8FD922, TrackVehicleInfo_8FD975, TrackVehicleInfo_8FD9D1, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DB70E, TrackVehicleInfo_8DBA70, TrackVehicleInfo_8DBDD2, TrackVehicleInfo_8DC134, TrackVehicleInfo_8DC496, TrackVehicleInfo_8DC7F8,
+    TrackVehicleInfo_8DCB5A, TrackVehicleInfo_8DCEBC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E7AFA, TrackVehicleInfo_8E80A5, TrackVehicleInfo_8E8650, TrackVehicleInfo_8E8BFB, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EC3AA, TrackVehicleInfo_8EC715, TrackVehicleInfo_8ECA80, TrackVehicleInfo_8ECDEB, TrackVehicleInfo_8ED156, TrackVehicleInfo_8ED4C1,
+    TrackVehicleInfo_8ED82C, TrackVehicleInfo_8EDB97, TrackVehicleInfo_8C6C32, TrackVehicleInfo_8C6D78, TrackVehicleInfo_8C6EBE, TrackVehicleInfo_8C7004,
+    TrackVehicleInfo_8C714A, TrackVehicleInfo_8C7290, TrackVehicleInfo_8C73D6, TrackVehicleInfo_8C751C, TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8,
+    TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_8C7B7A, TrackVehicleInfo_8C7CC0, TrackVehicleInfo_8C7E06, TrackVehicleInfo_8C7F4C,
+    TrackVehicleInfo_8EFA5A, TrackVehicleInfo_8EFDAA, TrackVehicleInfo_8F00FA, TrackVehicleInfo_8F044A, TrackVehicleInfo_8F079A, TrackVehicleInfo_8F08BC,
+    TrackVehicleInfo_8F09DE, TrackVehicleInfo_8F0B00, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554,
+    TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80,
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5,
+    TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408,
+    TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4, TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C,
+    TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18,
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01,
+    TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890,
+    TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496, TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D,
+    TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94,
+    TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923, TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8,
+    TrackVehicleInfo_8F8C82, TrackVehicleInfo_8F9143, TrackVehicleInfo_8F9616, TrackVehicleInfo_8F9AE9, TrackVehicleInfo_8F9FAA, TrackVehicleInfo_8FA46B,
+    TrackVehicleInfo_8FA93E, TrackVehicleInfo_8FAE11, TrackVehicleInfo_8FB2D2, TrackVehicleInfo_8FB793, TrackVehicleInfo_8FBC66, TrackVehicleInfo_8FC139,
+    TrackVehicleInfo_8FC5FA, TrackVehicleInfo_8FCABB, TrackVehicleInfo_8FCF8E, TrackVehicleInfo_8FD461, TrackVehicleInfo_8F0C22, TrackVehicleInfo_8F141F,
+    TrackVehicleInfo_8F1C2E, TrackVehicleInfo_8F243D, TrackVehicleInfo_8F2C3A, TrackVehicleInfo_8F3437, TrackVehicleInfo_8F3C46, TrackVehicleInfo_8F4455,
+    TrackVehicleInfo_8F4C52, TrackVehicleInfo_8F544F, TrackVehicleInfo_8F5C5E, TrackVehicleInfo_8F646D, TrackVehicleInfo_8F6C6A, TrackVehicleInfo_8F7467,
+    TrackVehicleInfo_8F7C76, TrackVehicleInfo_8F8485, TrackVehicleInfo_8E402E, TrackVehicleInfo_8E4270, TrackVehicleInfo_8E44B2, TrackVehicleInfo_8E46F4,
+    TrackVehicleInfo_8E4936, TrackVehicleInfo_8E4B78, TrackVehicleInfo_8E4DBA, TrackVehicleInfo_8E4FFC, TrackVehicleInfo_8E523E, TrackVehicleInfo_8E5480,
+    TrackVehicleInfo_8E56C2, TrackVehicleInfo_8E5904, TrackVehicleInfo_8E5B46, TrackVehicleInfo_8E5D88, TrackVehicleInfo_8E5FCA, TrackVehicleInfo_8E620C,
+    TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48, TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04, TrackVehicleInfo_8CDE26, TrackVehicleInfo_8CDF48,
+    TrackVehicleInfo_8CDBE2, TrackVehicleInfo_8CDD04,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListChairliftEndBullwheel[] = {
-    &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291,
-    &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF,
-    &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C,
-    &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408, &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4,
-    &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_8E39EE, &TrackVehicleInfo_8E3AB6, &TrackVehicleInfo_8E3B87, &TrackVehicleInfo_8E3C4F,
-    &TrackVehicleInfo_8E3D0E, &TrackVehicleInfo_8E3DCD, &TrackVehicleInfo_8E3E95, &TrackVehicleInfo_8E3F66, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DB70E, &TrackVehicleInfo_8DBA70, &TrackVehicleInfo_8DBDD2, &TrackVehicleInfo_8DC134, &TrackVehicleInfo_8DC496, &TrackVehicleInfo_8DC7F8,
-    &TrackVehicleInfo_8DCB5A, &TrackVehicleInfo_8DCEBC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E7AFA, &TrackVehicleInfo_8E80A5, &TrackVehicleInfo_8E8650, &TrackVehicleInfo_8E8BFB, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EC3AA, &TrackVehicleInfo_8EC715, &TrackVehicleInfo_8ECA80, &TrackVehicleInfo_8ECDEB, &TrackVehicleInfo_8ED156, &TrackVehicleInfo_8ED4C1,
-    &TrackVehicleInfo_8ED82C, &TrackVehicleInfo_8EDB97, &TrackVehicleInfo_8C6C32, &TrackVehicleInfo_8C6D78, &TrackVehicleInfo_8C6EBE, &TrackVehicleInfo_8C7004,
-    &TrackVehicleInfo_8C714A, &TrackVehicleInfo_8C7290, &TrackVehicleInfo_8C73D6, &TrackVehicleInfo_8C751C, &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8,
-    &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_8C7B7A, &TrackVehicleInfo_8C7CC0, &TrackVehicleInfo_8C7E06, &TrackVehicleInfo_8C7F4C,
-    &TrackVehicleInfo_8EFA5A, &TrackVehicleInfo_8EFDAA, &TrackVehicleInfo_8F00FA, &TrackVehicleInfo_8F044A, &TrackVehicleInfo_8F079A, &TrackVehicleInfo_8F08BC,
-    &TrackVehicleInfo_8F09DE, &TrackVehicleInfo_8F0B00, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554,
-    &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80,
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5,
-    &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408,
-    &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4, &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C,
-    &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18,
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01,
-    &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890,
-    &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496, &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D,
-    &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94,
-    &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923, &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8,
-    &TrackVehicleInfo_8F8C82, &TrackVehicleInfo_8F9143, &TrackVehicleInfo_8F9616, &TrackVehicleInfo_8F9AE9, &TrackVehicleInfo_8F9FAA, &TrackVehicleInfo_8FA46B,
-    &TrackVehicleInfo_8FA93E, &TrackVehicleInfo_8FAE11, &TrackVehicleInfo_8FB2D2, &TrackVehicleInfo_8FB793, &TrackVehicleInfo_8FBC66, &TrackVehicleInfo_8FC139,
-    &TrackVehicleInfo_8FC5FA, &TrackVehicleInfo_8FCABB, &TrackVehicleInfo_8FCF8E, &TrackVehicleInfo_8FD461, &TrackVehicleInfo_8F0C22, &TrackVehicleInfo_8F141F,
-    &TrackVehicleInfo_8F1C2E, &TrackVehicleInfo_8F243D, &TrackVehicleInfo_8F2C3A, &TrackVehicleInfo_8F3437, &TrackVehicleInfo_8F3C46, &TrackVehicleInfo_8F4455,
-    &TrackVehicleInfo_8F4C52, &TrackVehicleInfo_8F544F, &TrackVehicleInfo_8F5C5E, &TrackVehicleInfo_8F646D, &TrackVehicleInfo_8F6C6A, &TrackVehicleInfo_8F7467,
-    &TrackVehicleInfo_8F7C76, &TrackVehicleInfo_8F8485, &TrackVehicleInfo_8E402E, &TrackVehicleInfo_8E4270, &TrackVehicleInfo_8E44B2, &TrackVehicleInfo_8E46F4,
-    &TrackVehicleInfo_8E4936, &TrackVehicleInfo_8E4B78, &TrackVehicleInfo_8E4DBA, &TrackVehicleInfo_8E4FFC, &TrackVehicleInfo_8E523E, &TrackVehicleInfo_8E5480,
-    &TrackVehicleInfo_8E56C2, &TrackVehicleInfo_8E5904, &TrackVehicleInfo_8E5B46, &TrackVehicleInfo_8E5D88, &TrackVehicleInfo_8E5FCA, &TrackVehicleInfo_8E620C,
-    &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291,
-    &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListChairliftEndBullwheel[] = {
+    TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291,
+    TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF,
+    TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C,
+    TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408, TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4,
+    TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_8E39EE, TrackVehicleInfo_8E3AB6, TrackVehicleInfo_8E3B87, TrackVehicleInfo_8E3C4F,
+    TrackVehicleInfo_8E3D0E, TrackVehicleInfo_8E3DCD, TrackVehicleInfo_8E3E95, TrackVehicleInfo_8E3F66, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DB70E, TrackVehicleInfo_8DBA70, TrackVehicleInfo_8DBDD2, TrackVehicleInfo_8DC134, TrackVehicleInfo_8DC496, TrackVehicleInfo_8DC7F8,
+    TrackVehicleInfo_8DCB5A, TrackVehicleInfo_8DCEBC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E7AFA, TrackVehicleInfo_8E80A5, TrackVehicleInfo_8E8650, TrackVehicleInfo_8E8BFB, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EC3AA, TrackVehicleInfo_8EC715, TrackVehicleInfo_8ECA80, TrackVehicleInfo_8ECDEB, TrackVehicleInfo_8ED156, TrackVehicleInfo_8ED4C1,
+    TrackVehicleInfo_8ED82C, TrackVehicleInfo_8EDB97, TrackVehicleInfo_8C6C32, TrackVehicleInfo_8C6D78, TrackVehicleInfo_8C6EBE, TrackVehicleInfo_8C7004,
+    TrackVehicleInfo_8C714A, TrackVehicleInfo_8C7290, TrackVehicleInfo_8C73D6, TrackVehicleInfo_8C751C, TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8,
+    TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_8C7B7A, TrackVehicleInfo_8C7CC0, TrackVehicleInfo_8C7E06, TrackVehicleInfo_8C7F4C,
+    TrackVehicleInfo_8EFA5A, TrackVehicleInfo_8EFDAA, TrackVehicleInfo_8F00FA, TrackVehicleInfo_8F044A, TrackVehicleInfo_8F079A, TrackVehicleInfo_8F08BC,
+    TrackVehicleInfo_8F09DE, TrackVehicleInfo_8F0B00, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554,
+    TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80,
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5,
+    TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408,
+    TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4, TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C,
+    TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18,
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01,
+    TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890,
+    TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496, TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D,
+    TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94,
+    TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923, TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8,
+    TrackVehicleInfo_8F8C82, TrackVehicleInfo_8F9143, TrackVehicleInfo_8F9616, TrackVehicleInfo_8F9AE9, TrackVehicleInfo_8F9FAA, TrackVehicleInfo_8FA46B,
+    TrackVehicleInfo_8FA93E, TrackVehicleInfo_8FAE11, TrackVehicleInfo_8FB2D2, TrackVehicleInfo_8FB793, TrackVehicleInfo_8FBC66, TrackVehicleInfo_8FC139,
+    TrackVehicleInfo_8FC5FA, TrackVehicleInfo_8FCABB, TrackVehicleInfo_8FCF8E, TrackVehicleInfo_8FD461, TrackVehicleInfo_8F0C22, TrackVehicleInfo_8F141F,
+    TrackVehicleInfo_8F1C2E, TrackVehicleInfo_8F243D, TrackVehicleInfo_8F2C3A, TrackVehicleInfo_8F3437, TrackVehicleInfo_8F3C46, TrackVehicleInfo_8F4455,
+    TrackVehicleInfo_8F4C52, TrackVehicleInfo_8F544F, TrackVehicleInfo_8F5C5E, TrackVehicleInfo_8F646D, TrackVehicleInfo_8F6C6A, TrackVehicleInfo_8F7467,
+    TrackVehicleInfo_8F7C76, TrackVehicleInfo_8F8485, TrackVehicleInfo_8E402E, TrackVehicleInfo_8E4270, TrackVehicleInfo_8E44B2, TrackVehicleInfo_8E46F4,
+    TrackVehicleInfo_8E4936, TrackVehicleInfo_8E4B78, TrackVehicleInfo_8E4DBA, TrackVehicleInfo_8E4FFC, TrackVehicleInfo_8E523E, TrackVehicleInfo_8E5480,
+    TrackVehicleInfo_8E56C2, TrackVehicleInfo_8E5904, TrackVehicleInfo_8E5B46, TrackVehicleInfo_8E5D88, TrackVehicleInfo_8E5FCA, TrackVehicleInfo_8E620C,
+    TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291,
+    TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListChairliftStartBullwheel[] = {
-    &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF,
-    &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291,
-    &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C,
-    &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408, &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4,
-    &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_8E39EE, &TrackVehicleInfo_8E3AB6, &TrackVehicleInfo_8E3B87, &TrackVehicleInfo_8E3C4F,
-    &TrackVehicleInfo_8E3D0E, &TrackVehicleInfo_8E3DCD, &TrackVehicleInfo_8E3E95, &TrackVehicleInfo_8E3F66, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DB70E, &TrackVehicleInfo_8DBA70, &TrackVehicleInfo_8DBDD2, &TrackVehicleInfo_8DC134, &TrackVehicleInfo_8DC496, &TrackVehicleInfo_8DC7F8,
-    &TrackVehicleInfo_8DCB5A, &TrackVehicleInfo_8DCEBC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E7AFA, &TrackVehicleInfo_8E80A5, &TrackVehicleInfo_8E8650, &TrackVehicleInfo_8E8BFB, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EC3AA, &TrackVehicleInfo_8EC715, &TrackVehicleInfo_8ECA80, &TrackVehicleInfo_8ECDEB, &TrackVehicleInfo_8ED156, &TrackVehicleInfo_8ED4C1,
-    &TrackVehicleInfo_8ED82C, &TrackVehicleInfo_8EDB97, &TrackVehicleInfo_8C6C32, &TrackVehicleInfo_8C6D78, &TrackVehicleInfo_8C6EBE, &TrackVehicleInfo_8C7004,
-    &TrackVehicleInfo_8C714A, &TrackVehicleInfo_8C7290, &TrackVehicleInfo_8C73D6, &TrackVehicleInfo_8C751C, &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8,
-    &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_8C7B7A, &TrackVehicleInfo_8C7CC0, &TrackVehicleInfo_8C7E06, &TrackVehicleInfo_8C7F4C,
-    &TrackVehicleInfo_8EFA5A, &TrackVehicleInfo_8EFDAA, &TrackVehicleInfo_8F00FA, &TrackVehicleInfo_8F044A, &TrackVehicleInfo_8F079A, &TrackVehicleInfo_8F08BC,
-    &TrackVehicleInfo_8F09DE, &TrackVehicleInfo_8F0B00, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554,
-    &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80,
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5,
-    &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408,
-    &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4, &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C,
-    &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18,
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01,
-    &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890,
-    &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496, &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D,
-    &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94,
-    &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923, &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8,
-    &TrackVehicleInfo_8F8C82, &TrackVehicleInfo_8F9143, &TrackVehicleInfo_8F9616, &TrackVehicleInfo_8F9AE9, &TrackVehicleInfo_8F9FAA, &TrackVehicleInfo_8FA46B,
-    &TrackVehicleInfo_8FA93E, &TrackVehicleInfo_8FAE11, &TrackVehicleInfo_8FB2D2, &TrackVehicleInfo_8FB793, &TrackVehicleInfo_8FBC66, &TrackVehicleInfo_8FC139,
-    &TrackVehicleInfo_8FC5FA, &TrackVehicleInfo_8FCABB, &TrackVehicleInfo_8FCF8E, &TrackVehicleInfo_8FD461, &TrackVehicleInfo_8F0C22, &TrackVehicleInfo_8F141F,
-    &TrackVehicleInfo_8F1C2E, &TrackVehicleInfo_8F243D, &TrackVehicleInfo_8F2C3A, &TrackVehicleInfo_8F3437, &TrackVehicleInfo_8F3C46, &TrackVehicleInfo_8F4455,
-    &TrackVehicleInfo_8F4C52, &TrackVehicleInfo_8F544F, &TrackVehicleInfo_8F5C5E, &TrackVehicleInfo_8F646D, &TrackVehicleInfo_8F6C6A, &TrackVehicleInfo_8F7467,
-    &TrackVehicleInfo_8F7C76, &TrackVehicleInfo_8F8485, &TrackVehicleInfo_8E402E, &TrackVehicleInfo_8E4270, &TrackVehicleInfo_8E44B2, &TrackVehicleInfo_8E46F4,
-    &TrackVehicleInfo_8E4936, &TrackVehicleInfo_8E4B78, &TrackVehicleInfo_8E4DBA, &TrackVehicleInfo_8E4FFC, &TrackVehicleInfo_8E523E, &TrackVehicleInfo_8E5480,
-    &TrackVehicleInfo_8E56C2, &TrackVehicleInfo_8E5904, &TrackVehicleInfo_8E5B46, &TrackVehicleInfo_8E5D88, &TrackVehicleInfo_8E5FCA, &TrackVehicleInfo_8E620C,
-    &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF, &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291, &TrackVehicleInfo_8CE4B8, &TrackVehicleInfo_8CE6DF,
-    &TrackVehicleInfo_8CE06A, &TrackVehicleInfo_8CE291,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListChairliftStartBullwheel[] = {
+    TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF,
+    TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291,
+    TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C,
+    TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408, TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4,
+    TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_8E39EE, TrackVehicleInfo_8E3AB6, TrackVehicleInfo_8E3B87, TrackVehicleInfo_8E3C4F,
+    TrackVehicleInfo_8E3D0E, TrackVehicleInfo_8E3DCD, TrackVehicleInfo_8E3E95, TrackVehicleInfo_8E3F66, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DB70E, TrackVehicleInfo_8DBA70, TrackVehicleInfo_8DBDD2, TrackVehicleInfo_8DC134, TrackVehicleInfo_8DC496, TrackVehicleInfo_8DC7F8,
+    TrackVehicleInfo_8DCB5A, TrackVehicleInfo_8DCEBC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E7AFA, TrackVehicleInfo_8E80A5, TrackVehicleInfo_8E8650, TrackVehicleInfo_8E8BFB, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EC3AA, TrackVehicleInfo_8EC715, TrackVehicleInfo_8ECA80, TrackVehicleInfo_8ECDEB, TrackVehicleInfo_8ED156, TrackVehicleInfo_8ED4C1,
+    TrackVehicleInfo_8ED82C, TrackVehicleInfo_8EDB97, TrackVehicleInfo_8C6C32, TrackVehicleInfo_8C6D78, TrackVehicleInfo_8C6EBE, TrackVehicleInfo_8C7004,
+    TrackVehicleInfo_8C714A, TrackVehicleInfo_8C7290, TrackVehicleInfo_8C73D6, TrackVehicleInfo_8C751C, TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8,
+    TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_8C7B7A, TrackVehicleInfo_8C7CC0, TrackVehicleInfo_8C7E06, TrackVehicleInfo_8C7F4C,
+    TrackVehicleInfo_8EFA5A, TrackVehicleInfo_8EFDAA, TrackVehicleInfo_8F00FA, TrackVehicleInfo_8F044A, TrackVehicleInfo_8F079A, TrackVehicleInfo_8F08BC,
+    TrackVehicleInfo_8F09DE, TrackVehicleInfo_8F0B00, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554,
+    TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80,
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5,
+    TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408,
+    TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4, TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C,
+    TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18,
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01,
+    TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890,
+    TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496, TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D,
+    TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94,
+    TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923, TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8,
+    TrackVehicleInfo_8F8C82, TrackVehicleInfo_8F9143, TrackVehicleInfo_8F9616, TrackVehicleInfo_8F9AE9, TrackVehicleInfo_8F9FAA, TrackVehicleInfo_8FA46B,
+    TrackVehicleInfo_8FA93E, TrackVehicleInfo_8FAE11, TrackVehicleInfo_8FB2D2, TrackVehicleInfo_8FB793, TrackVehicleInfo_8FBC66, TrackVehicleInfo_8FC139,
+    TrackVehicleInfo_8FC5FA, TrackVehicleInfo_8FCABB, TrackVehicleInfo_8FCF8E, TrackVehicleInfo_8FD461, TrackVehicleInfo_8F0C22, TrackVehicleInfo_8F141F,
+    TrackVehicleInfo_8F1C2E, TrackVehicleInfo_8F243D, TrackVehicleInfo_8F2C3A, TrackVehicleInfo_8F3437, TrackVehicleInfo_8F3C46, TrackVehicleInfo_8F4455,
+    TrackVehicleInfo_8F4C52, TrackVehicleInfo_8F544F, TrackVehicleInfo_8F5C5E, TrackVehicleInfo_8F646D, TrackVehicleInfo_8F6C6A, TrackVehicleInfo_8F7467,
+    TrackVehicleInfo_8F7C76, TrackVehicleInfo_8F8485, TrackVehicleInfo_8E402E, TrackVehicleInfo_8E4270, TrackVehicleInfo_8E44B2, TrackVehicleInfo_8E46F4,
+    TrackVehicleInfo_8E4936, TrackVehicleInfo_8E4B78, TrackVehicleInfo_8E4DBA, TrackVehicleInfo_8E4FFC, TrackVehicleInfo_8E523E, TrackVehicleInfo_8E5480,
+    TrackVehicleInfo_8E56C2, TrackVehicleInfo_8E5904, TrackVehicleInfo_8E5B46, TrackVehicleInfo_8E5D88, TrackVehicleInfo_8E5FCA, TrackVehicleInfo_8E620C,
+    TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF, TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291, TrackVehicleInfo_8CE4B8, TrackVehicleInfo_8CE6DF,
+    TrackVehicleInfo_8CE06A, TrackVehicleInfo_8CE291,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListGoKartsLeftLane[] = {
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::Flat
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::EndStation
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::BeginStation
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::MiddleStation
-    &TrackVehicleInfo_900E52, &TrackVehicleInfo_900F74, &TrackVehicleInfo_901096, &TrackVehicleInfo_9011B8, // TrackElemType::Up25
-    &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, // TrackElemType::Up60
-    &TrackVehicleInfo_8FFBEA, &TrackVehicleInfo_8FFD0C, &TrackVehicleInfo_8FFE2E, &TrackVehicleInfo_8FFF50, // TrackElemType::FlatToUp25
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, // TrackElemType::Up25ToUp60
-    &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, // TrackElemType::Up60ToUp25
-    &TrackVehicleInfo_900072, &TrackVehicleInfo_9001A6, &TrackVehicleInfo_9002DA, &TrackVehicleInfo_90040E, // TrackElemType::Up25ToFlat
-    &TrackVehicleInfo_9012DA, &TrackVehicleInfo_9013FC, &TrackVehicleInfo_90151E, &TrackVehicleInfo_901640, // TrackElemType::Down25
-    &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, // TrackElemType::Down60
-    &TrackVehicleInfo_9009CA, &TrackVehicleInfo_900AEC, &TrackVehicleInfo_900C0E, &TrackVehicleInfo_900D30, // TrackElemType::FlatToDown25
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, // TrackElemType::Down25ToDown60
-    &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, // TrackElemType::Down60ToDown25
-    &TrackVehicleInfo_900542, &TrackVehicleInfo_900664, &TrackVehicleInfo_900786, &TrackVehicleInfo_9008A8, // TrackElemType::Down25ToFlat
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::LeftQuarterTurn5Tiles
-    &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles0, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles1, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles2, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::RightQuarterTurn5Tiles
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::FlatToLeftBank
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::FlatToRightBank
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::LeftBankToFlat
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::RightBankToFlat
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::BankedLeftQuarterTurn5Tiles
-    &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles0, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles1, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles2, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::BankedRightQuarterTurn5Tiles
-    &TrackVehicleInfo_8FFBEA, &TrackVehicleInfo_8FFD0C, &TrackVehicleInfo_8FFE2E, &TrackVehicleInfo_8FFF50, // TrackElemType::LeftBankToUp25
-    &TrackVehicleInfo_8FFBEA, &TrackVehicleInfo_8FFD0C, &TrackVehicleInfo_8FFE2E, &TrackVehicleInfo_8FFF50, // TrackElemType::RightBankToUp25
-    &TrackVehicleInfo_900072, &TrackVehicleInfo_9001A6, &TrackVehicleInfo_9002DA, &TrackVehicleInfo_90040E, // TrackElemType::Up25ToLeftBank
-    &TrackVehicleInfo_900072, &TrackVehicleInfo_9001A6, &TrackVehicleInfo_9002DA, &TrackVehicleInfo_90040E, // TrackElemType::Up25ToRightBank
-    &TrackVehicleInfo_9009CA, &TrackVehicleInfo_900AEC, &TrackVehicleInfo_900C0E, &TrackVehicleInfo_900D30, // TrackElemType::LeftBankToDown25
-    &TrackVehicleInfo_9009CA, &TrackVehicleInfo_900AEC, &TrackVehicleInfo_900C0E, &TrackVehicleInfo_900D30, // TrackElemType::RightBankToDown25
-    &TrackVehicleInfo_900542, &TrackVehicleInfo_900664, &TrackVehicleInfo_900786, &TrackVehicleInfo_9008A8, // TrackElemType::Down25ToLeftBank
-    &TrackVehicleInfo_900542, &TrackVehicleInfo_900664, &TrackVehicleInfo_900786, &TrackVehicleInfo_9008A8, // TrackElemType::Down25ToRightBank
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::LeftBank
-    &TrackVehicleInfo_8FF2DA, &TrackVehicleInfo_8FF3FC, &TrackVehicleInfo_8FF51E, &TrackVehicleInfo_8FF640, // TrackElemType::RightBank
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp0, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp1, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp2, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp3, // TrackElemType::LeftQuarterTurn5TilesUp25
-    &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp0, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp1, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp2, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp3, // TrackElemType::RightQuarterTurn5TilesUp25
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown0, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown1, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown2, &LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown3, // TrackElemType::LeftQuarterTurn5TilesDown25
-    &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown0, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown1, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown2, &LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown3, // TrackElemType::RightQuarterTurn5TilesDown25
-    &LeftLane::TrackVehicleInfoLeftSBend0, &LeftLane::TrackVehicleInfoLeftSBend1, &LeftLane::TrackVehicleInfoLeftSBend2, &LeftLane::TrackVehicleInfoLeftSBend3, // TrackElemType::SBendLeft
-    &LeftLane::TrackVehicleInfoRightSBend0, &LeftLane::TrackVehicleInfoRightSBend1, &LeftLane::TrackVehicleInfoRightSBend2, &LeftLane::TrackVehicleInfoRightSBend3, // TrackElemType::SBendRight
-    &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6, &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, // TrackElemType::LeftVerticalLoop
-    &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116, // TrackElemType::RightVerticalLoop
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftQuarterTurn3Tiles
-    &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles0, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles1, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles2, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightQuarterTurn3Tiles
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftBankedQuarterTurn3Tiles
-    &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles0, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles1, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles2, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightBankedQuarterTurn3Tiles
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp0, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp1, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp2, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp3, // TrackElemType::LeftQuarterTurn3TilesUp25
-    &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp0, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp1, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp2, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp3, // TrackElemType::RightQuarterTurn3TilesUp25
-    &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown0, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown1, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown2, &LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown3, // TrackElemType::LeftQuarterTurn3TilesDown25
-    &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown0, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown1, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown2, &LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown3, // TrackElemType::RightQuarterTurn3TilesDown25
-    &TrackVehicleInfo_901C05, &TrackVehicleInfo_901C7C, &TrackVehicleInfo_901CFC, &TrackVehicleInfo_901D73, // TrackElemType::LeftQuarterTurn1Tile
-    &TrackVehicleInfo_901762, &TrackVehicleInfo_901884, &TrackVehicleInfo_9019AF, &TrackVehicleInfo_901AE3, // TrackElemType::RightQuarterTurn1Tile
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListGoKartsLeftLane[] = {
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::Flat
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::EndStation
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::BeginStation
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::MiddleStation
+    TrackVehicleInfo_900E52, TrackVehicleInfo_900F74, TrackVehicleInfo_901096, TrackVehicleInfo_9011B8, // TrackElemType::Up25
+    TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, // TrackElemType::Up60
+    TrackVehicleInfo_8FFBEA, TrackVehicleInfo_8FFD0C, TrackVehicleInfo_8FFE2E, TrackVehicleInfo_8FFF50, // TrackElemType::FlatToUp25
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, // TrackElemType::Up25ToUp60
+    TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, // TrackElemType::Up60ToUp25
+    TrackVehicleInfo_900072, TrackVehicleInfo_9001A6, TrackVehicleInfo_9002DA, TrackVehicleInfo_90040E, // TrackElemType::Up25ToFlat
+    TrackVehicleInfo_9012DA, TrackVehicleInfo_9013FC, TrackVehicleInfo_90151E, TrackVehicleInfo_901640, // TrackElemType::Down25
+    TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, // TrackElemType::Down60
+    TrackVehicleInfo_9009CA, TrackVehicleInfo_900AEC, TrackVehicleInfo_900C0E, TrackVehicleInfo_900D30, // TrackElemType::FlatToDown25
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, // TrackElemType::Down25ToDown60
+    TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, // TrackElemType::Down60ToDown25
+    TrackVehicleInfo_900542, TrackVehicleInfo_900664, TrackVehicleInfo_900786, TrackVehicleInfo_9008A8, // TrackElemType::Down25ToFlat
+    LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::LeftQuarterTurn5Tiles
+    LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles0, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles1, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles2, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::RightQuarterTurn5Tiles
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::FlatToLeftBank
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::FlatToRightBank
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::LeftBankToFlat
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::RightBankToFlat
+    LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::BankedLeftQuarterTurn5Tiles
+    LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles0, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles1, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles2, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::BankedRightQuarterTurn5Tiles
+    TrackVehicleInfo_8FFBEA, TrackVehicleInfo_8FFD0C, TrackVehicleInfo_8FFE2E, TrackVehicleInfo_8FFF50, // TrackElemType::LeftBankToUp25
+    TrackVehicleInfo_8FFBEA, TrackVehicleInfo_8FFD0C, TrackVehicleInfo_8FFE2E, TrackVehicleInfo_8FFF50, // TrackElemType::RightBankToUp25
+    TrackVehicleInfo_900072, TrackVehicleInfo_9001A6, TrackVehicleInfo_9002DA, TrackVehicleInfo_90040E, // TrackElemType::Up25ToLeftBank
+    TrackVehicleInfo_900072, TrackVehicleInfo_9001A6, TrackVehicleInfo_9002DA, TrackVehicleInfo_90040E, // TrackElemType::Up25ToRightBank
+    TrackVehicleInfo_9009CA, TrackVehicleInfo_900AEC, TrackVehicleInfo_900C0E, TrackVehicleInfo_900D30, // TrackElemType::LeftBankToDown25
+    TrackVehicleInfo_9009CA, TrackVehicleInfo_900AEC, TrackVehicleInfo_900C0E, TrackVehicleInfo_900D30, // TrackElemType::RightBankToDown25
+    TrackVehicleInfo_900542, TrackVehicleInfo_900664, TrackVehicleInfo_900786, TrackVehicleInfo_9008A8, // TrackElemType::Down25ToLeftBank
+    TrackVehicleInfo_900542, TrackVehicleInfo_900664, TrackVehicleInfo_900786, TrackVehicleInfo_9008A8, // TrackElemType::Down25ToRightBank
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::LeftBank
+    TrackVehicleInfo_8FF2DA, TrackVehicleInfo_8FF3FC, TrackVehicleInfo_8FF51E, TrackVehicleInfo_8FF640, // TrackElemType::RightBank
+    LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp0, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp1, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp2, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp3, // TrackElemType::LeftQuarterTurn5TilesUp25
+    LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp0, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp1, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp2, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp3, // TrackElemType::RightQuarterTurn5TilesUp25
+    LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown0, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown1, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown2, LeftLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown3, // TrackElemType::LeftQuarterTurn5TilesDown25
+    LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown0, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown1, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown2, LeftLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown3, // TrackElemType::RightQuarterTurn5TilesDown25
+    LeftLane::TrackVehicleInfoLeftSBend0, LeftLane::TrackVehicleInfoLeftSBend1, LeftLane::TrackVehicleInfoLeftSBend2, LeftLane::TrackVehicleInfoLeftSBend3, // TrackElemType::SBendLeft
+    LeftLane::TrackVehicleInfoRightSBend0, LeftLane::TrackVehicleInfoRightSBend1, LeftLane::TrackVehicleInfoRightSBend2, LeftLane::TrackVehicleInfoRightSBend3, // TrackElemType::SBendRight
+    TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6, TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, // TrackElemType::LeftVerticalLoop
+    TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116, // TrackElemType::RightVerticalLoop
+    LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftQuarterTurn3Tiles
+    LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles0, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles1, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles2, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightQuarterTurn3Tiles
+    LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftBankedQuarterTurn3Tiles
+    LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles0, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles1, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles2, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightBankedQuarterTurn3Tiles
+    LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp0, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp1, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp2, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp3, // TrackElemType::LeftQuarterTurn3TilesUp25
+    LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp0, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp1, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp2, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp3, // TrackElemType::RightQuarterTurn3TilesUp25
+    LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown0, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown1, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown2, LeftLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown3, // TrackElemType::LeftQuarterTurn3TilesDown25
+    LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown0, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown1, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown2, LeftLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown3, // TrackElemType::RightQuarterTurn3TilesDown25
+    TrackVehicleInfo_901C05, TrackVehicleInfo_901C7C, TrackVehicleInfo_901CFC, TrackVehicleInfo_901D73, // TrackElemType::LeftQuarterTurn1Tile
+    TrackVehicleInfo_901762, TrackVehicleInfo_901884, TrackVehicleInfo_9019AF, TrackVehicleInfo_901AE3, // TrackElemType::RightQuarterTurn1Tile
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListGoKartsRightLane[] = {
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::Flat
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::EndStation
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::BeginStation
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::MiddleStation
-    &TrackVehicleInfo_9034D1, &TrackVehicleInfo_9035F3, &TrackVehicleInfo_903715, &TrackVehicleInfo_903837, // TrackElemType::Up25
-    &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, // TrackElemType::Up60
-    &TrackVehicleInfo_902269, &TrackVehicleInfo_90238B, &TrackVehicleInfo_9024AD, &TrackVehicleInfo_9025CF, // TrackElemType::FlatToUp25
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, // TrackElemType::Up25ToUp60
-    &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, // TrackElemType::Up60ToUp25
-    &TrackVehicleInfo_9026F1, &TrackVehicleInfo_902825, &TrackVehicleInfo_902959, &TrackVehicleInfo_902A8D, // TrackElemType::Up25ToFlat
-    &TrackVehicleInfo_903959, &TrackVehicleInfo_903A7B, &TrackVehicleInfo_903B9D, &TrackVehicleInfo_903CBF, // TrackElemType::Down25
-    &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, // TrackElemType::Down60
-    &TrackVehicleInfo_903049, &TrackVehicleInfo_90316B, &TrackVehicleInfo_90328D, &TrackVehicleInfo_9033AF, // TrackElemType::FlatToDown25
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, // TrackElemType::Down25ToDown60
-    &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, // TrackElemType::Down60ToDown25
-    &TrackVehicleInfo_902BC1, &TrackVehicleInfo_902CE3, &TrackVehicleInfo_902E05, &TrackVehicleInfo_902F27, // TrackElemType::Down25ToFlat
-    &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::LeftQuarterTurn5Tiles
-    &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles0, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles1, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles2, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::RightQuarterTurn5Tiles
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::FlatToLeftBank
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::FlatToRightBank
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::LeftBankToFlat
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::RightBankToFlat
-    &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::BankedLeftQuarterTurn5Tiles
-    &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles0, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles1, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles2, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::BankedRightQuarterTurn5Tiles
-    &TrackVehicleInfo_902269, &TrackVehicleInfo_90238B, &TrackVehicleInfo_9024AD, &TrackVehicleInfo_9025CF, // TrackElemType::LeftBankToUp25
-    &TrackVehicleInfo_902269, &TrackVehicleInfo_90238B, &TrackVehicleInfo_9024AD, &TrackVehicleInfo_9025CF, // TrackElemType::RightBankToUp25
-    &TrackVehicleInfo_9026F1, &TrackVehicleInfo_902825, &TrackVehicleInfo_902959, &TrackVehicleInfo_902A8D, // TrackElemType::Up25ToLeftBank
-    &TrackVehicleInfo_9026F1, &TrackVehicleInfo_902825, &TrackVehicleInfo_902959, &TrackVehicleInfo_902A8D, // TrackElemType::Up25ToRightBank
-    &TrackVehicleInfo_903049, &TrackVehicleInfo_90316B, &TrackVehicleInfo_90328D, &TrackVehicleInfo_9033AF, // TrackElemType::LeftBankToDown25
-    &TrackVehicleInfo_903049, &TrackVehicleInfo_90316B, &TrackVehicleInfo_90328D, &TrackVehicleInfo_9033AF, // TrackElemType::RightBankToDown25
-    &TrackVehicleInfo_902BC1, &TrackVehicleInfo_902CE3, &TrackVehicleInfo_902E05, &TrackVehicleInfo_902F27, // TrackElemType::Down25ToLeftBank
-    &TrackVehicleInfo_902BC1, &TrackVehicleInfo_902CE3, &TrackVehicleInfo_902E05, &TrackVehicleInfo_902F27, // TrackElemType::Down25ToRightBank
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::LeftBank
-    &TrackVehicleInfo_901DE1, &TrackVehicleInfo_901F03, &TrackVehicleInfo_902025, &TrackVehicleInfo_902147, // TrackElemType::RightBank
-    &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp0, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp1, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp2, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp3, // TrackElemType::LeftQuarterTurn5TilesUp25
-    &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp0, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp1, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp2, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp3, // TrackElemType::RightQuarterTurn5TilesUp25
-    &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown0, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown1, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown2, &RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown3, // TrackElemType::LeftQuarterTurn5TilesDown25
-    &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown0, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown1, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown2, &RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown3, // TrackElemType::RightQuarterTurn5TilesDown25
-    &RightLane::TrackVehicleInfoLeftSBend0, &RightLane::TrackVehicleInfoLeftSBend1, &RightLane::TrackVehicleInfoLeftSBend2, &RightLane::TrackVehicleInfoLeftSBend3, // TrackElemType::SBendLeft
-    &RightLane::TrackVehicleInfoRightSBend0, &RightLane::TrackVehicleInfoRightSBend1, &RightLane::TrackVehicleInfoRightSBend2, &RightLane::TrackVehicleInfoRightSBend3, // TrackElemType::SBendRight
-    &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6, &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, // TrackElemType::LeftVerticalLoop
-    &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116, // TrackElemType::RightVerticalLoop
-    &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftQuarterTurn3Tiles
-    &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles0, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles1, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles2, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightQuarterTurn3Tiles
-    &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftBankedQuarterTurn3Tiles
-    &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles0, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles1, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles2, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightBankedQuarterTurn3Tiles
-    &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp0, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp1, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp2, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp3, // TrackElemType::LeftQuarterTurn3TilesUp25
-    &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp0, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp1, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp2, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp3, // TrackElemType::RightQuarterTurn3TilesUp25
-    &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown0, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown1, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown2, &RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown3, // TrackElemType::LeftQuarterTurn3TilesDown25
-    &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown0, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown1, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown2, &RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown3, // TrackElemType::RightQuarterTurn3TilesDown25
-    &TrackVehicleInfo_903DE1, &TrackVehicleInfo_903F0C, &TrackVehicleInfo_904040, &TrackVehicleInfo_904162, // TrackElemType::LeftQuarterTurn1Tile
-    &TrackVehicleInfo_904284, &TrackVehicleInfo_9042F2, &TrackVehicleInfo_904369, &TrackVehicleInfo_9043E9, // TrackElemType::RightQuarterTurn1Tile
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListGoKartsRightLane[] = {
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::Flat
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::EndStation
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::BeginStation
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::MiddleStation
+    TrackVehicleInfo_9034D1, TrackVehicleInfo_9035F3, TrackVehicleInfo_903715, TrackVehicleInfo_903837, // TrackElemType::Up25
+    TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, // TrackElemType::Up60
+    TrackVehicleInfo_902269, TrackVehicleInfo_90238B, TrackVehicleInfo_9024AD, TrackVehicleInfo_9025CF, // TrackElemType::FlatToUp25
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, // TrackElemType::Up25ToUp60
+    TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, // TrackElemType::Up60ToUp25
+    TrackVehicleInfo_9026F1, TrackVehicleInfo_902825, TrackVehicleInfo_902959, TrackVehicleInfo_902A8D, // TrackElemType::Up25ToFlat
+    TrackVehicleInfo_903959, TrackVehicleInfo_903A7B, TrackVehicleInfo_903B9D, TrackVehicleInfo_903CBF, // TrackElemType::Down25
+    TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, // TrackElemType::Down60
+    TrackVehicleInfo_903049, TrackVehicleInfo_90316B, TrackVehicleInfo_90328D, TrackVehicleInfo_9033AF, // TrackElemType::FlatToDown25
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, // TrackElemType::Down25ToDown60
+    TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, // TrackElemType::Down60ToDown25
+    TrackVehicleInfo_902BC1, TrackVehicleInfo_902CE3, TrackVehicleInfo_902E05, TrackVehicleInfo_902F27, // TrackElemType::Down25ToFlat
+    RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::LeftQuarterTurn5Tiles
+    RightLane::TrackVehicleInfoRightQuarterTurn5Tiles0, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles1, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles2, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::RightQuarterTurn5Tiles
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::FlatToLeftBank
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::FlatToRightBank
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::LeftBankToFlat
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::RightBankToFlat
+    RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles0, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles1, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles2, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles3, // TrackElemType::BankedLeftQuarterTurn5Tiles
+    RightLane::TrackVehicleInfoRightQuarterTurn5Tiles0, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles1, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles2, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles3, // TrackElemType::BankedRightQuarterTurn5Tiles
+    TrackVehicleInfo_902269, TrackVehicleInfo_90238B, TrackVehicleInfo_9024AD, TrackVehicleInfo_9025CF, // TrackElemType::LeftBankToUp25
+    TrackVehicleInfo_902269, TrackVehicleInfo_90238B, TrackVehicleInfo_9024AD, TrackVehicleInfo_9025CF, // TrackElemType::RightBankToUp25
+    TrackVehicleInfo_9026F1, TrackVehicleInfo_902825, TrackVehicleInfo_902959, TrackVehicleInfo_902A8D, // TrackElemType::Up25ToLeftBank
+    TrackVehicleInfo_9026F1, TrackVehicleInfo_902825, TrackVehicleInfo_902959, TrackVehicleInfo_902A8D, // TrackElemType::Up25ToRightBank
+    TrackVehicleInfo_903049, TrackVehicleInfo_90316B, TrackVehicleInfo_90328D, TrackVehicleInfo_9033AF, // TrackElemType::LeftBankToDown25
+    TrackVehicleInfo_903049, TrackVehicleInfo_90316B, TrackVehicleInfo_90328D, TrackVehicleInfo_9033AF, // TrackElemType::RightBankToDown25
+    TrackVehicleInfo_902BC1, TrackVehicleInfo_902CE3, TrackVehicleInfo_902E05, TrackVehicleInfo_902F27, // TrackElemType::Down25ToLeftBank
+    TrackVehicleInfo_902BC1, TrackVehicleInfo_902CE3, TrackVehicleInfo_902E05, TrackVehicleInfo_902F27, // TrackElemType::Down25ToRightBank
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::LeftBank
+    TrackVehicleInfo_901DE1, TrackVehicleInfo_901F03, TrackVehicleInfo_902025, TrackVehicleInfo_902147, // TrackElemType::RightBank
+    RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp0, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp1, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp2, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegUp3, // TrackElemType::LeftQuarterTurn5TilesUp25
+    RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp0, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp1, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp2, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegUp3, // TrackElemType::RightQuarterTurn5TilesUp25
+    RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown0, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown1, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown2, RightLane::TrackVehicleInfoLeftQuarterTurn5Tiles25DegDown3, // TrackElemType::LeftQuarterTurn5TilesDown25
+    RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown0, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown1, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown2, RightLane::TrackVehicleInfoRightQuarterTurn5Tiles25DegDown3, // TrackElemType::RightQuarterTurn5TilesDown25
+    RightLane::TrackVehicleInfoLeftSBend0, RightLane::TrackVehicleInfoLeftSBend1, RightLane::TrackVehicleInfoLeftSBend2, RightLane::TrackVehicleInfoLeftSBend3, // TrackElemType::SBendLeft
+    RightLane::TrackVehicleInfoRightSBend0, RightLane::TrackVehicleInfoRightSBend1, RightLane::TrackVehicleInfoRightSBend2, RightLane::TrackVehicleInfoRightSBend3, // TrackElemType::SBendRight
+    TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6, TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, // TrackElemType::LeftVerticalLoop
+    TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116, // TrackElemType::RightVerticalLoop
+    RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftQuarterTurn3Tiles
+    RightLane::TrackVehicleInfoRightQuarterTurn3Tiles0, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles1, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles2, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightQuarterTurn3Tiles
+    RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles0, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles1, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles2, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles3, // TrackElemType::LeftBankedQuarterTurn3Tiles
+    RightLane::TrackVehicleInfoRightQuarterTurn3Tiles0, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles1, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles2, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles3, // TrackElemType::RightBankedQuarterTurn3Tiles
+    RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp0, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp1, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp2, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegUp3, // TrackElemType::LeftQuarterTurn3TilesUp25
+    RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp0, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp1, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp2, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegUp3, // TrackElemType::RightQuarterTurn3TilesUp25
+    RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown0, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown1, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown2, RightLane::TrackVehicleInfoLeftQuarterTurn3Tiles25DegDown3, // TrackElemType::LeftQuarterTurn3TilesDown25
+    RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown0, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown1, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown2, RightLane::TrackVehicleInfoRightQuarterTurn3Tiles25DegDown3, // TrackElemType::RightQuarterTurn3TilesDown25
+    TrackVehicleInfo_903DE1, TrackVehicleInfo_903F0C, TrackVehicleInfo_904040, TrackVehicleInfo_904162, // TrackElemType::LeftQuarterTurn1Tile
+    TrackVehicleInfo_904284, TrackVehicleInfo_9042F2, TrackVehicleInfo_904369, TrackVehicleInfo_9043E9, // TrackElemType::RightQuarterTurn1Tile
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListGoKartsMovingToRightLane[] = {
-    &TrackVehicleInfo_8FF762, &TrackVehicleInfo_8FF884, &TrackVehicleInfo_8FF9A6, &TrackVehicleInfo_8FFAC8, &TrackVehicleInfo_8FF762, &TrackVehicleInfo_8FF884,
-    &TrackVehicleInfo_8FF9A6, &TrackVehicleInfo_8FFAC8, &TrackVehicleInfo_8FF762, &TrackVehicleInfo_8FF884, &TrackVehicleInfo_8FF9A6, &TrackVehicleInfo_8FFAC8,
-    &TrackVehicleInfo_8FF762, &TrackVehicleInfo_8FF884, &TrackVehicleInfo_8FF9A6, &TrackVehicleInfo_8FFAC8, &TrackVehicleInfo_900E52, &TrackVehicleInfo_900F74,
-    &TrackVehicleInfo_901096, &TrackVehicleInfo_9011B8, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8FFBEA, &TrackVehicleInfo_8FFD0C, &TrackVehicleInfo_8FFE2E, &TrackVehicleInfo_8FFF50, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_900072, &TrackVehicleInfo_9001A6, &TrackVehicleInfo_9002DA, &TrackVehicleInfo_90040E, &TrackVehicleInfo_9012DA, &TrackVehicleInfo_9013FC,
-    &TrackVehicleInfo_90151E, &TrackVehicleInfo_901640, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_9009CA, &TrackVehicleInfo_900AEC, &TrackVehicleInfo_900C0E, &TrackVehicleInfo_900D30, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_900542, &TrackVehicleInfo_900664, &TrackVehicleInfo_900786, &TrackVehicleInfo_9008A8, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_901C05, &TrackVehicleInfo_901C7C, &TrackVehicleInfo_901CFC, &TrackVehicleInfo_901D73,
-    &TrackVehicleInfo_901762, &TrackVehicleInfo_901884, &TrackVehicleInfo_9019AF, &TrackVehicleInfo_901AE3,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListGoKartsMovingToRightLane[] = {
+    TrackVehicleInfo_8FF762, TrackVehicleInfo_8FF884, TrackVehicleInfo_8FF9A6, TrackVehicleInfo_8FFAC8, TrackVehicleInfo_8FF762, TrackVehicleInfo_8FF884,
+    TrackVehicleInfo_8FF9A6, TrackVehicleInfo_8FFAC8, TrackVehicleInfo_8FF762, TrackVehicleInfo_8FF884, TrackVehicleInfo_8FF9A6, TrackVehicleInfo_8FFAC8,
+    TrackVehicleInfo_8FF762, TrackVehicleInfo_8FF884, TrackVehicleInfo_8FF9A6, TrackVehicleInfo_8FFAC8, TrackVehicleInfo_900E52, TrackVehicleInfo_900F74,
+    TrackVehicleInfo_901096, TrackVehicleInfo_9011B8, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8FFBEA, TrackVehicleInfo_8FFD0C, TrackVehicleInfo_8FFE2E, TrackVehicleInfo_8FFF50, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_900072, TrackVehicleInfo_9001A6, TrackVehicleInfo_9002DA, TrackVehicleInfo_90040E, TrackVehicleInfo_9012DA, TrackVehicleInfo_9013FC,
+    TrackVehicleInfo_90151E, TrackVehicleInfo_901640, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_9009CA, TrackVehicleInfo_900AEC, TrackVehicleInfo_900C0E, TrackVehicleInfo_900D30, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_900542, TrackVehicleInfo_900664, TrackVehicleInfo_900786, TrackVehicleInfo_9008A8, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_901C05, TrackVehicleInfo_901C7C, TrackVehicleInfo_901CFC, TrackVehicleInfo_901D73,
+    TrackVehicleInfo_901762, TrackVehicleInfo_901884, TrackVehicleInfo_9019AF, TrackVehicleInfo_901AE3,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListGoKartsMovingToLeftLane[] = {
-    &TrackVehicleInfo_904460, &TrackVehicleInfo_904582, &TrackVehicleInfo_9046A4, &TrackVehicleInfo_9047C6, &TrackVehicleInfo_904460, &TrackVehicleInfo_904582,
-    &TrackVehicleInfo_9046A4, &TrackVehicleInfo_9047C6, &TrackVehicleInfo_904460, &TrackVehicleInfo_904582, &TrackVehicleInfo_9046A4, &TrackVehicleInfo_9047C6,
-    &TrackVehicleInfo_904460, &TrackVehicleInfo_904582, &TrackVehicleInfo_9046A4, &TrackVehicleInfo_9047C6, &TrackVehicleInfo_9034D1, &TrackVehicleInfo_9035F3,
-    &TrackVehicleInfo_903715, &TrackVehicleInfo_903837, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_902269, &TrackVehicleInfo_90238B, &TrackVehicleInfo_9024AD, &TrackVehicleInfo_9025CF, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_9026F1, &TrackVehicleInfo_902825, &TrackVehicleInfo_902959, &TrackVehicleInfo_902A8D, &TrackVehicleInfo_903959, &TrackVehicleInfo_903A7B,
-    &TrackVehicleInfo_903B9D, &TrackVehicleInfo_903CBF, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_903049, &TrackVehicleInfo_90316B, &TrackVehicleInfo_90328D, &TrackVehicleInfo_9033AF, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_902BC1, &TrackVehicleInfo_902CE3, &TrackVehicleInfo_902E05, &TrackVehicleInfo_902F27, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_903DE1, &TrackVehicleInfo_903F0C, &TrackVehicleInfo_904040, &TrackVehicleInfo_904162,
-    &TrackVehicleInfo_904284, &TrackVehicleInfo_9042F2, &TrackVehicleInfo_904369, &TrackVehicleInfo_9043E9,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListGoKartsMovingToLeftLane[] = {
+    TrackVehicleInfo_904460, TrackVehicleInfo_904582, TrackVehicleInfo_9046A4, TrackVehicleInfo_9047C6, TrackVehicleInfo_904460, TrackVehicleInfo_904582,
+    TrackVehicleInfo_9046A4, TrackVehicleInfo_9047C6, TrackVehicleInfo_904460, TrackVehicleInfo_904582, TrackVehicleInfo_9046A4, TrackVehicleInfo_9047C6,
+    TrackVehicleInfo_904460, TrackVehicleInfo_904582, TrackVehicleInfo_9046A4, TrackVehicleInfo_9047C6, TrackVehicleInfo_9034D1, TrackVehicleInfo_9035F3,
+    TrackVehicleInfo_903715, TrackVehicleInfo_903837, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_902269, TrackVehicleInfo_90238B, TrackVehicleInfo_9024AD, TrackVehicleInfo_9025CF, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_9026F1, TrackVehicleInfo_902825, TrackVehicleInfo_902959, TrackVehicleInfo_902A8D, TrackVehicleInfo_903959, TrackVehicleInfo_903A7B,
+    TrackVehicleInfo_903B9D, TrackVehicleInfo_903CBF, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_903049, TrackVehicleInfo_90316B, TrackVehicleInfo_90328D, TrackVehicleInfo_9033AF, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_902BC1, TrackVehicleInfo_902CE3, TrackVehicleInfo_902E05, TrackVehicleInfo_902F27, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_903DE1, TrackVehicleInfo_903F0C, TrackVehicleInfo_904040, TrackVehicleInfo_904162,
+    TrackVehicleInfo_904284, TrackVehicleInfo_9042F2, TrackVehicleInfo_904369, TrackVehicleInfo_9043E9,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListMiniGolfStartPathA9[] = {
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4,
-    &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8,
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938D7A, &TrackVehicleInfo_938E0C,
-    &TrackVehicleInfo_938E9E, &TrackVehicleInfo_938F30, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_93845A, &TrackVehicleInfo_9384EC, &TrackVehicleInfo_93857E, &TrackVehicleInfo_938610, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9386A2, &TrackVehicleInfo_938734, &TrackVehicleInfo_9387C6, &TrackVehicleInfo_938858, &TrackVehicleInfo_938FC2, &TrackVehicleInfo_939054,
-    &TrackVehicleInfo_9390E6, &TrackVehicleInfo_939178, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_938B32, &TrackVehicleInfo_938BC4, &TrackVehicleInfo_938C56, &TrackVehicleInfo_938CE8, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9388EA, &TrackVehicleInfo_93897C, &TrackVehicleInfo_938A0E, &TrackVehicleInfo_938AA0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_93920A, &TrackVehicleInfo_939293, &TrackVehicleInfo_93932E, &TrackVehicleInfo_9393C0,
-    &TrackVehicleInfo_939449, &TrackVehicleInfo_9394D2, &TrackVehicleInfo_939564, &TrackVehicleInfo_9395FF, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_939691, &TrackVehicleInfo_93C082, &TrackVehicleInfo_93EA73, &TrackVehicleInfo_941464, &TrackVehicleInfo_93A46E, &TrackVehicleInfo_93CE5F,
-    &TrackVehicleInfo_93F850, &TrackVehicleInfo_942241, &TrackVehicleInfo_93B2AE, &TrackVehicleInfo_93DC9F, &TrackVehicleInfo_940690, &TrackVehicleInfo_943081,
-    &TrackVehicleInfo_943E56, &TrackVehicleInfo_946B14, &TrackVehicleInfo_9497D2, &TrackVehicleInfo_94C490, &TrackVehicleInfo_9454B5, &TrackVehicleInfo_948173,
-    &TrackVehicleInfo_94AE31, &TrackVehicleInfo_94DAEF,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListMiniGolfStartPathA9[] = {
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4,
+    TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8,
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938D7A, TrackVehicleInfo_938E0C,
+    TrackVehicleInfo_938E9E, TrackVehicleInfo_938F30, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_93845A, TrackVehicleInfo_9384EC, TrackVehicleInfo_93857E, TrackVehicleInfo_938610, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9386A2, TrackVehicleInfo_938734, TrackVehicleInfo_9387C6, TrackVehicleInfo_938858, TrackVehicleInfo_938FC2, TrackVehicleInfo_939054,
+    TrackVehicleInfo_9390E6, TrackVehicleInfo_939178, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_938B32, TrackVehicleInfo_938BC4, TrackVehicleInfo_938C56, TrackVehicleInfo_938CE8, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9388EA, TrackVehicleInfo_93897C, TrackVehicleInfo_938A0E, TrackVehicleInfo_938AA0, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_93920A, TrackVehicleInfo_939293, TrackVehicleInfo_93932E, TrackVehicleInfo_9393C0,
+    TrackVehicleInfo_939449, TrackVehicleInfo_9394D2, TrackVehicleInfo_939564, TrackVehicleInfo_9395FF, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_939691, TrackVehicleInfo_93C082, TrackVehicleInfo_93EA73, TrackVehicleInfo_941464, TrackVehicleInfo_93A46E, TrackVehicleInfo_93CE5F,
+    TrackVehicleInfo_93F850, TrackVehicleInfo_942241, TrackVehicleInfo_93B2AE, TrackVehicleInfo_93DC9F, TrackVehicleInfo_940690, TrackVehicleInfo_943081,
+    TrackVehicleInfo_943E56, TrackVehicleInfo_946B14, TrackVehicleInfo_9497D2, TrackVehicleInfo_94C490, TrackVehicleInfo_9454B5, TrackVehicleInfo_948173,
+    TrackVehicleInfo_94AE31, TrackVehicleInfo_94DAEF,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListMiniGolfBallPathA10[] = {
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4,
-    &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8,
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938D7A, &TrackVehicleInfo_938E0C,
-    &TrackVehicleInfo_938E9E, &TrackVehicleInfo_938F30, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_93845A, &TrackVehicleInfo_9384EC, &TrackVehicleInfo_93857E, &TrackVehicleInfo_938610, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9386A2, &TrackVehicleInfo_938734, &TrackVehicleInfo_9387C6, &TrackVehicleInfo_938858, &TrackVehicleInfo_938FC2, &TrackVehicleInfo_939054,
-    &TrackVehicleInfo_9390E6, &TrackVehicleInfo_939178, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_938B32, &TrackVehicleInfo_938BC4, &TrackVehicleInfo_938C56, &TrackVehicleInfo_938CE8, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9388EA, &TrackVehicleInfo_93897C, &TrackVehicleInfo_938A0E, &TrackVehicleInfo_938AA0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_93920A, &TrackVehicleInfo_939293, &TrackVehicleInfo_93932E, &TrackVehicleInfo_9393C0,
-    &TrackVehicleInfo_939449, &TrackVehicleInfo_9394D2, &TrackVehicleInfo_939564, &TrackVehicleInfo_9395FF, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9398A6, &TrackVehicleInfo_93C297, &TrackVehicleInfo_93EC88, &TrackVehicleInfo_941679, &TrackVehicleInfo_93A68C, &TrackVehicleInfo_93D07D,
-    &TrackVehicleInfo_93FA6E, &TrackVehicleInfo_94245F, &TrackVehicleInfo_93B4CC, &TrackVehicleInfo_93DEBD, &TrackVehicleInfo_9408AE, &TrackVehicleInfo_94329F,
-    &TrackVehicleInfo_944104, &TrackVehicleInfo_946DC2, &TrackVehicleInfo_949A80, &TrackVehicleInfo_94C73E, &TrackVehicleInfo_945763, &TrackVehicleInfo_948421,
-    &TrackVehicleInfo_94B0DF, &TrackVehicleInfo_94DD9D,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListMiniGolfBallPathA10[] = {
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4,
+    TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8,
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938D7A, TrackVehicleInfo_938E0C,
+    TrackVehicleInfo_938E9E, TrackVehicleInfo_938F30, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_93845A, TrackVehicleInfo_9384EC, TrackVehicleInfo_93857E, TrackVehicleInfo_938610, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9386A2, TrackVehicleInfo_938734, TrackVehicleInfo_9387C6, TrackVehicleInfo_938858, TrackVehicleInfo_938FC2, TrackVehicleInfo_939054,
+    TrackVehicleInfo_9390E6, TrackVehicleInfo_939178, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_938B32, TrackVehicleInfo_938BC4, TrackVehicleInfo_938C56, TrackVehicleInfo_938CE8, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9388EA, TrackVehicleInfo_93897C, TrackVehicleInfo_938A0E, TrackVehicleInfo_938AA0, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_93920A, TrackVehicleInfo_939293, TrackVehicleInfo_93932E, TrackVehicleInfo_9393C0,
+    TrackVehicleInfo_939449, TrackVehicleInfo_9394D2, TrackVehicleInfo_939564, TrackVehicleInfo_9395FF, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9398A6, TrackVehicleInfo_93C297, TrackVehicleInfo_93EC88, TrackVehicleInfo_941679, TrackVehicleInfo_93A68C, TrackVehicleInfo_93D07D,
+    TrackVehicleInfo_93FA6E, TrackVehicleInfo_94245F, TrackVehicleInfo_93B4CC, TrackVehicleInfo_93DEBD, TrackVehicleInfo_9408AE, TrackVehicleInfo_94329F,
+    TrackVehicleInfo_944104, TrackVehicleInfo_946DC2, TrackVehicleInfo_949A80, TrackVehicleInfo_94C73E, TrackVehicleInfo_945763, TrackVehicleInfo_948421,
+    TrackVehicleInfo_94B0DF, TrackVehicleInfo_94DD9D,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListMiniGolfPathB11[] = {
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4,
-    &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8,
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938D7A, &TrackVehicleInfo_938E0C,
-    &TrackVehicleInfo_938E9E, &TrackVehicleInfo_938F30, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_93845A, &TrackVehicleInfo_9384EC, &TrackVehicleInfo_93857E, &TrackVehicleInfo_938610, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9386A2, &TrackVehicleInfo_938734, &TrackVehicleInfo_9387C6, &TrackVehicleInfo_938858, &TrackVehicleInfo_938FC2, &TrackVehicleInfo_939054,
-    &TrackVehicleInfo_9390E6, &TrackVehicleInfo_939178, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_938B32, &TrackVehicleInfo_938BC4, &TrackVehicleInfo_938C56, &TrackVehicleInfo_938CE8, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9388EA, &TrackVehicleInfo_93897C, &TrackVehicleInfo_938A0E, &TrackVehicleInfo_938AA0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_93920A, &TrackVehicleInfo_939293, &TrackVehicleInfo_93932E, &TrackVehicleInfo_9393C0,
-    &TrackVehicleInfo_939449, &TrackVehicleInfo_9394D2, &TrackVehicleInfo_939564, &TrackVehicleInfo_9395FF, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_939A85, &TrackVehicleInfo_93C476, &TrackVehicleInfo_93EE67, &TrackVehicleInfo_941858, &TrackVehicleInfo_93A898, &TrackVehicleInfo_93D289,
-    &TrackVehicleInfo_93FC7A, &TrackVehicleInfo_94266B, &TrackVehicleInfo_93B648, &TrackVehicleInfo_93E039, &TrackVehicleInfo_940A2A, &TrackVehicleInfo_94341B,
-    &TrackVehicleInfo_9443A0, &TrackVehicleInfo_94705E, &TrackVehicleInfo_949D1C, &TrackVehicleInfo_94C9DA, &TrackVehicleInfo_9459FF, &TrackVehicleInfo_9486BD,
-    &TrackVehicleInfo_94B37B, &TrackVehicleInfo_94E039,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListMiniGolfPathB11[] = {
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4,
+    TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8,
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938D7A, TrackVehicleInfo_938E0C,
+    TrackVehicleInfo_938E9E, TrackVehicleInfo_938F30, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_93845A, TrackVehicleInfo_9384EC, TrackVehicleInfo_93857E, TrackVehicleInfo_938610, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9386A2, TrackVehicleInfo_938734, TrackVehicleInfo_9387C6, TrackVehicleInfo_938858, TrackVehicleInfo_938FC2, TrackVehicleInfo_939054,
+    TrackVehicleInfo_9390E6, TrackVehicleInfo_939178, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_938B32, TrackVehicleInfo_938BC4, TrackVehicleInfo_938C56, TrackVehicleInfo_938CE8, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9388EA, TrackVehicleInfo_93897C, TrackVehicleInfo_938A0E, TrackVehicleInfo_938AA0, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_93920A, TrackVehicleInfo_939293, TrackVehicleInfo_93932E, TrackVehicleInfo_9393C0,
+    TrackVehicleInfo_939449, TrackVehicleInfo_9394D2, TrackVehicleInfo_939564, TrackVehicleInfo_9395FF, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_939A85, TrackVehicleInfo_93C476, TrackVehicleInfo_93EE67, TrackVehicleInfo_941858, TrackVehicleInfo_93A898, TrackVehicleInfo_93D289,
+    TrackVehicleInfo_93FC7A, TrackVehicleInfo_94266B, TrackVehicleInfo_93B648, TrackVehicleInfo_93E039, TrackVehicleInfo_940A2A, TrackVehicleInfo_94341B,
+    TrackVehicleInfo_9443A0, TrackVehicleInfo_94705E, TrackVehicleInfo_949D1C, TrackVehicleInfo_94C9DA, TrackVehicleInfo_9459FF, TrackVehicleInfo_9486BD,
+    TrackVehicleInfo_94B37B, TrackVehicleInfo_94E039,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListMiniGolfBallPathB12[] = {
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4,
-    &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8,
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938D7A, &TrackVehicleInfo_938E0C,
-    &TrackVehicleInfo_938E9E, &TrackVehicleInfo_938F30, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_93845A, &TrackVehicleInfo_9384EC, &TrackVehicleInfo_93857E, &TrackVehicleInfo_938610, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9386A2, &TrackVehicleInfo_938734, &TrackVehicleInfo_9387C6, &TrackVehicleInfo_938858, &TrackVehicleInfo_938FC2, &TrackVehicleInfo_939054,
-    &TrackVehicleInfo_9390E6, &TrackVehicleInfo_939178, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_938B32, &TrackVehicleInfo_938BC4, &TrackVehicleInfo_938C56, &TrackVehicleInfo_938CE8, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9388EA, &TrackVehicleInfo_93897C, &TrackVehicleInfo_938A0E, &TrackVehicleInfo_938AA0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_93920A, &TrackVehicleInfo_939293, &TrackVehicleInfo_93932E, &TrackVehicleInfo_9393C0,
-    &TrackVehicleInfo_939449, &TrackVehicleInfo_9394D2, &TrackVehicleInfo_939564, &TrackVehicleInfo_9395FF, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_939CD9, &TrackVehicleInfo_93C6CA, &TrackVehicleInfo_93F0BB, &TrackVehicleInfo_941AAC, &TrackVehicleInfo_93AB73, &TrackVehicleInfo_93D564,
-    &TrackVehicleInfo_93FF55, &TrackVehicleInfo_942946, &TrackVehicleInfo_93B8DB, &TrackVehicleInfo_93E2CC, &TrackVehicleInfo_940CBD, &TrackVehicleInfo_9436AE,
-    &TrackVehicleInfo_9446DE, &TrackVehicleInfo_94739C, &TrackVehicleInfo_94A05A, &TrackVehicleInfo_94CD18, &TrackVehicleInfo_945D3D, &TrackVehicleInfo_9489FB,
-    &TrackVehicleInfo_94B6B9, &TrackVehicleInfo_94E377,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListMiniGolfBallPathB12[] = {
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4,
+    TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8,
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938D7A, TrackVehicleInfo_938E0C,
+    TrackVehicleInfo_938E9E, TrackVehicleInfo_938F30, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_93845A, TrackVehicleInfo_9384EC, TrackVehicleInfo_93857E, TrackVehicleInfo_938610, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9386A2, TrackVehicleInfo_938734, TrackVehicleInfo_9387C6, TrackVehicleInfo_938858, TrackVehicleInfo_938FC2, TrackVehicleInfo_939054,
+    TrackVehicleInfo_9390E6, TrackVehicleInfo_939178, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_938B32, TrackVehicleInfo_938BC4, TrackVehicleInfo_938C56, TrackVehicleInfo_938CE8, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9388EA, TrackVehicleInfo_93897C, TrackVehicleInfo_938A0E, TrackVehicleInfo_938AA0, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_93920A, TrackVehicleInfo_939293, TrackVehicleInfo_93932E, TrackVehicleInfo_9393C0,
+    TrackVehicleInfo_939449, TrackVehicleInfo_9394D2, TrackVehicleInfo_939564, TrackVehicleInfo_9395FF, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_939CD9, TrackVehicleInfo_93C6CA, TrackVehicleInfo_93F0BB, TrackVehicleInfo_941AAC, TrackVehicleInfo_93AB73, TrackVehicleInfo_93D564,
+    TrackVehicleInfo_93FF55, TrackVehicleInfo_942946, TrackVehicleInfo_93B8DB, TrackVehicleInfo_93E2CC, TrackVehicleInfo_940CBD, TrackVehicleInfo_9436AE,
+    TrackVehicleInfo_9446DE, TrackVehicleInfo_94739C, TrackVehicleInfo_94A05A, TrackVehicleInfo_94CD18, TrackVehicleInfo_945D3D, TrackVehicleInfo_9489FB,
+    TrackVehicleInfo_94B6B9, TrackVehicleInfo_94E377,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListMiniGolfPathC13[] = {
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4,
-    &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8,
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938D7A, &TrackVehicleInfo_938E0C,
-    &TrackVehicleInfo_938E9E, &TrackVehicleInfo_938F30, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_93845A, &TrackVehicleInfo_9384EC, &TrackVehicleInfo_93857E, &TrackVehicleInfo_938610, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9386A2, &TrackVehicleInfo_938734, &TrackVehicleInfo_9387C6, &TrackVehicleInfo_938858, &TrackVehicleInfo_938FC2, &TrackVehicleInfo_939054,
-    &TrackVehicleInfo_9390E6, &TrackVehicleInfo_939178, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_938B32, &TrackVehicleInfo_938BC4, &TrackVehicleInfo_938C56, &TrackVehicleInfo_938CE8, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9388EA, &TrackVehicleInfo_93897C, &TrackVehicleInfo_938A0E, &TrackVehicleInfo_938AA0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_93920A, &TrackVehicleInfo_939293, &TrackVehicleInfo_93932E, &TrackVehicleInfo_9393C0,
-    &TrackVehicleInfo_939449, &TrackVehicleInfo_9394D2, &TrackVehicleInfo_939564, &TrackVehicleInfo_9395FF, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_939EAF, &TrackVehicleInfo_93C8A0, &TrackVehicleInfo_93F291, &TrackVehicleInfo_941C82, &TrackVehicleInfo_93ADA3, &TrackVehicleInfo_93D794,
-    &TrackVehicleInfo_940185, &TrackVehicleInfo_942B76, &TrackVehicleInfo_93BAB1, &TrackVehicleInfo_93E4A2, &TrackVehicleInfo_940E93, &TrackVehicleInfo_943884,
-    &TrackVehicleInfo_944AA3, &TrackVehicleInfo_947761, &TrackVehicleInfo_94A41F, &TrackVehicleInfo_94D0DD, &TrackVehicleInfo_946102, &TrackVehicleInfo_948DC0,
-    &TrackVehicleInfo_94BA7E, &TrackVehicleInfo_94E73C,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListMiniGolfPathC13[] = {
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4,
+    TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8,
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938D7A, TrackVehicleInfo_938E0C,
+    TrackVehicleInfo_938E9E, TrackVehicleInfo_938F30, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_93845A, TrackVehicleInfo_9384EC, TrackVehicleInfo_93857E, TrackVehicleInfo_938610, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9386A2, TrackVehicleInfo_938734, TrackVehicleInfo_9387C6, TrackVehicleInfo_938858, TrackVehicleInfo_938FC2, TrackVehicleInfo_939054,
+    TrackVehicleInfo_9390E6, TrackVehicleInfo_939178, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_938B32, TrackVehicleInfo_938BC4, TrackVehicleInfo_938C56, TrackVehicleInfo_938CE8, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9388EA, TrackVehicleInfo_93897C, TrackVehicleInfo_938A0E, TrackVehicleInfo_938AA0, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_93920A, TrackVehicleInfo_939293, TrackVehicleInfo_93932E, TrackVehicleInfo_9393C0,
+    TrackVehicleInfo_939449, TrackVehicleInfo_9394D2, TrackVehicleInfo_939564, TrackVehicleInfo_9395FF, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_939EAF, TrackVehicleInfo_93C8A0, TrackVehicleInfo_93F291, TrackVehicleInfo_941C82, TrackVehicleInfo_93ADA3, TrackVehicleInfo_93D794,
+    TrackVehicleInfo_940185, TrackVehicleInfo_942B76, TrackVehicleInfo_93BAB1, TrackVehicleInfo_93E4A2, TrackVehicleInfo_940E93, TrackVehicleInfo_943884,
+    TrackVehicleInfo_944AA3, TrackVehicleInfo_947761, TrackVehicleInfo_94A41F, TrackVehicleInfo_94D0DD, TrackVehicleInfo_946102, TrackVehicleInfo_948DC0,
+    TrackVehicleInfo_94BA7E, TrackVehicleInfo_94E73C,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListMiniGolfPathC14[] = {
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4,
-    &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8,
-    &TrackVehicleInfo_938212, &TrackVehicleInfo_9382A4, &TrackVehicleInfo_938336, &TrackVehicleInfo_9383C8, &TrackVehicleInfo_938D7A, &TrackVehicleInfo_938E0C,
-    &TrackVehicleInfo_938E9E, &TrackVehicleInfo_938F30, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_93845A, &TrackVehicleInfo_9384EC, &TrackVehicleInfo_93857E, &TrackVehicleInfo_938610, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9386A2, &TrackVehicleInfo_938734, &TrackVehicleInfo_9387C6, &TrackVehicleInfo_938858, &TrackVehicleInfo_938FC2, &TrackVehicleInfo_939054,
-    &TrackVehicleInfo_9390E6, &TrackVehicleInfo_939178, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_938B32, &TrackVehicleInfo_938BC4, &TrackVehicleInfo_938C56, &TrackVehicleInfo_938CE8, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_9388EA, &TrackVehicleInfo_93897C, &TrackVehicleInfo_938A0E, &TrackVehicleInfo_938AA0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_93920A, &TrackVehicleInfo_939293, &TrackVehicleInfo_93932E, &TrackVehicleInfo_9393C0,
-    &TrackVehicleInfo_939449, &TrackVehicleInfo_9394D2, &TrackVehicleInfo_939564, &TrackVehicleInfo_9395FF, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_93A1F6, &TrackVehicleInfo_93CBE7, &TrackVehicleInfo_93F5D8, &TrackVehicleInfo_941FC9, &TrackVehicleInfo_93B01B, &TrackVehicleInfo_93DA0C,
-    &TrackVehicleInfo_9403FD, &TrackVehicleInfo_942DEE, &TrackVehicleInfo_93BDCB, &TrackVehicleInfo_93E7BC, &TrackVehicleInfo_9411AD, &TrackVehicleInfo_943B9E,
-    &TrackVehicleInfo_944E3B, &TrackVehicleInfo_947AF9, &TrackVehicleInfo_94A7B7, &TrackVehicleInfo_94D475, &TrackVehicleInfo_94649A, &TrackVehicleInfo_949158,
-    &TrackVehicleInfo_94BE16, &TrackVehicleInfo_94EAD4,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListMiniGolfPathC14[] = {
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4,
+    TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8,
+    TrackVehicleInfo_938212, TrackVehicleInfo_9382A4, TrackVehicleInfo_938336, TrackVehicleInfo_9383C8, TrackVehicleInfo_938D7A, TrackVehicleInfo_938E0C,
+    TrackVehicleInfo_938E9E, TrackVehicleInfo_938F30, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_93845A, TrackVehicleInfo_9384EC, TrackVehicleInfo_93857E, TrackVehicleInfo_938610, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9386A2, TrackVehicleInfo_938734, TrackVehicleInfo_9387C6, TrackVehicleInfo_938858, TrackVehicleInfo_938FC2, TrackVehicleInfo_939054,
+    TrackVehicleInfo_9390E6, TrackVehicleInfo_939178, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_938B32, TrackVehicleInfo_938BC4, TrackVehicleInfo_938C56, TrackVehicleInfo_938CE8, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_9388EA, TrackVehicleInfo_93897C, TrackVehicleInfo_938A0E, TrackVehicleInfo_938AA0, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_93920A, TrackVehicleInfo_939293, TrackVehicleInfo_93932E, TrackVehicleInfo_9393C0,
+    TrackVehicleInfo_939449, TrackVehicleInfo_9394D2, TrackVehicleInfo_939564, TrackVehicleInfo_9395FF, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_93A1F6, TrackVehicleInfo_93CBE7, TrackVehicleInfo_93F5D8, TrackVehicleInfo_941FC9, TrackVehicleInfo_93B01B, TrackVehicleInfo_93DA0C,
+    TrackVehicleInfo_9403FD, TrackVehicleInfo_942DEE, TrackVehicleInfo_93BDCB, TrackVehicleInfo_93E7BC, TrackVehicleInfo_9411AD, TrackVehicleInfo_943B9E,
+    TrackVehicleInfo_944E3B, TrackVehicleInfo_947AF9, TrackVehicleInfo_94A7B7, TrackVehicleInfo_94D475, TrackVehicleInfo_94649A, TrackVehicleInfo_949158,
+    TrackVehicleInfo_94BE16, TrackVehicleInfo_94EAD4,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListReverserRCFrontBogie[] = {
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C,
-    &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408, &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4,
-    &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_8E39EE, &TrackVehicleInfo_8E3AB6, &TrackVehicleInfo_8E3B87, &TrackVehicleInfo_8E3C4F,
-    &TrackVehicleInfo_8E3D0E, &TrackVehicleInfo_8E3DCD, &TrackVehicleInfo_8E3E95, &TrackVehicleInfo_8E3F66, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DB70E, &TrackVehicleInfo_8DBA70, &TrackVehicleInfo_8DBDD2, &TrackVehicleInfo_8DC134, &TrackVehicleInfo_8DC496, &TrackVehicleInfo_8DC7F8,
-    &TrackVehicleInfo_8DCB5A, &TrackVehicleInfo_8DCEBC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E7AFA, &TrackVehicleInfo_8E80A5, &TrackVehicleInfo_8E8650, &TrackVehicleInfo_8E8BFB, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EC3AA, &TrackVehicleInfo_8EC715, &TrackVehicleInfo_8ECA80, &TrackVehicleInfo_8ECDEB, &TrackVehicleInfo_8ED156, &TrackVehicleInfo_8ED4C1,
-    &TrackVehicleInfo_8ED82C, &TrackVehicleInfo_8EDB97, &TrackVehicleInfo_8C6C32, &TrackVehicleInfo_8C6D78, &TrackVehicleInfo_8C6EBE, &TrackVehicleInfo_8C7004,
-    &TrackVehicleInfo_8C714A, &TrackVehicleInfo_8C7290, &TrackVehicleInfo_8C73D6, &TrackVehicleInfo_8C751C, &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8,
-    &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_8C7B7A, &TrackVehicleInfo_8C7CC0, &TrackVehicleInfo_8C7E06, &TrackVehicleInfo_8C7F4C,
-    &TrackVehicleInfo_8EFA5A, &TrackVehicleInfo_8EFDAA, &TrackVehicleInfo_8F00FA, &TrackVehicleInfo_8F044A, &TrackVehicleInfo_8F079A, &TrackVehicleInfo_8F08BC,
-    &TrackVehicleInfo_8F09DE, &TrackVehicleInfo_8F0B00, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554,
-    &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80,
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5,
-    &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408,
-    &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4, &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C,
-    &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18,
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01,
-    &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890,
-    &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496, &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D,
-    &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94,
-    &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923, &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8,
-    &TrackVehicleInfo_8F8C82, &TrackVehicleInfo_8F9143, &TrackVehicleInfo_8F9616, &TrackVehicleInfo_8F9AE9, &TrackVehicleInfo_8F9FAA, &TrackVehicleInfo_8FA46B,
-    &TrackVehicleInfo_8FA93E, &TrackVehicleInfo_8FAE11, &TrackVehicleInfo_8FB2D2, &TrackVehicleInfo_8FB793, &TrackVehicleInfo_8FBC66, &TrackVehicleInfo_8FC139,
-    &TrackVehicleInfo_8FC5FA, &TrackVehicleInfo_8FCABB, &TrackVehicleInfo_8FCF8E, &TrackVehicleInfo_8FD461, &TrackVehicleInfo_8F0C22, &TrackVehicleInfo_8F141F,
-    &TrackVehicleInfo_8F1C2E, &TrackVehicleInfo_8F243D, &TrackVehicleInfo_8F2C3A, &TrackVehicleInfo_8F3437, &TrackVehicleInfo_8F3C46, &TrackVehicleInfo_8F4455,
-    &TrackVehicleInfo_8F4C52, &TrackVehicleInfo_8F544F, &TrackVehicleInfo_8F5C5E, &TrackVehicleInfo_8F646D, &TrackVehicleInfo_8F6C6A, &TrackVehicleInfo_8F7467,
-    &TrackVehicleInfo_8F7C76, &TrackVehicleInfo_8F8485, &TrackVehicleInfo_8E402E, &TrackVehicleInfo_8E4270, &TrackVehicleInfo_8E44B2, &TrackVehicleInfo_8E46F4,
-    &TrackVehicleInfo_8E4936, &TrackVehicleInfo_8E4B78, &TrackVehicleInfo_8E4DBA, &TrackVehicleInfo_8E4FFC, &TrackVehicleInfo_8E523E, &TrackVehicleInfo_8E5480,
-    &TrackVehicleInfo_8E56C2, &TrackVehicleInfo_8E5904, &TrackVehicleInfo_8E5B46, &TrackVehicleInfo_8E5D88, &TrackVehicleInfo_8E5FCA, &TrackVehicleInfo_8E620C,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_8B0EB2, &TrackVehicleInfo_8B12B6, &TrackVehicleInfo_8B16C3, &TrackVehicleInfo_8B1AC7, &TrackVehicleInfo_8B1EC2, &TrackVehicleInfo_8B22BD,
-    &TrackVehicleInfo_8B26C1, &TrackVehicleInfo_8B2ACE, &TrackVehicleInfo_8B2ED2, &TrackVehicleInfo_8B32D6, &TrackVehicleInfo_8B36E3, &TrackVehicleInfo_8B3AE7,
-    &TrackVehicleInfo_8B3EE2, &TrackVehicleInfo_8B42DD, &TrackVehicleInfo_8B46E1, &TrackVehicleInfo_8B4AEE, &TrackVehicleInfo_8B4EF2, &TrackVehicleInfo_8B52F6,
-    &TrackVehicleInfo_8B5703, &TrackVehicleInfo_8B5B07, &TrackVehicleInfo_8B5F02, &TrackVehicleInfo_8B62FD, &TrackVehicleInfo_8B6701, &TrackVehicleInfo_8B6B0E,
-    &TrackVehicleInfo_8B6F12, &TrackVehicleInfo_8B7316, &TrackVehicleInfo_8B7723, &TrackVehicleInfo_8B7B27, &TrackVehicleInfo_8B7F22, &TrackVehicleInfo_8B831D,
-    &TrackVehicleInfo_8B8721, &TrackVehicleInfo_8B8B2E, &TrackVehicleInfo_968C6E, &TrackVehicleInfo_968D90, &TrackVehicleInfo_968EB2, &TrackVehicleInfo_968FD4,
-    &TrackVehicleInfo_96957E, &TrackVehicleInfo_9696A0, &TrackVehicleInfo_9697C2, &TrackVehicleInfo_9698E4, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9048E8, &TrackVehicleInfo_904A0A, &TrackVehicleInfo_904B2C, &TrackVehicleInfo_904C4E,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9690F6, &TrackVehicleInfo_969218,
-    &TrackVehicleInfo_96933A, &TrackVehicleInfo_96945C, &TrackVehicleInfo_969A06, &TrackVehicleInfo_969B28, &TrackVehicleInfo_969C4A, &TrackVehicleInfo_969D6C,
-    &TrackVehicleInfo_904D72, &TrackVehicleInfo_905314, &TrackVehicleInfo_9058B6, &TrackVehicleInfo_905E58, &TrackVehicleInfo_96D4AE, &TrackVehicleInfo_96D9A5,
-    &TrackVehicleInfo_96DE9C, &TrackVehicleInfo_96E393, &TrackVehicleInfo_96E88A, &TrackVehicleInfo_96ED81, &TrackVehicleInfo_96F278, &TrackVehicleInfo_96F76F,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_971042, &TrackVehicleInfo_971539,
-    &TrackVehicleInfo_971A30, &TrackVehicleInfo_971F27, &TrackVehicleInfo_96FC66, &TrackVehicleInfo_97015D, &TrackVehicleInfo_970654, &TrackVehicleInfo_970B4B,
-    &TrackVehicleInfo_97241E, &TrackVehicleInfo_9729ED, &TrackVehicleInfo_972FBC, &TrackVehicleInfo_97358B, &TrackVehicleInfo_9063FA, &TrackVehicleInfo_906EAC,
-    &TrackVehicleInfo_90795E, &TrackVehicleInfo_908410, &TrackVehicleInfo_90B98A, &TrackVehicleInfo_90BC5C, &TrackVehicleInfo_90BF2E, &TrackVehicleInfo_90C200,
-    &TrackVehicleInfo_90E02A, &TrackVehicleInfo_90E14C, &TrackVehicleInfo_90E26E, &TrackVehicleInfo_90E390, &TrackVehicleInfo_90E4B2, &TrackVehicleInfo_90E5D4,
-    &TrackVehicleInfo_90E6F6, &TrackVehicleInfo_90E818, &TrackVehicleInfo_90E93A, &TrackVehicleInfo_90EB34, &TrackVehicleInfo_90ED2E, &TrackVehicleInfo_90EF28,
-    &TrackVehicleInfo_9100F2, &TrackVehicleInfo_9102EC, &TrackVehicleInfo_9104E6, &TrackVehicleInfo_9106E0, &TrackVehicleInfo_90F122, &TrackVehicleInfo_90F31C,
-    &TrackVehicleInfo_90F516, &TrackVehicleInfo_90F710, &TrackVehicleInfo_90F90A, &TrackVehicleInfo_90FB04, &TrackVehicleInfo_90FCFE, &TrackVehicleInfo_90FEF8,
-    &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8, &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_9108DA, &TrackVehicleInfo_910BA3,
-    &TrackVehicleInfo_910E75, &TrackVehicleInfo_911147, &TrackVehicleInfo_911F58, &TrackVehicleInfo_91222A, &TrackVehicleInfo_9124FC, &TrackVehicleInfo_9127CE,
-    &TrackVehicleInfo_911419, &TrackVehicleInfo_9116E2, &TrackVehicleInfo_9119B4, &TrackVehicleInfo_911C86, &TrackVehicleInfo_912AA0, &TrackVehicleInfo_912D69,
-    &TrackVehicleInfo_91303B, &TrackVehicleInfo_91330D, &TrackVehicleInfo_9135DF, &TrackVehicleInfo_9138A8, &TrackVehicleInfo_913B7A, &TrackVehicleInfo_913E4C,
-    &TrackVehicleInfo_914C5D, &TrackVehicleInfo_914F2F, &TrackVehicleInfo_915201, &TrackVehicleInfo_9154D3, &TrackVehicleInfo_91411E, &TrackVehicleInfo_9143E7,
-    &TrackVehicleInfo_9146B9, &TrackVehicleInfo_91498B, &TrackVehicleInfo_9157A5, &TrackVehicleInfo_915A6E, &TrackVehicleInfo_915D40, &TrackVehicleInfo_916012,
-    &TrackVehicleInfo_9162E6, &TrackVehicleInfo_916408, &TrackVehicleInfo_91652A, &TrackVehicleInfo_91664C, &TrackVehicleInfo_91676E, &TrackVehicleInfo_916890,
-    &TrackVehicleInfo_9169B2, &TrackVehicleInfo_916AD4, &TrackVehicleInfo_91707E, &TrackVehicleInfo_9172C0, &TrackVehicleInfo_917502, &TrackVehicleInfo_917744,
-    &TrackVehicleInfo_91828E, &TrackVehicleInfo_9183B0, &TrackVehicleInfo_9184D2, &TrackVehicleInfo_9185F4, &TrackVehicleInfo_9194F6, &TrackVehicleInfo_919645,
-    &TrackVehicleInfo_919794, &TrackVehicleInfo_9198E3, &TrackVehicleInfo_919A32, &TrackVehicleInfo_919B81, &TrackVehicleInfo_919CD0, &TrackVehicleInfo_919E1F,
-    &TrackVehicleInfo_918716, &TrackVehicleInfo_91884A, &TrackVehicleInfo_91897E, &TrackVehicleInfo_918AB2, &TrackVehicleInfo_916BF6, &TrackVehicleInfo_916D18,
-    &TrackVehicleInfo_916E3A, &TrackVehicleInfo_916F5C, &TrackVehicleInfo_917986, &TrackVehicleInfo_917BC8, &TrackVehicleInfo_917E0A, &TrackVehicleInfo_91804C,
-    &TrackVehicleInfo_91906E, &TrackVehicleInfo_919190, &TrackVehicleInfo_9192B2, &TrackVehicleInfo_9193D4, &TrackVehicleInfo_91A4AA, &TrackVehicleInfo_91A5F9,
-    &TrackVehicleInfo_91A748, &TrackVehicleInfo_91A897, &TrackVehicleInfo_919F6E, &TrackVehicleInfo_91A0BD, &TrackVehicleInfo_91A20C, &TrackVehicleInfo_91A35B,
-    &TrackVehicleInfo_918BE6, &TrackVehicleInfo_918D08, &TrackVehicleInfo_918E2A, &TrackVehicleInfo_918F4C, &TrackVehicleInfo_91A9E6, &TrackVehicleInfo_91AB2C,
-    &TrackVehicleInfo_91AC72, &TrackVehicleInfo_91ADB8, &TrackVehicleInfo_91AEFE, &TrackVehicleInfo_91B044, &TrackVehicleInfo_91B18A, &TrackVehicleInfo_91B2D0,
-    &TrackVehicleInfo_91B416, &TrackVehicleInfo_91B55C, &TrackVehicleInfo_91B6A2, &TrackVehicleInfo_91B7E8, &TrackVehicleInfo_91B92E, &TrackVehicleInfo_91BA74,
-    &TrackVehicleInfo_91BBBA, &TrackVehicleInfo_91BD00, &TrackVehicleInfo_95787E, &TrackVehicleInfo_9579A0, &TrackVehicleInfo_957AC2, &TrackVehicleInfo_957BE4,
-    &TrackVehicleInfo_957D06, &TrackVehicleInfo_957E28, &TrackVehicleInfo_957F4A, &TrackVehicleInfo_95806C, &TrackVehicleInfo_95818E, &TrackVehicleInfo_9582B0,
-    &TrackVehicleInfo_9583D2, &TrackVehicleInfo_9584F4, &TrackVehicleInfo_958616, &TrackVehicleInfo_958738, &TrackVehicleInfo_95885A, &TrackVehicleInfo_95897C,
-    &TrackVehicleInfo_958A9E, &TrackVehicleInfo_958BC0, &TrackVehicleInfo_958CE2, &TrackVehicleInfo_958E04, &TrackVehicleInfo_958F26, &TrackVehicleInfo_959048,
-    &TrackVehicleInfo_95916A, &TrackVehicleInfo_95928C, &TrackVehicleInfo_9593AE, &TrackVehicleInfo_9594E2, &TrackVehicleInfo_959616, &TrackVehicleInfo_95974A,
-    &TrackVehicleInfo_95987E, &TrackVehicleInfo_9599B2, &TrackVehicleInfo_959AE6, &TrackVehicleInfo_959C1A, &TrackVehicleInfo_95A65E, &TrackVehicleInfo_95A780,
-    &TrackVehicleInfo_95A8A2, &TrackVehicleInfo_95A9C4, &TrackVehicleInfo_95AAE6, &TrackVehicleInfo_95AC08, &TrackVehicleInfo_95AD2A, &TrackVehicleInfo_95AE4C,
-    &TrackVehicleInfo_959D4E, &TrackVehicleInfo_959E70, &TrackVehicleInfo_959F92, &TrackVehicleInfo_95A0B4, &TrackVehicleInfo_95A1D6, &TrackVehicleInfo_95A2F8,
-    &TrackVehicleInfo_95A41A, &TrackVehicleInfo_95A53C, &TrackVehicleInfo_95AF6E, &TrackVehicleInfo_95B090, &TrackVehicleInfo_95B1B2, &TrackVehicleInfo_95B2D4,
-    &TrackVehicleInfo_95B3F6, &TrackVehicleInfo_95B518, &TrackVehicleInfo_95B63A, &TrackVehicleInfo_95B75C, &TrackVehicleInfo_91BE46, &TrackVehicleInfo_91C001,
-    &TrackVehicleInfo_91C1BC, &TrackVehicleInfo_91C377, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_91C532, &TrackVehicleInfo_91C894, &TrackVehicleInfo_91CBF6, &TrackVehicleInfo_91CF58, &TrackVehicleInfo_91D2BA, &TrackVehicleInfo_91D61C,
-    &TrackVehicleInfo_91D97E, &TrackVehicleInfo_91DCE0, &TrackVehicleInfo_91E042, &TrackVehicleInfo_91E3A4, &TrackVehicleInfo_91E706, &TrackVehicleInfo_91EA68,
-    &TrackVehicleInfo_91EDCA, &TrackVehicleInfo_91F12C, &TrackVehicleInfo_91F48E, &TrackVehicleInfo_91F7F0, &TrackVehicleInfo_920E82, &TrackVehicleInfo_9210E8,
-    &TrackVehicleInfo_921357, &TrackVehicleInfo_9215BD, &TrackVehicleInfo_92181A, &TrackVehicleInfo_921A77, &TrackVehicleInfo_921CDD, &TrackVehicleInfo_921F4C,
-    &TrackVehicleInfo_91FB52, &TrackVehicleInfo_91FDB8, &TrackVehicleInfo_920027, &TrackVehicleInfo_92028D, &TrackVehicleInfo_9204EA, &TrackVehicleInfo_920747,
-    &TrackVehicleInfo_9209AD, &TrackVehicleInfo_920C1C, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690,
-    &TrackVehicleInfo_9221B2, &TrackVehicleInfo_9237A6, &TrackVehicleInfo_924D9A, &TrackVehicleInfo_92638E, &TrackVehicleInfo_922CAC, &TrackVehicleInfo_9242A0,
-    &TrackVehicleInfo_925894, &TrackVehicleInfo_926E88, &TrackVehicleInfo_927982, &TrackVehicleInfo_928F76, &TrackVehicleInfo_92A56A, &TrackVehicleInfo_92BB5E,
-    &TrackVehicleInfo_92847C, &TrackVehicleInfo_929A70, &TrackVehicleInfo_92B064, &TrackVehicleInfo_92C658, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DD21E, &TrackVehicleInfo_8DD580, &TrackVehicleInfo_8DD8E2, &TrackVehicleInfo_8DDC44, &TrackVehicleInfo_8DDFA6, &TrackVehicleInfo_8DE308,
-    &TrackVehicleInfo_8DE66A, &TrackVehicleInfo_8DE9CC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E91A6, &TrackVehicleInfo_8E9751, &TrackVehicleInfo_8E9CFC, &TrackVehicleInfo_8EA2A7, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EDF02, &TrackVehicleInfo_8EE26D, &TrackVehicleInfo_8EE5D8, &TrackVehicleInfo_8EE943, &TrackVehicleInfo_8EECAE, &TrackVehicleInfo_8EF019,
-    &TrackVehicleInfo_8EF384, &TrackVehicleInfo_8EF6EF, &TrackVehicleInfo_92D152, &TrackVehicleInfo_92D6F4, &TrackVehicleInfo_92DC96, &TrackVehicleInfo_92E238,
-    &TrackVehicleInfo_92E7DA, &TrackVehicleInfo_92ED7C, &TrackVehicleInfo_92F31E, &TrackVehicleInfo_92F8C0, &TrackVehicleInfo_92FE62, &TrackVehicleInfo_930524,
-    &TrackVehicleInfo_930BE6, &TrackVehicleInfo_9312A8, &TrackVehicleInfo_93196A, &TrackVehicleInfo_93202C, &TrackVehicleInfo_9326EE, &TrackVehicleInfo_932DB0,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_95275E, &TrackVehicleInfo_952AC0,
-    &TrackVehicleInfo_952E22, &TrackVehicleInfo_953184, &TrackVehicleInfo_9534E6, &TrackVehicleInfo_953848, &TrackVehicleInfo_953BAA, &TrackVehicleInfo_953F0C,
-    &TrackVehicleInfo_90C4D2, &TrackVehicleInfo_90C8D6, &TrackVehicleInfo_90CCDA, &TrackVehicleInfo_90D0DE, &TrackVehicleInfo_90D4E2, &TrackVehicleInfo_90D7B4,
-    &TrackVehicleInfo_90DA86, &TrackVehicleInfo_90DD58, &TrackVehicleInfo_908EC2, &TrackVehicleInfo_909974, &TrackVehicleInfo_90A426, &TrackVehicleInfo_90AED8,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListReverserRCFrontBogie[] = {
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C,
+    TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408, TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4,
+    TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_8E39EE, TrackVehicleInfo_8E3AB6, TrackVehicleInfo_8E3B87, TrackVehicleInfo_8E3C4F,
+    TrackVehicleInfo_8E3D0E, TrackVehicleInfo_8E3DCD, TrackVehicleInfo_8E3E95, TrackVehicleInfo_8E3F66, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DB70E, TrackVehicleInfo_8DBA70, TrackVehicleInfo_8DBDD2, TrackVehicleInfo_8DC134, TrackVehicleInfo_8DC496, TrackVehicleInfo_8DC7F8,
+    TrackVehicleInfo_8DCB5A, TrackVehicleInfo_8DCEBC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E7AFA, TrackVehicleInfo_8E80A5, TrackVehicleInfo_8E8650, TrackVehicleInfo_8E8BFB, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EC3AA, TrackVehicleInfo_8EC715, TrackVehicleInfo_8ECA80, TrackVehicleInfo_8ECDEB, TrackVehicleInfo_8ED156, TrackVehicleInfo_8ED4C1,
+    TrackVehicleInfo_8ED82C, TrackVehicleInfo_8EDB97, TrackVehicleInfo_8C6C32, TrackVehicleInfo_8C6D78, TrackVehicleInfo_8C6EBE, TrackVehicleInfo_8C7004,
+    TrackVehicleInfo_8C714A, TrackVehicleInfo_8C7290, TrackVehicleInfo_8C73D6, TrackVehicleInfo_8C751C, TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8,
+    TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_8C7B7A, TrackVehicleInfo_8C7CC0, TrackVehicleInfo_8C7E06, TrackVehicleInfo_8C7F4C,
+    TrackVehicleInfo_8EFA5A, TrackVehicleInfo_8EFDAA, TrackVehicleInfo_8F00FA, TrackVehicleInfo_8F044A, TrackVehicleInfo_8F079A, TrackVehicleInfo_8F08BC,
+    TrackVehicleInfo_8F09DE, TrackVehicleInfo_8F0B00, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554,
+    TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80,
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5,
+    TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408,
+    TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4, TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C,
+    TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18,
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01,
+    TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890,
+    TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496, TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D,
+    TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94,
+    TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923, TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8,
+    TrackVehicleInfo_8F8C82, TrackVehicleInfo_8F9143, TrackVehicleInfo_8F9616, TrackVehicleInfo_8F9AE9, TrackVehicleInfo_8F9FAA, TrackVehicleInfo_8FA46B,
+    TrackVehicleInfo_8FA93E, TrackVehicleInfo_8FAE11, TrackVehicleInfo_8FB2D2, TrackVehicleInfo_8FB793, TrackVehicleInfo_8FBC66, TrackVehicleInfo_8FC139,
+    TrackVehicleInfo_8FC5FA, TrackVehicleInfo_8FCABB, TrackVehicleInfo_8FCF8E, TrackVehicleInfo_8FD461, TrackVehicleInfo_8F0C22, TrackVehicleInfo_8F141F,
+    TrackVehicleInfo_8F1C2E, TrackVehicleInfo_8F243D, TrackVehicleInfo_8F2C3A, TrackVehicleInfo_8F3437, TrackVehicleInfo_8F3C46, TrackVehicleInfo_8F4455,
+    TrackVehicleInfo_8F4C52, TrackVehicleInfo_8F544F, TrackVehicleInfo_8F5C5E, TrackVehicleInfo_8F646D, TrackVehicleInfo_8F6C6A, TrackVehicleInfo_8F7467,
+    TrackVehicleInfo_8F7C76, TrackVehicleInfo_8F8485, TrackVehicleInfo_8E402E, TrackVehicleInfo_8E4270, TrackVehicleInfo_8E44B2, TrackVehicleInfo_8E46F4,
+    TrackVehicleInfo_8E4936, TrackVehicleInfo_8E4B78, TrackVehicleInfo_8E4DBA, TrackVehicleInfo_8E4FFC, TrackVehicleInfo_8E523E, TrackVehicleInfo_8E5480,
+    TrackVehicleInfo_8E56C2, TrackVehicleInfo_8E5904, TrackVehicleInfo_8E5B46, TrackVehicleInfo_8E5D88, TrackVehicleInfo_8E5FCA, TrackVehicleInfo_8E620C,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_8B0EB2, TrackVehicleInfo_8B12B6, TrackVehicleInfo_8B16C3, TrackVehicleInfo_8B1AC7, TrackVehicleInfo_8B1EC2, TrackVehicleInfo_8B22BD,
+    TrackVehicleInfo_8B26C1, TrackVehicleInfo_8B2ACE, TrackVehicleInfo_8B2ED2, TrackVehicleInfo_8B32D6, TrackVehicleInfo_8B36E3, TrackVehicleInfo_8B3AE7,
+    TrackVehicleInfo_8B3EE2, TrackVehicleInfo_8B42DD, TrackVehicleInfo_8B46E1, TrackVehicleInfo_8B4AEE, TrackVehicleInfo_8B4EF2, TrackVehicleInfo_8B52F6,
+    TrackVehicleInfo_8B5703, TrackVehicleInfo_8B5B07, TrackVehicleInfo_8B5F02, TrackVehicleInfo_8B62FD, TrackVehicleInfo_8B6701, TrackVehicleInfo_8B6B0E,
+    TrackVehicleInfo_8B6F12, TrackVehicleInfo_8B7316, TrackVehicleInfo_8B7723, TrackVehicleInfo_8B7B27, TrackVehicleInfo_8B7F22, TrackVehicleInfo_8B831D,
+    TrackVehicleInfo_8B8721, TrackVehicleInfo_8B8B2E, TrackVehicleInfo_968C6E, TrackVehicleInfo_968D90, TrackVehicleInfo_968EB2, TrackVehicleInfo_968FD4,
+    TrackVehicleInfo_96957E, TrackVehicleInfo_9696A0, TrackVehicleInfo_9697C2, TrackVehicleInfo_9698E4, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9048E8, TrackVehicleInfo_904A0A, TrackVehicleInfo_904B2C, TrackVehicleInfo_904C4E,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9690F6, TrackVehicleInfo_969218,
+    TrackVehicleInfo_96933A, TrackVehicleInfo_96945C, TrackVehicleInfo_969A06, TrackVehicleInfo_969B28, TrackVehicleInfo_969C4A, TrackVehicleInfo_969D6C,
+    TrackVehicleInfo_904D72, TrackVehicleInfo_905314, TrackVehicleInfo_9058B6, TrackVehicleInfo_905E58, TrackVehicleInfo_96D4AE, TrackVehicleInfo_96D9A5,
+    TrackVehicleInfo_96DE9C, TrackVehicleInfo_96E393, TrackVehicleInfo_96E88A, TrackVehicleInfo_96ED81, TrackVehicleInfo_96F278, TrackVehicleInfo_96F76F,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_971042, TrackVehicleInfo_971539,
+    TrackVehicleInfo_971A30, TrackVehicleInfo_971F27, TrackVehicleInfo_96FC66, TrackVehicleInfo_97015D, TrackVehicleInfo_970654, TrackVehicleInfo_970B4B,
+    TrackVehicleInfo_97241E, TrackVehicleInfo_9729ED, TrackVehicleInfo_972FBC, TrackVehicleInfo_97358B, TrackVehicleInfo_9063FA, TrackVehicleInfo_906EAC,
+    TrackVehicleInfo_90795E, TrackVehicleInfo_908410, TrackVehicleInfo_90B98A, TrackVehicleInfo_90BC5C, TrackVehicleInfo_90BF2E, TrackVehicleInfo_90C200,
+    TrackVehicleInfo_90E02A, TrackVehicleInfo_90E14C, TrackVehicleInfo_90E26E, TrackVehicleInfo_90E390, TrackVehicleInfo_90E4B2, TrackVehicleInfo_90E5D4,
+    TrackVehicleInfo_90E6F6, TrackVehicleInfo_90E818, TrackVehicleInfo_90E93A, TrackVehicleInfo_90EB34, TrackVehicleInfo_90ED2E, TrackVehicleInfo_90EF28,
+    TrackVehicleInfo_9100F2, TrackVehicleInfo_9102EC, TrackVehicleInfo_9104E6, TrackVehicleInfo_9106E0, TrackVehicleInfo_90F122, TrackVehicleInfo_90F31C,
+    TrackVehicleInfo_90F516, TrackVehicleInfo_90F710, TrackVehicleInfo_90F90A, TrackVehicleInfo_90FB04, TrackVehicleInfo_90FCFE, TrackVehicleInfo_90FEF8,
+    TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8, TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_9108DA, TrackVehicleInfo_910BA3,
+    TrackVehicleInfo_910E75, TrackVehicleInfo_911147, TrackVehicleInfo_911F58, TrackVehicleInfo_91222A, TrackVehicleInfo_9124FC, TrackVehicleInfo_9127CE,
+    TrackVehicleInfo_911419, TrackVehicleInfo_9116E2, TrackVehicleInfo_9119B4, TrackVehicleInfo_911C86, TrackVehicleInfo_912AA0, TrackVehicleInfo_912D69,
+    TrackVehicleInfo_91303B, TrackVehicleInfo_91330D, TrackVehicleInfo_9135DF, TrackVehicleInfo_9138A8, TrackVehicleInfo_913B7A, TrackVehicleInfo_913E4C,
+    TrackVehicleInfo_914C5D, TrackVehicleInfo_914F2F, TrackVehicleInfo_915201, TrackVehicleInfo_9154D3, TrackVehicleInfo_91411E, TrackVehicleInfo_9143E7,
+    TrackVehicleInfo_9146B9, TrackVehicleInfo_91498B, TrackVehicleInfo_9157A5, TrackVehicleInfo_915A6E, TrackVehicleInfo_915D40, TrackVehicleInfo_916012,
+    TrackVehicleInfo_9162E6, TrackVehicleInfo_916408, TrackVehicleInfo_91652A, TrackVehicleInfo_91664C, TrackVehicleInfo_91676E, TrackVehicleInfo_916890,
+    TrackVehicleInfo_9169B2, TrackVehicleInfo_916AD4, TrackVehicleInfo_91707E, TrackVehicleInfo_9172C0, TrackVehicleInfo_917502, TrackVehicleInfo_917744,
+    TrackVehicleInfo_91828E, TrackVehicleInfo_9183B0, TrackVehicleInfo_9184D2, TrackVehicleInfo_9185F4, TrackVehicleInfo_9194F6, TrackVehicleInfo_919645,
+    TrackVehicleInfo_919794, TrackVehicleInfo_9198E3, TrackVehicleInfo_919A32, TrackVehicleInfo_919B81, TrackVehicleInfo_919CD0, TrackVehicleInfo_919E1F,
+    TrackVehicleInfo_918716, TrackVehicleInfo_91884A, TrackVehicleInfo_91897E, TrackVehicleInfo_918AB2, TrackVehicleInfo_916BF6, TrackVehicleInfo_916D18,
+    TrackVehicleInfo_916E3A, TrackVehicleInfo_916F5C, TrackVehicleInfo_917986, TrackVehicleInfo_917BC8, TrackVehicleInfo_917E0A, TrackVehicleInfo_91804C,
+    TrackVehicleInfo_91906E, TrackVehicleInfo_919190, TrackVehicleInfo_9192B2, TrackVehicleInfo_9193D4, TrackVehicleInfo_91A4AA, TrackVehicleInfo_91A5F9,
+    TrackVehicleInfo_91A748, TrackVehicleInfo_91A897, TrackVehicleInfo_919F6E, TrackVehicleInfo_91A0BD, TrackVehicleInfo_91A20C, TrackVehicleInfo_91A35B,
+    TrackVehicleInfo_918BE6, TrackVehicleInfo_918D08, TrackVehicleInfo_918E2A, TrackVehicleInfo_918F4C, TrackVehicleInfo_91A9E6, TrackVehicleInfo_91AB2C,
+    TrackVehicleInfo_91AC72, TrackVehicleInfo_91ADB8, TrackVehicleInfo_91AEFE, TrackVehicleInfo_91B044, TrackVehicleInfo_91B18A, TrackVehicleInfo_91B2D0,
+    TrackVehicleInfo_91B416, TrackVehicleInfo_91B55C, TrackVehicleInfo_91B6A2, TrackVehicleInfo_91B7E8, TrackVehicleInfo_91B92E, TrackVehicleInfo_91BA74,
+    TrackVehicleInfo_91BBBA, TrackVehicleInfo_91BD00, TrackVehicleInfo_95787E, TrackVehicleInfo_9579A0, TrackVehicleInfo_957AC2, TrackVehicleInfo_957BE4,
+    TrackVehicleInfo_957D06, TrackVehicleInfo_957E28, TrackVehicleInfo_957F4A, TrackVehicleInfo_95806C, TrackVehicleInfo_95818E, TrackVehicleInfo_9582B0,
+    TrackVehicleInfo_9583D2, TrackVehicleInfo_9584F4, TrackVehicleInfo_958616, TrackVehicleInfo_958738, TrackVehicleInfo_95885A, TrackVehicleInfo_95897C,
+    TrackVehicleInfo_958A9E, TrackVehicleInfo_958BC0, TrackVehicleInfo_958CE2, TrackVehicleInfo_958E04, TrackVehicleInfo_958F26, TrackVehicleInfo_959048,
+    TrackVehicleInfo_95916A, TrackVehicleInfo_95928C, TrackVehicleInfo_9593AE, TrackVehicleInfo_9594E2, TrackVehicleInfo_959616, TrackVehicleInfo_95974A,
+    TrackVehicleInfo_95987E, TrackVehicleInfo_9599B2, TrackVehicleInfo_959AE6, TrackVehicleInfo_959C1A, TrackVehicleInfo_95A65E, TrackVehicleInfo_95A780,
+    TrackVehicleInfo_95A8A2, TrackVehicleInfo_95A9C4, TrackVehicleInfo_95AAE6, TrackVehicleInfo_95AC08, TrackVehicleInfo_95AD2A, TrackVehicleInfo_95AE4C,
+    TrackVehicleInfo_959D4E, TrackVehicleInfo_959E70, TrackVehicleInfo_959F92, TrackVehicleInfo_95A0B4, TrackVehicleInfo_95A1D6, TrackVehicleInfo_95A2F8,
+    TrackVehicleInfo_95A41A, TrackVehicleInfo_95A53C, TrackVehicleInfo_95AF6E, TrackVehicleInfo_95B090, TrackVehicleInfo_95B1B2, TrackVehicleInfo_95B2D4,
+    TrackVehicleInfo_95B3F6, TrackVehicleInfo_95B518, TrackVehicleInfo_95B63A, TrackVehicleInfo_95B75C, TrackVehicleInfo_91BE46, TrackVehicleInfo_91C001,
+    TrackVehicleInfo_91C1BC, TrackVehicleInfo_91C377, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_91C532, TrackVehicleInfo_91C894, TrackVehicleInfo_91CBF6, TrackVehicleInfo_91CF58, TrackVehicleInfo_91D2BA, TrackVehicleInfo_91D61C,
+    TrackVehicleInfo_91D97E, TrackVehicleInfo_91DCE0, TrackVehicleInfo_91E042, TrackVehicleInfo_91E3A4, TrackVehicleInfo_91E706, TrackVehicleInfo_91EA68,
+    TrackVehicleInfo_91EDCA, TrackVehicleInfo_91F12C, TrackVehicleInfo_91F48E, TrackVehicleInfo_91F7F0, TrackVehicleInfo_920E82, TrackVehicleInfo_9210E8,
+    TrackVehicleInfo_921357, TrackVehicleInfo_9215BD, TrackVehicleInfo_92181A, TrackVehicleInfo_921A77, TrackVehicleInfo_921CDD, TrackVehicleInfo_921F4C,
+    TrackVehicleInfo_91FB52, TrackVehicleInfo_91FDB8, TrackVehicleInfo_920027, TrackVehicleInfo_92028D, TrackVehicleInfo_9204EA, TrackVehicleInfo_920747,
+    TrackVehicleInfo_9209AD, TrackVehicleInfo_920C1C, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690,
+    TrackVehicleInfo_9221B2, TrackVehicleInfo_9237A6, TrackVehicleInfo_924D9A, TrackVehicleInfo_92638E, TrackVehicleInfo_922CAC, TrackVehicleInfo_9242A0,
+    TrackVehicleInfo_925894, TrackVehicleInfo_926E88, TrackVehicleInfo_927982, TrackVehicleInfo_928F76, TrackVehicleInfo_92A56A, TrackVehicleInfo_92BB5E,
+    TrackVehicleInfo_92847C, TrackVehicleInfo_929A70, TrackVehicleInfo_92B064, TrackVehicleInfo_92C658, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DD21E, TrackVehicleInfo_8DD580, TrackVehicleInfo_8DD8E2, TrackVehicleInfo_8DDC44, TrackVehicleInfo_8DDFA6, TrackVehicleInfo_8DE308,
+    TrackVehicleInfo_8DE66A, TrackVehicleInfo_8DE9CC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E91A6, TrackVehicleInfo_8E9751, TrackVehicleInfo_8E9CFC, TrackVehicleInfo_8EA2A7, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EDF02, TrackVehicleInfo_8EE26D, TrackVehicleInfo_8EE5D8, TrackVehicleInfo_8EE943, TrackVehicleInfo_8EECAE, TrackVehicleInfo_8EF019,
+    TrackVehicleInfo_8EF384, TrackVehicleInfo_8EF6EF, TrackVehicleInfo_92D152, TrackVehicleInfo_92D6F4, TrackVehicleInfo_92DC96, TrackVehicleInfo_92E238,
+    TrackVehicleInfo_92E7DA, TrackVehicleInfo_92ED7C, TrackVehicleInfo_92F31E, TrackVehicleInfo_92F8C0, TrackVehicleInfo_92FE62, TrackVehicleInfo_930524,
+    TrackVehicleInfo_930BE6, TrackVehicleInfo_9312A8, TrackVehicleInfo_93196A, TrackVehicleInfo_93202C, TrackVehicleInfo_9326EE, TrackVehicleInfo_932DB0,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_95275E, TrackVehicleInfo_952AC0,
+    TrackVehicleInfo_952E22, TrackVehicleInfo_953184, TrackVehicleInfo_9534E6, TrackVehicleInfo_953848, TrackVehicleInfo_953BAA, TrackVehicleInfo_953F0C,
+    TrackVehicleInfo_90C4D2, TrackVehicleInfo_90C8D6, TrackVehicleInfo_90CCDA, TrackVehicleInfo_90D0DE, TrackVehicleInfo_90D4E2, TrackVehicleInfo_90D7B4,
+    TrackVehicleInfo_90DA86, TrackVehicleInfo_90DD58, TrackVehicleInfo_908EC2, TrackVehicleInfo_909974, TrackVehicleInfo_90A426, TrackVehicleInfo_90AED8,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
 };
 
-static constexpr const rct_vehicle_info_list *TrackVehicleInfoListReverserRCRearBogie[] = {
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C,
-    &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554, &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8,
-    &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80, &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89,
-    &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5, &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763,
-    &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408, &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4,
-    &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C, &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300,
-    &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18, &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D,
-    &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01, &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F,
-    &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890, &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496,
-    &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D, &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE,
-    &TrackVehicleInfo_8C3542, &TrackVehicleInfo_8C3664, &TrackVehicleInfo_8C3786, &TrackVehicleInfo_8C38A8, &TrackVehicleInfo_8C39CA, &TrackVehicleInfo_8C3AEC,
-    &TrackVehicleInfo_8C3C0E, &TrackVehicleInfo_8C3D30, &TrackVehicleInfo_8C3E52, &TrackVehicleInfo_8C3F74, &TrackVehicleInfo_8C4096, &TrackVehicleInfo_8C41B8,
-    &TrackVehicleInfo_8C42DA, &TrackVehicleInfo_8C43FC, &TrackVehicleInfo_8C451E, &TrackVehicleInfo_8C4640, &TrackVehicleInfo_8CA0B2, &TrackVehicleInfo_8CA4B6,
-    &TrackVehicleInfo_8CA8C3, &TrackVehicleInfo_8CACC7, &TrackVehicleInfo_8CB0C2, &TrackVehicleInfo_8CB4BD, &TrackVehicleInfo_8CB8C1, &TrackVehicleInfo_8CBCCE,
-    &TrackVehicleInfo_8C4762, &TrackVehicleInfo_8C4884, &TrackVehicleInfo_8C49A6, &TrackVehicleInfo_8C4AC8, &TrackVehicleInfo_8C4BEA, &TrackVehicleInfo_8C4D0C,
-    &TrackVehicleInfo_8C4E2E, &TrackVehicleInfo_8C4F50, &TrackVehicleInfo_8C5072, &TrackVehicleInfo_8C51A6, &TrackVehicleInfo_8C52DA, &TrackVehicleInfo_8C540E,
-    &TrackVehicleInfo_8C5542, &TrackVehicleInfo_8C5676, &TrackVehicleInfo_8C57AA, &TrackVehicleInfo_8C58DE, &TrackVehicleInfo_8C6322, &TrackVehicleInfo_8C6444,
-    &TrackVehicleInfo_8C6566, &TrackVehicleInfo_8C6688, &TrackVehicleInfo_8C67AA, &TrackVehicleInfo_8C68CC, &TrackVehicleInfo_8C69EE, &TrackVehicleInfo_8C6B10,
-    &TrackVehicleInfo_8C5A12, &TrackVehicleInfo_8C5B34, &TrackVehicleInfo_8C5C56, &TrackVehicleInfo_8C5D78, &TrackVehicleInfo_8C5E9A, &TrackVehicleInfo_8C5FBC,
-    &TrackVehicleInfo_8C60DE, &TrackVehicleInfo_8C6200, &TrackVehicleInfo_8BEA02, &TrackVehicleInfo_8BEB24, &TrackVehicleInfo_8BEC46, &TrackVehicleInfo_8BED68,
-    &TrackVehicleInfo_8BEE8A, &TrackVehicleInfo_8BEFAC, &TrackVehicleInfo_8BF0CE, &TrackVehicleInfo_8BF1F0, &TrackVehicleInfo_8D047E, &TrackVehicleInfo_8D0882,
-    &TrackVehicleInfo_8D0C8F, &TrackVehicleInfo_8D1093, &TrackVehicleInfo_8D148E, &TrackVehicleInfo_8D1889, &TrackVehicleInfo_8D1C8D, &TrackVehicleInfo_8D209A,
-    &TrackVehicleInfo_8D249E, &TrackVehicleInfo_8D28A2, &TrackVehicleInfo_8D2CAF, &TrackVehicleInfo_8D30B3, &TrackVehicleInfo_8D34AE, &TrackVehicleInfo_8D38A9,
-    &TrackVehicleInfo_8D3CAD, &TrackVehicleInfo_8D40BA, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8D44BE, &TrackVehicleInfo_8D4FA6,
-    &TrackVehicleInfo_8D5A8E, &TrackVehicleInfo_8D6576, &TrackVehicleInfo_8D705E, &TrackVehicleInfo_8D7B46, &TrackVehicleInfo_8D862E, &TrackVehicleInfo_8D9116,
-    &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94, &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923,
-    &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8, &TrackVehicleInfo_8E005E, &TrackVehicleInfo_8E02C4, &TrackVehicleInfo_8E0533, &TrackVehicleInfo_8E0799,
-    &TrackVehicleInfo_8E09F6, &TrackVehicleInfo_8E0C53, &TrackVehicleInfo_8E0EB9, &TrackVehicleInfo_8E1128, &TrackVehicleInfo_8E26BE, &TrackVehicleInfo_8E2924,
-    &TrackVehicleInfo_8E2B93, &TrackVehicleInfo_8E2DF9, &TrackVehicleInfo_8E3056, &TrackVehicleInfo_8E32B3, &TrackVehicleInfo_8E3519, &TrackVehicleInfo_8E3788,
-    &TrackVehicleInfo_8E138E, &TrackVehicleInfo_8E15F4, &TrackVehicleInfo_8E1863, &TrackVehicleInfo_8E1AC9, &TrackVehicleInfo_8E1D26, &TrackVehicleInfo_8E1F83,
-    &TrackVehicleInfo_8E21E9, &TrackVehicleInfo_8E2458, &TrackVehicleInfo_8E39EE, &TrackVehicleInfo_8E3AB6, &TrackVehicleInfo_8E3B87, &TrackVehicleInfo_8E3C4F,
-    &TrackVehicleInfo_8E3D0E, &TrackVehicleInfo_8E3DCD, &TrackVehicleInfo_8E3E95, &TrackVehicleInfo_8E3F66, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DB70E, &TrackVehicleInfo_8DBA70, &TrackVehicleInfo_8DBDD2, &TrackVehicleInfo_8DC134, &TrackVehicleInfo_8DC496, &TrackVehicleInfo_8DC7F8,
-    &TrackVehicleInfo_8DCB5A, &TrackVehicleInfo_8DCEBC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E7AFA, &TrackVehicleInfo_8E80A5, &TrackVehicleInfo_8E8650, &TrackVehicleInfo_8E8BFB, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EC3AA, &TrackVehicleInfo_8EC715, &TrackVehicleInfo_8ECA80, &TrackVehicleInfo_8ECDEB, &TrackVehicleInfo_8ED156, &TrackVehicleInfo_8ED4C1,
-    &TrackVehicleInfo_8ED82C, &TrackVehicleInfo_8EDB97, &TrackVehicleInfo_8C6C32, &TrackVehicleInfo_8C6D78, &TrackVehicleInfo_8C6EBE, &TrackVehicleInfo_8C7004,
-    &TrackVehicleInfo_8C714A, &TrackVehicleInfo_8C7290, &TrackVehicleInfo_8C73D6, &TrackVehicleInfo_8C751C, &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8,
-    &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_8C7B7A, &TrackVehicleInfo_8C7CC0, &TrackVehicleInfo_8C7E06, &TrackVehicleInfo_8C7F4C,
-    &TrackVehicleInfo_8EFA5A, &TrackVehicleInfo_8EFDAA, &TrackVehicleInfo_8F00FA, &TrackVehicleInfo_8F044A, &TrackVehicleInfo_8F079A, &TrackVehicleInfo_8F08BC,
-    &TrackVehicleInfo_8F09DE, &TrackVehicleInfo_8F0B00, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690, &TrackVehicleInfo_8BF312, &TrackVehicleInfo_8BF554,
-    &TrackVehicleInfo_8BF796, &TrackVehicleInfo_8BF9D8, &TrackVehicleInfo_8BFC1A, &TrackVehicleInfo_8BFD3C, &TrackVehicleInfo_8BFE5E, &TrackVehicleInfo_8BFF80,
-    &TrackVehicleInfo_8C0E3A, &TrackVehicleInfo_8C0F89, &TrackVehicleInfo_8C10D8, &TrackVehicleInfo_8C1227, &TrackVehicleInfo_8C1376, &TrackVehicleInfo_8C14C5,
-    &TrackVehicleInfo_8C1614, &TrackVehicleInfo_8C1763, &TrackVehicleInfo_8C00A2, &TrackVehicleInfo_8C01C4, &TrackVehicleInfo_8C02E6, &TrackVehicleInfo_8C0408,
-    &TrackVehicleInfo_8C27B2, &TrackVehicleInfo_8C28D4, &TrackVehicleInfo_8C29F6, &TrackVehicleInfo_8C2B18, &TrackVehicleInfo_8C2C3A, &TrackVehicleInfo_8C2E7C,
-    &TrackVehicleInfo_8C30BE, &TrackVehicleInfo_8C3300, &TrackVehicleInfo_8C09B2, &TrackVehicleInfo_8C0AD4, &TrackVehicleInfo_8C0BF6, &TrackVehicleInfo_8C0D18,
-    &TrackVehicleInfo_8C1DEE, &TrackVehicleInfo_8C1F3D, &TrackVehicleInfo_8C208C, &TrackVehicleInfo_8C21DB, &TrackVehicleInfo_8C18B2, &TrackVehicleInfo_8C1A01,
-    &TrackVehicleInfo_8C1B50, &TrackVehicleInfo_8C1C9F, &TrackVehicleInfo_8C052A, &TrackVehicleInfo_8C064C, &TrackVehicleInfo_8C076E, &TrackVehicleInfo_8C0890,
-    &TrackVehicleInfo_8C8092, &TrackVehicleInfo_8C8496, &TrackVehicleInfo_8C88A3, &TrackVehicleInfo_8C8CA7, &TrackVehicleInfo_8C90A2, &TrackVehicleInfo_8C949D,
-    &TrackVehicleInfo_8C98A1, &TrackVehicleInfo_8C9CAE, &TrackVehicleInfo_8CC0D2, &TrackVehicleInfo_8CC434, &TrackVehicleInfo_8CC796, &TrackVehicleInfo_8CCAF8,
-    &TrackVehicleInfo_8CCE5A, &TrackVehicleInfo_8CD1BC, &TrackVehicleInfo_8CD51E, &TrackVehicleInfo_8CD880, &TrackVehicleInfo_8DED2E, &TrackVehicleInfo_8DEF94,
-    &TrackVehicleInfo_8DF203, &TrackVehicleInfo_8DF469, &TrackVehicleInfo_8DF6C6, &TrackVehicleInfo_8DF923, &TrackVehicleInfo_8DFB89, &TrackVehicleInfo_8DFDF8,
-    &TrackVehicleInfo_8F8C82, &TrackVehicleInfo_8F9143, &TrackVehicleInfo_8F9616, &TrackVehicleInfo_8F9AE9, &TrackVehicleInfo_8F9FAA, &TrackVehicleInfo_8FA46B,
-    &TrackVehicleInfo_8FA93E, &TrackVehicleInfo_8FAE11, &TrackVehicleInfo_8FB2D2, &TrackVehicleInfo_8FB793, &TrackVehicleInfo_8FBC66, &TrackVehicleInfo_8FC139,
-    &TrackVehicleInfo_8FC5FA, &TrackVehicleInfo_8FCABB, &TrackVehicleInfo_8FCF8E, &TrackVehicleInfo_8FD461, &TrackVehicleInfo_8F0C22, &TrackVehicleInfo_8F141F,
-    &TrackVehicleInfo_8F1C2E, &TrackVehicleInfo_8F243D, &TrackVehicleInfo_8F2C3A, &TrackVehicleInfo_8F3437, &TrackVehicleInfo_8F3C46, &TrackVehicleInfo_8F4455,
-    &TrackVehicleInfo_8F4C52, &TrackVehicleInfo_8F544F, &TrackVehicleInfo_8F5C5E, &TrackVehicleInfo_8F646D, &TrackVehicleInfo_8F6C6A, &TrackVehicleInfo_8F7467,
-    &TrackVehicleInfo_8F7C76, &TrackVehicleInfo_8F8485, &TrackVehicleInfo_8E402E, &TrackVehicleInfo_8E4270, &TrackVehicleInfo_8E44B2, &TrackVehicleInfo_8E46F4,
-    &TrackVehicleInfo_8E4936, &TrackVehicleInfo_8E4B78, &TrackVehicleInfo_8E4DBA, &TrackVehicleInfo_8E4FFC, &TrackVehicleInfo_8E523E, &TrackVehicleInfo_8E5480,
-    &TrackVehicleInfo_8E56C2, &TrackVehicleInfo_8E5904, &TrackVehicleInfo_8E5B46, &TrackVehicleInfo_8E5D88, &TrackVehicleInfo_8E5FCA, &TrackVehicleInfo_8E620C,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_8B0EB2, &TrackVehicleInfo_8B12B6, &TrackVehicleInfo_8B16C3, &TrackVehicleInfo_8B1AC7, &TrackVehicleInfo_8B1EC2, &TrackVehicleInfo_8B22BD,
-    &TrackVehicleInfo_8B26C1, &TrackVehicleInfo_8B2ACE, &TrackVehicleInfo_8B2ED2, &TrackVehicleInfo_8B32D6, &TrackVehicleInfo_8B36E3, &TrackVehicleInfo_8B3AE7,
-    &TrackVehicleInfo_8B3EE2, &TrackVehicleInfo_8B42DD, &TrackVehicleInfo_8B46E1, &TrackVehicleInfo_8B4AEE, &TrackVehicleInfo_8B4EF2, &TrackVehicleInfo_8B52F6,
-    &TrackVehicleInfo_8B5703, &TrackVehicleInfo_8B5B07, &TrackVehicleInfo_8B5F02, &TrackVehicleInfo_8B62FD, &TrackVehicleInfo_8B6701, &TrackVehicleInfo_8B6B0E,
-    &TrackVehicleInfo_8B6F12, &TrackVehicleInfo_8B7316, &TrackVehicleInfo_8B7723, &TrackVehicleInfo_8B7B27, &TrackVehicleInfo_8B7F22, &TrackVehicleInfo_8B831D,
-    &TrackVehicleInfo_8B8721, &TrackVehicleInfo_8B8B2E, &TrackVehicleInfo_968C6E, &TrackVehicleInfo_968D90, &TrackVehicleInfo_968EB2, &TrackVehicleInfo_968FD4,
-    &TrackVehicleInfo_96957E, &TrackVehicleInfo_9696A0, &TrackVehicleInfo_9697C2, &TrackVehicleInfo_9698E4, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C,
-    &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9048E8, &TrackVehicleInfo_904A0A, &TrackVehicleInfo_904B2C, &TrackVehicleInfo_904C4E,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_9690F6, &TrackVehicleInfo_969218,
-    &TrackVehicleInfo_96933A, &TrackVehicleInfo_96945C, &TrackVehicleInfo_969A06, &TrackVehicleInfo_969B28, &TrackVehicleInfo_969C4A, &TrackVehicleInfo_969D6C,
-    &TrackVehicleInfo_904D72, &TrackVehicleInfo_905314, &TrackVehicleInfo_9058B6, &TrackVehicleInfo_905E58, &TrackVehicleInfo_96D4AE, &TrackVehicleInfo_96D9A5,
-    &TrackVehicleInfo_96DE9C, &TrackVehicleInfo_96E393, &TrackVehicleInfo_96E88A, &TrackVehicleInfo_96ED81, &TrackVehicleInfo_96F278, &TrackVehicleInfo_96F76F,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0, &TrackVehicleInfo_971042, &TrackVehicleInfo_971539,
-    &TrackVehicleInfo_971A30, &TrackVehicleInfo_971F27, &TrackVehicleInfo_96FC66, &TrackVehicleInfo_97015D, &TrackVehicleInfo_970654, &TrackVehicleInfo_970B4B,
-    &TrackVehicleInfo_97241E, &TrackVehicleInfo_9729ED, &TrackVehicleInfo_972FBC, &TrackVehicleInfo_97358B, &TrackVehicleInfo_9063FA, &TrackVehicleInfo_906EAC,
-    &TrackVehicleInfo_90795E, &TrackVehicleInfo_908410, &TrackVehicleInfo_90B98A, &TrackVehicleInfo_90BC5C, &TrackVehicleInfo_90BF2E, &TrackVehicleInfo_90C200,
-    &TrackVehicleInfo_90E02A, &TrackVehicleInfo_90E14C, &TrackVehicleInfo_90E26E, &TrackVehicleInfo_90E390, &TrackVehicleInfo_90E4B2, &TrackVehicleInfo_90E5D4,
-    &TrackVehicleInfo_90E6F6, &TrackVehicleInfo_90E818, &TrackVehicleInfo_90E93A, &TrackVehicleInfo_90EB34, &TrackVehicleInfo_90ED2E, &TrackVehicleInfo_90EF28,
-    &TrackVehicleInfo_9100F2, &TrackVehicleInfo_9102EC, &TrackVehicleInfo_9104E6, &TrackVehicleInfo_9106E0, &TrackVehicleInfo_90F122, &TrackVehicleInfo_90F31C,
-    &TrackVehicleInfo_90F516, &TrackVehicleInfo_90F710, &TrackVehicleInfo_90F90A, &TrackVehicleInfo_90FB04, &TrackVehicleInfo_90FCFE, &TrackVehicleInfo_90FEF8,
-    &TrackVehicleInfo_8C7662, &TrackVehicleInfo_8C77A8, &TrackVehicleInfo_8C78EE, &TrackVehicleInfo_8C7A34, &TrackVehicleInfo_9108DA, &TrackVehicleInfo_910BA3,
-    &TrackVehicleInfo_910E75, &TrackVehicleInfo_911147, &TrackVehicleInfo_911F58, &TrackVehicleInfo_91222A, &TrackVehicleInfo_9124FC, &TrackVehicleInfo_9127CE,
-    &TrackVehicleInfo_911419, &TrackVehicleInfo_9116E2, &TrackVehicleInfo_9119B4, &TrackVehicleInfo_911C86, &TrackVehicleInfo_912AA0, &TrackVehicleInfo_912D69,
-    &TrackVehicleInfo_91303B, &TrackVehicleInfo_91330D, &TrackVehicleInfo_9135DF, &TrackVehicleInfo_9138A8, &TrackVehicleInfo_913B7A, &TrackVehicleInfo_913E4C,
-    &TrackVehicleInfo_914C5D, &TrackVehicleInfo_914F2F, &TrackVehicleInfo_915201, &TrackVehicleInfo_9154D3, &TrackVehicleInfo_91411E, &TrackVehicleInfo_9143E7,
-    &TrackVehicleInfo_9146B9, &TrackVehicleInfo_91498B, &TrackVehicleInfo_9157A5, &TrackVehicleInfo_915A6E, &TrackVehicleInfo_915D40, &TrackVehicleInfo_916012,
-    &TrackVehicleInfo_9162E6, &TrackVehicleInfo_916408, &TrackVehicleInfo_91652A, &TrackVehicleInfo_91664C, &TrackVehicleInfo_91676E, &TrackVehicleInfo_916890,
-    &TrackVehicleInfo_9169B2, &TrackVehicleInfo_916AD4, &TrackVehicleInfo_91707E, &TrackVehicleInfo_9172C0, &TrackVehicleInfo_917502, &TrackVehicleInfo_917744,
-    &TrackVehicleInfo_91828E, &TrackVehicleInfo_9183B0, &TrackVehicleInfo_9184D2, &TrackVehicleInfo_9185F4, &TrackVehicleInfo_9194F6, &TrackVehicleInfo_919645,
-    &TrackVehicleInfo_919794, &TrackVehicleInfo_9198E3, &TrackVehicleInfo_919A32, &TrackVehicleInfo_919B81, &TrackVehicleInfo_919CD0, &TrackVehicleInfo_919E1F,
-    &TrackVehicleInfo_918716, &TrackVehicleInfo_91884A, &TrackVehicleInfo_91897E, &TrackVehicleInfo_918AB2, &TrackVehicleInfo_916BF6, &TrackVehicleInfo_916D18,
-    &TrackVehicleInfo_916E3A, &TrackVehicleInfo_916F5C, &TrackVehicleInfo_917986, &TrackVehicleInfo_917BC8, &TrackVehicleInfo_917E0A, &TrackVehicleInfo_91804C,
-    &TrackVehicleInfo_91906E, &TrackVehicleInfo_919190, &TrackVehicleInfo_9192B2, &TrackVehicleInfo_9193D4, &TrackVehicleInfo_91A4AA, &TrackVehicleInfo_91A5F9,
-    &TrackVehicleInfo_91A748, &TrackVehicleInfo_91A897, &TrackVehicleInfo_919F6E, &TrackVehicleInfo_91A0BD, &TrackVehicleInfo_91A20C, &TrackVehicleInfo_91A35B,
-    &TrackVehicleInfo_918BE6, &TrackVehicleInfo_918D08, &TrackVehicleInfo_918E2A, &TrackVehicleInfo_918F4C, &TrackVehicleInfo_91A9E6, &TrackVehicleInfo_91AB2C,
-    &TrackVehicleInfo_91AC72, &TrackVehicleInfo_91ADB8, &TrackVehicleInfo_91AEFE, &TrackVehicleInfo_91B044, &TrackVehicleInfo_91B18A, &TrackVehicleInfo_91B2D0,
-    &TrackVehicleInfo_91B416, &TrackVehicleInfo_91B55C, &TrackVehicleInfo_91B6A2, &TrackVehicleInfo_91B7E8, &TrackVehicleInfo_91B92E, &TrackVehicleInfo_91BA74,
-    &TrackVehicleInfo_91BBBA, &TrackVehicleInfo_91BD00, &TrackVehicleInfo_95787E, &TrackVehicleInfo_9579A0, &TrackVehicleInfo_957AC2, &TrackVehicleInfo_957BE4,
-    &TrackVehicleInfo_957D06, &TrackVehicleInfo_957E28, &TrackVehicleInfo_957F4A, &TrackVehicleInfo_95806C, &TrackVehicleInfo_95818E, &TrackVehicleInfo_9582B0,
-    &TrackVehicleInfo_9583D2, &TrackVehicleInfo_9584F4, &TrackVehicleInfo_958616, &TrackVehicleInfo_958738, &TrackVehicleInfo_95885A, &TrackVehicleInfo_95897C,
-    &TrackVehicleInfo_958A9E, &TrackVehicleInfo_958BC0, &TrackVehicleInfo_958CE2, &TrackVehicleInfo_958E04, &TrackVehicleInfo_958F26, &TrackVehicleInfo_959048,
-    &TrackVehicleInfo_95916A, &TrackVehicleInfo_95928C, &TrackVehicleInfo_9593AE, &TrackVehicleInfo_9594E2, &TrackVehicleInfo_959616, &TrackVehicleInfo_95974A,
-    &TrackVehicleInfo_95987E, &TrackVehicleInfo_9599B2, &TrackVehicleInfo_959AE6, &TrackVehicleInfo_959C1A, &TrackVehicleInfo_95A65E, &TrackVehicleInfo_95A780,
-    &TrackVehicleInfo_95A8A2, &TrackVehicleInfo_95A9C4, &TrackVehicleInfo_95AAE6, &TrackVehicleInfo_95AC08, &TrackVehicleInfo_95AD2A, &TrackVehicleInfo_95AE4C,
-    &TrackVehicleInfo_959D4E, &TrackVehicleInfo_959E70, &TrackVehicleInfo_959F92, &TrackVehicleInfo_95A0B4, &TrackVehicleInfo_95A1D6, &TrackVehicleInfo_95A2F8,
-    &TrackVehicleInfo_95A41A, &TrackVehicleInfo_95A53C, &TrackVehicleInfo_95AF6E, &TrackVehicleInfo_95B090, &TrackVehicleInfo_95B1B2, &TrackVehicleInfo_95B2D4,
-    &TrackVehicleInfo_95B3F6, &TrackVehicleInfo_95B518, &TrackVehicleInfo_95B63A, &TrackVehicleInfo_95B75C, &TrackVehicleInfo_91BE46, &TrackVehicleInfo_91C001,
-    &TrackVehicleInfo_91C1BC, &TrackVehicleInfo_91C377, &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
-    &TrackVehicleInfo_91C532, &TrackVehicleInfo_91C894, &TrackVehicleInfo_91CBF6, &TrackVehicleInfo_91CF58, &TrackVehicleInfo_91D2BA, &TrackVehicleInfo_91D61C,
-    &TrackVehicleInfo_91D97E, &TrackVehicleInfo_91DCE0, &TrackVehicleInfo_91E042, &TrackVehicleInfo_91E3A4, &TrackVehicleInfo_91E706, &TrackVehicleInfo_91EA68,
-    &TrackVehicleInfo_91EDCA, &TrackVehicleInfo_91F12C, &TrackVehicleInfo_91F48E, &TrackVehicleInfo_91F7F0, &TrackVehicleInfo_920E82, &TrackVehicleInfo_9210E8,
-    &TrackVehicleInfo_921357, &TrackVehicleInfo_9215BD, &TrackVehicleInfo_92181A, &TrackVehicleInfo_921A77, &TrackVehicleInfo_921CDD, &TrackVehicleInfo_921F4C,
-    &TrackVehicleInfo_91FB52, &TrackVehicleInfo_91FDB8, &TrackVehicleInfo_920027, &TrackVehicleInfo_92028D, &TrackVehicleInfo_9204EA, &TrackVehicleInfo_920747,
-    &TrackVehicleInfo_9209AD, &TrackVehicleInfo_920C1C, &TrackVehicleInfo_8C232A, &TrackVehicleInfo_8C244C, &TrackVehicleInfo_8C256E, &TrackVehicleInfo_8C2690,
-    &TrackVehicleInfo_9221B2, &TrackVehicleInfo_9237A6, &TrackVehicleInfo_924D9A, &TrackVehicleInfo_92638E, &TrackVehicleInfo_922CAC, &TrackVehicleInfo_9242A0,
-    &TrackVehicleInfo_925894, &TrackVehicleInfo_926E88, &TrackVehicleInfo_927982, &TrackVehicleInfo_928F76, &TrackVehicleInfo_92A56A, &TrackVehicleInfo_92BB5E,
-    &TrackVehicleInfo_92847C, &TrackVehicleInfo_929A70, &TrackVehicleInfo_92B064, &TrackVehicleInfo_92C658, &TrackVehicleInfo_8D9BFE, &TrackVehicleInfo_8D9F60,
-    &TrackVehicleInfo_8DA2C2, &TrackVehicleInfo_8DA624, &TrackVehicleInfo_8DA986, &TrackVehicleInfo_8DACE8, &TrackVehicleInfo_8DB04A, &TrackVehicleInfo_8DB3AC,
-    &TrackVehicleInfo_8DD21E, &TrackVehicleInfo_8DD580, &TrackVehicleInfo_8DD8E2, &TrackVehicleInfo_8DDC44, &TrackVehicleInfo_8DDFA6, &TrackVehicleInfo_8DE308,
-    &TrackVehicleInfo_8DE66A, &TrackVehicleInfo_8DE9CC, &TrackVehicleInfo_8E644E, &TrackVehicleInfo_8E69F9, &TrackVehicleInfo_8E6FA4, &TrackVehicleInfo_8E754F,
-    &TrackVehicleInfo_8E91A6, &TrackVehicleInfo_8E9751, &TrackVehicleInfo_8E9CFC, &TrackVehicleInfo_8EA2A7, &TrackVehicleInfo_8EA852, &TrackVehicleInfo_8EABBD,
-    &TrackVehicleInfo_8EAF28, &TrackVehicleInfo_8EB293, &TrackVehicleInfo_8EB5FE, &TrackVehicleInfo_8EB969, &TrackVehicleInfo_8EBCD4, &TrackVehicleInfo_8EC03F,
-    &TrackVehicleInfo_8EDF02, &TrackVehicleInfo_8EE26D, &TrackVehicleInfo_8EE5D8, &TrackVehicleInfo_8EE943, &TrackVehicleInfo_8EECAE, &TrackVehicleInfo_8EF019,
-    &TrackVehicleInfo_8EF384, &TrackVehicleInfo_8EF6EF, &TrackVehicleInfo_92D152, &TrackVehicleInfo_92D6F4, &TrackVehicleInfo_92DC96, &TrackVehicleInfo_92E238,
-    &TrackVehicleInfo_92E7DA, &TrackVehicleInfo_92ED7C, &TrackVehicleInfo_92F31E, &TrackVehicleInfo_92F8C0, &TrackVehicleInfo_92FE62, &TrackVehicleInfo_930524,
-    &TrackVehicleInfo_930BE6, &TrackVehicleInfo_9312A8, &TrackVehicleInfo_93196A, &TrackVehicleInfo_93202C, &TrackVehicleInfo_9326EE, &TrackVehicleInfo_932DB0,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000,
-    &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_000000, &TrackVehicleInfo_95426E, &TrackVehicleInfo_954930,
-    &TrackVehicleInfo_954FF2, &TrackVehicleInfo_9556B4, &TrackVehicleInfo_955D76, &TrackVehicleInfo_956438, &TrackVehicleInfo_956AFA, &TrackVehicleInfo_9571BC,
-    &TrackVehicleInfo_90C4D2, &TrackVehicleInfo_90C8D6, &TrackVehicleInfo_90CCDA, &TrackVehicleInfo_90D0DE, &TrackVehicleInfo_90D4E2, &TrackVehicleInfo_90D7B4,
-    &TrackVehicleInfo_90DA86, &TrackVehicleInfo_90DD58, &TrackVehicleInfo_908EC2, &TrackVehicleInfo_909974, &TrackVehicleInfo_90A426, &TrackVehicleInfo_90AED8,
-    &TrackVehicleInfo_8BE57A, &TrackVehicleInfo_8BE69C, &TrackVehicleInfo_8BE7BE, &TrackVehicleInfo_8BE8E0,
+static constexpr const rct_vehicle_info_list TrackVehicleInfoListReverserRCRearBogie[] = {
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C,
+    TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554, TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8,
+    TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80, TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89,
+    TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5, TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763,
+    TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408, TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4,
+    TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C, TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300,
+    TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18, TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D,
+    TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01, TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F,
+    TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890, TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496,
+    TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D, TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE,
+    TrackVehicleInfo_8C3542, TrackVehicleInfo_8C3664, TrackVehicleInfo_8C3786, TrackVehicleInfo_8C38A8, TrackVehicleInfo_8C39CA, TrackVehicleInfo_8C3AEC,
+    TrackVehicleInfo_8C3C0E, TrackVehicleInfo_8C3D30, TrackVehicleInfo_8C3E52, TrackVehicleInfo_8C3F74, TrackVehicleInfo_8C4096, TrackVehicleInfo_8C41B8,
+    TrackVehicleInfo_8C42DA, TrackVehicleInfo_8C43FC, TrackVehicleInfo_8C451E, TrackVehicleInfo_8C4640, TrackVehicleInfo_8CA0B2, TrackVehicleInfo_8CA4B6,
+    TrackVehicleInfo_8CA8C3, TrackVehicleInfo_8CACC7, TrackVehicleInfo_8CB0C2, TrackVehicleInfo_8CB4BD, TrackVehicleInfo_8CB8C1, TrackVehicleInfo_8CBCCE,
+    TrackVehicleInfo_8C4762, TrackVehicleInfo_8C4884, TrackVehicleInfo_8C49A6, TrackVehicleInfo_8C4AC8, TrackVehicleInfo_8C4BEA, TrackVehicleInfo_8C4D0C,
+    TrackVehicleInfo_8C4E2E, TrackVehicleInfo_8C4F50, TrackVehicleInfo_8C5072, TrackVehicleInfo_8C51A6, TrackVehicleInfo_8C52DA, TrackVehicleInfo_8C540E,
+    TrackVehicleInfo_8C5542, TrackVehicleInfo_8C5676, TrackVehicleInfo_8C57AA, TrackVehicleInfo_8C58DE, TrackVehicleInfo_8C6322, TrackVehicleInfo_8C6444,
+    TrackVehicleInfo_8C6566, TrackVehicleInfo_8C6688, TrackVehicleInfo_8C67AA, TrackVehicleInfo_8C68CC, TrackVehicleInfo_8C69EE, TrackVehicleInfo_8C6B10,
+    TrackVehicleInfo_8C5A12, TrackVehicleInfo_8C5B34, TrackVehicleInfo_8C5C56, TrackVehicleInfo_8C5D78, TrackVehicleInfo_8C5E9A, TrackVehicleInfo_8C5FBC,
+    TrackVehicleInfo_8C60DE, TrackVehicleInfo_8C6200, TrackVehicleInfo_8BEA02, TrackVehicleInfo_8BEB24, TrackVehicleInfo_8BEC46, TrackVehicleInfo_8BED68,
+    TrackVehicleInfo_8BEE8A, TrackVehicleInfo_8BEFAC, TrackVehicleInfo_8BF0CE, TrackVehicleInfo_8BF1F0, TrackVehicleInfo_8D047E, TrackVehicleInfo_8D0882,
+    TrackVehicleInfo_8D0C8F, TrackVehicleInfo_8D1093, TrackVehicleInfo_8D148E, TrackVehicleInfo_8D1889, TrackVehicleInfo_8D1C8D, TrackVehicleInfo_8D209A,
+    TrackVehicleInfo_8D249E, TrackVehicleInfo_8D28A2, TrackVehicleInfo_8D2CAF, TrackVehicleInfo_8D30B3, TrackVehicleInfo_8D34AE, TrackVehicleInfo_8D38A9,
+    TrackVehicleInfo_8D3CAD, TrackVehicleInfo_8D40BA, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8D44BE, TrackVehicleInfo_8D4FA6,
+    TrackVehicleInfo_8D5A8E, TrackVehicleInfo_8D6576, TrackVehicleInfo_8D705E, TrackVehicleInfo_8D7B46, TrackVehicleInfo_8D862E, TrackVehicleInfo_8D9116,
+    TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94, TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923,
+    TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8, TrackVehicleInfo_8E005E, TrackVehicleInfo_8E02C4, TrackVehicleInfo_8E0533, TrackVehicleInfo_8E0799,
+    TrackVehicleInfo_8E09F6, TrackVehicleInfo_8E0C53, TrackVehicleInfo_8E0EB9, TrackVehicleInfo_8E1128, TrackVehicleInfo_8E26BE, TrackVehicleInfo_8E2924,
+    TrackVehicleInfo_8E2B93, TrackVehicleInfo_8E2DF9, TrackVehicleInfo_8E3056, TrackVehicleInfo_8E32B3, TrackVehicleInfo_8E3519, TrackVehicleInfo_8E3788,
+    TrackVehicleInfo_8E138E, TrackVehicleInfo_8E15F4, TrackVehicleInfo_8E1863, TrackVehicleInfo_8E1AC9, TrackVehicleInfo_8E1D26, TrackVehicleInfo_8E1F83,
+    TrackVehicleInfo_8E21E9, TrackVehicleInfo_8E2458, TrackVehicleInfo_8E39EE, TrackVehicleInfo_8E3AB6, TrackVehicleInfo_8E3B87, TrackVehicleInfo_8E3C4F,
+    TrackVehicleInfo_8E3D0E, TrackVehicleInfo_8E3DCD, TrackVehicleInfo_8E3E95, TrackVehicleInfo_8E3F66, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DB70E, TrackVehicleInfo_8DBA70, TrackVehicleInfo_8DBDD2, TrackVehicleInfo_8DC134, TrackVehicleInfo_8DC496, TrackVehicleInfo_8DC7F8,
+    TrackVehicleInfo_8DCB5A, TrackVehicleInfo_8DCEBC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E7AFA, TrackVehicleInfo_8E80A5, TrackVehicleInfo_8E8650, TrackVehicleInfo_8E8BFB, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EC3AA, TrackVehicleInfo_8EC715, TrackVehicleInfo_8ECA80, TrackVehicleInfo_8ECDEB, TrackVehicleInfo_8ED156, TrackVehicleInfo_8ED4C1,
+    TrackVehicleInfo_8ED82C, TrackVehicleInfo_8EDB97, TrackVehicleInfo_8C6C32, TrackVehicleInfo_8C6D78, TrackVehicleInfo_8C6EBE, TrackVehicleInfo_8C7004,
+    TrackVehicleInfo_8C714A, TrackVehicleInfo_8C7290, TrackVehicleInfo_8C73D6, TrackVehicleInfo_8C751C, TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8,
+    TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_8C7B7A, TrackVehicleInfo_8C7CC0, TrackVehicleInfo_8C7E06, TrackVehicleInfo_8C7F4C,
+    TrackVehicleInfo_8EFA5A, TrackVehicleInfo_8EFDAA, TrackVehicleInfo_8F00FA, TrackVehicleInfo_8F044A, TrackVehicleInfo_8F079A, TrackVehicleInfo_8F08BC,
+    TrackVehicleInfo_8F09DE, TrackVehicleInfo_8F0B00, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690, TrackVehicleInfo_8BF312, TrackVehicleInfo_8BF554,
+    TrackVehicleInfo_8BF796, TrackVehicleInfo_8BF9D8, TrackVehicleInfo_8BFC1A, TrackVehicleInfo_8BFD3C, TrackVehicleInfo_8BFE5E, TrackVehicleInfo_8BFF80,
+    TrackVehicleInfo_8C0E3A, TrackVehicleInfo_8C0F89, TrackVehicleInfo_8C10D8, TrackVehicleInfo_8C1227, TrackVehicleInfo_8C1376, TrackVehicleInfo_8C14C5,
+    TrackVehicleInfo_8C1614, TrackVehicleInfo_8C1763, TrackVehicleInfo_8C00A2, TrackVehicleInfo_8C01C4, TrackVehicleInfo_8C02E6, TrackVehicleInfo_8C0408,
+    TrackVehicleInfo_8C27B2, TrackVehicleInfo_8C28D4, TrackVehicleInfo_8C29F6, TrackVehicleInfo_8C2B18, TrackVehicleInfo_8C2C3A, TrackVehicleInfo_8C2E7C,
+    TrackVehicleInfo_8C30BE, TrackVehicleInfo_8C3300, TrackVehicleInfo_8C09B2, TrackVehicleInfo_8C0AD4, TrackVehicleInfo_8C0BF6, TrackVehicleInfo_8C0D18,
+    TrackVehicleInfo_8C1DEE, TrackVehicleInfo_8C1F3D, TrackVehicleInfo_8C208C, TrackVehicleInfo_8C21DB, TrackVehicleInfo_8C18B2, TrackVehicleInfo_8C1A01,
+    TrackVehicleInfo_8C1B50, TrackVehicleInfo_8C1C9F, TrackVehicleInfo_8C052A, TrackVehicleInfo_8C064C, TrackVehicleInfo_8C076E, TrackVehicleInfo_8C0890,
+    TrackVehicleInfo_8C8092, TrackVehicleInfo_8C8496, TrackVehicleInfo_8C88A3, TrackVehicleInfo_8C8CA7, TrackVehicleInfo_8C90A2, TrackVehicleInfo_8C949D,
+    TrackVehicleInfo_8C98A1, TrackVehicleInfo_8C9CAE, TrackVehicleInfo_8CC0D2, TrackVehicleInfo_8CC434, TrackVehicleInfo_8CC796, TrackVehicleInfo_8CCAF8,
+    TrackVehicleInfo_8CCE5A, TrackVehicleInfo_8CD1BC, TrackVehicleInfo_8CD51E, TrackVehicleInfo_8CD880, TrackVehicleInfo_8DED2E, TrackVehicleInfo_8DEF94,
+    TrackVehicleInfo_8DF203, TrackVehicleInfo_8DF469, TrackVehicleInfo_8DF6C6, TrackVehicleInfo_8DF923, TrackVehicleInfo_8DFB89, TrackVehicleInfo_8DFDF8,
+    TrackVehicleInfo_8F8C82, TrackVehicleInfo_8F9143, TrackVehicleInfo_8F9616, TrackVehicleInfo_8F9AE9, TrackVehicleInfo_8F9FAA, TrackVehicleInfo_8FA46B,
+    TrackVehicleInfo_8FA93E, TrackVehicleInfo_8FAE11, TrackVehicleInfo_8FB2D2, TrackVehicleInfo_8FB793, TrackVehicleInfo_8FBC66, TrackVehicleInfo_8FC139,
+    TrackVehicleInfo_8FC5FA, TrackVehicleInfo_8FCABB, TrackVehicleInfo_8FCF8E, TrackVehicleInfo_8FD461, TrackVehicleInfo_8F0C22, TrackVehicleInfo_8F141F,
+    TrackVehicleInfo_8F1C2E, TrackVehicleInfo_8F243D, TrackVehicleInfo_8F2C3A, TrackVehicleInfo_8F3437, TrackVehicleInfo_8F3C46, TrackVehicleInfo_8F4455,
+    TrackVehicleInfo_8F4C52, TrackVehicleInfo_8F544F, TrackVehicleInfo_8F5C5E, TrackVehicleInfo_8F646D, TrackVehicleInfo_8F6C6A, TrackVehicleInfo_8F7467,
+    TrackVehicleInfo_8F7C76, TrackVehicleInfo_8F8485, TrackVehicleInfo_8E402E, TrackVehicleInfo_8E4270, TrackVehicleInfo_8E44B2, TrackVehicleInfo_8E46F4,
+    TrackVehicleInfo_8E4936, TrackVehicleInfo_8E4B78, TrackVehicleInfo_8E4DBA, TrackVehicleInfo_8E4FFC, TrackVehicleInfo_8E523E, TrackVehicleInfo_8E5480,
+    TrackVehicleInfo_8E56C2, TrackVehicleInfo_8E5904, TrackVehicleInfo_8E5B46, TrackVehicleInfo_8E5D88, TrackVehicleInfo_8E5FCA, TrackVehicleInfo_8E620C,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_8B0EB2, TrackVehicleInfo_8B12B6, TrackVehicleInfo_8B16C3, TrackVehicleInfo_8B1AC7, TrackVehicleInfo_8B1EC2, TrackVehicleInfo_8B22BD,
+    TrackVehicleInfo_8B26C1, TrackVehicleInfo_8B2ACE, TrackVehicleInfo_8B2ED2, TrackVehicleInfo_8B32D6, TrackVehicleInfo_8B36E3, TrackVehicleInfo_8B3AE7,
+    TrackVehicleInfo_8B3EE2, TrackVehicleInfo_8B42DD, TrackVehicleInfo_8B46E1, TrackVehicleInfo_8B4AEE, TrackVehicleInfo_8B4EF2, TrackVehicleInfo_8B52F6,
+    TrackVehicleInfo_8B5703, TrackVehicleInfo_8B5B07, TrackVehicleInfo_8B5F02, TrackVehicleInfo_8B62FD, TrackVehicleInfo_8B6701, TrackVehicleInfo_8B6B0E,
+    TrackVehicleInfo_8B6F12, TrackVehicleInfo_8B7316, TrackVehicleInfo_8B7723, TrackVehicleInfo_8B7B27, TrackVehicleInfo_8B7F22, TrackVehicleInfo_8B831D,
+    TrackVehicleInfo_8B8721, TrackVehicleInfo_8B8B2E, TrackVehicleInfo_968C6E, TrackVehicleInfo_968D90, TrackVehicleInfo_968EB2, TrackVehicleInfo_968FD4,
+    TrackVehicleInfo_96957E, TrackVehicleInfo_9696A0, TrackVehicleInfo_9697C2, TrackVehicleInfo_9698E4, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C,
+    TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9048E8, TrackVehicleInfo_904A0A, TrackVehicleInfo_904B2C, TrackVehicleInfo_904C4E,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_9690F6, TrackVehicleInfo_969218,
+    TrackVehicleInfo_96933A, TrackVehicleInfo_96945C, TrackVehicleInfo_969A06, TrackVehicleInfo_969B28, TrackVehicleInfo_969C4A, TrackVehicleInfo_969D6C,
+    TrackVehicleInfo_904D72, TrackVehicleInfo_905314, TrackVehicleInfo_9058B6, TrackVehicleInfo_905E58, TrackVehicleInfo_96D4AE, TrackVehicleInfo_96D9A5,
+    TrackVehicleInfo_96DE9C, TrackVehicleInfo_96E393, TrackVehicleInfo_96E88A, TrackVehicleInfo_96ED81, TrackVehicleInfo_96F278, TrackVehicleInfo_96F76F,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0, TrackVehicleInfo_971042, TrackVehicleInfo_971539,
+    TrackVehicleInfo_971A30, TrackVehicleInfo_971F27, TrackVehicleInfo_96FC66, TrackVehicleInfo_97015D, TrackVehicleInfo_970654, TrackVehicleInfo_970B4B,
+    TrackVehicleInfo_97241E, TrackVehicleInfo_9729ED, TrackVehicleInfo_972FBC, TrackVehicleInfo_97358B, TrackVehicleInfo_9063FA, TrackVehicleInfo_906EAC,
+    TrackVehicleInfo_90795E, TrackVehicleInfo_908410, TrackVehicleInfo_90B98A, TrackVehicleInfo_90BC5C, TrackVehicleInfo_90BF2E, TrackVehicleInfo_90C200,
+    TrackVehicleInfo_90E02A, TrackVehicleInfo_90E14C, TrackVehicleInfo_90E26E, TrackVehicleInfo_90E390, TrackVehicleInfo_90E4B2, TrackVehicleInfo_90E5D4,
+    TrackVehicleInfo_90E6F6, TrackVehicleInfo_90E818, TrackVehicleInfo_90E93A, TrackVehicleInfo_90EB34, TrackVehicleInfo_90ED2E, TrackVehicleInfo_90EF28,
+    TrackVehicleInfo_9100F2, TrackVehicleInfo_9102EC, TrackVehicleInfo_9104E6, TrackVehicleInfo_9106E0, TrackVehicleInfo_90F122, TrackVehicleInfo_90F31C,
+    TrackVehicleInfo_90F516, TrackVehicleInfo_90F710, TrackVehicleInfo_90F90A, TrackVehicleInfo_90FB04, TrackVehicleInfo_90FCFE, TrackVehicleInfo_90FEF8,
+    TrackVehicleInfo_8C7662, TrackVehicleInfo_8C77A8, TrackVehicleInfo_8C78EE, TrackVehicleInfo_8C7A34, TrackVehicleInfo_9108DA, TrackVehicleInfo_910BA3,
+    TrackVehicleInfo_910E75, TrackVehicleInfo_911147, TrackVehicleInfo_911F58, TrackVehicleInfo_91222A, TrackVehicleInfo_9124FC, TrackVehicleInfo_9127CE,
+    TrackVehicleInfo_911419, TrackVehicleInfo_9116E2, TrackVehicleInfo_9119B4, TrackVehicleInfo_911C86, TrackVehicleInfo_912AA0, TrackVehicleInfo_912D69,
+    TrackVehicleInfo_91303B, TrackVehicleInfo_91330D, TrackVehicleInfo_9135DF, TrackVehicleInfo_9138A8, TrackVehicleInfo_913B7A, TrackVehicleInfo_913E4C,
+    TrackVehicleInfo_914C5D, TrackVehicleInfo_914F2F, TrackVehicleInfo_915201, TrackVehicleInfo_9154D3, TrackVehicleInfo_91411E, TrackVehicleInfo_9143E7,
+    TrackVehicleInfo_9146B9, TrackVehicleInfo_91498B, TrackVehicleInfo_9157A5, TrackVehicleInfo_915A6E, TrackVehicleInfo_915D40, TrackVehicleInfo_916012,
+    TrackVehicleInfo_9162E6, TrackVehicleInfo_916408, TrackVehicleInfo_91652A, TrackVehicleInfo_91664C, TrackVehicleInfo_91676E, TrackVehicleInfo_916890,
+    TrackVehicleInfo_9169B2, TrackVehicleInfo_916AD4, TrackVehicleInfo_91707E, TrackVehicleInfo_9172C0, TrackVehicleInfo_917502, TrackVehicleInfo_917744,
+    TrackVehicleInfo_91828E, TrackVehicleInfo_9183B0, TrackVehicleInfo_9184D2, TrackVehicleInfo_9185F4, TrackVehicleInfo_9194F6, TrackVehicleInfo_919645,
+    TrackVehicleInfo_919794, TrackVehicleInfo_9198E3, TrackVehicleInfo_919A32, TrackVehicleInfo_919B81, TrackVehicleInfo_919CD0, TrackVehicleInfo_919E1F,
+    TrackVehicleInfo_918716, TrackVehicleInfo_91884A, TrackVehicleInfo_91897E, TrackVehicleInfo_918AB2, TrackVehicleInfo_916BF6, TrackVehicleInfo_916D18,
+    TrackVehicleInfo_916E3A, TrackVehicleInfo_916F5C, TrackVehicleInfo_917986, TrackVehicleInfo_917BC8, TrackVehicleInfo_917E0A, TrackVehicleInfo_91804C,
+    TrackVehicleInfo_91906E, TrackVehicleInfo_919190, TrackVehicleInfo_9192B2, TrackVehicleInfo_9193D4, TrackVehicleInfo_91A4AA, TrackVehicleInfo_91A5F9,
+    TrackVehicleInfo_91A748, TrackVehicleInfo_91A897, TrackVehicleInfo_919F6E, TrackVehicleInfo_91A0BD, TrackVehicleInfo_91A20C, TrackVehicleInfo_91A35B,
+    TrackVehicleInfo_918BE6, TrackVehicleInfo_918D08, TrackVehicleInfo_918E2A, TrackVehicleInfo_918F4C, TrackVehicleInfo_91A9E6, TrackVehicleInfo_91AB2C,
+    TrackVehicleInfo_91AC72, TrackVehicleInfo_91ADB8, TrackVehicleInfo_91AEFE, TrackVehicleInfo_91B044, TrackVehicleInfo_91B18A, TrackVehicleInfo_91B2D0,
+    TrackVehicleInfo_91B416, TrackVehicleInfo_91B55C, TrackVehicleInfo_91B6A2, TrackVehicleInfo_91B7E8, TrackVehicleInfo_91B92E, TrackVehicleInfo_91BA74,
+    TrackVehicleInfo_91BBBA, TrackVehicleInfo_91BD00, TrackVehicleInfo_95787E, TrackVehicleInfo_9579A0, TrackVehicleInfo_957AC2, TrackVehicleInfo_957BE4,
+    TrackVehicleInfo_957D06, TrackVehicleInfo_957E28, TrackVehicleInfo_957F4A, TrackVehicleInfo_95806C, TrackVehicleInfo_95818E, TrackVehicleInfo_9582B0,
+    TrackVehicleInfo_9583D2, TrackVehicleInfo_9584F4, TrackVehicleInfo_958616, TrackVehicleInfo_958738, TrackVehicleInfo_95885A, TrackVehicleInfo_95897C,
+    TrackVehicleInfo_958A9E, TrackVehicleInfo_958BC0, TrackVehicleInfo_958CE2, TrackVehicleInfo_958E04, TrackVehicleInfo_958F26, TrackVehicleInfo_959048,
+    TrackVehicleInfo_95916A, TrackVehicleInfo_95928C, TrackVehicleInfo_9593AE, TrackVehicleInfo_9594E2, TrackVehicleInfo_959616, TrackVehicleInfo_95974A,
+    TrackVehicleInfo_95987E, TrackVehicleInfo_9599B2, TrackVehicleInfo_959AE6, TrackVehicleInfo_959C1A, TrackVehicleInfo_95A65E, TrackVehicleInfo_95A780,
+    TrackVehicleInfo_95A8A2, TrackVehicleInfo_95A9C4, TrackVehicleInfo_95AAE6, TrackVehicleInfo_95AC08, TrackVehicleInfo_95AD2A, TrackVehicleInfo_95AE4C,
+    TrackVehicleInfo_959D4E, TrackVehicleInfo_959E70, TrackVehicleInfo_959F92, TrackVehicleInfo_95A0B4, TrackVehicleInfo_95A1D6, TrackVehicleInfo_95A2F8,
+    TrackVehicleInfo_95A41A, TrackVehicleInfo_95A53C, TrackVehicleInfo_95AF6E, TrackVehicleInfo_95B090, TrackVehicleInfo_95B1B2, TrackVehicleInfo_95B2D4,
+    TrackVehicleInfo_95B3F6, TrackVehicleInfo_95B518, TrackVehicleInfo_95B63A, TrackVehicleInfo_95B75C, TrackVehicleInfo_91BE46, TrackVehicleInfo_91C001,
+    TrackVehicleInfo_91C1BC, TrackVehicleInfo_91C377, TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
+    TrackVehicleInfo_91C532, TrackVehicleInfo_91C894, TrackVehicleInfo_91CBF6, TrackVehicleInfo_91CF58, TrackVehicleInfo_91D2BA, TrackVehicleInfo_91D61C,
+    TrackVehicleInfo_91D97E, TrackVehicleInfo_91DCE0, TrackVehicleInfo_91E042, TrackVehicleInfo_91E3A4, TrackVehicleInfo_91E706, TrackVehicleInfo_91EA68,
+    TrackVehicleInfo_91EDCA, TrackVehicleInfo_91F12C, TrackVehicleInfo_91F48E, TrackVehicleInfo_91F7F0, TrackVehicleInfo_920E82, TrackVehicleInfo_9210E8,
+    TrackVehicleInfo_921357, TrackVehicleInfo_9215BD, TrackVehicleInfo_92181A, TrackVehicleInfo_921A77, TrackVehicleInfo_921CDD, TrackVehicleInfo_921F4C,
+    TrackVehicleInfo_91FB52, TrackVehicleInfo_91FDB8, TrackVehicleInfo_920027, TrackVehicleInfo_92028D, TrackVehicleInfo_9204EA, TrackVehicleInfo_920747,
+    TrackVehicleInfo_9209AD, TrackVehicleInfo_920C1C, TrackVehicleInfo_8C232A, TrackVehicleInfo_8C244C, TrackVehicleInfo_8C256E, TrackVehicleInfo_8C2690,
+    TrackVehicleInfo_9221B2, TrackVehicleInfo_9237A6, TrackVehicleInfo_924D9A, TrackVehicleInfo_92638E, TrackVehicleInfo_922CAC, TrackVehicleInfo_9242A0,
+    TrackVehicleInfo_925894, TrackVehicleInfo_926E88, TrackVehicleInfo_927982, TrackVehicleInfo_928F76, TrackVehicleInfo_92A56A, TrackVehicleInfo_92BB5E,
+    TrackVehicleInfo_92847C, TrackVehicleInfo_929A70, TrackVehicleInfo_92B064, TrackVehicleInfo_92C658, TrackVehicleInfo_8D9BFE, TrackVehicleInfo_8D9F60,
+    TrackVehicleInfo_8DA2C2, TrackVehicleInfo_8DA624, TrackVehicleInfo_8DA986, TrackVehicleInfo_8DACE8, TrackVehicleInfo_8DB04A, TrackVehicleInfo_8DB3AC,
+    TrackVehicleInfo_8DD21E, TrackVehicleInfo_8DD580, TrackVehicleInfo_8DD8E2, TrackVehicleInfo_8DDC44, TrackVehicleInfo_8DDFA6, TrackVehicleInfo_8DE308,
+    TrackVehicleInfo_8DE66A, TrackVehicleInfo_8DE9CC, TrackVehicleInfo_8E644E, TrackVehicleInfo_8E69F9, TrackVehicleInfo_8E6FA4, TrackVehicleInfo_8E754F,
+    TrackVehicleInfo_8E91A6, TrackVehicleInfo_8E9751, TrackVehicleInfo_8E9CFC, TrackVehicleInfo_8EA2A7, TrackVehicleInfo_8EA852, TrackVehicleInfo_8EABBD,
+    TrackVehicleInfo_8EAF28, TrackVehicleInfo_8EB293, TrackVehicleInfo_8EB5FE, TrackVehicleInfo_8EB969, TrackVehicleInfo_8EBCD4, TrackVehicleInfo_8EC03F,
+    TrackVehicleInfo_8EDF02, TrackVehicleInfo_8EE26D, TrackVehicleInfo_8EE5D8, TrackVehicleInfo_8EE943, TrackVehicleInfo_8EECAE, TrackVehicleInfo_8EF019,
+    TrackVehicleInfo_8EF384, TrackVehicleInfo_8EF6EF, TrackVehicleInfo_92D152, TrackVehicleInfo_92D6F4, TrackVehicleInfo_92DC96, TrackVehicleInfo_92E238,
+    TrackVehicleInfo_92E7DA, TrackVehicleInfo_92ED7C, TrackVehicleInfo_92F31E, TrackVehicleInfo_92F8C0, TrackVehicleInfo_92FE62, TrackVehicleInfo_930524,
+    TrackVehicleInfo_930BE6, TrackVehicleInfo_9312A8, TrackVehicleInfo_93196A, TrackVehicleInfo_93202C, TrackVehicleInfo_9326EE, TrackVehicleInfo_932DB0,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000,
+    TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_000000, TrackVehicleInfo_95426E, TrackVehicleInfo_954930,
+    TrackVehicleInfo_954FF2, TrackVehicleInfo_9556B4, TrackVehicleInfo_955D76, TrackVehicleInfo_956438, TrackVehicleInfo_956AFA, TrackVehicleInfo_9571BC,
+    TrackVehicleInfo_90C4D2, TrackVehicleInfo_90C8D6, TrackVehicleInfo_90CCDA, TrackVehicleInfo_90D0DE, TrackVehicleInfo_90D4E2, TrackVehicleInfo_90D7B4,
+    TrackVehicleInfo_90DA86, TrackVehicleInfo_90DD58, TrackVehicleInfo_908EC2, TrackVehicleInfo_909974, TrackVehicleInfo_90A426, TrackVehicleInfo_90AED8,
+    TrackVehicleInfo_8BE57A, TrackVehicleInfo_8BE69C, TrackVehicleInfo_8BE7BE, TrackVehicleInfo_8BE8E0,
 };
 
 // rct2: 0x008B8F30
-constexpr const rct_vehicle_info_list * const * gTrackVehicleInfo[static_cast<uint8_t>(VehicleTrackSubposition::Count)] = {
+constexpr const rct_vehicle_info_list * gTrackVehicleInfo[static_cast<uint8_t>(VehicleTrackSubposition::Count)] = {
     TrackVehicleInfoListDefault,                  // VehicleTrackSubposition::Default
     TrackVehicleInfoListChairliftGoingOut,        // VehicleTrackSubposition::ChairliftGoingOut
     TrackVehicleInfoListChairliftGoingBack,       // VehicleTrackSubposition::ChairliftGoingBack
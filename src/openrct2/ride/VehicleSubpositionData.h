@@ -19,4 +19,8 @@ struct rct_vehicle_info_list
     const rct_vehicle_info* info;
 };
 
-extern const rct_vehicle_info_list* const* const gTrackVehicleInfo[17];
+/**
+ * For every track subposition the move info lists indexed by track type and direction. The lists are stored by value so
+ * that a vehicle step only has to follow the pointer to the move info itself.
+ */
+extern const rct_vehicle_info_list* const gTrackVehicleInfo[17];
@@ -24,6 +24,8 @@
 #include "../world/MapAnimation.h"
 #include "../world/Sprite.h"
 
+#include <functional>
+
 using random_engine_t = Random::Rct2::Engine;
 
 struct ParkLoadResult;
@@ -297,6 +299,19 @@ struct rct_s6_data
     uint8_t pad_13CE778[434];
 };
 assert_struct_size(rct_s6_data, 0x46b44a);
+
+/**
+ * Header of the OpenRCT2 chunks written after the RCT2 chunks of a saved game or scenario. RCT2 stops reading before
+ * them, so parks that fit in the RCT2 limits still load in RCT2.
+ */
+struct rct_s6_extension_header
+{
+    uint32_t magic_number;
+    uint32_t version;
+    uint32_t num_tile_elements; // Elements that did not fit in rct_s6_data::tile_elements, stored in the next chunk
+    uint32_t num_sprites;       // Sprites that did not fit in rct_s6_data::sprites, stored in the chunk after that
+};
+assert_struct_size(rct_s6_extension_header, 16);
 #pragma pack(pop)
 
 enum
@@ -314,6 +329,8 @@ enum
 
 #define S6_RCT2_VERSION 120001
 #define S6_MAGIC_NUMBER 0x00031144
+#define S6_EXTENSION_MAGIC_NUMBER 0x58453652 // "R6EX"
+#define S6_EXTENSION_VERSION 2
 
 enum
 {
@@ -457,6 +474,15 @@ uint32_t scenario_rand_max(uint32_t max);
 
 bool scenario_prepare_for_save();
 int32_t scenario_save(const utf8* path, int32_t flags);
+
+/**
+ * Copies the park on the calling thread, then runs prepareFn and writes the file on a background thread. Returns
+ * false if the park could not be copied, errors while writing are only logged.
+ */
+bool scenario_save_in_background(const utf8* path, int32_t flags, std::function<void()> prepareFn);
+
+// Blocks until a park being written by scenario_save_in_background has been written.
+void scenario_wait_for_background_save();
 void scenario_remove_trackless_rides(rct_s6_data* s6);
 void scenario_fix_ghosts(rct_s6_data* s6);
 void scenario_failure();
@@ -13,6 +13,8 @@
 
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
+#    include <iterator>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -29,11 +31,32 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
           { "network.join", HOOK_TYPE::NETWORK_JOIN },
           { "network.leave", HOOK_TYPE::NETWORK_LEAVE },
           { "ride.ratings.calculate", HOOK_TYPE::RIDE_RATINGS_CALCULATE },
-          { "action.location", HOOK_TYPE::ACTION_LOCATION } });
+          { "action.location", HOOK_TYPE::ACTION_LOCATION },
+          { "action.execute.batch", HOOK_TYPE::ACTION_EXECUTE_BATCH } });
     auto result = LookupTable.find(name);
     return (result != LookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookTypeName(HOOK_TYPE type)
+{
+    static constexpr std::string_view Names[] = {
+        "action.query",
+        "action.execute",
+        "interval.tick",
+        "interval.day",
+        "network.chat",
+        "network.authenticate",
+        "network.join",
+        "network.leave",
+        "ride.ratings.calculate",
+        "action.location",
+        "action.execute.batch",
+    };
+    static_assert(std::size(Names) == NUM_HOOK_TYPES);
+    auto index = static_cast<size_t>(type);
+    return index < std::size(Names) ? Names[index] : std::string_view();
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -44,12 +67,14 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function)
+uint32_t HookEngine::Subscribe(
+    HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, const HookFilter& filter)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    Hook hook(cookie, owner, function);
+    Hook hook(cookie, owner, function, filter);
     hookList.Hooks.push_back(hook);
+    UpdateSubscribedTypes();
     return cookie;
 }
 
@@ -65,6 +90,7 @@ void HookEngine::Unsubscribe(HOOK_TYPE type, uint32_t cookie)
             break;
         }
     }
+    UpdateSubscribedTypes();
 }
 
 void HookEngine::UnsubscribeAll(std::shared_ptr<const Plugin> owner)
@@ -75,6 +101,7 @@ void HookEngine::UnsubscribeAll(std::shared_ptr<const Plugin> owner)
         auto isOwner = [&](auto& obj) { return obj.Owner == owner; };
         hooks.erase(std::remove_if(hooks.begin(), hooks.end(), isOwner), hooks.end());
     }
+    UpdateSubscribedTypes();
 }
 
 void HookEngine::UnsubscribeAll()
@@ -84,35 +111,75 @@ void HookEngine::UnsubscribeAll()
         auto& hooks = hookList.Hooks;
         hooks.clear();
     }
+    UpdateSubscribedTypes();
 }
 
-bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
+void HookEngine::UpdateSubscribedTypes()
 {
-    auto& hookList = GetHookList(type);
-    return !hookList.Hooks.empty();
+    _subscribedTypes = 0;
+    for (const auto& hookList : _hookMap)
+    {
+        if (!hookList.Hooks.empty())
+        {
+            _subscribedTypes |= 1u << static_cast<uint32_t>(hookList.Type);
+        }
+    }
+}
+
+bool HookEngine::HasSubscriptions(HOOK_TYPE type, const HookTarget& target) const
+{
+    if (!HasSubscriptions(type))
+        return false;
+
+    const auto& hooks = GetHookList(type).Hooks;
+    return std::any_of(hooks.begin(), hooks.end(), [&target](const Hook& hook) { return hook.Filter.Matches(target); });
 }
 
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
+    if (!HasSubscriptions(type))
+        return;
+
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable, type);
     }
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
+    if (!HasSubscriptions(type))
+        return;
+
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable, type);
+    }
+}
+
+void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable, const HookTarget& target)
+{
+    if (!HasSubscriptions(type))
+        return;
+
+    auto& hookList = GetHookList(type);
+    for (auto& hook : hookList.Hooks)
+    {
+        if (hook.Filter.Matches(target))
+        {
+            _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable, type);
+        }
     }
 }
 
 void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
+    if (!HasSubscriptions(type))
+        return;
+
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
@@ -141,7 +208,7 @@ void HookEngine::Call(
 
         std::vector<DukValue> dukArgs;
         dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable, type);
     }
 }
 
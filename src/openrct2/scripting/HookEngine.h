@@ -12,11 +12,14 @@
 #ifdef ENABLE_SCRIPTING
 
 #    include "../common.h"
+#    include "../world/Location.hpp"
 #    include "Duktape.hpp"
 
 #    include <any>
 #    include <memory>
+#    include <optional>
 #    include <string>
+#    include <string_view>
 #    include <tuple>
 #    include <vector>
 
@@ -38,23 +41,63 @@ namespace OpenRCT2::Scripting
         NETWORK_LEAVE,
         RIDE_RATINGS_CALCULATE,
         ACTION_LOCATION,
+        ACTION_EXECUTE_BATCH,
         COUNT,
         UNDEFINED = -1,
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
+    static_assert(NUM_HOOK_TYPES <= 32, "Hook types must fit in the subscription mask");
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookTypeName(HOOK_TYPE type);
+
+    /**
+     * What a hook call is about, so that hooks subscribed for a single ride or area can be skipped without calling
+     * into the plugin.
+     */
+    struct HookTarget
+    {
+        int32_t RideId = -1;
+        std::optional<CoordsXY> Location;
+    };
+
+    /**
+     * Restricts a subscription to the calls of one ride or one area of the map.
+     */
+    struct HookFilter
+    {
+        int32_t RideId = -1;
+        std::optional<MapRange> Area;
+
+        bool Matches(const HookTarget& target) const
+        {
+            if (RideId != -1 && target.RideId != RideId)
+                return false;
+            if (Area && target.Location)
+            {
+                const auto& loc = *target.Location;
+                if (loc.x < Area->GetLeft() || loc.x > Area->GetRight() || loc.y < Area->GetTop()
+                    || loc.y > Area->GetBottom())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        HookFilter Filter;
 
         Hook() = default;
-        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
+        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function, const HookFilter& filter = {})
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , Filter(filter)
         {
         }
     };
@@ -75,23 +118,38 @@ namespace OpenRCT2::Scripting
         ScriptEngine& _scriptEngine;
         std::vector<HookList> _hookMap;
         uint32_t _nextCookie = 1;
+        // One bit per hook type that has at least one subscription
+        uint32_t _subscribedTypes{};
 
     public:
         HookEngine(ScriptEngine& scriptEngine);
         HookEngine(const HookEngine&) = delete;
-        uint32_t Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function);
+        uint32_t Subscribe(
+            HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, const HookFilter& filter = {});
         void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
         void UnsubscribeAll(std::shared_ptr<const Plugin> owner);
         void UnsubscribeAll();
-        bool HasSubscriptions(HOOK_TYPE type) const;
+
+        /**
+         * Cheap enough to be called before building the arguments of every call, which should only be done when this
+         * returns true.
+         */
+        bool HasSubscriptions(HOOK_TYPE type) const
+        {
+            return (_subscribedTypes & (1u << static_cast<uint32_t>(type))) != 0;
+        }
+        bool HasSubscriptions(HOOK_TYPE type, const HookTarget& target) const;
+
         void Call(HOOK_TYPE type, bool isGameStateMutable);
         void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
+        void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable, const HookTarget& target);
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
     private:
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
+        void UpdateSubscribedTypes();
     };
 } // namespace OpenRCT2::Scripting
 
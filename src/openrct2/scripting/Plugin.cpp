@@ -11,16 +11,125 @@
 
 #    include "Plugin.h"
 
+#    include "../Context.h"
 #    include "../Diagnostic.h"
 #    include "../OpenRCT2.h"
+#    include "../PlatformEnvironment.h"
+#    include "../core/File.h"
+#    include "../core/MemoryStream.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "Duktape.hpp"
 
 #    include <algorithm>
+#    include <cinttypes>
 #    include <fstream>
 #    include <memory>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+static constexpr uint32_t BYTECODE_CACHE_MAGIC_NUMBER = 0x43425344; // DSBC
+static constexpr uint32_t BYTECODE_CACHE_VERSION = 1;
+
+/**
+ * Returns the path of the bytecode cache file for the given plugin source. The name is a hash of the source, so an
+ * edited plugin gets a new cache file and a network plugin shares the cache file of the same code loaded before.
+ */
+static std::string GetBytecodeCachePath(const std::string& code)
+{
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325;
+    for (auto c : code)
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3;
+    }
+
+    const auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), "plugins");
+    return Path::Combine(directory, String::StdFormat("%016" PRIx64 ".dat", hash));
+}
+
+static duk_ret_t duk_load_function_wrapper(duk_context* ctx, void*)
+{
+    duk_load_function(ctx);
+    return 1;
+}
+
+/**
+ * Pushes the function stored in the given cache file, returns false and pushes nothing if there is no valid cache
+ * file for the source.
+ */
+static bool TryLoadBytecodeCache(duk_context* ctx, const std::string& path, const std::string& code)
+{
+    if (!File::Exists(path))
+    {
+        return false;
+    }
+
+    try
+    {
+        auto data = File::ReadAllBytes(path);
+        auto ms = MemoryStream(data.data(), data.size());
+        if (ms.ReadValue<uint32_t>() != BYTECODE_CACHE_MAGIC_NUMBER || ms.ReadValue<uint32_t>() != BYTECODE_CACHE_VERSION
+            || ms.ReadValue<uint32_t>() != DUK_VERSION || ms.ReadValue<uint32_t>() != code.size())
+        {
+            return false;
+        }
+
+        auto length = ms.ReadValue<uint32_t>();
+        if (length != ms.GetLength() - ms.GetPosition())
+        {
+            return false;
+        }
+
+        auto buffer = duk_push_fixed_buffer(ctx, length);
+        ms.Read(buffer, length);
+        if (duk_safe_call(ctx, duk_load_function_wrapper, nullptr, 1, 1) != DUK_EXEC_SUCCESS)
+        {
+            duk_pop(ctx);
+            return false;
+        }
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to read plugin bytecode cache '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
+/**
+ * Writes the bytecode of the function on top of the stack to the given cache file, the stack is left unchanged.
+ */
+static void WriteBytecodeCache(duk_context* ctx, const std::string& path, const std::string& code)
+{
+    duk_dup(ctx, -1);
+    duk_dump_function(ctx);
+    duk_size_t length{};
+    auto bytecode = duk_get_buffer(ctx, -1, &length);
+
+    MemoryStream ms;
+    ms.WriteValue<uint32_t>(BYTECODE_CACHE_MAGIC_NUMBER);
+    ms.WriteValue<uint32_t>(BYTECODE_CACHE_VERSION);
+    ms.WriteValue<uint32_t>(DUK_VERSION);
+    ms.WriteValue<uint32_t>(static_cast<uint32_t>(code.size()));
+    ms.WriteValue<uint32_t>(static_cast<uint32_t>(length));
+    ms.Write(bytecode, length);
+    duk_pop(ctx);
+
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(path));
+        auto data = static_cast<const uint8_t*>(ms.GetData());
+        File::WriteAllBytesAsync(path, std::vector<uint8_t>(data, data + ms.GetLength()));
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to write plugin bytecode cache '%s': %s", path.c_str(), e.what());
+    }
+}
+
 Plugin::Plugin(duk_context* context, const std::string& path)
     : _context(context)
     , _path(path)
@@ -39,10 +148,17 @@ void Plugin::Load()
         LoadCodeFromFile();
     }
 
-    std::string projectedVariables = "console,context,date,map,network,park";
+    std::vector<const char*> projectedVariables = { "console", "context", "date", "map", "network", "park" };
     if (!gOpenRCT2Headless)
     {
-        projectedVariables += ",ui";
+        projectedVariables.push_back("ui");
+    }
+    std::string projectedVariableList;
+    for (auto name : projectedVariables)
+    {
+        if (!projectedVariableList.empty())
+            projectedVariableList += ",";
+        projectedVariableList += name;
     }
 
     // Wrap the script in a function and pass the global objects as variables
@@ -51,19 +167,36 @@ void Plugin::Load()
     // clang-format off
     auto code = _code;
     code =
-        "     (function(" + projectedVariables + ") {"
+        "     function(" + projectedVariableList + ") {"
         "         var __metadata__ = null;"
         "         var registerPlugin = function(m) { __metadata__ = m };"
         "         (function(__metadata__) {"
                       + code +
         "         })();"
         "         return __metadata__;"
-        "     })(" + projectedVariables + ");";
+        "     }";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
-    if (result != DUK_ERR_NONE)
+    // Compiling is the slow part of loading large plugins, so the compiled function is kept in a bytecode cache
+    auto cachePath = GetBytecodeCachePath(code);
+    if (!TryLoadBytecodeCache(_context, cachePath, code))
+    {
+        auto flags = DUK_COMPILE_FUNCTION | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+        if (duk_compile_raw(_context, code.c_str(), code.size(), flags) != DUK_EXEC_SUCCESS)
+        {
+            auto val = std::string(duk_safe_to_string(_context, -1));
+            duk_pop(_context);
+            throw std::runtime_error("Failed to load plug-in script: " + val);
+        }
+        WriteBytecodeCache(_context, cachePath, code);
+    }
+
+    for (auto name : projectedVariables)
+    {
+        duk_get_global_string(_context, name);
+    }
+    auto result = duk_pcall(_context, static_cast<duk_idx_t>(projectedVariables.size()));
+    if (result != DUK_EXEC_SUCCESS)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
         duk_pop(_context);
@@ -12,7 +12,10 @@
 #ifdef ENABLE_SCRIPTING
 
 #    include "Duktape.hpp"
+#    include "HookEngine.h"
 
+#    include <algorithm>
+#    include <array>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -45,6 +48,37 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    struct PluginCallStats
+    {
+        uint64_t Calls{};
+        double TotalTime{};
+        double LongestTime{};
+
+        void Add(double time)
+        {
+            Calls++;
+            TotalTime += time;
+            LongestTime = std::max(LongestTime, time);
+        }
+    };
+
+    struct PluginPerformanceStats
+    {
+        PluginCallStats Total;
+        // One entry per hook type, followed by one for all other calls such as intervals and UI callbacks.
+        std::array<PluginCallStats, NUM_HOOK_TYPES + 1> Hooks;
+
+        // Time spent in the current budget period, a game tick or a frame while the game is paused.
+        uint32_t PeriodTick{};
+        uint32_t PeriodFrame{};
+        double PeriodTime{};
+        double LastPeriodTime{};
+        uint64_t PeriodsOverSoftBudget{};
+        uint64_t ThrottledCalls{};
+        uint32_t LastWarningTick{};
+        bool HasWarned{};
+    };
+
     class Plugin
     {
     private:
@@ -53,6 +87,7 @@ namespace OpenRCT2::Scripting
         PluginMetadata _metadata{};
         std::string _code;
         bool _hasStarted{};
+        PluginPerformanceStats _performanceStats;
 
     public:
         std::string GetPath() const
@@ -80,6 +115,11 @@ namespace OpenRCT2::Scripting
             return _hasStarted;
         }
 
+        PluginPerformanceStats& GetPerformanceStats()
+        {
+            return _performanceStats;
+        }
+
         Plugin() = default;
         Plugin(duk_context* context, const std::string& path);
         Plugin(const Plugin&) = delete;
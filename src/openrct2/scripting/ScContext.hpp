@@ -11,6 +11,8 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../MemoryReport.h"
+#    include "../TickProfiler.h"
 #    include "../actions/GameAction.h"
 #    include "../interface/Screenshot.h"
 #    include "../object/ObjectManager.h"
@@ -20,6 +22,7 @@
 #    include "ScConfiguration.hpp"
 #    include "ScDisposable.hpp"
 #    include "ScObject.hpp"
+#    include "ScWorker.hpp"
 #    include "ScriptEngine.h"
 
 #    include <cstdio>
@@ -145,6 +148,88 @@ namespace OpenRCT2::Scripting
             return result;
         }
 
+        std::vector<DukValue> getTickProfile() const
+        {
+            using namespace OpenRCT2::TickProfiler;
+
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            auto createStage = [ctx](std::string_view name, const StageSummary& summary) {
+                DukObject obj(ctx);
+                obj.Set("name", name);
+                obj.Set("mean", summary.Mean * 1000);
+                obj.Set("longest", summary.Longest * 1000);
+                return obj.Take();
+            };
+
+            std::vector<DukValue> result;
+            for (size_t i = 0; i < StageCount; i++)
+            {
+                const auto stage = static_cast<Stage>(i);
+                result.push_back(createStage(GetStageName(stage), GetStageSummary(stage)));
+            }
+            result.push_back(createStage("total", GetTotalSummary()));
+            return result;
+        }
+
+        std::vector<DukValue> getMemoryReport() const
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            std::vector<DukValue> result;
+            for (const auto& entry : OpenRCT2::MemoryReport::GetEntries())
+            {
+                DukObject obj(ctx);
+                obj.Set("name", entry.Name);
+                obj.Set("bytes", static_cast<double>(entry.Bytes));
+                obj.Set("items", static_cast<double>(entry.Items));
+                result.push_back(obj.Take());
+            }
+            return result;
+        }
+
+        std::vector<DukValue> getPerformanceStats() const
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            auto createCallStats = [ctx](const PluginCallStats& callStats) {
+                DukObject obj(ctx);
+                obj.Set("calls", static_cast<double>(callStats.Calls));
+                obj.Set("totalTime", callStats.TotalTime * 1000);
+                obj.Set("longestTime", callStats.LongestTime * 1000);
+                return obj.Take();
+            };
+
+            std::vector<DukValue> result;
+            for (const auto& plugin : scriptEngine.GetPlugins())
+            {
+                const auto& stats = plugin->GetPerformanceStats();
+                DukObject hooks(ctx);
+                for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
+                {
+                    if (stats.Hooks[i].Calls != 0)
+                    {
+                        auto name = std::string(GetHookTypeName(static_cast<HOOK_TYPE>(i)));
+                        hooks.Set(name.c_str(), createCallStats(stats.Hooks[i]));
+                    }
+                }
+                if (stats.Hooks[NUM_HOOK_TYPES].Calls != 0)
+                {
+                    hooks.Set("other", createCallStats(stats.Hooks[NUM_HOOK_TYPES]));
+                }
+
+                DukObject obj(ctx);
+                obj.Set("name", plugin->GetMetadata().Name);
+                obj.Set("calls", static_cast<double>(stats.Total.Calls));
+                obj.Set("totalTime", stats.Total.TotalTime * 1000);
+                obj.Set("longestTime", stats.Total.LongestTime * 1000);
+                obj.Set("lastTickTime", stats.LastPeriodTime * 1000);
+                obj.Set("ticksOverBudget", static_cast<double>(stats.PeriodsOverSoftBudget));
+                obj.Set("throttledCalls", static_cast<double>(stats.ThrottledCalls));
+                obj.Set("hooks", hooks.Take());
+                result.push_back(obj.Take());
+            }
+            return result;
+        }
+
         int32_t getRandom(int32_t min, int32_t max)
         {
             ThrowIfGameStateNotMutable();
@@ -154,7 +239,7 @@ namespace OpenRCT2::Scripting
             return min + scenario_rand_max(range);
         }
 
-        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback, const DukValue& options)
         {
             auto hookType = GetHookType(hook);
             if (hookType == HOOK_TYPE::UNDEFINED)
@@ -173,7 +258,31 @@ namespace OpenRCT2::Scripting
                 throw DukException() << "Not in a plugin context";
             }
 
-            auto cookie = _hookEngine.Subscribe(hookType, owner, callback);
+            HookFilter filter;
+            if (options.type() == DukValue::Type::OBJECT)
+            {
+                if (options["ride"].type() == DukValue::Type::NUMBER)
+                {
+                    if (hookType != HOOK_TYPE::RIDE_RATINGS_CALCULATE)
+                    {
+                        throw DukException() << "Hook " << hook << " can not be filtered by ride";
+                    }
+                    filter.RideId = options["ride"].as_int();
+                }
+                auto dukArea = options["area"];
+                if (dukArea.type() == DukValue::Type::OBJECT)
+                {
+                    if (hookType != HOOK_TYPE::ACTION_LOCATION)
+                    {
+                        throw DukException() << "Hook " << hook << " can not be filtered by area";
+                    }
+                    auto leftTop = FromDuk<CoordsXY>(dukArea["leftTop"]);
+                    auto rightBottom = FromDuk<CoordsXY>(dukArea["rightBottom"]);
+                    filter.Area = MapRange(leftTop, rightBottom).Normalise();
+                }
+            }
+
+            auto cookie = _hookEngine.Subscribe(hookType, owner, callback, filter);
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
@@ -258,7 +367,7 @@ namespace OpenRCT2::Scripting
             }
         }
 
-        void registerAction(const std::string& action, const DukValue& query, const DukValue& execute)
+        void registerAction(const std::string& action, const DukValue& query, const DukValue& execute, const DukValue& schema)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
@@ -271,12 +380,21 @@ namespace OpenRCT2::Scripting
             {
                 duk_error(ctx, DUK_ERR_ERROR, "execute was not a function.");
             }
-            else if (!scriptEngine.RegisterCustomAction(plugin, action, query, execute))
+            else if (!scriptEngine.RegisterCustomAction(plugin, action, query, execute, schema))
             {
                 duk_error(ctx, DUK_ERR_ERROR, "action has already been registered.");
             }
         }
 
+        std::shared_ptr<ScWorker> createWorker(const std::string& code)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+            auto worker = std::make_shared<ScWorker>(plugin, code);
+            scriptEngine.AddWorker(worker);
+            return worker;
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
@@ -286,10 +404,14 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::getObject, "getObject");
             dukglue_register_method(ctx, &ScContext::getAllObjects, "getAllObjects");
             dukglue_register_method(ctx, &ScContext::getRandom, "getRandom");
+            dukglue_register_method(ctx, &ScContext::getTickProfile, "getTickProfile");
+            dukglue_register_method(ctx, &ScContext::getPerformanceStats, "getPerformanceStats");
+            dukglue_register_method(ctx, &ScContext::getMemoryReport, "getMemoryReport");
             dukglue_register_method(ctx, &ScContext::subscribe, "subscribe");
             dukglue_register_method(ctx, &ScContext::queryAction, "queryAction");
             dukglue_register_method(ctx, &ScContext::executeAction, "executeAction");
             dukglue_register_method(ctx, &ScContext::registerAction, "registerAction");
+            dukglue_register_method(ctx, &ScContext::createWorker, "createWorker");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -19,6 +19,12 @@
 #    include "ScRide.hpp"
 #    include "ScTile.hpp"
 
+#    include <algorithm>
+#    include <cstring>
+#    include <optional>
+#    include <unordered_map>
+#    include <vector>
+
 namespace OpenRCT2::Scripting
 {
     class ScMap
@@ -81,6 +87,83 @@ namespace OpenRCT2::Scripting
             return std::make_shared<ScTile>(coords);
         }
 
+        /**
+         * Reads a rectangle of tiles in one go. Each property is a typed array with one value per tile, in rows of
+         * width tiles. Tiles outside the map read as zero.
+         */
+        DukValue getTileData(int32_t x, int32_t y, int32_t width, int32_t height) const
+        {
+            if (width < 0 || height < 0)
+            {
+                duk_error(_context, DUK_ERR_RANGE_ERROR, "Invalid rectangle.");
+            }
+
+            const size_t numTiles = static_cast<size_t>(width) * height;
+            std::vector<uint8_t> surfaceHeights(numTiles);
+            std::vector<uint8_t> maxHeights(numTiles);
+            std::vector<uint16_t> waterHeights(numTiles);
+            std::vector<uint8_t> surfaceStyles(numTiles);
+            std::vector<uint8_t> ownerships(numTiles);
+            std::vector<uint16_t> numElements(numTiles);
+            std::vector<uint16_t> elementTypes(numTiles);
+
+            const int32_t left = std::max(x, 0);
+            const int32_t top = std::max(y, 0);
+            const int32_t right = std::min<int32_t>(x + width, MAXIMUM_MAP_SIZE_TECHNICAL);
+            const int32_t bottom = std::min<int32_t>(y + height, MAXIMUM_MAP_SIZE_TECHNICAL);
+            for (int32_t tileY = top; tileY < bottom; tileY++)
+            {
+                for (int32_t tileX = left; tileX < right; tileX++)
+                {
+                    const TileElement* element = map_get_first_element_at(TileCoordsXY(tileX, tileY).ToCoordsXY());
+                    if (element == nullptr)
+                        continue;
+
+                    const size_t i = static_cast<size_t>(tileY - y) * width + (tileX - x);
+                    uint16_t count = 0;
+                    uint16_t types = 0;
+                    bool foundSurface = false;
+                    do
+                    {
+                        count++;
+                        types |= 1 << (element->GetType() >> 2);
+                        maxHeights[i] = std::max(maxHeights[i], element->clearance_height);
+
+                        auto surface = element->AsSurface();
+                        if (surface != nullptr && !foundSurface)
+                        {
+                            foundSurface = true;
+                            surfaceHeights[i] = surface->base_height;
+                            waterHeights[i] = surface->GetWaterHeight();
+                            surfaceStyles[i] = surface->GetSurfaceStyle();
+                            ownerships[i] = surface->GetOwnership();
+                        }
+                    } while (!(element++)->IsLastForTile());
+                    numElements[i] = count;
+                    elementTypes[i] = types;
+                }
+            }
+
+            auto ctx = _context;
+            auto objIdx = duk_push_object(ctx);
+            duk_push_int(ctx, x);
+            duk_put_prop_string(ctx, objIdx, "x");
+            duk_push_int(ctx, y);
+            duk_put_prop_string(ctx, objIdx, "y");
+            duk_push_int(ctx, width);
+            duk_put_prop_string(ctx, objIdx, "width");
+            duk_push_int(ctx, height);
+            duk_put_prop_string(ctx, objIdx, "height");
+            PutTypedArray(objIdx, "surfaceHeight", surfaceHeights, DUK_BUFOBJ_UINT8ARRAY);
+            PutTypedArray(objIdx, "maxHeight", maxHeights, DUK_BUFOBJ_UINT8ARRAY);
+            PutTypedArray(objIdx, "waterHeight", waterHeights, DUK_BUFOBJ_UINT16ARRAY);
+            PutTypedArray(objIdx, "surfaceStyle", surfaceStyles, DUK_BUFOBJ_UINT8ARRAY);
+            PutTypedArray(objIdx, "ownership", ownerships, DUK_BUFOBJ_UINT8ARRAY);
+            PutTypedArray(objIdx, "numElements", numElements, DUK_BUFOBJ_UINT16ARRAY);
+            PutTypedArray(objIdx, "elementTypes", elementTypes, DUK_BUFOBJ_UINT16ARRAY);
+            return DukValue::take_from_stack(ctx);
+        }
+
         DukValue getEntity(int32_t id) const
         {
             if (id >= 0 && id < MAX_SPRITES)
@@ -100,32 +183,7 @@ namespace OpenRCT2::Scripting
         {
             EntityListId targetList{};
             uint8_t targetType{};
-            if (type == "balloon")
-            {
-                targetList = EntityListId::Misc;
-                targetType = SPRITE_MISC_BALLOON;
-            }
-            if (type == "car")
-            {
-                targetList = EntityListId::TrainHead;
-            }
-            else if (type == "litter")
-            {
-                targetList = EntityListId::Litter;
-            }
-            else if (type == "duck")
-            {
-                targetList = EntityListId::Misc;
-                targetType = SPRITE_MISC_DUCK;
-            }
-            else if (type == "peep")
-            {
-                targetList = EntityListId::Peep;
-            }
-            else
-            {
-                duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
-            }
+            GetEntityListForType(type, targetList, targetType);
 
             std::vector<DukValue> result;
             for (auto sprite : EntityList(targetList))
@@ -158,6 +216,153 @@ namespace OpenRCT2::Scripting
             return result;
         }
 
+        /**
+         * Looks up entities of a type that match the query, so that only the entities a plugin is interested in are
+         * wrapped in script objects. With fields, the matches are not wrapped at all but returned as one typed array
+         * per field.
+         */
+        DukValue queryEntities(const std::string& type, const DukValue& query) const
+        {
+            EntityListId targetList{};
+            uint8_t targetType{};
+            GetEntityListForType(type, targetList, targetType);
+
+            std::optional<MapRange> range;
+            uint32_t flags = 0;
+            std::string peepType;
+            int32_t offset = 0;
+            int32_t limit = -1;
+            std::vector<EntityQueryField> fields;
+            bool project = false;
+            if (query.type() == DukValue::OBJECT)
+            {
+                auto dukRange = query["range"];
+                if (dukRange.type() == DukValue::OBJECT)
+                {
+                    auto leftTop = FromDuk<CoordsXY>(dukRange["leftTop"]);
+                    auto rightBottom = FromDuk<CoordsXY>(dukRange["rightBottom"]);
+                    range = MapRange(leftTop, rightBottom).Normalise();
+                }
+                auto dukFlags = query["flags"];
+                if (dukFlags.is_array())
+                {
+                    for (const auto& dukFlag : dukFlags.as_array())
+                    {
+                        auto mask = PeepFlagMap[AsOrDefault(dukFlag, "")];
+                        if (mask == 0)
+                        {
+                            duk_error(_context, DUK_ERR_ERROR, "Invalid peep flag.");
+                        }
+                        flags |= mask;
+                    }
+                }
+                peepType = AsOrDefault(query["peepType"], "");
+                offset = std::max(AsOrDefault(query["offset"], 0), 0);
+                limit = AsOrDefault(query["limit"], -1);
+                auto dukFields = query["fields"];
+                if (dukFields.is_array())
+                {
+                    project = true;
+                    for (const auto& dukField : dukFields.as_array())
+                    {
+                        auto field = EntityQueryFieldMap.find(AsOrDefault(dukField, ""));
+                        if (field == EntityQueryFieldMap.end())
+                        {
+                            duk_error(_context, DUK_ERR_ERROR, "Invalid entity field.");
+                        }
+                        fields.push_back(field->second);
+                    }
+                }
+            }
+
+            auto matches = [&](const SpriteBase* entity) {
+                if (range
+                    && (entity->x < range->GetLeft() || entity->x > range->GetRight() || entity->y < range->GetTop()
+                        || entity->y > range->GetBottom()))
+                    return false;
+                if (targetList == EntityListId::Peep)
+                {
+                    auto peep = entity->As<Peep>();
+                    if (peep == nullptr || (peep->PeepFlags & flags) != flags)
+                        return false;
+                    if (peepType == "guest" && peep->AssignedPeepType != PeepType::Guest)
+                        return false;
+                    if (peepType == "staff" && peep->AssignedPeepType != PeepType::Staff)
+                        return false;
+                }
+                return true;
+            };
+
+            std::vector<uint16_t> ids;
+            int32_t skipped = 0;
+            auto add = [&](const SpriteBase* entity) {
+                if (!matches(entity))
+                    return true;
+                if (skipped < offset)
+                {
+                    skipped++;
+                    return true;
+                }
+                ids.push_back(entity->sprite_index);
+                return limit < 0 || static_cast<int32_t>(ids.size()) < limit;
+            };
+            if (limit != 0)
+            {
+                for (auto sprite : EntityList(targetList))
+                {
+                    bool more = true;
+                    if (targetList == EntityListId::TrainHead)
+                    {
+                        for (auto carId = sprite->sprite_index; carId != SPRITE_INDEX_NULL && more;)
+                        {
+                            auto car = GetEntity<Vehicle>(carId);
+                            if (car == nullptr)
+                                break;
+                            more = add(car);
+                            carId = car->next_vehicle_on_train;
+                        }
+                    }
+                    else if (targetList != EntityListId::Misc || sprite->type == targetType)
+                    {
+                        more = add(sprite);
+                    }
+                    if (!more)
+                        break;
+                }
+            }
+
+            if (project)
+            {
+                auto ctx = _context;
+                auto objIdx = duk_push_object(ctx);
+                duk_push_uint(ctx, static_cast<duk_uint_t>(ids.size()));
+                duk_put_prop_string(ctx, objIdx, "length");
+                std::vector<int32_t> values(ids.size());
+                for (auto field : fields)
+                {
+                    for (size_t i = 0; i < ids.size(); i++)
+                    {
+                        values[i] = GetEntityQueryField(GetEntity(ids[i]), field);
+                    }
+                    PutTypedArray(objIdx, EntityQueryFieldNames[static_cast<size_t>(field)], values, DUK_BUFOBJ_INT32ARRAY);
+                }
+                return DukValue::take_from_stack(ctx);
+            }
+
+            duk_push_array(_context);
+            duk_uarridx_t index = 0;
+            for (auto id : ids)
+            {
+                auto entity = GetEntity(id);
+                if (entity != nullptr)
+                {
+                    GetEntityAsDukValue(entity).push();
+                    duk_put_prop_index(_context, -2, index++);
+                }
+            }
+            return DukValue::take_from_stack(_context);
+        }
+
         static void Register(duk_context* ctx)
         {
             dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
@@ -166,11 +371,154 @@ namespace OpenRCT2::Scripting
             dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
             dukglue_register_method(ctx, &ScMap::getRide, "getRide");
             dukglue_register_method(ctx, &ScMap::getTile, "getTile");
+            dukglue_register_method(ctx, &ScMap::getTileData, "getTileData");
             dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
             dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
         }
 
     private:
+        enum class EntityQueryField
+        {
+            Id,
+            X,
+            Y,
+            Z,
+            Energy,
+            Happiness,
+            Nausea,
+            Hunger,
+            Thirst,
+            Toilet,
+            Cash,
+            Ride,
+            Velocity,
+        };
+
+        static constexpr const char* EntityQueryFieldNames[] = {
+            "id",     "x",      "y",      "z",    "energy", "happiness", "nausea",
+            "hunger", "thirst", "toilet", "cash", "ride",   "velocity",
+        };
+
+        inline static const std::unordered_map<std::string, EntityQueryField> EntityQueryFieldMap = {
+            { "id", EntityQueryField::Id },
+            { "x", EntityQueryField::X },
+            { "y", EntityQueryField::Y },
+            { "z", EntityQueryField::Z },
+            { "energy", EntityQueryField::Energy },
+            { "happiness", EntityQueryField::Happiness },
+            { "nausea", EntityQueryField::Nausea },
+            { "hunger", EntityQueryField::Hunger },
+            { "thirst", EntityQueryField::Thirst },
+            { "toilet", EntityQueryField::Toilet },
+            { "cash", EntityQueryField::Cash },
+            { "ride", EntityQueryField::Ride },
+            { "velocity", EntityQueryField::Velocity },
+        };
+
+        void GetEntityListForType(const std::string& type, EntityListId& targetList, uint8_t& targetType) const
+        {
+            if (type == "balloon")
+            {
+                targetList = EntityListId::Misc;
+                targetType = SPRITE_MISC_BALLOON;
+            }
+            else if (type == "car")
+            {
+                targetList = EntityListId::TrainHead;
+            }
+            else if (type == "litter")
+            {
+                targetList = EntityListId::Litter;
+            }
+            else if (type == "duck")
+            {
+                targetList = EntityListId::Misc;
+                targetType = SPRITE_MISC_DUCK;
+            }
+            else if (type == "peep")
+            {
+                targetList = EntityListId::Peep;
+            }
+            else
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+            }
+        }
+
+        static int32_t GetEntityQueryField(const SpriteBase* entity, EntityQueryField field)
+        {
+            if (entity == nullptr)
+                return 0;
+
+            switch (field)
+            {
+                case EntityQueryField::Id:
+                    return entity->sprite_index;
+                case EntityQueryField::X:
+                    return entity->x;
+                case EntityQueryField::Y:
+                    return entity->y;
+                case EntityQueryField::Z:
+                    return entity->z;
+                default:
+                    break;
+            }
+
+            if (auto vehicle = entity->As<Vehicle>(); vehicle != nullptr)
+            {
+                if (field == EntityQueryField::Ride)
+                    return vehicle->ride;
+                if (field == EntityQueryField::Velocity)
+                    return vehicle->velocity;
+                return 0;
+            }
+
+            auto peep = entity->As<Peep>();
+            if (peep == nullptr)
+                return 0;
+            if (field == EntityQueryField::Energy)
+                return peep->Energy;
+
+            auto guest = peep->As<Guest>();
+            if (guest == nullptr)
+                return 0;
+            switch (field)
+            {
+                case EntityQueryField::Happiness:
+                    return guest->Happiness;
+                case EntityQueryField::Nausea:
+                    return guest->Nausea;
+                case EntityQueryField::Hunger:
+                    return guest->Hunger;
+                case EntityQueryField::Thirst:
+                    return guest->Thirst;
+                case EntityQueryField::Toilet:
+                    return guest->Toilet;
+                case EntityQueryField::Cash:
+                    return guest->CashInPocket;
+                case EntityQueryField::Ride:
+                    return guest->CurrentRide;
+                default:
+                    return 0;
+            }
+        }
+
+        template<typename T>
+        void PutTypedArray(duk_idx_t objIdx, const char* name, const std::vector<T>& values, duk_uint_t type) const
+        {
+            auto ctx = _context;
+            auto dataLen = values.size() * sizeof(T);
+            auto data = duk_push_fixed_buffer(ctx, dataLen);
+            if (dataLen != 0)
+            {
+                std::memcpy(data, values.data(), dataLen);
+            }
+            duk_push_buffer_object(ctx, -1, 0, dataLen, type);
+            duk_remove(ctx, -2);
+            duk_put_prop_string(ctx, objIdx, name);
+        }
+
         DukValue GetEntityAsDukValue(const SpriteBase* sprite) const
         {
             auto spriteId = sprite->sprite_index;
@@ -15,6 +15,7 @@
 #    include "../actions/NetworkModifyGroupAction.hpp"
 #    include "../actions/PlayerKickAction.hpp"
 #    include "../actions/PlayerSetGroupAction.hpp"
+#    include "../core/Json.hpp"
 #    include "../network/NetworkAction.h"
 #    include "../network/network.h"
 #    include "Duktape.hpp"
@@ -357,6 +358,18 @@ namespace OpenRCT2::Scripting
             return player;
         }
 
+        DukValue stats_get() const
+        {
+#    ifndef DISABLE_NETWORK
+            auto stats = DuktapeTryParseJson(_context, network_get_stats_as_json().dump());
+            if (stats)
+            {
+                return *stats;
+            }
+#    endif
+            return ToDuk(_context, nullptr);
+        }
+
         std::shared_ptr<ScPlayer> getPlayer(int32_t index) const
         {
 #    ifndef DISABLE_NETWORK
@@ -491,6 +504,7 @@ namespace OpenRCT2::Scripting
             dukglue_register_property(ctx, &ScNetwork::players_get, nullptr, "players");
             dukglue_register_property(ctx, &ScNetwork::currentPlayer_get, nullptr, "currentPlayer");
             dukglue_register_property(ctx, &ScNetwork::defaultGroup_get, &ScNetwork::defaultGroup_set, "defaultGroup");
+            dukglue_register_property(ctx, &ScNetwork::stats_get, nullptr, "stats");
             dukglue_register_method(ctx, &ScNetwork::addGroup, "addGroup");
             dukglue_register_method(ctx, &ScNetwork::getGroup, "getGroup");
             dukglue_register_method(ctx, &ScNetwork::removeGroup, "removeGroup");
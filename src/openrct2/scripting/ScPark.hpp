@@ -244,6 +244,7 @@ namespace OpenRCT2::Scripting
         { "difficultParkRating", PARK_FLAGS_DIFFICULT_PARK_RATING },
         { "noMoney", PARK_FLAGS_NO_MONEY_SCENARIO },
         { "unlockAllPrices", PARK_FLAGS_UNLOCK_ALL_PRICES },
+        { "longRangePathfinding", PARK_FLAGS_LONG_RANGE_PATHFINDING },
     });
 
     class ScPark
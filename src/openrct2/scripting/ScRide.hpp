@@ -276,6 +276,7 @@ namespace OpenRCT2::Scripting
             auto ride = GetRide();
             if (ride != nullptr)
             {
+                ride->Wake();
                 ride->lifecycle_flags = value;
             }
         }
@@ -292,6 +293,7 @@ namespace OpenRCT2::Scripting
             auto ride = GetRide();
             if (ride != nullptr)
             {
+                ride->Wake();
                 ride->mode = static_cast<RideMode>(value);
             }
         }
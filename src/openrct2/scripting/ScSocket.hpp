@@ -18,6 +18,7 @@
 #        include "ScriptEngine.h"
 
 #        include <algorithm>
+#        include <cstring>
 #        include <vector>
 
 namespace OpenRCT2::Scripting
@@ -116,12 +117,20 @@ namespace OpenRCT2::Scripting
         static constexpr uint32_t EVENT_DATA = 1;
         static constexpr uint32_t EVENT_CONNECT_ONCE = 2;
         static constexpr uint32_t EVENT_ERROR = 3;
+        static constexpr uint32_t EVENT_DRAIN = 4;
+
+        // Upper limit of bytes read per update, everything read in one update is raised as a single data event.
+        static constexpr size_t MAX_RECEIVE_PER_UPDATE = 1024 * 1024;
 
         EventList _eventList;
         std::unique_ptr<ITcpSocket> _socket;
+        std::vector<uint8_t> _receiveBuffer;
+        std::vector<uint8_t> _sendBuffer;
         bool _disposed{};
         bool _connecting{};
         bool _wasConnected{};
+        bool _binary{};
+        bool _needsDrain{};
 
     public:
         ScSocket(const std::shared_ptr<Plugin>& plugin)
@@ -196,43 +205,83 @@ namespace OpenRCT2::Scripting
             }
             else if (_socket != nullptr)
             {
-                if (data.type() == DukValue::Type::STRING)
-                {
-                    write(data.as_string());
-                    _socket->Finish();
-                }
-                else
+                if (data.type() != DukValue::Type::UNDEFINED)
                 {
-                    _socket->Finish();
-                    auto ctx = GetContext()->GetScriptEngine().GetContext();
-                    duk_error(ctx, DUK_ERR_ERROR, "Only sending strings is currently supported.");
+                    write(data);
                 }
+                _socket->Finish();
             }
             return this;
         }
 
-        bool write(const std::string& data)
+        /**
+         * Queues the data and sends as much of the queue as the socket accepts. Returns false if some of the data
+         * had to be kept for a later update, in which case a drain event is raised once the queue has been sent.
+         */
+        bool write(const DukValue& data)
         {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
             if (_disposed)
             {
-                auto ctx = GetContext()->GetScriptEngine().GetContext();
                 duk_error(ctx, DUK_ERR_ERROR, "Socket is disposed.");
             }
             else if (_socket != nullptr)
             {
-                try
+                if (data.type() == DukValue::Type::STRING)
                 {
-                    auto sentBytes = _socket->SendData(data.c_str(), data.size());
-                    return sentBytes != data.size();
+                    auto str = data.as_string();
+                    _sendBuffer.insert(_sendBuffer.end(), str.begin(), str.end());
                 }
-                catch (const std::exception&)
+                else
+                {
+                    data.push();
+                    if (!duk_is_buffer_data(ctx, -1))
+                    {
+                        duk_pop(ctx);
+                        duk_error(ctx, DUK_ERR_ERROR, "Only strings and buffers can be sent.");
+                    }
+                    duk_size_t len{};
+                    auto bytes = static_cast<const uint8_t*>(duk_get_buffer_data(ctx, -1, &len));
+                    _sendBuffer.insert(_sendBuffer.end(), bytes, bytes + len);
+                    duk_pop(ctx);
+                }
+
+                if (FlushSendBuffer())
                 {
-                    return false;
+                    return true;
                 }
+                _needsDrain = true;
             }
             return false;
         }
 
+        size_t bufferedAmount_get() const
+        {
+            return _sendBuffer.size();
+        }
+
+        std::string binaryType_get() const
+        {
+            return _binary ? "arraybuffer" : "string";
+        }
+
+        void binaryType_set(const std::string& value)
+        {
+            if (value == "arraybuffer")
+            {
+                _binary = true;
+            }
+            else if (value == "string")
+            {
+                _binary = false;
+            }
+            else
+            {
+                auto ctx = GetContext()->GetScriptEngine().GetContext();
+                duk_error(ctx, DUK_ERR_ERROR, "Unknown binary type.");
+            }
+        }
+
         ScSocket* on(const std::string& eventType, const DukValue& callback)
         {
             auto eventId = GetEventType(eventType);
@@ -259,6 +308,8 @@ namespace OpenRCT2::Scripting
             {
                 _socket->Close();
                 _socket = nullptr;
+                _sendBuffer.clear();
+                _needsDrain = false;
                 if (_wasConnected)
                 {
                     _wasConnected = false;
@@ -273,11 +324,79 @@ namespace OpenRCT2::Scripting
             _eventList.Raise(EVENT_CLOSE, GetPlugin(), { ToDuk(ctx, hadError) }, false);
         }
 
-        void RaiseOnData(const std::string& data)
+        void RaiseOnData()
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto ctx = scriptEngine.GetContext();
-            _eventList.Raise(EVENT_DATA, GetPlugin(), { ToDuk(ctx, data) }, false);
+            DukValue data;
+            if (_binary)
+            {
+                auto dataLen = _receiveBuffer.size();
+                auto dst = duk_push_fixed_buffer(ctx, dataLen);
+                std::memcpy(dst, _receiveBuffer.data(), dataLen);
+                duk_push_buffer_object(ctx, -1, 0, dataLen, DUK_BUFOBJ_UINT8ARRAY);
+                duk_remove(ctx, -2);
+                data = DukValue::take_from_stack(ctx);
+            }
+            else
+            {
+                auto str = std::string_view(reinterpret_cast<const char*>(_receiveBuffer.data()), _receiveBuffer.size());
+                data = ToDuk(ctx, str);
+            }
+            _receiveBuffer.clear();
+            _eventList.Raise(EVENT_DATA, GetPlugin(), { data }, false);
+        }
+
+        /**
+         * Sends as much of the queued data as possible, returns true if the queue is now empty.
+         */
+        bool FlushSendBuffer()
+        {
+            if (!_sendBuffer.empty() && _socket != nullptr && _socket->GetStatus() == SocketStatus::Connected)
+            {
+                try
+                {
+                    auto sentBytes = _socket->SendData(_sendBuffer.data(), _sendBuffer.size());
+                    _sendBuffer.erase(_sendBuffer.begin(), _sendBuffer.begin() + sentBytes);
+                }
+                catch (const std::exception&)
+                {
+                }
+            }
+            return _sendBuffer.empty();
+        }
+
+        /**
+         * Reads everything that has arrived since the last update, up to a limit, so that a stream of small packets
+         * results in one data event per update rather than one per packet.
+         */
+        void ReceiveData()
+        {
+            bool disconnected = false;
+            uint8_t buffer[16384];
+            while (_receiveBuffer.size() < MAX_RECEIVE_PER_UPDATE)
+            {
+                size_t bytesRead{};
+                auto result = _socket->ReceiveData(buffer, sizeof(buffer), &bytesRead);
+                if (result == NetworkReadPacket::Success)
+                {
+                    _receiveBuffer.insert(_receiveBuffer.end(), buffer, buffer + bytesRead);
+                }
+                else
+                {
+                    disconnected = result == NetworkReadPacket::Disconnected;
+                    break;
+                }
+            }
+
+            if (!_receiveBuffer.empty())
+            {
+                RaiseOnData();
+            }
+            if (disconnected)
+            {
+                CloseSocket();
+            }
         }
 
         uint32_t GetEventType(std::string_view name)
@@ -288,6 +407,8 @@ namespace OpenRCT2::Scripting
                 return EVENT_DATA;
             if (name == "error")
                 return EVENT_ERROR;
+            if (name == "drain")
+                return EVENT_DRAIN;
             return EVENT_NONE;
         }
 
@@ -326,21 +447,14 @@ namespace OpenRCT2::Scripting
                 }
                 else if (status == SocketStatus::Connected)
                 {
-                    char buffer[2048];
-                    size_t bytesRead{};
-                    auto result = _socket->ReceiveData(buffer, sizeof(buffer), &bytesRead);
-                    switch (result)
+                    if (FlushSendBuffer() && _needsDrain)
+                    {
+                        _needsDrain = false;
+                        _eventList.Raise(EVENT_DRAIN, GetPlugin(), {}, false);
+                    }
+                    if (_socket != nullptr)
                     {
-                        case NetworkReadPacket::Success:
-                            RaiseOnData(std::string(buffer, bytesRead));
-                            break;
-                        case NetworkReadPacket::NoData:
-                            break;
-                        case NetworkReadPacket::MoreData:
-                            break;
-                        case NetworkReadPacket::Disconnected:
-                            CloseSocket();
-                            break;
+                        ReceiveData();
                     }
                 }
                 else
@@ -368,6 +482,8 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScSocket::connect, "connect");
             dukglue_register_method(ctx, &ScSocket::end, "end");
             dukglue_register_method(ctx, &ScSocket::write, "write");
+            dukglue_register_property(ctx, &ScSocket::bufferedAmount_get, nullptr, "bufferedAmount");
+            dukglue_register_property(ctx, &ScSocket::binaryType_get, &ScSocket::binaryType_set, "binaryType");
             dukglue_register_method(ctx, &ScSocket::on, "on");
             dukglue_register_method(ctx, &ScSocket::off, "off");
         }
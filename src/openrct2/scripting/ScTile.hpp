@@ -14,6 +14,8 @@
 #    include "../Context.h"
 #    include "../common.h"
 #    include "../core/Guard.hpp"
+#    include "../peep/GuestPathfinding.h"
+#    include "../ride/RideRatings.h"
 #    include "../world/Footpath.h"
 #    include "../world/Scenery.h"
 #    include "../world/Sprite.h"
@@ -98,6 +100,7 @@ namespace OpenRCT2::Scripting
             }
 
             _element->type = type;
+            map_invalidate_tile_element_summary(_coords);
             Invalidate();
         }
 
@@ -993,6 +996,8 @@ namespace OpenRCT2::Scripting
         void Invalidate()
         {
             map_invalidate_tile_full(_coords);
+            peep_pathfind_cache_invalidate();
+            ride_ratings_cache_invalidate();
         }
 
     public:
@@ -1175,7 +1180,10 @@ namespace OpenRCT2::Scripting
                         first[numElements - 1].SetLastForTile(true);
                     }
                 }
+                map_invalidate_tile_element_summary(_coords);
                 map_invalidate_tile_full(_coords);
+                peep_pathfind_cache_invalidate();
+                ride_ratings_cache_invalidate();
             }
         }
 
@@ -1227,7 +1235,10 @@ namespace OpenRCT2::Scripting
                         first[i].SetLastForTile(false);
                     }
                     first[origNumElements].SetLastForTile(true);
+                    map_invalidate_tile_element_summary(_coords);
                     map_invalidate_tile_full(_coords);
+                    peep_pathfind_cache_invalidate();
+                    ride_ratings_cache_invalidate();
                     result = std::make_shared<ScTileElement>(_coords, &first[index]);
                 }
             }
@@ -1247,6 +1258,8 @@ namespace OpenRCT2::Scripting
             {
                 tile_element_remove(&first[index]);
                 map_invalidate_tile_full(_coords);
+                peep_pathfind_cache_invalidate();
+                ride_ratings_cache_invalidate();
             }
         }
 
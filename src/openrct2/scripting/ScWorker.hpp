@@ -0,0 +1,338 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "Duktape.hpp"
+#    include "ScriptEngine.h"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <condition_variable>
+#    include <deque>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    /**
+     * A plugin worker runs a script on a background thread in its own Duktape heap. The worker has no access to the
+     * game, it can only exchange JSON messages with the plugin that created it, which makes it suitable for expensive
+     * computations over data the plugin has copied out of the park.
+     *
+     * Terminating a worker interrupts its script: every allocation of the worker heap fails from then on and posting
+     * a message throws, so the script is stopped at its next allocation or call into the worker API. A script that
+     * loops without doing either keeps running until it does, and destroying the worker waits for it.
+     */
+    class ScWorker
+    {
+    private:
+        struct WorkerMessage
+        {
+            bool IsError{};
+            std::string Payload;
+        };
+
+        // State shared between the worker thread and the main thread
+        struct WorkerState
+        {
+            std::mutex Mutex;
+            std::condition_variable Condition;
+            std::deque<std::string> Inbox;
+            std::deque<WorkerMessage> Outbox;
+            bool Stop{};
+            std::atomic<bool> Interrupted{};
+            std::atomic<bool> Finished{};
+            DukHeapUserData HeapUserData;
+        };
+
+        static constexpr const char* STASH_WORKER_STATE = "worker_state";
+
+        std::shared_ptr<Plugin> _plugin;
+        std::unique_ptr<WorkerState> _state;
+        std::thread _thread;
+        bool _disposed{};
+        std::vector<DukValue> _messageListeners;
+        std::vector<DukValue> _errorListeners;
+
+    public:
+        ScWorker(const std::shared_ptr<Plugin>& plugin, const std::string& code)
+            : _plugin(plugin)
+            , _state(std::make_unique<WorkerState>())
+        {
+            _thread = std::thread(&ScWorker::Run, _state.get(), code);
+        }
+
+        ~ScWorker()
+        {
+            Dispose();
+            _thread.join();
+        }
+
+        const std::shared_ptr<Plugin>& GetPlugin() const
+        {
+            return _plugin;
+        }
+
+        void Update()
+        {
+            if (_disposed)
+                return;
+
+            std::deque<WorkerMessage> messages;
+            {
+                std::lock_guard<std::mutex> lock(_state->Mutex);
+                messages.swap(_state->Outbox);
+            }
+
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            for (const auto& message : messages)
+            {
+                // Copy the listeners in case they are modified by a callback
+                auto listeners = message.IsError ? _errorListeners : _messageListeners;
+                DukValue arg;
+                if (message.IsError)
+                {
+                    arg = ToDuk(ctx, message.Payload);
+                }
+                else
+                {
+                    auto value = DuktapeTryParseJson(ctx, message.Payload);
+                    if (!value)
+                        continue;
+                    arg = *value;
+                }
+                for (const auto& listener : listeners)
+                {
+                    scriptEngine.ExecutePluginCall(_plugin, listener, { arg }, false);
+                }
+                if (_disposed)
+                    break;
+            }
+        }
+
+        /**
+         * Stops the worker and interrupts its script, the thread is joined when the worker is destroyed.
+         */
+        void Dispose()
+        {
+            if (!_disposed)
+            {
+                _disposed = true;
+                {
+                    std::lock_guard<std::mutex> lock(_state->Mutex);
+                    _state->Stop = true;
+                    _state->Interrupted = true;
+                }
+                _state->Condition.notify_all();
+
+                // The worker can outlive the plugin's context while its thread finishes
+                _messageListeners.clear();
+                _errorListeners.clear();
+            }
+        }
+
+        bool IsDisposed() const
+        {
+            return _disposed;
+        }
+
+        /**
+         * Whether the thread of a disposed worker has finished, so destroying the worker does not have to wait.
+         */
+        bool HasFinished() const
+        {
+            return _state->Finished;
+        }
+
+    private:
+        void postMessage(const DukValue& data)
+        {
+            if (_disposed)
+                return;
+
+            auto ctx = data.context();
+            if (data.type() == DukValue::Type::UNDEFINED)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Message can not be undefined.");
+            }
+            data.push();
+            const char* jsonz = duk_json_encode(ctx, -1);
+            if (jsonz == nullptr)
+            {
+                duk_pop(ctx);
+                duk_error(ctx, DUK_ERR_ERROR, "Message can not be serialised to JSON.");
+            }
+            std::string json = jsonz;
+            duk_pop(ctx);
+            {
+                std::lock_guard<std::mutex> lock(_state->Mutex);
+                _state->Inbox.push_back(std::move(json));
+            }
+            _state->Condition.notify_all();
+        }
+
+        ScWorker* on(const std::string& eventType, const DukValue& callback)
+        {
+            auto listeners = GetListenerList(eventType);
+            if (listeners != nullptr)
+            {
+                listeners->push_back(callback);
+            }
+            return this;
+        }
+
+        ScWorker* off(const std::string& eventType, const DukValue& callback)
+        {
+            auto listeners = GetListenerList(eventType);
+            if (listeners != nullptr)
+            {
+                listeners->erase(std::remove(listeners->begin(), listeners->end(), callback), listeners->end());
+            }
+            return this;
+        }
+
+        void terminate()
+        {
+            Dispose();
+        }
+
+        std::vector<DukValue>* GetListenerList(std::string_view eventType)
+        {
+            if (eventType == "message")
+                return &_messageListeners;
+            if (eventType == "error")
+                return &_errorListeners;
+            return nullptr;
+        }
+
+        static void PostFromWorker(WorkerState& state, bool isError, std::string payload)
+        {
+            std::lock_guard<std::mutex> lock(state.Mutex);
+            if (!state.Stop)
+            {
+                state.Outbox.push_back({ isError, std::move(payload) });
+            }
+        }
+
+        static WorkerState& GetWorkerState(duk_context* ctx)
+        {
+            duk_push_heap_stash(ctx);
+            duk_get_prop_string(ctx, -1, STASH_WORKER_STATE);
+            auto state = static_cast<WorkerState*>(duk_get_pointer(ctx, -1));
+            duk_pop_2(ctx);
+            return *state;
+        }
+
+        // postMessage(data) as seen from inside the worker
+        static duk_ret_t WorkerPostMessage(duk_context* ctx)
+        {
+            auto& state = GetWorkerState(ctx);
+            if (state.Interrupted)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Worker has been terminated.");
+            }
+            if (duk_is_undefined(ctx, 0))
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Message can not be undefined.");
+            }
+            const char* jsonz = duk_json_encode(ctx, 0);
+            if (jsonz == nullptr)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Message can not be serialised to JSON.");
+            }
+            PostFromWorker(state, false, jsonz);
+            return 0;
+        }
+
+        static void Run(WorkerState* state, std::string code)
+        {
+            state->HeapUserData.Interrupt = &state->Interrupted;
+            auto ctx = CreateDukHeap(DukHeapType::Worker, state->HeapUserData);
+            if (ctx == nullptr)
+            {
+                PostFromWorker(*state, true, "Unable to create worker heap.");
+                state->Finished = true;
+                return;
+            }
+
+            duk_push_heap_stash(ctx);
+            duk_push_pointer(ctx, state);
+            duk_put_prop_string(ctx, -2, STASH_WORKER_STATE);
+            duk_pop(ctx);
+
+            // Anything outside a protected call that throws, such as an allocation failing once the worker has been
+            // interrupted, would be fatal to the whole process
+            if (duk_safe_call(ctx, RunScript, &code, 0, 1) != DUK_EXEC_SUCCESS)
+            {
+                PostFromWorker(*state, true, duk_safe_to_string(ctx, -1));
+            }
+
+            duk_destroy_heap(ctx);
+            state->Finished = true;
+        }
+
+        static duk_ret_t RunScript(duk_context* ctx, void* udata)
+        {
+            auto& state = GetWorkerState(ctx);
+            const auto& code = *static_cast<const std::string*>(udata);
+
+            duk_push_c_function(ctx, WorkerPostMessage, 1);
+            duk_put_global_string(ctx, "postMessage");
+
+            if (duk_peval_string(ctx, code.c_str()) != DUK_EXEC_SUCCESS)
+            {
+                PostFromWorker(state, true, duk_safe_to_string(ctx, -1));
+            }
+            duk_pop(ctx);
+
+            while (true)
+            {
+                std::string message;
+                {
+                    std::unique_lock<std::mutex> lock(state.Mutex);
+                    state.Condition.wait(lock, [&state] { return state.Stop || !state.Inbox.empty(); });
+                    if (state.Stop)
+                        break;
+                    message = std::move(state.Inbox.front());
+                    state.Inbox.pop_front();
+                }
+
+                duk_get_global_string(ctx, "onmessage");
+                if (duk_is_function(ctx, -1))
+                {
+                    duk_push_lstring(ctx, message.data(), message.size());
+                    duk_json_decode(ctx, -1);
+                    if (duk_pcall(ctx, 1) != DUK_EXEC_SUCCESS)
+                    {
+                        PostFromWorker(state, true, duk_safe_to_string(ctx, -1));
+                    }
+                }
+                duk_pop(ctx);
+            }
+            duk_push_undefined(ctx);
+            return 1;
+        }
+
+    public:
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method(ctx, &ScWorker::postMessage, "postMessage");
+            dukglue_register_method(ctx, &ScWorker::on, "on");
+            dukglue_register_method(ctx, &ScWorker::off, "off");
+            dukglue_register_method(ctx, &ScWorker::terminate, "terminate");
+        }
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -11,13 +11,17 @@
 
 #    include "ScriptEngine.h"
 
+#    include "../Context.h"
+#    include "../Game.h"
 #    include "../PlatformEnvironment.h"
 #    include "../actions/CustomAction.hpp"
 #    include "../actions/GameAction.h"
 #    include "../actions/RideCreateAction.hpp"
 #    include "../config/Config.h"
+#    include "../core/DataSerialiser.h"
 #    include "../core/File.h"
 #    include "../core/FileScanner.h"
+#    include "../core/MemoryStream.h"
 #    include "../core/Path.hpp"
 #    include "../interface/InteractiveConsole.h"
 #    include "../platform/Platform2.h"
@@ -36,14 +40,25 @@
 #    include "ScScenario.hpp"
 #    include "ScSocket.hpp"
 #    include "ScTile.hpp"
-
+#    include "ScWorker.hpp"
+
+#    include <atomic>
+#    include <chrono>
+#    include <cmath>
+#    include <cstdio>
+#    include <cstdlib>
+#    include <cstring>
 #    include <iostream>
+#    include <limits>
 #    include <stdexcept>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
-static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 11;
+static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 23;
+
+// Minimum time in milliseconds between two writes of the shared storage, changes made in between are saved together.
+static constexpr uint32_t SHARED_STORAGE_SAVE_INTERVAL = 1000;
 
 struct ExpressionStringifier final
 {
@@ -347,9 +362,90 @@ public:
     }
 };
 
+// Every allocation is prefixed with its size so that it can be taken off the heap size again when freed
+static constexpr size_t DukAllocationPrefixSize = alignof(std::max_align_t);
+static_assert(DukAllocationPrefixSize >= sizeof(size_t));
+
+static std::atomic<size_t> _dukHeapSizes[2];
+static DukHeapUserData _dukHeapUserData[] = {
+    { &_dukHeapSizes[0] },
+    { &_dukHeapSizes[1] },
+};
+
+static bool IsDukHeapInterrupted(void* udata)
+{
+    auto interrupt = static_cast<DukHeapUserData*>(udata)->Interrupt;
+    return interrupt != nullptr && interrupt->load(std::memory_order_relaxed);
+}
+
+static void* DukAlloc(void* udata, duk_size_t size)
+{
+    if (size == 0 || IsDukHeapInterrupted(udata))
+        return nullptr;
+
+    auto block = static_cast<uint8_t*>(std::malloc(size + DukAllocationPrefixSize));
+    if (block == nullptr)
+        return nullptr;
+
+    *reinterpret_cast<size_t*>(block) = size;
+    static_cast<DukHeapUserData*>(udata)->Size->fetch_add(size, std::memory_order_relaxed);
+    return block + DukAllocationPrefixSize;
+}
+
+static void DukFree(void* udata, void* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    auto block = static_cast<uint8_t*>(ptr) - DukAllocationPrefixSize;
+    static_cast<DukHeapUserData*>(udata)->Size->fetch_sub(*reinterpret_cast<size_t*>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+static void* DukRealloc(void* udata, void* ptr, duk_size_t size)
+{
+    if (ptr == nullptr)
+        return DukAlloc(udata, size);
+    if (size == 0)
+    {
+        DukFree(udata, ptr);
+        return nullptr;
+    }
+    if (IsDukHeapInterrupted(udata))
+        return nullptr;
+
+    auto block = static_cast<uint8_t*>(ptr) - DukAllocationPrefixSize;
+    auto oldSize = *reinterpret_cast<size_t*>(block);
+    auto newBlock = static_cast<uint8_t*>(std::realloc(block, size + DukAllocationPrefixSize));
+    if (newBlock == nullptr)
+        return nullptr;
+
+    *reinterpret_cast<size_t*>(newBlock) = size;
+    auto& heapSize = *static_cast<DukHeapUserData*>(udata)->Size;
+    heapSize.fetch_add(size, std::memory_order_relaxed);
+    heapSize.fetch_sub(oldSize, std::memory_order_relaxed);
+    return newBlock + DukAllocationPrefixSize;
+}
+
+duk_context* OpenRCT2::Scripting::CreateDukHeap(DukHeapType type)
+{
+    return duk_create_heap(DukAlloc, DukRealloc, DukFree, &_dukHeapUserData[static_cast<size_t>(type)], nullptr);
+}
+
+duk_context* OpenRCT2::Scripting::CreateDukHeap(DukHeapType type, DukHeapUserData& userData)
+{
+    userData.Size = &_dukHeapSizes[static_cast<size_t>(type)];
+    return duk_create_heap(DukAlloc, DukRealloc, DukFree, &userData, nullptr);
+}
+
+size_t OpenRCT2::Scripting::GetDukHeapSize(DukHeapType type)
+{
+    return _dukHeapSizes[static_cast<size_t>(type)].load(std::memory_order_relaxed);
+}
+
 DukContext::DukContext()
 {
-    _context = duk_create_heap_default();
+    _context = CreateDukHeap(DukHeapType::Engine);
     if (_context == nullptr)
     {
         throw std::runtime_error("Unable to initialise duktape context.");
@@ -368,6 +464,14 @@ ScriptEngine::ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& en
 {
 }
 
+ScriptEngine::~ScriptEngine()
+{
+    if (_sharedStorageDirty)
+    {
+        SaveSharedStorage();
+    }
+}
+
 void ScriptEngine::Initialise()
 {
     auto ctx = static_cast<duk_context*>(_context);
@@ -402,6 +506,7 @@ void ScriptEngine::Initialise()
     ScScenario::Register(ctx);
     ScScenarioObjective::Register(ctx);
     ScStaff::Register(ctx);
+    ScWorker::Register(ctx);
 
     dukglue_register_global(ctx, std::make_shared<ScCheats>(), "cheats");
     dukglue_register_global(ctx, std::make_shared<ScConsole>(_console), "console");
@@ -489,6 +594,7 @@ void ScriptEngine::StopPlugin(std::shared_ptr<Plugin> plugin)
     {
         RemoveCustomGameActions(plugin);
         RemoveSockets(plugin);
+        RemoveWorkers(plugin);
         _hookEngine.UnsubscribeAll(plugin);
         for (auto callback : _pluginStoppedSubscriptions)
         {
@@ -570,6 +676,7 @@ void ScriptEngine::UnloadPlugins()
         LogPluginInfo(plugin, "Unloaded");
     }
     _plugins.clear();
+    _gameActionBatch.clear();
     _pluginsLoaded = false;
     _pluginsStarted = false;
 }
@@ -650,8 +757,15 @@ void ScriptEngine::Update()
         }
     }
 
+    if (_sharedStorageDirty && Platform::GetTicks() - _lastSharedStorageSaveTick >= SHARED_STORAGE_SAVE_INTERVAL)
+    {
+        SaveSharedStorage();
+    }
+
     UpdateSockets();
+    UpdateWorkers();
     ProcessREPL();
+    _frame++;
 }
 
 void ScriptEngine::ProcessREPL()
@@ -687,18 +801,27 @@ std::future<void> ScriptEngine::Eval(const std::string& s)
 }
 
 DukValue ScriptEngine::ExecutePluginCall(
-    const std::shared_ptr<Plugin>& plugin, const DukValue& func, const std::vector<DukValue>& args, bool isGameStateMutable)
+    const std::shared_ptr<Plugin>& plugin, const DukValue& func, const std::vector<DukValue>& args, bool isGameStateMutable,
+    HOOK_TYPE hookType)
 {
     DukStackFrame frame(_context);
     if (func.is_function())
     {
+        if (IsPluginCallThrottled(plugin, isGameStateMutable))
+        {
+            return DukValue();
+        }
+
         ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, isGameStateMutable);
         func.push();
         for (const auto& arg : args)
         {
             arg.push();
         }
+        const auto startTime = std::chrono::high_resolution_clock::now();
         auto result = duk_pcall(_context, static_cast<duk_idx_t>(args.size()));
+        RecordPluginCall(
+            plugin, hookType, std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count());
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -713,6 +836,71 @@ DukValue ScriptEngine::ExecutePluginCall(
     return DukValue();
 }
 
+/**
+ * Starts a new budget period for the plugin if a tick or frame has passed since its last call, and checks whether the
+ * plugin has used up its hard budget for the current one. Calls that may change the game state are only skipped for
+ * local plugins, as remote plugins run on every client and skipping their calls on one of them would desync.
+ */
+bool ScriptEngine::IsPluginCallThrottled(const std::shared_ptr<Plugin>& plugin, bool isGameStateMutable)
+{
+    if (plugin == nullptr)
+        return false;
+
+    auto& stats = plugin->GetPerformanceStats();
+    if (stats.PeriodTick != gCurrentTicks || stats.PeriodFrame != _frame)
+    {
+        stats.PeriodTick = gCurrentTicks;
+        stats.PeriodFrame = _frame;
+        stats.LastPeriodTime = stats.PeriodTime;
+        stats.PeriodTime = 0;
+        stats.HasWarned = false;
+    }
+
+    const auto hardBudget = gConfigPlugin.hard_tick_budget / 1000.0;
+    if (hardBudget <= 0 || stats.PeriodTime < hardBudget)
+        return false;
+    if (isGameStateMutable && plugin->GetMetadata().Type != PluginType::Local)
+        return false;
+
+    if (stats.ThrottledCalls == 0)
+    {
+        LogPluginInfo(plugin, "Went over the hard tick budget, calls are skipped for the rest of the tick.");
+    }
+    stats.ThrottledCalls++;
+    return true;
+}
+
+void ScriptEngine::RecordPluginCall(const std::shared_ptr<Plugin>& plugin, HOOK_TYPE hookType, double time)
+{
+    if (plugin == nullptr)
+        return;
+
+    auto& stats = plugin->GetPerformanceStats();
+    stats.Total.Add(time);
+    const auto hookIndex = hookType == HOOK_TYPE::UNDEFINED ? NUM_HOOK_TYPES : static_cast<size_t>(hookType);
+    stats.Hooks[hookIndex].Add(time);
+
+    const auto softBudget = gConfigPlugin.soft_tick_budget / 1000.0;
+    const bool wasOverBudget = softBudget > 0 && stats.PeriodTime >= softBudget;
+    stats.PeriodTime += time;
+    if (softBudget <= 0 || wasOverBudget || stats.PeriodTime < softBudget)
+        return;
+
+    stats.PeriodsOverSoftBudget++;
+    // Only warn once every 30 seconds of game time, a slow plugin would otherwise flood the console.
+    constexpr uint32_t WarningInterval = 30 * GAME_UPDATE_FPS;
+    if (!stats.HasWarned && (stats.LastWarningTick == 0 || gCurrentTicks - stats.LastWarningTick >= WarningInterval))
+    {
+        stats.HasWarned = true;
+        stats.LastWarningTick = std::max<uint32_t>(gCurrentTicks, 1);
+        char buffer[128];
+        std::snprintf(
+            buffer, sizeof(buffer), "Took %.2f ms in a single tick, over the budget of %.2f ms.", stats.PeriodTime * 1000,
+            gConfigPlugin.soft_tick_budget);
+        LogPluginInfo(plugin, buffer);
+    }
+}
+
 void ScriptEngine::LogPluginInfo(const std::shared_ptr<Plugin>& plugin, const std::string_view& message)
 {
     const auto& pluginName = plugin->GetMetadata().Name;
@@ -727,7 +915,7 @@ void ScriptEngine::AddNetworkPlugin(const std::string_view& code)
 }
 
 std::unique_ptr<GameActions::Result> ScriptEngine::QueryOrExecuteCustomGameAction(
-    const std::string_view& id, const std::string_view& args, bool isExecute)
+    const std::string_view& id, const std::string_view& json, const std::vector<uint8_t>& args, bool isExecute)
 {
     std::string actionz = std::string(id);
     auto kvp = _customActions.find(actionz);
@@ -735,15 +923,12 @@ std::unique_ptr<GameActions::Result> ScriptEngine::QueryOrExecuteCustomGameActio
     {
         const auto& customAction = kvp->second;
 
-        // Deserialise the JSON args
-        std::string argsz(args);
-
-        auto dukArgs = DuktapeTryParseJson(_context, argsz);
+        auto dukArgs = DecodeCustomActionArgs(id, json, args);
         if (!dukArgs)
         {
             auto action = std::make_unique<GameActions::Result>();
             action->Error = GameActions::Status::InvalidParameters;
-            action->ErrorTitle = "Invalid JSON";
+            action->ErrorTitle = customAction.Schema.empty() ? "Invalid JSON" : "Invalid arguments";
             return action;
         }
 
@@ -862,7 +1047,8 @@ DukValue ScriptEngine::GameActionResultToDuk(const GameAction& action, const std
 }
 
 bool ScriptEngine::RegisterCustomAction(
-    const std::shared_ptr<Plugin>& plugin, const std::string_view& action, const DukValue& query, const DukValue& execute)
+    const std::shared_ptr<Plugin>& plugin, const std::string_view& action, const DukValue& query, const DukValue& execute,
+    const DukValue& schema)
 {
     std::string actionz = std::string(action);
     if (_customActions.find(actionz) != _customActions.end())
@@ -875,10 +1061,223 @@ bool ScriptEngine::RegisterCustomAction(
     customAction.Name = std::move(actionz);
     customAction.Query = query;
     customAction.Execute = execute;
+    customAction.Schema = ParseCustomActionSchema(schema);
     _customActions[customAction.Name] = std::move(customAction);
     return true;
 }
 
+static const std::unordered_map<std::string_view, CustomActionFieldType> CustomActionFieldTypeMap = {
+    { "bool", CustomActionFieldType::Bool },
+    { "int8", CustomActionFieldType::Int8 },
+    { "uint8", CustomActionFieldType::UInt8 },
+    { "int16", CustomActionFieldType::Int16 },
+    { "uint16", CustomActionFieldType::UInt16 },
+    { "int32", CustomActionFieldType::Int32 },
+    { "uint32", CustomActionFieldType::UInt32 },
+    { "float64", CustomActionFieldType::Float64 },
+    { "string", CustomActionFieldType::String },
+};
+
+/**
+ * Reads the { name: type } object passed to registerAction. The fields are sorted by name so that every peer encodes
+ * them in the same order, however the plugin enumerates its schema object.
+ */
+std::vector<CustomActionField> ScriptEngine::ParseCustomActionSchema(const DukValue& schema)
+{
+    std::vector<CustomActionField> fields;
+    if (schema.type() != DukValue::Type::OBJECT)
+    {
+        return fields;
+    }
+
+    auto ctx = schema.context();
+    schema.push();
+    duk_enum(ctx, -1, DUK_ENUM_OWN_PROPERTIES_ONLY);
+    while (duk_next(ctx, -1, 1))
+    {
+        std::string name = duk_safe_to_string(ctx, -2);
+        std::string typeName = duk_is_string(ctx, -1) ? duk_get_string(ctx, -1) : "";
+        duk_pop_2(ctx);
+
+        auto it = CustomActionFieldTypeMap.find(typeName);
+        if (it == CustomActionFieldTypeMap.end())
+        {
+            duk_pop_2(ctx);
+            throw DukException() << "Unknown type '" << typeName << "' for action argument '" << name << "'.";
+        }
+        fields.push_back({ std::move(name), it->second });
+    }
+    duk_pop_2(ctx);
+
+    std::sort(fields.begin(), fields.end(), [](const CustomActionField& a, const CustomActionField& b) {
+        return a.Name < b.Name;
+    });
+    return fields;
+}
+
+/**
+ * Plugins can pass any number for an integer argument, values that do not fit the type declared for it are rejected
+ * rather than cast.
+ */
+template<typename T> static T CustomActionArgAsInteger(const CustomActionField& field, double number)
+{
+    if (!std::isfinite(number) || number < static_cast<double>(std::numeric_limits<T>::min())
+        || number > static_cast<double>(std::numeric_limits<T>::max()))
+    {
+        throw DukException() << "Value " << number << " is out of range for action argument '" << field.Name << "'.";
+    }
+    return static_cast<T>(number);
+}
+
+std::vector<uint8_t> ScriptEngine::EncodeCustomActionArgs(
+    const std::vector<CustomActionField>& schema, const DukValue& args)
+{
+    MemoryStream ms;
+    DataSerialiser ds(true, ms);
+    for (const auto& field : schema)
+    {
+        auto value = args.type() == DukValue::Type::OBJECT ? args[field.Name] : DukValue();
+        auto number = value.type() == DukValue::Type::NUMBER ? value.as_double() : 0.0;
+        switch (field.Type)
+        {
+            case CustomActionFieldType::Bool:
+                ds << AsOrDefault(value, false);
+                break;
+            case CustomActionFieldType::Int8:
+                ds << CustomActionArgAsInteger<int8_t>(field, number);
+                break;
+            case CustomActionFieldType::UInt8:
+                ds << CustomActionArgAsInteger<uint8_t>(field, number);
+                break;
+            case CustomActionFieldType::Int16:
+                ds << CustomActionArgAsInteger<int16_t>(field, number);
+                break;
+            case CustomActionFieldType::UInt16:
+                ds << CustomActionArgAsInteger<uint16_t>(field, number);
+                break;
+            case CustomActionFieldType::Int32:
+                ds << CustomActionArgAsInteger<int32_t>(field, number);
+                break;
+            case CustomActionFieldType::UInt32:
+                ds << CustomActionArgAsInteger<uint32_t>(field, number);
+                break;
+            case CustomActionFieldType::Float64:
+            {
+                uint64_t bits;
+                std::memcpy(&bits, &number, sizeof(bits));
+                ds << bits;
+                break;
+            }
+            case CustomActionFieldType::String:
+                ds << AsOrDefault(value, std::string());
+                break;
+        }
+    }
+    auto data = static_cast<const uint8_t*>(ms.GetData());
+    return std::vector<uint8_t>(data, data + ms.GetLength());
+}
+
+/**
+ * Creates the argument object passed to the query and execute functions of a custom action. Actions registered with a
+ * schema are read field by field from their binary arguments, other actions from their JSON string.
+ */
+std::optional<DukValue> ScriptEngine::DecodeCustomActionArgs(
+    const std::string_view& id, const std::string_view& json, const std::vector<uint8_t>& args)
+{
+    auto kvp = _customActions.find(std::string(id));
+    if (kvp == _customActions.end() || kvp->second.Schema.empty())
+    {
+        return DuktapeTryParseJson(_context, json);
+    }
+
+    try
+    {
+        MemoryStream ms(args.data(), args.size());
+        DataSerialiser ds(false, ms);
+        DukObject obj(_context);
+        for (const auto& field : kvp->second.Schema)
+        {
+            switch (field.Type)
+            {
+                case CustomActionFieldType::Bool:
+                {
+                    bool value{};
+                    ds << value;
+                    obj.Set(field.Name.c_str(), value);
+                    break;
+                }
+                case CustomActionFieldType::Int8:
+                {
+                    int8_t value{};
+                    ds << value;
+                    obj.Set(field.Name.c_str(), static_cast<int32_t>(value));
+                    break;
+                }
+                case CustomActionFieldType::UInt8:
+                {
+                    uint8_t value{};
+                    ds << value;
+                    obj.Set(field.Name.c_str(), static_cast<int32_t>(value));
+                    break;
+                }
+                case CustomActionFieldType::Int16:
+                {
+                    int16_t value{};
+                    ds << value;
+                    obj.Set(field.Name.c_str(), static_cast<int32_t>(value));
+                    break;
+                }
+                case CustomActionFieldType::UInt16:
+                {
+                    uint16_t value{};
+                    ds << value;
+                    obj.Set(field.Name.c_str(), static_cast<int32_t>(value));
+                    break;
+                }
+                case CustomActionFieldType::Int32:
+                {
+                    int32_t value{};
+                    ds << value;
+                    obj.Set(field.Name.c_str(), value);
+                    break;
+                }
+                case CustomActionFieldType::UInt32:
+                {
+                    uint32_t value{};
+                    ds << value;
+                    obj.Set(field.Name.c_str(), value);
+                    break;
+                }
+                case CustomActionFieldType::Float64:
+                {
+                    uint64_t bits{};
+                    ds << bits;
+                    double value;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    obj.Set(field.Name.c_str(), value);
+                    break;
+                }
+                case CustomActionFieldType::String:
+                {
+                    std::string value;
+                    ds << value;
+                    obj.Set(field.Name.c_str(), value);
+                    break;
+                }
+            }
+        }
+        if (ms.GetPosition() != ms.GetLength())
+        {
+            return std::nullopt;
+        }
+        return obj.Take();
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
 void ScriptEngine::RemoveCustomGameActions(const std::shared_ptr<Plugin>& plugin)
 {
     for (auto it = _customActions.begin(); it != _customActions.end();)
@@ -1054,30 +1453,28 @@ static std::unique_ptr<GameAction> CreateGameActionFromActionId(const std::strin
 }
 
 void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute)
+{
+    GameActionHookArgs hookArgs;
+    RunGameActionHooks(action, result, isExecute, hookArgs);
+}
+
+void ScriptEngine::RunGameActionHooks(
+    const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute, GameActionHookArgs& hookArgs)
 {
     DukStackFrame frame(_context);
 
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
-    if (_hookEngine.HasSubscriptions(hookType))
+    const bool hasHooks = _hookEngine.HasSubscriptions(hookType);
+    const bool isBatched = isExecute && _hookEngine.HasSubscriptions(HOOK_TYPE::ACTION_EXECUTE_BATCH);
+    if (hasHooks || isBatched)
     {
         DukObject obj(_context);
 
         auto actionId = action.GetType();
         if (action.GetType() == GAME_COMMAND_CUSTOM)
         {
-            auto customAction = static_cast<const CustomAction&>(action);
+            const auto& customAction = static_cast<const CustomAction&>(action);
             obj.Set("action", customAction.GetId());
-
-            auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
-            if (dukArgs)
-            {
-                obj.Set("args", *dukArgs);
-            }
-            else
-            {
-                DukObject args(_context);
-                obj.Set("args", args.Take());
-            }
         }
         else
         {
@@ -1086,13 +1483,14 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<
             {
                 obj.Set("action", actionName);
             }
+        }
 
-            DukObject args(_context);
-            DukFromGameActionParameterVisitor visitor(args);
-            const_cast<GameAction&>(action).AcceptParameters(visitor);
-            const_cast<GameAction&>(action).AcceptFlags(visitor);
-            obj.Set("args", args.Take());
+        if (!hookArgs.Built)
+        {
+            hookArgs.Args = CreateGameActionArgs(action);
+            hookArgs.Built = true;
         }
+        obj.Set("args", hookArgs.Args);
 
         obj.Set("player", action.GetPlayer());
         obj.Set("type", actionId);
@@ -1103,7 +1501,14 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
 
-        _hookEngine.Call(hookType, dukEventArgs, false);
+        if (hasHooks)
+        {
+            _hookEngine.Call(hookType, dukEventArgs, false);
+        }
+        if (isBatched)
+        {
+            _gameActionBatch.push_back(dukEventArgs);
+        }
 
         if (!isExecute)
         {
@@ -1122,6 +1527,56 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<
     }
 }
 
+DukValue ScriptEngine::CreateGameActionArgs(const GameAction& action)
+{
+    if (action.GetType() == GAME_COMMAND_CUSTOM)
+    {
+        const auto& customAction = static_cast<const CustomAction&>(action);
+        auto dukArgs = DecodeCustomActionArgs(customAction.GetId(), customAction.GetJson(), customAction.GetArgs());
+        if (dukArgs)
+        {
+            return *dukArgs;
+        }
+        DukObject args(_context);
+        return args.Take();
+    }
+
+    DukObject args(_context);
+    DukFromGameActionParameterVisitor visitor(args);
+    const_cast<GameAction&>(action).AcceptParameters(visitor);
+    const_cast<GameAction&>(action).AcceptFlags(visitor);
+    return args.Take();
+}
+
+/**
+ * Passes the actions executed since the last call to the action.execute.batch hooks in one go, so plugins that
+ * follow every action do not have to be called once per action. Called once per tick.
+ */
+void ScriptEngine::FlushGameActionBatch()
+{
+    if (_gameActionBatch.empty())
+        return;
+
+    auto batch = std::move(_gameActionBatch);
+    _gameActionBatch.clear();
+    if (!_hookEngine.HasSubscriptions(HOOK_TYPE::ACTION_EXECUTE_BATCH))
+        return;
+
+    DukStackFrame frame(_context);
+    duk_push_array(_context);
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        batch[i].push();
+        duk_put_prop_index(_context, -2, static_cast<duk_uarridx_t>(i));
+    }
+    auto actions = DukValue::take_from_stack(_context);
+
+    DukObject obj(_context);
+    obj.Set("tick", gCurrentTicks);
+    obj.Set("actions", actions);
+    _hookEngine.Call(HOOK_TYPE::ACTION_EXECUTE_BATCH, obj.Take(), false);
+}
+
 std::unique_ptr<GameAction> ScriptEngine::CreateGameAction(const std::string& actionid, const DukValue& args)
 {
     auto action = CreateGameActionFromActionId(actionid);
@@ -1138,6 +1593,12 @@ std::unique_ptr<GameAction> ScriptEngine::CreateGameAction(const std::string& ac
     }
     else
     {
+        auto kvp = _customActions.find(actionid);
+        if (kvp != _customActions.end() && !kvp->second.Schema.empty())
+        {
+            return std::make_unique<CustomAction>(actionid, std::string(), EncodeCustomActionArgs(kvp->second.Schema, args));
+        }
+
         // Serialise args to json so that it can be sent
         auto ctx = args.context();
         if (args.type() == DukValue::Type::OBJECT)
@@ -1185,21 +1646,32 @@ void ScriptEngine::LoadSharedStorage()
     }
 }
 
+/**
+ * Encodes the shared storage and hands the JSON to the file I/O thread, so the game only pays for the encoding. Writes
+ * are queued in order, so an older snapshot never overwrites a newer one.
+ */
 void ScriptEngine::SaveSharedStorage()
 {
+    _sharedStorageDirty = false;
+    _lastSharedStorageSaveTick = Platform::GetTicks();
+
     auto path = _env.GetFilePath(PATHID::PLUGIN_STORE);
-    try
-    {
-        _sharedStorage.push();
-        auto json = std::string(duk_json_encode(_context, -1));
-        duk_pop(_context);
+    _sharedStorage.push();
+    duk_size_t length{};
+    auto json = reinterpret_cast<const uint8_t*>(duk_json_encode(_context, -1));
+    duk_get_lstring(_context, -1, &length);
+    auto data = std::vector<uint8_t>(json, json + length);
+    duk_pop(_context);
+
+    File::WriteAllBytesAsync(path, std::move(data));
+}
 
-        File::WriteAllBytes(path, json.c_str(), json.size());
-    }
-    catch (const std::exception&)
-    {
-        fprintf(stderr, "Unable to write to '%s'\n", path.c_str());
-    }
+/**
+ * Marks the shared storage as changed, it is saved on a later update so that many changes in a row cause one write.
+ */
+void ScriptEngine::ScheduleSharedStorageSave()
+{
+    _sharedStorageDirty = true;
 }
 
 #    ifndef DISABLE_NETWORK
@@ -1250,6 +1722,43 @@ void ScriptEngine::RemoveSockets(const std::shared_ptr<Plugin>& plugin)
 #    endif
 }
 
+void ScriptEngine::AddWorker(const std::shared_ptr<ScWorker>& worker)
+{
+    _workers.push_back(worker);
+}
+
+void ScriptEngine::UpdateWorkers()
+{
+    // Update calls can terminate workers. Terminated workers are kept until their thread has finished, so that dropping
+    // them does not wait for the thread.
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto& worker = *it;
+        worker->Update();
+        if (worker->IsDisposed() && worker->HasFinished())
+        {
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void ScriptEngine::RemoveWorkers(const std::shared_ptr<Plugin>& plugin)
+{
+    // They are dropped by UpdateWorkers once their thread has finished
+    for (auto& worker : _workers)
+    {
+        if (worker->GetPlugin() == plugin)
+        {
+            worker->Dispose();
+        }
+    }
+}
+
 std::string OpenRCT2::Scripting::Stringify(const DukValue& val)
 {
     return ExpressionStringifier::StringifyExpression(val);
@@ -18,10 +18,12 @@
 #    include "HookEngine.h"
 #    include "Plugin.h"
 
+#    include <atomic>
 #    include <future>
 #    include <list>
 #    include <memory>
 #    include <mutex>
+#    include <optional>
 #    include <queue>
 #    include <string>
 #    include <unordered_map>
@@ -49,6 +51,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
 #    endif
+    class ScWorker;
 
     class ScriptExecutionInfo
     {
@@ -90,6 +93,35 @@ namespace OpenRCT2::Scripting
         }
     };
 
+    enum class DukHeapType : uint8_t
+    {
+        Engine,
+        Worker,
+    };
+
+    struct DukHeapUserData
+    {
+        std::atomic<size_t>* Size{};
+        // Every allocation fails once this is set, which makes the script running on the heap throw
+        const std::atomic<bool>* Interrupt{};
+    };
+
+    /**
+     * Creates a Duktape heap whose allocations are counted towards the given type of heap.
+     */
+    duk_context* CreateDukHeap(DukHeapType type);
+
+    /**
+     * Same as above, but the script running on the heap can be interrupted through userData. The caller fills in
+     * Interrupt and keeps userData alive until the heap is destroyed.
+     */
+    duk_context* CreateDukHeap(DukHeapType type, DukHeapUserData& userData);
+
+    /**
+     * Number of bytes currently allocated by all heaps of the given type.
+     */
+    size_t GetDukHeapSize(DukHeapType type);
+
     class DukContext
     {
     private:
@@ -111,6 +143,35 @@ namespace OpenRCT2::Scripting
         }
     };
 
+    enum class CustomActionFieldType : uint8_t
+    {
+        Bool,
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float64,
+        String,
+    };
+
+    struct CustomActionField
+    {
+        std::string Name;
+        CustomActionFieldType Type{};
+    };
+
+    /**
+     * The script arguments of a game action. They are built the first time a hook needs them and then shared by the
+     * query and execute hooks of the action.
+     */
+    struct GameActionHookArgs
+    {
+        DukValue Args;
+        bool Built{};
+    };
+
     class ScriptEngine
     {
     private:
@@ -123,6 +184,9 @@ namespace OpenRCT2::Scripting
         std::queue<std::tuple<std::promise<void>, std::string>> _evalQueue;
         std::vector<std::shared_ptr<Plugin>> _plugins;
         uint32_t _lastHotReloadCheckTick{};
+        uint32_t _lastSharedStorageSaveTick{};
+        bool _sharedStorageDirty{};
+        uint32_t _frame{};
         HookEngine _hookEngine;
         ScriptExecutionInfo _execInfo;
         DukValue _sharedStorage;
@@ -138,16 +202,22 @@ namespace OpenRCT2::Scripting
             std::string Name;
             DukValue Query;
             DukValue Execute;
+            // Fields of the binary argument encoding, sorted by name. Empty if the arguments are sent as JSON.
+            std::vector<CustomActionField> Schema;
         };
 
         std::unordered_map<std::string, CustomActionInfo> _customActions;
+        // Event args of the actions executed since the last action.execute.batch call.
+        std::vector<DukValue> _gameActionBatch;
 #    ifndef DISABLE_NETWORK
         std::list<std::shared_ptr<ScSocketBase>> _sockets;
 #    endif
+        std::list<std::shared_ptr<ScWorker>> _workers;
 
     public:
         ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& env);
         ScriptEngine(ScriptEngine&) = delete;
+        ~ScriptEngine();
 
         duk_context* GetContext()
         {
@@ -176,7 +246,7 @@ namespace OpenRCT2::Scripting
         std::future<void> Eval(const std::string& s);
         DukValue ExecutePluginCall(
             const std::shared_ptr<Plugin>& plugin, const DukValue& func, const std::vector<DukValue>& args,
-            bool isGameStateMutable);
+            bool isGameStateMutable, HOOK_TYPE hookType = HOOK_TYPE::UNDEFINED);
 
         void LogPluginInfo(const std::shared_ptr<Plugin>& plugin, const std::string_view& message);
 
@@ -188,18 +258,24 @@ namespace OpenRCT2::Scripting
         void AddNetworkPlugin(const std::string_view& code);
 
         std::unique_ptr<GameActions::Result> QueryOrExecuteCustomGameAction(
-            const std::string_view& id, const std::string_view& args, bool isExecute);
+            const std::string_view& id, const std::string_view& json, const std::vector<uint8_t>& args, bool isExecute);
         bool RegisterCustomAction(
             const std::shared_ptr<Plugin>& plugin, const std::string_view& action, const DukValue& query,
-            const DukValue& execute);
+            const DukValue& execute, const DukValue& schema);
         void RunGameActionHooks(const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute);
+        void RunGameActionHooks(
+            const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute,
+            GameActionHookArgs& hookArgs);
+        void FlushGameActionBatch();
         std::unique_ptr<GameAction> CreateGameAction(const std::string& actionid, const DukValue& args);
 
         void SaveSharedStorage();
+        void ScheduleSharedStorageSave();
 
 #    ifndef DISABLE_NETWORK
         void AddSocket(const std::shared_ptr<ScSocketBase>& socket);
 #    endif
+        void AddWorker(const std::shared_ptr<ScWorker>& worker);
 
     private:
         void Initialise();
@@ -213,6 +289,13 @@ namespace OpenRCT2::Scripting
         void SetupHotReloading();
         void AutoReloadPlugins();
         void ProcessREPL();
+        DukValue CreateGameActionArgs(const GameAction& action);
+        static std::vector<CustomActionField> ParseCustomActionSchema(const DukValue& schema);
+        static std::vector<uint8_t> EncodeCustomActionArgs(const std::vector<CustomActionField>& schema, const DukValue& args);
+        std::optional<DukValue> DecodeCustomActionArgs(
+            const std::string_view& id, const std::string_view& json, const std::vector<uint8_t>& args);
+        bool IsPluginCallThrottled(const std::shared_ptr<Plugin>& plugin, bool isGameStateMutable);
+        void RecordPluginCall(const std::shared_ptr<Plugin>& plugin, HOOK_TYPE hookType, double time);
         void RemoveCustomGameActions(const std::shared_ptr<Plugin>& plugin);
         std::unique_ptr<GameActions::Result> DukToGameActionResult(const DukValue& d);
         DukValue GameActionResultToDuk(const GameAction& action, const std::unique_ptr<GameActions::Result>& result);
@@ -224,6 +307,8 @@ namespace OpenRCT2::Scripting
 
         void UpdateSockets();
         void RemoveSockets(const std::shared_ptr<Plugin>& plugin);
+        void UpdateWorkers();
+        void RemoveWorkers(const std::shared_ptr<Plugin>& plugin);
     };
 
     bool IsGameStateMutable();
@@ -95,6 +95,9 @@ std::unique_ptr<TitleSequence> LoadTitleSequence(const std::string& path)
     return seq;
 }
 
+TitleSequenceParkHandle::TitleSequenceParkHandle() = default;
+TitleSequenceParkHandle::~TitleSequenceParkHandle() = default;
+
 std::unique_ptr<TitleSequenceParkHandle> TitleSequenceGetParkHandle(const TitleSequence& seq, size_t index)
 {
     std::unique_ptr<TitleSequenceParkHandle> handle;
@@ -104,15 +107,13 @@ std::unique_ptr<TitleSequenceParkHandle> TitleSequenceGetParkHandle(const TitleS
         if (seq.IsZip)
         {
             auto zip = std::unique_ptr<IZipArchive>(Zip::TryOpen(seq.Path, ZIP_ACCESS::READ));
-            if (zip != nullptr)
+            auto stream = zip != nullptr ? zip->GetFileStream(filename) : nullptr;
+            if (stream != nullptr)
             {
-                auto data = zip->GetFileData(filename);
-                auto ms = std::make_unique<OpenRCT2::MemoryStream>();
-                ms->Write(data.data(), data.size());
-                ms->SetPosition(0);
-
+                // The park is decompressed as it is read rather than copied out of the archive up front
                 handle = std::make_unique<TitleSequenceParkHandle>();
-                handle->Stream = std::move(ms);
+                handle->Stream = std::move(stream);
+                handle->Zip = std::move(zip);
                 handle->HintPath = filename;
             }
             else
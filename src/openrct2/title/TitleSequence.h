@@ -52,10 +52,17 @@ struct TitleSequence
     bool IsZip = false;
 };
 
+struct IZipArchive;
+
 struct TitleSequenceParkHandle
 {
     std::string HintPath;
+    // Keeps the archive open for streams that read from it, so it must be destroyed after the stream
+    std::unique_ptr<IZipArchive> Zip;
     std::unique_ptr<OpenRCT2::IStream> Stream;
+
+    TitleSequenceParkHandle();
+    ~TitleSequenceParkHandle();
 };
 
 enum TITLE_SCRIPT
@@ -0,0 +1,40 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../common.h"
+#include "../core/Guard.hpp"
+#include "SawyerCoding.h"
+
+#ifdef __SSE4_1__
+
+#    include <immintrin.h>
+
+uint32_t sawyercoding_find_repeat_candidates_sse4_1(const uint8_t* window, uint8_t value)
+{
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(window + 16));
+    const uint32_t maskLo = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lo, needle)));
+    const uint32_t maskHi = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(hi, needle)));
+    return maskLo | (maskHi << 16);
+}
+
+#else
+
+#    ifdef OPENRCT2_X86
+#        error You have to compile this file with SSE4.1 enabled, when targetting x86!
+#    endif
+
+uint32_t sawyercoding_find_repeat_candidates_sse4_1(const uint8_t* window, uint8_t value)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+    return 0;
+}
+
+#endif // __SSE4_1__
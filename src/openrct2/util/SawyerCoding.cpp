@@ -314,11 +314,31 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
     return dst - dst_buffer;
 }
 
+uint32_t sawyercoding_find_repeat_candidates_scalar(const uint8_t* window, uint8_t value)
+{
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        if (window[i] == value)
+            mask |= 1u << i;
+    }
+    return mask;
+}
+
+using RepeatCandidatesFn = uint32_t (*)(const uint8_t* window, uint8_t value);
+
+static RepeatCandidatesFn get_repeat_candidates_fn()
+{
+    return sse41_available() ? sawyercoding_find_repeat_candidates_sse4_1 : sawyercoding_find_repeat_candidates_scalar;
+}
+
 static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length)
 {
     if (length == 0)
         return 0;
 
+    static const RepeatCandidatesFn findCandidates = get_repeat_candidates_fn();
+
     size_t outLength = 0;
 
     // Need to emit at least one byte, otherwise there is nothing to repeat
@@ -332,16 +352,36 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
         size_t searchIndex = (i < 32) ? 0 : (i - 32);
         size_t searchEnd = i - 1;
 
+        // Only the positions that start with the same byte can repeat anything, so the others are skipped without
+        // being compared. Bit n of the mask stands for the position searchIndex + n.
+        uint32_t candidates;
+        if (i >= 32)
+        {
+            candidates = findCandidates(src_buffer + searchIndex, src_buffer[i]);
+        }
+        else
+        {
+            candidates = 0;
+            for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+            {
+                if (src_buffer[repeatIndex] == src_buffer[i])
+                    candidates |= 1u << repeatIndex;
+            }
+        }
+
         size_t bestRepeatIndex = 0;
         size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+        while (candidates != 0)
         {
-            size_t repeatCount = 0;
+            size_t repeatIndex = searchIndex + bitscanforward(static_cast<int32_t>(candidates));
+            candidates &= candidates - 1;
+
+            size_t repeatCount = 1;
             size_t maxRepeatCount = std::min(std::min(static_cast<size_t>(7), searchEnd - repeatIndex), length - i - 1);
             // maxRepeatCount should not exceed length
             assert(repeatIndex + maxRepeatCount < length);
             assert(i + maxRepeatCount < length);
-            for (size_t j = 0; j <= maxRepeatCount; j++)
+            for (size_t j = 1; j <= maxRepeatCount; j++)
             {
                 if (src_buffer[repeatIndex + j] == src_buffer[i + j])
                 {
@@ -53,6 +53,12 @@ size_t sawyercoding_decode_td6(const uint8_t* src, uint8_t* dst, size_t length);
 size_t sawyercoding_encode_td6(const uint8_t* src, uint8_t* dst, size_t length);
 int32_t sawyercoding_validate_track_checksum(const uint8_t* src, size_t length);
 
+/**
+ * Returns a mask with bit n set for every window[n] equal to value, the window is 32 bytes long.
+ */
+uint32_t sawyercoding_find_repeat_candidates_scalar(const uint8_t* window, uint8_t value);
+uint32_t sawyercoding_find_repeat_candidates_sse4_1(const uint8_t* window, uint8_t value);
+
 int32_t sawyercoding_detect_file_type(const uint8_t* src, size_t length);
 int32_t sawyercoding_detect_rct1_version(int32_t gameVersion);
 
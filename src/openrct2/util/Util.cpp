@@ -616,6 +616,81 @@ std::optional<std::vector<uint8_t>> util_zlib_deflate(const uint8_t* data, size_
     return buffer;
 }
 
+struct ZlibInflater::Impl
+{
+    z_stream Stream{};
+    std::vector<uint8_t> Output;
+    bool Initialised = false;
+    bool Finished = false;
+    bool Failed = false;
+};
+
+ZlibInflater::ZlibInflater()
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->Initialised = inflateInit(&_impl->Stream) == Z_OK;
+    _impl->Failed = !_impl->Initialised;
+}
+
+ZlibInflater::~ZlibInflater()
+{
+    if (_impl->Initialised)
+    {
+        inflateEnd(&_impl->Stream);
+    }
+}
+
+bool ZlibInflater::Write(const uint8_t* data, size_t size)
+{
+    auto& strm = _impl->Stream;
+    if (_impl->Failed)
+        return false;
+    if (_impl->Finished)
+        return size == 0;
+
+    strm.next_in = const_cast<Bytef*>(data);
+    strm.avail_in = static_cast<uInt>(size);
+    do
+    {
+        auto& output = _impl->Output;
+        const size_t used = strm.total_out;
+        if (used == output.size())
+        {
+            // Compressed parks usually inflate to several times their size
+            output.resize(std::max<size_t>(CHUNK, output.size() * 2));
+        }
+        strm.next_out = output.data() + used;
+        strm.avail_out = static_cast<uInt>(output.size() - used);
+
+        const auto ret = inflate(&strm, Z_NO_FLUSH);
+        if (ret == Z_STREAM_END)
+        {
+            _impl->Finished = true;
+            return strm.avail_in == 0;
+        }
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            log_error("Error uncompressing data.");
+            _impl->Failed = true;
+            return false;
+        }
+        // A full output buffer may still hold back inflated data, so keep going until zlib has room to spare
+    } while (strm.avail_in > 0 || strm.avail_out == 0);
+    return true;
+}
+
+bool ZlibInflater::IsFinished() const
+{
+    return _impl->Finished;
+}
+
+std::vector<uint8_t> ZlibInflater::TakeOutput()
+{
+    auto output = std::move(_impl->Output);
+    output.resize(_impl->Stream.total_out);
+    return output;
+}
+
 // Compress the source to gzip-compatible stream, write to dest.
 // Mainly used for compressing the crashdumps
 bool util_gzip_compress(FILE* source, FILE* dest)
@@ -14,6 +14,7 @@
 
 #include <cstdio>
 #include <ctime>
+#include <memory>
 #include <optional>
 #include <type_traits>
 #include <vector>
@@ -59,6 +60,32 @@ std::optional<std::vector<uint8_t>> util_zlib_deflate(const uint8_t* data, size_
 uint8_t* util_zlib_inflate(uint8_t* data, size_t data_in_size, size_t* data_out_size);
 bool util_gzip_compress(FILE* source, FILE* dest);
 
+/**
+ * Inflates a zlib stream that arrives in pieces, so the data can be decompressed while the rest is still being received.
+ */
+class ZlibInflater
+{
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+
+public:
+    ZlibInflater();
+    ~ZlibInflater();
+
+    ZlibInflater(const ZlibInflater&) = delete;
+    ZlibInflater& operator=(const ZlibInflater&) = delete;
+
+    // Inflates the next piece of the stream, returns false if the stream is corrupt.
+    bool Write(const uint8_t* data, size_t size);
+
+    // Whether the end of the stream has been reached.
+    bool IsFinished() const;
+
+    // Returns the inflated data, only complete once IsFinished returns true.
+    std::vector<uint8_t> TakeOutput();
+};
+
 int8_t add_clamp_int8_t(int8_t value, int8_t value_to_add);
 int16_t add_clamp_int16_t(int16_t value, int16_t value_to_add);
 int32_t add_clamp_int32_t(int32_t value, int32_t value_to_add);
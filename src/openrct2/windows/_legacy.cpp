@@ -25,8 +25,10 @@
 #include "../world/Sprite.h"
 #include "Intent.h"
 
+#include <algorithm>
 #include <iterator>
 #include <tuple>
+#include <vector>
 
 bool gDisableErrorWindowSound = false;
 
@@ -38,20 +40,38 @@ uint8_t _rideConstructionState2;
 bool _stationConstructed;
 bool _deferClose;
 
+struct ProvisionalTrackPiece
+{
+    ride_id_t RideIndex;
+    int32_t TrackType;
+    int32_t TrackDirection;
+    int32_t LiftHillAndAlternativeState;
+    CoordsXYZ Position;
+
+    bool operator==(const ProvisionalTrackPiece& other) const
+    {
+        return RideIndex == other.RideIndex && TrackType == other.TrackType && TrackDirection == other.TrackDirection
+            && LiftHillAndAlternativeState == other.LiftHillAndAlternativeState && Position == other.Position;
+    }
+};
+
+// Placing a ghost runs the whole track placement, the mouse keeps asking for the same pieces while it moves over
+// the same tiles. The results are kept until an action other than the ghosts themselves has been executed.
+static uint32_t _provisionalTrackExecutedCount;
+static std::optional<ProvisionalTrackPiece> _provisionalTrackPlaced;
+static money32 _provisionalTrackPlacedCost;
+static std::vector<ProvisionalTrackPiece> _provisionalTrackFailures;
+static constexpr size_t MaxProvisionalTrackFailures = 1024;
+
 /**
  *
  *  rct2: 0x006CA162
  */
-money32 place_provisional_track_piece(
-    ride_id_t rideIndex, int32_t trackType, int32_t trackDirection, int32_t liftHillAndAlternativeState,
+static money32 place_provisional_track_piece_uncached(
+    Ride* ride, ride_id_t rideIndex, int32_t trackType, int32_t trackDirection, int32_t liftHillAndAlternativeState,
     const CoordsXYZ& trackPos)
 {
-    auto ride = get_ride(rideIndex);
-    if (ride == nullptr)
-        return MONEY32_UNDEFINED;
-
     money32 result;
-    ride_construction_remove_ghosts();
     if (ride->type == RIDE_TYPE_MAZE)
     {
         int32_t flags = GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_NO_SPEND
@@ -124,6 +144,57 @@ money32 place_provisional_track_piece(
     }
 }
 
+money32 place_provisional_track_piece(
+    ride_id_t rideIndex, int32_t trackType, int32_t trackDirection, int32_t liftHillAndAlternativeState,
+    const CoordsXYZ& trackPos)
+{
+    auto ride = get_ride(rideIndex);
+    if (ride == nullptr)
+        return MONEY32_UNDEFINED;
+
+    if (_provisionalTrackExecutedCount != GameActions::GetExecutedCount())
+    {
+        _provisionalTrackPlaced.reset();
+        _provisionalTrackFailures.clear();
+    }
+
+    const ProvisionalTrackPiece piece{ rideIndex, trackType, trackDirection, liftHillAndAlternativeState, trackPos };
+    if (_provisionalTrackPlaced == piece
+        && (_currentTrackSelectionFlags & (TRACK_SELECTION_FLAG_TRACK | TRACK_SELECTION_FLAG_ENTRANCE_OR_EXIT))
+            == TRACK_SELECTION_FLAG_TRACK)
+    {
+        // The ghost of this piece is still in place
+        return _provisionalTrackPlacedCost;
+    }
+
+    ride_construction_remove_ghosts();
+    _provisionalTrackPlaced.reset();
+    if (std::find(_provisionalTrackFailures.begin(), _provisionalTrackFailures.end(), piece)
+        != _provisionalTrackFailures.end())
+    {
+        _provisionalTrackExecutedCount = GameActions::GetExecutedCount();
+        return MONEY32_UNDEFINED;
+    }
+
+    money32 result = place_provisional_track_piece_uncached(
+        ride, rideIndex, trackType, trackDirection, liftHillAndAlternativeState, trackPos);
+
+    // Only the ghosts have been changed since the check above
+    _provisionalTrackExecutedCount = GameActions::GetExecutedCount();
+    if (result == MONEY32_UNDEFINED)
+    {
+        if (_provisionalTrackFailures.size() >= MaxProvisionalTrackFailures)
+            _provisionalTrackFailures.clear();
+        _provisionalTrackFailures.push_back(piece);
+    }
+    else
+    {
+        _provisionalTrackPlaced = piece;
+        _provisionalTrackPlacedCost = result;
+    }
+    return result;
+}
+
 static std::tuple<bool, uint8_t> window_ride_construction_update_state_get_track_element()
 {
     auto intent = Intent(INTENT_ACTION_RIDE_CONSTRUCTION_UPDATE_PIECES);
@@ -163,6 +163,16 @@ void climate_update()
             }
         }
     }
+}
+
+/**
+ * Thunder and lightning update iteration.
+ * These are only seen and heard, they have no effect on the park so they are kept apart from climate_update.
+ */
+void climate_update_effects()
+{
+    if (gScreenFlags & (~SCREEN_FLAGS_PLAYING))
+        return;
 
     if (_thunderTimer != 0)
     {
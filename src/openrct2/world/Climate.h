@@ -78,6 +78,7 @@ extern uint16_t gClimateLightningFlash;
 int32_t climate_celsius_to_fahrenheit(int32_t celsius);
 void climate_reset(ClimateType climate);
 void climate_update();
+void climate_update_effects();
 void climate_update_sound();
 void climate_force_weather(uint8_t weather);
 
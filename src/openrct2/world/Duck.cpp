@@ -200,7 +200,7 @@ void Duck::UpdateSwim()
             }
             else
             {
-                z = waterZ;
+                MoveTo({ x, y, waterZ });
                 randomNumber = scenario_rand();
                 if ((randomNumber & 0xFFFF) <= 0xAAA)
                 {
@@ -1558,6 +1558,7 @@ rct_scenery_entry* PathElement::GetAdditionEntry() const
 void PathElement::SetAddition(uint8_t newAddition)
 {
     Additions = newAddition;
+    map_invalidate_tile_element_summaries();
 }
 
 bool PathElement::AdditionIsGhost() const
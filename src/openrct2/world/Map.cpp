@@ -28,6 +28,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../interface/Cursors.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
@@ -36,7 +37,10 @@
 #include "../network/network.h"
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../paint/tile_element/Paint.TileElement.h"
+#include "../peep/GuestPathfinding.h"
 #include "../ride/RideData.h"
+#include "../ride/RideRatings.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
@@ -56,8 +60,11 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <iterator>
 #include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -99,7 +106,7 @@ int16_t gMapSize;
 int16_t gMapSizeMaxXY;
 int16_t gMapBaseZ;
 
-TileElement gTileElements[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
+TileElementStore gTileElements;
 TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
 std::vector<CoordsXY> gMapSelectionTiles;
 std::vector<PeepSpawn> gPeepSpawns;
@@ -107,6 +114,70 @@ std::vector<PeepSpawn> gPeepSpawns;
 TileElement* gNextFreeTileElement;
 uint32_t gNextFreeTileElementPointerIndex;
 
+// Each tile owns a block of elements that may be bigger than its element run, so that inserts can usually happen in
+// place. A capacity of 0 means the block size is unknown and is treated as just the element run.
+static uint16_t _tileElementBlockCapacity[MAX_TILE_TILE_ELEMENT_POINTERS];
+// Blocks left behind by tiles that moved to a bigger block, indexed by block size. Bigger blocks are only reclaimed by
+// map_reorganise_elements.
+static constexpr size_t MaxFreeTileElementBlockSize = 32;
+static std::vector<TileElement*> _freeTileElementBlocks[MaxFreeTileElementBlockSize + 1];
+
+// Changed whenever tile elements may have moved in memory
+static uint32_t _tileElementGeneration;
+
+// Tiles invalidated since the journal was last taken, each tile recorded once. Once the journal is full it overflows
+// and the consumer has to treat every tile as changed.
+static constexpr size_t MaxMapChangeJournalSize = 4096;
+static bool _mapChangeJournalEnabled;
+static bool _mapChangeJournalOverflowed;
+static std::vector<TileCoordsXY> _mapChangeJournal;
+static std::bitset<MAX_TILE_TILE_ELEMENT_POINTERS> _mapChangeJournalMarks;
+
+// Which element types each tile may contain, one bit per type. Bits can go stale when elements are removed, so this is
+// only ever a superset of the types on the tile. A summary is only valid for the generation it was built in, setting
+// the type of any element starts a new generation. The summary also notes what the scenery and grass growth pass needs
+// to look at, so that it can skip tiles without scanning them.
+struct TileElementSummary
+{
+    uint32_t Generation;
+    uint32_t Types;
+};
+static constexpr uint32_t TileElementSummaryKnown = 1 << 16;
+// Small scenery that ages or a footpath addition that may be a fountain
+static constexpr uint32_t TileElementSummaryGrowth = 1 << 17;
+// Style of the surface element, grass growth depends on it
+static constexpr uint32_t TileElementSummarySurfaceStyleShift = 24;
+
+// Tiles visited by map_update_tiles each tick
+static constexpr int32_t TilesUpdatedPerTick = 43;
+static TileElementSummary _tileElementSummaries[MAX_TILE_TILE_ELEMENT_POINTERS];
+static uint32_t _tileElementSummaryGeneration = 1;
+
+// Ownership of the first surface element of every tile as bitmaps over the technical map area, one bit per tile in row
+// order. They are rebuilt in one pass when the ownership of any surface or the elements of any tile may have changed,
+// so the full-map land counts become popcounts over a few kilobytes instead of walks over every tile element.
+struct TileOwnershipPlanes
+{
+    using Bitmap = std::array<uint64_t, MAX_TILE_TILE_ELEMENT_POINTERS / 64>;
+
+    // Owned or with construction rights owned, these make up the park size
+    Bitmap InPark;
+    Bitmap OwnershipForSale;
+    Bitmap ConstructionRightsForSale;
+    // Further surface elements on a tile that count towards the park size, only found in hacked parks
+    int32_t ExtraInParkElements;
+
+    bool Valid;
+    uint32_t SummaryGeneration;
+    uint32_t ElementGeneration;
+    uint32_t OwnershipGeneration;
+};
+static TileOwnershipPlanes _tileOwnershipPlanes;
+static uint32_t _tileOwnershipGeneration;
+
+// Elements at the end of the store that only single element inserts may use, see map_check_free_elements_and_reorganise.
+static constexpr size_t TileElementStoreSpareRoom = MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - MAX_TILE_ELEMENTS;
+
 bool gLandMountainMode;
 bool gLandPaintMode;
 bool gClearSmallScenery;
@@ -211,6 +282,72 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     gTileElementTilePointers[tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+    map_invalidate_tile_element_summary(tilePos.ToCoordsXY());
+    _tileElementGeneration++;
+}
+
+uint32_t map_get_tile_element_generation()
+{
+    return _tileElementGeneration;
+}
+
+void map_invalidate_tile_element_summaries()
+{
+    _tileElementSummaryGeneration++;
+}
+
+void map_invalidate_tile_element_summary(const CoordsXY& loc)
+{
+    // Whole elements may have been written, which can include the ownership of a surface
+    _tileOwnershipGeneration++;
+    if (!map_is_location_valid(loc))
+        return;
+
+    auto tilePos = TileCoordsXY{ loc };
+    _tileElementSummaries[tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL].Types = 0;
+}
+
+static uint32_t map_get_tile_element_summary(size_t tileIndex)
+{
+    auto& summary = _tileElementSummaries[tileIndex];
+    if (summary.Generation != _tileElementSummaryGeneration || !(summary.Types & TileElementSummaryKnown))
+    {
+        uint32_t types = TileElementSummaryKnown;
+        const TileElement* tileElement = gTileElementTilePointers[tileIndex];
+        if (tileElement != nullptr)
+        {
+            do
+            {
+                types |= 1u << (tileElement->GetType() >> 2);
+                switch (tileElement->GetType())
+                {
+                    case TILE_ELEMENT_TYPE_SURFACE:
+                        types |= (tileElement->AsSurface()->GetSurfaceStyle() & 0xFF) << TileElementSummarySurfaceStyleShift;
+                        break;
+                    case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                        types |= TileElementSummaryGrowth;
+                        break;
+                    case TILE_ELEMENT_TYPE_PATH:
+                        if (tileElement->AsPath()->HasAddition())
+                            types |= TileElementSummaryGrowth;
+                        break;
+                }
+            } while (!(tileElement++)->IsLastForTile());
+        }
+        summary.Generation = _tileElementSummaryGeneration;
+        summary.Types = types;
+    }
+    return summary.Types;
+}
+
+bool map_tile_may_contain(const CoordsXY& loc, uint8_t tileElementType)
+{
+    if (!map_is_location_valid(loc))
+        return false;
+
+    auto tilePos = TileCoordsXY{ loc };
+    const auto types = map_get_tile_element_summary(tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL);
+    return (types & (1u << ((tileElementType & TILE_ELEMENT_TYPE_MASK) >> 2))) != 0;
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -234,6 +371,9 @@ SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
 
 PathElement* map_get_path_element_at(const TileCoordsXYZ& loc)
 {
+    if (!map_tile_may_contain(loc.ToCoordsXY(), TILE_ELEMENT_TYPE_PATH))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(loc.ToCoordsXY());
 
     if (tileElement == nullptr)
@@ -257,6 +397,9 @@ PathElement* map_get_path_element_at(const TileCoordsXYZ& loc)
 
 BannerElement* map_get_banner_element_at(const CoordsXYZ& bannerPos, uint8_t position)
 {
+    if (!map_tile_may_contain(bannerPos, TILE_ELEMENT_TYPE_BANNER))
+        return nullptr;
+
     auto bannerTilePos = TileCoordsXYZ{ bannerPos };
     TileElement* tileElement = map_get_first_element_at(bannerPos);
 
@@ -287,6 +430,7 @@ void map_init(int32_t size)
 {
     gNextFreeTileElementPointerIndex = 0;
 
+    map_reset_tile_element_store(MAX_TILE_TILE_ELEMENT_POINTERS);
     for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
     {
         TileElement* tile_element = &gTileElements[i];
@@ -319,28 +463,45 @@ void map_init(int32_t size)
     context_broadcast_intent(&intent);
 }
 
-/**
- * Counts the number of surface tiles that offer land ownership rights for sale,
- * but haven't been bought yet. It updates gLandRemainingOwnershipSales and
- * gLandRemainingConstructionSales.
- */
-void map_count_remaining_land_rights()
+void map_invalidate_tile_ownership()
 {
-    gLandRemainingOwnershipSales = 0;
-    gLandRemainingConstructionSales = 0;
+    _tileOwnershipGeneration++;
+}
 
-    for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+static const TileOwnershipPlanes& map_get_tile_ownership_planes()
+{
+    auto& planes = _tileOwnershipPlanes;
+    if (planes.Valid && planes.SummaryGeneration == _tileElementSummaryGeneration
+        && planes.ElementGeneration == _tileElementGeneration && planes.OwnershipGeneration == _tileOwnershipGeneration)
     {
-        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        return planes;
+    }
+
+    planes.InPark.fill(0);
+    planes.OwnershipForSale.fill(0);
+    planes.ConstructionRightsForSale.fill(0);
+    planes.ExtraInParkElements = 0;
+    map_for_each_tile([&planes](const TileElementSpan& span) {
+        const size_t tileIndex = span.Tile.x + span.Tile.y * MAXIMUM_MAP_SIZE_TECHNICAL;
+        const size_t word = tileIndex / 64;
+        const uint64_t bit = 1ULL << (tileIndex % 64);
+        bool isFirstSurface = true;
+        for (const auto& element : span)
         {
-            auto* surfaceElement = map_get_surface_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
-            // Surface elements are sometimes hacked out to save some space for other map elements
-            if (surfaceElement == nullptr)
+            if (element.GetType() != TILE_ELEMENT_TYPE_SURFACE)
+                continue;
+
+            const uint8_t flags = element.AsSurface()->GetOwnership();
+            const bool inPark = (flags & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)) != 0;
+            if (!isFirstSurface)
             {
+                planes.ExtraInParkElements += inPark ? 1 : 0;
                 continue;
             }
+            isFirstSurface = false;
 
-            uint8_t flags = surfaceElement->GetOwnership();
+            if (inPark)
+                planes.InPark[word] |= bit;
 
             // Do not combine this condition with (flags & OWNERSHIP_AVAILABLE)
             // As some RCT1 parks have owned tiles with the 'construction rights available' flag also set
@@ -348,16 +509,76 @@ void map_count_remaining_land_rights()
             {
                 if (flags & OWNERSHIP_AVAILABLE)
                 {
-                    gLandRemainingOwnershipSales++;
+                    planes.OwnershipForSale[word] |= bit;
                 }
                 else if (
                     (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE) && (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED) == 0)
                 {
-                    gLandRemainingConstructionSales++;
+                    planes.ConstructionRightsForSale[word] |= bit;
                 }
             }
         }
+    });
+
+    planes.Valid = true;
+    planes.SummaryGeneration = _tileElementSummaryGeneration;
+    planes.ElementGeneration = _tileElementGeneration;
+    planes.OwnershipGeneration = _tileOwnershipGeneration;
+    return planes;
+}
+
+static int32_t bitcount64(uint64_t source)
+{
+    return bitcount(static_cast<uint32_t>(source)) + bitcount(static_cast<uint32_t>(source >> 32));
+}
+
+/**
+ * Counts the tiles set in a bitmap within the square of the given size at the origin.
+ */
+static int32_t map_count_tiles_in_square(const TileOwnershipPlanes::Bitmap& bitmap, int32_t size)
+{
+    constexpr int32_t WordsPerRow = MAXIMUM_MAP_SIZE_TECHNICAL / 64;
+    std::array<uint64_t, WordsPerRow> rowMask{};
+    for (int32_t i = 0; i < WordsPerRow; i++)
+    {
+        const int32_t tilesInWord = std::clamp(size - i * 64, 0, 64);
+        rowMask[i] = tilesInWord == 64 ? ~0ULL : (1ULL << tilesInWord) - 1;
+    }
+
+    int32_t count = 0;
+    for (int32_t y = 0; y < size; y++)
+    {
+        for (int32_t i = 0; i < WordsPerRow; i++)
+        {
+            count += bitcount64(bitmap[y * WordsPerRow + i] & rowMask[i]);
+        }
+    }
+    return count;
+}
+
+/**
+ * Counts the number of surface tiles that offer land ownership rights for sale,
+ * but haven't been bought yet. It updates gLandRemainingOwnershipSales and
+ * gLandRemainingConstructionSales.
+ */
+void map_count_remaining_land_rights()
+{
+    // Surface elements are sometimes hacked out to save some space for other map elements, such tiles have no bits set
+    const auto& planes = map_get_tile_ownership_planes();
+    const int32_t size = std::clamp<int32_t>(gMapSize, 0, MAXIMUM_MAP_SIZE_TECHNICAL);
+    gLandRemainingOwnershipSales = map_count_tiles_in_square(planes.OwnershipForSale, size);
+    gLandRemainingConstructionSales = map_count_tiles_in_square(planes.ConstructionRightsForSale, size);
+}
+
+int32_t map_count_park_tiles()
+{
+    const auto& planes = map_get_tile_ownership_planes();
+    int32_t count = planes.ExtraInParkElements;
+    for (auto word : planes.InPark)
+    {
+        count += bitcount64(word);
     }
+    return count;
 }
 
 /**
@@ -371,10 +592,28 @@ void map_count_remaining_land_rights()
  */
 void map_strip_ghost_flag_from_elements()
 {
-    for (auto& element : gTileElements)
+    map_for_each_tile_parallel([](const TileElementSpan& span) {
+        for (auto& element : span)
+        {
+            element.SetGhost(false);
+        }
+    });
+}
+
+void map_for_each_tile_parallel(const std::function<void(const TileElementSpan&)>& fn)
+{
+    if (!gConfigGeneral.multithreading)
     {
-        element.SetGhost(false);
+        map_for_each_tile(fn);
+        return;
     }
+
+    // A few rows per task keeps the tasks big enough to be worth handing out
+    constexpr int32_t RowsPerTask = 8;
+    JobPool::ParallelFor(MAXIMUM_MAP_SIZE_TECHNICAL / RowsPerTask, [&fn](size_t i) {
+        const auto firstRow = static_cast<int32_t>(i) * RowsPerTask;
+        map_for_each_tile_in_rows(firstRow, firstRow + RowsPerTask, fn);
+    });
 }
 
 /**
@@ -385,12 +624,19 @@ void map_update_tile_pointers()
 {
     int32_t i, x, y;
 
+    // The whole map may have been replaced
+    _tileElementGeneration++;
+    peep_pathfind_cache_invalidate();
+    ride_ratings_cache_invalidate();
+    tile_element_paint_cache_invalidate();
+    map_reset_tile_element_blocks();
+
     for (i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
     {
         gTileElementTilePointers[i] = TILE_UNDEFINED_TILE_ELEMENT;
     }
 
-    TileElement* tileElement = gTileElements;
+    TileElement* tileElement = gTileElements.data();
     TileElement** tile = gTileElementTilePointers;
     for (y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
@@ -616,6 +862,30 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection)
     return false;
 }
 
+/**
+ * Returns one bit per footpath element on the tile which is set if the path is wide. Tiles with more than 63 footpath
+ * elements set the top bit so that any update to them is treated as a change.
+ */
+static uint64_t map_get_path_wide_flags(const CoordsXY& loc)
+{
+    uint64_t flags = 0;
+    int32_t pathIndex = 0;
+    TileElement* tileElement = map_get_first_element_at(loc);
+    if (tileElement == nullptr)
+        return flags;
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (pathIndex >= 63)
+            return flags | (1ULL << 63);
+        if (tileElement->AsPath()->IsWide())
+            flags |= 1ULL << pathIndex;
+        pathIndex++;
+    } while (!(tileElement++)->IsLastForTile());
+    return flags;
+}
+
 /**
  *
  *  rct2: 0x006A876D
@@ -629,12 +899,22 @@ void map_update_path_wide_flags()
 
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
-    // progress. A maximum of 128 calls is done per update.
+    // progress. A maximum of 128 calls is done per update. Tiles without paths, which includes every tile outside
+    // of the map, are skipped but still count towards the 128 so that each tile keeps being updated on the same tick.
     uint16_t x = gWidePathTileLoopX;
     uint16_t y = gWidePathTileLoopY;
     for (int32_t i = 0; i < 128; i++)
     {
-        footpath_update_path_wide_flags({ x, y });
+        if (map_tile_may_contain({ x, y }, TILE_ELEMENT_TYPE_PATH))
+        {
+            // The guest pathfinding results depend on which paths are wide
+            auto wideFlagsBefore = map_get_path_wide_flags({ x, y });
+            footpath_update_path_wide_flags({ x, y });
+            if (map_get_path_wide_flags({ x, y }) != wideFlagsBefore)
+            {
+                peep_pathfind_cache_invalidate();
+            }
+        }
 
         // Next x, y tile
         x += COORDS_XY_STEP;
@@ -943,6 +1223,8 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    _tileElementGeneration++;
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -954,14 +1236,10 @@ void tile_element_remove(TileElement* tileElement)
         } while (!(++tileElement)->IsLastForTile());
     }
 
-    // Mark the latest element with the last element flag.
+    // Mark the latest element with the last element flag. The freed element stays part of the tile's block so that
+    // the tile can grow into it again.
     (tileElement - 1)->SetLastForTile(true);
     tileElement->base_height = MAX_ELEMENT_HEIGHT;
-
-    if ((tileElement + 1) == gNextFreeTileElement)
-    {
-        gNextFreeTileElement--;
-    }
 }
 
 /**
@@ -1059,14 +1337,7 @@ void map_invalidate_selection_rect()
     bottom += 32;
     top -= 32 + 2080;
 
-    for (int32_t i = 0; i < MAX_VIEWPORT_COUNT; i++)
-    {
-        rct_viewport* viewport = &g_viewport_list[i];
-        if (viewport->width != 0)
-        {
-            viewport_invalidate(viewport, left, top, right, bottom);
-        }
-    }
+    viewports_invalidate(left, top, right, bottom);
 }
 
 /**
@@ -1077,14 +1348,8 @@ void map_reorganise_elements()
 {
     context_setcurrentcursor(CursorID::ZZZ);
 
-    auto newTileElements = std::make_unique<TileElement[]>(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
-    TileElement* newElementsPtr = newTileElements.get();
-
-    if (newTileElements == nullptr)
-    {
-        log_fatal("Unable to allocate memory for map elements.");
-        return;
-    }
+    TileElementStore newTileElements(gTileElements.size());
+    TileElement* newElementsPtr = newTileElements.data();
 
     for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
@@ -1103,13 +1368,38 @@ void map_reorganise_elements()
         }
     }
 
-    const auto numElements = static_cast<uint32_t>(newElementsPtr - newTileElements.get());
-    std::memcpy(gTileElements, newTileElements.get(), numElements * sizeof(TileElement));
-    std::memset(gTileElements + numElements, 0, (MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - numElements) * sizeof(TileElement));
-
+    gTileElements = std::move(newTileElements);
     map_update_tile_pointers();
 }
 
+/**
+ * Size the tile element store grows to for numElements elements, there is some slack so growing is amortised.
+ */
+static size_t map_get_tile_element_store_size(size_t numElements)
+{
+    return std::min<size_t>(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM, numElements + numElements / 2 + TileElementStoreSpareRoom);
+}
+
+void map_reset_tile_element_store(size_t numElements)
+{
+    gTileElements.assign(map_get_tile_element_store_size(numElements));
+    gNextFreeTileElement = gTileElements.data();
+    _tileElementGeneration++;
+    map_reset_tile_element_blocks();
+}
+
+/**
+ * Grows the tile element store in place, so elements do not move and pointers to them stay valid.
+ */
+static void map_grow_tile_element_store(size_t numElements)
+{
+    const size_t newSize = map_get_tile_element_store_size(numElements);
+    if (newSize > gTileElements.size())
+    {
+        gTileElements.resize(newSize);
+    }
+}
+
 /**
  *
  *  rct2: 0x0068B044
@@ -1120,18 +1410,23 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
 {
     if (numElements != 0)
     {
-        auto tileElementEnd = &gTileElements[MAX_TILE_ELEMENTS];
-
         // Check if is there is room for the required number of elements
-        auto newTileElementEnd = gNextFreeTileElement + numElements;
-        if (newTileElementEnd > tileElementEnd)
+        auto newNumElements = static_cast<size_t>(gNextFreeTileElement - gTileElements.data()) + numElements;
+        if (newNumElements + TileElementStoreSpareRoom > gTileElements.size()
+            && gTileElements.size() < MAX_TILE_ELEMENTS_WITH_SPARE_ROOM)
+        {
+            // Grow the store, the map is only defragmented once the store can not grow any further
+            map_grow_tile_element_store(newNumElements);
+        }
+
+        if (newNumElements + TileElementStoreSpareRoom > gTileElements.size())
         {
             // Defragment the map element list
             map_reorganise_elements();
 
             // Check if there is any room again
-            newTileElementEnd = gNextFreeTileElement + numElements;
-            if (newTileElementEnd > tileElementEnd)
+            newNumElements = static_cast<size_t>(gNextFreeTileElement - gTileElements.data()) + numElements;
+            if (newNumElements + TileElementStoreSpareRoom > gTileElements.size())
             {
                 // Not enough spare elements left :'(
                 gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
@@ -1142,6 +1437,68 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
     return true;
 }
 
+void map_reset_tile_element_blocks()
+{
+    std::fill(std::begin(_tileElementBlockCapacity), std::end(_tileElementBlockCapacity), 0);
+    map_invalidate_tile_element_summaries();
+    for (auto& blocks : _freeTileElementBlocks)
+    {
+        blocks.clear();
+    }
+}
+
+static bool tile_element_is_in_store(const TileElement* tileElement)
+{
+    return tileElement >= gTileElements.data() && tileElement < gTileElements.data() + gTileElements.size();
+}
+
+static void tile_element_free_block(TileElement* block, size_t size)
+{
+    if (size == 0 || size > MaxFreeTileElementBlockSize || !tile_element_is_in_store(block))
+        return;
+
+    _freeTileElementBlocks[size].push_back(block);
+}
+
+/**
+ * Finds a block of at least minSize elements, preferably wantedSize. Released blocks are reused before new
+ * elements are taken from the end of the store.
+ */
+static TileElement* tile_element_allocate_block(size_t minSize, size_t wantedSize, size_t* blockSize)
+{
+    for (size_t size = minSize; size <= MaxFreeTileElementBlockSize; size++)
+    {
+        auto& blocks = _freeTileElementBlocks[size];
+        if (blocks.empty())
+            continue;
+
+        auto* block = blocks.back();
+        blocks.pop_back();
+        if (size > wantedSize)
+        {
+            tile_element_free_block(block + wantedSize, size - wantedSize);
+            size = wantedSize;
+        }
+        *blockSize = size;
+        return block;
+    }
+
+    // Only dip into the spare room for the elements that are actually needed.
+    const auto numFreeElements = gTileElements.size() - static_cast<size_t>(gNextFreeTileElement - gTileElements.data());
+    size_t size = wantedSize;
+    if (size + TileElementStoreSpareRoom > numFreeElements)
+    {
+        size = minSize;
+        if (size > numFreeElements)
+            return nullptr;
+    }
+
+    auto* block = gNextFreeTileElement;
+    gNextFreeTileElement += size;
+    *blockSize = size;
+    return block;
+}
+
 /**
  *
  *  rct2: 0x0068B1F6
@@ -1149,8 +1506,6 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants)
 {
     const auto& tileLoc = TileCoordsXYZ(loc);
-    TileElement *originalTileElement, *newTileElement, *insertedElement;
-    bool isLastForTile = false;
 
     if (!map_check_free_elements_and_reorganise(1))
     {
@@ -1158,63 +1513,90 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
         return nullptr;
     }
 
-    newTileElement = gNextFreeTileElement;
-    originalTileElement = gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x];
+    const size_t tileIndex = tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x;
+    TileElement* originalTileElement = gTileElementTilePointers[tileIndex];
+    _tileElementGeneration++;
 
-    // Set tile index pointer to point to new element block
-    gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x] = newTileElement;
+    // Elements below the insert height stay below the new element
+    size_t numElements = 0;
+    size_t insertIndex = 0;
+    if (originalTileElement != nullptr)
+    {
+        bool insertIndexFound = false;
+        do
+        {
+            if (!insertIndexFound && loc.z < originalTileElement[numElements].GetBaseZ())
+            {
+                insertIndex = numElements;
+                insertIndexFound = true;
+            }
+        } while (!originalTileElement[numElements++].IsLastForTile());
+
+        if (!insertIndexFound)
+        {
+            insertIndex = numElements;
+        }
+    }
 
-    if (originalTileElement == nullptr)
+    TileElement* newTileElement = originalTileElement;
+    if (originalTileElement != nullptr && tile_element_is_in_store(originalTileElement)
+        && numElements < _tileElementBlockCapacity[tileIndex])
     {
-        isLastForTile = true;
+        // There is slack in the block, move the elements above the insert height up by one
+        std::memmove(
+            &newTileElement[insertIndex + 1], &newTileElement[insertIndex], (numElements - insertIndex) * sizeof(TileElement));
     }
     else
     {
-        // Copy all elements that are below the insert height
-        while (loc.z >= originalTileElement->GetBaseZ())
+        // Move the tile to a bigger block with some slack so the next few inserts can happen in place
+        const size_t minSize = numElements + 1;
+        size_t blockSize = 0;
+        newTileElement = tile_element_allocate_block(minSize, minSize + std::max<size_t>(1, minSize / 4), &blockSize);
+        if (newTileElement == nullptr)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
+            log_error("Cannot insert new element");
+            return nullptr;
+        }
 
-            if ((newTileElement - 1)->IsLastForTile())
+        if (originalTileElement != nullptr)
+        {
+            std::memcpy(newTileElement, originalTileElement, insertIndex * sizeof(TileElement));
+            std::memcpy(
+                &newTileElement[insertIndex + 1], &originalTileElement[insertIndex],
+                (numElements - insertIndex) * sizeof(TileElement));
+            for (size_t i = 0; i < numElements; i++)
             {
-                // No more elements above the insert element
-                (newTileElement - 1)->SetLastForTile(false);
-                isLastForTile = true;
-                break;
+                originalTileElement[i].base_height = MAX_ELEMENT_HEIGHT;
             }
+            tile_element_free_block(
+                originalTileElement, std::max<size_t>(numElements, _tileElementBlockCapacity[tileIndex]));
         }
+
+        // Set tile index pointer to point to new element block
+        gTileElementTilePointers[tileIndex] = newTileElement;
+        _tileElementBlockCapacity[tileIndex] = static_cast<uint16_t>(blockSize);
     }
 
-    // Insert new map element
-    insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->SetBaseZ(loc.z);
-    newTileElement->Flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->SetClearanceZ(loc.z);
-    std::memset(&newTileElement->pad_04, 0, sizeof(newTileElement->pad_04));
-    std::memset(&newTileElement->pad_08, 0, sizeof(newTileElement->pad_08));
-    newTileElement++;
-
-    // Insert rest of map elements above insert height
-    if (!isLastForTile)
+    const bool isLastForTile = insertIndex == numElements;
+    if (isLastForTile && numElements != 0)
     {
-        do
-        {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-        } while (!((newTileElement - 1)->IsLastForTile()));
+        // No more elements above the insert element
+        newTileElement[numElements - 1].SetLastForTile(false);
     }
 
-    gNextFreeTileElement = newTileElement;
+    // The new element starts out as a surface and gets its real type afterwards
+    _tileElementSummaries[tileIndex].Types = 0;
+
+    // Insert new map element
+    TileElement* insertedElement = &newTileElement[insertIndex];
+    insertedElement->type = 0;
+    insertedElement->SetBaseZ(loc.z);
+    insertedElement->Flags = 0;
+    insertedElement->SetLastForTile(isLastForTile);
+    insertedElement->SetOccupiedQuadrants(occupiedQuadrants);
+    insertedElement->SetClearanceZ(loc.z);
+    std::memset(&insertedElement->pad_04, 0, sizeof(insertedElement->pad_04));
+    std::memset(&insertedElement->pad_08, 0, sizeof(insertedElement->pad_08));
     return insertedElement;
 }
 
@@ -1512,14 +1894,32 @@ std::unique_ptr<GameActions::ConstructClearResult> MapCanConstructAt(const Coord
  *
  *  rct2: 0x006646E1
  */
+static bool map_surface_style_can_grow(uint32_t surfaceStyle)
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    auto obj = static_cast<TerrainSurfaceObject*>(objManager.GetLoadedObject(ObjectType::TerrainSurface, surfaceStyle));
+    return obj != nullptr && (obj->Flags & TERRAIN_SURFACE_FLAGS::CAN_GROW);
+}
+
 void map_update_tiles()
 {
     int32_t ignoreScreenFlags = SCREEN_FLAGS_SCENARIO_EDITOR | SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER;
     if (gScreenFlags & ignoreScreenFlags)
         return;
 
-    // Update 43 more tiles
-    for (int32_t j = 0; j < 43; j++)
+    struct GrowthTile
+    {
+        CoordsXY Pos;
+        bool Grass;
+        bool Scenery;
+    };
+
+    // Work out which of the next 43 tiles have grass or scenery to update from their summaries first. Tiles outside of
+    // the map or without anything that grows are skipped but still count, so the cadence stays the same. An update
+    // only ever changes its own tile, so the summaries of the tiles after it stay valid.
+    GrowthTile batch[TilesUpdatedPerTick];
+    size_t batchSize = 0;
+    for (int32_t j = 0; j < TilesUpdatedPerTick; j++)
     {
         int32_t x = 0;
         int32_t y = 0;
@@ -1533,21 +1933,50 @@ void map_update_tiles()
             interleaved_xy >>= 1;
         }
 
-        auto mapPos = TileCoordsXY{ x, y }.ToCoordsXY();
-        auto* surfaceElement = map_get_surface_element_at(mapPos);
-        if (surfaceElement != nullptr)
+        gGrassSceneryTileLoopPosition++;
+        gGrassSceneryTileLoopPosition &= 0xFFFF;
+
+        if (x >= gMapSize || y >= gMapSize)
+            continue;
+
+        const auto types = map_get_tile_element_summary(x + y * MAXIMUM_MAP_SIZE_TECHNICAL);
+        if (!(types & (1u << (TILE_ELEMENT_TYPE_SURFACE >> 2))))
+            continue;
+
+        const bool grass = map_surface_style_can_grow(types >> TileElementSummarySurfaceStyleShift);
+        const bool scenery = (types & TileElementSummaryGrowth) != 0;
+        if (grass || scenery)
         {
-            surfaceElement->UpdateGrassLength(mapPos);
-            scenery_update_tile(mapPos);
+            batch[batchSize++] = { TileCoordsXY{ x, y }.ToCoordsXY(), grass, scenery };
         }
+    }
 
-        gGrassSceneryTileLoopPosition++;
-        gGrassSceneryTileLoopPosition &= 0xFFFF;
+    for (size_t i = 0; i < batchSize; i++)
+    {
+        const auto& tile = batch[i];
+        if (tile.Grass)
+        {
+            auto* surfaceElement = map_get_surface_element_at(tile.Pos);
+            if (surfaceElement != nullptr)
+            {
+                surfaceElement->UpdateGrassLength(tile.Pos);
+            }
+        }
+        if (tile.Scenery)
+        {
+            scenery_update_tile(tile.Pos);
+        }
     }
 }
 
 void map_remove_provisional_elements()
 {
+    // The provisional elements are put back right after the guests have updated, which leaves the footpath network as
+    // the guests last saw it, so there is no need to throw away their pathfinding caches every tick. The ratings only
+    // look at elements that are not ghosts.
+    peep_pathfind_cache_suspend_invalidation(true);
+    ride_ratings_cache_suspend_invalidation(true);
+
     if (gFootpathProvisionalFlags & PROVISIONAL_PATH_FLAG_1)
     {
         footpath_provisional_remove();
@@ -1565,10 +1994,16 @@ void map_remove_provisional_elements()
         auto intent = Intent(INTENT_ACTION_TRACK_DESIGN_REMOVE_PROVISIONAL);
         context_broadcast_intent(&intent);
     }
+
+    peep_pathfind_cache_suspend_invalidation(false);
+    ride_ratings_cache_suspend_invalidation(false);
 }
 
 void map_restore_provisional_elements()
 {
+    peep_pathfind_cache_suspend_invalidation(true);
+    ride_ratings_cache_suspend_invalidation(true);
+
     if (gFootpathProvisionalFlags & PROVISIONAL_PATH_FLAG_1)
     {
         gFootpathProvisionalFlags &= ~PROVISIONAL_PATH_FLAG_1;
@@ -1586,6 +2021,9 @@ void map_restore_provisional_elements()
         auto intent = Intent(INTENT_ACTION_TRACK_DESIGN_RESTORE_PROVISIONAL);
         context_broadcast_intent(&intent);
     }
+
+    peep_pathfind_cache_suspend_invalidation(false);
+    ride_ratings_cache_suspend_invalidation(false);
 }
 
 /**
@@ -1813,6 +2251,9 @@ int32_t map_get_highest_z(const CoordsXY& loc)
 
 LargeSceneryElement* map_get_large_scenery_segment(const CoordsXYZD& sceneryPos, int32_t sequence)
 {
+    if (!map_tile_may_contain(sceneryPos, TILE_ELEMENT_TYPE_LARGE_SCENERY))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(sceneryPos);
     if (tileElement == nullptr)
     {
@@ -1837,6 +2278,9 @@ LargeSceneryElement* map_get_large_scenery_segment(const CoordsXYZD& sceneryPos,
 
 EntranceElement* map_get_park_entrance_element_at(const CoordsXYZ& entranceCoords, bool ghost)
 {
+    if (!map_tile_may_contain(entranceCoords, TILE_ELEMENT_TYPE_ENTRANCE))
+        return nullptr;
+
     auto entranceTileCoords = TileCoordsXYZ(entranceCoords);
     TileElement* tileElement = map_get_first_element_at(entranceCoords);
     if (tileElement != nullptr)
@@ -1863,6 +2307,9 @@ EntranceElement* map_get_park_entrance_element_at(const CoordsXYZ& entranceCoord
 
 EntranceElement* map_get_ride_entrance_element_at(const CoordsXYZ& entranceCoords, bool ghost)
 {
+    if (!map_tile_may_contain(entranceCoords, TILE_ELEMENT_TYPE_ENTRANCE))
+        return nullptr;
+
     auto entranceTileCoords = TileCoordsXYZ{ entranceCoords };
     TileElement* tileElement = map_get_first_element_at(entranceCoords);
     if (tileElement != nullptr)
@@ -1889,6 +2336,9 @@ EntranceElement* map_get_ride_entrance_element_at(const CoordsXYZ& entranceCoord
 
 EntranceElement* map_get_ride_exit_element_at(const CoordsXYZ& exitCoords, bool ghost)
 {
+    if (!map_tile_may_contain(exitCoords, TILE_ELEMENT_TYPE_ENTRANCE))
+        return nullptr;
+
     auto exitTileCoords = TileCoordsXYZ{ exitCoords };
     TileElement* tileElement = map_get_first_element_at(exitCoords);
     if (tileElement != nullptr)
@@ -1915,6 +2365,9 @@ EntranceElement* map_get_ride_exit_element_at(const CoordsXYZ& exitCoords, bool
 
 SmallSceneryElement* map_get_small_scenery_element_at(const CoordsXYZ& sceneryCoords, int32_t type, uint8_t quadrant)
 {
+    if (!map_tile_may_contain(sceneryCoords, TILE_ELEMENT_TYPE_SMALL_SCENERY))
+        return nullptr;
+
     auto sceneryTileCoords = TileCoordsXYZ{ sceneryCoords };
     TileElement* tileElement = map_get_first_element_at(sceneryCoords);
     if (tileElement != nullptr)
@@ -2012,11 +2465,55 @@ ScreenCoordsXY translate_3d_to_2d_with_z(int32_t rotation, const CoordsXYZ& pos)
     return ScreenCoordsXY{ rotated.y - rotated.x, ((rotated.x + rotated.y) >> 1) - pos.z };
 }
 
+void map_change_journal_set_enabled(bool enabled)
+{
+    _mapChangeJournalEnabled = enabled;
+    _mapChangeJournal.clear();
+    _mapChangeJournalMarks.reset();
+    _mapChangeJournalOverflowed = false;
+}
+
+bool map_change_journal_take(std::vector<TileCoordsXY>& tiles)
+{
+    bool overflowed = _mapChangeJournalOverflowed;
+    tiles.clear();
+    if (!overflowed)
+    {
+        tiles.swap(_mapChangeJournal);
+    }
+    _mapChangeJournal.clear();
+    _mapChangeJournalMarks.reset();
+    _mapChangeJournalOverflowed = false;
+    return !overflowed;
+}
+
+static void map_change_journal_record(const TileCoordsXY& tilePos)
+{
+    if (!_mapChangeJournalEnabled || _mapChangeJournalOverflowed)
+        return;
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tilePos.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    auto index = tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL;
+    if (_mapChangeJournalMarks[index])
+        return;
+
+    if (_mapChangeJournal.size() >= MaxMapChangeJournalSize)
+    {
+        _mapChangeJournalOverflowed = true;
+        return;
+    }
+    _mapChangeJournalMarks[index] = true;
+    _mapChangeJournal.push_back(tilePos);
+}
+
 static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
 {
     if (gOpenRCT2Headless)
         return;
 
+    map_change_journal_record(TileCoordsXY{ CoordsXY{ x, y } });
+
     int32_t x1, y1, x2, y2;
 
     x += 16;
@@ -2028,14 +2525,7 @@ static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int
     x2 = screenCoord.x + 32;
     y2 = screenCoord.y + 32 - z0;
 
-    for (int32_t i = 0; i < MAX_VIEWPORT_COUNT; i++)
-    {
-        rct_viewport* viewport = &g_viewport_list[i];
-        if (viewport->width != 0 && (maxZoom == -1 || viewport->zoom <= maxZoom))
-        {
-            viewport_invalidate(viewport, x1, y1, x2, y2);
-        }
-    }
+    viewports_invalidate(x1, y1, x2, y2, maxZoom);
 }
 
 /**
@@ -2083,6 +2573,19 @@ void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
 {
     int32_t x0, y0, x1, y1, left, right, top, bottom;
 
+    if (_mapChangeJournalEnabled)
+    {
+        auto tileMins = TileCoordsXY{ mins };
+        auto tileMaxs = TileCoordsXY{ maxs };
+        for (int32_t tileY = tileMins.y; tileY <= tileMaxs.y; tileY++)
+        {
+            for (int32_t tileX = tileMins.x; tileX <= tileMaxs.x; tileX++)
+            {
+                map_change_journal_record({ tileX, tileY });
+            }
+        }
+    }
+
     x0 = mins.x + 16;
     y0 = mins.y + 16;
 
@@ -2096,14 +2599,7 @@ void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
     bottom += 32;
     top -= 32 + 2080;
 
-    for (int32_t i = 0; i < MAX_VIEWPORT_COUNT; i++)
-    {
-        rct_viewport* viewport = &g_viewport_list[i];
-        if (viewport->width != 0)
-        {
-            viewport_invalidate(viewport, left, top, right, bottom);
-        }
-    }
+    viewports_invalidate(left, top, right, bottom);
 }
 
 int32_t map_get_tile_side(const CoordsXY& mapPos)
@@ -2190,6 +2686,9 @@ void map_clear_all_elements()
  */
 TrackElement* map_get_track_element_at(const CoordsXYZ& trackPos)
 {
+    if (!map_tile_may_contain(trackPos, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     if (tileElement == nullptr)
         return nullptr;
@@ -2214,6 +2713,9 @@ TrackElement* map_get_track_element_at(const CoordsXYZ& trackPos)
  */
 TileElement* map_get_track_element_at_of_type(const CoordsXYZ& trackPos, int32_t trackType)
 {
+    if (!map_tile_may_contain(trackPos, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     if (tileElement == nullptr)
         return nullptr;
@@ -2241,6 +2743,9 @@ TileElement* map_get_track_element_at_of_type(const CoordsXYZ& trackPos, int32_t
  */
 TileElement* map_get_track_element_at_of_type_seq(const CoordsXYZ& trackPos, int32_t trackType, int32_t sequence)
 {
+    if (!map_tile_may_contain(trackPos, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     auto trackTilePos = TileCoordsXYZ{ trackPos };
     do
@@ -2264,6 +2769,9 @@ TileElement* map_get_track_element_at_of_type_seq(const CoordsXYZ& trackPos, int
 
 TrackElement* map_get_track_element_at_of_type(const CoordsXYZD& location, int32_t trackType)
 {
+    if (!map_tile_may_contain(location, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     auto tileElement = map_get_first_element_at(location);
     if (tileElement != nullptr)
     {
@@ -2287,6 +2795,9 @@ TrackElement* map_get_track_element_at_of_type(const CoordsXYZD& location, int32
 
 TrackElement* map_get_track_element_at_of_type_seq(const CoordsXYZD& location, int32_t trackType, int32_t sequence)
 {
+    if (!map_tile_may_contain(location, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     auto tileElement = map_get_first_element_at(location);
     if (tileElement != nullptr)
     {
@@ -2318,6 +2829,9 @@ TrackElement* map_get_track_element_at_of_type_seq(const CoordsXYZD& location, i
  */
 TileElement* map_get_track_element_at_of_type_from_ride(const CoordsXYZ& trackPos, int32_t trackType, ride_id_t rideIndex)
 {
+    if (!map_tile_may_contain(trackPos, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     if (tileElement == nullptr)
         return nullptr;
@@ -2347,6 +2861,9 @@ TileElement* map_get_track_element_at_of_type_from_ride(const CoordsXYZ& trackPo
  */
 TileElement* map_get_track_element_at_from_ride(const CoordsXYZ& trackPos, ride_id_t rideIndex)
 {
+    if (!map_tile_may_contain(trackPos, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     if (tileElement == nullptr)
         return nullptr;
@@ -2375,6 +2892,9 @@ TileElement* map_get_track_element_at_from_ride(const CoordsXYZ& trackPos, ride_
  */
 TileElement* map_get_track_element_at_with_direction_from_ride(const CoordsXYZD& trackPos, ride_id_t rideIndex)
 {
+    if (!map_tile_may_contain(trackPos, TILE_ELEMENT_TYPE_TRACK))
+        return nullptr;
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     if (tileElement == nullptr)
         return nullptr;
@@ -2398,6 +2918,9 @@ TileElement* map_get_track_element_at_with_direction_from_ride(const CoordsXYZD&
 
 WallElement* map_get_wall_element_at(const CoordsXYRangedZ& coords)
 {
+    if (!map_tile_may_contain(coords, TILE_ELEMENT_TYPE_WALL))
+        return nullptr;
+
     auto tileElement = map_get_first_element_at(coords);
 
     if (tileElement != nullptr)
@@ -2417,6 +2940,9 @@ WallElement* map_get_wall_element_at(const CoordsXYRangedZ& coords)
 
 WallElement* map_get_wall_element_at(const CoordsXYZD& wallCoords)
 {
+    if (!map_tile_may_contain(wallCoords, TILE_ELEMENT_TYPE_WALL))
+        return nullptr;
+
     auto tileWallCoords = TileCoordsXYZ(wallCoords);
     TileElement* tileElement = map_get_first_element_at(wallCoords);
     if (tileElement == nullptr)
@@ -13,7 +13,9 @@
 #include "../common.h"
 #include "Location.hpp"
 #include "TileElement.h"
+#include "TileElementStore.h"
 
+#include <functional>
 #include <initializer_list>
 #include <vector>
 
@@ -33,7 +35,8 @@ constexpr const int32_t MINIMUM_LAND_HEIGHT_BIG = MINIMUM_LAND_HEIGHT * COORDS_Z
 
 #define MAP_MINIMUM_X_Y (-MAXIMUM_MAP_SIZE_TECHNICAL)
 
-constexpr const uint32_t MAX_TILE_ELEMENTS_WITH_SPARE_ROOM = 0x30000;
+// Parks with more elements than RCT2_MAX_TILE_ELEMENTS store the rest in an OpenRCT2 chunk of the S6 file
+constexpr const uint32_t MAX_TILE_ELEMENTS_WITH_SPARE_ROOM = 0x100000;
 constexpr const uint32_t MAX_TILE_ELEMENTS = MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - 512;
 #define MAX_TILE_TILE_ELEMENT_POINTERS (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL)
 #define MAX_PEEP_SPAWNS 2
@@ -117,7 +120,8 @@ extern uint8_t gMapSelectArrowDirection;
 
 extern uint8_t gMapGroundFlags;
 
-extern TileElement gTileElements[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
+// Grows on demand up to MAX_TILE_ELEMENTS_WITH_SPARE_ROOM without moving the elements
+extern TileElementStore gTileElements;
 extern TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
 
 extern std::vector<CoordsXY> gMapSelectionTiles;
@@ -147,11 +151,39 @@ extern const uint8_t tile_element_raise_styles[9][32];
 void map_init(int32_t size);
 
 void map_count_remaining_land_rights();
+/**
+ * Counts the surface elements that are owned by the park or where it owns the construction rights, over the whole
+ * technical map area.
+ */
+int32_t map_count_park_tiles();
+/**
+ * Marks the ownership of the tiles as changed, called whenever the ownership of a surface element changes.
+ */
+void map_invalidate_tile_ownership();
 void map_strip_ghost_flag_from_elements();
 void map_update_tile_pointers();
 TileElement* map_get_first_element_at(const CoordsXY& elementPos);
 TileElement* map_get_nth_element_at(const CoordsXY& coords, int32_t n);
 void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements);
+/**
+ * Returns a number that changes whenever tile elements may have moved in memory, pointers to tile elements that are
+ * kept for longer are only valid while it stays the same.
+ */
+uint32_t map_get_tile_element_generation();
+/**
+ * Returns false if the tile at loc definitely has no element of the given type. The answer comes from a per-tile
+ * summary of element types that is rebuilt lazily, so lookups skip tiles without scanning their elements.
+ */
+bool map_tile_may_contain(const CoordsXY& loc, uint8_t tileElementType);
+/**
+ * Drops the element type summaries of all tiles, called whenever the type of an element, the style of a surface or
+ * the addition of a footpath changes.
+ */
+void map_invalidate_tile_element_summaries();
+/**
+ * Drops the element type summary of one tile, must be called after writing whole elements of that tile directly.
+ */
+void map_invalidate_tile_element_summary(const CoordsXY& loc);
 int32_t map_height_from_slope(const CoordsXY& coords, int32_t slopeDirection, bool isSloped);
 BannerElement* map_get_banner_element_at(const CoordsXYZ& bannerPos, uint8_t direction);
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords);
@@ -183,6 +215,16 @@ void map_invalidate_map_selection_tiles();
 void map_invalidate_selection_rect();
 void map_reorganise_elements();
 bool map_check_free_elements_and_reorganise(int32_t num_elements);
+/**
+ * Forgets the slack and released blocks of the tile element store, must be called whenever gTileElements or the tile
+ * pointers are rewritten directly.
+ */
+void map_reset_tile_element_blocks();
+/**
+ * Replaces the tile element store with an empty one that has room for at least numElements elements, the tile pointers
+ * have to be rebuilt afterwards.
+ */
+void map_reset_tile_element_store(size_t numElements);
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants);
 
 namespace GameActions
@@ -217,6 +259,64 @@ void tile_element_iterator_begin(tile_element_iterator* it);
 int32_t tile_element_iterator_next(tile_element_iterator* it);
 void tile_element_iterator_restart_for_tile(tile_element_iterator* it);
 
+/**
+ * All elements of one tile, which are stored next to each other.
+ */
+struct TileElementSpan
+{
+    TileCoordsXY Tile;
+    TileElement* Elements;
+    size_t Count;
+
+    TileElement* begin() const
+    {
+        return Elements;
+    }
+    TileElement* end() const
+    {
+        return Elements + Count;
+    }
+};
+
+/**
+ * Calls fn(const TileElementSpan&) for every tile with elements in the tile rows [firstRow, endRow), row by row.
+ * Elements may be changed in place but fn must not insert or remove any.
+ */
+template<typename TFn> void map_for_each_tile_in_rows(int32_t firstRow, int32_t endRow, TFn&& fn)
+{
+    for (int32_t y = firstRow; y < endRow; y++)
+    {
+        TileElement** tilePointers = &gTileElementTilePointers[y * MAXIMUM_MAP_SIZE_TECHNICAL];
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            TileElement* first = tilePointers[x];
+            if (first == nullptr)
+                continue;
+
+            size_t count = 1;
+            while (!first[count - 1].IsLastForTile())
+            {
+                count++;
+            }
+            fn(TileElementSpan{ { x, y }, first, count });
+        }
+    }
+}
+
+/**
+ * Calls fn(const TileElementSpan&) for every tile of the technical map area that has elements.
+ */
+template<typename TFn> void map_for_each_tile(TFn&& fn)
+{
+    map_for_each_tile_in_rows(0, MAXIMUM_MAP_SIZE_TECHNICAL, std::forward<TFn>(fn));
+}
+
+/**
+ * Like map_for_each_tile but the rows are spread across the job pool, so in no particular order. fn may only touch
+ * the elements of the span it is given, which keeps the result the same as doing it on one thread.
+ */
+void map_for_each_tile_parallel(const std::function<void(const TileElementSpan&)>& fn);
+
 void map_update_tiles();
 int32_t map_get_highest_z(const CoordsXY& loc);
 
@@ -236,6 +336,16 @@ void map_invalidate_tile_zoom0(const CoordsXYRangedZ& tilePos);
 void map_invalidate_tile_full(const CoordsXY& tilePos);
 void map_invalidate_element(const CoordsXY& elementPos, TileElement* tileElement);
 void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs);
+/**
+ * Starts or stops recording which tiles are invalidated, so that views of the whole map such as the minimap can
+ * repaint only the tiles that have changed.
+ */
+void map_change_journal_set_enabled(bool enabled);
+/**
+ * Moves the tiles invalidated since the last call into the given list. Returns false if too many tiles changed to be
+ * recorded, in which case every tile should be treated as changed.
+ */
+bool map_change_journal_take(std::vector<TileCoordsXY>& tiles);
 
 int32_t map_get_tile_side(const CoordsXY& mapPos);
 int32_t map_get_tile_quadrant(const CoordsXY& mapPos);
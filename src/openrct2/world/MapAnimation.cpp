@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../Game.h"
+#include "../OpenRCT2.h"
 #include "../interface/Viewport.h"
 #include "../object/StationObject.h"
 #include "../ride/Ride.h"
@@ -25,19 +26,66 @@
 #include "SmallScenery.h"
 #include "Sprite.h"
 
-using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
+#include <algorithm>
+#include <limits>
 
-static std::vector<MapAnimation> _mapAnimations;
+struct MapAnimationEntry
+{
+    MapAnimation Animation;
+    // Element the animation was last found at, only used while the tile elements have not moved since
+    TileElement* Element;
+    uint32_t ElementGeneration;
+};
+
+using map_animation_invalidate_event_handler = bool (*)(MapAnimationEntry& entry);
+
+// Animations that change the game state rather than only redraw, these are updated every tick in the order they were
+// created so that the game plays the same whether or not they are in view
+static std::vector<MapAnimationEntry> _stateMapAnimations;
+
+// Other animations are kept per region of 8 by 8 tiles, only regions in view of a viewport are updated
+constexpr int32_t MapAnimationRegionShift = 3;
+constexpr int32_t MapAnimationRegionsPerSide = MAXIMUM_MAP_SIZE_TECHNICAL >> MapAnimationRegionShift;
+constexpr int32_t MapAnimationRegionCount = MapAnimationRegionsPerSide * MapAnimationRegionsPerSide;
+constexpr int32_t MapAnimationRegionSize = COORDS_XY_STEP << MapAnimationRegionShift;
+
+// How far above its base an animation may redraw
+constexpr int32_t MapAnimationMaxHeight = 256;
+
+struct MapAnimationRegion
+{
+    std::vector<MapAnimationEntry> Animations;
+    int32_t MinZ;
+    int32_t MaxZ;
+};
+
+static MapAnimationRegion _mapAnimationRegions[MapAnimationRegionCount];
+static size_t _regionMapAnimationCount;
+// Region updated this tick whether or not it is in view, so that animations of removed elements are dropped
+static int32_t _mapAnimationSweepRegion;
 
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
-static bool InvalidateMapAnimation(const MapAnimation& obj);
+static bool InvalidateMapAnimation(MapAnimationEntry& entry);
 
-static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
+static bool IsStateMapAnimation(int32_t type)
 {
-    for (const auto& a : _mapAnimations)
+    return type == MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO || type == MAP_ANIMATION_TYPE_WALL_DOOR
+        || type == MAP_ANIMATION_TYPE_REMOVE;
+}
+
+static int32_t GetMapAnimationRegion(const CoordsXY& loc)
+{
+    auto x = std::clamp(loc.x / MapAnimationRegionSize, 0, MapAnimationRegionsPerSide - 1);
+    auto y = std::clamp(loc.y / MapAnimationRegionSize, 0, MapAnimationRegionsPerSide - 1);
+    return y * MapAnimationRegionsPerSide + x;
+}
+
+static bool DoesAnimationExist(const std::vector<MapAnimationEntry>& animations, int32_t type, const CoordsXYZ& location)
+{
+    for (const auto& a : animations)
     {
-        if (a.type == type && a.location == location)
+        if (a.Animation.type == type && a.Animation.location == location)
         {
             // Animation already exists
             return true;
@@ -48,33 +96,87 @@ static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc)
 {
-    if (!DoesAnimationExist(type, loc))
+    MapAnimationEntry entry{ { static_cast<uint8_t>(type), loc }, nullptr, 0 };
+    if (IsStateMapAnimation(type))
     {
-        if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
+        if (DoesAnimationExist(_stateMapAnimations, type, loc))
+            return;
+        if (_stateMapAnimations.size() < MAX_ANIMATED_OBJECTS)
         {
-            // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
+            _stateMapAnimations.push_back(entry);
+            return;
         }
-        else
+    }
+    else
+    {
+        auto& region = _mapAnimationRegions[GetMapAnimationRegion(loc)];
+        if (DoesAnimationExist(region.Animations, type, loc))
+            return;
+        if (_regionMapAnimationCount < MAX_ANIMATED_OBJECTS)
         {
-            log_error("Exceeded the maximum number of animations");
+            region.MinZ = region.Animations.empty() ? loc.z : std::min(region.MinZ, loc.z);
+            region.MaxZ = region.Animations.empty() ? loc.z : std::max(region.MaxZ, loc.z);
+            region.Animations.push_back(entry);
+            _regionMapAnimationCount++;
+            return;
         }
     }
+    log_error("Exceeded the maximum number of animations");
 }
 
 /**
- *
- *  rct2: 0x0068AFAD
+ * Whether any viewport that animations are drawn in, those zoomed in to at least 1, can see part of the region.
  */
-void map_animation_invalidate_all()
+static bool IsMapAnimationRegionVisible(int32_t regionIndex)
+{
+    const auto& region = _mapAnimationRegions[regionIndex];
+    const int32_t left = (regionIndex % MapAnimationRegionsPerSide) * MapAnimationRegionSize;
+    const int32_t top = (regionIndex / MapAnimationRegionsPerSide) * MapAnimationRegionSize;
+    const auto rotation = get_current_rotation();
+
+    // Bounds of the region on screen, from the corners at the lowest and highest height an animation can redraw
+    int32_t screenLeft = std::numeric_limits<int32_t>::max();
+    int32_t screenTop = std::numeric_limits<int32_t>::max();
+    int32_t screenRight = std::numeric_limits<int32_t>::min();
+    int32_t screenBottom = std::numeric_limits<int32_t>::min();
+    for (int32_t corner = 0; corner < 8; corner++)
+    {
+        CoordsXYZ pos = { left + ((corner & 1) ? MapAnimationRegionSize : 0),
+                          top + ((corner & 2) ? MapAnimationRegionSize : 0),
+                          (corner & 4) ? region.MaxZ + MapAnimationMaxHeight : region.MinZ };
+        auto screenPos = translate_3d_to_2d_with_z(rotation, pos);
+        screenLeft = std::min(screenLeft, screenPos.x - 32);
+        screenTop = std::min(screenTop, screenPos.y - 32);
+        screenRight = std::max(screenRight, screenPos.x + 32);
+        screenBottom = std::max(screenBottom, screenPos.y + 32);
+    }
+
+    for (const auto& viewport : g_viewport_list)
+    {
+        if (viewport.width == 0 || viewport.zoom > 1)
+            continue;
+        if (screenRight > viewport.viewPos.x && screenLeft < viewport.viewPos.x + viewport.view_width
+            && screenBottom > viewport.viewPos.y && screenTop < viewport.viewPos.y + viewport.view_height)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void InvalidateMapAnimations(std::vector<MapAnimationEntry>& animations, bool smallSceneryOnly)
 {
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    auto it = animations.begin();
+    while (it != animations.end())
     {
-        if (InvalidateMapAnimation(*it))
+        if (smallSceneryOnly && it->Animation.type != MAP_ANIMATION_TYPE_SMALL_SCENERY)
+        {
+            it++;
+        }
+        else if (InvalidateMapAnimation(*it))
         {
             // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
+            it = animations.erase(it);
         }
         else
         {
@@ -85,264 +187,241 @@ void map_animation_invalidate_all()
 
 /**
  *
- *  rct2: 0x00666670
+ *  rct2: 0x0068AFAD
  */
-static bool map_animation_invalidate_ride_entrance(const CoordsXYZ& loc)
+void map_animation_invalidate_all()
 {
-    TileCoordsXYZ tileLoc{ loc };
-    auto tileElement = map_get_first_element_at(loc);
-    if (tileElement == nullptr)
-        return true;
-    do
+    InvalidateMapAnimations(_stateMapAnimations, false);
+
+    // Clocks send peeps looking at them on these ticks, so all small scenery is updated whether it is in view or not
+    const bool isClockTick = !(gCurrentTicks & 0x3FF) && game_is_not_paused();
+    const bool hasViewports = !gOpenRCT2Headless;
+    _mapAnimationSweepRegion = (_mapAnimationSweepRegion + 1) % MapAnimationRegionCount;
+    for (int32_t i = 0; i < MapAnimationRegionCount; i++)
     {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_ENTRANCE)
-            continue;
-        if (tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_RIDE_ENTRANCE)
+        auto& region = _mapAnimationRegions[i];
+        if (region.Animations.empty())
             continue;
 
-        auto ride = get_ride(tileElement->AsEntrance()->GetRideIndex());
-        if (ride != nullptr)
+        auto countBefore = region.Animations.size();
+        if (i == _mapAnimationSweepRegion || (hasViewports && IsMapAnimationRegionVisible(i)))
         {
-            auto stationObj = ride_get_station_object(ride);
-            if (stationObj != nullptr)
-            {
-                int32_t height = loc.z + stationObj->Height + 8;
-                map_invalidate_tile_zoom1({ loc, height, height + 16 });
-            }
+            InvalidateMapAnimations(region.Animations, false);
         }
-        return false;
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+        else if (isClockTick)
+        {
+            InvalidateMapAnimations(region.Animations, true);
+        }
+        _regionMapAnimationCount -= countBefore - region.Animations.size();
+    }
 }
 
 /**
- *
- *  rct2: 0x006A7BD4
+ * Returns the element of the animation, the first element at its height matching the predicate. The element found
+ * last time is used directly as long as no tile elements have moved since and it still matches.
  */
-static bool map_animation_invalidate_queue_banner(const CoordsXYZ& loc)
+template<typename TPredicate> static TileElement* FindAnimationElement(MapAnimationEntry& entry, TPredicate predicate)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
+    const auto& loc = entry.Animation.location;
+    const auto baseHeight = loc.z / COORDS_Z_STEP;
+    const auto generation = map_get_tile_element_generation();
+    if (entry.Element != nullptr && entry.ElementGeneration == generation && entry.Element->base_height == baseHeight
+        && predicate(*entry.Element))
+    {
+        return entry.Element;
+    }
 
-    tileElement = map_get_first_element_at(loc);
+    entry.Element = nullptr;
+    auto tileElement = map_get_first_element_at(loc);
     if (tileElement == nullptr)
-        return true;
+        return nullptr;
     do
     {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
-            continue;
-        if (!(tileElement->AsPath()->IsQueue()))
-            continue;
-        if (!tileElement->AsPath()->HasQueueBanner())
-            continue;
-
-        int32_t direction = (tileElement->AsPath()->GetQueueBannerDirection() + get_current_rotation()) & 3;
-        if (direction == TILE_ELEMENT_DIRECTION_NORTH || direction == TILE_ELEMENT_DIRECTION_EAST)
+        if (tileElement->base_height == baseHeight && predicate(*tileElement))
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 16, loc.z + 30 });
+            entry.Element = tileElement;
+            entry.ElementGeneration = generation;
+            return tileElement;
         }
-        return false;
     } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    return nullptr;
 }
 
 /**
  *
- *  rct2: 0x006E32C9
+ *  rct2: 0x00666670
  */
-static bool map_animation_invalidate_small_scenery(const CoordsXYZ& loc)
+static bool map_animation_invalidate_ride_entrance(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-
-    auto tileElement = map_get_first_element_at(loc);
+    auto tileElement = FindAnimationElement(entry, [](const TileElement& element) {
+        return element.GetType() == TILE_ELEMENT_TYPE_ENTRANCE
+            && element.AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_RIDE_ENTRANCE;
+    });
     if (tileElement == nullptr)
         return true;
-    do
+
+    const auto& loc = entry.Animation.location;
+    auto ride = get_ride(tileElement->AsEntrance()->GetRideIndex());
+    if (ride != nullptr)
     {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_SMALL_SCENERY)
-            continue;
-        if (tileElement->IsGhost())
-            continue;
+        auto stationObj = ride_get_station_object(ride);
+        if (stationObj != nullptr)
+        {
+            int32_t height = loc.z + stationObj->Height + 8;
+            map_invalidate_tile_zoom1({ loc, height, height + 16 });
+        }
+    }
+    return false;
+}
 
-        auto sceneryEntry = tileElement->AsSmallScenery()->GetEntry();
-        if (sceneryEntry == nullptr)
-            continue;
+/**
+ *
+ *  rct2: 0x006A7BD4
+ */
+static bool map_animation_invalidate_queue_banner(MapAnimationEntry& entry)
+{
+    auto tileElement = FindAnimationElement(entry, [](const TileElement& element) {
+        return element.GetType() == TILE_ELEMENT_TYPE_PATH && element.AsPath()->IsQueue()
+            && element.AsPath()->HasQueueBanner();
+    });
+    if (tileElement == nullptr)
+        return true;
 
-        if (scenery_small_entry_has_flag(
-                sceneryEntry,
-                SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
-                    | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
-        {
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+    const auto& loc = entry.Animation.location;
+    int32_t direction = (tileElement->AsPath()->GetQueueBannerDirection() + get_current_rotation()) & 3;
+    if (direction == TILE_ELEMENT_DIRECTION_NORTH || direction == TILE_ELEMENT_DIRECTION_EAST)
+    {
+        map_invalidate_tile_zoom1({ loc, loc.z + 16, loc.z + 30 });
+    }
+    return false;
+}
+
+/**
+ *
+ *  rct2: 0x006E32C9
+ */
+static bool map_animation_invalidate_small_scenery(MapAnimationEntry& entry)
+{
+    auto tileElement = FindAnimationElement(entry, [](const TileElement& element) {
+        if (element.GetType() != TILE_ELEMENT_TYPE_SMALL_SCENERY || element.IsGhost())
             return false;
-        }
+        auto sceneryEntry = element.AsSmallScenery()->GetEntry();
+        return sceneryEntry != nullptr
+            && scenery_small_entry_has_flag(
+                   sceneryEntry,
+                   SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
+                       | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS | SMALL_SCENERY_FLAG_IS_CLOCK);
+    });
+    if (tileElement == nullptr)
+        return true;
 
-        if (scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_IS_CLOCK))
+    const auto& loc = entry.Animation.location;
+    auto sceneryEntry = tileElement->AsSmallScenery()->GetEntry();
+    if (!scenery_small_entry_has_flag(
+            sceneryEntry,
+            SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
+                | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
+    {
+        // Peep, looking at scenery
+        if (!(gCurrentTicks & 0x3FF) && game_is_not_paused())
         {
-            // Peep, looking at scenery
-            if (!(gCurrentTicks & 0x3FF) && game_is_not_paused())
+            int32_t direction = tileElement->GetDirection();
+            auto quad = EntityTileList<Peep>(CoordsXY{ loc } - CoordsDirectionDelta[direction]);
+            for (auto peep : quad)
             {
-                int32_t direction = tileElement->GetDirection();
-                auto quad = EntityTileList<Peep>(CoordsXY{ loc } - CoordsDirectionDelta[direction]);
-                for (auto peep : quad)
-                {
-                    if (peep->State != PeepState::Walking)
-                        continue;
-                    if (peep->z != loc.z)
-                        continue;
-                    if (peep->Action < PeepActionType::None1)
-                        continue;
-
-                    peep->Action = PeepActionType::CheckTime;
-                    peep->ActionFrame = 0;
-                    peep->ActionSpriteImageOffset = 0;
-                    peep->UpdateCurrentActionSpriteType();
-                    peep->Invalidate1();
-                    break;
-                }
+                if (peep->State != PeepState::Walking)
+                    continue;
+                if (peep->z != loc.z)
+                    continue;
+                if (peep->Action < PeepActionType::None1)
+                    continue;
+
+                peep->Action = PeepActionType::CheckTime;
+                peep->ActionFrame = 0;
+                peep->ActionSpriteImageOffset = 0;
+                peep->UpdateCurrentActionSpriteType();
+                peep->Invalidate1();
+                break;
             }
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
-            return false;
         }
-
-    } while (!(tileElement++)->IsLastForTile());
-    return true;
+    }
+    map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x00666C63
  */
-static bool map_animation_invalidate_park_entrance(const CoordsXYZ& loc)
+static bool map_animation_invalidate_park_entrance(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = map_get_first_element_at(loc);
+    auto tileElement = FindAnimationElement(entry, [](const TileElement& element) {
+        return element.GetType() == TILE_ELEMENT_TYPE_ENTRANCE
+            && element.AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE
+            && element.AsEntrance()->GetSequenceIndex() == 0;
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_ENTRANCE)
-            continue;
-        if (tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE)
-            continue;
-        if (tileElement->AsEntrance()->GetSequenceIndex())
-            continue;
 
-        map_invalidate_tile_zoom1({ loc, loc.z + 32, loc.z + 64 });
-        return false;
-    } while (!(tileElement++)->IsLastForTile());
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z + 32, loc.z + 64 });
+    return false;
+}
 
-    return true;
+template<track_type_t TTrackType> static bool IsTrackOfType(const TileElement& element)
+{
+    return element.GetType() == TILE_ELEMENT_TYPE_TRACK && element.AsTrack()->GetTrackType() == TTrackType;
 }
 
 /**
  *
  *  rct2: 0x006CE29E
  */
-static bool map_animation_invalidate_track_waterfall(const CoordsXYZ& loc)
+static bool map_animation_invalidate_track_waterfall(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = map_get_first_element_at(loc);
-    if (tileElement == nullptr)
+    if (FindAnimationElement(entry, IsTrackOfType<TrackElemType::Waterfall>) == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
 
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Waterfall)
-        {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 46 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 46 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006CE2F3
  */
-static bool map_animation_invalidate_track_rapids(const CoordsXYZ& loc)
+static bool map_animation_invalidate_track_rapids(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = map_get_first_element_at(loc);
-    if (tileElement == nullptr)
+    if (FindAnimationElement(entry, IsTrackOfType<TrackElemType::Rapids>) == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Rapids)
-        {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
 
-    return true;
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006CE39D
  */
-static bool map_animation_invalidate_track_onridephoto(const CoordsXYZ& loc)
+static bool map_animation_invalidate_track_onridephoto(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = map_get_first_element_at(loc);
+    auto tileElement = FindAnimationElement(entry, IsTrackOfType<TrackElemType::OnRidePhoto>);
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
-
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::OnRidePhoto)
-        {
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
-            if (game_is_paused())
-            {
-                return false;
-            }
-            if (tileElement->AsTrack()->IsTakingPhoto())
-            {
-                tileElement->AsTrack()->DecrementPhotoTimeout();
-                return false;
-            }
-            else
-            {
-                return true;
-            }
-        }
-    } while (!(tileElement++)->IsLastForTile());
 
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+    if (game_is_paused())
+    {
+        return false;
+    }
+    if (tileElement->AsTrack()->IsTakingPhoto())
+    {
+        tileElement->AsTrack()->DecrementPhotoTimeout();
+        return false;
+    }
     return true;
 }
 
@@ -350,65 +429,35 @@ static bool map_animation_invalidate_track_onridephoto(const CoordsXYZ& loc)
  *
  *  rct2: 0x006CE348
  */
-static bool map_animation_invalidate_track_whirlpool(const CoordsXYZ& loc)
+static bool map_animation_invalidate_track_whirlpool(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = map_get_first_element_at(loc);
-    if (tileElement == nullptr)
+    if (FindAnimationElement(entry, IsTrackOfType<TrackElemType::Whirlpool>) == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
 
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Whirlpool)
-        {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006CE3FA
  */
-static bool map_animation_invalidate_track_spinningtunnel(const CoordsXYZ& loc)
+static bool map_animation_invalidate_track_spinningtunnel(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = map_get_first_element_at(loc);
-    if (tileElement == nullptr)
+    if (FindAnimationElement(entry, IsTrackOfType<TrackElemType::SpinningTunnel>) == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-            continue;
 
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::SpinningTunnel)
-        {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 32 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 32 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x0068DF8F
  */
-static bool map_animation_invalidate_remove([[maybe_unused]] const CoordsXYZ& loc)
+static bool map_animation_invalidate_remove([[maybe_unused]] MapAnimationEntry& entry)
 {
     return true;
 }
@@ -417,65 +466,47 @@ static bool map_animation_invalidate_remove([[maybe_unused]] const CoordsXYZ& lo
  *
  *  rct2: 0x006BA2BB
  */
-static bool map_animation_invalidate_banner(const CoordsXYZ& loc)
+static bool map_animation_invalidate_banner(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = map_get_first_element_at(loc);
+    auto tileElement = FindAnimationElement(
+        entry, [](const TileElement& element) { return element.GetType() == TILE_ELEMENT_TYPE_BANNER; });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_BANNER)
-            continue;
-        map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
-        return false;
-    } while (!(tileElement++)->IsLastForTile());
 
-    return true;
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006B94EB
  */
-static bool map_animation_invalidate_large_scenery(const CoordsXYZ& loc)
+static bool map_animation_invalidate_large_scenery(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-    rct_scenery_entry* sceneryEntry;
-
-    bool wasInvalidated = false;
-    tileElement = map_get_first_element_at(loc);
+    // Every animated piece at the height invalidates the same area, so finding one is enough
+    auto tileElement = FindAnimationElement(entry, [](const TileElement& element) {
+        if (element.GetType() != TILE_ELEMENT_TYPE_LARGE_SCENERY)
+            return false;
+        auto sceneryEntry = element.AsLargeScenery()->GetEntry();
+        return sceneryEntry != nullptr && (sceneryEntry->large_scenery.flags & LARGE_SCENERY_FLAG_ANIMATED);
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_LARGE_SCENERY)
-            continue;
 
-        sceneryEntry = tileElement->AsLargeScenery()->GetEntry();
-        if (sceneryEntry->large_scenery.flags & LARGE_SCENERY_FLAG_ANIMATED)
-        {
-            map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
-            wasInvalidated = true;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    return !wasInvalidated;
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006E5B50
  */
-static bool map_animation_invalidate_wall_door(const CoordsXYZ& loc)
+static bool map_animation_invalidate_wall_door(MapAnimationEntry& entry)
 {
+    // All doors at the height are animated, so these are always looked up on the tile
+    const auto& loc = entry.Animation.location;
     TileCoordsXYZ tileLoc{ loc };
     TileElement* tileElement;
     rct_scenery_entry* sceneryEntry;
@@ -539,35 +570,23 @@ static bool map_animation_invalidate_wall_door(const CoordsXYZ& loc)
  *
  *  rct2: 0x006E5EE4
  */
-static bool map_animation_invalidate_wall(const CoordsXYZ& loc)
+static bool map_animation_invalidate_wall(MapAnimationEntry& entry)
 {
-    TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-    rct_scenery_entry* sceneryEntry;
-
-    bool wasInvalidated = false;
-    tileElement = map_get_first_element_at(loc);
+    // Every animated wall at the height invalidates the same area, so finding one is enough
+    auto tileElement = FindAnimationElement(entry, [](const TileElement& element) {
+        if (element.GetType() != TILE_ELEMENT_TYPE_WALL)
+            return false;
+        auto sceneryEntry = element.AsWall()->GetEntry();
+        return sceneryEntry != nullptr
+            && ((sceneryEntry->wall.flags2 & WALL_SCENERY_2_ANIMATED)
+                || sceneryEntry->wall.scrolling_mode != SCROLLING_MODE_NONE);
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->base_height != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TILE_ELEMENT_TYPE_WALL)
-            continue;
-
-        sceneryEntry = tileElement->AsWall()->GetEntry();
-
-        if (!sceneryEntry
-            || (!(sceneryEntry->wall.flags2 & WALL_SCENERY_2_ANIMATED)
-                && sceneryEntry->wall.scrolling_mode == SCROLLING_MODE_NONE))
-            continue;
-
-        map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
-        wasInvalidated = true;
-    } while (!(tileElement++)->IsLastForTile());
 
-    return !wasInvalidated;
+    const auto& loc = entry.Animation.location;
+    map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+    return false;
 }
 
 /**
@@ -594,23 +613,40 @@ static constexpr const map_animation_invalidate_event_handler _animatedObjectEve
 /**
  * @returns true if the animation should be removed.
  */
-static bool InvalidateMapAnimation(const MapAnimation& a)
+static bool InvalidateMapAnimation(MapAnimationEntry& entry)
 {
-    if (a.type < std::size(_animatedObjectEventHandlers))
+    if (entry.Animation.type < std::size(_animatedObjectEventHandlers))
     {
-        return _animatedObjectEventHandlers[a.type](a.location);
+        return _animatedObjectEventHandlers[entry.Animation.type](entry);
     }
     return true;
 }
 
-const std::vector<MapAnimation>& GetMapAnimations()
+std::vector<MapAnimation> GetMapAnimations()
 {
-    return _mapAnimations;
+    std::vector<MapAnimation> result;
+    for (const auto& entry : _stateMapAnimations)
+    {
+        result.push_back(entry.Animation);
+    }
+    for (const auto& region : _mapAnimationRegions)
+    {
+        for (const auto& entry : region.Animations)
+        {
+            result.push_back(entry.Animation);
+        }
+    }
+    return result;
 }
 
 static void ClearMapAnimations()
 {
-    _mapAnimations.clear();
+    _stateMapAnimations.clear();
+    for (auto& region : _mapAnimationRegions)
+    {
+        region.Animations.clear();
+    }
+    _regionMapAnimationCount = 0;
 }
 
 void AutoCreateMapAnimations()
@@ -41,5 +41,5 @@ enum
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc);
 void map_animation_invalidate_all();
-const std::vector<MapAnimation>& GetMapAnimations();
+std::vector<MapAnimation> GetMapAnimations();
 void AutoCreateMapAnimations();
@@ -14,6 +14,7 @@
 #include "../common.h"
 #include "../core/Guard.hpp"
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/String.hpp"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -411,29 +412,30 @@ static void mapgen_set_water_level(int32_t waterLevel)
  */
 static void mapgen_smooth_height(int32_t iterations)
 {
-    int32_t i, x, y, xx, yy, avg;
     int32_t arraySize = _heightSize * _heightSize * sizeof(uint8_t);
     uint8_t* copyHeight = new uint8_t[arraySize];
 
-    for (i = 0; i < iterations; i++)
+    for (int32_t i = 0; i < iterations; i++)
     {
         std::memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize - 1; y++)
-        {
-            for (x = 1; x < _heightSize - 1; x++)
+
+        // Every row only reads the copy, so rows can be smoothed in parallel. The 3x3 sum is made from sums of three
+        // vertically adjacent heights so that each of them is only added up once per row.
+        JobPool::ParallelFor(std::max(0, _heightSize - 2), [copyHeight](size_t row) {
+            int32_t y = static_cast<int32_t>(row) + 1;
+            std::vector<int32_t> columnSums(_heightSize);
+            const uint8_t* above = &copyHeight[(y - 1) * _heightSize];
+            const uint8_t* centre = &copyHeight[y * _heightSize];
+            const uint8_t* below = &copyHeight[(y + 1) * _heightSize];
+            for (int32_t x = 0; x < _heightSize; x++)
             {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
-                {
-                    for (xx = -1; xx <= 1; xx++)
-                    {
-                        avg += copyHeight[(y + yy) * _heightSize + (x + xx)];
-                    }
-                }
-                avg /= 9;
-                set_height(x, y, avg);
+                columnSums[x] = above[x] + centre[x] + below[x];
             }
-        }
+            for (int32_t x = 1; x < _heightSize - 1; x++)
+            {
+                _height[x + y * _heightSize] = (columnSums[x - 1] + columnSums[x] + columnSums[x + 1]) / 9;
+            }
+        });
     }
 
     delete[] copyHeight;
@@ -620,25 +622,24 @@ static float grad(int32_t hash, float x, float y)
 
 static void mapgen_simplex(mapgen_settings* settings)
 {
-    int32_t x, y;
-
     float freq = settings->simplex_base_freq * (1.0f / _heightSize);
     int32_t octaves = settings->simplex_octaves;
 
     int32_t low = settings->simplex_low;
     int32_t high = settings->simplex_high;
 
+    // The permutation table is only read once it has been filled, so rows can be generated in parallel
     noise_rand();
-    for (y = 0; y < _heightSize; y++)
-    {
-        for (x = 0; x < _heightSize; x++)
+    JobPool::ParallelFor(_heightSize, [=](size_t row) {
+        int32_t y = static_cast<int32_t>(row);
+        for (int32_t x = 0; x < _heightSize; x++)
         {
             float noiseValue = std::clamp(fractal_noise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
             float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
             set_height(x, y, low + static_cast<int32_t>(normalisedNoiseValue * high));
         }
-    }
+    });
 }
 
 #pragma endregion
@@ -728,41 +729,40 @@ static void mapgen_smooth_heightmap(uint8_t* src, int32_t strength)
     // Create buffer to store one channel
     uint8_t* dest = new uint8_t[_heightMapData.width * _heightMapData.height];
 
+    const int32_t width = static_cast<int32_t>(_heightMapData.width);
+    const int32_t height = static_cast<int32_t>(_heightMapData.height);
     for (int32_t i = 0; i < strength; i++)
     {
-        // Calculate box blur value to all pixels of the surface
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
-            for (uint32_t x = 0; x < _heightMapData.width; x++)
+        // Calculate box blur value to all pixels of the surface, each row only reads the source so rows are blurred in
+        // parallel
+        JobPool::ParallelFor(height, [src, dest, width, height](size_t row) {
+            const int32_t y = static_cast<int32_t>(row);
+
+            // Clamp y so it stays within the image
+            // This assumes the height map is not tiled, and increases the weight of the edges
+            const uint8_t* above = &src[std::max(y - 1, 0) * width];
+            const uint8_t* centre = &src[y * width];
+            const uint8_t* below = &src[std::min(y + 1, height - 1) * width];
+
+            // Sum the neighbour pixels in each column once, all of them have the same weight
+            std::vector<uint32_t> columnSums(width);
+            for (int32_t x = 0; x < width; x++)
             {
-                uint32_t heightSum = 0;
+                columnSums[x] = above[x] + centre[x] + below[x];
+            }
 
-                // Loop over neighbour pixels, all of them have the same weight
-                for (int8_t offsetX = -1; offsetX <= 1; offsetX++)
-                {
-                    for (int8_t offsetY = -1; offsetY <= 1; offsetY++)
-                    {
-                        // Clamp x and y so they stay within the image
-                        // This assumes the height map is not tiled, and increases the weight of the edges
-                        const int32_t readX = std::clamp<int32_t>(x + offsetX, 0, _heightMapData.width - 1);
-                        const int32_t readY = std::clamp<int32_t>(y + offsetY, 0, _heightMapData.height - 1);
-                        heightSum += src[readX + readY * _heightMapData.width];
-                    }
-                }
+            for (int32_t x = 0; x < width; x++)
+            {
+                // Clamp x the same way as y
+                uint32_t heightSum = columnSums[std::max(x - 1, 0)] + columnSums[x] + columnSums[std::min(x + 1, width - 1)];
 
                 // Take average
-                dest[x + y * _heightMapData.width] = heightSum / 9;
+                dest[x + y * width] = heightSum / 9;
             }
-        }
+        });
 
         // Now apply the blur to the source pixels
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
-            for (uint32_t x = 0; x < _heightMapData.width; x++)
-            {
-                src[x + y * _heightMapData.width] = dest[x + y * _heightMapData.width];
-            }
-        }
+        std::memcpy(src, dest, _heightMapData.width * _heightMapData.height);
     }
 
     delete[] dest;
@@ -312,11 +312,12 @@ void Park::Update(const Date& date)
     // Every ~13 seconds
     if (gCurrentTicks % 512 == 0)
     {
-        gParkRating = CalculateParkRating();
-        gParkValue = CalculateParkValue();
+        auto stats = CalculateStatistics();
+        gParkRating = CalculateParkRating(stats);
+        gParkValue = CalculateParkValue(stats.TotalRideValue);
         gCompanyValue = CalculateCompanyValue();
-        gTotalRideValueForMoney = CalculateTotalRideValueForMoney();
-        _suggestedGuestMaximum = CalculateSuggestedMaxGuests();
+        gTotalRideValueForMoney = stats.TotalRideValueForMoney;
+        _suggestedGuestMaximum = CalculateSuggestedMaxGuests(stats);
         _guestGenerationProbability = CalculateGuestGenerationProbability();
 
         window_invalidate_by_class(WC_FINANCES);
@@ -339,32 +340,108 @@ void Park::Update(const Date& date)
 
 int32_t Park::CalculateParkSize() const
 {
-    int32_t tiles;
-    tile_element_iterator it;
+    int32_t tiles = map_count_park_tiles();
 
-    tiles = 0;
-    tile_element_iterator_begin(&it);
-    do
+    if (tiles != gParkSize)
     {
-        if (it.element->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        gParkSize = tiles;
+        window_invalidate_by_class(WC_PARK_INFORMATION);
+    }
+
+    return tiles;
+}
+
+ParkStatistics Park::CalculateStatistics() const
+{
+    ParkStatistics stats;
+
+    // Guests
+    for (auto peep : EntityList<Guest>(EntityListId::Peep))
+    {
+        if (!peep->OutsideOfPark)
         {
-            if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
+            if (peep->Happiness > 128)
             {
-                tiles++;
+                stats.HappyGuests++;
+            }
+            if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
+            {
+                stats.LostGuests++;
             }
         }
-    } while (tile_element_iterator_next(&it));
+    }
 
-    if (tiles != gParkSize)
+    // Rides
+    bool ridePricesUnlocked = park_ride_prices_unlocked() && !(gParkFlags & PARK_FLAGS_NO_MONEY);
+    for (auto& ride : GetRideManager())
     {
-        gParkSize = tiles;
-        window_invalidate_by_class(WC_PARK_INFORMATION);
+        stats.Rides++;
+        stats.TotalRideUptime += 100 - ride.downtime;
+        if (ride_has_ratings(&ride))
+        {
+            stats.TotalRideExcitement += ride.excitement / 8;
+            stats.TotalRideIntensity += ride.intensity / 8;
+            stats.RatedRides++;
+        }
+        stats.TotalRideValue += CalculateRideValue(&ride);
+
+        if (ride.lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED))
+            continue;
+
+        if (ride.status == RIDE_STATUS_OPEN)
+        {
+            // Add ride value
+            if (ride.value != RIDE_VALUE_UNDEFINED)
+            {
+                money16 rideValue = static_cast<money16>(ride.value);
+                if (ridePricesUnlocked)
+                {
+                    rideValue -= ride.price[0];
+                }
+                if (rideValue > 0)
+                {
+                    stats.TotalRideValueForMoney += rideValue * 2;
+                }
+            }
+
+            // Add guest score for ride type
+            stats.SuggestedMaxGuests += RideTypeDescriptors[ride.type].BonusValue;
+        }
+
+        // Extra guests are available for good rides with difficult guest generation
+        if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_TESTED))
+            continue;
+        if (!ride_type_has_flag(ride.type, RIDE_TYPE_FLAG_HAS_TRACK))
+            continue;
+        if (!ride_type_has_flag(ride.type, RIDE_TYPE_FLAG_HAS_DATA_LOGGING))
+            continue;
+        if (ride.stations[0].SegmentLength < (600 << 16))
+            continue;
+        if (ride.excitement < RIDE_RATING(6, 00))
+            continue;
+
+        stats.GoodRideBonusGuests += RideTypeDescriptors[ride.type].BonusValue * 2;
     }
 
-    return tiles;
+    // Litter
+    for (auto litter : EntityList<Litter>(EntityListId::Litter))
+    {
+        // Ignore recently dropped litter
+        if (litter->creationTick - gScenarioTicks >= 7680)
+        {
+            stats.Litter++;
+        }
+    }
+
+    return stats;
 }
 
 int32_t Park::CalculateParkRating() const
+{
+    return CalculateParkRating(CalculateStatistics());
+}
+
+int32_t Park::CalculateParkRating(const ParkStatistics& stats) const
 {
     if (_forcedParkRating >= 0)
     {
@@ -382,66 +459,34 @@ int32_t Park::CalculateParkRating() const
         // -150 to +3 based on a range of guests from 0 to 2000
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
-        // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>(EntityListId::Peep))
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
-
         // Peep happiness -500 to +0
         result -= 500;
         if (gNumGuestsInPark > 0)
         {
-            result += 2 * std::min(250u, (happyGuestCount * 300) / gNumGuestsInPark);
+            result += 2 * std::min(250u, (stats.HappyGuests * 300) / gNumGuestsInPark);
         }
 
         // Up to 25 guests can be lost without affecting the park rating.
-        if (lostGuestCount > 25)
+        if (stats.LostGuests > 25)
         {
-            result -= (lostGuestCount - 25) * 7;
+            result -= (stats.LostGuests - 25) * 7;
         }
     }
 
     // Rides
     {
-        int32_t rideCount = 0;
-        int32_t excitingRideCount = 0;
-        int32_t totalRideUptime = 0;
-        int32_t totalRideIntensity = 0;
-        int32_t totalRideExcitement = 0;
-        for (auto& ride : GetRideManager())
-        {
-            totalRideUptime += 100 - ride.downtime;
-            if (ride_has_ratings(&ride))
-            {
-                totalRideExcitement += ride.excitement / 8;
-                totalRideIntensity += ride.intensity / 8;
-                excitingRideCount++;
-            }
-            rideCount++;
-        }
+        int32_t totalRideIntensity = stats.TotalRideIntensity;
+        int32_t totalRideExcitement = stats.TotalRideExcitement;
         result -= 200;
-        if (rideCount > 0)
+        if (stats.Rides > 0)
         {
-            result += (totalRideUptime / rideCount) * 2;
+            result += (stats.TotalRideUptime / stats.Rides) * 2;
         }
         result -= 100;
-        if (excitingRideCount > 0)
+        if (stats.RatedRides > 0)
         {
-            int32_t averageExcitement = totalRideExcitement / excitingRideCount;
-            int32_t averageIntensity = totalRideIntensity / excitingRideCount;
+            int32_t averageExcitement = totalRideExcitement / stats.RatedRides;
+            int32_t averageIntensity = totalRideIntensity / stats.RatedRides;
 
             averageExcitement -= 46;
             if (averageExcitement < 0)
@@ -466,18 +511,7 @@ int32_t Park::CalculateParkRating() const
     }
 
     // Litter
-    {
-        int32_t litterCount = 0;
-        for (auto litter : EntityList<Litter>(EntityListId::Litter))
-        {
-            // Ignore recently dropped litter
-            if (litter->creationTick - gScenarioTicks >= 7680)
-            {
-                litterCount++;
-            }
-        }
-        result -= 600 - (4 * (150 - std::min<int32_t>(150, litterCount)));
-    }
+    result -= 600 - (4 * (150 - std::min<int32_t>(150, stats.Litter)));
 
     result -= gParkRatingCasualtyPenalty;
     result = std::clamp(result, 0, 999);
@@ -492,11 +526,13 @@ money32 Park::CalculateParkValue() const
     {
         result += CalculateRideValue(&ride);
     }
+    return CalculateParkValue(result);
+}
 
+money32 Park::CalculateParkValue(money32 totalRideValue) const
+{
     // +7.00 per guest
-    result += gNumGuestsInPark * MONEY(7, 00);
-
-    return result;
+    return totalRideValue + gNumGuestsInPark * MONEY(7, 00);
 }
 
 money32 Park::CalculateRideValue(const Ride* ride) const
@@ -519,78 +555,15 @@ money32 Park::CalculateCompanyValue() const
     return result;
 }
 
-money16 Park::CalculateTotalRideValueForMoney() const
+uint32_t Park::CalculateSuggestedMaxGuests(const ParkStatistics& stats) const
 {
-    money16 totalRideValue = 0;
-    bool ridePricesUnlocked = park_ride_prices_unlocked() && !(gParkFlags & PARK_FLAGS_NO_MONEY);
-    for (auto& ride : GetRideManager())
-    {
-        if (ride.status != RIDE_STATUS_OPEN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-            continue;
-
-        // Add ride value
-        if (ride.value != RIDE_VALUE_UNDEFINED)
-        {
-            money16 rideValue = static_cast<money16>(ride.value);
-            if (ridePricesUnlocked)
-            {
-                rideValue -= ride.price[0];
-            }
-            if (rideValue > 0)
-            {
-                totalRideValue += rideValue * 2;
-            }
-        }
-    }
-    return totalRideValue;
-}
-
-uint32_t Park::CalculateSuggestedMaxGuests() const
-{
-    uint32_t suggestedMaxGuests = 0;
-
-    // TODO combine the two ride loops
-    for (auto& ride : GetRideManager())
-    {
-        if (ride.status != RIDE_STATUS_OPEN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-            continue;
-
-        // Add guest score for ride type
-        suggestedMaxGuests += RideTypeDescriptors[ride.type].BonusValue;
-    }
+    uint32_t suggestedMaxGuests = stats.SuggestedMaxGuests;
 
     // If difficult guest generation, extra guests are available for good rides
     if (gParkFlags & PARK_FLAGS_DIFFICULT_GUEST_GENERATION)
     {
         suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 1000);
-        for (auto& ride : GetRideManager())
-        {
-            if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-                continue;
-            if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-                continue;
-            if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-                continue;
-            if (!ride_type_has_flag(ride.type, RIDE_TYPE_FLAG_HAS_TRACK))
-                continue;
-            if (!ride_type_has_flag(ride.type, RIDE_TYPE_FLAG_HAS_DATA_LOGGING))
-                continue;
-            if (ride.stations[0].SegmentLength < (600 << 16))
-                continue;
-            if (ride.excitement < RIDE_RATING(6, 00))
-                continue;
-
-            // Bonus guests for good ride
-            suggestedMaxGuests += RideTypeDescriptors[ride.type].BonusValue * 2;
-        }
+        suggestedMaxGuests += stats.GoodRideBonusGuests;
     }
 
     suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 65535);
@@ -735,6 +708,21 @@ Peep* Park::GenerateGuest()
     return peep;
 }
 
+int32_t Park::GenerateGuests(int32_t count)
+{
+    // Every guest starts on a peep spawn, so inserting them one by one would walk ever longer spatial index lists
+    sprite_spatial_index_defer_begin();
+    int32_t generated = 0;
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (GenerateGuest() == nullptr)
+            break;
+        generated++;
+    }
+    sprite_spatial_index_defer_end();
+    return generated;
+}
+
 template<typename T, size_t TSize> static void HistoryPushRecord(T history[TSize], T newItem)
 {
     for (size_t i = TSize - 1; i > 0; i--)
@@ -38,9 +38,10 @@ enum : uint32_t
     PARK_FLAGS_DIFFICULT_PARK_RATING = (1 << 14),
     PARK_FLAGS_LOCK_REAL_NAMES_OPTION_DEPRECATED = (1 << 15), // Deprecated now we use a persistent 'real names' setting
     PARK_FLAGS_NO_MONEY_SCENARIO = (1 << 17),                 // equivalent to PARK_FLAGS_NO_MONEY, but used in scenario editor
-    PARK_FLAGS_SPRITES_INITIALISED = (1 << 18),  // After a scenario is loaded this prevents edits in the scenario editor
-    PARK_FLAGS_SIX_FLAGS_DEPRECATED = (1 << 19), // Not used anymore
-    PARK_FLAGS_UNLOCK_ALL_PRICES = (1u << 31),   // OpenRCT2 only!
+    PARK_FLAGS_SPRITES_INITIALISED = (1 << 18),     // After a scenario is loaded this prevents edits in the scenario editor
+    PARK_FLAGS_SIX_FLAGS_DEPRECATED = (1 << 19),    // Not used anymore
+    PARK_FLAGS_LONG_RANGE_PATHFINDING = (1u << 30), // OpenRCT2 only!
+    PARK_FLAGS_UNLOCK_ALL_PRICES = (1u << 31),      // OpenRCT2 only!
 };
 
 struct Peep;
@@ -50,6 +51,25 @@ namespace OpenRCT2
 {
     class Date;
 
+    /**
+     * Park-wide figures gathered in one pass over the guests, rides and litter for the periodic park evaluation.
+     */
+    struct ParkStatistics
+    {
+        uint32_t HappyGuests{};
+        uint32_t LostGuests{};
+        int32_t Rides{};
+        int32_t RatedRides{};
+        int32_t TotalRideUptime{};
+        int32_t TotalRideExcitement{};
+        int32_t TotalRideIntensity{};
+        money32 TotalRideValue{};
+        money16 TotalRideValueForMoney{};
+        uint32_t SuggestedMaxGuests{};
+        uint32_t GoodRideBonusGuests{};
+        int32_t Litter{};
+    };
+
     class Park final
     {
     public:
@@ -68,20 +88,23 @@ namespace OpenRCT2
         void Update(const Date& date);
 
         int32_t CalculateParkSize() const;
+        ParkStatistics CalculateStatistics() const;
         int32_t CalculateParkRating() const;
+        int32_t CalculateParkRating(const ParkStatistics& stats) const;
         money32 CalculateParkValue() const;
         money32 CalculateCompanyValue() const;
         static uint8_t CalculateGuestInitialHappiness(uint8_t percentage);
 
         Peep* GenerateGuest();
+        int32_t GenerateGuests(int32_t count);
 
         void ResetHistories();
         void UpdateHistories();
 
     private:
         money32 CalculateRideValue(const Ride* ride) const;
-        money16 CalculateTotalRideValueForMoney() const;
-        uint32_t CalculateSuggestedMaxGuests() const;
+        money32 CalculateParkValue(money32 totalRideValue) const;
+        uint32_t CalculateSuggestedMaxGuests(const ParkStatistics& stats) const;
         uint32_t CalculateGuestGenerationProbability() const;
 
         void GenerateGuests();
@@ -15,6 +15,7 @@
 #include "../audio/audio.h"
 #include "../core/Crypt.h"
 #include "../core/Guard.hpp"
+#include "../core/LargePages.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -23,16 +24,44 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 uint16_t gSpriteListHead[static_cast<uint8_t>(EntityListId::Count)];
 uint16_t gSpriteListCount[static_cast<uint8_t>(EntityListId::Count)];
-static rct_sprite _spriteList[MAX_SPRITES];
+static uint32_t _entityListRevision = 1;
+static uint32_t _entitySpatialRevision = 1;
+// Dense copies of the entity lists for iteration, see AcquireEntityListEntries. The free list is only ever walked by its
+// links and has no entries. Positions hold where each sprite is in the entries of its list.
+static std::vector<uint16_t> _entityListEntries[static_cast<uint8_t>(EntityListId::Count)];
+static size_t _entityListRemovedCount[static_cast<uint8_t>(EntityListId::Count)];
+static uint32_t _entityListPositions[MAX_SPRITES];
+static bool _entityListEntriesInvalid = true;
+// Number of EntityLists alive, the entries can not be compacted or rebuilt under them
+static uint32_t _entityListEntriesUsers;
+// Sprite slots are allocated in chunks the first time a slot in a chunk is needed. Slots that are not allocated yet still
+// count as free and logically follow the allocated part of the free list in index order, so sprites are handed out in
+// the same order as they would be if all MAX_SPRITES slots were allocated up front.
+static constexpr size_t SpriteChunkSize = 1000;
+static_assert(MAX_SPRITES % SpriteChunkSize == 0);
+// The chunks are slices of one reservation for all MAX_SPRITES, which keeps the sprites contiguous. Pages of a slice are
+// only backed once its chunk is allocated and written.
+static rct_sprite* _spritePool;
+static size_t _spriteChunkCount;
+
+// While above zero the spatial index is left alone and rebuilt in one pass once the deferral ends
+static int32_t _spatialIndexDeferCount = 0;
 
 static bool _spriteFlashingList[MAX_SPRITES];
 
 uint16_t gSpriteSpatialIndex[SPATIAL_INDEX_SIZE];
 
+// Only the pages for the allocated sprites are ever written, the rest of the arrays is never backed
+static SpriteHotFields _spriteHotFields;
+const SpriteHotFields& gSpriteHotFields = _spriteHotFields;
+
 const rct_string_id litterNames[12] = { STR_LITTER_VOMIT,
                                         STR_LITTER_VOMIT,
                                         STR_SHOP_ITEM_SINGULAR_EMPTY_CAN,
@@ -46,12 +75,42 @@ const rct_string_id litterNames[12] = { STR_LITTER_VOMIT,
                                         STR_SHOP_ITEM_SINGULAR_EMPTY_JUICE_CUP,
                                         STR_SHOP_ITEM_SINGULAR_EMPTY_BOWL_BLUE };
 
-static CoordsXYZ _spritelocations1[MAX_SPRITES];
-static CoordsXYZ _spritelocations2[MAX_SPRITES];
+// Positions of a sprite before and after the last tick, for drawing it in between
+struct SpriteTween
+{
+    uint16_t SpriteIndex;
+    CoordsXYZ From;
+    CoordsXYZ To;
+};
+
+// Sprites in view that moved during the last tick. The tween functions run every frame and only have to visit these
+// rather than striding through the whole sprite list.
+static std::vector<SpriteTween> _spriteTweens;
+static std::vector<TileCoordsXY> _spriteTweenTiles;
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y);
 static void move_sprite_to_list(SpriteBase* sprite, EntityListId newListIndex);
 
+static void sprite_hot_fields_sync(const SpriteBase* sprite)
+{
+    const auto spriteIndex = sprite->sprite_index;
+    _spriteHotFields.X[spriteIndex] = sprite->x;
+    _spriteHotFields.Y[spriteIndex] = sprite->y;
+    _spriteHotFields.Z[spriteIndex] = sprite->z;
+    _spriteHotFields.Left[spriteIndex] = sprite->sprite_left;
+    _spriteHotFields.Top[spriteIndex] = sprite->sprite_top;
+    _spriteHotFields.Right[spriteIndex] = sprite->sprite_right;
+    _spriteHotFields.Bottom[spriteIndex] = sprite->sprite_bottom;
+    _spriteHotFields.NextInQuadrant[spriteIndex] = sprite->next_in_quadrant;
+    _spriteHotFields.ListId[spriteIndex] = sprite->linked_list_index;
+}
+
+static void sprite_set_next_in_quadrant(SpriteBase* sprite, uint16_t nextInQuadrant)
+{
+    sprite->next_in_quadrant = nextInQuadrant;
+    _spriteHotFields.NextInQuadrant[sprite->sprite_index] = nextInQuadrant;
+}
+
 // Required for GetEntity to return a default
 template<> bool SpriteBase::Is<SpriteBase>() const
 {
@@ -83,6 +142,116 @@ uint16_t GetEntityListCount(EntityListId list)
     return gSpriteListCount[static_cast<uint8_t>(list)];
 }
 
+uint32_t GetEntityListRevision()
+{
+    return _entityListRevision;
+}
+
+void IncrementEntityListRevision()
+{
+    _entityListRevision++;
+    _entityListEntriesInvalid = true;
+}
+
+static void RebuildEntityListEntries()
+{
+    for (uint8_t i = 0; i < static_cast<uint8_t>(EntityListId::Count); i++)
+    {
+        auto& entries = _entityListEntries[i];
+        entries.clear();
+        _entityListRemovedCount[i] = 0;
+        if (i == static_cast<uint8_t>(EntityListId::Free))
+            continue;
+
+        // The list is walked from the head, a broken or cyclic list is cut off where it goes wrong
+        for (uint16_t spriteIndex = gSpriteListHead[i]; spriteIndex != SPRITE_INDEX_NULL && entries.size() < MAX_SPRITES;)
+        {
+            auto* sprite = GetEntity(spriteIndex);
+            if (sprite == nullptr)
+                break;
+            entries.push_back(spriteIndex);
+            spriteIndex = sprite->next;
+        }
+        std::reverse(entries.begin(), entries.end());
+        for (size_t position = 0; position < entries.size(); position++)
+        {
+            _entityListPositions[entries[position]] = static_cast<uint32_t>(position);
+        }
+    }
+    _entityListEntriesInvalid = false;
+}
+
+static void CompactEntityListEntries(uint8_t list)
+{
+    auto& entries = _entityListEntries[list];
+    size_t count = 0;
+    for (auto spriteIndex : entries)
+    {
+        if (spriteIndex != SPRITE_INDEX_NULL)
+        {
+            _entityListPositions[spriteIndex] = static_cast<uint32_t>(count);
+            entries[count++] = spriteIndex;
+        }
+    }
+    entries.resize(count);
+    _entityListRemovedCount[list] = 0;
+}
+
+const std::vector<uint16_t>& AcquireEntityListEntries(EntityListId list)
+{
+    const auto listIndex = static_cast<uint8_t>(list);
+    Guard::Assert(list != EntityListId::Free, "The free list has no entries");
+    if (_entityListEntriesUsers == 0)
+    {
+        if (_entityListEntriesInvalid)
+        {
+            RebuildEntityListEntries();
+        }
+        else if (_entityListRemovedCount[listIndex] * 2 > _entityListEntries[listIndex].size())
+        {
+            CompactEntityListEntries(listIndex);
+        }
+    }
+    _entityListEntriesUsers++;
+    return _entityListEntries[listIndex];
+}
+
+void ReleaseEntityListEntries()
+{
+    _entityListEntriesUsers--;
+}
+
+static void RemoveEntityListEntry(const SpriteBase* sprite, EntityListId list)
+{
+    if (list == EntityListId::Free)
+        return;
+
+    const auto listIndex = static_cast<uint8_t>(list);
+    auto& entries = _entityListEntries[listIndex];
+    const auto position = _entityListPositions[sprite->sprite_index];
+    if (position < entries.size() && entries[position] == sprite->sprite_index)
+    {
+        entries[position] = SPRITE_INDEX_NULL;
+        _entityListRemovedCount[listIndex]++;
+    }
+}
+
+static void AddEntityListEntry(const SpriteBase* sprite, EntityListId list)
+{
+    if (list == EntityListId::Free)
+        return;
+
+    // The sprite becomes the head of the list, which is the end of the entries
+    auto& entries = _entityListEntries[static_cast<uint8_t>(list)];
+    _entityListPositions[sprite->sprite_index] = static_cast<uint32_t>(entries.size());
+    entries.push_back(sprite->sprite_index);
+}
+
+uint32_t GetEntitySpatialRevision()
+{
+    return _entitySpatialRevision;
+}
+
 std::string rct_sprite_checksum::ToString() const
 {
     std::string result;
@@ -100,7 +269,9 @@ std::string rct_sprite_checksum::ToString() const
 
 SpriteBase* try_get_sprite(size_t spriteIndex)
 {
-    return spriteIndex >= MAX_SPRITES ? nullptr : &_spriteList[spriteIndex].generic;
+    if (spriteIndex >= _spriteChunkCount * SpriteChunkSize)
+        return nullptr;
+    return &_spritePool[spriteIndex].generic;
 }
 
 SpriteBase* get_sprite(size_t spriteIndex)
@@ -123,14 +294,7 @@ static void invalidate_sprite_max_zoom(SpriteBase* sprite, int32_t maxZoom)
     if (sprite->sprite_left == LOCATION_NULL)
         return;
 
-    for (int32_t i = 0; i < MAX_VIEWPORT_COUNT; i++)
-    {
-        rct_viewport* viewport = &g_viewport_list[i];
-        if (viewport->width != 0 && viewport->zoom <= maxZoom)
-        {
-            viewport_invalidate(viewport, sprite->sprite_left, sprite->sprite_top, sprite->sprite_right, sprite->sprite_bottom);
-        }
-    }
+    viewports_invalidate(sprite->sprite_left, sprite->sprite_top, sprite->sprite_right, sprite->sprite_bottom, maxZoom);
 }
 
 /**
@@ -161,50 +325,149 @@ void SpriteBase::Invalidate2()
 }
 
 /**
- *
- *  rct2: 0x0069EB13
+ * Allocates the next chunk of sprite slots as free sprites and links them after freeListTail, or makes them the free
+ * list if freeListTail is nullptr.
  */
-void reset_sprite_list()
+static void sprite_allocate_chunk(SpriteBase* freeListTail)
 {
-    gSavedAge = 0;
-    std::memset(static_cast<void*>(_spriteList), 0, sizeof(_spriteList));
+    if (_spritePool == nullptr)
+    {
+        // Kept for the lifetime of the process like the fixed sprite array it replaces. Small parks only use the first
+        // few chunks, so the pages of each chunk are only backed as it is first allocated.
+        _spritePool = static_cast<rct_sprite*>(LargePages::Reserve(MAX_SPRITES * sizeof(rct_sprite)));
+        if (_spritePool == nullptr)
+            throw std::bad_alloc();
+    }
 
-    for (int32_t i = 0; i < static_cast<uint8_t>(EntityListId::Count); i++)
+    const size_t firstIndex = _spriteChunkCount * SpriteChunkSize;
+    auto chunk = &_spritePool[firstIndex];
+    std::uninitialized_value_construct_n(chunk, SpriteChunkSize);
+    for (size_t i = 0; i < SpriteChunkSize; i++)
     {
-        gSpriteListHead[i] = SPRITE_INDEX_NULL;
-        gSpriteListCount[i] = 0;
-        _spriteFlashingList[i] = false;
+        const auto spriteIndex = static_cast<uint16_t>(firstIndex + i);
+        auto& spr = chunk[i].generic;
+        spr.sprite_identifier = SpriteIdentifier::Null;
+        spr.sprite_index = spriteIndex;
+        spr.linked_list_index = EntityListId::Free;
+        spr.next_in_quadrant = SPRITE_INDEX_NULL;
+        spr.previous = spriteIndex - 1;
+        spr.next = i + 1 < SpriteChunkSize ? spriteIndex + 1 : SPRITE_INDEX_NULL;
+        _spriteFlashingList[spriteIndex] = false;
+        sprite_hot_fields_sync(&spr);
     }
 
-    SpriteBase* previous_spr = nullptr;
+    if (freeListTail == nullptr)
+    {
+        chunk[0].generic.previous = SPRITE_INDEX_NULL;
+        gSpriteListHead[static_cast<uint8_t>(EntityListId::Free)] = static_cast<uint16_t>(firstIndex);
+    }
+    else
+    {
+        chunk[0].generic.previous = freeListTail->sprite_index;
+        freeListTail->next = static_cast<uint16_t>(firstIndex);
+    }
+    _spriteChunkCount++;
+}
+
+/**
+ * Unallocates the chunks from keepChunkCount on and gives their pages back to the OS.
+ */
+static void sprite_discard_chunks(size_t keepChunkCount)
+{
+    if (keepChunkCount >= _spriteChunkCount)
+        return;
 
-    for (int32_t i = 0; i < MAX_SPRITES; ++i)
+    LargePages::Discard(
+        &_spritePool[keepChunkCount * SpriteChunkSize],
+        (_spriteChunkCount - keepChunkCount) * SpriteChunkSize * sizeof(rct_sprite));
+    _spriteChunkCount = keepChunkCount;
+}
+
+void sprite_allocate(size_t count)
+{
+    count = std::min<size_t>(count, MAX_SPRITES);
+    if (_spriteChunkCount * SpriteChunkSize >= count)
+        return;
+
+    SpriteBase* freeListTail = nullptr;
+    for (auto sprite : EntityLinkedList(EntityListId::Free))
     {
-        auto* spr = GetEntity(i);
-        if (spr == nullptr)
-        {
-            continue;
-        }
+        freeListTail = sprite;
+    }
+    while (_spriteChunkCount * SpriteChunkSize < count)
+    {
+        sprite_allocate_chunk(freeListTail);
+        freeListTail = &_spritePool[_spriteChunkCount * SpriteChunkSize - 1].generic;
+    }
+}
 
-        spr->sprite_identifier = SpriteIdentifier::Null;
-        spr->sprite_index = i;
-        spr->next = SPRITE_INDEX_NULL;
-        spr->linked_list_index = EntityListId::Free;
+size_t sprite_get_allocated_count()
+{
+    return _spriteChunkCount * SpriteChunkSize;
+}
 
-        if (previous_spr != nullptr)
-        {
-            spr->previous = previous_spr->sprite_index;
-            previous_spr->next = i;
-        }
-        else
+void sprite_release_unused_chunks()
+{
+    const size_t allocatedCount = _spriteChunkCount * SpriteChunkSize;
+    if (allocatedCount <= SpriteChunkSize)
+        return;
+
+    std::vector<uint16_t> freeList;
+    for (uint16_t spriteIndex = gSpriteListHead[static_cast<uint8_t>(EntityListId::Free)]; spriteIndex != SPRITE_INDEX_NULL;)
+    {
+        auto* sprite = GetEntity(spriteIndex);
+        if (sprite == nullptr || freeList.size() >= allocatedCount)
         {
-            spr->previous = SPRITE_INDEX_NULL;
-            gSpriteListHead[static_cast<uint8_t>(EntityListId::Free)] = i;
+            // Broken list, keep everything allocated.
+            return;
         }
-        _spriteFlashingList[i] = false;
-        previous_spr = spr;
+        freeList.push_back(spriteIndex);
+        spriteIndex = sprite->next;
+    }
+
+    // Only a tail of the free list that counts up to the last allocated slot can become unallocated again, that is the
+    // order those slots would be linked in when they are allocated.
+    size_t runStart = freeList.size();
+    while (runStart > 0 && freeList[runStart - 1] == allocatedCount - (freeList.size() - runStart) - 1)
+    {
+        runStart--;
     }
+    const size_t firstUnusedIndex = allocatedCount - (freeList.size() - runStart);
+    const size_t firstUnusedChunk = (firstUnusedIndex + SpriteChunkSize - 1) / SpriteChunkSize;
+    const size_t keepCount = std::max<size_t>(1, firstUnusedChunk) * SpriteChunkSize;
+    if (keepCount >= allocatedCount)
+        return;
 
+    const size_t newTailPosition = runStart + (keepCount - firstUnusedIndex);
+    if (newTailPosition == 0)
+    {
+        gSpriteListHead[static_cast<uint8_t>(EntityListId::Free)] = SPRITE_INDEX_NULL;
+    }
+    else
+    {
+        GetEntity(freeList[newTailPosition - 1])->next = SPRITE_INDEX_NULL;
+    }
+    sprite_discard_chunks(keepCount / SpriteChunkSize);
+}
+
+/**
+ *
+ *  rct2: 0x0069EB13
+ */
+void reset_sprite_list()
+{
+    gSavedAge = 0;
+    sprite_discard_chunks(0);
+    gPeepNames.Clear();
+    IncrementEntityListRevision();
+
+    for (int32_t i = 0; i < static_cast<uint8_t>(EntityListId::Count); i++)
+    {
+        gSpriteListHead[i] = SPRITE_INDEX_NULL;
+        gSpriteListCount[i] = 0;
+    }
+
+    sprite_allocate_chunk(nullptr);
     gSpriteListCount[static_cast<uint8_t>(EntityListId::Free)] = MAX_SPRITES;
 
     reset_sprite_spatial_index();
@@ -219,7 +482,8 @@ void reset_sprite_list()
 void reset_sprite_spatial_index()
 {
     std::fill_n(gSpriteSpatialIndex, std::size(gSpriteSpatialIndex), SPRITE_INDEX_NULL);
-    for (size_t i = 0; i < MAX_SPRITES; i++)
+    _entitySpatialRevision++;
+    for (size_t i = 0; i < sprite_get_allocated_count(); i++)
     {
         auto* spr = GetEntity(i);
         if (spr != nullptr && spr->sprite_identifier != SpriteIdentifier::Null)
@@ -230,6 +494,15 @@ void reset_sprite_spatial_index()
             spr->next_in_quadrant = nextSpriteId;
         }
     }
+    sprite_hot_fields_sync_all();
+}
+
+void sprite_hot_fields_sync_all()
+{
+    for (size_t i = 0; i < sprite_get_allocated_count(); i++)
+    {
+        sprite_hot_fields_sync(try_get_sprite(i));
+    }
 }
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
@@ -272,7 +545,7 @@ rct_sprite_checksum sprite_checksum()
         }
 
         _spriteHashAlg->Clear();
-        for (size_t i = 0; i < MAX_SPRITES; i++)
+        for (size_t i = 0; i < sprite_get_allocated_count(); i++)
         {
             // TODO create a way to copy only the specific type
             auto sprite = GetEntity(i);
@@ -297,8 +570,8 @@ rct_sprite_checksum sprite_checksum()
 
                 if (copy.generic.Is<Peep>())
                 {
-                    // Name is pointer and will not be the same across clients
-                    copy.peep.Name = {};
+                    // Name is an index into the local name table and will not be the same across clients
+                    copy.peep.NameStorage = {};
 
                     // We set this to 0 because as soon the client selects a guest the window will remove the
                     // invalidation flags causing the sprite checksum to be different than on server, the flag does not affect
@@ -320,6 +593,95 @@ rct_sprite_checksum sprite_checksum()
 
     return checksum;
 }
+
+static uint64_t sprite_checksum_mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return value;
+}
+
+/**
+ * Hashes the game state of a single entity, the type specific size is used so that leftovers from whatever occupied
+ * the slot before are not part of the hash.
+ */
+static uint64_t sprite_checksum_hash_entity(const SpriteBase* entity)
+{
+    size_t size = sizeof(SpriteBase);
+    if (entity->Is<Peep>())
+        size = sizeof(Peep);
+    else if (entity->Is<Vehicle>())
+        size = sizeof(Vehicle);
+    else if (entity->Is<Litter>())
+        size = sizeof(Litter);
+
+    rct_sprite copy;
+    std::memcpy(copy.pad_00, entity, size);
+
+    // Same normalisation as sprite_checksum.
+    copy.generic.sprite_left = copy.generic.sprite_right = copy.generic.sprite_top = copy.generic.sprite_bottom = 0;
+    copy.generic.sprite_width = copy.generic.sprite_height_negative = copy.generic.sprite_height_positive = 0;
+    while (auto* nextSprite = GetEntity(copy.generic.next_in_quadrant))
+    {
+        if (nextSprite->sprite_identifier == SpriteIdentifier::Misc)
+            copy.generic.next_in_quadrant = nextSprite->next_in_quadrant;
+        else
+            break;
+    }
+    if (copy.generic.Is<Peep>())
+    {
+        copy.peep.NameStorage = {};
+        copy.peep.WindowInvalidateFlags = 0;
+    }
+
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&copy);
+    uint64_t hash = sprite_checksum_mix(entity->sprite_index + 0x9E3779B97F4A7C15ULL);
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + offset, sizeof(word));
+        hash = sprite_checksum_mix(hash ^ word);
+    }
+    if (offset < size)
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, bytes + offset, size - offset);
+        hash = sprite_checksum_mix(hash ^ word);
+    }
+    return hash;
+}
+
+rct_sprite_checksum sprite_rolling_checksum()
+{
+    // The entity hashes are combined with commutative operations so the order of the entity lists does not matter.
+    uint64_t sumHash = 0;
+    uint64_t xorHash = 0;
+    uint32_t count = 0;
+    for (auto listId : { EntityListId::TrainHead, EntityListId::Vehicle, EntityListId::Peep, EntityListId::Litter })
+    {
+        for (auto entity : EntityList(listId))
+        {
+            if (entity->sprite_identifier == SpriteIdentifier::Null || entity->sprite_identifier == SpriteIdentifier::Misc)
+                continue;
+
+            uint64_t hash = sprite_checksum_hash_entity(entity);
+            sumHash += hash;
+            xorHash ^= sprite_checksum_mix(hash);
+            count++;
+        }
+    }
+
+    rct_sprite_checksum checksum;
+    std::memcpy(checksum.raw.data(), &sumHash, sizeof(sumHash));
+    std::memcpy(checksum.raw.data() + sizeof(sumHash), &xorHash, sizeof(xorHash));
+    std::memcpy(checksum.raw.data() + sizeof(sumHash) + sizeof(xorHash), &count, sizeof(count));
+    static_assert(sizeof(sumHash) + sizeof(xorHash) + sizeof(count) == sizeof(checksum.raw));
+    return checksum;
+}
 #else
 
 rct_sprite_checksum sprite_checksum()
@@ -327,6 +689,11 @@ rct_sprite_checksum sprite_checksum()
     return rct_sprite_checksum{};
 }
 
+rct_sprite_checksum sprite_rolling_checksum()
+{
+    return rct_sprite_checksum{};
+}
+
 #endif // DISABLE_NETWORK
 
 static void sprite_reset(SpriteBase* sprite)
@@ -347,6 +714,7 @@ static void sprite_reset(SpriteBase* sprite)
     sprite->previous = prev;
     sprite->sprite_index = sprite_index;
     sprite->sprite_identifier = SpriteIdentifier::Null;
+    sprite_hot_fields_sync(sprite);
 }
 
 /**
@@ -355,7 +723,7 @@ static void sprite_reset(SpriteBase* sprite)
  */
 void sprite_clear_all_unused()
 {
-    for (auto sprite : EntityList(EntityListId::Free))
+    for (auto sprite : EntityLinkedList(EntityListId::Free))
     {
         sprite_reset(sprite);
         sprite->linked_list_index = EntityListId::Free;
@@ -368,6 +736,7 @@ void sprite_clear_all_unused()
             sprite->next_in_quadrant = SPRITE_INDEX_NULL;
         }
         _spriteFlashingList[sprite->sprite_index] = false;
+        sprite_hot_fields_sync(sprite);
     }
 }
 
@@ -395,6 +764,12 @@ rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier, EntityListId linked
         }
     }
 
+    if (gSpriteListHead[static_cast<uint8_t>(EntityListId::Free)] == SPRITE_INDEX_NULL
+        && _spriteChunkCount * SpriteChunkSize < MAX_SPRITES)
+    {
+        sprite_allocate_chunk(nullptr);
+    }
+
     auto* sprite = GetEntity(gSpriteListHead[static_cast<uint8_t>(EntityListId::Free)]);
     if (sprite == nullptr)
     {
@@ -414,6 +789,7 @@ rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier, EntityListId linked
     sprite->sprite_height_positive = 0x8;
     sprite->flags = 0;
     sprite->sprite_left = LOCATION_NULL;
+    sprite_hot_fields_sync(sprite);
 
     SpriteSpatialInsert(sprite, { LOCATION_NULL, 0 });
 
@@ -495,6 +871,7 @@ static void move_sprite_to_list(SpriteBase* sprite, EntityListId newListIndex)
 
     sprite->previous = SPRITE_INDEX_NULL; // We become the new head of the target list, so there's no previous sprite
     sprite->linked_list_index = newListIndex;
+    _spriteHotFields.ListId[sprite->sprite_index] = newListIndex;
 
     sprite->next = gSpriteListHead[static_cast<uint8_t>(
         newListIndex)]; // This sprite's next sprite is the old head, since we're the new head
@@ -519,6 +896,13 @@ static void move_sprite_to_list(SpriteBase* sprite, EntityListId newListIndex)
     // Decrement old list counter, increment new list counter.
     gSpriteListCount[static_cast<uint8_t>(oldListIndex)]--;
     gSpriteListCount[static_cast<uint8_t>(newListIndex)]++;
+    _entityListRevision++;
+
+    if (!_entityListEntriesInvalid)
+    {
+        RemoveEntityListEntry(sprite, oldListIndex);
+        AddEntityListEntry(sprite, newListIndex);
+    }
 }
 
 /**
@@ -661,44 +1045,80 @@ void sprite_misc_update_all()
 }
 
 // Performs a search to ensure that insert keeps next_in_quadrant in sprite_index order
+void sprite_spatial_index_defer_begin()
+{
+    _spatialIndexDeferCount++;
+}
+
+void sprite_spatial_index_defer_end()
+{
+    Guard::Assert(_spatialIndexDeferCount > 0, "Unbalanced sprite spatial index deferral");
+    _spatialIndexDeferCount--;
+    if (_spatialIndexDeferCount == 0)
+    {
+        // Buckets are rebuilt in descending sprite index order, the same order SpriteSpatialInsert keeps them in
+        reset_sprite_spatial_index();
+    }
+}
+
 static void SpriteSpatialInsert(SpriteBase* sprite, const CoordsXY& newLoc)
 {
+    if (_spatialIndexDeferCount > 0)
+    {
+        _entitySpatialRevision++;
+        return;
+    }
+
     size_t newIndex = GetSpatialIndexOffset(newLoc.x, newLoc.y);
 
-    auto* next = &gSpriteSpatialIndex[newIndex];
-    while (sprite->sprite_index < *next && *next != SPRITE_INDEX_NULL)
+    // The quadrant is walked through the hot fields, only the sprite linking to the new one is touched
+    uint16_t previousIndex = SPRITE_INDEX_NULL;
+    uint16_t nextIndex = gSpriteSpatialIndex[newIndex];
+    while (sprite->sprite_index < nextIndex && nextIndex != SPRITE_INDEX_NULL)
     {
-        auto sprite2 = GetEntity(*next);
-        next = &sprite2->next_in_quadrant;
+        previousIndex = nextIndex;
+        nextIndex = _spriteHotFields.NextInQuadrant[nextIndex];
     }
 
-    sprite->next_in_quadrant = *next;
-    *next = sprite->sprite_index;
+    sprite_set_next_in_quadrant(sprite, nextIndex);
+    if (previousIndex == SPRITE_INDEX_NULL)
+        gSpriteSpatialIndex[newIndex] = sprite->sprite_index;
+    else
+        sprite_set_next_in_quadrant(GetEntity(previousIndex), sprite->sprite_index);
+    _entitySpatialRevision++;
 }
 
 static void SpriteSpatialRemove(SpriteBase* sprite)
 {
+    if (_spatialIndexDeferCount > 0)
+    {
+        _entitySpatialRevision++;
+        return;
+    }
+
     size_t currentIndex = GetSpatialIndexOffset(sprite->x, sprite->y);
-    auto* index = &gSpriteSpatialIndex[currentIndex];
 
     // This indicates that the spatial index data is incorrect.
-    if (*index == SPRITE_INDEX_NULL)
+    if (gSpriteSpatialIndex[currentIndex] == SPRITE_INDEX_NULL)
     {
         log_warning("Bad sprite spatial index. Rebuilding the spatial index...");
         reset_sprite_spatial_index();
     }
 
-    auto* sprite2 = GetEntity(*index);
-    while (sprite != sprite2)
+    // If the sprite is not in the quadrant its link is dropped onto the end of it, as it always has been
+    uint16_t previousIndex = SPRITE_INDEX_NULL;
+    uint16_t spriteIndex = gSpriteSpatialIndex[currentIndex];
+    while (spriteIndex != sprite->sprite_index && spriteIndex != SPRITE_INDEX_NULL)
     {
-        index = &sprite2->next_in_quadrant;
-        if (*index == SPRITE_INDEX_NULL)
-        {
-            break;
-        }
-        sprite2 = GetEntity(*index);
+        previousIndex = spriteIndex;
+        spriteIndex = _spriteHotFields.NextInQuadrant[spriteIndex];
     }
-    *index = sprite->next_in_quadrant;
+
+    if (previousIndex == SPRITE_INDEX_NULL)
+        gSpriteSpatialIndex[currentIndex] = sprite->next_in_quadrant;
+    else
+        sprite_set_next_in_quadrant(GetEntity(previousIndex), sprite->next_in_quadrant);
+    _entitySpatialRevision++;
 }
 
 static void SpriteSpatialMove(SpriteBase* sprite, const CoordsXY& newLoc)
@@ -734,9 +1154,11 @@ void SpriteBase::MoveTo(const CoordsXYZ& newLocation)
     if (loc.x == LOCATION_NULL)
     {
         sprite_left = LOCATION_NULL;
+        _entitySpatialRevision++;
         x = loc.x;
         y = loc.y;
         z = loc.z;
+        sprite_hot_fields_sync(this);
     }
     else
     {
@@ -755,6 +1177,8 @@ void sprite_set_coordinates(const CoordsXYZ& spritePos, SpriteBase* sprite)
     sprite->x = spritePos.x;
     sprite->y = spritePos.y;
     sprite->z = spritePos.z;
+    sprite_hot_fields_sync(sprite);
+    _entitySpatialRevision++;
 }
 
 /**
@@ -880,6 +1304,10 @@ uint16_t remove_floating_sprites()
     for (uint16_t i = 0; i < MAX_SPRITES; i++)
     {
         auto* entity = GetEntity(i);
+        if (entity == nullptr)
+        {
+            continue;
+        }
         if (entity->Is<Balloon>())
         {
             sprite_remove(entity);
@@ -906,59 +1334,90 @@ uint16_t remove_floating_sprites()
 /**
  * Determines whether it's worth tweening a sprite or not when frame smoothing is on.
  */
-static bool sprite_should_tween(SpriteBase* sprite)
+static bool sprite_should_tween(uint16_t spriteIndex)
 {
-    switch (sprite->sprite_identifier)
+    // Peeps and vehicles are the sprites in these lists
+    switch (_spriteHotFields.ListId[spriteIndex])
     {
-        case SpriteIdentifier::Peep:
-        case SpriteIdentifier::Vehicle:
+        case EntityListId::TrainHead:
+        case EntityListId::Vehicle:
+        case EntityListId::Peep:
             return true;
-        case SpriteIdentifier::Misc:
-        case SpriteIdentifier::Litter:
-        case SpriteIdentifier::Null:
+        default:
             return false;
     }
-    return false;
 }
 
-static void store_sprite_locations(CoordsXYZ* sprite_locations)
+static CoordsXYZ sprite_get_hot_position(uint16_t spriteIndex)
 {
-    for (uint16_t i = 0; i < MAX_SPRITES; i++)
+    return { _spriteHotFields.X[spriteIndex], _spriteHotFields.Y[spriteIndex], _spriteHotFields.Z[spriteIndex] };
+}
+
+static void sprite_position_tween_add(uint16_t spriteIndex)
+{
+    if (sprite_should_tween(spriteIndex))
     {
-        // skip going through `get_sprite` to not get stalled on assert,
-        // this can get very expensive for busy parks with uncap FPS option on
-        const rct_sprite* sprite = &_spriteList[i];
-        sprite_locations[i].x = sprite->generic.x;
-        sprite_locations[i].y = sprite->generic.y;
-        sprite_locations[i].z = sprite->generic.z;
+        _spriteTweens.push_back({ spriteIndex, sprite_get_hot_position(spriteIndex), {} });
     }
 }
 
+/**
+ * Stores the positions of the sprites that can be seen before a tick. Only sprites on tiles in view of a viewport are
+ * stored, unless the views cover so much of the map that going through every sprite is cheaper.
+ */
 void sprite_position_tween_store_a()
 {
-    store_sprite_locations(_spritelocations1);
+    _spriteTweens.clear();
+
+    const size_t spritesInUse = MAX_SPRITES - GetEntityListCount(EntityListId::Free);
+    if (viewports_get_visible_tiles(spritesInUse, _spriteTweenTiles))
+    {
+        for (const auto& tile : _spriteTweenTiles)
+        {
+            for (uint16_t spriteIndex = sprite_get_first_in_quadrant(tile.ToCoordsXY()); spriteIndex != SPRITE_INDEX_NULL;
+                 spriteIndex = _spriteHotFields.NextInQuadrant[spriteIndex])
+            {
+                sprite_position_tween_add(spriteIndex);
+            }
+        }
+        return;
+    }
+
+    // Only the hot fields are read, this runs every frame with uncapped FPS
+    const auto allocatedCount = static_cast<uint16_t>(sprite_get_allocated_count());
+    for (uint16_t i = 0; i < allocatedCount; i++)
+    {
+        sprite_position_tween_add(i);
+    }
 }
 
+/**
+ * Stores the positions of the same sprites after the tick, sprites that did not move are dropped.
+ */
 void sprite_position_tween_store_b()
 {
-    store_sprite_locations(_spritelocations2);
+    const size_t allocatedCount = sprite_get_allocated_count();
+    auto end = std::remove_if(_spriteTweens.begin(), _spriteTweens.end(), [allocatedCount](SpriteTween& tween) {
+        if (tween.SpriteIndex >= allocatedCount || !sprite_should_tween(tween.SpriteIndex))
+            return true;
+
+        tween.To = sprite_get_hot_position(tween.SpriteIndex);
+        return tween.To == tween.From;
+    });
+    _spriteTweens.erase(end, _spriteTweens.end());
 }
 
 void sprite_position_tween_all(float alpha)
 {
     const float inv = (1.0f - alpha);
 
-    for (uint16_t i = 0; i < MAX_SPRITES; i++)
+    for (const auto& tween : _spriteTweens)
     {
-        auto* sprite = GetEntity(i);
-        if (sprite != nullptr && sprite_should_tween(sprite))
+        auto* sprite = GetEntity(tween.SpriteIndex);
+        if (sprite != nullptr && sprite_should_tween(tween.SpriteIndex))
         {
-            auto posA = _spritelocations1[i];
-            auto posB = _spritelocations2[i];
-            if (posA == posB)
-            {
-                continue;
-            }
+            const auto& posA = tween.From;
+            const auto& posB = tween.To;
             sprite_set_coordinates(
                 { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
                   static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
@@ -974,33 +1433,20 @@ void sprite_position_tween_all(float alpha)
  */
 void sprite_position_tween_restore()
 {
-    for (uint16_t i = 0; i < MAX_SPRITES; i++)
+    for (const auto& tween : _spriteTweens)
     {
-        auto* sprite = GetEntity(i);
-        if (sprite != nullptr && sprite_should_tween(sprite))
+        auto* sprite = GetEntity(tween.SpriteIndex);
+        if (sprite != nullptr && sprite_should_tween(tween.SpriteIndex))
         {
             sprite->Invalidate2();
-
-            auto pos = _spritelocations2[i];
-            sprite_set_coordinates(pos, sprite);
+            sprite_set_coordinates(tween.To, sprite);
         }
     }
 }
 
 void sprite_position_tween_reset()
 {
-    for (uint16_t i = 0; i < MAX_SPRITES; i++)
-    {
-        auto* sprite = GetEntity(i);
-        if (sprite == nullptr)
-        {
-            continue;
-        }
-
-        _spritelocations1[i].x = _spritelocations2[i].x = sprite->x;
-        _spritelocations1[i].y = _spritelocations2[i].y = sprite->y;
-        _spritelocations1[i].z = _spritelocations2[i].z = sprite->z;
-    }
+    _spriteTweens.clear();
 }
 
 void sprite_set_flashing(SpriteBase* sprite, bool flashing)
@@ -1053,7 +1499,7 @@ static SpriteBase* find_sprite_list_cycle(uint16_t sprite_idx)
 
 static bool index_is_in_list(uint16_t index, EntityListId sl)
 {
-    for (auto entity : EntityList(sl))
+    for (auto entity : EntityLinkedList(sl))
     {
         if (entity->sprite_index == index)
         {
@@ -1072,6 +1518,8 @@ int32_t check_for_sprite_list_cycles(bool fix)
         {
             if (fix)
             {
+                IncrementEntityListRevision();
+
                 // Fix head list, but only in reverse order
                 // This is likely not needed, but just in case
                 auto head = GetEntity(gSpriteListHead[i]);
@@ -1119,7 +1567,7 @@ int32_t check_for_sprite_list_cycles(bool fix)
 int32_t fix_disjoint_sprites()
 {
     // Find reachable sprites
-    bool reachable[MAX_SPRITES] = { false };
+    std::vector<bool> reachable(MAX_SPRITES, false);
 
     SpriteBase* null_list_tail = nullptr;
     for (uint16_t sprite_idx = gSpriteListHead[static_cast<uint8_t>(EntityListId::Free)]; sprite_idx != SPRITE_INDEX_NULL;)
@@ -1163,6 +1611,7 @@ int32_t fix_disjoint_sprites()
                 null_list_tail = spr;
                 count++;
                 reachable[sprite_idx] = true;
+                IncrementEntityListRevision();
             }
         }
     }
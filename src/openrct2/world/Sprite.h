@@ -16,8 +16,11 @@
 #include "Fountain.h"
 #include "SpriteBase.h"
 
+#include <vector>
+
 #define SPRITE_INDEX_NULL 0xFFFF
-#define MAX_SPRITES 10000
+// Parks with more sprites than RCT2_MAX_SPRITES store the rest in an OpenRCT2 chunk of the S6 file
+#define MAX_SPRITES 65000
 
 enum class SpriteIdentifier : uint8_t
 {
@@ -216,6 +219,28 @@ template<typename T = SpriteBase> T* TryGetEntity(size_t sprite_idx)
 }
 
 uint16_t GetEntityListCount(EntityListId list);
+/**
+ * Changes whenever an entity is added to or removed from one of the entity lists, so that code keeping its own list of
+ * entities can tell when it has to be rebuilt.
+ */
+uint32_t GetEntityListRevision();
+/**
+ * Changes whenever an entity joins, leaves or moves within the spatial index or its screen bounds change, so that code
+ * caching entity positions can tell when it has to be rebuilt.
+ */
+uint32_t GetEntitySpatialRevision();
+/**
+ * For code that writes the entity list links directly, such as the S6 importer. The entries of the lists are rebuilt
+ * from the links the next time they are iterated.
+ */
+void IncrementEntityListRevision();
+/**
+ * Entities of a list as a dense array of sprite indices in reverse list order, the last entry is the head of the list.
+ * Entities that left the list leave SPRITE_INDEX_NULL behind until the array is compacted, which only happens while no
+ * EntityList is alive. Every call must be paired with ReleaseEntityListEntries.
+ */
+const std::vector<uint16_t>& AcquireEntityListEntries(EntityListId list);
+void ReleaseEntityListEntries();
 extern uint16_t gSpriteListHead[static_cast<uint8_t>(EntityListId::Count)];
 extern uint16_t gSpriteListCount[static_cast<uint8_t>(EntityListId::Count)];
 
@@ -223,12 +248,57 @@ constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXI
 constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 extern uint16_t gSpriteSpatialIndex[SPATIAL_INDEX_SIZE];
 
+/**
+ * The sprite fields that the spatial index walks, painting and tweening read, copied into one array per field and
+ * indexed by sprite index. Scans over these only load the fields they look at instead of a whole sprite per step. The
+ * sprite functions keep the copies in step with the sprites, code that writes the fields of a sprite directly has to
+ * call sprite_hot_fields_sync_all afterwards.
+ */
+struct SpriteHotFields
+{
+    int16_t X[MAX_SPRITES];
+    int16_t Y[MAX_SPRITES];
+    int16_t Z[MAX_SPRITES];
+    int16_t Left[MAX_SPRITES];
+    int16_t Top[MAX_SPRITES];
+    int16_t Right[MAX_SPRITES];
+    int16_t Bottom[MAX_SPRITES];
+    uint16_t NextInQuadrant[MAX_SPRITES];
+    EntityListId ListId[MAX_SPRITES];
+};
+extern const SpriteHotFields& gSpriteHotFields;
+
 extern const rct_string_id litterNames[12];
 
 rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier);
 rct_sprite* create_sprite(SpriteIdentifier spriteIdentifier, EntityListId linkedListIndex);
 void reset_sprite_list();
+/**
+ * Allocates sprite slots until at least count of them are allocated, for code that reads or writes slots directly such as
+ * the S6 importer and exporter.
+ */
+void sprite_allocate(size_t count);
+/**
+ * Releases trailing chunks of sprite slots that only contain free sprites at the end of the free list.
+ */
+void sprite_release_unused_chunks();
+/**
+ * Number of sprite slots that are currently allocated, free or not.
+ */
+size_t sprite_get_allocated_count();
 void reset_sprite_spatial_index();
+/**
+ * Copies the hot fields of every allocated sprite into gSpriteHotFields, for code that wrote them directly such as the
+ * importers.
+ */
+void sprite_hot_fields_sync_all();
+/**
+ * Stops the spatial index from being updated as sprites are created, moved and removed until the matching call to
+ * sprite_spatial_index_defer_end, which rebuilds it in a single pass. Meant for creating many sprites at once, the
+ * index must not be read in between.
+ */
+void sprite_spatial_index_defer_begin();
+void sprite_spatial_index_defer_end();
 void sprite_clear_all_unused();
 void sprite_misc_update_all();
 void sprite_set_coordinates(const CoordsXYZ& spritePos, SpriteBase* sprite);
@@ -265,6 +335,11 @@ void crashed_vehicle_particle_create(rct_vehicle_colour colours, const CoordsXYZ
 void crash_splash_create(const CoordsXYZ& splashPos);
 
 rct_sprite_checksum sprite_checksum();
+/**
+ * Cheaper alternative to sprite_checksum used for network desync checks. Only the live entity lists are visited and
+ * each entity is hashed over the size of its own type, the result does not match sprite_checksum.
+ */
+rct_sprite_checksum sprite_rolling_checksum();
 
 void sprite_set_flashing(SpriteBase* sprite, bool flashing);
 bool sprite_get_flashing(SpriteBase* sprite);
@@ -349,26 +424,167 @@ public:
     }
 };
 
-template<typename T = SpriteBase> class EntityList
+/**
+ * Walks the links of an entity list, for code that maintains the links itself such as the free list handling.
+ */
+template<typename T = SpriteBase> class EntityLinkedList
 {
 private:
     uint16_t FirstEntity = SPRITE_INDEX_NULL;
-    using EntityListIterator = EntityIterator<T, &SpriteBase::next>;
+    using EntityLinkedListIterator = EntityIterator<T, &SpriteBase::next>;
 
 public:
-    EntityList(EntityListId type)
+    EntityLinkedList(EntityListId type)
         : FirstEntity(gSpriteListHead[static_cast<uint8_t>(type)])
     {
     }
 
-    EntityListIterator begin()
+    EntityLinkedListIterator begin()
     {
-        return EntityListIterator(FirstEntity);
+        return EntityLinkedListIterator(FirstEntity);
     }
-    EntityListIterator end()
+    EntityLinkedListIterator end()
     {
-        return EntityListIterator(SPRITE_INDEX_NULL);
+        return EntityLinkedListIterator(SPRITE_INDEX_NULL);
     }
 };
 
+template<typename T> class EntityListIterator
+{
+private:
+    const std::vector<uint16_t>* Entries = nullptr;
+    size_t Position = 0;
+    T* Entity = nullptr;
+
+public:
+    EntityListIterator(const std::vector<uint16_t>* entries, size_t position)
+        : Entries(entries)
+        , Position(position)
+    {
+        ++(*this);
+    }
+    EntityListIterator& operator++()
+    {
+        Entity = nullptr;
+
+        // Entries are walked backwards from the head, entities added during the walk are appended and not visited
+        while (Position != 0 && Entity == nullptr)
+        {
+            auto entityId = (*Entries)[--Position];
+            if (entityId == SPRITE_INDEX_NULL)
+                continue;
+
+            auto baseEntity = GetEntity(entityId);
+            if (baseEntity != nullptr)
+            {
+                Entity = baseEntity->template As<T>();
+            }
+        }
+        return *this;
+    }
+
+    EntityListIterator operator++(int)
+    {
+        EntityListIterator retval = *this;
+        ++(*this);
+        return retval;
+    }
+    bool operator==(EntityListIterator other) const
+    {
+        return Entity == other.Entity;
+    }
+    bool operator!=(EntityListIterator other) const
+    {
+        return !(*this == other);
+    }
+    T* operator*()
+    {
+        return Entity;
+    }
+    // iterator traits
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+    using iterator_category = std::forward_iterator_tag;
+};
+
+/**
+ * Iterates the entities of a list in list order through the dense entries of the list, see AcquireEntityListEntries.
+ */
+template<typename T = SpriteBase> class EntityList
+{
+private:
+    const std::vector<uint16_t>* Entries = nullptr;
+    size_t Count = 0;
+
+public:
+    EntityList(EntityListId type)
+        : Entries(&AcquireEntityListEntries(type))
+        , Count(Entries->size())
+    {
+    }
+    EntityList(const EntityList&) = delete;
+    EntityList& operator=(const EntityList&) = delete;
+    ~EntityList()
+    {
+        ReleaseEntityListEntries();
+    }
+
+    EntityListIterator<T> begin()
+    {
+        return EntityListIterator<T>(Entries, Count);
+    }
+    EntityListIterator<T> end()
+    {
+        return EntityListIterator<T>(Entries, 0);
+    }
+};
+
+/**
+ * Calls fn for every entity of type T inside the area, edges included, by going through the tiles of the spatial index
+ * that the area covers instead of a whole entity list. Entities are visited tile by tile rather than in the order of the
+ * entity lists, so this is only for lookups whose outcome does not depend on that order.
+ */
+template<typename T = SpriteBase, typename TFn> void ForEachEntityInArea(const MapRange& area, TFn&& fn)
+{
+    constexpr int32_t maxCoord = (MAXIMUM_MAP_SIZE_TECHNICAL - 1) * COORDS_XY_STEP;
+    const auto range = area.Normalise();
+    const int32_t left = std::clamp(range.GetLeft(), 0, maxCoord) / COORDS_XY_STEP * COORDS_XY_STEP;
+    const int32_t top = std::clamp(range.GetTop(), 0, maxCoord) / COORDS_XY_STEP * COORDS_XY_STEP;
+    const int32_t right = std::clamp(range.GetRight(), 0, maxCoord);
+    const int32_t bottom = std::clamp(range.GetBottom(), 0, maxCoord);
+    for (int32_t y = top; y <= bottom; y += COORDS_XY_STEP)
+    {
+        for (int32_t x = left; x <= right; x += COORDS_XY_STEP)
+        {
+            // The quadrant links and positions come from the hot fields, only entities inside the area are read
+            for (uint16_t spriteIndex = sprite_get_first_in_quadrant({ x, y }); spriteIndex != SPRITE_INDEX_NULL;)
+            {
+                const uint16_t nextIndex = gSpriteHotFields.NextInQuadrant[spriteIndex];
+                const int32_t entityX = gSpriteHotFields.X[spriteIndex];
+                const int32_t entityY = gSpriteHotFields.Y[spriteIndex];
+                if (entityX >= range.GetLeft() && entityX <= range.GetRight() && entityY >= range.GetTop()
+                    && entityY <= range.GetBottom())
+                {
+                    auto entity = GetEntity<T>(spriteIndex);
+                    if (entity != nullptr)
+                    {
+                        fn(entity);
+                    }
+                }
+                spriteIndex = nextIndex;
+            }
+        }
+    }
+}
+
+/**
+ * Same as ForEachEntityInArea for the square of entities that are at most range away from the centre on both axes.
+ */
+template<typename T = SpriteBase, typename TFn> void ForEachEntityInRange(const CoordsXY& centre, int32_t range, TFn&& fn)
+{
+    ForEachEntityInArea<T>({ centre.x - range, centre.y - range, centre.x + range, centre.y + range }, std::forward<TFn>(fn));
+}
+
 #endif
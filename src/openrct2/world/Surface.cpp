@@ -42,6 +42,7 @@ TerrainEdgeObject* SurfaceElement::GetEdgeStyleObject() const
 void SurfaceElement::SetSurfaceStyle(uint32_t newStyle)
 {
     SurfaceStyle = newStyle;
+    map_invalidate_tile_element_summaries();
 }
 
 void SurfaceElement::SetEdgeStyle(uint32_t newStyle)
@@ -197,8 +198,13 @@ uint8_t SurfaceElement::GetOwnership() const
 
 void SurfaceElement::SetOwnership(uint8_t newOwnership)
 {
-    Ownership &= ~TILE_ELEMENT_SURFACE_OWNERSHIP_MASK;
-    Ownership |= (newOwnership & TILE_ELEMENT_SURFACE_OWNERSHIP_MASK);
+    const uint8_t ownership = (Ownership & ~TILE_ELEMENT_SURFACE_OWNERSHIP_MASK)
+        | (newOwnership & TILE_ELEMENT_SURFACE_OWNERSHIP_MASK);
+    if (ownership != Ownership)
+    {
+        Ownership = ownership;
+        map_invalidate_tile_ownership();
+    }
 }
 
 uint8_t SurfaceElement::GetParkFences() const
@@ -16,6 +16,7 @@
 #include "Banner.h"
 #include "LargeScenery.h"
 #include "Location.hpp"
+#include "Map.h"
 #include "Scenery.h"
 
 uint8_t TileElementBase::GetType() const
@@ -27,6 +28,7 @@ void TileElementBase::SetType(uint8_t newType)
 {
     this->type &= ~TILE_ELEMENT_TYPE_MASK;
     this->type |= (newType & TILE_ELEMENT_TYPE_MASK);
+    map_invalidate_tile_element_summaries();
 }
 
 Direction TileElementBase::GetDirection() const
@@ -159,6 +161,7 @@ ride_id_t TileElement::GetRideIndex() const
 void TileElement::ClearAs(uint8_t newType)
 {
     type = newType;
+    map_invalidate_tile_element_summaries();
     Flags = 0;
     base_height = MINIMUM_LAND_HEIGHT;
     clearance_height = MINIMUM_LAND_HEIGHT;
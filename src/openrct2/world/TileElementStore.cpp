@@ -0,0 +1,94 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TileElementStore.h"
+
+#include "../core/LargePages.h"
+#include "Map.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+TileElementStore::TileElementStore(size_type size)
+{
+    assign(size);
+}
+
+TileElementStore::TileElementStore(TileElementStore&& other) noexcept
+    : _elements(std::exchange(other._elements, nullptr))
+    , _size(std::exchange(other._size, 0))
+{
+}
+
+TileElementStore& TileElementStore::operator=(TileElementStore&& other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        _elements = std::exchange(other._elements, nullptr);
+        _size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
+
+TileElementStore::~TileElementStore()
+{
+    Release();
+}
+
+TileElementStore::size_type TileElementStore::max_size()
+{
+    return MAX_TILE_ELEMENTS_WITH_SPARE_ROOM;
+}
+
+void TileElementStore::assign(size_type size)
+{
+    resize(0);
+    resize(size);
+}
+
+void TileElementStore::resize(size_type size)
+{
+    size = std::min(size, max_size());
+    if (size > _size)
+    {
+        if (_elements == nullptr)
+        {
+            Reserve();
+        }
+        std::memset(static_cast<void*>(_elements + _size), 0, (size - _size) * sizeof(TileElement));
+    }
+    else if (size < _size && _elements != nullptr)
+    {
+        // The pages are given back, they are zeroed again when the store grows back over them
+        LargePages::Discard(_elements + size, (_size - size) * sizeof(TileElement));
+    }
+    _size = size;
+}
+
+void TileElementStore::Reserve()
+{
+    _elements = static_cast<TileElement*>(LargePages::Reserve(max_size() * sizeof(TileElement)));
+    if (_elements == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+}
+
+void TileElementStore::Release()
+{
+    if (_elements != nullptr)
+    {
+        LargePages::Free(_elements, max_size() * sizeof(TileElement));
+        _elements = nullptr;
+    }
+    _size = 0;
+}
@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "TileElement.h"
+
+#include <cstddef>
+
+/**
+ * The tile elements of a map. Address space for the largest possible store is reserved when the first element is
+ * added, but memory only backs the pages that have been written to. Resizing never moves the elements, so pointers to
+ * them stay valid while the store grows. They only become invalid when the store is replaced or reset.
+ */
+class TileElementStore
+{
+public:
+    using value_type = TileElement;
+    using size_type = size_t;
+    using iterator = TileElement*;
+    using const_iterator = const TileElement*;
+
+    TileElementStore() = default;
+    explicit TileElementStore(size_type size);
+    TileElementStore(TileElementStore&& other) noexcept;
+    TileElementStore& operator=(TileElementStore&& other) noexcept;
+    TileElementStore(const TileElementStore&) = delete;
+    TileElementStore& operator=(const TileElementStore&) = delete;
+    ~TileElementStore();
+
+    /**
+     * Largest number of elements the store can hold.
+     */
+    static size_type max_size();
+
+    TileElement* data()
+    {
+        return _elements;
+    }
+
+    const TileElement* data() const
+    {
+        return _elements;
+    }
+
+    size_type size() const
+    {
+        return _size;
+    }
+
+    TileElement& operator[](size_type index)
+    {
+        return _elements[index];
+    }
+
+    const TileElement& operator[](size_type index) const
+    {
+        return _elements[index];
+    }
+
+    iterator begin()
+    {
+        return _elements;
+    }
+
+    iterator end()
+    {
+        return _elements + _size;
+    }
+
+    const_iterator begin() const
+    {
+        return _elements;
+    }
+
+    const_iterator end() const
+    {
+        return _elements + _size;
+    }
+
+    /**
+     * Replaces the contents with size zeroed elements.
+     */
+    void assign(size_type size);
+
+    /**
+     * Grows or shrinks the store in place. Elements added by growing are zeroed.
+     */
+    void resize(size_type size);
+
+private:
+    TileElement* _elements = nullptr;
+    size_type _size = 0;
+
+    void Reserve();
+    void Release();
+};
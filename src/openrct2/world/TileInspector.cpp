@@ -68,6 +68,8 @@ static bool map_swap_elements_at(const CoordsXY& loc, int16_t first, int16_t sec
         secondElement->SetLastForTile(!secondElement->IsLastForTile());
     }
 
+    // Which surface comes first decides the ownership of the tile
+    map_invalidate_tile_ownership();
     return true;
 }
 
@@ -387,6 +389,7 @@ GameActionResultPtr tile_inspector_paste_element_at(const CoordsXY& loc, TileEle
         bool lastForTile = pastedElement->IsLastForTile();
         *pastedElement = element;
         pastedElement->SetLastForTile(lastForTile);
+        map_invalidate_tile_element_summary(loc);
 
         map_invalidate_tile_full(loc);
 
@@ -0,0 +1,404 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+// Microbenchmarks for the engine primitives that are hot during a tick or a frame. Results are written as JSON by
+// default so runs can be compared with the tools that come with Google benchmark, e.g. compare.py.
+
+#include "TestData.h"
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/core/DataSerialiser.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/NewDrawing.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/network/NetworkPacket.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/peep/GuestPathfinding.h>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/platform/platform.h>
+#include <openrct2/rct12/SawyerChunkReader.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/Station.h>
+#include <openrct2/scenario/Scenario.h>
+#include <openrct2/util/SawyerCoding.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/Sprite.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static std::unique_ptr<IContext> _context;
+static std::string _loadedPark;
+
+// Parks are only loaded again when a benchmark needs a different one than the previous benchmark.
+static void LoadPark(const std::string& name)
+{
+    if (_loadedPark == name)
+        return;
+
+    auto path = TestData::GetParkPath(name);
+    load_from_sv6(path.c_str());
+    game_load_init();
+    _loadedPark = name;
+}
+
+static void BM_map_get_first_element_at(benchmark::State& state)
+{
+    LoadPark("bpb.sv6");
+    for (auto _ : state)
+    {
+        for (int32_t y = 0; y < gMapSize; y++)
+        {
+            for (int32_t x = 0; x < gMapSize; x++)
+            {
+                benchmark::DoNotOptimize(map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY()));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * gMapSize * gMapSize);
+}
+BENCHMARK(BM_map_get_first_element_at);
+
+static void BM_tile_element_insert(benchmark::State& state)
+{
+    LoadPark("bpb.sv6");
+    const auto loc = TileCoordsXYZ{ gMapSize / 2, gMapSize / 2, 14 }.ToCoordsXYZ();
+    for (auto _ : state)
+    {
+        auto element = tile_element_insert(loc, 0b1111);
+        benchmark::DoNotOptimize(element);
+
+        state.PauseTiming();
+        if (element != nullptr)
+            tile_element_remove(element);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_tile_element_insert);
+
+static void BM_peep_pathfind_choose_direction(benchmark::State& state)
+{
+    LoadPark("pathfinding-tests.sv6");
+
+    // The longest of the pathfinding test scenarios, see Pathfinding.cpp
+    Ride* ride = nullptr;
+    for (auto& r : GetRideManager())
+    {
+        if (r.GetName() == "SelfCrossingPath")
+            ride = &r;
+    }
+    if (ride == nullptr)
+    {
+        state.SkipWithError("Ride SelfCrossingPath not found.");
+        return;
+    }
+
+    const auto start = TileCoordsXYZ{ 6, 5, 14 };
+    auto entrancePos = ride_get_entrance_location(ride, 0);
+    const auto goal = TileCoordsXYZ(
+        entrancePos.x - TileDirectionDelta[entrancePos.direction].x,
+        entrancePos.y - TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+
+    Peep* peep = Peep::Generate(start.ToCoordsXYZ().ToTileCentre());
+    peep->OutsideOfPark = false;
+    peep->GuestHeadingToRideId = ride->id;
+    for (auto _ : state)
+    {
+        // Forget the previous search so that every iteration does the same work
+        peep->ResetPathfindGoal();
+        gPeepPathFindGoalPosition = goal;
+        benchmark::DoNotOptimize(peep_pathfind_choose_direction(start, peep));
+    }
+    peep->Remove();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_peep_pathfind_choose_direction);
+
+// Sessions keep indices into their entries so they can be copied around, these are turned into pointers before use.
+static void FixupPaintSessionPointers(std::vector<RecordedPaintSession>& sessions)
+{
+    for (auto& record : sessions)
+    {
+        const size_t nullIndex = record.Entries.size();
+        for (auto& entry : record.Entries)
+        {
+            auto nextQuadrantPs = reinterpret_cast<size_t>(entry.basic.next_quadrant_ps);
+            entry.basic.next_quadrant_ps = nextQuadrantPs == nullIndex ? nullptr : &record.Entries[nextQuadrantPs].basic;
+        }
+        for (auto& quad : record.Session.Quadrants)
+        {
+            auto quadIndex = reinterpret_cast<size_t>(quad);
+            quad = quadIndex == nullIndex ? nullptr : &record.Entries[quadIndex].basic;
+        }
+    }
+}
+
+// Paints the whole park into a viewport once, recording the sessions for sorting.
+static std::vector<RecordedPaintSession> RecordPaintSessions()
+{
+    const int32_t width = gMapSize * 32 * 2 + 8;
+    const int32_t height = gMapSize * 32 + 128;
+
+    rct_viewport viewport{};
+    viewport.width = width;
+    viewport.height = height;
+    viewport.view_width = width;
+    viewport.view_height = height;
+
+    const int32_t centreX = (gMapSize / 2) * 32 + 16;
+    const int32_t centreY = (gMapSize / 2) * 32 + 16;
+    const int32_t centreZ = tile_element_height({ centreX, centreY });
+    viewport.viewPos = { (centreY - centreX) - width / 2, ((centreX + centreY) / 2 - centreZ) - height / 2 };
+    gCurrentRotation = 0;
+    reset_all_sprite_quadrant_placements();
+
+    std::vector<uint8_t> bits(static_cast<size_t>(width) * height);
+    rct_drawpixelinfo dpi{};
+    dpi.width = width;
+    dpi.height = height;
+    dpi.bits = bits.data();
+
+    std::vector<RecordedPaintSession> sessions;
+    viewport_render(&dpi, &viewport, 0, 0, width, height, &sessions);
+    return sessions;
+}
+
+static void BM_PaintSessionArrange(benchmark::State& state)
+{
+    LoadPark("bpb.sv6");
+    auto sessions = RecordPaintSessions();
+    if (sessions.empty())
+    {
+        state.SkipWithError("No paint sessions recorded.");
+        return;
+    }
+    FixupPaintSessionPointers(sessions);
+
+    // Sorting relinks the entries, so they are restored into the same storage before every run
+    const auto original = sessions;
+    size_t numEntries = 0;
+    for (const auto& session : sessions)
+    {
+        numEntries += session.Entries.size();
+    }
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (size_t i = 0; i < sessions.size(); i++)
+        {
+            sessions[i].Session = original[i].Session;
+            std::copy(original[i].Entries.cbegin(), original[i].Entries.cend(), sessions[i].Entries.begin());
+        }
+        state.ResumeTiming();
+
+        for (auto& session : sessions)
+        {
+            PaintSessionArrange(&session.Session);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numEntries);
+}
+BENCHMARK(BM_PaintSessionArrange)->Unit(benchmark::kMillisecond);
+
+/**
+ * Builds an RLE encoded sprite with a transparent gap in the middle of every line, which is the typical shape of
+ * scenery and peep images.
+ */
+static std::vector<uint8_t> CreateRLESprite(int32_t width, int32_t height)
+{
+    const int32_t runLength = width / 3;
+    std::vector<uint8_t> data(height * 2);
+    for (int32_t y = 0; y < height; y++)
+    {
+        auto offset = static_cast<uint16_t>(data.size());
+        data[y * 2] = offset & 0xFF;
+        data[y * 2 + 1] = offset >> 8;
+
+        data.push_back(runLength);
+        data.push_back(0);
+        for (int32_t x = 0; x < runLength; x++)
+            data.push_back(static_cast<uint8_t>(10 + x));
+
+        data.push_back(runLength | 0x80);
+        data.push_back(width - runLength);
+        for (int32_t x = 0; x < runLength; x++)
+            data.push_back(static_cast<uint8_t>(10 + x));
+    }
+    return data;
+}
+
+static void BM_gfx_rle_sprite_to_buffer(benchmark::State& state)
+{
+    const int32_t size = static_cast<int32_t>(state.range(0));
+    auto spriteData = CreateRLESprite(size, size);
+
+    rct_g1_element sprite{};
+    sprite.offset = spriteData.data();
+    sprite.width = size;
+    sprite.height = size;
+    sprite.flags = G1_FLAG_RLE_COMPRESSION;
+
+    std::vector<uint8_t> bits(static_cast<size_t>(size) * size);
+    rct_drawpixelinfo dpi{};
+    dpi.width = size;
+    dpi.height = size;
+    dpi.bits = bits.data();
+
+    for (auto _ : state)
+    {
+        DrawSpriteArgs args(&dpi, ImageId(0), PaletteMap::GetDefault(), sprite, 0, 0, size, size, dpi.bits);
+        gfx_rle_sprite_to_buffer(args);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(BM_gfx_rle_sprite_to_buffer)->Arg(32)->Arg(128);
+
+static void BM_sawyercoding_rle_encode(benchmark::State& state)
+{
+    LoadPark("bpb.sv6");
+    const auto src = reinterpret_cast<const uint8_t*>(gTileElements.data());
+    const size_t length = gTileElements.size() * sizeof(TileElement);
+
+    // Runs of differing bytes grow by one byte per 125 bytes at worst
+    std::vector<uint8_t> dst(sizeof(sawyercoding_chunk_header) + length + length / 64 + 1);
+    for (auto _ : state)
+    {
+        sawyercoding_chunk_header header;
+        header.encoding = CHUNK_ENCODING_RLE;
+        header.length = static_cast<uint32_t>(length);
+        benchmark::DoNotOptimize(sawyercoding_write_chunk_buffer(dst.data(), src, header));
+    }
+    state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(BM_sawyercoding_rle_encode)->Unit(benchmark::kMillisecond);
+
+static void BM_sawyercoding_rle_decode(benchmark::State& state)
+{
+    LoadPark("bpb.sv6");
+    const auto src = reinterpret_cast<const uint8_t*>(gTileElements.data());
+    const size_t length = gTileElements.size() * sizeof(TileElement);
+
+    std::vector<uint8_t> encoded(sizeof(sawyercoding_chunk_header) + length + length / 64 + 1);
+    sawyercoding_chunk_header header;
+    header.encoding = CHUNK_ENCODING_RLE;
+    header.length = static_cast<uint32_t>(length);
+    encoded.resize(sawyercoding_write_chunk_buffer(encoded.data(), src, header));
+
+    for (auto _ : state)
+    {
+        MemoryStream ms(encoded.data(), encoded.size());
+        SawyerChunkReader reader(&ms);
+        benchmark::DoNotOptimize(reader.ReadChunk());
+    }
+    state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(BM_sawyercoding_rle_decode)->Unit(benchmark::kMillisecond);
+
+static void BM_DataSerialiser_round_trip(benchmark::State& state)
+{
+    LoadPark("bpb.sv6");
+    const size_t count = std::min<size_t>(gTileElements.size(), 4096);
+    std::vector<TileElement> elements(count);
+
+    for (auto _ : state)
+    {
+        MemoryStream stream;
+        DataSerialiser saver(true, stream);
+        for (size_t i = 0; i < count; i++)
+        {
+            saver << gTileElements[i];
+        }
+
+        stream.SetPosition(0);
+        DataSerialiser loader(false, stream);
+        for (size_t i = 0; i < count; i++)
+        {
+            loader << elements[i];
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DataSerialiser_round_trip);
+
+#ifndef DISABLE_NETWORK
+static void BM_NetworkPacket_round_trip(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        // Shaped like a game action: a few fixed fields followed by the serialised action
+        NetworkPacket packet(NetworkCommand::GameAction);
+        DataSerialiser ds(true);
+        ds << CoordsXYZD{ 1024, 2048, 112, 2 } << std::string("Benchmark");
+        packet << gCurrentTicks << uint32_t{ 1 } << uint32_t{ 0x1234 } << ds;
+        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+
+        uint32_t tick, type, id;
+        packet >> tick >> type >> id;
+        benchmark::DoNotOptimize(packet.Read(packet.Header.Size - packet.BytesRead));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NetworkPacket_round_trip);
+#endif
+
+static void BM_sprite_checksum(benchmark::State& state)
+{
+    LoadPark("bpb.sv6");
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sprite_checksum());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_sprite_checksum)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+    // JSON unless asked for something else on the command line
+    std::vector<char*> args(argv, argv + argc);
+    bool hasFormat = false;
+    for (int i = 1; i < argc; i++)
+    {
+        hasFormat |= std::strncmp(argv[i], "--benchmark_format", 18) == 0;
+    }
+    char jsonFormat[] = "--benchmark_format=json";
+    if (!hasFormat)
+    {
+        args.insert(args.begin() + 1, jsonFormat);
+    }
+    argc = static_cast<int>(args.size());
+
+    ::benchmark::Initialize(&argc, args.data());
+    if (::benchmark::ReportUnrecognizedArguments(argc, args.data()))
+        return 1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+    _context = CreateContext();
+    if (!_context->Initialise())
+        return 1;
+    drawing_engine_init();
+
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    drawing_engine_dispose();
+    _context = nullptr;
+    return 0;
+}
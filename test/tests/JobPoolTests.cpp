@@ -0,0 +1,236 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <openrct2/core/JobPool.h>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
+
+TEST(JobPoolTests, join_waits_for_all_tasks)
+{
+    constexpr size_t TaskCount = 1000;
+    std::atomic<size_t> ran = { 0 };
+
+    JobPool pool;
+    for (size_t i = 0; i < TaskCount; i++)
+    {
+        pool.AddTask([&ran]() { ran++; });
+    }
+    pool.Join();
+
+    EXPECT_EQ(ran, TaskCount);
+    EXPECT_EQ(pool.CountPending(), 0U);
+}
+
+TEST(JobPoolTests, completions_run_on_joining_thread)
+{
+    constexpr size_t TaskCount = 100;
+    std::atomic<size_t> ran = { 0 };
+    size_t completed = 0;
+    bool allOnJoiningThread = true;
+    const auto joiningThread = std::this_thread::get_id();
+
+    JobPool pool;
+    for (size_t i = 0; i < TaskCount; i++)
+    {
+        pool.AddTask(
+            [&ran]() { ran++; },
+            [&]() {
+                completed++;
+                allOnJoiningThread &= std::this_thread::get_id() == joiningThread;
+            });
+    }
+    pool.Join();
+
+    EXPECT_EQ(ran, TaskCount);
+    EXPECT_EQ(completed, TaskCount);
+    EXPECT_TRUE(allOnJoiningThread);
+}
+
+TEST(JobPoolTests, join_can_be_called_again)
+{
+    std::atomic<size_t> ran = { 0 };
+
+    JobPool pool;
+    pool.Join();
+    pool.AddTask([&ran]() { ran++; });
+    pool.Join();
+    pool.AddTask([&ran]() { ran++; });
+    pool.Join();
+
+    EXPECT_EQ(ran, 2U);
+}
+
+TEST(JobPoolTests, nested_pools)
+{
+    constexpr size_t OuterCount = 16;
+    constexpr size_t InnerCount = 64;
+    std::atomic<size_t> ran = { 0 };
+
+    JobPool outer;
+    for (size_t i = 0; i < OuterCount; i++)
+    {
+        outer.AddTask([&ran]() {
+            // Joining from within a task must not wait on the task doing the joining
+            JobPool inner;
+            for (size_t j = 0; j < InnerCount; j++)
+            {
+                inner.AddTask([&ran]() { ran++; });
+            }
+            inner.Join();
+        });
+    }
+    outer.Join();
+
+    EXPECT_EQ(ran, OuterCount * InnerCount);
+}
+
+TEST(JobPoolTests, nested_parallel_for)
+{
+    constexpr size_t OuterCount = 8;
+    constexpr size_t InnerCount = 100;
+    std::array<std::atomic<size_t>, OuterCount> sums{};
+
+    JobPool::ParallelFor(OuterCount, 1, [&sums](size_t i) {
+        JobPool::ParallelFor(InnerCount, [&sums, i](size_t j) { sums[i] += j; });
+    });
+
+    for (const auto& sum : sums)
+    {
+        EXPECT_EQ(sum, InnerCount * (InnerCount - 1) / 2);
+    }
+}
+
+TEST(JobPoolTests, parallel_for_visits_each_index_once)
+{
+    constexpr size_t Count = 10007;
+    std::vector<std::atomic<uint8_t>> visits(Count);
+
+    JobPool::ParallelFor(Count, [&visits](size_t i) { visits[i]++; });
+
+    for (size_t i = 0; i < Count; i++)
+    {
+        ASSERT_EQ(visits[i], 1) << "index " << i;
+    }
+}
+
+TEST(JobPoolTests, join_leaves_tasks_of_other_pools)
+{
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::atomic<bool> timedOut = { false };
+
+    // If joining the second pool ran this task on the joining thread it would wait here until it gives up
+    JobPool blocked;
+    blocked.AddTask([released, &timedOut]() {
+        if (released.wait_for(std::chrono::seconds(10)) == std::future_status::timeout)
+        {
+            timedOut = true;
+        }
+    });
+
+    std::atomic<size_t> ran = { 0 };
+    JobPool pool;
+    for (size_t i = 0; i < 10; i++)
+    {
+        pool.AddTask([&ran]() { ran++; });
+    }
+    pool.Join();
+    EXPECT_EQ(ran, 10U);
+
+    release.set_value();
+    blocked.Join();
+    EXPECT_FALSE(timedOut);
+}
+
+TEST(JobPoolTests, large_callables_are_kept)
+{
+    // Captures larger than the inline storage of a task are moved to the heap
+    std::array<size_t, 64> values{};
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = i;
+    }
+    std::atomic<size_t> sum = { 0 };
+
+    JobPool pool;
+    pool.AddTask([values, &sum]() {
+        for (auto value : values)
+        {
+            sum += value;
+        }
+    });
+    pool.Join();
+
+    EXPECT_EQ(sum, values.size() * (values.size() - 1) / 2);
+}
+
+#ifndef _WIN32
+static int WaitForExitCode(pid_t pid)
+{
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status))
+        return -1;
+    return WEXITSTATUS(status);
+}
+
+TEST(JobPoolTests, pool_works_on_both_sides_of_fork)
+{
+    std::atomic<size_t> ran = { 0 };
+    JobPool::ParallelFor(100, [&ran](size_t) { ran++; });
+    ASSERT_EQ(ran, 100U);
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0)
+    {
+        std::atomic<size_t> childRan = { 0 };
+        JobPool::ParallelFor(100, [&childRan](size_t) { childRan++; });
+        _exit(childRan == 100 ? 0 : 1);
+    }
+
+    JobPool::ParallelFor(100, [&ran](size_t) { ran++; });
+    EXPECT_EQ(ran, 200U);
+    EXPECT_EQ(WaitForExitCode(pid), 0);
+}
+
+TEST(JobPoolTests, fork_from_task_does_not_stop_workers)
+{
+    // Stopping the workers here would wait on the worker that forks
+    std::promise<int> exitCode;
+    auto exited = exitCode.get_future();
+    JobPool pool;
+    pool.AddTask([&exitCode]() {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            _exit(0);
+        }
+        exitCode.set_value(pid != -1 ? WaitForExitCode(pid) : -1);
+    });
+
+    // Waited for before joining so that the task runs on a worker rather than on this thread
+    ASSERT_EQ(exited.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    pool.Join();
+    EXPECT_EQ(exited.get(), 0);
+
+    std::atomic<size_t> ran = { 0 };
+    JobPool::ParallelFor(100, [&ran](size_t) { ran++; });
+    EXPECT_EQ(ran, 100U);
+}
+#endif
@@ -0,0 +1,304 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <openrct2/network/NetworkConnection.h>
+#include <openrct2/network/NetworkIoThread.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A connected socket whose other end is the test, shared with the I/O thread
+class FakeTcpSocket final : public ITcpSocket
+{
+public:
+    void Feed(const std::vector<uint8_t>& bytes)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _incoming.insert(_incoming.end(), bytes.begin(), bytes.end());
+    }
+
+    void CloseRemote()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _remoteClosed = true;
+    }
+
+    std::vector<uint8_t> TakeSent()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return std::move(_sent);
+    }
+
+    size_t GetPendingIncoming()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _incoming.size();
+    }
+
+    SocketStatus GetStatus() const override
+    {
+        return SocketStatus::Connected;
+    }
+    const char* GetError() const override
+    {
+        return nullptr;
+    }
+    const char* GetHostName() const override
+    {
+        return "test";
+    }
+    std::string GetIpAddress() const override
+    {
+        return "127.0.0.1";
+    }
+
+    void Listen(uint16_t port) override
+    {
+    }
+    void Listen(const std::string& address, uint16_t port) override
+    {
+    }
+    std::unique_ptr<ITcpSocket> Accept() override
+    {
+        return nullptr;
+    }
+
+    void Connect(const std::string& address, uint16_t port) override
+    {
+    }
+    void ConnectAsync(const std::string& address, uint16_t port) override
+    {
+    }
+
+    size_t SendData(const void* buffer, size_t size) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto bytes = static_cast<const uint8_t*>(buffer);
+        _sent.insert(_sent.end(), bytes, bytes + size);
+        return size;
+    }
+
+    NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        *sizeReceived = 0;
+        if (_incoming.empty())
+        {
+            return _remoteClosed ? NetworkReadPacket::Disconnected : NetworkReadPacket::NoData;
+        }
+        size = std::min(size, _incoming.size());
+        std::memcpy(buffer, _incoming.data(), size);
+        _incoming.erase(_incoming.begin(), _incoming.begin() + size);
+        *sizeReceived = size;
+        return NetworkReadPacket::Success;
+    }
+
+    void SetNoDelay(bool noDelay) override
+    {
+    }
+
+    void Finish() override
+    {
+    }
+    void Disconnect() override
+    {
+    }
+    void Close() override
+    {
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<uint8_t> _incoming;
+    std::vector<uint8_t> _sent;
+    bool _remoteClosed = false;
+};
+
+class NetworkIoThreadTests : public testing::Test
+{
+protected:
+    static NetworkPacket MakeChatPacket(const std::string& text)
+    {
+        NetworkPacket packet(NetworkCommand::Chat);
+        packet.WriteString(text.c_str());
+        return packet;
+    }
+
+    // Frames packets the way a peer sends them, by sending them through a connection of its own
+    static std::vector<uint8_t> Frame(const std::vector<NetworkPacket>& packets)
+    {
+        NetworkConnection peer;
+        peer.AuthStatus = NetworkAuth::Ok;
+        auto socket = std::make_unique<FakeTcpSocket>();
+        auto socketPtr = socket.get();
+        peer.Socket = std::move(socket);
+        for (const auto& packet : packets)
+        {
+            peer.QueuePacket(packet);
+        }
+        peer.SendQueuedPackets();
+        return socketPtr->TakeSent();
+    }
+
+    static bool WaitFor(const std::function<bool()>& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    static std::string ReadChatText(NetworkPacket& packet)
+    {
+        auto text = packet.ReadString();
+        return text != nullptr ? text : "";
+    }
+};
+
+TEST_F(NetworkIoThreadTests, received_packets_are_framed_in_order)
+{
+    NetworkConnection connection;
+    auto socket = std::make_unique<FakeTcpSocket>();
+    auto socketPtr = socket.get();
+    connection.Socket = std::move(socket);
+
+    NetworkIoThread ioThread;
+    ioThread.Add(connection);
+    ASSERT_TRUE(connection.IsServicedByIoThread());
+
+    auto bytes = Frame({ MakeChatPacket("one"), MakeChatPacket("two"), MakeChatPacket("three") });
+    // Split a packet over two reads, the thread has to keep the partial packet until the rest comes in
+    const size_t split = bytes.size() - 3;
+    socketPtr->Feed(std::vector<uint8_t>(bytes.begin(), bytes.begin() + split));
+
+    std::vector<NetworkPacket> packets;
+    ASSERT_TRUE(WaitFor([&]() {
+        connection.TakeReceivedPackets(packets, 16);
+        return packets.size() == 2;
+    }));
+    socketPtr->Feed(std::vector<uint8_t>(bytes.begin() + split, bytes.end()));
+    ASSERT_TRUE(WaitFor([&]() {
+        connection.TakeReceivedPackets(packets, 16);
+        return packets.size() == 3;
+    }));
+
+    EXPECT_EQ(ReadChatText(packets[0]), "one");
+    EXPECT_EQ(ReadChatText(packets[1]), "two");
+    EXPECT_EQ(ReadChatText(packets[2]), "three");
+    for (const auto& packet : packets)
+    {
+        EXPECT_EQ(packet.GetCommand(), NetworkCommand::Chat);
+    }
+
+    ioThread.Remove(connection);
+    EXPECT_FALSE(connection.IsServicedByIoThread());
+}
+
+TEST_F(NetworkIoThreadTests, take_is_limited)
+{
+    NetworkConnection connection;
+    auto socket = std::make_unique<FakeTcpSocket>();
+    auto socketPtr = socket.get();
+    connection.Socket = std::move(socket);
+
+    NetworkIoThread ioThread;
+    ioThread.Add(connection);
+
+    std::vector<NetworkPacket> sent;
+    for (int32_t i = 0; i < 10; i++)
+    {
+        sent.push_back(MakeChatPacket(std::to_string(i)));
+    }
+    socketPtr->Feed(Frame(sent));
+    ASSERT_TRUE(WaitFor([&]() { return socketPtr->GetPendingIncoming() == 0; }));
+
+    std::vector<NetworkPacket> packets;
+    ASSERT_TRUE(WaitFor([&]() {
+        packets.clear();
+        connection.TakeReceivedPackets(packets, 4);
+        return !packets.empty();
+    }));
+    ASSERT_LE(packets.size(), 4U);
+    ASSERT_TRUE(WaitFor([&]() {
+        connection.TakeReceivedPackets(packets, 4);
+        return packets.size() == sent.size();
+    }));
+    for (size_t i = 0; i < packets.size(); i++)
+    {
+        EXPECT_EQ(ReadChatText(packets[i]), std::to_string(i));
+    }
+
+    ioThread.Remove(connection);
+}
+
+TEST_F(NetworkIoThreadTests, queued_packets_are_sent)
+{
+    NetworkConnection connection;
+    auto socket = std::make_unique<FakeTcpSocket>();
+    auto socketPtr = socket.get();
+    connection.Socket = std::move(socket);
+
+    connection.AuthStatus = NetworkAuth::Ok;
+
+    NetworkIoThread ioThread;
+    ioThread.Add(connection);
+
+    const auto expected = Frame({ MakeChatPacket("hello"), MakeChatPacket("world") });
+    ASSERT_FALSE(expected.empty());
+    connection.QueuePacket(MakeChatPacket("hello"));
+    connection.QueuePacket(MakeChatPacket("world"));
+    ioThread.Wake();
+
+    std::vector<uint8_t> sent;
+    ASSERT_TRUE(WaitFor([&]() {
+        auto bytes = socketPtr->TakeSent();
+        sent.insert(sent.end(), bytes.begin(), bytes.end());
+        return sent.size() >= expected.size();
+    }));
+    EXPECT_EQ(sent, expected);
+    EXPECT_EQ(connection.GetQueuedPacketCount(), 0U);
+
+    const auto stats = connection.GetStats();
+    EXPECT_EQ(stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)], expected.size());
+
+    ioThread.Remove(connection);
+}
+
+TEST_F(NetworkIoThreadTests, closed_after_last_packet)
+{
+    NetworkConnection connection;
+    auto socket = std::make_unique<FakeTcpSocket>();
+    auto socketPtr = socket.get();
+    connection.Socket = std::move(socket);
+
+    NetworkIoThread ioThread;
+    ioThread.Add(connection);
+
+    socketPtr->Feed(Frame({ MakeChatPacket("bye") }));
+    socketPtr->CloseRemote();
+
+    // The packet read before the socket closed still has to be handed out before the connection counts as closed
+    std::vector<NetworkPacket> packets;
+    ASSERT_TRUE(WaitFor([&]() { return socketPtr->GetPendingIncoming() == 0; }));
+    ASSERT_TRUE(WaitFor([&]() { return !connection.TakeReceivedPackets(packets, 16); }));
+    ASSERT_EQ(packets.size(), 1U);
+    EXPECT_EQ(ReadChatText(packets[0]), "bye");
+
+    ioThread.Remove(connection);
+}
@@ -15,11 +15,14 @@
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ReplayManager.h>
+#include <openrct2/TickProfiler.h>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
+#include <openrct2/core/Json.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/platform/Platform2.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
 #include <string>
@@ -64,6 +67,122 @@ static std::vector<ReplayTestData> GetReplayFiles()
     return res;
 }
 
+// Stages faster than this per tick are too noisy to compare, in seconds
+static constexpr double PerformanceNoiseFloor = 2e-6;
+static constexpr double DefaultPerformanceTolerance = 0.2;
+
+struct ReplayTimings
+{
+    uint32_t Ticks{};
+    double Total{};
+    std::array<double, TickProfiler::StageCount> Stages{};
+
+    void Add(const TickProfiler::TickSample& sample)
+    {
+        Ticks++;
+        Total += sample.Total;
+        for (size_t i = 0; i < Stages.size(); i++)
+        {
+            Stages[i] += sample.Time[i];
+        }
+    }
+
+    double GetTicksPerSecond() const
+    {
+        return Total > 0 ? Ticks / Total : 0;
+    }
+
+    double GetStageMean(size_t stage) const
+    {
+        return Ticks > 0 ? Stages[stage] / Ticks : 0;
+    }
+};
+
+/**
+ * Timings are only looked at when OPENRCT2_REPLAY_PERF is set, as they depend on the machine the tests run on. With
+ * "record" the timings of each replay are written next to it as its thresholds, with "check" the replays fail when
+ * they run slower than their thresholds allow.
+ */
+static std::string GetPerformanceMode()
+{
+    return Platform::GetEnvironmentVariable("OPENRCT2_REPLAY_PERF");
+}
+
+static std::string GetThresholdsPath(const std::string& replayFile)
+{
+    return replayFile + ".perf.json";
+}
+
+static void RecordThresholds(const std::string& replayFile, const ReplayTimings& timings)
+{
+    json_t stages = json_t::object();
+    for (size_t i = 0; i < TickProfiler::StageCount; i++)
+    {
+        auto name = std::string(TickProfiler::GetStageName(static_cast<TickProfiler::Stage>(i)));
+        stages[name] = timings.GetStageMean(i);
+    }
+
+    json_t thresholds = {
+        { "tolerance", DefaultPerformanceTolerance },
+        { "ticksPerSecond", timings.GetTicksPerSecond() },
+        { "stages", stages },
+    };
+    Json::WriteToFile(GetThresholdsPath(replayFile).c_str(), thresholds);
+}
+
+static void CheckThresholds(const std::string& replayFile, const ReplayTimings& timings)
+{
+    auto path = GetThresholdsPath(replayFile);
+    if (!File::Exists(path))
+    {
+        log_warning(
+            "No performance thresholds for %s, run with OPENRCT2_REPLAY_PERF=record to create them.", replayFile.c_str());
+        return;
+    }
+
+    auto thresholds = Json::ReadFromFile(path.c_str());
+    const double tolerance = Json::GetNumber<double>(thresholds["tolerance"], DefaultPerformanceTolerance);
+
+    bool failed = false;
+    std::string report = String::StdFormat("Performance of %s (tolerance %.0f%%):\n", replayFile.c_str(), tolerance * 100);
+
+    const double ticksPerSecond = timings.GetTicksPerSecond();
+    const double expectedTicksPerSecond = Json::GetNumber<double>(thresholds["ticksPerSecond"]);
+    if (expectedTicksPerSecond > 0)
+    {
+        const bool slower = ticksPerSecond * (1 + tolerance) < expectedTicksPerSecond;
+        failed |= slower;
+        report += String::StdFormat(
+            "  %-20s %10.1f ticks/s, expected %10.1f%s\n", "total", ticksPerSecond, expectedTicksPerSecond,
+            slower ? "  SLOWER" : "");
+    }
+
+    const auto& stages = thresholds["stages"];
+    for (size_t i = 0; i < TickProfiler::StageCount; i++)
+    {
+        auto name = std::string(TickProfiler::GetStageName(static_cast<TickProfiler::Stage>(i)));
+        if (!stages.is_object() || !stages.contains(name))
+            continue;
+
+        const double expected = Json::GetNumber<double>(stages[name]);
+        const double actual = timings.GetStageMean(i);
+        if (std::max(expected, actual) < PerformanceNoiseFloor)
+            continue;
+
+        const bool slower = actual > std::max(expected, PerformanceNoiseFloor) * (1 + tolerance);
+        failed |= slower;
+        report += String::StdFormat(
+            "  %-20s %10.2f us/tick, expected %10.2f%s\n", name.c_str(), actual * 1e6, expected * 1e6,
+            slower ? "  SLOWER" : "");
+    }
+
+    printf("%s", report.c_str());
+    if (failed)
+    {
+        ADD_FAILURE() << report;
+    }
+}
+
 class ReplayTests : public testing::TestWithParam<ReplayTestData>
 {
 protected:
@@ -95,10 +214,26 @@ TEST_P(ReplayTests, RunReplay)
     bool startedReplay = replayManager->StartPlayback(replayFile);
     ASSERT_TRUE(startedReplay);
 
+    const auto perfMode = GetPerformanceMode();
+    ReplayTimings timings;
     while (replayManager->IsReplaying())
     {
         gs->UpdateLogic();
         ASSERT_TRUE(replayManager->IsPlaybackStateMismatching() == false);
+        if (!perfMode.empty())
+        {
+            timings.Add(TickProfiler::GetSamples().back());
+        }
+    }
+    ASSERT_FALSE(replayManager->GetFirstPlaybackMismatch().has_value());
+
+    if (perfMode == "record")
+    {
+        RecordThresholds(replayFile, timings);
+    }
+    else if (perfMode == "check")
+    {
+        CheckThresholds(replayFile, timings);
     }
 #endif
 }
@@ -44,6 +44,14 @@ protected:
         }
     }
 
+    void ClearRatings()
+    {
+        for (auto& ride : GetRideManager())
+        {
+            ride.ratings = { RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED, RIDE_RATING_UNDEFINED };
+        }
+    }
+
     std::string FormatRatings(const Ride& ride)
     {
         RatingTuple ratings = ride.ratings;
@@ -88,3 +96,37 @@ TEST_F(RideRatings, all)
         expI++;
     }
 }
+
+TEST_F(RideRatings, cached)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    load_from_sv6(path.c_str());
+    ASSERT_EQ(ride_get_count(), 134);
+
+    // The second pass reuses the proximity walks of the first
+    CalculateRatingsForAllRides();
+    ClearRatings();
+    CalculateRatingsForAllRides();
+
+    auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
+    auto expectedRatings = File::ReadAllLines(expectedDataPath);
+
+    int expI = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        auto actual = FormatRatings(ride);
+        auto expected = expectedRatings[expI];
+        ASSERT_STREQ(actual.c_str(), expected.c_str());
+
+        expI++;
+    }
+}
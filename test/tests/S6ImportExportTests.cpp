@@ -9,6 +9,7 @@
 
 #include "TestData.h"
 
+#include <cstring>
 #include <gtest/gtest.h>
 #include <openrct2/Cheats.h>
 #include <openrct2/Context.h>
@@ -571,6 +572,48 @@ TEST(S6ImportExportAdvanceTicks, all)
     SUCCEED();
 }
 
+// Dormant rides must end up in exactly the same state as rides that are updated every tick
+TEST(S6ImportExportDormantRides, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+
+    MemoryStream importBuffer;
+    std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+    ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+
+    MemoryStream exportBuffers[2];
+    std::unique_ptr<GameState_t> states[2];
+    for (size_t run = 0; run < 2; run++)
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        ASSERT_TRUE(ImportSave(importBuffer, context, false));
+        auto* gameState = context->GetGameState();
+        for (uint32_t i = 0; i < 3000; i++)
+        {
+            // Waking every ride before each tick updates all of them every tick
+            if (run == 1)
+                Ride::WakeAll();
+            gameState->UpdateLogic();
+        }
+        ASSERT_TRUE(ExportSave(exportBuffers[run], context));
+
+        states[run] = GetGameState(context);
+        ASSERT_NE(states[run], nullptr);
+    }
+
+    CompareStates(exportBuffers[0], exportBuffers[1], states[0], states[1]);
+    ASSERT_EQ(exportBuffers[0].GetLength(), exportBuffers[1].GetLength());
+    EXPECT_EQ(std::memcmp(exportBuffers[0].GetData(), exportBuffers[1].GetData(), exportBuffers[0].GetLength()), 0);
+}
+
 TEST(SeaDecrypt, DecryptSea)
 {
     auto path = TestData::GetParkPath("volcania.sea");
@@ -0,0 +1,123 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/world/TileElementStore.h>
+#include <utility>
+
+static bool IsZeroed(const TileElement& element)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&element);
+    return std::all_of(bytes, bytes + sizeof(TileElement), [](uint8_t b) { return b == 0; });
+}
+
+TEST(TileElementStoreTests, empty)
+{
+    TileElementStore store;
+    EXPECT_EQ(store.size(), 0U);
+    EXPECT_EQ(store.begin(), store.end());
+}
+
+TEST(TileElementStoreTests, growth_zeroes_new_elements)
+{
+    TileElementStore store(16);
+    ASSERT_EQ(store.size(), 16U);
+    for (const auto& element : store)
+    {
+        EXPECT_TRUE(IsZeroed(element));
+    }
+
+    store.resize(4096);
+    ASSERT_EQ(store.size(), 4096U);
+    for (const auto& element : store)
+    {
+        EXPECT_TRUE(IsZeroed(element));
+    }
+}
+
+TEST(TileElementStoreTests, growth_keeps_pointers)
+{
+    TileElementStore store(16);
+    TileElement* first = store.data();
+    TileElement* last = &store[15];
+    first->base_height = 12;
+    last->base_height = 34;
+
+    // Growing well past the first pages must not move the elements
+    for (size_t size = 32; size <= 1u << 20 && size <= TileElementStore::max_size(); size *= 2)
+    {
+        store.resize(size);
+        ASSERT_EQ(store.data(), first);
+        ASSERT_EQ(&store[15], last);
+    }
+    EXPECT_EQ(first->base_height, 12);
+    EXPECT_EQ(last->base_height, 34);
+}
+
+TEST(TileElementStoreTests, shrink_then_grow_zeroes)
+{
+    TileElementStore store(1024);
+    for (auto& element : store)
+    {
+        element.base_height = 0xFF;
+    }
+
+    store.resize(8);
+    ASSERT_EQ(store.size(), 8U);
+    store.resize(1024);
+    ASSERT_EQ(store.size(), 1024U);
+    for (size_t i = 0; i < store.size(); i++)
+    {
+        EXPECT_EQ(store[i].base_height, i < 8 ? 0xFF : 0) << "element " << i;
+    }
+}
+
+TEST(TileElementStoreTests, resize_is_limited_to_max_size)
+{
+    TileElementStore store;
+    store.resize(TileElementStore::max_size() + 1);
+    EXPECT_EQ(store.size(), TileElementStore::max_size());
+}
+
+TEST(TileElementStoreTests, assign_replaces_contents)
+{
+    TileElementStore store(64);
+    for (auto& element : store)
+    {
+        element.base_height = 1;
+    }
+
+    store.assign(32);
+    ASSERT_EQ(store.size(), 32U);
+    for (const auto& element : store)
+    {
+        EXPECT_TRUE(IsZeroed(element));
+    }
+}
+
+TEST(TileElementStoreTests, move_keeps_elements)
+{
+    TileElementStore store(64);
+    store[10].base_height = 56;
+    TileElement* elements = store.data();
+
+    TileElementStore moved(std::move(store));
+    EXPECT_EQ(moved.data(), elements);
+    EXPECT_EQ(moved.size(), 64U);
+    EXPECT_EQ(moved[10].base_height, 56);
+    EXPECT_EQ(store.size(), 0U);
+    EXPECT_EQ(store.data(), nullptr);
+
+    TileElementStore assigned(8);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.data(), elements);
+    EXPECT_EQ(assigned.size(), 64U);
+    EXPECT_EQ(moved.size(), 0U);
+}
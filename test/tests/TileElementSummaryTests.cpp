@@ -0,0 +1,148 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/world/Footpath.h>
+#include <openrct2/world/Map.h>
+#include <optional>
+
+using namespace OpenRCT2;
+
+class TileElementSummaryTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        std::string parkPath = TestData::GetParkPath("tile-element-tests.sv6");
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+        SUCCEED();
+    }
+
+    static void TearDownTestCase()
+    {
+        if (_context)
+            _context.reset();
+    }
+
+    static bool TileHasType(const CoordsXY& loc, uint8_t type)
+    {
+        const TileElement* tileElement = map_get_first_element_at(loc);
+        if (tileElement == nullptr)
+            return false;
+        do
+        {
+            if (tileElement->GetType() == type)
+                return true;
+        } while (!(tileElement++)->IsLastForTile());
+        return false;
+    }
+
+    // First tile that has an element of withType and none of withoutType
+    static std::optional<CoordsXY> FindTile(std::optional<uint8_t> withType, uint8_t withoutType)
+    {
+        for (int32_t y = 1; y < gMapSize - 1; y++)
+        {
+            for (int32_t x = 1; x < gMapSize - 1; x++)
+            {
+                const auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+                if ((!withType.has_value() || TileHasType(loc, *withType)) && !TileHasType(loc, withoutType))
+                {
+                    return loc;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> TileElementSummaryTests::_context;
+
+TEST_F(TileElementSummaryTests, summary_covers_all_elements)
+{
+    // The summaries may report types a tile no longer has, but never miss one it does have
+    for (int32_t y = 0; y < gMapSize; y++)
+    {
+        for (int32_t x = 0; x < gMapSize; x++)
+        {
+            const auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+            const TileElement* tileElement = map_get_first_element_at(loc);
+            if (tileElement == nullptr)
+                continue;
+            do
+            {
+                ASSERT_TRUE(map_tile_may_contain(loc, tileElement->GetType())) << "tile " << x << ", " << y;
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+}
+
+TEST_F(TileElementSummaryTests, insert_invalidates_tile)
+{
+    const auto loc = FindTile(std::nullopt, TILE_ELEMENT_TYPE_WALL);
+    ASSERT_TRUE(loc.has_value());
+    ASSERT_FALSE(map_tile_may_contain(*loc, TILE_ELEMENT_TYPE_WALL));
+
+    auto* surfaceElement = map_get_surface_element_at(*loc);
+    ASSERT_NE(surfaceElement, nullptr);
+    auto* wallElement = tile_element_insert({ *loc, surfaceElement->GetBaseZ() }, 0b0001);
+    ASSERT_NE(wallElement, nullptr);
+
+    // Written directly so only the insert itself can have dropped the summary of the tile
+    wallElement->type = TILE_ELEMENT_TYPE_WALL;
+    EXPECT_TRUE(map_tile_may_contain(*loc, TILE_ELEMENT_TYPE_WALL));
+
+    tile_element_remove(wallElement);
+}
+
+TEST_F(TileElementSummaryTests, set_type_invalidates)
+{
+    const auto loc = FindTile(TILE_ELEMENT_TYPE_PATH, TILE_ELEMENT_TYPE_WALL);
+    ASSERT_TRUE(loc.has_value());
+    ASSERT_TRUE(map_tile_may_contain(*loc, TILE_ELEMENT_TYPE_PATH));
+    ASSERT_FALSE(map_tile_may_contain(*loc, TILE_ELEMENT_TYPE_WALL));
+
+    TileElement* pathElement = map_get_first_element_at(*loc);
+    while (pathElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+    {
+        pathElement++;
+    }
+
+    pathElement->SetType(TILE_ELEMENT_TYPE_WALL);
+    EXPECT_TRUE(map_tile_may_contain(*loc, TILE_ELEMENT_TYPE_WALL));
+
+    pathElement->SetType(TILE_ELEMENT_TYPE_PATH);
+    EXPECT_TRUE(map_tile_may_contain(*loc, TILE_ELEMENT_TYPE_PATH));
+}
+
+TEST_F(TileElementSummaryTests, lookups_skip_tiles_without_type)
+{
+    const auto loc = FindTile(std::nullopt, TILE_ELEMENT_TYPE_PATH);
+    ASSERT_TRUE(loc.has_value());
+    EXPECT_FALSE(map_tile_may_contain(*loc, TILE_ELEMENT_TYPE_PATH));
+
+    auto* surfaceElement = map_get_surface_element_at(*loc);
+    ASSERT_NE(surfaceElement, nullptr);
+    EXPECT_EQ(map_get_footpath_element({ *loc, surfaceElement->GetBaseZ() }), nullptr);
+}
@@ -11,6 +11,7 @@
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -76,6 +77,30 @@ TEST_F(SawyerCodingTest, write_read_chunk_rle_compressed)
     test_encode_decode(CHUNK_ENCODING_RLECOMPRESSED);
 }
 
+TEST_F(SawyerCodingTest, write_read_chunk_rle_compressed_repeating)
+{
+    // Random data hardly has any repeats, so also check data where most bytes can be copied from earlier ones
+    std::vector<uint8_t> data(8192);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = (i % 61) < 40 ? static_cast<uint8_t>(i % 7) : randomdata[i % sizeof(randomdata)];
+    }
+
+    sawyercoding_chunk_header chdr_in;
+    chdr_in.encoding = CHUNK_ENCODING_RLECOMPRESSED;
+    chdr_in.length = static_cast<uint32_t>(data.size());
+    std::vector<uint8_t> encodedData(BUFFER_SIZE);
+    size_t encodedDataSize = sawyercoding_write_chunk_buffer(encodedData.data(), data.data(), chdr_in);
+    ASSERT_GT(encodedDataSize, sizeof(sawyercoding_chunk_header));
+    ASSERT_LT(encodedDataSize, data.size());
+
+    OpenRCT2::MemoryStream ms(encodedData.data(), encodedDataSize);
+    SawyerChunkReader reader(&ms);
+    auto chunk = reader.ReadChunk();
+    ASSERT_EQ(chunk->GetLength(), data.size());
+    ASSERT_EQ(memcmp(chunk->GetData(), data.data(), data.size()), 0);
+}
+
 TEST_F(SawyerCodingTest, write_read_chunk_rotate)
 {
     test_encode_decode(CHUNK_ENCODING_ROTATE);